@@ -31,12 +31,18 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/Triple.h>
 
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/SceneTools/AbsoluteTransformations.h"
+#include "Magnum/SceneTools/BoundingVolumeHierarchy.h"
 #include "Magnum/SceneTools/Filter.h"
 #include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/MeshInstances.h"
+#include "Magnum/SceneTools/SceneBuilder.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -167,4 +173,96 @@ for(const Containers::Pair<UnsignedInt, Int>& parent:
 }
 /* [parentsBreadthFirst-transformations] */
 }
+
+{
+/* [AbsoluteTransformations-update] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+SceneTools::AbsoluteTransformations3D absolute{scene};
+
+/* Animate a few objects by modifying their transformations in-place */
+UnsignedInt animatedObjects[]{DOXYGEN_ELLIPSIS(0)};
+Containers::StridedArrayView1D<Matrix4> localTransformations =
+    scene.mutableField<Matrix4>(Trade::SceneField::Transformation);
+for(UnsignedInt object: animatedObjects)
+    localTransformations[scene.fieldObjectOffset(
+        Trade::SceneField::Transformation, object)] = DOXYGEN_ELLIPSIS({});
+
+/* Recalculate absolute transformations just for the animated objects and
+   their children */
+absolute.update(animatedObjects);
+Containers::ArrayView<const Matrix4> transformations = absolute.transformations();
+/* [AbsoluteTransformations-update] */
+static_cast<void>(transformations);
+}
+
+{
+/* [BoundingVolumeHierarchy-usage] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+Containers::Array<Trade::MeshData> meshes = DOXYGEN_ELLIPSIS({});
+
+/* Bounds of all meshes referenced by the scene */
+Containers::Array<Range3D> meshBounds{NoInit, meshes.size()};
+for(std::size_t i = 0; i != meshes.size(); ++i)
+    meshBounds[i] = MeshTools::boundingRange(meshes[i].positions3DAsArray());
+
+SceneTools::BoundingVolumeHierarchy bvh{scene, meshBounds};
+
+/* Get objects visible by the camera, reusing the output array across
+   frames */
+Matrix4 projection = DOXYGEN_ELLIPSIS({});
+Matrix4 cameraTransformation = DOXYGEN_ELLIPSIS({});
+Containers::Array<UnsignedInt> visible{NoInit, bvh.instanceCount()};
+std::size_t visibleCount = bvh.objectsInFrustumInto(
+    Frustum::fromMatrix(projection*cameraTransformation.inverted()), visible);
+/* [BoundingVolumeHierarchy-usage] */
+static_cast<void>(visibleCount);
+}
+
+{
+/* [groupMeshInstances] */
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+
+/* Group the meshes and calculate a transformation for each instance */
+Trade::SceneData grouped = SceneTools::groupMeshInstances(scene);
+Containers::Array<Matrix4> transformations =
+    SceneTools::absoluteFieldTransformations3D(grouped, Trade::SceneField::Mesh);
+
+std::size_t offset = 0;
+for(const Containers::Triple<UnsignedInt, Int, UnsignedInt>& run:
+    SceneTools::meshInstanceRuns(grouped))
+{
+    Containers::ArrayView<const Matrix4> instanceTransformations =
+        transformations.sliceSize(offset, run.third());
+
+    /* Draw mesh run.first() with material run.second() once for each item in
+       instanceTransformations */
+    DOXYGEN_ELLIPSIS(static_cast<void>(instanceTransformations);)
+
+    offset += run.third();
+}
+/* [groupMeshInstances] */
+}
+
+{
+/* [SceneBuilder-usage] */
+SceneTools::SceneBuilder builder;
+UnsignedInt parent = builder.addField(Trade::SceneField::Parent,
+    Trade::SceneFieldType::Int);
+UnsignedInt mesh = builder.addField(Trade::SceneField::Mesh,
+    Trade::SceneFieldType::UnsignedInt);
+UnsignedInt material = builder.addField(mesh, Trade::SceneField::MeshMaterial,
+    Trade::SceneFieldType::Int);
+
+UnsignedInt root = builder.addObject();
+builder.addEntry(parent, root, Int{-1});
+
+UnsignedInt child = builder.addObject();
+builder.addEntry(parent, child, Int(root));
+std::size_t id = builder.addEntry(mesh, child, 3u);
+builder.mutableField<Int>(material)[id] = 5;
+
+Trade::SceneData scene = builder.build();
+/* [SceneBuilder-usage] */
+static_cast<void>(scene);
+}
 }
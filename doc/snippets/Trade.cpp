@@ -30,11 +30,13 @@
 
 #include <unordered_map>
 #include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/DebugStl.h>
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/Resource.h>
@@ -46,15 +48,23 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Animation/Player.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Swizzle.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/Quantize.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 #include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
+#include "Magnum/Trade/ImportCache.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -249,8 +259,75 @@ importer->setFileCallback([](const std::string& filename,
 importer->openFile("scene.gltf"); // memory-maps all files
 /* [AbstractImporter-usage-callbacks] */
 }
+
+{
+/* [MagnumImporter-zero-copy] */
+PluginManager::Manager<Trade::AbstractImporter> manager;
+Containers::Pointer<Trade::AbstractImporter> importer =
+    manager.loadAndInstantiate("MagnumImporter");
+
+Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>>
+    data = Utility::Path::mapRead("scene.blob");
+if(!data || !importer->openMemory(*data))
+    Fatal{} << "Can't open scene.blob with MagnumImporter";
+
+/* The mesh references the mapped memory directly */
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+/* [MagnumImporter-zero-copy] */
+static_cast<void>(mesh);
+}
+
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [AbstractImporter-usage-chunks] */
+Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>>
+    data = Utility::Path::mapRead("terrain.obj");
+if(!data || !importer->openMemory(*data))
+    Fatal{} << "Can't open terrain.obj";
+
+/* First pass calculates bounds of the whole mesh chunk by chunk */
+Containers::Optional<Range3D> bounds;
+importer->meshChunks(0, 0, 64*1024*1024,
+    [](Trade::MeshData&& chunk, Containers::Optional<Range3D>& bounds) {
+        const Containers::Array<Vector3> positions = chunk.positions3DAsArray();
+        const Range3D chunkBounds = MeshTools::boundingRange(positions);
+        bounds = bounds ? Math::join(*bounds, chunkBounds) : chunkBounds;
+        return true;
+    }, bounds);
+
+/* Second pass quantizes all chunks to the same range */
+importer->meshChunks(0, 0, 64*1024*1024,
+    [](Trade::MeshData&& chunk, Range3D& bounds) {
+        Trade::MeshData quantized = MeshTools::quantizePositions(chunk, bounds);
+        DOXYGEN_ELLIPSIS(static_cast<void>(quantized);)
+        return true;
+    }, *bounds);
+
+/* Transformation to render the quantized chunks with */
+Matrix4 transformation = MeshTools::quantizePositionsTransformation(*bounds);
+/* [AbstractImporter-usage-chunks] */
+static_cast<void>(transformation);
+}
 #endif
 
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [AbstractImporter-usage-probing] */
+Containers::Pointer<Trade::AbstractImporter> importer =
+    manager.loadAndInstantiate("AnyImageImporter");
+importer->configuration().setValue("probe", true);
+
+for(const char* filename: {"brick.png", "grass.tga", "sky.dds"}) {
+    if(!importer->openFile(filename)) continue;
+
+    Containers::Optional<Trade::ImageProperties2D> properties =
+        importer->image2DProperties(0);
+    if(properties && !properties->isCompressed())
+        Debug{} << filename << properties->size() << properties->format();
+}
+/* [AbstractImporter-usage-probing] */
+}
+
 {
 /* -Wnonnull in GCC 11+  "helpfully" says "this is null" if I don't initialize
    the converter pointer. I don't care, I just want you to check compilation
@@ -379,6 +456,114 @@ if(!converter->addSupportedImporterContents(*importer, ~Trade::SceneContent::Mes
 /* [AbstractSceneConverter-usage-multiple-file-selective] */
 }
 
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [AsyncImporter-usage] */
+/* Zero thread count picks the number of hardware threads */
+Trade::AsyncImporter importer{manager, "GltfImporter", 0};
+if(!importer.openFile("scene.gltf"))
+    Fatal{} << "Can't open scene.gltf";
+
+/* Queue all images, the first one with a higher priority */
+Containers::Array<UnsignedInt> jobs;
+for(UnsignedInt i = 0; i != importer.importer().image2DCount(); ++i)
+    arrayAppend(jobs, importer.loadImage2D(i, 0, i == 0 ? 1 : 0));
+
+/* Take the results as they get done, waiting for them if needed */
+for(UnsignedInt job: jobs) {
+    Containers::Optional<Trade::ImageData2D> image = importer.takeImage2D(job);
+    if(!image) continue;
+
+    // use the image ...
+}
+/* [AsyncImporter-usage] */
+}
+
+{
+PluginManager::Manager<Trade::AbstractImporter> importerManager;
+PluginManager::Manager<Trade::AbstractSceneConverter> converterManager;
+/* [ImportCache-usage] */
+Trade::ImportCache cache{"cache/", 512*1024*1024};
+
+Containers::Optional<Containers::Array<char>> input =
+    Utility::Path::read("scene.gltf");
+Containers::String key = Trade::ImportCache::key(*input,
+    "GltfImporter\nremove-duplicate-vertices");
+
+/* On a hit, import the cached data directly */
+Containers::Pointer<Trade::AbstractImporter> importer;
+Containers::Optional<Containers::Array<char>> data = cache.find(key);
+if(data) {
+    importer = importerManager.loadAndInstantiate("MagnumImporter");
+    if(!importer->openMemory(*data))
+        Fatal{} << "Can't open cached data";
+
+/* Otherwise import and process the original file, serialize the result and
+   put it into the cache for next time */
+} else {
+    importer = importerManager.loadAndInstantiate("GltfImporter");
+    Containers::Pointer<Trade::AbstractSceneConverter> converter =
+        converterManager.loadAndInstantiate("MagnumSceneConverter");
+    if(!importer->openData(*input) || !converter->beginData())
+        Fatal{} << "Can't import scene.gltf";
+
+    for(UnsignedInt i = 0; i != importer->meshCount(); ++i)
+        converter->add(MeshTools::removeDuplicates(*importer->mesh(i)));
+    converter->addSupportedImporterContents(*importer,
+        ~Trade::SceneContent::Meshes);
+
+    data = converter->endData();
+    cache.store(key, *data);
+}
+/* [ImportCache-usage] */
+}
+
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [DataArena-usage] */
+Trade::DataArena arena;
+importer->setArena(&arena);
+
+/* With importers that support it, all meshes and their vertex and index data
+   share the arena blocks */
+Containers::Array<Trade::MeshData> meshes;
+for(UnsignedInt i = 0; i != importer->meshCount(); ++i)
+    arrayAppend(meshes, *importer->mesh(i));
+
+DOXYGEN_ELLIPSIS()
+
+/* Once the level is no longer needed, drop the instances and free all their
+   data at once */
+meshes = {};
+arena.reset();
+/* [DataArena-usage] */
+}
+
+{
+struct: Trade::AbstractImporter {
+    Trade::ImporterFeatures doFeatures() const override { return {}; }
+    bool doIsOpened() const override { return true; }
+    void doClose() override {}
+
+    Containers::Optional<Trade::ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+        Vector2i size{256};
+/* [DataArena-implementation] */
+const std::size_t dataSize = size.product()*4;
+if(arena()) {
+    Containers::ArrayView<char> data = arena()->allocate(dataSize);
+    DOXYGEN_ELLIPSIS()
+    return Trade::ImageData2D{PixelFormat::RGBA8Unorm, size,
+        Trade::DataFlag::ExternallyOwned|Trade::DataFlag::Mutable, data};
+}
+
+Containers::Array<char> data{NoInit, dataSize};
+DOXYGEN_ELLIPSIS()
+return Trade::ImageData2D{PixelFormat::RGBA8Unorm, size, std::move(data)};
+/* [DataArena-implementation] */
+    }
+} importer;
+}
+
 {
 UnsignedInt id{};
 Containers::Pointer<Trade::AbstractImporter> importer;
@@ -85,6 +85,9 @@
 #  WglContext                   - WGL context
 #  OpenGLTester                 - OpenGLTester class
 #  VulkanTester                 - VulkanTester class
+#  BcImageConverter             - BC1-BC5 and BC7 image compressor plugin
+#  MagnumImporter               - Magnum binary importer plugin
+#  MagnumSceneConverter         - Magnum binary scene converter plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -413,8 +416,8 @@ set(_MAGNUM_LIBRARY_COMPONENTS_ALWAYS_STATIC
     OpenGLTester)
 set(_MAGNUM_PLUGIN_COMPONENTS
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneConverter
-    AnySceneImporter ObjImporter TgaImageConverter TgaImporter
-    WavAudioImporter)
+    AnySceneImporter BcImageConverter MagnumImporter MagnumSceneConverter
+    ObjImporter TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENTS
     imageconverter sceneconverter shaderconverter gl-info al-info)
 # Audio and Vk libs aren't enabled by default, and none of the Context,
@@ -506,7 +509,10 @@ if(MAGNUM_TARGET_GL)
 endif()
 
 set(_MAGNUM_SceneGraph_DEPENDENCIES )
-set(_MAGNUM_SceneTools_DEPENDENCIES Trade)
+# MeshTools is used only by batchMeshes3D(), which is compiled in only if the
+# base library was selected.
+set(_MAGNUM_SceneTools_DEPENDENCIES MeshTools Trade)
+set(_MAGNUM_SceneTools_MeshTools_DEPENDENCY_IS_OPTIONAL ON)
 set(_MAGNUM_Shaders_DEPENDENCIES )
 if(MAGNUM_TARGET_GL)
     list(APPEND _MAGNUM_Shaders_DEPENDENCIES GL)
@@ -560,6 +566,7 @@ set(_MAGNUM_EglContext_DEPENDENCIES GL)
 set(_MAGNUM_GlxContext_DEPENDENCIES GL)
 set(_MAGNUM_WglContext_DEPENDENCIES GL)
 
+set(_MAGNUM_BcImageConverter_DEPENDENCIES TextureTools) # and below
 set(_MAGNUM_ObjImporter_DEPENDENCIES MeshTools) # and below
 foreach(_component ${_MAGNUM_PLUGIN_COMPONENTS})
     if(_component MATCHES ".+AudioImporter")
@@ -1097,12 +1104,43 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for VulkanTester library
         # No special setup for Primitives library
         # No special setup for SceneGraph library
-        # No special setup for SceneTools library
+
+        # SceneTools library
+        elseif(_component STREQUAL SceneTools)
+            # Threads are used privately for hierarchy processing, so they
+            # need to be linked explicitly only in a static build
+            if(MAGNUM_BUILD_STATIC)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
+
         # No special setup for ShaderTools library
         # No special setup for Shaders library
         # No special setup for Text library
-        # No special setup for TextureTools library
-        # No special setup for Trade library
+
+        # TextureTools library
+        elseif(_component STREQUAL TextureTools)
+            # Threads are used privately for block compression, so they need
+            # to be linked explicitly only in a static build
+            if(MAGNUM_BUILD_STATIC)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
+
+        # Trade library
+        elseif(_component STREQUAL Trade)
+            # Threads are used privately for building scene object indices,
+            # so they need to be linked explicitly only in a static build
+            if(MAGNUM_BUILD_STATIC)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
 
         # Vk library
         elseif(_component STREQUAL Vk)
@@ -1115,6 +1153,9 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnyImageConverter plugin
         # No special setup for AnyImageImporter plugin
         # No special setup for AnySceneImporter plugin
+        # No special setup for BcImageConverter plugin
+        # No special setup for MagnumImporter plugin
+        # No special setup for MagnumSceneConverter plugin
         # No special setup for ObjImporter plugin
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
@@ -43,6 +43,7 @@ cmake .. ^
     -DMAGNUM_WITH_ANYSCENECONVERTER=OFF ^
     -DMAGNUM_WITH_ANYSCENEIMPORTER=OFF ^
     -DMAGNUM_WITH_ANYSHADERCONVERTER=OFF ^
+    -DMAGNUM_WITH_BCIMAGECONVERTER=ON ^
     -DMAGNUM_WITH_MAGNUMFONT=ON ^
     -DMAGNUM_WITH_MAGNUMFONTCONVERTER=ON ^
     -DMAGNUM_WITH_OBJIMPORTER=OFF ^
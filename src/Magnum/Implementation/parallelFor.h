@@ -0,0 +1,102 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+
+/* Emscripten has std::thread only if built with -pthread, everything else
+   we support has it always */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define MAGNUM_IMPLEMENTATION_PARALLELFOR_THREADS
+#include <thread>
+#endif
+
+namespace Magnum { namespace Implementation {
+
+/* Minimal count of items processed by a single thread, shared by all
+   parallelFor() users so the heuristic stays the same across modules. Below
+   that the overhead of spawning a thread is larger than the work itself. */
+constexpr std::size_t ParallelForMinChunkSize = 16384;
+
+/* Resolves a user-supplied thread count to the actual count of threads used
+   for processing `count` items, with each thread getting at least
+   `minChunkSize` items. Thread count of 0 means autodetection from the
+   hardware concurrency, if the platform doesn't have threads available, it's
+   always 1. */
+inline UnsignedInt parallelForThreadCount(const std::size_t count, UnsignedInt threadCount, const std::size_t minChunkSize) {
+    #ifdef MAGNUM_IMPLEMENTATION_PARALLELFOR_THREADS
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        /* The function is allowed to return 0 if it cannot detect */
+        if(!threadCount) threadCount = 1;
+    }
+    const std::size_t maxThreadCount = minChunkSize ? (count + minChunkSize - 1)/minChunkSize : count;
+    if(std::size_t(threadCount) > maxThreadCount)
+        threadCount = maxThreadCount ? UnsignedInt(maxThreadCount) : 1;
+    return threadCount;
+    #else
+    static_cast<void>(count);
+    static_cast<void>(threadCount);
+    static_cast<void>(minChunkSize);
+    return 1;
+    #endif
+}
+
+/* Splits the [0, count) range into contiguous chunks of roughly equal size
+   and calls `function(begin, end)` for each of them, on at most
+   `threadCount` threads. The last chunk is processed on the calling thread,
+   the function returns once all chunks are processed. The chunks are
+   disjoint, so as long as `function` writes only to the items in its range,
+   no synchronization is needed. */
+template<class F> void parallelFor(const std::size_t count, const UnsignedInt threadCount, const std::size_t minChunkSize, F&& function) {
+    const UnsignedInt actualThreadCount = parallelForThreadCount(count, threadCount, minChunkSize);
+    if(actualThreadCount <= 1) {
+        if(count) function(std::size_t{}, count);
+        return;
+    }
+
+    /* Without threads available the thread count is always 1, so this part
+       isn't needed at all */
+    #ifdef MAGNUM_IMPLEMENTATION_PARALLELFOR_THREADS
+    Containers::Array<std::thread> threads{actualThreadCount - 1};
+    for(std::size_t i = 0; i != threads.size(); ++i) {
+        const std::size_t begin = count*i/actualThreadCount;
+        const std::size_t end = count*(i + 1)/actualThreadCount;
+        threads[i] = std::thread{[&function, begin, end]() {
+            function(begin, end);
+        }};
+    }
+    function(count*threads.size()/actualThreadCount, count);
+    for(std::thread& thread: threads) thread.join();
+    #endif
+}
+
+}}
+
+#endif
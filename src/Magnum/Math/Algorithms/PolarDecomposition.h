@@ -0,0 +1,269 @@
+#ifndef Magnum_Math_Algorithms_PolarDecomposition_h
+#define Magnum_Math_Algorithms_PolarDecomposition_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::polarDecomposition(), @ref Magnum::Math::Algorithms::decompose(), @ref Magnum::Math::Algorithms::decomposeInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+template<class T> T frobeniusNormSquared(const Matrix3x3<T>& matrix) {
+    return matrix[0].dot() + matrix[1].dot() + matrix[2].dot();
+}
+
+/* Creates a right-handed orthonormal basis with the first column pointing in
+   given direction */
+template<class T> Matrix3x3<T> orthonormalBasisFrom(const Vector3<T>& direction) {
+    const Vector3<T> a = direction.normalized();
+    /* Pick the axis least aligned with the direction to get a well-defined
+       cross product */
+    const Vector3<T> absA = Math::abs(a);
+    const Vector3<T> axis = absA.x() <= absA.y() && absA.x() <= absA.z() ? Vector3<T>::xAxis() :
+        absA.y() <= absA.z() ? Vector3<T>::yAxis() : Vector3<T>::zAxis();
+    const Vector3<T> b = Math::cross(a, axis).normalized();
+    return Matrix3x3<T>{a, b, Math::cross(a, b)};
+}
+
+}
+
+/**
+@brief Polar decomposition
+@param matrix           Matrix to decompose
+@param maxIterations    Max count of iterations
+@m_since_latest
+
+Decomposes @p matrix into an orthogonal matrix @f$ \boldsymbol{U} @f$ and a
+symmetric positive semi-definite matrix @f$ \boldsymbol{P} @f$ such that @f[
+    \boldsymbol{M} = \boldsymbol{U} \boldsymbol{P}
+@f]
+
+Compared to @ref svd() or @ref qr(), the @f$ \boldsymbol{U} @f$ is the closest
+orthogonal matrix to @p matrix and thus the decomposition is unique for
+non-singular matrices and stays stable in presence of shear, which makes it
+suitable for extracting a rotation from an arbitrary transformation. If the
+determinant of @p matrix is negative, @f$ \boldsymbol{U} @f$ is a reflection
+with a determinant of @cpp -1 @ce. Use @ref decompose() to get a proper
+rotation and a signed scaling instead.
+
+Calculated using a [Newton iteration scaled by a Frobenius norm ratio](https://doi.org/10.1137/0907079): @f[
+    \begin{array}{rcl}
+        \boldsymbol{U}_0 & = & \boldsymbol{M} \\
+        \gamma_k & = & \sqrt{\frac{|\boldsymbol{U}_k^{-1}|_F}{|\boldsymbol{U}_k|_F}} \\
+        \boldsymbol{U}_{k + 1} & = & \frac{1}{2} \left( \gamma_k \boldsymbol{U}_k + \frac{1}{\gamma_k} \boldsymbol{U}_k^{-T} \right)
+    \end{array}
+@f]
+
+The iteration converges quadratically, for typical transformation matrices in
+about four to six steps. It stops when the Frobenius norm of the difference
+between two consecutive iterations gets under @ref TypeTraits::epsilon() or
+after @p maxIterations, whichever comes first.
+
+Singular and near-singular matrices, such as transformations with one or more
+axes scaled to zero, are handled by first extending them to a regular matrix
+with the same @f$ \boldsymbol{P} @f$, so @f$ \boldsymbol{U} @f$ is always
+orthogonal and @f$ \boldsymbol{P} @f$ contains zeros for the degenerate axes.
+As @f$ \boldsymbol{U} @f$ isn't unique for singular matrices, a rotation is
+returned in that case. A zero matrix decomposes to an identity
+@f$ \boldsymbol{U} @f$ and a zero @f$ \boldsymbol{P} @f$.
+@see @ref Matrix4::rotation(), @ref Matrix4::rotationShear()
+*/
+template<class T> Containers::Pair<Matrix3x3<T>, Matrix3x3<T>> polarDecomposition(const Matrix3x3<T>& matrix, const std::size_t maxIterations = 16) {
+    /* Cross products of column pairs, the k-th is orthogonal to the plane
+       spanned by the other two columns, and its dot product with the k-th
+       column is the determinant. The determinant is compared relative to
+       the product of column lengths, which is its upper bound, to detect
+       (nearly) linearly dependent columns independently of the scale. */
+    const Vector3<T> crosses[3]{
+        Math::cross(matrix[1], matrix[2]),
+        Math::cross(matrix[2], matrix[0]),
+        Math::cross(matrix[0], matrix[1])
+    };
+    const T lengthsSquared[3]{
+        matrix[0].dot(),
+        matrix[1].dot(),
+        matrix[2].dot()
+    };
+    const T determinant = Math::dot(matrix[0], crosses[0]);
+
+    /* A zero matrix, or one with values so small that their squares
+       underflow. Returning the original matrix instead of a zero one to
+       preserve the M = UP relation in the latter case. */
+    if(lengthsSquared[0] == T(0) && lengthsSquared[1] == T(0) && lengthsSquared[2] == T(0))
+        return {Matrix3x3<T>{IdentityInit}, matrix};
+
+    Matrix3x3<T> u = matrix;
+    if(Math::pow<2>(determinant) <= TypeTraits<T>::epsilon()*lengthsSquared[0]*lengthsSquared[1]*lengthsSquared[2]) {
+        /* All cross products are normals of the plane spanned by the columns
+           if the matrix has rank 2, pick the longest */
+        std::size_t k = 0;
+        T maxCrossSquared = crosses[0].dot();
+        for(std::size_t i = 1; i != 3; ++i) {
+            const T crossSquared = crosses[i].dot();
+            if(crossSquared > maxCrossSquared) {
+                k = i;
+                maxCrossSquared = crossSquared;
+            }
+        }
+
+        /* Rank 2. Make the matrix regular by adding an outer product of the
+           plane normal and a vector spanning the null space of the matrix.
+           The null space is orthogonal to the row space and the normal to
+           the column space, so the M^T M product gets only extended with
+           the null space vector and P stays the same. The normal is scaled
+           to have a length comparable to the columns, with the sign picked
+           to make U a rotation, as a singular matrix has no orientation. */
+        if(maxCrossSquared > TypeTraits<T>::epsilon()*lengthsSquared[(k + 1) % 3]*lengthsSquared[(k + 2) % 3]) {
+            /* Columns of the adjugate matrix span the null space */
+            const Matrix3x3<T> adjugate = Matrix3x3<T>{crosses[0], crosses[1], crosses[2]}.transposed();
+            std::size_t j = 0;
+            for(std::size_t i = 1; i != 3; ++i)
+                if(adjugate[i].dot() > adjugate[j].dot()) j = i;
+
+            const Vector3<T> normal = crosses[k]/std::sqrt(std::sqrt(maxCrossSquared));
+            const Vector3<T> nullVector = adjugate[j].normalized();
+            for(std::size_t i = 0; i != 3; ++i)
+                u[i] += normal*nullVector[i];
+            if(u.determinant() < T(0)) for(std::size_t i = 0; i != 3; ++i)
+                u[i] -= T(2)*normal*nullVector[i];
+
+        /* Rank 1, i.e. an outer product of a column vector a and a row vector
+           b. U is then directly a rotation that maps the direction of b to
+           the direction of a. */
+        } else {
+            std::size_t j = 0;
+            for(std::size_t i = 1; i != 3; ++i)
+                if(lengthsSquared[i] > lengthsSquared[j]) j = i;
+            const Vector3<T> a = matrix[j].normalized();
+            const Vector3<T> b{Math::dot(a, matrix[0]),
+                               Math::dot(a, matrix[1]),
+                               Math::dot(a, matrix[2])};
+            u = Implementation::orthonormalBasisFrom(a)*Implementation::orthonormalBasisFrom(b).transposed();
+            return {u, u.transposed()*matrix};
+        }
+    }
+
+    for(std::size_t i = 0; i != maxIterations; ++i) {
+        /* Inverse transpose is a comatrix divided by the determinant, norm of
+           the inverse is the same as norm of the inverse transpose */
+        const Matrix3x3<T> uInvertedTransposed = u.comatrix()/u.determinant();
+        const T gamma = std::sqrt(std::sqrt(Implementation::frobeniusNormSquared(uInvertedTransposed)/Implementation::frobeniusNormSquared(u)));
+        const Matrix3x3<T> next = (u*gamma + uInvertedTransposed/gamma)*T(0.5);
+        const T differenceSquared = Implementation::frobeniusNormSquared(next - u);
+        u = next;
+        if(differenceSquared <= Math::pow<2>(TypeTraits<T>::epsilon()))
+            break;
+    }
+
+    return {u, u.transposed()*matrix};
+}
+
+/**
+@brief Decompose a transformation into translation, rotation and scaling
+@m_since_latest
+
+Extracts a rotation from the upper left 3x3 part of @p transformation using
+@ref polarDecomposition() and calculates scaling as a projection of the
+original axes onto the rotated ones. Translation is taken from
+@ref Matrix4::translation(), the bottom row is ignored. Shear, if present, is
+discarded, with the rotation being the closest to the original
+transformation.
+
+If the transformation contains a reflection, the rotation axis that is the
+least aligned with the original coordinate system is flipped and the
+corresponding scaling is negative. For transformations with zero scaling
+along some axes, the rotation is picked to be the closest to the remaining
+axes and the corresponding scaling is zero. Expects that the bottom row is
+@f$ (0, 0, 0, 1) @f$, for projective transformations the output is
+meaningless.
+
+Composing the result back using @ref Matrix4::from() with
+@ref Quaternion::toMatrix() and @ref Matrix4::scaling() gives back the
+original @p transformation, if it didn't contain any shear.
+@see @ref decomposeInto(), @ref Matrix4::scaling() const,
+    @ref Matrix4::rotation() const
+*/
+template<class T> Containers::Triple<Vector3<T>, Quaternion<T>, Vector3<T>> decompose(const Matrix4<T>& transformation) {
+    const Matrix3x3<T> rotationScaling = transformation.rotationScaling();
+    Matrix3x3<T> rotation = polarDecomposition(rotationScaling).first();
+
+    /* If there's a reflection, flip the column that's least aligned with
+       the corresponding axis to make it a rotation */
+    if(rotation.determinant() < T(0)) {
+        std::size_t k = 0;
+        for(std::size_t i = 1; i != 3; ++i)
+            if(rotation[i][i] < rotation[k][k]) k = i;
+        rotation[k] = -rotation[k];
+    }
+
+    return {
+        transformation.translation(),
+        Quaternion<T>::fromMatrix(rotation),
+        Vector3<T>{Math::dot(rotation[0], rotationScaling[0]),
+                   Math::dot(rotation[1], rotationScaling[1]),
+                   Math::dot(rotation[2], rotationScaling[2])}
+    };
+}
+
+/**
+@brief Decompose a list of transformations into translations, rotations and scalings
+@m_since_latest
+
+Performs @ref decompose() on each item of @p transformations. Expects that
+@p translations, @p rotations and @p scalings have the same size as
+@p transformations.
+*/
+template<class T> void decomposeInto(const Containers::StridedArrayView1D<const Matrix4<T>>& transformations, const Containers::StridedArrayView1D<Vector3<T>>& translations, const Containers::StridedArrayView1D<Quaternion<T>>& rotations, const Containers::StridedArrayView1D<Vector3<T>>& scalings) {
+    CORRADE_ASSERT(translations.size() == transformations.size(),
+        "Math::Algorithms::decomposeInto(): expected translation view size to be" << transformations.size() << "but got" << translations.size(), );
+    CORRADE_ASSERT(rotations.size() == transformations.size(),
+        "Math::Algorithms::decomposeInto(): expected rotation view size to be" << transformations.size() << "but got" << rotations.size(), );
+    CORRADE_ASSERT(scalings.size() == transformations.size(),
+        "Math::Algorithms::decomposeInto(): expected scaling view size to be" << transformations.size() << "but got" << scalings.size(), );
+
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        const Containers::Triple<Vector3<T>, Quaternion<T>, Vector3<T>> trs = decompose(transformations[i]);
+        translations[i] = trs.first();
+        rotations[i] = trs.second();
+        scalings[i] = trs.third();
+    }
+}
+
+}}}
+
+#endif
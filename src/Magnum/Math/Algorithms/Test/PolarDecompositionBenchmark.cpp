@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+#include "Magnum/Math/Algorithms/Qr.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct PolarDecompositionBenchmark: TestSuite::Tester {
+    explicit PolarDecompositionBenchmark();
+
+    void rotationQr();
+    void rotationSvd();
+    void rotationPolarDecomposition();
+
+    void decompose();
+
+    Containers::Array<Matrix4> _transformations;
+};
+
+using Magnum::Matrix3x3;
+using Magnum::Matrix4;
+using Magnum::Quaternion;
+using Magnum::Vector3;
+using Magnum::Deg;
+
+PolarDecompositionBenchmark::PolarDecompositionBenchmark() {
+    addBenchmarks({&PolarDecompositionBenchmark::rotationQr,
+                   &PolarDecompositionBenchmark::rotationSvd,
+                   &PolarDecompositionBenchmark::rotationPolarDecomposition,
+
+                   &PolarDecompositionBenchmark::decompose}, 10);
+
+    /* Random TRS transformations with a slight shear in some of them, as
+       commonly seen in imported scenes */
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> ud{-1.0f, 1.0f};
+    std::uniform_real_distribution<Float> sd{0.25f, 4.0f};
+    _transformations = Containers::Array<Matrix4>{NoInit, 512};
+    for(std::size_t i = 0; i != _transformations.size(); ++i) {
+        const Vector3 axis = Vector3{ud(g), ud(g), ud(g)} + Vector3{0.001f};
+        _transformations[i] =
+            Matrix4::translation({ud(g), ud(g), ud(g)})*
+            Matrix4::rotation(Deg(180.0f*ud(g)), axis.normalized())*
+            Matrix4::scaling({sd(g), sd(g), sd(g)})*
+            (i % 4 == 0 ? Matrix4::rotationZ(Deg(30.0f*ud(g)))*Matrix4::scaling({1.0f, 1.5f, 1.0f}) : Matrix4{});
+    }
+}
+
+void PolarDecompositionBenchmark::rotationQr() {
+    Matrix3x3 a{ZeroInit};
+    CORRADE_BENCHMARK(10) for(const Matrix4& transformation: _transformations) {
+        a += Algorithms::qr(transformation.rotationScaling()).first();
+    }
+
+    CORRADE_VERIFY(a != Matrix3x3{ZeroInit});
+}
+
+void PolarDecompositionBenchmark::rotationSvd() {
+    Matrix3x3 a{ZeroInit};
+    CORRADE_BENCHMARK(10) for(const Matrix4& transformation: _transformations) {
+        Containers::Triple<Matrix3x3, Vector3, Matrix3x3> uwv{*Algorithms::svd(transformation.rotationScaling())};
+        a += uwv.first()*uwv.third().transposed();
+    }
+
+    CORRADE_VERIFY(a != Matrix3x3{ZeroInit});
+}
+
+void PolarDecompositionBenchmark::rotationPolarDecomposition() {
+    Matrix3x3 a{ZeroInit};
+    CORRADE_BENCHMARK(10) for(const Matrix4& transformation: _transformations) {
+        a += Algorithms::polarDecomposition(transformation.rotationScaling()).first();
+    }
+
+    CORRADE_VERIFY(a != Matrix3x3{ZeroInit});
+}
+
+void PolarDecompositionBenchmark::decompose() {
+    Containers::Array<Vector3> translations{NoInit, _transformations.size()};
+    Containers::Array<Quaternion> rotations{NoInit, _transformations.size()};
+    Containers::Array<Vector3> scalings{NoInit, _transformations.size()};
+    CORRADE_BENCHMARK(10) {
+        Algorithms::decomposeInto<Float>(Containers::arrayView(_transformations), Containers::arrayView(translations), Containers::arrayView(rotations), Containers::arrayView(scalings));
+    }
+
+    CORRADE_VERIFY(scalings[0] != Vector3{});
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::PolarDecompositionBenchmark)
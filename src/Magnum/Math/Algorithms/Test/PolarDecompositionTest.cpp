@@ -0,0 +1,289 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Algorithms/PolarDecomposition.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test { namespace {
+
+struct PolarDecompositionTest: TestSuite::Tester {
+    explicit PolarDecompositionTest();
+
+    template<class T> void rotationScaling();
+    void rotationShear();
+    void reflection();
+    void nearSingular();
+    void singularZeroAxis();
+    void singularDependentAxes();
+    void singularRankOne();
+    void zero();
+
+    void decompose();
+    void decomposeReflection();
+    void decomposeShear();
+    void decomposeZeroScaling();
+    void decomposeInto();
+    void decomposeIntoInvalidSize();
+};
+
+using namespace Math::Literals;
+
+using Magnum::Matrix3x3;
+using Magnum::Matrix4;
+using Magnum::Quaternion;
+using Magnum::Vector3;
+
+PolarDecompositionTest::PolarDecompositionTest() {
+    addTests({&PolarDecompositionTest::rotationScaling<Float>,
+              &PolarDecompositionTest::rotationScaling<Double>,
+              &PolarDecompositionTest::rotationShear,
+              &PolarDecompositionTest::reflection,
+              &PolarDecompositionTest::nearSingular,
+              &PolarDecompositionTest::singularZeroAxis,
+              &PolarDecompositionTest::singularDependentAxes,
+              &PolarDecompositionTest::singularRankOne,
+              &PolarDecompositionTest::zero,
+
+              &PolarDecompositionTest::decompose,
+              &PolarDecompositionTest::decomposeReflection,
+              &PolarDecompositionTest::decomposeShear,
+              &PolarDecompositionTest::decomposeZeroScaling,
+              &PolarDecompositionTest::decomposeInto,
+              &PolarDecompositionTest::decomposeIntoInvalidSize});
+}
+
+template<class T> void PolarDecompositionTest::rotationScaling() {
+    setTestCaseTemplateName(TypeTraits<T>::name());
+
+    const Math::Matrix3x3<T> rotation = Math::Matrix4<T>::rotation(Math::Deg<T>(T(35.0)), Math::Vector3<T>{T(1.0), T(-2.0), T(0.5)}.normalized()).rotationScaling();
+    const Math::Matrix3x3<T> scaling = Math::Matrix3x3<T>::fromDiagonal({T(1.5), T(0.25), T(3.0)});
+    const Math::Matrix3x3<T> a = rotation*scaling;
+
+    Containers::Pair<Math::Matrix3x3<T>, Math::Matrix3x3<T>> up = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(up.first(), rotation);
+    CORRADE_COMPARE(up.second(), scaling);
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::rotationShear() {
+    /* Scaling applied after a rotation results in a shear, the U should then
+       be orthogonal and P symmetric */
+    const Matrix3x3 a = (Matrix4::scaling({1.5f, 2.0f, 1.0f})*Matrix4::rotationZ(35.0_degf)).rotationScaling();
+
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_VERIFY(up.first().isOrthogonal());
+    CORRADE_COMPARE(up.first().determinant(), 1.0f);
+    CORRADE_COMPARE(up.second(), up.second().transposed());
+    CORRADE_COMPARE(up.first()*up.second(), a);
+
+    /* The shear is only in the XY plane, so the Z axis stays untouched */
+    CORRADE_COMPARE(up.first()[2], Vector3::zAxis());
+}
+
+void PolarDecompositionTest::reflection() {
+    const Matrix3x3 rotation = Matrix4::rotationX(-60.0_degf).rotationScaling();
+    const Matrix3x3 a = rotation*Matrix3x3::fromDiagonal({2.0f, -1.0f, 3.0f});
+
+    /* The reflection is kept in the U, P is positive definite */
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_VERIFY(up.first().isOrthogonal());
+    CORRADE_COMPARE(up.first().determinant(), -1.0f);
+    CORRADE_COMPARE(up.second(), Matrix3x3::fromDiagonal({2.0f, 1.0f, 3.0f}));
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::nearSingular() {
+    /* One axis scaled to almost zero, the determinant is still large enough
+       relative to the axis lengths to go through the iteration without any
+       special handling */
+    const Matrix3x3 rotation = Matrix4::rotation(75.0_degf, Vector3{0.5f, 1.0f, 1.0f}.normalized()).rotationScaling();
+    const Matrix3x3 a = rotation*Matrix3x3::fromDiagonal({1.0f, 2.0f, 1.0e-6f});
+
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(up.first(), rotation);
+    CORRADE_COMPARE(up.second(), Matrix3x3::fromDiagonal({1.0f, 2.0f, 1.0e-6f}));
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::singularZeroAxis() {
+    const Matrix3x3 rotation = Matrix4::rotation(75.0_degf, Vector3{0.5f, 1.0f, 1.0f}.normalized()).rotationScaling();
+    const Matrix3x3 a = rotation*Matrix3x3::fromDiagonal({1.0f, 0.0f, 3.0f});
+
+    /* The zero axis gets reconstructed from the other two */
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(up.first(), rotation);
+    CORRADE_COMPARE(up.second(), Matrix3x3::fromDiagonal({1.0f, 0.0f, 3.0f}));
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::singularDependentAxes() {
+    /* Third column is a linear combination of the first two */
+    const Matrix3x3 a{Vector3{1.0f, 2.0f, 0.5f},
+                      Vector3{-1.0f, 0.5f, 2.0f},
+                      Vector3{0.0f, 2.5f, 2.5f}};
+    CORRADE_COMPARE(a.determinant(), 0.0f);
+
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_VERIFY(up.first().isOrthogonal());
+    CORRADE_COMPARE(up.second(), up.second().transposed());
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::singularRankOne() {
+    const Matrix3x3 rotation = Matrix4::rotationY(-30.0_degf).rotationScaling();
+    const Matrix3x3 a = rotation*Matrix3x3::fromDiagonal({0.0f, 5.0f, 0.0f});
+
+    /* The only non-zero axis is preserved, the rest is an arbitrary
+       completion to an orthonormal basis */
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(a);
+    CORRADE_VERIFY(up.first().isOrthogonal());
+    CORRADE_COMPARE(up.first().determinant(), 1.0f);
+    CORRADE_COMPARE(up.first()[1], rotation[1]);
+    CORRADE_COMPARE(up.second(), Matrix3x3::fromDiagonal({0.0f, 5.0f, 0.0f}));
+    CORRADE_COMPARE(up.first()*up.second(), a);
+}
+
+void PolarDecompositionTest::zero() {
+    Containers::Pair<Matrix3x3, Matrix3x3> up = Algorithms::polarDecomposition(Matrix3x3{ZeroInit});
+    CORRADE_COMPARE(up.first(), Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(up.second(), Matrix3x3{ZeroInit});
+}
+
+void PolarDecompositionTest::decompose() {
+    const Quaternion rotation = Quaternion::rotation(35.0_degf, Vector3{1.0f, -2.0f, 0.5f}.normalized());
+    const Matrix4 a = Matrix4::translation({3.0f, -1.0f, 0.5f})*
+        Matrix4::from(rotation.toMatrix(), {})*
+        Matrix4::scaling({1.5f, 0.25f, 3.0f});
+
+    Containers::Triple<Vector3, Quaternion, Vector3> trs = Algorithms::decompose(a);
+    CORRADE_COMPARE(trs.first(), (Vector3{3.0f, -1.0f, 0.5f}));
+    CORRADE_COMPARE(trs.second(), rotation);
+    CORRADE_COMPARE(trs.third(), (Vector3{1.5f, 0.25f, 3.0f}));
+}
+
+void PolarDecompositionTest::decomposeReflection() {
+    /* The axis that got flipped should get a negative scale if the rotation
+       isn't too large */
+    const Quaternion rotation = Quaternion::rotation(15.0_degf, Vector3{0.0f, 1.0f, 1.0f}.normalized());
+    const Matrix4 a = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::from(rotation.toMatrix(), {})*
+        Matrix4::scaling({2.0f, -1.0f, 3.0f});
+
+    Containers::Triple<Vector3, Quaternion, Vector3> trs = Algorithms::decompose(a);
+    CORRADE_COMPARE(trs.first(), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(trs.second(), rotation);
+    CORRADE_COMPARE(trs.third(), (Vector3{2.0f, -1.0f, 3.0f}));
+
+    /* Mirroring all axes is a reflection as well. It's ambiguous and the
+       output is a 180° rotation with one axis flipped, but it should
+       recompose back to the same matrix. */
+    const Matrix4 b = Matrix4::scaling({-1.0f, -2.0f, -3.0f});
+    Containers::Triple<Vector3, Quaternion, Vector3> trsB = Algorithms::decompose(b);
+    CORRADE_COMPARE(Matrix4::from(trsB.second().toMatrix(), trsB.first())*Matrix4::scaling(trsB.third()), b);
+}
+
+void PolarDecompositionTest::decomposeShear() {
+    /* Shear gets discarded, the rotation should be the closest one to the
+       original. In this particular case it's exactly the original rotation
+       as the scaling is uniform in the rotation plane on average. */
+    const Matrix4 a = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::scaling({1.5f, 2.0f, 1.0f})*
+        Matrix4::rotationZ(35.0_degf);
+
+    Containers::Triple<Vector3, Quaternion, Vector3> trs = Algorithms::decompose(a);
+    CORRADE_COMPARE(trs.first(), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(trs.second(), Quaternion::rotation(35.0_degf, Vector3::zAxis()));
+    CORRADE_COMPARE(trs.third().z(), 1.0f);
+}
+
+void PolarDecompositionTest::decomposeZeroScaling() {
+    const Quaternion rotation = Quaternion::rotation(100.0_degf, Vector3{1.0f, 1.0f, 0.0f}.normalized());
+    const Matrix4 a = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::from(rotation.toMatrix(), {})*
+        Matrix4::scaling({0.0f, 2.0f, 0.5f});
+
+    Containers::Triple<Vector3, Quaternion, Vector3> trs = Algorithms::decompose(a);
+    CORRADE_COMPARE(trs.first(), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(trs.second(), rotation);
+    CORRADE_COMPARE(trs.third(), (Vector3{0.0f, 2.0f, 0.5f}));
+
+    /* Everything scaled to zero gives back an identity rotation */
+    Containers::Triple<Vector3, Quaternion, Vector3> trsZero = Algorithms::decompose(Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling(Vector3{0.0f}));
+    CORRADE_COMPARE(trsZero.first(), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(trsZero.second(), Quaternion{});
+    CORRADE_COMPARE(trsZero.third(), Vector3{0.0f});
+}
+
+void PolarDecompositionTest::decomposeInto() {
+    const Quaternion rotationA = Quaternion::rotation(35.0_degf, Vector3::xAxis());
+    const Quaternion rotationB = Quaternion::rotation(-70.0_degf, Vector3{1.0f, 1.0f, 1.0f}.normalized());
+    const Matrix4 transformations[]{
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::from(rotationA.toMatrix(), {})*Matrix4::scaling({2.0f, 2.0f, 2.0f}),
+        Matrix4{},
+        Matrix4::translation({-1.0f, 0.0f, 0.5f})*Matrix4::from(rotationB.toMatrix(), {})*Matrix4::scaling({0.5f, 1.0f, 4.0f})
+    };
+
+    Vector3 translations[3];
+    Quaternion rotations[3];
+    Vector3 scalings[3];
+    Algorithms::decomposeInto<Float>(transformations, translations, rotations, scalings);
+    CORRADE_COMPARE(translations[0], (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(translations[1], Vector3{});
+    CORRADE_COMPARE(translations[2], (Vector3{-1.0f, 0.0f, 0.5f}));
+    CORRADE_COMPARE(rotations[0], rotationA);
+    CORRADE_COMPARE(rotations[1], Quaternion{});
+    CORRADE_COMPARE(rotations[2], rotationB);
+    CORRADE_COMPARE(scalings[0], (Vector3{2.0f, 2.0f, 2.0f}));
+    CORRADE_COMPARE(scalings[1], (Vector3{1.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(scalings[2], (Vector3{0.5f, 1.0f, 4.0f}));
+}
+
+void PolarDecompositionTest::decomposeIntoInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Matrix4 transformations[3];
+    Vector3 translations[3];
+    Quaternion rotations[3];
+    Vector3 scalings[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    Algorithms::decomposeInto<Float>(transformations, Containers::arrayView(translations).prefix(2), rotations, scalings);
+    Algorithms::decomposeInto<Float>(transformations, translations, Containers::arrayView(rotations).prefix(2), scalings);
+    Algorithms::decomposeInto<Float>(transformations, translations, rotations, Containers::arrayView(scalings).prefix(2));
+    CORRADE_COMPARE(out,
+        "Math::Algorithms::decomposeInto(): expected translation view size to be 3 but got 2\n"
+        "Math::Algorithms::decomposeInto(): expected rotation view size to be 3 but got 2\n"
+        "Math::Algorithms::decomposeInto(): expected scaling view size to be 3 but got 2\n");
+}
+
+}}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::PolarDecompositionTest)
@@ -0,0 +1,275 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BezierBatch.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Count of items between recalculating the forward differences */
+constexpr std::size_t ForwardDifferenceBlockSize = 32;
+
+/* Max subdivision depth for flattening */
+constexpr std::size_t FlattenMaxDepth = 16;
+
+/* Power basis coefficients of a cubic Bézier curve, the value at t is
+   ((a*t + b)*t + c)*t + d */
+template<class T> struct PowerBasis {
+    explicit PowerBasis(const Bezier<3, T::Size, Float>& curve):
+        a{curve[3] - 3.0f*curve[2] + 3.0f*curve[1] - curve[0]},
+        b{3.0f*(curve[2] - 2.0f*curve[1] + curve[0])},
+        c{3.0f*(curve[1] - curve[0])},
+        d{curve[0]} {}
+
+    T value(Float t) const {
+        return ((a*t + b)*t + c)*t + d;
+    }
+
+    /* Derivative, which is used for arc length calculation */
+    T derivative(Float t) const {
+        return (3.0f*a*t + 2.0f*b)*t + c;
+    }
+
+    T a, b, c, d;
+};
+
+template<class T> void bezierValueIntoImplementation(const Containers::StridedArrayView1D<const Bezier<3, T::Size, Float>>& curves, const Float t, const Containers::StridedArrayView1D<T>& values) {
+    CORRADE_ASSERT(curves.size() == values.size(),
+        "Math::bezierValueInto(): expected curve and value views to have the same size, got" << curves.size() << "and" << values.size(), );
+
+    /* Bernstein polynomials are the same for all curves */
+    const Float u = 1.0f - t;
+    const Float b0 = u*u*u;
+    const Float b1 = 3.0f*u*u*t;
+    const Float b2 = 3.0f*u*t*t;
+    const Float b3 = t*t*t;
+    for(std::size_t i = 0; i != curves.size(); ++i) {
+        const Bezier<3, T::Size, Float>& curve = curves[i];
+        values[i] = b0*curve[0] + b1*curve[1] + b2*curve[2] + b3*curve[3];
+    }
+}
+
+template<class T> void bezierValueIntoImplementation(const Bezier<3, T::Size, Float>& curve, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<T>& values) {
+    CORRADE_ASSERT(t.size() == values.size(),
+        "Math::bezierValueInto(): expected position and value views to have the same size, got" << t.size() << "and" << values.size(), );
+
+    const PowerBasis<T> basis{curve};
+    for(std::size_t i = 0; i != t.size(); ++i)
+        values[i] = basis.value(t[i]);
+}
+
+template<class T> void bezierUniformValueIntoImplementation(const Bezier<3, T::Size, Float>& curve, const Containers::StridedArrayView1D<T>& values) {
+    CORRADE_ASSERT(values.size() >= 2,
+        "Math::bezierUniformValueInto(): expected at least two values, got" << values.size(), );
+
+    const PowerBasis<T> basis{curve};
+    const Float step = 1.0f/(values.size() - 1);
+    for(std::size_t blockBegin = 0; blockBegin < values.size(); blockBegin += ForwardDifferenceBlockSize) {
+        const std::size_t blockEnd = Math::min(blockBegin + ForwardDifferenceBlockSize, values.size());
+
+        /* First, second and third forward difference at the block start,
+           calculated directly from the power basis. Calculating them from
+           the differences of adjacent values would suffer from catastrophic
+           cancellation. */
+        const Float t = blockBegin*step;
+        T p = basis.value(t);
+        T d1 = basis.a*(3.0f*t*t*step + 3.0f*t*step*step + step*step*step) + basis.b*(2.0f*t*step + step*step) + basis.c*step;
+        T d2 = basis.a*(6.0f*t*step*step + 6.0f*step*step*step) + basis.b*(2.0f*step*step);
+        const T d3 = basis.a*(6.0f*step*step*step);
+        for(std::size_t i = blockBegin; i != blockEnd; ++i) {
+            values[i] = p;
+            p += d1;
+            d1 += d2;
+            d2 += d3;
+        }
+    }
+
+    /* The last value is exactly the end point */
+    values.back() = curve[3];
+}
+
+template<class T> Containers::Array<T> bezierFlattenImplementation(const Bezier<3, T::Size, Float>& curve, const Float tolerance) {
+    CORRADE_ASSERT(tolerance > 0.0f,
+        "Math::bezierFlatten(): expected a positive tolerance, got" << tolerance, {});
+
+    /* The curve is within given distance from the line between its endpoints
+       if the following holds, see for example
+       https://web.archive.org/web/20191006042920/http://hcklbrrfnn.files.wordpress.com/2012/08/bez.pdf */
+    const Float maxDistance = 16.0f*tolerance*tolerance;
+
+    Containers::Array<T> out;
+    arrayAppend(out, curve[0]);
+
+    /* Depth-first traversal with the left half processed first, which emits
+       the points in order */
+    struct Segment {
+        Bezier<3, T::Size, Float> curve;
+        std::size_t depth;
+    } stack[FlattenMaxDepth + 1];
+    std::size_t stackSize = 0;
+    stack[stackSize++] = {curve, 0};
+    while(stackSize) {
+        const Segment segment = stack[--stackSize];
+        const Bezier<3, T::Size, Float>& c = segment.curve;
+
+        const T u = 3.0f*c[1] - 2.0f*c[0] - c[3];
+        const T v = 3.0f*c[2] - c[0] - 2.0f*c[3];
+        if(segment.depth == FlattenMaxDepth || Math::max(u*u, v*v).sum() <= maxDistance) {
+            arrayAppend(out, c[3]);
+            continue;
+        }
+
+        /* De Casteljau subdivision in the middle */
+        const T c01 = (c[0] + c[1])*0.5f;
+        const T c12 = (c[1] + c[2])*0.5f;
+        const T c23 = (c[2] + c[3])*0.5f;
+        const T c012 = (c01 + c12)*0.5f;
+        const T c123 = (c12 + c23)*0.5f;
+        const T middle = (c012 + c123)*0.5f;
+        stack[stackSize++] = {{middle, c123, c23, c[3]}, segment.depth + 1};
+        stack[stackSize++] = {{c[0], c01, c012, middle}, segment.depth + 1};
+    }
+
+    /* Convert back to a default deleter to make the returned array usable
+       in plugins */
+    arrayShrink(out, DefaultInit);
+    return out;
+}
+
+template<class T> void bezierArcLengthIntoImplementation(const Bezier<3, T::Size, Float>& curve, const Containers::StridedArrayView1D<Float>& lengths) {
+    CORRADE_ASSERT(lengths.size() >= 2,
+        "Math::bezierArcLengthInto(): expected at least two values, got" << lengths.size(), );
+
+    /* Five-point Gauss-Legendre quadrature nodes and weights for the [0, 1]
+       range */
+    constexpr Float Nodes[]{
+        0.5f,
+        0.5f - 0.5f*0.538469310f,
+        0.5f + 0.5f*0.538469310f,
+        0.5f - 0.5f*0.906179846f,
+        0.5f + 0.5f*0.906179846f
+    };
+    constexpr Float Weights[]{
+        0.5f*0.568888889f,
+        0.5f*0.478628670f,
+        0.5f*0.478628670f,
+        0.5f*0.236926885f,
+        0.5f*0.236926885f
+    };
+
+    const PowerBasis<T> basis{curve};
+    const Float step = 1.0f/(lengths.size() - 1);
+    /* Summing in doubles to avoid precision loss with many intervals */
+    Double length = 0.0;
+    lengths[0] = 0.0f;
+    for(std::size_t i = 1; i != lengths.size(); ++i) {
+        const Float begin = (i - 1)*step;
+        Float intervalLength = 0.0f;
+        for(std::size_t j = 0; j != 5; ++j)
+            intervalLength += Weights[j]*basis.derivative(begin + Nodes[j]*step).length();
+        length += Double(intervalLength*step);
+        lengths[i] = Float(length);
+    }
+}
+
+}
+
+void bezierValueInto(const Containers::StridedArrayView1D<const CubicBezier2D<Float>>& curves, const Float t, const Containers::StridedArrayView1D<Vector2<Float>>& values) {
+    bezierValueIntoImplementation(curves, t, values);
+}
+
+void bezierValueInto(const Containers::StridedArrayView1D<const CubicBezier3D<Float>>& curves, const Float t, const Containers::StridedArrayView1D<Vector3<Float>>& values) {
+    bezierValueIntoImplementation(curves, t, values);
+}
+
+void bezierValueInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector2<Float>>& values) {
+    bezierValueIntoImplementation(curve, t, values);
+}
+
+void bezierValueInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector3<Float>>& values) {
+    bezierValueIntoImplementation(curve, t, values);
+}
+
+void bezierUniformValueInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<Vector2<Float>>& values) {
+    bezierUniformValueIntoImplementation(curve, values);
+}
+
+void bezierUniformValueInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<Vector3<Float>>& values) {
+    bezierUniformValueIntoImplementation(curve, values);
+}
+
+Containers::Array<Vector2<Float>> bezierFlatten(const CubicBezier2D<Float>& curve, const Float tolerance) {
+    return bezierFlattenImplementation<Vector2<Float>>(curve, tolerance);
+}
+
+Containers::Array<Vector3<Float>> bezierFlatten(const CubicBezier3D<Float>& curve, const Float tolerance) {
+    return bezierFlattenImplementation<Vector3<Float>>(curve, tolerance);
+}
+
+void bezierArcLengthInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<Float>& lengths) {
+    bezierArcLengthIntoImplementation<Vector2<Float>>(curve, lengths);
+}
+
+void bezierArcLengthInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<Float>& lengths) {
+    bezierArcLengthIntoImplementation<Vector3<Float>>(curve, lengths);
+}
+
+Float arcLengthParameter(const Containers::StridedArrayView1D<const Float>& lengths, const Float length) {
+    CORRADE_ASSERT(lengths.size() >= 2,
+        "Math::arcLengthParameter(): expected at least two values, got" << lengths.size(), {});
+
+    /* Clamp to the table range */
+    if(!(length > lengths.front())) return 0.0f;
+    if(!(length < lengths.back())) return 1.0f;
+
+    /* Find the last entry that's less than or equal to the length. Thanks to
+       the clamping above it's always before the last element. */
+    std::size_t begin = 0;
+    std::size_t end = lengths.size() - 1;
+    while(end - begin > 1) {
+        const std::size_t middle = begin + (end - begin)/2;
+        if(lengths[middle] <= length)
+            begin = middle;
+        else
+            end = middle;
+    }
+
+    const Float intervalLength = lengths[begin + 1] - lengths[begin];
+    const Float factor = intervalLength > 0.0f ? (length - lengths[begin])/intervalLength : 0.0f;
+    return (begin + factor)/(lengths.size() - 1);
+}
+
+}}
@@ -0,0 +1,195 @@
+#ifndef Magnum_Math_BezierBatch_h
+#define Magnum_Math_BezierBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::bezierValueInto(), @ref Magnum::Math::bezierUniformValueInto(), @ref Magnum::Math::bezierFlatten(), @ref Magnum::Math::bezierArcLengthInto(), @ref Magnum::Math::arcLengthParameter()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch Bézier curve functions
+
+These functions evaluate many cubic Bézier curves at once or a single curve at
+many positions. Unlike @ref Bezier::value(), which uses the De Casteljau's
+algorithm, the curves are evaluated in the Bernstein or power basis with the
+coefficients calculated just once for the whole batch, so the results may
+differ from @ref Bezier::value() in the last few bits.
+*/
+
+/**
+@brief Evaluate many cubic 2D Bézier curves at a single position
+@param[in]  curves  Curves to evaluate
+@param[in]  t       Interpolation factor
+@param[out] values  Where to put the values
+@m_since_latest
+
+Batch variant of @ref Bezier::value(). Expects that @p curves and @p values
+have the same size.
+*/
+MAGNUM_EXPORT void bezierValueInto(const Containers::StridedArrayView1D<const CubicBezier2D<Float>>& curves, Float t, const Containers::StridedArrayView1D<Vector2<Float>>& values);
+
+/**
+@brief Evaluate many cubic 3D Bézier curves at a single position
+@m_since_latest
+
+Same as @ref bezierValueInto(const Containers::StridedArrayView1D<const CubicBezier2D<Float>>&, Float, const Containers::StridedArrayView1D<Vector2<Float>>&)
+but for 3D curves.
+*/
+MAGNUM_EXPORT void bezierValueInto(const Containers::StridedArrayView1D<const CubicBezier3D<Float>>& curves, Float t, const Containers::StridedArrayView1D<Vector3<Float>>& values);
+
+/**
+@brief Evaluate a cubic 2D Bézier curve at many positions
+@param[in]  curve   Curve to evaluate
+@param[in]  t       Interpolation factors
+@param[out] values  Where to put the values
+@m_since_latest
+
+Batch variant of @ref Bezier::value(). Expects that @p t and @p values have the
+same size. If the positions are uniformly distributed, use
+@ref bezierUniformValueInto() instead.
+*/
+MAGNUM_EXPORT void bezierValueInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector2<Float>>& values);
+
+/**
+@brief Evaluate a cubic 3D Bézier curve at many positions
+@m_since_latest
+
+Same as @ref bezierValueInto(const CubicBezier2D<Float>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Vector2<Float>>&)
+but for a 3D curve.
+*/
+MAGNUM_EXPORT void bezierValueInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector3<Float>>& values);
+
+/**
+@brief Evaluate a cubic 2D Bézier curve at uniformly distributed positions
+@param[in]  curve   Curve to evaluate
+@param[out] values  Where to put the values
+@m_since_latest
+
+Fills @p values with the curve evaluated at @f$ t_i = \frac{i}{n - 1} @f$,
+where @f$ n @f$ is size of @p values, i.e. the first and last value is
+the first and last control point. Expects that @p values contain at least two
+items.
+
+The values are calculated using forward differencing, which needs just three
+additions per component for each value. To avoid error accumulation with
+large @f$ n @f$, the value and the differences are calculated again from the
+curve every 32 items.
+*/
+MAGNUM_EXPORT void bezierUniformValueInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<Vector2<Float>>& values);
+
+/**
+@brief Evaluate a cubic 3D Bézier curve at uniformly distributed positions
+@m_since_latest
+
+Same as @ref bezierUniformValueInto(const CubicBezier2D<Float>&, const Containers::StridedArrayView1D<Vector2<Float>>&)
+but for a 3D curve.
+*/
+MAGNUM_EXPORT void bezierUniformValueInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<Vector3<Float>>& values);
+
+/**
+@brief Flatten a cubic 2D Bézier curve into a polyline
+@param curve        Curve to flatten
+@param tolerance    Maximal distance between the curve and the polyline
+@m_since_latest
+
+The curve is recursively subdivided in the middle until the distance between
+each segment and the corresponding part of the curve is at most
+@p tolerance, with the distance estimated from the control points. Flat parts
+of the curve are thus approximated with fewer points than parts with a high
+curvature. The subdivision depth is limited to 16 levels, i.e. at most
+@cpp 65537 @ce points are returned. The first and last returned point is
+always the first and last control point. Expects that @p tolerance is
+positive.
+*/
+MAGNUM_EXPORT Containers::Array<Vector2<Float>> bezierFlatten(const CubicBezier2D<Float>& curve, Float tolerance);
+
+/**
+@brief Flatten a cubic 3D Bézier curve into a polyline
+@m_since_latest
+
+Same as @ref bezierFlatten(const CubicBezier2D<Float>&, Float) but for a 3D
+curve.
+*/
+MAGNUM_EXPORT Containers::Array<Vector3<Float>> bezierFlatten(const CubicBezier3D<Float>& curve, Float tolerance);
+
+/**
+@brief Calculate an arc length table of a cubic 2D Bézier curve
+@param[in]  curve   Curve
+@param[out] lengths Where to put the arc lengths
+@m_since_latest
+
+Fills @p lengths with the length of the curve from @f$ t = 0 @f$ to
+@f$ t_i = \frac{i}{n - 1} @f$, where @f$ n @f$ is size of @p lengths, i.e.
+the first value is always @cpp 0.0f @ce and the last value is the length of
+the whole curve. The length of each interval is calculated with a five-point
+Gauss-Legendre quadrature, which makes the result precise even for small
+@f$ n @f$. Expects that @p lengths contain at least two items. Pass the result
+to @ref arcLengthParameter() to get a parameterization by arc length.
+*/
+MAGNUM_EXPORT void bezierArcLengthInto(const CubicBezier2D<Float>& curve, const Containers::StridedArrayView1D<Float>& lengths);
+
+/**
+@brief Calculate an arc length table of a cubic 3D Bézier curve
+@m_since_latest
+
+Same as @ref bezierArcLengthInto(const CubicBezier2D<Float>&, const Containers::StridedArrayView1D<Float>&)
+but for a 3D curve.
+*/
+MAGNUM_EXPORT void bezierArcLengthInto(const CubicBezier3D<Float>& curve, const Containers::StridedArrayView1D<Float>& lengths);
+
+/**
+@brief Curve parameter corresponding to given arc length
+@param lengths      Arc length table
+@param length       Arc length from the curve start
+@m_since_latest
+
+Expects that @p lengths contain at least two items, with the values
+monotonically non-decreasing and corresponding to uniformly distributed curve
+parameters in range @f$ [0, 1] @f$, such as produced by
+@ref bezierArcLengthInto(). Returns a parameter that can be passed to
+@ref Bezier::value() or @ref bezierValueInto() to get a point at given arc
+length, linearly interpolating between the table entries. The @p length is
+clamped to the range of the table, so the result is always in range
+@f$ [0, 1] @f$.
+*/
+MAGNUM_EXPORT Float arcLengthParameter(const Containers::StridedArrayView1D<const Float>& lengths, Float length);
+
+/**
+@}
+*/
+
+}}
+
+#endif
@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CubicHermiteBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math {
+
+namespace {
+
+/* Hermite basis functions, calculated the same way as in splerp() */
+struct HermiteBasis {
+    explicit HermiteBasis(const Float t):
+        pointA{2.0f*t*t*t - 3.0f*t*t + 1.0f},
+        tangentA{t*t*t - 2.0f*t*t + t},
+        pointB{-2.0f*t*t*t + 3.0f*t*t},
+        tangentB{t*t*t - t*t} {}
+
+    template<class T> T value(const CubicHermite<T>& a, const CubicHermite<T>& b) const {
+        return pointA*a.point() + tangentA*a.outTangent() + pointB*b.point() + tangentB*b.inTangent();
+    }
+
+    Float pointA, tangentA, pointB, tangentB;
+};
+
+template<class T> void splerpIntoImplementation(const Containers::StridedArrayView1D<const CubicHermite<T>>& a, const Containers::StridedArrayView1D<const CubicHermite<T>>& b, const Float t, const Containers::StridedArrayView1D<T>& values) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::splerpInto(): expected first and second point views to have the same size, got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(values.size() == a.size(),
+        "Math::splerpInto(): wrong destination size, got" << values.size() << "but expected" << a.size(), );
+
+    const HermiteBasis basis{t};
+    for(std::size_t i = 0; i != a.size(); ++i)
+        values[i] = basis.value(a[i], b[i]);
+}
+
+template<class T> void splerpIntoImplementation(const CubicHermite<T>& a, const CubicHermite<T>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<T>& values) {
+    CORRADE_ASSERT(values.size() == t.size(),
+        "Math::splerpInto(): wrong destination size, got" << values.size() << "but expected" << t.size(), );
+
+    /* Convert to power basis to have just three multiplications and
+       additions per component */
+    const T c3 = 2.0f*a.point() + a.outTangent() - 2.0f*b.point() + b.inTangent();
+    const T c2 = -3.0f*a.point() - 2.0f*a.outTangent() + 3.0f*b.point() - b.inTangent();
+    const T c1 = a.outTangent();
+    const T c0 = a.point();
+    for(std::size_t i = 0; i != t.size(); ++i) {
+        const Float ti = t[i];
+        values[i] = ((c3*ti + c2)*ti + c1)*ti + c0;
+    }
+}
+
+}
+
+void splerpInto(const Containers::StridedArrayView1D<const CubicHermite1D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite1D<Float>>& b, const Float t, const Containers::StridedArrayView1D<Float>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+void splerpInto(const Containers::StridedArrayView1D<const CubicHermite2D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite2D<Float>>& b, const Float t, const Containers::StridedArrayView1D<Vector2<Float>>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+void splerpInto(const Containers::StridedArrayView1D<const CubicHermite3D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite3D<Float>>& b, const Float t, const Containers::StridedArrayView1D<Vector3<Float>>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+void splerpInto(const CubicHermite1D<Float>& a, const CubicHermite1D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Float>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+void splerpInto(const CubicHermite2D<Float>& a, const CubicHermite2D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector2<Float>>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+void splerpInto(const CubicHermite3D<Float>& a, const CubicHermite3D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector3<Float>>& values) {
+    splerpIntoImplementation(a, b, t, values);
+}
+
+}}
@@ -0,0 +1,119 @@
+#ifndef Magnum_Math_CubicHermiteBatch_h
+#define Magnum_Math_CubicHermiteBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::splerpInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Batch cubic Hermite spline functions
+
+These functions interpolate many cubic Hermite spline segments at once or a
+single segment at many positions. The calculation is the same as in
+@ref splerp(const CubicHermite<T>&, const CubicHermite<T>&, U), with the
+Hermite basis functions calculated just once for the whole batch if the
+interpolation phase is the same for all segments.
+*/
+
+/**
+@brief Spline interpolation of many one-dimensional cubic Hermite segments at a single phase
+@param[in]  a       First points of the segments
+@param[in]  b       Second points of the segments
+@param[in]  t       Interpolation phase
+@param[out] values  Where to put the values
+@m_since_latest
+
+Batch variant of @ref splerp(const CubicHermite<T>&, const CubicHermite<T>&, U).
+Expects that @p a, @p b and @p values have the same size.
+*/
+MAGNUM_EXPORT void splerpInto(const Containers::StridedArrayView1D<const CubicHermite1D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite1D<Float>>& b, Float t, const Containers::StridedArrayView1D<Float>& values);
+
+/**
+@brief Spline interpolation of many two-dimensional cubic Hermite segments at a single phase
+@m_since_latest
+
+Same as @ref splerpInto(const Containers::StridedArrayView1D<const CubicHermite1D<Float>>&, const Containers::StridedArrayView1D<const CubicHermite1D<Float>>&, Float, const Containers::StridedArrayView1D<Float>&)
+but for two-dimensional segments.
+*/
+MAGNUM_EXPORT void splerpInto(const Containers::StridedArrayView1D<const CubicHermite2D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite2D<Float>>& b, Float t, const Containers::StridedArrayView1D<Vector2<Float>>& values);
+
+/**
+@brief Spline interpolation of many three-dimensional cubic Hermite segments at a single phase
+@m_since_latest
+
+Same as @ref splerpInto(const Containers::StridedArrayView1D<const CubicHermite1D<Float>>&, const Containers::StridedArrayView1D<const CubicHermite1D<Float>>&, Float, const Containers::StridedArrayView1D<Float>&)
+but for three-dimensional segments.
+*/
+MAGNUM_EXPORT void splerpInto(const Containers::StridedArrayView1D<const CubicHermite3D<Float>>& a, const Containers::StridedArrayView1D<const CubicHermite3D<Float>>& b, Float t, const Containers::StridedArrayView1D<Vector3<Float>>& values);
+
+/**
+@brief Spline interpolation of a one-dimensional cubic Hermite segment at many phases
+@param[in]  a       First point of the segment
+@param[in]  b       Second point of the segment
+@param[in]  t       Interpolation phases
+@param[out] values  Where to put the values
+@m_since_latest
+
+Batch variant of @ref splerp(const CubicHermite<T>&, const CubicHermite<T>&, U).
+Expects that @p t and @p values have the same size.
+*/
+MAGNUM_EXPORT void splerpInto(const CubicHermite1D<Float>& a, const CubicHermite1D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Float>& values);
+
+/**
+@brief Spline interpolation of a two-dimensional cubic Hermite segment at many phases
+@m_since_latest
+
+Same as @ref splerpInto(const CubicHermite1D<Float>&, const CubicHermite1D<Float>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Float>&)
+but for a two-dimensional segment.
+*/
+MAGNUM_EXPORT void splerpInto(const CubicHermite2D<Float>& a, const CubicHermite2D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector2<Float>>& values);
+
+/**
+@brief Spline interpolation of a three-dimensional cubic Hermite segment at many phases
+@m_since_latest
+
+Same as @ref splerpInto(const CubicHermite1D<Float>&, const CubicHermite1D<Float>&, const Containers::StridedArrayView1D<const Float>&, const Containers::StridedArrayView1D<Float>&)
+but for a three-dimensional segment.
+*/
+MAGNUM_EXPORT void splerpInto(const CubicHermite3D<Float>& a, const CubicHermite3D<Float>& b, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Vector3<Float>>& values);
+
+/**
+@}
+*/
+
+}}
+
+#endif
@@ -0,0 +1,230 @@
+#ifndef Magnum_Math_FastFunctions_h
+#define Magnum_Math_FastFunctions_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Fast, functions @ref Magnum::Math::Fast::sqrtInverted(), @ref Magnum::Math::Fast::sincos(), @ref Magnum::Math::Fast::atan2(), @ref Magnum::Math::Fast::exp2(), @ref Magnum::Math::Fast::log2(), @ref Magnum::Math::Fast::pow()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/Math/Angle.h"
+
+namespace Magnum { namespace Math {
+
+namespace Fast {
+
+namespace Implementation {
+
+union FloatBits {
+    Float f;
+    UnsignedInt u;
+    Int i;
+};
+
+/* Rounding to nearest integer, halfway cases away from zero. Unlike
+   std::round() this compiles to a plain conversion instruction. */
+inline Int roundToInt(Float value) {
+    return Int(value + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+}
+
+/**
+@brief Approximate inverse square root
+@m_since_latest
+
+Calculated using the [famous bit manipulation trick](https://en.wikipedia.org/wiki/Fast_inverse_square_root)
+with a magic constant by Chris Lomont, followed by two Newton-Raphson
+iterations. Maximal relative error is @f$ 5 \cdot 10^{-6} @f$ over the whole
+range of positive normalized floats. The result is undefined for zero,
+denormals, negative values, infinity and NaN.
+@see @ref Math::sqrtInverted(), @ref sqrtInvertedInto()
+*/
+inline Float sqrtInverted(Float value) {
+    Implementation::FloatBits bits;
+    bits.f = value;
+    bits.i = 0x5f375a86 - (bits.i >> 1);
+    const Float half = value*0.5f;
+    Float y = bits.f;
+    y = y*(1.5f - half*y*y);
+    y = y*(1.5f - half*y*y);
+    return y;
+}
+
+/**
+@brief Approximate sine and cosine
+@m_since_latest
+
+The angle is reduced to @f$ [-\frac{\pi}{4}, \frac{\pi}{4}] @f$ using a
+two-part representation of @f$ \frac{\pi}{2} @f$ and then minimax polynomials
+of degree 7 for the sine and degree 8 for the cosine are used. Maximal absolute
+error is @f$ 10^{-7} @f$ for angles in range
+@f$ [-\pi, \pi] @f$, with larger angles the error grows proportionally to the
+ULP of the input, reaching @f$ 4 \cdot 10^{-6} @f$ for @f$ [-100, 100] @f$
+and @f$ 2.5 \cdot 10^{-4} @f$ for @f$ [-8192, 8192] @f$.
+The result is undefined for angles with absolute value larger than
+@f$ 2^{31} \frac{\pi}{2} @f$, infinity and NaN.
+@see @ref Math::sincos(), @ref sincosInto()
+*/
+inline Containers::Pair<Float, Float> sincos(Rad<Float> angle) {
+    const Float x = Float(angle);
+    const Int quadrant = Implementation::roundToInt(x*0.636619772f);
+    const Float quadrantF = Float(quadrant);
+    const Float r = (x - quadrantF*1.57079637f) - quadrantF*-4.37113900e-8f;
+    const Float r2 = r*r;
+    const Float sin = r + r*r2*(-1.66666546e-1f + r2*(8.33216087e-3f + r2*-1.95152959e-4f));
+    const Float cos = 1.0f - 0.5f*r2 + r2*r2*(4.16666457e-2f + r2*(-1.38873163e-3f + r2*2.44331571e-5f));
+
+    /* Odd quadrants have sine and cosine swapped, the second and third
+       quadrant have a negative sine, the first and second negative cosine */
+    const bool swap = quadrant & 1;
+    const Float sinSwapped = swap ? cos : sin;
+    const Float cosSwapped = swap ? sin : cos;
+    return {quadrant & 2 ? -sinSwapped : sinSwapped,
+            (quadrant + 1) & 2 ? -cosSwapped : cosSwapped};
+}
+
+/**
+@overload
+@m_since_latest
+*/
+inline Containers::Pair<Float, Float> sincos(Deg<Float> angle) {
+    return sincos(Rad<Float>(angle));
+}
+
+/**
+@brief Approximate arc tangent of two values
+@m_since_latest
+
+Returns the angle between the positive X axis and a point
+@f$ (x, y) @f$, in range @f$ [-\pi, \pi] @f$. The ratio of the smaller and
+larger absolute value of @p y and @p x is passed to a minimax polynomial of
+degree 11 and the result is then mapped to the correct octant. Maximal absolute
+error is @f$ 2.5 \cdot 10^{-6} @f$ radians. If both @p y and @p x are zero,
+returns zero. The result is undefined for infinity and NaN.
+@see @ref Math::atan(), @ref atan2Into()
+*/
+inline Rad<Float> atan2(Float y, Float x) {
+    const Float absX = x < 0.0f ? -x : x;
+    const Float absY = y < 0.0f ? -y : y;
+    const Float min = absX < absY ? absX : absY;
+    const Float max = absX < absY ? absY : absX;
+    const Float a = max == 0.0f ? 0.0f : min/max;
+    const Float a2 = a*a;
+    Float r = a*(0.99997726f + a2*(-0.33262347f + a2*(0.19354346f + a2*(-0.11643287f + a2*(0.05265332f + a2*-0.01172120f)))));
+    r = absY > absX ? 1.57079637f - r : r;
+    r = x < 0.0f ? 3.14159274f - r : r;
+    return Rad<Float>{y < 0.0f ? -r : r};
+}
+
+/**
+@brief Approximate base-2 exponential
+@m_since_latest
+
+The exponent is split into an integer part, which is directly converted to a
+power of two, and a fractional part in range @f$ [-\frac{1}{2}, \frac{1}{2}] @f$
+for which a Taylor polynomial of degree 6 is used. Maximal relative error is
+@f$ 3 \cdot 10^{-7} @f$ as long as the result is a normalized float, results
+smaller than @f$ 2^{-126} @f$ lose precision gradually as any other
+denormalized value and exponents below @f$ -150 @f$ return zero. Exponents
+of @f$ 128 @f$ and above return infinity. The result is undefined for NaN.
+@see @ref Math::exp(), @ref exp2Into()
+*/
+inline Float exp2(Float exponent) {
+    const Float x = exponent < -150.0f ? -150.0f : exponent > 128.0f ? 128.0f : exponent;
+    const Int integer = Implementation::roundToInt(x);
+    const Float f = x - Float(integer);
+    const Float fraction = 1.0f + f*(0.693147182f + f*(0.240226507f + f*(5.55041087e-2f + f*(9.61812911e-3f + f*(1.33335581e-3f + f*1.54035304e-4f)))));
+
+    /* The integer part is in range [-150, 128], split it into two halves to
+       have the powers always representable as normalized floats. Multiplying
+       the fraction first to avoid overflow for results close to the max
+       float value. */
+    Implementation::FloatBits a, b;
+    a.u = UnsignedInt((integer >> 1) + 127) << 23;
+    b.u = UnsignedInt(integer - (integer >> 1) + 127) << 23;
+    return a.f*(b.f*fraction);
+}
+
+/**
+@brief Approximate base-2 logarithm
+@m_since_latest
+
+The exponent of the value is extracted directly from its binary
+representation, logarithm of the mantissa normalized to range
+@f$ [\frac{1}{\sqrt{2}}, \sqrt{2}] @f$ is calculated using an
+@f$ \operatorname{artanh} @f$ series of degree 7. Maximal absolute error is
+@f$ 5 \cdot 10^{-6} @f$ over the whole range of positive normalized floats,
+which is at most one ULP of the result for values far from @f$ 1 @f$. The
+relative error is at most @f$ 4 \cdot 10^{-7} @f$ and the result is exactly
+zero for @f$ 1 @f$. The result is undefined for zero, denormals, negative
+values, infinity and NaN.
+@see @ref Math::log(), @ref log2Into()
+*/
+inline Float log2(Float value) {
+    Implementation::FloatBits bits;
+    bits.f = value;
+    const Int exponent = Int((bits.u >> 23) & 0xff) - 127;
+    bits.u = (bits.u & 0x7fffff) | 0x3f800000;
+
+    /* Mantissa is in [1, 2), move the upper part to [0.5, 1) to have it
+       centered around 1 */
+    const bool upper = bits.f > 1.41421356f;
+    const Float m = upper ? bits.f*0.5f : bits.f;
+    const Int e = upper ? exponent + 1 : exponent;
+
+    const Float t = (m - 1.0f)/(m + 1.0f);
+    const Float t2 = t*t;
+    return Float(e) + t*(2.88539008f + t2*(0.961796694f + t2*(0.577078016f + t2*0.412198583f)));
+}
+
+/**
+@brief Approximate power
+@m_since_latest
+
+Calculated as @f$ 2^{y \log_2 x} @f$ using @ref log2() and @ref exp2(). The
+absolute error of the logarithm gets multiplied by @p exponent, which means
+the relative error grows with the magnitude of the product. It's below
+@f$ 2 \cdot 10^{-6} @f$ for @p base in range @f$ [0.01, 10] @f$ and
+@p exponent in range @f$ [-4, 4] @f$ and below @f$ 10^{-5} @f$ for
+@p base in range @f$ [0.001, 1000] @f$ and @p exponent in range
+@f$ [-10, 10] @f$. Expects that @p base is a positive normalized float, the
+result is undefined otherwise.
+@see @ref Math::pow(), @ref powInto()
+*/
+inline Float pow(Float base, Float exponent) {
+    return exp2(exponent*log2(base));
+}
+
+}
+
+}}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FastFunctionsBatch.h"
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/FastFunctions.h"
+
+namespace Magnum { namespace Math { namespace Fast {
+
+namespace {
+
+/* If the views are contiguous, the loops operate on plain pointers, which
+   makes them vectorizable. The functions are all branchless so this is the
+   only thing needed. */
+
+template<class F> void unaryInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst, F&& function) {
+    if(src.isContiguous() && dst.isContiguous()) {
+        const Float* const srcData = src.asContiguous().data();
+        Float* const dstData = dst.asContiguous().data();
+        for(std::size_t i = 0, max = src.size(); i != max; ++i)
+            dstData[i] = function(srcData[i]);
+    } else for(std::size_t i = 0, max = src.size(); i != max; ++i)
+        dst[i] = function(src[i]);
+}
+
+template<class F> void binaryInto(const Containers::StridedArrayView1D<const Float>& a, const Containers::StridedArrayView1D<const Float>& b, const Containers::StridedArrayView1D<Float>& dst, F&& function) {
+    if(a.isContiguous() && b.isContiguous() && dst.isContiguous()) {
+        const Float* const aData = a.asContiguous().data();
+        const Float* const bData = b.asContiguous().data();
+        Float* const dstData = dst.asContiguous().data();
+        for(std::size_t i = 0, max = a.size(); i != max; ++i)
+            dstData[i] = function(aData[i], bData[i]);
+    } else for(std::size_t i = 0, max = a.size(); i != max; ++i)
+        dst[i] = function(a[i], b[i]);
+}
+
+}
+
+void sqrtInvertedInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::sqrtInvertedInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    unaryInto(src, dst, [](Float value) { return sqrtInverted(value); });
+}
+
+void sincosInto(const Containers::StridedArrayView1D<const Float>& angles, const Containers::StridedArrayView1D<Float>& sin, const Containers::StridedArrayView1D<Float>& cos) {
+    CORRADE_ASSERT(sin.size() == angles.size(),
+        "Math::Fast::sincosInto(): wrong sine destination size, got" << sin.size() << "but expected" << angles.size(), );
+    CORRADE_ASSERT(cos.size() == angles.size(),
+        "Math::Fast::sincosInto(): wrong cosine destination size, got" << cos.size() << "but expected" << angles.size(), );
+    if(angles.isContiguous() && sin.isContiguous() && cos.isContiguous()) {
+        const Float* const anglesData = angles.asContiguous().data();
+        Float* const sinData = sin.asContiguous().data();
+        Float* const cosData = cos.asContiguous().data();
+        for(std::size_t i = 0, max = angles.size(); i != max; ++i) {
+            const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad<Float>{anglesData[i]});
+            sinData[i] = sincos.first();
+            cosData[i] = sincos.second();
+        }
+    } else for(std::size_t i = 0, max = angles.size(); i != max; ++i) {
+        const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad<Float>{angles[i]});
+        sin[i] = sincos.first();
+        cos[i] = sincos.second();
+    }
+}
+
+void atan2Into(const Containers::StridedArrayView1D<const Float>& y, const Containers::StridedArrayView1D<const Float>& x, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(x.size() == y.size(),
+        "Math::Fast::atan2Into(): expected X and Y views to have the same size, got" << x.size() << "and" << y.size(), );
+    CORRADE_ASSERT(dst.size() == y.size(),
+        "Math::Fast::atan2Into(): wrong destination size, got" << dst.size() << "but expected" << y.size(), );
+    binaryInto(y, x, dst, [](Float y, Float x) { return Float(atan2(y, x)); });
+}
+
+void exp2Into(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::exp2Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    unaryInto(src, dst, [](Float value) { return exp2(value); });
+}
+
+void log2Into(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::Fast::log2Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    unaryInto(src, dst, [](Float value) { return log2(value); });
+}
+
+void powInto(const Containers::StridedArrayView1D<const Float>& bases, const Containers::StridedArrayView1D<const Float>& exponents, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(exponents.size() == bases.size(),
+        "Math::Fast::powInto(): expected base and exponent views to have the same size, got" << bases.size() << "and" << exponents.size(), );
+    CORRADE_ASSERT(dst.size() == bases.size(),
+        "Math::Fast::powInto(): wrong destination size, got" << dst.size() << "but expected" << bases.size(), );
+    binaryInto(bases, exponents, dst, [](Float base, Float exponent) { return pow(base, exponent); });
+}
+
+void powInto(const Containers::StridedArrayView1D<const Float>& bases, const Float exponent, const Containers::StridedArrayView1D<Float>& dst) {
+    CORRADE_ASSERT(dst.size() == bases.size(),
+        "Math::Fast::powInto(): wrong destination size, got" << dst.size() << "but expected" << bases.size(), );
+    unaryInto(bases, dst, [exponent](Float base) { return pow(base, exponent); });
+}
+
+}}}
@@ -0,0 +1,132 @@
+#ifndef Magnum_Math_FastFunctionsBatch_h
+#define Magnum_Math_FastFunctionsBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Fast::sqrtInvertedInto(), @ref Magnum::Math::Fast::sincosInto(), @ref Magnum::Math::Fast::atan2Into(), @ref Magnum::Math::Fast::exp2Into(), @ref Magnum::Math::Fast::log2Into(), @ref Magnum::Math::Fast::powInto()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Math { namespace Fast {
+
+/**
+@{ @name Batch approximate functions
+
+These functions process an ubounded range of values, as opposed to single
+scalars. If all views are contiguous, the processing is done on plain arrays,
+which allows the compiler to vectorize the loops.
+*/
+
+/**
+@brief Approximate inverse square root of a list of values
+@param[in]  src     Source values
+@param[out] dst     Destination values
+@m_since_latest
+
+Expects that @p src and @p dst have the same size. The @p src and @p dst views
+can be the same. See @ref sqrtInverted() for accuracy guarantees.
+*/
+MAGNUM_EXPORT void sqrtInvertedInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst);
+
+/**
+@brief Approximate sine and cosine of a list of angles
+@param[in]  angles  Angles in radians
+@param[out] sin     Destination sine values
+@param[out] cos     Destination cosine values
+@m_since_latest
+
+Expects that @p angles, @p sin and @p cos have the same size. The @p angles
+view can be the same as @p sin or @p cos. See @ref sincos() for accuracy
+guarantees.
+*/
+MAGNUM_EXPORT void sincosInto(const Containers::StridedArrayView1D<const Float>& angles, const Containers::StridedArrayView1D<Float>& sin, const Containers::StridedArrayView1D<Float>& cos);
+
+/**
+@brief Approximate arc tangent of a list of value pairs
+@param[in]  y       Y coordinates
+@param[in]  x       X coordinates
+@param[out] dst     Destination angles in radians
+@m_since_latest
+
+Expects that @p y, @p x and @p dst have the same size. The @p dst view can be
+the same as @p y or @p x. See @ref atan2() for accuracy guarantees.
+*/
+MAGNUM_EXPORT void atan2Into(const Containers::StridedArrayView1D<const Float>& y, const Containers::StridedArrayView1D<const Float>& x, const Containers::StridedArrayView1D<Float>& dst);
+
+/**
+@brief Approximate base-2 exponential of a list of values
+@param[in]  src     Source exponents
+@param[out] dst     Destination values
+@m_since_latest
+
+Expects that @p src and @p dst have the same size. The @p src and @p dst views
+can be the same. See @ref exp2() for accuracy guarantees.
+*/
+MAGNUM_EXPORT void exp2Into(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst);
+
+/**
+@brief Approximate base-2 logarithm of a list of values
+@param[in]  src     Source values
+@param[out] dst     Destination logarithms
+@m_since_latest
+
+Expects that @p src and @p dst have the same size. The @p src and @p dst views
+can be the same. See @ref log2() for accuracy guarantees.
+*/
+MAGNUM_EXPORT void log2Into(const Containers::StridedArrayView1D<const Float>& src, const Containers::StridedArrayView1D<Float>& dst);
+
+/**
+@brief Approximate power of a list of values
+@param[in]  bases       Bases
+@param[in]  exponents   Exponents
+@param[out] dst         Destination values
+@m_since_latest
+
+Expects that @p bases, @p exponents and @p dst have the same size. The
+@p dst view can be the same as @p bases or @p exponents. See @ref pow() for
+accuracy guarantees.
+*/
+MAGNUM_EXPORT void powInto(const Containers::StridedArrayView1D<const Float>& bases, const Containers::StridedArrayView1D<const Float>& exponents, const Containers::StridedArrayView1D<Float>& dst);
+
+/**
+@overload
+@m_since_latest
+
+Uses the same @p exponent for all values.
+*/
+MAGNUM_EXPORT void powInto(const Containers::StridedArrayView1D<const Float>& bases, Float exponent, const Containers::StridedArrayView1D<Float>& dst);
+
+/*@}*/
+
+}}}
+
+#endif
@@ -0,0 +1,274 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IntersectionBatch.h"
+
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+namespace {
+
+/* Count of volumes processed at once. Eight floats fit into a single AVX
+   register or two SSE / NEON registers, the fixed-size inner loops are then
+   trivially vectorizable. */
+constexpr std::size_t BatchSize = 8;
+
+/* Frustum planes transposed to structure-of-arrays, with absolute values of
+   the normals precalculated for the box tests */
+struct TransposedFrustum {
+    explicit TransposedFrustum(const Frustum<Float>& frustum) {
+        for(std::size_t i = 0; i != 6; ++i) {
+            const Vector4<Float>& plane = frustum[i];
+            x[i] = plane.x();
+            y[i] = plane.y();
+            z[i] = plane.z();
+            w[i] = plane.w();
+            absX[i] = Math::abs(plane.x());
+            absY[i] = Math::abs(plane.y());
+            absZ[i] = Math::abs(plane.z());
+        }
+    }
+
+    Float x[6], y[6], z[6], w[6];
+    Float absX[6], absY[6], absZ[6];
+};
+
+/* Writes `count` lowest bits of `mask` to `out` starting at `offset`. If the
+   eight bits map to a whole byte, it's written directly. */
+inline void writeBits(const Containers::MutableBitArrayView out, const std::size_t offset, const UnsignedByte mask, const std::size_t count) {
+    const std::size_t bit = out.offset() + offset;
+    if(count == BatchSize && bit % 8 == 0) {
+        static_cast<UnsignedByte*>(out.data())[bit/8] = mask;
+        return;
+    }
+
+    for(std::size_t i = 0; i != count; ++i) {
+        if(mask & (1 << i))
+            out.set(offset + i);
+        else
+            out.reset(offset + i);
+    }
+}
+
+inline UnsignedByte packBits(const bool(&values)[BatchSize]) {
+    UnsignedByte mask = 0;
+    for(std::size_t i = 0; i != BatchSize; ++i)
+        mask |= UnsignedByte(values[i]) << i;
+    return mask;
+}
+
+/* Center and extent (or doubled center and extent for ranges) vs frustum,
+   shared by rangeFrustum() and aabbFrustum(). The w factor is 2 for ranges,
+   matching the scalar rangeFrustum() implementation. */
+inline UnsignedByte boxFrustumBatch(const Float(&cx)[BatchSize], const Float(&cy)[BatchSize], const Float(&cz)[BatchSize], const Float(&ex)[BatchSize], const Float(&ey)[BatchSize], const Float(&ez)[BatchSize], const TransposedFrustum& frustum, const Float wFactor) {
+    bool inside[BatchSize];
+    for(std::size_t j = 0; j != BatchSize; ++j)
+        inside[j] = true;
+
+    for(std::size_t i = 0; i != 6; ++i) {
+        const Float nx = frustum.x[i];
+        const Float ny = frustum.y[i];
+        const Float nz = frustum.z[i];
+        const Float ax = frustum.absX[i];
+        const Float ay = frustum.absY[i];
+        const Float az = frustum.absZ[i];
+        const Float w = -wFactor*frustum.w[i];
+        for(std::size_t j = 0; j != BatchSize; ++j) {
+            const Float d = cx[j]*nx + cy[j]*ny + cz[j]*nz;
+            const Float r = ex[j]*ax + ey[j]*ay + ez[j]*az;
+            inside[j] = inside[j] && !(d + r < w);
+        }
+    }
+
+    return packBits(inside);
+}
+
+}
+
+void rangeFrustum(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(ranges.size() == intersects.size(),
+        "Math::Intersection::rangeFrustum(): expected output view size to be" << ranges.size() << "but got" << intersects.size(), );
+
+    const TransposedFrustum planes{frustum};
+    for(std::size_t i = 0, size = ranges.size(); i < size; i += BatchSize) {
+        const std::size_t count = Math::min(BatchSize, size - i);
+
+        /* Convert to center/extent, avoiding division by 2 and instead
+           comparing to 2*-plane.w(), same as in the scalar variant. The
+           unused lanes are zero-filled to not operate on garbage. */
+        Float cx[BatchSize]{}, cy[BatchSize]{}, cz[BatchSize]{};
+        Float ex[BatchSize]{}, ey[BatchSize]{}, ez[BatchSize]{};
+        for(std::size_t j = 0; j != count; ++j) {
+            const Range3D<Float>& range = ranges[i + j];
+            const Vector3<Float> center = range.min() + range.max();
+            const Vector3<Float> extent = range.max() - range.min();
+            cx[j] = center.x();
+            cy[j] = center.y();
+            cz[j] = center.z();
+            ex[j] = extent.x();
+            ey[j] = extent.y();
+            ez[j] = extent.z();
+        }
+
+        writeBits(intersects, i, boxFrustumBatch(cx, cy, cz, ex, ey, ez, planes, 2.0f), count);
+    }
+}
+
+void aabbFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(aabbExtents.size() == aabbCenters.size(),
+        "Math::Intersection::aabbFrustum(): expected extent view size to be" << aabbCenters.size() << "but got" << aabbExtents.size(), );
+    CORRADE_ASSERT(intersects.size() == aabbCenters.size(),
+        "Math::Intersection::aabbFrustum(): expected output view size to be" << aabbCenters.size() << "but got" << intersects.size(), );
+
+    const TransposedFrustum planes{frustum};
+    for(std::size_t i = 0, size = aabbCenters.size(); i < size; i += BatchSize) {
+        const std::size_t count = Math::min(BatchSize, size - i);
+
+        Float cx[BatchSize]{}, cy[BatchSize]{}, cz[BatchSize]{};
+        Float ex[BatchSize]{}, ey[BatchSize]{}, ez[BatchSize]{};
+        for(std::size_t j = 0; j != count; ++j) {
+            const Vector3<Float>& center = aabbCenters[i + j];
+            const Vector3<Float>& extent = aabbExtents[i + j];
+            cx[j] = center.x();
+            cy[j] = center.y();
+            cz[j] = center.z();
+            ex[j] = extent.x();
+            ey[j] = extent.y();
+            ez[j] = extent.z();
+        }
+
+        writeBits(intersects, i, boxFrustumBatch(cx, cy, cz, ex, ey, ez, planes, 1.0f), count);
+    }
+}
+
+void sphereFrustum(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(sphereRadii.size() == sphereCenters.size(),
+        "Math::Intersection::sphereFrustum(): expected radius view size to be" << sphereCenters.size() << "but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(intersects.size() == sphereCenters.size(),
+        "Math::Intersection::sphereFrustum(): expected output view size to be" << sphereCenters.size() << "but got" << intersects.size(), );
+
+    const TransposedFrustum planes{frustum};
+    for(std::size_t i = 0, size = sphereCenters.size(); i < size; i += BatchSize) {
+        const std::size_t count = Math::min(BatchSize, size - i);
+
+        Float cx[BatchSize]{}, cy[BatchSize]{}, cz[BatchSize]{};
+        Float minusRadiusSq[BatchSize]{};
+        for(std::size_t j = 0; j != count; ++j) {
+            const Vector3<Float>& center = sphereCenters[i + j];
+            const Float radius = sphereRadii[i + j];
+            cx[j] = center.x();
+            cy[j] = center.y();
+            cz[j] = center.z();
+            minusRadiusSq[j] = -(radius*radius);
+        }
+
+        bool inside[BatchSize];
+        for(std::size_t j = 0; j != BatchSize; ++j)
+            inside[j] = true;
+
+        for(std::size_t p = 0; p != 6; ++p) {
+            const Float nx = planes.x[p];
+            const Float ny = planes.y[p];
+            const Float nz = planes.z[p];
+            const Float w = planes.w[p];
+            for(std::size_t j = 0; j != BatchSize; ++j) {
+                /* Same as Distance::pointPlaneScaled() */
+                const Float distance = nx*cx[j] + ny*cy[j] + nz*cz[j] + w;
+                inside[j] = inside[j] && !(distance < minusRadiusSq[j]);
+            }
+        }
+
+        writeBits(intersects, i, packBits(inside), count);
+    }
+}
+
+void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Rad<Float> coneAngle, const Containers::MutableBitArrayView intersects) {
+    /* Same as in the scalar variant */
+    const Rad<Float> halfAngle = coneAngle*0.5f;
+    const Float sinAngle = Math::sin(halfAngle);
+    const Float tanAngleSqPlusOne = 1.0f + Math::pow<Float>(Math::tan<Float>(halfAngle), 2.0f);
+
+    sphereCone(sphereCenters, sphereRadii, coneOrigin, coneNormal, sinAngle, tanAngleSqPlusOne, intersects);
+}
+
+void sphereCone(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Float sinAngle, const Float tanAngleSqPlusOne, const Containers::MutableBitArrayView intersects) {
+    CORRADE_ASSERT(sphereRadii.size() == sphereCenters.size(),
+        "Math::Intersection::sphereCone(): expected radius view size to be" << sphereCenters.size() << "but got" << sphereRadii.size(), );
+    CORRADE_ASSERT(intersects.size() == sphereCenters.size(),
+        "Math::Intersection::sphereCone(): expected output view size to be" << sphereCenters.size() << "but got" << intersects.size(), );
+
+    const Float nx = coneNormal.x();
+    const Float ny = coneNormal.y();
+    const Float nz = coneNormal.z();
+    for(std::size_t i = 0, size = sphereCenters.size(); i < size; i += BatchSize) {
+        const std::size_t count = Math::min(BatchSize, size - i);
+
+        Float dx[BatchSize]{}, dy[BatchSize]{}, dz[BatchSize]{};
+        Float radii[BatchSize]{};
+        for(std::size_t j = 0; j != count; ++j) {
+            const Vector3<Float> diff = sphereCenters[i + j] - coneOrigin;
+            dx[j] = diff.x();
+            dy[j] = diff.y();
+            dz[j] = diff.z();
+            radii[j] = sphereRadii[i + j];
+        }
+
+        /* Evaluate both the point-cone and the sphere-origin test and pick
+           one based on which side of the offset cone plane the sphere is.
+           The operations are done in the same order as in the scalar
+           variant to get the exact same results. */
+        bool inside[BatchSize];
+        for(std::size_t j = 0; j != BatchSize; ++j) {
+            const Float offset = radii[j]*sinAngle;
+            const Float px = dx[j] - offset*nx;
+            const Float py = dy[j] - offset*ny;
+            const Float pz = dz[j] - offset*nz;
+            const bool inFront = px*nx + py*ny + pz*nz > 0.0f;
+
+            const Float cx = sinAngle*dx[j] + nx*radii[j];
+            const Float cy = sinAngle*dy[j] + ny*radii[j];
+            const Float cz = sinAngle*dz[j] + nz*radii[j];
+            const Float lenA = cx*nx + cy*ny + cz*nz;
+            const bool inCone = cx*cx + cy*cy + cz*cz <= lenA*lenA*tanAngleSqPlusOne;
+
+            const bool inSphere = dx[j]*dx[j] + dy[j]*dy[j] + dz[j]*dz[j] <= radii[j]*radii[j];
+
+            inside[j] = inFront ? inCone : inSphere;
+        }
+
+        writeBits(intersects, i, packBits(inside), count);
+    }
+}
+
+}}}
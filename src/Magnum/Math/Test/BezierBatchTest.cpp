@@ -0,0 +1,422 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/BezierBatch.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct BezierBatchTest: TestSuite::Tester {
+    explicit BezierBatchTest();
+
+    void valueCurves2D();
+    void valueCurves3D();
+    void valuePositions2D();
+    void valuePositions3D();
+    void valueEmpty();
+
+    void uniformValue2D();
+    void uniformValue3D();
+
+    void flatten2D();
+    void flatten3D();
+    void flattenLine();
+
+    void arcLength2D();
+    void arcLength3D();
+    void arcLengthLine();
+    void arcLengthParameter();
+    void arcLengthParameterZeroLengthInterval();
+
+    void invalidSize();
+    void flattenInvalidTolerance();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::CubicBezier2D<Float> CubicBezier2D;
+typedef Math::CubicBezier3D<Float> CubicBezier3D;
+
+const struct {
+    std::size_t count;
+} UniformValueData[]{
+    {2},
+    {3},
+    {31},
+    /* Exactly one forward differencing block */
+    {32},
+    /* One item in the second block */
+    {33},
+    {1000}
+};
+
+const struct {
+    Float tolerance;
+} FlattenData[]{
+    {0.1f},
+    {0.01f},
+    {0.001f}
+};
+
+const CubicBezier2D Curve2D{Vector2{0.0f, 0.0f}, Vector2{1.0f, 3.0f}, Vector2{4.0f, -2.0f}, Vector2{5.0f, 1.0f}};
+const CubicBezier3D Curve3D{Vector3{0.0f, 0.0f, 1.0f}, Vector3{1.0f, 3.0f, -2.0f}, Vector3{4.0f, -2.0f, 0.5f}, Vector3{5.0f, 1.0f, 2.0f}};
+
+BezierBatchTest::BezierBatchTest() {
+    addTests({&BezierBatchTest::valueCurves2D,
+              &BezierBatchTest::valueCurves3D,
+              &BezierBatchTest::valuePositions2D,
+              &BezierBatchTest::valuePositions3D,
+              &BezierBatchTest::valueEmpty});
+
+    addInstancedTests({&BezierBatchTest::uniformValue2D,
+                       &BezierBatchTest::uniformValue3D},
+        Containers::arraySize(UniformValueData));
+
+    addInstancedTests({&BezierBatchTest::flatten2D,
+                       &BezierBatchTest::flatten3D},
+        Containers::arraySize(FlattenData));
+
+    addTests({&BezierBatchTest::flattenLine,
+
+              &BezierBatchTest::arcLength2D,
+              &BezierBatchTest::arcLength3D,
+              &BezierBatchTest::arcLengthLine,
+              &BezierBatchTest::arcLengthParameter,
+              &BezierBatchTest::arcLengthParameterZeroLengthInterval,
+
+              &BezierBatchTest::invalidSize,
+              &BezierBatchTest::flattenInvalidTolerance});
+}
+
+void BezierBatchTest::valueCurves2D() {
+    struct Data {
+        CubicBezier2D curve;
+        Vector2 value;
+    } data[]{
+        {Curve2D, {}},
+        {{Vector2{-1.0f, 2.0f}, Vector2{0.5f, 0.5f}, Vector2{3.0f, 1.0f}, Vector2{2.0f, -5.0f}}, {}},
+        {{Vector2{3.0f}, Vector2{3.0f}, Vector2{3.0f}, Vector2{3.0f}}, {}},
+    };
+
+    for(Float t: {0.0f, 0.25f, 0.7f, 1.0f}) {
+        CORRADE_ITERATION(t);
+        Containers::StridedArrayView1D<Data> view = data;
+        bezierValueInto(view.slice(&Data::curve), t, view.slice(&Data::value));
+        for(const Data& i: data)
+            CORRADE_COMPARE(i.value, i.curve.value(t));
+    }
+}
+
+void BezierBatchTest::valueCurves3D() {
+    struct Data {
+        CubicBezier3D curve;
+        Vector3 value;
+    } data[]{
+        {Curve3D, {}},
+        {{Vector3{-1.0f, 2.0f, 0.0f}, Vector3{0.5f, 0.5f, 0.5f}, Vector3{3.0f, 1.0f, -1.0f}, Vector3{2.0f, -5.0f, 7.0f}}, {}},
+    };
+
+    for(Float t: {0.0f, 0.25f, 0.7f, 1.0f}) {
+        CORRADE_ITERATION(t);
+        Containers::StridedArrayView1D<Data> view = data;
+        bezierValueInto(view.slice(&Data::curve), t, view.slice(&Data::value));
+        for(const Data& i: data)
+            CORRADE_COMPARE(i.value, i.curve.value(t));
+    }
+}
+
+void BezierBatchTest::valuePositions2D() {
+    struct Data {
+        Float t;
+        Vector2 value;
+    } data[]{
+        {0.0f, {}},
+        {0.1f, {}},
+        {0.5f, {}},
+        {0.9f, {}},
+        {1.0f, {}}
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    bezierValueInto(Curve2D, view.slice(&Data::t), view.slice(&Data::value));
+    for(const Data& i: data) {
+        CORRADE_ITERATION(i.t);
+        CORRADE_COMPARE(i.value, Curve2D.value(i.t));
+    }
+}
+
+void BezierBatchTest::valuePositions3D() {
+    struct Data {
+        Float t;
+        Vector3 value;
+    } data[]{
+        {0.0f, {}},
+        {0.3f, {}},
+        {0.6f, {}},
+        {1.0f, {}}
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    bezierValueInto(Curve3D, view.slice(&Data::t), view.slice(&Data::value));
+    for(const Data& i: data) {
+        CORRADE_ITERATION(i.t);
+        CORRADE_COMPARE(i.value, Curve3D.value(i.t));
+    }
+}
+
+void BezierBatchTest::valueEmpty() {
+    /* Shouldn't crash or assert */
+    bezierValueInto(Containers::StridedArrayView1D<const CubicBezier2D>{}, 0.5f, Containers::StridedArrayView1D<Vector2>{});
+    bezierValueInto(Curve3D, Containers::StridedArrayView1D<const Float>{}, Containers::StridedArrayView1D<Vector3>{});
+    CORRADE_VERIFY(true);
+}
+
+void BezierBatchTest::uniformValue2D() {
+    auto&& data = UniformValueData[testCaseInstanceId()];
+    setTestCaseDescription(Utility::format("{}", data.count));
+
+    Containers::Array<Vector2> values{NoInit, data.count};
+    bezierUniformValueInto(Curve2D, values);
+
+    /* The endpoints are exact */
+    CORRADE_COMPARE(values.front(), Curve2D[0]);
+    CORRADE_COMPARE(values.back(), Curve2D[3]);
+
+    for(std::size_t i = 0; i != values.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(values[i], Curve2D.value(Float(i)/(data.count - 1)));
+    }
+}
+
+void BezierBatchTest::uniformValue3D() {
+    auto&& data = UniformValueData[testCaseInstanceId()];
+    setTestCaseDescription(Utility::format("{}", data.count));
+
+    /* Strided output */
+    Containers::Array<Vector4<Float>> values{NoInit, data.count};
+    Containers::StridedArrayView1D<Vector4<Float>> view = values;
+    bezierUniformValueInto(Curve3D, view.slice(&Vector4<Float>::xyz));
+
+    for(std::size_t i = 0; i != values.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(values[i].xyz(), Curve3D.value(Float(i)/(data.count - 1)));
+    }
+}
+
+/* Max distance of the curve from the polyline, sampled at a lot of places */
+template<class T> Float maxDistance(const Bezier<3, T::Size, Float>& curve, Containers::ArrayView<const T> polyline) {
+    Float maxDistance = 0.0f;
+    for(std::size_t i = 0; i <= 2000; ++i) {
+        const T point = curve.value(i/2000.0f);
+        Float minDistance = Constants<Float>::inf();
+        for(std::size_t j = 1; j != polyline.size(); ++j) {
+            const T a = polyline[j - 1];
+            const T direction = polyline[j] - a;
+            const Float t = Math::clamp(Math::dot(point - a, direction)/direction.dot(), 0.0f, 1.0f);
+            minDistance = Math::min(minDistance, (a + t*direction - point).length());
+        }
+        maxDistance = Math::max(maxDistance, minDistance);
+    }
+
+    return maxDistance;
+}
+
+void BezierBatchTest::flatten2D() {
+    auto&& data = FlattenData[testCaseInstanceId()];
+    setTestCaseDescription(Utility::format("{}", data.tolerance));
+
+    Containers::Array<Vector2> points = bezierFlatten(Curve2D, data.tolerance);
+    CORRADE_COMPARE_AS(points.size(), std::size_t{2},
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(points.front(), Curve2D[0]);
+    CORRADE_COMPARE(points.back(), Curve2D[3]);
+    CORRADE_COMPARE_AS(maxDistance<Vector2>(Curve2D, points), data.tolerance,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void BezierBatchTest::flatten3D() {
+    auto&& data = FlattenData[testCaseInstanceId()];
+    setTestCaseDescription(Utility::format("{}", data.tolerance));
+
+    Containers::Array<Vector3> points = bezierFlatten(Curve3D, data.tolerance);
+    CORRADE_COMPARE_AS(points.size(), std::size_t{2},
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(points.front(), Curve3D[0]);
+    CORRADE_COMPARE(points.back(), Curve3D[3]);
+    CORRADE_COMPARE_AS(maxDistance<Vector3>(Curve3D, points), data.tolerance,
+        TestSuite::Compare::LessOrEqual);
+}
+
+void BezierBatchTest::flattenLine() {
+    /* Control points on a line don't need any subdivision */
+    Containers::Array<Vector2> points = bezierFlatten(CubicBezier2D{Vector2{1.0f, 2.0f}, Vector2{2.0f, 3.0f}, Vector2{3.0f, 4.0f}, Vector2{4.0f, 5.0f}}, 0.001f);
+    CORRADE_COMPARE(points.size(), 2);
+    CORRADE_COMPARE(points[0], (Vector2{1.0f, 2.0f}));
+    CORRADE_COMPARE(points[1], (Vector2{4.0f, 5.0f}));
+}
+
+/* Curve length approximated by a polyline with a lot of segments */
+template<class T> Float referenceLength(const Bezier<3, T::Size, Float>& curve, Float t) {
+    Double length = 0.0;
+    T previous = curve[0];
+    for(std::size_t i = 1; i <= 100000; ++i) {
+        const T current = curve.value(t*i/100000.0f);
+        length += (current - previous).length();
+        previous = current;
+    }
+    return Float(length);
+}
+
+void BezierBatchTest::arcLength2D() {
+    Float lengths[5];
+    bezierArcLengthInto(Curve2D, lengths);
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    for(std::size_t i = 1; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(lengths[i], referenceLength<Vector2>(Curve2D, i/4.0f),
+            TestSuite::Compare::around(0.0001f));
+    }
+}
+
+void BezierBatchTest::arcLength3D() {
+    Float lengths[3];
+    bezierArcLengthInto(Curve3D, lengths);
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    for(std::size_t i = 1; i != 3; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(lengths[i], referenceLength<Vector3>(Curve3D, i/2.0f),
+            TestSuite::Compare::around(0.0001f));
+    }
+}
+
+void BezierBatchTest::arcLengthLine() {
+    /* Evenly distributed control points on a line have the arc length
+       proportional to the parameter */
+    Float lengths[4];
+    bezierArcLengthInto(CubicBezier2D{Vector2{0.0f, 0.0f}, Vector2{1.0f, 2.0f}, Vector2{2.0f, 4.0f}, Vector2{3.0f, 6.0f}}, lengths);
+    const Float length = Vector2{3.0f, 6.0f}.length();
+    CORRADE_COMPARE(lengths[0], 0.0f);
+    CORRADE_COMPARE(lengths[1], length/3.0f);
+    CORRADE_COMPARE(lengths[2], length*2.0f/3.0f);
+    CORRADE_COMPARE(lengths[3], length);
+}
+
+void BezierBatchTest::arcLengthParameter() {
+    const Float lengths[]{0.0f, 1.0f, 3.0f, 6.0f, 10.0f};
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 0.0f), 0.0f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 0.5f), 0.125f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 1.0f), 0.25f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 2.0f), 0.375f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 7.0f), 0.8125f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 10.0f), 1.0f);
+
+    /* Out of range values are clamped */
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, -1.0f), 0.0f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 11.0f), 1.0f);
+
+    /* Together with a real curve, the point at half the length should have
+       the same distance along the curve from both ends */
+    Float curveLengths[65];
+    bezierArcLengthInto(Curve2D, curveLengths);
+    const Float t = Math::arcLengthParameter(curveLengths, curveLengths[64]*0.5f);
+    CORRADE_COMPARE_WITH(referenceLength<Vector2>(Curve2D, t), curveLengths[64]*0.5f,
+        TestSuite::Compare::around(0.001f));
+}
+
+void BezierBatchTest::arcLengthParameterZeroLengthInterval() {
+    /* Degenerate parts of the curve, for a length matching multiple table
+       entries the end of the degenerate part is picked */
+    const Float lengths[]{0.0f, 2.0f, 2.0f, 2.0f, 4.0f};
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 1.0f), 0.125f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 2.0f), 0.75f);
+    CORRADE_COMPARE(Math::arcLengthParameter(lengths, 3.0f), 0.875f);
+
+    const Float zero[]{0.0f, 0.0f, 0.0f};
+    CORRADE_COMPARE(Math::arcLengthParameter(zero, 0.0f), 0.0f);
+    CORRADE_COMPARE(Math::arcLengthParameter(zero, 1.0f), 1.0f);
+}
+
+void BezierBatchTest::invalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const CubicBezier2D curves2D[3]{};
+    const CubicBezier3D curves3D[3]{};
+    const Float t[3]{};
+    Vector2 values2D[2];
+    Vector3 values3D[2];
+    Vector2 values2D1[1];
+    Vector3 values3D1[1];
+    Float lengths[1];
+
+    Containers::String out;
+    Error redirectError{&out};
+    bezierValueInto(curves2D, 0.5f, values2D);
+    bezierValueInto(curves3D, 0.5f, values3D);
+    bezierValueInto(Curve2D, t, values2D);
+    bezierValueInto(Curve3D, t, values3D);
+    bezierUniformValueInto(Curve2D, values2D1);
+    bezierUniformValueInto(Curve3D, values3D1);
+    bezierArcLengthInto(Curve2D, lengths);
+    bezierArcLengthInto(Curve3D, lengths);
+    Math::arcLengthParameter(Containers::arrayView(lengths), 0.0f);
+    CORRADE_COMPARE_AS(out,
+        "Math::bezierValueInto(): expected curve and value views to have the same size, got 3 and 2\n"
+        "Math::bezierValueInto(): expected curve and value views to have the same size, got 3 and 2\n"
+        "Math::bezierValueInto(): expected position and value views to have the same size, got 3 and 2\n"
+        "Math::bezierValueInto(): expected position and value views to have the same size, got 3 and 2\n"
+        "Math::bezierUniformValueInto(): expected at least two values, got 1\n"
+        "Math::bezierUniformValueInto(): expected at least two values, got 1\n"
+        "Math::bezierArcLengthInto(): expected at least two values, got 1\n"
+        "Math::bezierArcLengthInto(): expected at least two values, got 1\n"
+        "Math::arcLengthParameter(): expected at least two values, got 1\n",
+        TestSuite::Compare::String);
+}
+
+void BezierBatchTest::flattenInvalidTolerance() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    bezierFlatten(Curve2D, 0.0f);
+    bezierFlatten(Curve3D, -1.0f);
+    CORRADE_COMPARE(out,
+        "Math::bezierFlatten(): expected a positive tolerance, got 0\n"
+        "Math::bezierFlatten(): expected a positive tolerance, got -1\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BezierBatchTest)
@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/CubicHermiteBatch.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct CubicHermiteBatchTest: TestSuite::Tester {
+    explicit CubicHermiteBatchTest();
+
+    template<class T> void splerpSegments();
+    template<class T> void splerpPhases();
+
+    void splerpInvalidSize();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::CubicHermite1D<Float> CubicHermite1D;
+typedef Math::CubicHermite2D<Float> CubicHermite2D;
+typedef Math::CubicHermite3D<Float> CubicHermite3D;
+
+template<class T> struct SplineData;
+template<> struct SplineData<Float> {
+    static const char* name() { return "1D"; }
+    static CubicHermite1D a() { return {2.0f, 3.0f, -8.0f}; }
+    static CubicHermite1D b() { return {5.0f, -2.0f, 1.5f}; }
+};
+template<> struct SplineData<Vector2> {
+    static const char* name() { return "2D"; }
+    static CubicHermite2D a() { return {{2.0f, 1.5f}, {3.0f, 0.1f}, {-7.0f, 1.0f}}; }
+    static CubicHermite2D b() { return {{5.0f, 0.3f}, {-2.0f, 1.1f}, {1.5f, 0.3f}}; }
+};
+template<> struct SplineData<Vector3> {
+    static const char* name() { return "3D"; }
+    static CubicHermite3D a() { return {{2.0f, 1.5f, 0.3f}, {3.0f, 0.1f, 2.3f}, {-7.0f, 1.0f, 0.0f}}; }
+    static CubicHermite3D b() { return {{5.0f, 0.3f, 1.1f}, {-2.0f, 1.1f, 1.0f}, {1.5f, 0.3f, 17.0f}}; }
+};
+
+CubicHermiteBatchTest::CubicHermiteBatchTest() {
+    addTests({&CubicHermiteBatchTest::splerpSegments<Float>,
+              &CubicHermiteBatchTest::splerpSegments<Vector2>,
+              &CubicHermiteBatchTest::splerpSegments<Vector3>,
+              &CubicHermiteBatchTest::splerpPhases<Float>,
+              &CubicHermiteBatchTest::splerpPhases<Vector2>,
+              &CubicHermiteBatchTest::splerpPhases<Vector3>,
+
+              &CubicHermiteBatchTest::splerpInvalidSize});
+}
+
+template<class T> void CubicHermiteBatchTest::splerpSegments() {
+    setTestCaseTemplateName(SplineData<T>::name());
+
+    const CubicHermite<T> a = SplineData<T>::a();
+    const CubicHermite<T> b = SplineData<T>::b();
+    struct Data {
+        CubicHermite<T> a, b;
+        T value;
+    } data[]{
+        {a, b, {}},
+        {b, a, {}},
+        {a, a, {}}
+    };
+
+    for(Float t: {0.0f, 0.3f, 0.8f, 1.0f}) {
+        CORRADE_ITERATION(t);
+        Containers::StridedArrayView1D<Data> view = data;
+        splerpInto(view.slice(&Data::a), view.slice(&Data::b), t, view.slice(&Data::value));
+        for(const Data& i: data)
+            CORRADE_COMPARE(i.value, splerp(i.a, i.b, t));
+    }
+}
+
+template<class T> void CubicHermiteBatchTest::splerpPhases() {
+    setTestCaseTemplateName(SplineData<T>::name());
+
+    const CubicHermite<T> a = SplineData<T>::a();
+    const CubicHermite<T> b = SplineData<T>::b();
+    struct Data {
+        Float t;
+        T value;
+    } data[]{
+        {0.0f, {}},
+        {0.3f, {}},
+        {0.5f, {}},
+        {0.8f, {}},
+        {1.0f, {}}
+    };
+
+    Containers::StridedArrayView1D<Data> view = data;
+    splerpInto(a, b, view.slice(&Data::t), view.slice(&Data::value));
+    for(const Data& i: data) {
+        CORRADE_ITERATION(i.t);
+        CORRADE_COMPARE(i.value, splerp(a, b, i.t));
+    }
+}
+
+void CubicHermiteBatchTest::splerpInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const CubicHermite2D a[3];
+    const CubicHermite2D b[2];
+    const Float t[3]{};
+    Vector2 values[2];
+
+    Containers::String out;
+    Error redirectError{&out};
+    splerpInto(a, b, 0.5f, values);
+    splerpInto(Containers::arrayView(a).prefix(2), b, 0.5f, Containers::arrayView(values).prefix(1));
+    splerpInto(SplineData<Vector2>::a(), SplineData<Vector2>::b(), t, values);
+    CORRADE_COMPARE_AS(out,
+        "Math::splerpInto(): expected first and second point views to have the same size, got 3 and 2\n"
+        "Math::splerpInto(): wrong destination size, got 1 but expected 2\n"
+        "Math::splerpInto(): wrong destination size, got 2 but expected 3\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::CubicHermiteBatchTest)
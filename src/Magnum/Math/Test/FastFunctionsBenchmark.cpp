@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/FastFunctions.h"
+#include "Magnum/Math/FastFunctionsBatch.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct FastFunctionsBenchmark: TestSuite::Tester {
+    explicit FastFunctionsBenchmark();
+
+    void sqrtInverted();
+    void sqrtInvertedFast();
+    void sqrtInvertedFastBatch();
+
+    void sincos();
+    void sincosFast();
+    void sincosFastBatch();
+
+    void atan2();
+    void atan2Fast();
+    void atan2FastBatch();
+
+    void exp2();
+    void exp2Fast();
+    void exp2FastBatch();
+
+    void log2();
+    void log2Fast();
+    void log2FastBatch();
+
+    void pow();
+    void powFast();
+    void powFastBatch();
+
+    private:
+        Containers::Array<Float> _a, _b, _out, _out2;
+};
+
+enum: std::size_t { Size = 16384 };
+
+FastFunctionsBenchmark::FastFunctionsBenchmark() {
+    addBenchmarks({&FastFunctionsBenchmark::sqrtInverted,
+                   &FastFunctionsBenchmark::sqrtInvertedFast,
+                   &FastFunctionsBenchmark::sqrtInvertedFastBatch,
+
+                   &FastFunctionsBenchmark::sincos,
+                   &FastFunctionsBenchmark::sincosFast,
+                   &FastFunctionsBenchmark::sincosFastBatch,
+
+                   &FastFunctionsBenchmark::atan2,
+                   &FastFunctionsBenchmark::atan2Fast,
+                   &FastFunctionsBenchmark::atan2FastBatch,
+
+                   &FastFunctionsBenchmark::exp2,
+                   &FastFunctionsBenchmark::exp2Fast,
+                   &FastFunctionsBenchmark::exp2FastBatch,
+
+                   &FastFunctionsBenchmark::log2,
+                   &FastFunctionsBenchmark::log2Fast,
+                   &FastFunctionsBenchmark::log2FastBatch,
+
+                   &FastFunctionsBenchmark::pow,
+                   &FastFunctionsBenchmark::powFast,
+                   &FastFunctionsBenchmark::powFastBatch}, 50);
+
+    /* Inputs in range valid for all functions */
+    _a = Containers::Array<Float>{NoInit, Size};
+    _b = Containers::Array<Float>{NoInit, Size};
+    _out = Containers::Array<Float>{ValueInit, Size};
+    _out2 = Containers::Array<Float>{ValueInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) {
+        _a[i] = 0.01f + 10.0f*Float(i)/Size;
+        _b[i] = -4.0f + 8.0f*Float((i*7919) % Size)/Size;
+    }
+}
+
+void FastFunctionsBenchmark::sqrtInverted() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Math::sqrtInverted(_a[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::sqrtInvertedFast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Fast::sqrtInverted(_a[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::sqrtInvertedFastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::sqrtInvertedInto(_a, _out);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::sincos() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) {
+            const Containers::Pair<Float, Float> sincos = Math::sincos(Rad<Float>{_b[i]});
+            _out[i] = sincos.first();
+            _out2[i] = sincos.second();
+        }
+
+    CORRADE_VERIFY(_out[0] != _out2[0]);
+}
+
+void FastFunctionsBenchmark::sincosFast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) {
+            const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad<Float>{_b[i]});
+            _out[i] = sincos.first();
+            _out2[i] = sincos.second();
+        }
+
+    CORRADE_VERIFY(_out[0] != _out2[0]);
+}
+
+void FastFunctionsBenchmark::sincosFastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::sincosInto(_b, _out, _out2);
+
+    CORRADE_VERIFY(_out[0] != _out2[0]);
+}
+
+void FastFunctionsBenchmark::atan2() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = std::atan2(_b[i], _a[i]);
+
+    CORRADE_VERIFY(_out[0] != 0.0f);
+}
+
+void FastFunctionsBenchmark::atan2Fast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Float(Fast::atan2(_b[i], _a[i]));
+
+    CORRADE_VERIFY(_out[0] != 0.0f);
+}
+
+void FastFunctionsBenchmark::atan2FastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::atan2Into(_b, _a, _out);
+
+    CORRADE_VERIFY(_out[0] != 0.0f);
+}
+
+void FastFunctionsBenchmark::exp2() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = std::exp2(_b[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::exp2Fast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Fast::exp2(_b[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::exp2FastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::exp2Into(_b, _out);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::log2() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = std::log2(_a[i]);
+
+    CORRADE_VERIFY(_out[0] < 0.0f);
+}
+
+void FastFunctionsBenchmark::log2Fast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Fast::log2(_a[i]);
+
+    CORRADE_VERIFY(_out[0] < 0.0f);
+}
+
+void FastFunctionsBenchmark::log2FastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::log2Into(_a, _out);
+
+    CORRADE_VERIFY(_out[0] < 0.0f);
+}
+
+void FastFunctionsBenchmark::pow() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Math::pow(_a[i], _b[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::powFast() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            _out[i] = Fast::pow(_a[i], _b[i]);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+void FastFunctionsBenchmark::powFastBatch() {
+    CORRADE_BENCHMARK(1)
+        Fast::powInto(_a, _b, _out);
+
+    CORRADE_VERIFY(_out[0] > 0.0f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastFunctionsBenchmark)
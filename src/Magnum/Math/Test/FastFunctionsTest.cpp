@@ -0,0 +1,452 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/FastFunctions.h"
+#include "Magnum/Math/FastFunctionsBatch.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct FastFunctionsTest: TestSuite::Tester {
+    explicit FastFunctionsTest();
+
+    void sqrtInverted();
+    void sincos();
+    void sincosDeg();
+    void atan2();
+    void exp2();
+    void log2();
+    void pow();
+
+    void sqrtInvertedBatch();
+    void sincosBatch();
+    void atan2Batch();
+    void exp2Batch();
+    void log2Batch();
+    void powBatch();
+    void powBatchScalarExponent();
+
+    void batchInvalidSize();
+};
+
+typedef Math::Constants<Float> Constants;
+typedef Math::Deg<Float> Deg;
+typedef Math::Rad<Float> Rad;
+
+const struct {
+    const char* name;
+    bool strided;
+} BatchData[]{
+    {"contiguous", false},
+    {"strided", true}
+};
+
+FastFunctionsTest::FastFunctionsTest() {
+    addTests({&FastFunctionsTest::sqrtInverted,
+              &FastFunctionsTest::sincos,
+              &FastFunctionsTest::sincosDeg,
+              &FastFunctionsTest::atan2,
+              &FastFunctionsTest::exp2,
+              &FastFunctionsTest::log2,
+              &FastFunctionsTest::pow});
+
+    addInstancedTests({&FastFunctionsTest::sqrtInvertedBatch,
+                       &FastFunctionsTest::sincosBatch,
+                       &FastFunctionsTest::atan2Batch,
+                       &FastFunctionsTest::exp2Batch,
+                       &FastFunctionsTest::log2Batch,
+                       &FastFunctionsTest::powBatch,
+                       &FastFunctionsTest::powBatchScalarExponent},
+        Containers::arraySize(BatchData));
+
+    addTests({&FastFunctionsTest::batchInvalidSize});
+}
+
+/* Calls given function for every step-th float in the [begin, end) range.
+   Both have to be positive. */
+template<class F> void forEachFloat(const Float begin, const Float end, const UnsignedInt step, F&& function) {
+    Fast::Implementation::FloatBits bits, endBits;
+    bits.f = begin;
+    endBits.f = end;
+    for(; bits.u < endBits.u; bits.u += step)
+        function(bits.f);
+}
+
+/* Calls given function for count evenly distributed values in the
+   [begin, end] range */
+template<class F> void forEachSample(const Float begin, const Float end, const std::size_t count, F&& function) {
+    for(std::size_t i = 0; i != count; ++i)
+        function(begin + (end - begin)*(Float(i)/(count - 1)));
+}
+
+void FastFunctionsTest::sqrtInverted() {
+    CORRADE_COMPARE_WITH(Fast::sqrtInverted(0.25f), 2.0f,
+        TestSuite::Compare::around(0.00001f));
+
+    /* The relative error repeats every two binades, so checking [1, 4) is
+       exhaustive for all normalized floats */
+    Double maxError = 0.0;
+    forEachFloat(1.0f, 4.0f, 1, [&](Float value) {
+        const Double expected = 1.0/std::sqrt(Double(value));
+        maxError = Math::max(maxError, std::abs(Fast::sqrtInverted(value) - expected)/expected);
+    });
+    CORRADE_COMPARE_AS(maxError, 5.0e-6,
+        TestSuite::Compare::Less);
+
+    /* Verify that the whole range behaves the same */
+    Double maxErrorRange = 0.0;
+    forEachFloat(1.0e-37f, 1.0e38f, 4093, [&](Float value) {
+        const Double expected = 1.0/std::sqrt(Double(value));
+        maxErrorRange = Math::max(maxErrorRange, std::abs(Fast::sqrtInverted(value) - expected)/expected);
+    });
+    CORRADE_COMPARE_AS(maxErrorRange, 5.0e-6,
+        TestSuite::Compare::Less);
+}
+
+void FastFunctionsTest::sincos() {
+    {
+        Containers::Pair<Float, Float> sincos = Fast::sincos(Rad{Constants::piHalf()});
+        CORRADE_COMPARE(sincos.first(), 1.0f);
+        CORRADE_COMPARE(sincos.second(), 0.0f);
+    } {
+        Containers::Pair<Float, Float> sincos = Fast::sincos(Rad{0.0f});
+        CORRADE_COMPARE(sincos.first(), 0.0f);
+        CORRADE_COMPARE(sincos.second(), 1.0f);
+    }
+
+    /* Every eighth float in [-π, π] except for the tiniest values, for which
+       the result is exact anyway */
+    Double maxError = 0.0;
+    forEachFloat(1.0e-4f, Constants::pi(), 8, [&](Float value) {
+        for(Float angle: {value, -value}) {
+            const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad{angle});
+            maxError = Math::max(maxError, Math::max(
+                std::abs(sincos.first() - std::sin(Double(angle))),
+                std::abs(sincos.second() - std::cos(Double(angle)))));
+        }
+    });
+    CORRADE_COMPARE_AS(maxError, 1.0e-7,
+        TestSuite::Compare::Less);
+
+    /* Larger angles have the error growing with the input magnitude */
+    for(Float range: {100.0f, 8192.0f}) {
+        CORRADE_ITERATION(range);
+        Double maxErrorRange = 0.0;
+        forEachSample(-range, range, 1000000, [&](Float angle) {
+            const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad{angle});
+            maxErrorRange = Math::max(maxErrorRange, Math::max(
+                std::abs(sincos.first() - std::sin(Double(angle))),
+                std::abs(sincos.second() - std::cos(Double(angle)))));
+        });
+        CORRADE_COMPARE_AS(maxErrorRange, range == 100.0f ? 4.0e-6 : 2.5e-4,
+            TestSuite::Compare::Less);
+    }
+}
+
+void FastFunctionsTest::sincosDeg() {
+    Containers::Pair<Float, Float> sincos = Fast::sincos(Deg{-150.0f});
+    CORRADE_COMPARE(sincos.first(), -0.5f);
+    CORRADE_COMPARE(sincos.second(), -0.866025f);
+}
+
+void FastFunctionsTest::atan2() {
+    CORRADE_COMPARE(Fast::atan2(0.0f, 0.0f), Rad{0.0f});
+    CORRADE_COMPARE(Fast::atan2(0.0f, 1.0f), Rad{0.0f});
+    CORRADE_COMPARE(Fast::atan2(1.0f, 0.0f), Rad{Constants::piHalf()});
+    CORRADE_COMPARE(Fast::atan2(0.0f, -1.0f), Rad{Constants::pi()});
+    CORRADE_COMPARE(Fast::atan2(-1.0f, 0.0f), Rad{-Constants::piHalf()});
+    CORRADE_COMPARE(Fast::atan2(-2.0f, -2.0f), Rad{-0.75f*Constants::pi()});
+
+    /* Every combination of x and y in all four quadrants */
+    Double maxError = 0.0;
+    forEachSample(-2.0f, 2.0f, 2001, [&](Float y) {
+        forEachSample(-2.0f, 2.0f, 2001, [&](Float x) {
+            maxError = Math::max(maxError, std::abs(Double(Float(Fast::atan2(y, x))) - std::atan2(Double(y), Double(x))));
+        });
+    });
+    CORRADE_COMPARE_AS(maxError, 2.5e-6,
+        TestSuite::Compare::Less);
+}
+
+void FastFunctionsTest::exp2() {
+    CORRADE_COMPARE(Fast::exp2(0.0f), 1.0f);
+    CORRADE_COMPARE(Fast::exp2(10.0f), 1024.0f);
+    CORRADE_COMPARE(Fast::exp2(-3.0f), 0.125f);
+    CORRADE_COMPARE(Fast::exp2(128.0f), Constants::inf());
+    CORRADE_COMPARE(Fast::exp2(1000.0f), Constants::inf());
+    CORRADE_COMPARE(Fast::exp2(-151.0f), 0.0f);
+    CORRADE_COMPARE(Fast::exp2(-1000.0f), 0.0f);
+    /* Results close to the max float value shouldn't overflow */
+    CORRADE_COMPARE_WITH(Fast::exp2(127.9f), Float(std::exp2(127.9)),
+        TestSuite::Compare::around(Float(std::exp2(127.9))*3.0e-7f));
+
+    /* Every float in range of normalized outputs, with a step that makes it
+       go through all mantissa bit positions */
+    Double maxError = 0.0;
+    forEachFloat(1.0e-6f, 126.0f, 61, [&](Float value) {
+        for(Float exponent: {value, -value}) {
+            const Double expected = std::exp2(Double(exponent));
+            maxError = Math::max(maxError, std::abs(Fast::exp2(exponent) - expected)/expected);
+        }
+    });
+    CORRADE_COMPARE_AS(maxError, 3.0e-7,
+        TestSuite::Compare::Less);
+}
+
+void FastFunctionsTest::log2() {
+    CORRADE_COMPARE(Fast::log2(1.0f), 0.0f);
+    CORRADE_COMPARE(Fast::log2(8.0f), 3.0f);
+    CORRADE_COMPARE(Fast::log2(0.5f), -1.0f);
+
+    /* All mantissa values */
+    Double maxError = 0.0;
+    Double maxRelativeError = 0.0;
+    forEachFloat(0.5f, 2.0f, 1, [&](Float value) {
+        const Double expected = std::log2(Double(value));
+        const Double error = std::abs(Fast::log2(value) - expected);
+        maxError = Math::max(maxError, error);
+        if(expected != 0.0)
+            maxRelativeError = Math::max(maxRelativeError, error/std::abs(expected));
+    });
+    CORRADE_COMPARE_AS(maxError, 5.0e-6,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(maxRelativeError, 4.0e-7,
+        TestSuite::Compare::Less);
+
+    /* All exponents, the absolute error is dominated by rounding of the
+       result */
+    Double maxErrorRange = 0.0;
+    forEachFloat(1.1754944e-38f, 3.4e38f, 4093, [&](Float value) {
+        maxErrorRange = Math::max(maxErrorRange, std::abs(Fast::log2(value) - std::log2(Double(value))));
+    });
+    CORRADE_COMPARE_AS(maxErrorRange, 5.0e-6,
+        TestSuite::Compare::Less);
+}
+
+void FastFunctionsTest::pow() {
+    CORRADE_COMPARE(Fast::pow(2.0f, 3.0f), 8.0f);
+    CORRADE_COMPARE(Fast::pow(4.0f, 0.5f), 2.0f);
+    CORRADE_COMPARE(Fast::pow(17.0f, 0.0f), 1.0f);
+
+    Double maxError = 0.0;
+    forEachSample(0.01f, 10.0f, 1001, [&](Float base) {
+        forEachSample(-4.0f, 4.0f, 1001, [&](Float exponent) {
+            const Double expected = std::pow(Double(base), Double(exponent));
+            maxError = Math::max(maxError, std::abs(Fast::pow(base, exponent) - expected)/expected);
+        });
+    });
+    CORRADE_COMPARE_AS(maxError, 2.0e-6,
+        TestSuite::Compare::Less);
+
+    Double maxErrorRange = 0.0;
+    forEachSample(0.001f, 1000.0f, 1001, [&](Float base) {
+        forEachSample(-10.0f, 10.0f, 1001, [&](Float exponent) {
+            const Double expected = std::pow(Double(base), Double(exponent));
+            maxErrorRange = Math::max(maxErrorRange, std::abs(Fast::pow(base, exponent) - expected)/expected);
+        });
+    });
+    CORRADE_COMPARE_AS(maxErrorRange, 1.0e-5,
+        TestSuite::Compare::Less);
+}
+
+/* Input data for the batch functions. The strided variant has every other
+   item skipped. */
+struct BatchInput {
+    explicit BatchInput(bool strided, std::size_t size, Float begin, Float end): data{ValueInit, size*(strided ? 2 : 1)}, view{Containers::stridedArrayView(data).every(strided ? 2 : 1)} {
+        for(std::size_t i = 0; i != size; ++i)
+            view[i] = begin + (end - begin)*(Float(i)/(size - 1));
+    }
+
+    Containers::Array<Float> data;
+    Containers::StridedArrayView1D<Float> view;
+};
+
+void FastFunctionsTest::sqrtInvertedBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Odd size to not hide issues with the remaining items in vectorized
+       loops */
+    BatchInput src{data.strided, 1001, 0.001f, 1000.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::sqrtInvertedInto(src.view, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Fast::sqrtInverted(src.view[i]);
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+
+    /* In-place */
+    Fast::sqrtInvertedInto(src.view, src.view);
+    CORRADE_COMPARE_AS(src.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::sincosBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput angles{data.strided, 1001, -10.0f, 10.0f};
+    BatchInput sin{data.strided, 1001, 0.0f, 0.0f};
+    BatchInput cos{data.strided, 1001, 0.0f, 0.0f};
+    Fast::sincosInto(angles.view, sin.view, cos.view);
+
+    Containers::Array<Float> expectedSin{NoInit, 1001};
+    Containers::Array<Float> expectedCos{NoInit, 1001};
+    for(std::size_t i = 0; i != expectedSin.size(); ++i) {
+        const Containers::Pair<Float, Float> sincos = Fast::sincos(Rad{angles.view[i]});
+        expectedSin[i] = sincos.first();
+        expectedCos[i] = sincos.second();
+    }
+    CORRADE_COMPARE_AS(sin.view, Containers::arrayView(expectedSin),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(cos.view, Containers::arrayView(expectedCos),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::atan2Batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput y{data.strided, 1001, -5.0f, 3.0f};
+    BatchInput x{data.strided, 1001, 2.0f, -7.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::atan2Into(y.view, x.view, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Float(Fast::atan2(y.view[i], x.view[i]));
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::exp2Batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput src{data.strided, 1001, -160.0f, 130.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::exp2Into(src.view, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Fast::exp2(src.view[i]);
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::log2Batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput src{data.strided, 1001, 0.001f, 1000.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::log2Into(src.view, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Fast::log2(src.view[i]);
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::powBatch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput bases{data.strided, 1001, 0.01f, 10.0f};
+    BatchInput exponents{data.strided, 1001, 4.0f, -4.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::powInto(bases.view, exponents.view, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Fast::pow(bases.view[i], exponents.view[i]);
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::powBatchScalarExponent() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    BatchInput bases{data.strided, 1001, 0.01f, 10.0f};
+    BatchInput dst{data.strided, 1001, 0.0f, 0.0f};
+    Fast::powInto(bases.view, 2.2f, dst.view);
+
+    Containers::Array<Float> expected{NoInit, 1001};
+    for(std::size_t i = 0; i != expected.size(); ++i)
+        expected[i] = Fast::pow(bases.view[i], 2.2f);
+    CORRADE_COMPARE_AS(dst.view, Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+}
+
+void FastFunctionsTest::batchInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Float a[3]{};
+    Float b[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    Fast::sqrtInvertedInto(a, b);
+    Fast::sincosInto(a, b, a);
+    Fast::sincosInto(a, a, b);
+    Fast::atan2Into(a, b, a);
+    Fast::atan2Into(a, a, b);
+    Fast::exp2Into(a, b);
+    Fast::log2Into(a, b);
+    Fast::powInto(a, b, a);
+    Fast::powInto(a, a, b);
+    Fast::powInto(a, 2.0f, b);
+    CORRADE_COMPARE_AS(out,
+        "Math::Fast::sqrtInvertedInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::Fast::sincosInto(): wrong sine destination size, got 2 but expected 3\n"
+        "Math::Fast::sincosInto(): wrong cosine destination size, got 2 but expected 3\n"
+        "Math::Fast::atan2Into(): expected X and Y views to have the same size, got 2 and 3\n"
+        "Math::Fast::atan2Into(): wrong destination size, got 2 but expected 3\n"
+        "Math::Fast::exp2Into(): wrong destination size, got 2 but expected 3\n"
+        "Math::Fast::log2Into(): wrong destination size, got 2 but expected 3\n"
+        "Math::Fast::powInto(): expected base and exponent views to have the same size, got 3 and 2\n"
+        "Math::Fast::powInto(): wrong destination size, got 2 but expected 3\n"
+        "Math::Fast::powInto(): wrong destination size, got 2 but expected 3\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastFunctionsTest)
@@ -24,12 +24,18 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #ifndef CORRADE_NO_ASSERT
 #define CORRADE_NO_ASSERT
 #endif
 
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/BezierBatch.h"
+#include "Magnum/Math/CubicHermite.h"
+#include "Magnum/Math/CubicHermiteBatch.h"
 #include "Magnum/Math/DualQuaternion.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
@@ -44,8 +50,27 @@ struct InterpolationBenchmark: TestSuite::Tester {
     void quaternionSlerpShortestPath();
     void dualQuaternionSclerp();
     void dualQuaternionSclerpShortestPath();
+
+    void bezierValue();
+    void bezierValueBatch();
+    void bezierValuePositions();
+    void bezierValuePositionsBatch();
+    void bezierUniformValue();
+    void bezierFlatten();
+    void bezierArcLength();
+    void splerp();
+    void splerpBatch();
+    void splerpPhasesBatch();
+
+    private:
+        Containers::Array<CubicBezier2D<Float>> _curves;
+        Containers::Array<CubicHermite2D<Float>> _splinePoints;
+        Containers::Array<Float> _t;
+        Containers::Array<Vector2<Float>> _values;
 };
 
+enum: std::size_t { CurveCount = 10000 };
+
 InterpolationBenchmark::InterpolationBenchmark() {
     addBenchmarks({&InterpolationBenchmark::baseline,
                    &InterpolationBenchmark::quaternionLerp,
@@ -54,6 +79,29 @@ InterpolationBenchmark::InterpolationBenchmark() {
                    &InterpolationBenchmark::quaternionSlerpShortestPath,
                    &InterpolationBenchmark::dualQuaternionSclerp,
                    &InterpolationBenchmark::dualQuaternionSclerpShortestPath}, 100);
+
+    addBenchmarks({&InterpolationBenchmark::bezierValue,
+                   &InterpolationBenchmark::bezierValueBatch,
+                   &InterpolationBenchmark::bezierValuePositions,
+                   &InterpolationBenchmark::bezierValuePositionsBatch,
+                   &InterpolationBenchmark::bezierUniformValue,
+                   &InterpolationBenchmark::bezierFlatten,
+                   &InterpolationBenchmark::bezierArcLength,
+                   &InterpolationBenchmark::splerp,
+                   &InterpolationBenchmark::splerpBatch,
+                   &InterpolationBenchmark::splerpPhasesBatch}, 50);
+
+    _curves = Containers::Array<CubicBezier2D<Float>>{NoInit, CurveCount};
+    _splinePoints = Containers::Array<CubicHermite2D<Float>>{NoInit, CurveCount + 1};
+    _t = Containers::Array<Float>{NoInit, CurveCount};
+    _values = Containers::Array<Vector2<Float>>{ValueInit, CurveCount};
+    for(std::size_t i = 0; i != CurveCount; ++i) {
+        const Float f = Float(i);
+        _curves[i] = {Vector2<Float>{f, 0.0f}, Vector2<Float>{f + 0.3f, 1.0f}, Vector2<Float>{f + 0.7f, -1.0f}, Vector2<Float>{f + 1.0f, 0.5f}};
+        _splinePoints[i] = {Vector2<Float>{1.0f, -0.5f}, Vector2<Float>{f, 0.5f*f}, Vector2<Float>{1.0f, 0.5f}};
+        _t[i] = f/(CurveCount - 1);
+    }
+    _splinePoints[CurveCount] = {Vector2<Float>{1.0f}, Vector2<Float>{Float(CurveCount)}, Vector2<Float>{1.0f}};
 }
 
 using namespace Literals;
@@ -156,6 +204,83 @@ void InterpolationBenchmark::dualQuaternionSclerpShortestPath() {
     CORRADE_VERIFY(!c.isNormalized());
 }
 
+void InterpolationBenchmark::bezierValue() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != CurveCount; ++i)
+            _values[i] = _curves[i].value(0.37f);
+
+    CORRADE_COMPARE(_values[0], _curves[0].value(0.37f));
+}
+
+void InterpolationBenchmark::bezierValueBatch() {
+    CORRADE_BENCHMARK(1)
+        bezierValueInto(_curves, 0.37f, _values);
+
+    CORRADE_COMPARE(_values[0], _curves[0].value(0.37f));
+}
+
+void InterpolationBenchmark::bezierValuePositions() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != CurveCount; ++i)
+            _values[i] = _curves[0].value(_t[i]);
+
+    CORRADE_COMPARE(_values.back(), _curves[0][3]);
+}
+
+void InterpolationBenchmark::bezierValuePositionsBatch() {
+    CORRADE_BENCHMARK(1)
+        bezierValueInto(_curves[0], _t, _values);
+
+    CORRADE_COMPARE(_values.back(), _curves[0][3]);
+}
+
+void InterpolationBenchmark::bezierUniformValue() {
+    CORRADE_BENCHMARK(1)
+        bezierUniformValueInto(_curves[0], _values);
+
+    CORRADE_COMPARE(_values.back(), _curves[0][3]);
+}
+
+void InterpolationBenchmark::bezierFlatten() {
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != 100; ++i)
+            count += Math::bezierFlatten(_curves[i], 0.001f).size();
+
+    CORRADE_VERIFY(count);
+}
+
+void InterpolationBenchmark::bezierArcLength() {
+    Float lengths[65];
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != 100; ++i)
+            bezierArcLengthInto(_curves[i], lengths);
+
+    CORRADE_VERIFY(lengths[64] > 0.0f);
+}
+
+void InterpolationBenchmark::splerp() {
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != CurveCount; ++i)
+            _values[i] = Math::splerp(_splinePoints[i], _splinePoints[i + 1], 0.37f);
+
+    CORRADE_COMPARE(_values[0], Math::splerp(_splinePoints[0], _splinePoints[1], 0.37f));
+}
+
+void InterpolationBenchmark::splerpBatch() {
+    CORRADE_BENCHMARK(1)
+        splerpInto(_splinePoints.exceptSuffix(1), _splinePoints.exceptPrefix(1), 0.37f, _values);
+
+    CORRADE_COMPARE(_values[0], Math::splerp(_splinePoints[0], _splinePoints[1], 0.37f));
+}
+
+void InterpolationBenchmark::splerpPhasesBatch() {
+    CORRADE_BENCHMARK(1)
+        splerpInto(_splinePoints[0], _splinePoints[1], _t, _values);
+
+    CORRADE_COMPARE(_values.back(), _splinePoints[1].point());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::InterpolationBenchmark)
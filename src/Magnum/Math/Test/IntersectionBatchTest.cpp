@@ -0,0 +1,281 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/BitArrayView.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
+
+namespace Magnum { namespace Math { namespace Test { namespace {
+
+struct IntersectionBatchTest: TestSuite::Tester {
+    explicit IntersectionBatchTest();
+
+    void rangeFrustum();
+    void aabbFrustum();
+    void sphereFrustum();
+    void sphereCone();
+    void sphereConeAngle();
+
+    void empty();
+    void invalidSize();
+};
+
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Range3D<Float> Range3D;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Deg<Float> Deg;
+typedef Math::Rad<Float> Rad;
+
+const struct {
+    const char* name;
+    std::size_t count;
+    std::size_t offset;
+} Data[]{
+    {"one", 1, 0},
+    {"exactly one batch", 8, 0},
+    {"exactly one batch, unaligned output", 8, 3},
+    {"several batches and a remainder", 203, 0},
+    {"several batches and a remainder, unaligned output", 203, 5}
+};
+
+IntersectionBatchTest::IntersectionBatchTest() {
+    addInstancedTests({&IntersectionBatchTest::rangeFrustum,
+                       &IntersectionBatchTest::aabbFrustum,
+                       &IntersectionBatchTest::sphereFrustum,
+                       &IntersectionBatchTest::sphereCone,
+                       &IntersectionBatchTest::sphereConeAngle},
+        Containers::arraySize(Data));
+
+    addTests({&IntersectionBatchTest::empty,
+              &IntersectionBatchTest::invalidSize});
+}
+
+/* A frustum that's not axis-aligned so all planes contribute */
+Frustum testFrustum() {
+    return Frustum::fromMatrix(
+        Matrix4::perspectiveProjection(Deg(60.0f), 1.33f, 0.5f, 25.0f)*
+        Matrix4::lookAt({3.0f, -2.0f, 4.0f}, {0.5f, 1.0f, -2.0f}, Vector3::yAxis()).inverted());
+}
+
+/* Deterministic input data with roughly half of the volumes intersecting.
+   Not using random_device in order to have the test reproducible. */
+struct Volumes {
+    Containers::Array<Vector3> centers;
+    Containers::Array<Vector3> extents;
+    Containers::Array<Float> radii;
+    Containers::Array<Range3D> ranges;
+};
+
+Volumes testVolumes(const std::size_t count) {
+    std::mt19937 g;
+    std::uniform_real_distribution<Float> pd{-15.0f, 15.0f};
+    std::uniform_real_distribution<Float> sd{0.1f, 4.0f};
+
+    Volumes out{
+        Containers::Array<Vector3>{NoInit, count},
+        Containers::Array<Vector3>{NoInit, count},
+        Containers::Array<Float>{NoInit, count},
+        Containers::Array<Range3D>{NoInit, count}
+    };
+    for(std::size_t i = 0; i != count; ++i) {
+        out.centers[i] = {pd(g), pd(g), pd(g)};
+        out.extents[i] = {sd(g), sd(g), sd(g)};
+        out.radii[i] = sd(g);
+        out.ranges[i] = Range3D::fromCenter(out.centers[i], out.extents[i]);
+    }
+    return out;
+}
+
+void IntersectionBatchTest::rangeFrustum() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Frustum frustum = testFrustum();
+    const Volumes volumes = testVolumes(data.count);
+
+    /* Fill the output with garbage to verify all bits get overwritten */
+    Containers::BitArray out{DirectInit, data.offset + data.count + 3, true};
+    Intersection::rangeFrustum(Containers::arrayView(volumes.ranges), frustum, out.sliceSize(data.offset, data.count));
+
+    std::size_t intersecting = 0;
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        const bool expected = Intersection::rangeFrustum(volumes.ranges[i], frustum);
+        CORRADE_COMPARE(out[data.offset + i], expected);
+        intersecting += expected;
+    }
+
+    /* Bits outside of the range are untouched */
+    for(std::size_t i = 0; i != data.offset; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(out[i]);
+    }
+    for(std::size_t i = data.offset + data.count; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(out[i]);
+    }
+
+    /* Verify the input is actually meaningful and not all inside or
+       outside */
+    if(data.count > 100) {
+        CORRADE_COMPARE_AS(intersecting, 0,
+            TestSuite::Compare::Greater);
+        CORRADE_COMPARE_AS(intersecting, data.count,
+            TestSuite::Compare::Less);
+    }
+}
+
+void IntersectionBatchTest::aabbFrustum() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Frustum frustum = testFrustum();
+    const Volumes volumes = testVolumes(data.count);
+
+    Containers::BitArray out{DirectInit, data.offset + data.count + 3, true};
+    Intersection::aabbFrustum(Containers::arrayView(volumes.centers), Containers::arrayView(volumes.extents), frustum, out.sliceSize(data.offset, data.count));
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[data.offset + i], Intersection::aabbFrustum(volumes.centers[i], volumes.extents[i], frustum));
+    }
+    for(std::size_t i = data.offset + data.count; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(out[i]);
+    }
+}
+
+void IntersectionBatchTest::sphereFrustum() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Frustum frustum = testFrustum();
+    const Volumes volumes = testVolumes(data.count);
+
+    Containers::BitArray out{DirectInit, data.offset + data.count + 3, true};
+    Intersection::sphereFrustum(Containers::arrayView(volumes.centers), Containers::arrayView(volumes.radii), frustum, out.sliceSize(data.offset, data.count));
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[data.offset + i], Intersection::sphereFrustum(volumes.centers[i], volumes.radii[i], frustum));
+    }
+    for(std::size_t i = data.offset + data.count; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(out[i]);
+    }
+}
+
+void IntersectionBatchTest::sphereCone() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector3 origin{1.0f, -2.0f, 0.5f};
+    const Vector3 normal = Vector3{0.3f, 1.0f, -0.4f}.normalized();
+    const Rad halfAngle = Rad{Deg{35.0f}};
+    const Float sinAngle = Math::sin(halfAngle);
+    const Float tanAngleSqPlusOne = Math::pow<2>(Math::tan(halfAngle)) + 1.0f;
+    const Volumes volumes = testVolumes(data.count);
+
+    Containers::BitArray out{DirectInit, data.offset + data.count + 3, true};
+    Intersection::sphereCone(Containers::arrayView(volumes.centers), Containers::arrayView(volumes.radii), origin, normal, sinAngle, tanAngleSqPlusOne, out.sliceSize(data.offset, data.count));
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[data.offset + i], Intersection::sphereCone(volumes.centers[i], volumes.radii[i], origin, normal, sinAngle, tanAngleSqPlusOne));
+    }
+    for(std::size_t i = data.offset + data.count; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_VERIFY(out[i]);
+    }
+}
+
+void IntersectionBatchTest::sphereConeAngle() {
+    auto&& data = Data[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Vector3 origin{1.0f, -2.0f, 0.5f};
+    const Vector3 normal = Vector3{0.3f, 1.0f, -0.4f}.normalized();
+    const Volumes volumes = testVolumes(data.count);
+
+    Containers::BitArray out{DirectInit, data.offset + data.count, true};
+    Intersection::sphereCone(Containers::arrayView(volumes.centers), Containers::arrayView(volumes.radii), origin, normal, Rad{Deg{70.0f}}, out.sliceSize(data.offset, data.count));
+
+    for(std::size_t i = 0; i != data.count; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(out[data.offset + i], Intersection::sphereCone(volumes.centers[i], volumes.radii[i], origin, normal, Rad{Deg{70.0f}}));
+    }
+}
+
+void IntersectionBatchTest::empty() {
+    /* Shouldn't crash or do anything */
+    const Frustum frustum = testFrustum();
+    Intersection::rangeFrustum(nullptr, frustum, nullptr);
+    Intersection::aabbFrustum(nullptr, nullptr, frustum, nullptr);
+    Intersection::sphereFrustum(nullptr, nullptr, frustum, nullptr);
+    Intersection::sphereCone(nullptr, nullptr, {}, Vector3::zAxis(), 0.5f, 1.25f, nullptr);
+    CORRADE_VERIFY(true);
+}
+
+void IntersectionBatchTest::invalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Frustum frustum = testFrustum();
+    const Range3D ranges[3];
+    const Vector3 vectors[3];
+    const Float radii[3]{};
+    Containers::BitArray out{ValueInit, 4};
+
+    Containers::String outString;
+    Error redirectError{&outString};
+    Intersection::rangeFrustum(ranges, frustum, out);
+    Intersection::aabbFrustum(vectors, Containers::arrayView(vectors).prefix(2), frustum, out.prefix(3));
+    Intersection::aabbFrustum(vectors, vectors, frustum, out);
+    Intersection::sphereFrustum(vectors, Containers::arrayView(radii).prefix(2), frustum, out.prefix(3));
+    Intersection::sphereFrustum(vectors, radii, frustum, out);
+    Intersection::sphereCone(vectors, Containers::arrayView(radii).prefix(2), {}, Vector3::zAxis(), 0.5f, 1.25f, out.prefix(3));
+    Intersection::sphereCone(vectors, radii, {}, Vector3::zAxis(), 0.5f, 1.25f, out);
+    CORRADE_COMPARE(outString,
+        "Math::Intersection::rangeFrustum(): expected output view size to be 3 but got 4\n"
+        "Math::Intersection::aabbFrustum(): expected extent view size to be 3 but got 2\n"
+        "Math::Intersection::aabbFrustum(): expected output view size to be 3 but got 4\n"
+        "Math::Intersection::sphereFrustum(): expected radius view size to be 3 but got 2\n"
+        "Math::Intersection::sphereFrustum(): expected output view size to be 3 but got 4\n"
+        "Math::Intersection::sphereCone(): expected radius view size to be 3 but got 2\n"
+        "Math::Intersection::sphereCone(): expected output view size to be 3 but got 4\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::IntersectionBatchTest)
@@ -26,10 +26,14 @@
 */
 
 #include <random>
+#include <Corrade/Containers/ArrayViewStl.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/IntersectionBatch.h"
 
 namespace Magnum { namespace Math { namespace Test { namespace {
 
@@ -103,13 +107,16 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     void rangeFrustumNaive();
     void rangeFrustum();
+    void rangeFrustumBatch();
 
     void rangeCone();
 
     void sphereFrustum();
+    void sphereFrustumBatch();
 
     void sphereConeNaive();
     void sphereCone();
+    void sphereConeBatch();
     void sphereConeView();
 
     Frustum _frustum;
@@ -122,18 +129,22 @@ struct IntersectionBenchmark: TestSuite::Tester {
 
     std::vector<Range3D> _boxes;
     std::vector<Vector4> _spheres;
+    Containers::BitArray _intersects;
 };
 
 IntersectionBenchmark::IntersectionBenchmark() {
     addBenchmarks({&IntersectionBenchmark::rangeFrustumNaive,
                    &IntersectionBenchmark::rangeFrustum,
+                   &IntersectionBenchmark::rangeFrustumBatch,
 
                    &IntersectionBenchmark::rangeCone,
 
                    &IntersectionBenchmark::sphereFrustum,
+                   &IntersectionBenchmark::sphereFrustumBatch,
 
                    &IntersectionBenchmark::sphereConeNaive,
                    &IntersectionBenchmark::sphereCone,
+                   &IntersectionBenchmark::sphereConeBatch,
                    &IntersectionBenchmark::sphereConeView}, 10);
 
     /* Generate random data for the benchmarks */
@@ -158,6 +169,8 @@ IntersectionBenchmark::IntersectionBenchmark() {
         _boxes.emplace_back(center - extents, center + extents);
         _spheres.emplace_back(center, extents.length());
     }
+
+    _intersects = Containers::BitArray{ValueInit, 512};
 }
 
 void IntersectionBenchmark::rangeFrustumNaive() {
@@ -174,6 +187,12 @@ void IntersectionBenchmark::rangeFrustum() {
     }
 }
 
+void IntersectionBenchmark::rangeFrustumBatch() {
+    CORRADE_BENCHMARK(50) {
+        Intersection::rangeFrustum(Containers::arrayView(_boxes), _frustum, _intersects);
+    }
+}
+
 void IntersectionBenchmark::rangeCone() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
@@ -192,6 +211,14 @@ void IntersectionBenchmark::sphereFrustum() {
     }
 }
 
+void IntersectionBenchmark::sphereFrustumBatch() {
+    /* The const xyz() overload returns a copy, so slicing a mutable view */
+    const Containers::StridedArrayView1D<Vector4> spheres = Containers::arrayView(_spheres);
+    CORRADE_BENCHMARK(50) {
+        Intersection::sphereFrustum(spheres.slice(&Vector4::xyz), spheres.slice(&Vector4::w), _frustum, _intersects);
+    }
+}
+
 void IntersectionBenchmark::sphereConeNaive() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) for(auto& sphere: _spheres) {
@@ -211,6 +238,17 @@ void IntersectionBenchmark::sphereCone() {
     }
 }
 
+void IntersectionBenchmark::sphereConeBatch() {
+    /* The const xyz() overload returns a copy, so slicing a mutable view */
+    const Containers::StridedArrayView1D<Vector4> spheres = Containers::arrayView(_spheres);
+    CORRADE_BENCHMARK(50) {
+        const Float sinAngle = Math::sin(_cone.angle);
+        const Float tanAngle = Math::tan(_cone.angle);
+        const Float tanAngleSqPlusOne = tanAngle*tanAngle + 1.0f;
+        Intersection::sphereCone(spheres.slice(&Vector4::xyz), spheres.slice(&Vector4::w), _cone.origin, _cone.normal, sinAngle, tanAngleSqPlusOne, _intersects);
+    }
+}
+
 void IntersectionBenchmark::sphereConeView() {
     volatile bool b = false;
     CORRADE_BENCHMARK(50) {
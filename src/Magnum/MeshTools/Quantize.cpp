@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Quantize.h"
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/Filter.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+bool isQuantizedPositionFormat(const VertexFormat format) {
+    return format == VertexFormat::Vector3ubNormalized ||
+           format == VertexFormat::Vector3bNormalized ||
+           format == VertexFormat::Vector3usNormalized ||
+           format == VertexFormat::Vector3sNormalized;
+}
+
+bool isSignedQuantizedPositionFormat(const VertexFormat format) {
+    return format == VertexFormat::Vector3bNormalized ||
+           format == VertexFormat::Vector3sNormalized;
+}
+
+/* Range size with zero components replaced with 1, to avoid division by
+   zero and to keep the dequantization transformation invertible */
+Vector3 nonZeroSize(const Range3D& range) {
+    Vector3 size = range.size();
+    for(std::size_t i = 0; i != 3; ++i)
+        if(size[i] == 0.0f) size[i] = 1.0f;
+    return size;
+}
+
+}
+
+Trade::MeshData quantizePositions(const Trade::MeshData& mesh, const Range3D& range, const VertexFormat format, const InterleaveFlags flags) {
+    CORRADE_ASSERT(isQuantizedPositionFormat(format),
+        "MeshTools::quantizePositions(): expected a three-component normalized 8- or 16-bit integer format but got" << format,
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+    CORRADE_ASSERT(positionAttributeId,
+        "MeshTools::quantizePositions(): the mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    const VertexFormat positionAttributeFormat = mesh.attributeFormat(*positionAttributeId);
+    CORRADE_ASSERT(!isVertexFormatImplementationSpecific(positionAttributeFormat),
+        "MeshTools::quantizePositions(): positions have an implementation-specific format" << Debug::hex << vertexFormatUnwrap(positionAttributeFormat),
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    CORRADE_ASSERT(vertexFormatComponentCount(positionAttributeFormat) == 3,
+        "MeshTools::quantizePositions(): expected 3D positions but got" << positionAttributeFormat,
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+
+    /* Copy original attributes to a mutable array and replace the positions
+       with a placeholder that we'll put the quantized data into. Not using
+       Utility::copy() here as the view returned by attributeData() might have
+       offset-only attributes which interleave() doesn't want. */
+    Containers::Array<Trade::MeshAttributeData> attributes{ValueInit, mesh.attributeCount()};
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i)
+        attributes[i] = mesh.attributeData(i);
+    attributes[*positionAttributeId] = Trade::MeshAttributeData{Trade::MeshAttribute::Position, format, nullptr};
+
+    Trade::MeshData out = interleave(filterOnlyAttributes(mesh, Containers::ArrayView<const Trade::MeshAttribute>{}), attributes, flags);
+
+    /* Map the positions to [0, 1] for unsigned formats and [-1, 1] for
+       signed, clamping values outside of the range */
+    const bool isSigned = isSignedQuantizedPositionFormat(format);
+    const Vector3 size = nonZeroSize(range);
+    const Vector3 origin = isSigned ? range.center() : range.min();
+    const Vector3 scale = isSigned ? 2.0f/size : 1.0f/size;
+    Containers::Array<Vector3> positions = mesh.positions3DAsArray();
+    for(Vector3& position: positions)
+        position = Math::clamp((position - origin)*scale, isSigned ? -1.0f : 0.0f, 1.0f);
+
+    /* Pack them into the output */
+    const Containers::StridedArrayView2D<const Float> src = Containers::arrayCast<2, const Float>(Containers::stridedArrayView(positions));
+    const Containers::StridedArrayView2D<char> dst = out.mutableAttribute(*positionAttributeId);
+    if(format == VertexFormat::Vector3ubNormalized)
+        Math::packInto(src, Containers::arrayCast<2, UnsignedByte>(dst));
+    else if(format == VertexFormat::Vector3bNormalized)
+        Math::packInto(src, Containers::arrayCast<2, Byte>(dst));
+    else if(format == VertexFormat::Vector3usNormalized)
+        Math::packInto(src, Containers::arrayCast<2, UnsignedShort>(dst));
+    else if(format == VertexFormat::Vector3sNormalized)
+        Math::packInto(src, Containers::arrayCast<2, Short>(dst));
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    return out;
+}
+
+Matrix4 quantizePositionsTransformation(const Range3D& range, const VertexFormat format) {
+    CORRADE_ASSERT(isQuantizedPositionFormat(format),
+        "MeshTools::quantizePositionsTransformation(): expected a three-component normalized 8- or 16-bit integer format but got" << format, {});
+
+    const Vector3 size = nonZeroSize(range);
+    if(isSignedQuantizedPositionFormat(format))
+        return Matrix4::translation(range.center())*Matrix4::scaling(size*0.5f);
+    return Matrix4::translation(range.min())*Matrix4::scaling(size);
+}
+
+}}
@@ -0,0 +1,89 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantizePositions(), @ref Magnum::MeshTools::quantizePositionsTransformation()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/InterleaveFlags.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantize 3D positions in a mesh data
+@param mesh         Input mesh
+@param range        Range to quantize the positions to
+@param format       Quantized position format
+@param flags        Flags to pass to @ref interleavedLayout()
+@m_since_latest
+
+Expects that the mesh contains a three-dimensional
+@ref Trade::MeshAttribute::Position that isn't in an implementation-specific
+format and that @p format is one of @ref VertexFormat::Vector3ubNormalized,
+@ref VertexFormat::Vector3bNormalized, @ref VertexFormat::Vector3usNormalized
+or @ref VertexFormat::Vector3sNormalized. Positions are clamped to @p range
+and mapped to the full range of @p format, the data layouting is done by
+@ref interleavedLayout() with the @p flags parameter propagated to it, see its
+documentation for detailed behavior description. Other attributes and indices
+(if any) are passed through untouched.
+
+To get back the original positions, transform the quantized positions with
+@ref quantizePositionsTransformation(), for example by using it as a part of
+the object transformation when rendering.
+
+The @p range is taken as a parameter instead of being calculated from the
+mesh itself in order to make the quantization consistent across multiple
+meshes, such as chunks imported with @ref Trade::AbstractImporter::meshChunks().
+For a single mesh, the range can be calculated with @ref boundingRange().
+@see @ref Trade::MeshData::positions3DAsArray(),
+    @ref isVertexFormatImplementationSpecific()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData quantizePositions(const Trade::MeshData& mesh, const Range3D& range, VertexFormat format = VertexFormat::Vector3usNormalized, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
+/**
+@brief Transformation for dequantizing positions
+@m_since_latest
+
+Returns a transformation that maps positions produced by
+@ref quantizePositions() with the same @p range and @p format back to the
+original space. For unsigned formats it's a scaling by the range
+@ref Range3D::size() "size" followed by a translation to its
+@ref Range3D::min() "min", for signed formats a scaling by half of the size
+followed by a translation to its @ref Range3D::center() "center". Components
+where @p range has a zero size are treated as if the size was
+@cpp 1.0f @ce, in which case the quantized value is always zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT Matrix4 quantizePositionsTransformation(const Range3D& range, VertexFormat format = VertexFormat::Vector3usNormalized);
+
+}}
+
+#endif
@@ -0,0 +1,275 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace MeshTools { namespace Test { namespace {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void unsignedFormat();
+    void signedFormat();
+    void byteFormat();
+    void clamp();
+    void zeroSize();
+    void indicesAttributesPassthrough();
+
+    void noPosition();
+    void not3D();
+    void implementationSpecificVertexFormat();
+    void invalidFormat();
+};
+
+using namespace Math::Literals;
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::unsignedFormat,
+              &QuantizeTest::signedFormat,
+              &QuantizeTest::byteFormat,
+              &QuantizeTest::clamp,
+              &QuantizeTest::zeroSize,
+              &QuantizeTest::indicesAttributesPassthrough,
+
+              &QuantizeTest::noPosition,
+              &QuantizeTest::not3D,
+              &QuantizeTest::implementationSpecificVertexFormat,
+              &QuantizeTest::invalidFormat});
+}
+
+const Vector3 Positions[]{
+    {-1.0f, 2.0f, 10.0f},
+    {3.0f, 4.0f, 10.0f},
+    {1.0f, 3.0f, 30.0f}
+};
+
+const Range3D PositionRange{{-1.0f, 2.0f, 10.0f}, {3.0f, 4.0f, 30.0f}};
+
+void QuantizeTest::unsignedFormat() {
+    Trade::MeshData mesh{MeshPrimitive::Triangles, Trade::DataFlags{}, Positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(Positions)}
+    }};
+
+    Trade::MeshData out = quantizePositions(mesh, PositionRange);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3usNormalized);
+    CORRADE_COMPARE_AS(out.attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 65535, 0},
+        {32768, 32768, 65535}
+    }), TestSuite::Compare::Container);
+
+    /* Dequantizing gives back the original positions, minus precision loss */
+    const Matrix4 transformation = quantizePositionsTransformation(PositionRange);
+    Containers::Array<Vector3> positions = out.positions3DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_WITH(transformation.transformPoint(positions[i]), Positions[i],
+            TestSuite::Compare::around(Vector3{0.001f}));
+    }
+}
+
+void QuantizeTest::signedFormat() {
+    Trade::MeshData mesh{MeshPrimitive::Triangles, Trade::DataFlags{}, Positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(Positions)}
+    }};
+
+    Trade::MeshData out = quantizePositions(mesh, PositionRange, VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3sNormalized);
+    CORRADE_COMPARE_AS(out.attribute<Vector3s>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3s>({
+        {-32767, -32767, -32767},
+        {32767, 32767, -32767},
+        {0, 0, 32767}
+    }), TestSuite::Compare::Container);
+
+    const Matrix4 transformation = quantizePositionsTransformation(PositionRange, VertexFormat::Vector3sNormalized);
+    Containers::Array<Vector3> positions = out.positions3DAsArray();
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(transformation.transformPoint(positions[i]), Positions[i]);
+    }
+}
+
+void QuantizeTest::byteFormat() {
+    Trade::MeshData mesh{MeshPrimitive::Triangles, Trade::DataFlags{}, Positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(Positions)}
+    }};
+
+    Trade::MeshData out = quantizePositions(mesh, PositionRange, VertexFormat::Vector3ubNormalized);
+    CORRADE_COMPARE(out.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3ubNormalized);
+    CORRADE_COMPARE_AS(out.attribute<Vector3ub>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3ub>({
+        {0, 0, 0},
+        {255, 255, 0},
+        {128, 128, 255}
+    }), TestSuite::Compare::Container);
+
+    Trade::MeshData outSigned = quantizePositions(mesh, PositionRange, VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE(outSigned.attributeFormat(Trade::MeshAttribute::Position), VertexFormat::Vector3bNormalized);
+    CORRADE_COMPARE_AS(outSigned.attribute<Vector3b>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3b>({
+        {-127, -127, -127},
+        {127, 127, -127},
+        {0, 0, 127}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::clamp() {
+    Trade::MeshData mesh{MeshPrimitive::Triangles, Trade::DataFlags{}, Positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(Positions)}
+    }};
+
+    /* Positions outside of the range get clamped to its edges */
+    Trade::MeshData out = quantizePositions(mesh, {{0.0f, 2.0f, 10.0f}, {2.0f, 3.0f, 20.0f}});
+    CORRADE_COMPARE_AS(out.attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 65535, 0},
+        {32768, 65535, 65535}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::zeroSize() {
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {1.0f, 4.0f, 3.0f}
+    };
+    Trade::MeshData mesh{MeshPrimitive::Lines, Trade::DataFlags{}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    /* The range is flat in X and Z, which shouldn't result in NaNs */
+    const Range3D range{{1.0f, 2.0f, 3.0f}, {1.0f, 4.0f, 3.0f}};
+    Trade::MeshData out = quantizePositions(mesh, range);
+    CORRADE_COMPARE_AS(out.attribute<Vector3us>(Trade::MeshAttribute::Position), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {0, 65535, 0}
+    }), TestSuite::Compare::Container);
+
+    /* And the transformation is invertible */
+    const Matrix4 transformation = quantizePositionsTransformation(range);
+    CORRADE_COMPARE(transformation.scaling(), (Vector3{1.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(transformation.transformPoint(out.positions3DAsArray()[1]), positions[1]);
+}
+
+void QuantizeTest::indicesAttributesPassthrough() {
+    const struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{-1.0f, 2.0f, 10.0f}, {0.25f, 0.5f}},
+        {{3.0f, 4.0f, 10.0f}, {0.75f, 1.0f}},
+        {{1.0f, 3.0f, 30.0f}, {0.5f, 0.0f}}
+    };
+    const UnsignedShort indices[]{2, 1, 0, 0, 1, 2};
+    Containers::StridedArrayView1D<const Vertex> vertexView = vertices;
+    Trade::MeshData mesh{MeshPrimitive::Triangles,
+        Trade::DataFlags{}, indices, Trade::MeshIndexData{indices},
+        Trade::DataFlags{}, vertices, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates, vertexView.slice(&Vertex::textureCoordinates)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertexView.slice(&Vertex::position)}
+        }};
+
+    Trade::MeshData out = quantizePositions(mesh, PositionRange);
+    CORRADE_VERIFY(out.isIndexed());
+    CORRADE_COMPARE(out.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(out.indices<UnsignedShort>(), Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.attributeCount(), 2);
+    CORRADE_COMPARE(out.attributeName(0), Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE_AS(out.attribute<Vector2>(0), Containers::arrayView<Vector2>({
+        {0.25f, 0.5f}, {0.75f, 1.0f}, {0.5f, 0.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.attributeName(1), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE_AS(out.attribute<Vector3us>(1), Containers::arrayView<Vector3us>({
+        {0, 0, 0},
+        {65535, 65535, 0},
+        {32768, 32768, 65535}
+    }), TestSuite::Compare::Container);
+}
+
+void QuantizeTest::noPosition() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    quantizePositions(mesh, {});
+    CORRADE_COMPARE(out, "MeshTools::quantizePositions(): the mesh has no positions\n");
+}
+
+void QuantizeTest::not3D() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    quantizePositions(mesh, {});
+    CORRADE_COMPARE(out, "MeshTools::quantizePositions(): expected 3D positions but got VertexFormat::Vector2\n");
+}
+
+void QuantizeTest::implementationSpecificVertexFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertexFormatWrap(0xcaca), nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    quantizePositions(mesh, {});
+    CORRADE_COMPARE(out, "MeshTools::quantizePositions(): positions have an implementation-specific format 0xcaca\n");
+}
+
+void QuantizeTest::invalidFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::MeshData mesh{MeshPrimitive::Points, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    quantizePositions(mesh, {}, VertexFormat::Vector3h);
+    quantizePositionsTransformation({}, VertexFormat::Vector2usNormalized);
+    CORRADE_COMPARE(out,
+        "MeshTools::quantizePositions(): expected a three-component normalized 8- or 16-bit integer format but got VertexFormat::Vector3h\n"
+        "MeshTools::quantizePositionsTransformation(): expected a three-component normalized 8- or 16-bit integer format but got VertexFormat::Vector2usNormalized\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
@@ -0,0 +1,347 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AbsoluteTransformations.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/DualComplex.h"
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* Single-item variants of the conversions done in
+   Trade::SceneData::transformations2DInto() / transformations3DInto() */
+template<class Destination, class Source> Destination expandTransformationMatrix(const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+    return Destination{Math::RectangularMatrix<Source::Cols, Source::Rows, Float>{Containers::arrayCast<1, const Source>(field)[offset]}};
+}
+
+template<class Destination, class Source> Destination convertTransformation(const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+    return Destination{Containers::arrayCast<1, const Source>(field)[offset].toMatrix()};
+}
+
+template<class Destination, class Source> Destination translationMatrix(const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+    return Destination::translation(Math::Vector<Destination::Size - 1, Float>{Containers::arrayCast<1, const Source>(field)[offset]});
+}
+
+template<class Destination, class Source> Destination rotationMatrix(const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+    return Destination{Math::Matrix<Destination::Size - 1, Float>{Containers::arrayCast<1, const Source>(field)[offset].toMatrix()}};
+}
+
+template<class Destination, class Source> Destination scalingMatrix(const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+    return Destination::scaling(Math::Vector<Destination::Size - 1, Float>{Containers::arrayCast<1, const Source>(field)[offset]});
+}
+
+template<UnsignedInt> struct SceneDataDimensionTraits;
+template<> struct SceneDataDimensionTraits<2> {
+    static bool isDimensions(const Trade::SceneData& scene) {
+        return scene.is2D();
+    }
+    static void transformationsInto(const Trade::SceneData& scene, const std::size_t offset, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix3>& transformationDestination) {
+        scene.transformations2DInto(offset, mappingDestination, transformationDestination);
+    }
+    static Matrix3 transformation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Matrix3x3)
+            return Containers::arrayCast<1, const Matrix3>(field)[offset];
+        else if(type == Trade::SceneFieldType::Matrix3x3d)
+            return Matrix3{Containers::arrayCast<1, const Matrix3d>(field)[offset]};
+        else if(type == Trade::SceneFieldType::Matrix3x2)
+            return expandTransformationMatrix<Matrix3, Matrix3x2>(field, offset);
+        else if(type == Trade::SceneFieldType::Matrix3x2d)
+            return expandTransformationMatrix<Matrix3, Matrix3x2d>(field, offset);
+        else if(type == Trade::SceneFieldType::DualComplex)
+            return convertTransformation<Matrix3, DualComplex>(field, offset);
+        else if(type == Trade::SceneFieldType::DualComplexd)
+            return convertTransformation<Matrix3, DualComplexd>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix3 translation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Vector2)
+            return translationMatrix<Matrix3, Vector2>(field, offset);
+        else if(type == Trade::SceneFieldType::Vector2d)
+            return translationMatrix<Matrix3, Vector2d>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix3 rotation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Complex)
+            return rotationMatrix<Matrix3, Complex>(field, offset);
+        else if(type == Trade::SceneFieldType::Complexd)
+            return rotationMatrix<Matrix3, Complexd>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix3 scaling(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Vector2)
+            return scalingMatrix<Matrix3, Vector2>(field, offset);
+        else if(type == Trade::SceneFieldType::Vector2d)
+            return scalingMatrix<Matrix3, Vector2d>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+};
+template<> struct SceneDataDimensionTraits<3> {
+    static bool isDimensions(const Trade::SceneData& scene) {
+        return scene.is3D();
+    }
+    static void transformationsInto(const Trade::SceneData& scene, const std::size_t offset, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Matrix4>& transformationDestination) {
+        scene.transformations3DInto(offset, mappingDestination, transformationDestination);
+    }
+    static Matrix4 transformation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Matrix4x4)
+            return Containers::arrayCast<1, const Matrix4>(field)[offset];
+        else if(type == Trade::SceneFieldType::Matrix4x4d)
+            return Matrix4{Containers::arrayCast<1, const Matrix4d>(field)[offset]};
+        else if(type == Trade::SceneFieldType::Matrix4x3)
+            return expandTransformationMatrix<Matrix4, Matrix4x3>(field, offset);
+        else if(type == Trade::SceneFieldType::Matrix4x3d)
+            return expandTransformationMatrix<Matrix4, Matrix4x3d>(field, offset);
+        else if(type == Trade::SceneFieldType::DualQuaternion)
+            return convertTransformation<Matrix4, DualQuaternion>(field, offset);
+        else if(type == Trade::SceneFieldType::DualQuaterniond)
+            return convertTransformation<Matrix4, DualQuaterniond>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix4 translation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Vector3)
+            return translationMatrix<Matrix4, Vector3>(field, offset);
+        else if(type == Trade::SceneFieldType::Vector3d)
+            return translationMatrix<Matrix4, Vector3d>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix4 rotation(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Quaternion)
+            return rotationMatrix<Matrix4, Quaternion>(field, offset);
+        else if(type == Trade::SceneFieldType::Quaterniond)
+            return rotationMatrix<Matrix4, Quaterniond>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+    static Matrix4 scaling(const Trade::SceneFieldType type, const Containers::StridedArrayView2D<const char>& field, const std::size_t offset) {
+        if(type == Trade::SceneFieldType::Vector3)
+            return scalingMatrix<Matrix4, Vector3>(field, offset);
+        else if(type == Trade::SceneFieldType::Vector3d)
+            return scalingMatrix<Matrix4, Vector3d>(field, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+};
+
+void cacheField(const Trade::SceneData& scene, const Trade::SceneField name, Containers::StridedArrayView2D<const char>& field, Trade::SceneFieldType& type) {
+    if(const Containers::Optional<UnsignedInt> id = scene.findFieldId(name)) {
+        field = scene.field(*id);
+        type = scene.fieldType(*id);
+    }
+}
+
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation): _scene{&scene} {
+    CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
+        "SceneTools::AbsoluteTransformations: the scene is not" << dimensions << Debug::nospace << "D", );
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::AbsoluteTransformations: the scene has no hierarchy", );
+
+    /* Breadth-first order of the hierarchy, and position of each object in
+       it */
+    _parents = SceneTools::parentsBreadthFirst(scene);
+    _breadthFirstPositions = Containers::Array<UnsignedInt>{DirectInit, std::size_t(scene.mappingBound()), ~UnsignedInt{}};
+    for(std::size_t i = 0; i != _parents.size(); ++i)
+        _breadthFirstPositions[_parents[i].first()] = UnsignedInt(i);
+
+    /* In the breadth-first order, children of the same parent are always
+       next to each other, so each object has its children in a contiguous
+       range. Objects without children get an empty range. */
+    _children = Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>{ValueInit, _parents.size()};
+    _processed = Containers::BitArray{ValueInit, _parents.size()};
+    for(std::size_t i = 0; i != _parents.size(); ++i) {
+        const Int parent = _parents[i].second();
+        if(parent == -1)
+            continue;
+        Containers::Pair<UnsignedInt, UnsignedInt>& children = _children[_breadthFirstPositions[parent]];
+        if(!children.second())
+            children.first() = UnsignedInt(i);
+        CORRADE_INTERNAL_ASSERT(children.first() + children.second() == i);
+        ++children.second();
+    }
+
+    /* Offset of a transformation for each object in the scene. If an object
+       has more than one transformation, the last one is used, consistently
+       with absoluteFieldTransformations(). */
+    Containers::Array<UnsignedInt> transformationMapping{NoInit, scene.transformationFieldSize()};
+    SceneDataDimensionTraits<dimensions>::transformationsInto(scene, 0, transformationMapping, nullptr);
+    _transformationOffsets = Containers::Array<std::size_t>{DirectInit, std::size_t(scene.mappingBound()), ~std::size_t{}};
+    for(std::size_t i = 0; i != transformationMapping.size(); ++i) {
+        CORRADE_INTERNAL_ASSERT(transformationMapping[i] < scene.mappingBound());
+        _transformationOffsets[transformationMapping[i]] = i;
+    }
+
+    /* Views on the transformation-related fields for localTransformationFor().
+       The transformation field takes precedence over the TRS fields if
+       present. */
+    if(scene.hasField(Trade::SceneField::Transformation))
+        cacheField(scene, Trade::SceneField::Transformation, _transformationField, _transformationFieldType);
+    else {
+        cacheField(scene, Trade::SceneField::Translation, _translationField, _translationFieldType);
+        cacheField(scene, Trade::SceneField::Rotation, _rotationField, _rotationFieldType);
+        cacheField(scene, Trade::SceneField::Scaling, _scalingField, _scalingFieldType);
+    }
+
+    /* Absolute transformations, with identity for objects not in the
+       hierarchy */
+    _transformations = Containers::Array<MatrixTypeFor<dimensions, Float>>{ValueInit, std::size_t(scene.mappingBound() + 1)};
+    _transformations[0] = globalTransformation;
+    updateAll();
+}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(const Trade::SceneData& scene): AbsoluteTransformations{scene, {}} {}
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::AbsoluteTransformations(AbsoluteTransformations<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>::~AbsoluteTransformations() = default;
+
+template<UnsignedInt dimensions> AbsoluteTransformations<dimensions>& AbsoluteTransformations<dimensions>::operator=(AbsoluteTransformations<dimensions>&&) noexcept = default;
+
+template<UnsignedInt dimensions> Containers::StridedArrayView1D<const UnsignedInt> AbsoluteTransformations<dimensions>::childrenFor(const UnsignedLong object) const {
+    CORRADE_ASSERT(object < _breadthFirstPositions.size(),
+        "SceneTools::AbsoluteTransformations::childrenFor(): index" << object << "out of range for" << _breadthFirstPositions.size() << "objects", {});
+    const UnsignedInt position = _breadthFirstPositions[object];
+    if(position == ~UnsignedInt{})
+        return {};
+    const Containers::Pair<UnsignedInt, UnsignedInt> children = _children[position];
+    return stridedArrayView(_parents)
+        .slice(&Containers::Pair<UnsignedInt, Int>::first)
+        .sliceSize(children.first(), children.second());
+}
+
+template<UnsignedInt dimensions> Containers::ArrayView<const MatrixTypeFor<dimensions, Float>> AbsoluteTransformations<dimensions>::transformations() const {
+    return _transformations.exceptPrefix(1);
+}
+
+template<UnsignedInt dimensions> MatrixTypeFor<dimensions, Float> AbsoluteTransformations<dimensions>::transformationFor(const UnsignedLong object) const {
+    CORRADE_ASSERT(object + 1 < _transformations.size(),
+        "SceneTools::AbsoluteTransformations::transformationFor(): index" << object << "out of range for" << _transformations.size() - 1 << "objects", {});
+    return _transformations[object + 1];
+}
+
+template<UnsignedInt dimensions> MatrixTypeFor<dimensions, Float> AbsoluteTransformations<dimensions>::localTransformationFor(const UnsignedInt object) const {
+    const std::size_t offset = _transformationOffsets[object];
+    if(offset == ~std::size_t{})
+        return {};
+
+    /* A valid offset means the field providing the object mapping is
+       non-empty, so it's enough to check just the transformation field. TRS
+       components are combined in the same order as in SceneData. */
+    if(!_transformationField.isEmpty())
+        return SceneDataDimensionTraits<dimensions>::transformation(_transformationFieldType, _transformationField, offset);
+    MatrixTypeFor<dimensions, Float> out;
+    if(!_scalingField.isEmpty())
+        out = SceneDataDimensionTraits<dimensions>::scaling(_scalingFieldType, _scalingField, offset);
+    if(!_rotationField.isEmpty())
+        out = SceneDataDimensionTraits<dimensions>::rotation(_rotationFieldType, _rotationField, offset)*out;
+    if(!_translationField.isEmpty())
+        out = SceneDataDimensionTraits<dimensions>::translation(_translationFieldType, _translationField, offset)*out;
+    return out;
+}
+
+template<UnsignedInt dimensions> void AbsoluteTransformations<dimensions>::update(const Containers::StridedArrayView1D<const UnsignedInt>& objects) {
+    /* Put all objects that are in the hierarchy to the queue as offsets into
+       the breadth-first list, sorted so parents are always processed before
+       their children */
+    arrayResize(_queue, NoInit, 0);
+    for(const UnsignedInt object: objects) {
+        CORRADE_ASSERT(object < _breadthFirstPositions.size(),
+            "SceneTools::AbsoluteTransformations::update(): index" << object << "out of range for" << _breadthFirstPositions.size() << "objects", );
+        const UnsignedInt position = _breadthFirstPositions[object];
+        if(position != ~UnsignedInt{})
+            arrayAppend(_queue, position);
+    }
+    const std::size_t rootCount = _queue.size();
+    std::sort(_queue.begin(), _queue.end());
+
+    /* Go through the subtree roots in order and recalculate each subtree in
+       a breadth-first manner, appending the children to the end of the
+       queue. Because the roots are sorted, if a root is a child of a
+       previous root, it's already processed at this point, which is tracked
+       in a bit array in order to not process it again. */
+    for(std::size_t root = 0; root != rootCount; ++root) {
+        const UnsignedInt rootOffset = _queue[root];
+        if(_processed[rootOffset])
+            continue;
+
+        const Containers::Pair<UnsignedInt, Int>& rootParent = _parents[rootOffset];
+        _transformations[rootParent.first() + 1] =
+            _transformations[rootParent.second() + 1]*
+            localTransformationFor(rootParent.first());
+
+        const std::size_t subtreeBegin = _queue.size();
+        arrayAppend(_queue, rootOffset);
+        for(std::size_t i = subtreeBegin; i != _queue.size(); ++i) {
+            const UnsignedInt position = _queue[i];
+            _processed.set(position);
+
+            const Containers::Pair<UnsignedInt, UnsignedInt> children = _children[position];
+            const MatrixTypeFor<dimensions, Float>& parentTransformation = _transformations[_parents[position].first() + 1];
+            for(UnsignedInt child = children.first(), childEnd = children.first() + children.second(); child != childEnd; ++child) {
+                const UnsignedInt object = _parents[child].first();
+                _transformations[object + 1] = parentTransformation*localTransformationFor(object);
+                arrayAppend(_queue, child);
+            }
+        }
+    }
+
+    /* Reset the bits that were set above so the bit array can be reused next
+       time without clearing it whole */
+    for(const UnsignedInt position: _queue.exceptPrefix(rootCount))
+        _processed.reset(position);
+}
+
+template<UnsignedInt dimensions> void AbsoluteTransformations<dimensions>::update(const std::initializer_list<UnsignedInt> objects) {
+    update(Containers::arrayView(objects));
+}
+
+template<UnsignedInt dimensions> void AbsoluteTransformations<dimensions>::updateAll() {
+    /* Retrieve all transformations at once, which is significantly faster
+       than querying them one by one */
+    Containers::Array<MatrixTypeFor<dimensions, Float>> localTransformations{NoInit, _scene->transformationFieldSize()};
+    SceneDataDimensionTraits<dimensions>::transformationsInto(*_scene, 0, nullptr, localTransformations);
+
+    for(const Containers::Pair<UnsignedInt, Int>& parent: _parents) {
+        const std::size_t offset = _transformationOffsets[parent.first()];
+        _transformations[parent.first() + 1] =
+            _transformations[parent.second() + 1]*
+            (offset == ~std::size_t{} ? MatrixTypeFor<dimensions, Float>{} : localTransformations[offset]);
+    }
+}
+
+template class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations<2>;
+template class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations<3>;
+
+}}
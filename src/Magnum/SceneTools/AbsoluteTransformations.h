@@ -0,0 +1,237 @@
+#ifndef Magnum_SceneTools_AbsoluteTransformations_h
+#define Magnum_SceneTools_AbsoluteTransformations_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::AbsoluteTransformations, typedef @ref Magnum::SceneTools::AbsoluteTransformations2D, @ref Magnum::SceneTools::AbsoluteTransformations3D
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Incrementally updated absolute transformations
+@m_since_latest
+
+Caches the breadth-first object order and the children ranges of the
+@ref Trade::SceneField::Parent hierarchy of a scene together with absolute
+transformations of all objects in it, allowing to recalculate just the
+subtrees affected by a transformation change instead of the whole scene as
+with @ref absoluteFieldTransformations2D() /
+@ref absoluteFieldTransformations3D().
+
+The class keeps a reference to the scene and reads the local transformations
+from it every time an update is performed. The intended workflow is to modify
+the transformation field data in-place through
+@ref Trade::SceneData::mutableField() and then pass IDs of the modified
+objects to @ref update():
+
+@snippet SceneTools.cpp AbsoluteTransformations-update
+
+Updating a set of @f$ k @f$ objects is done in an
+@f$ \mathcal{O}(k \log k + m) @f$ execution time, with @f$ m @f$ being the
+total count of objects in the subtrees that need to be recalculated, and with
+no allocations once the internal queue grows large enough. Each object in the
+affected subtrees gets recalculated just once, even if both it and some of
+its parents were passed to @ref update().
+
+The hierarchy and the object mapping of the transformation fields are
+captured in the constructor. If the @ref Trade::SceneField::Parent field or
+object mapping of any transformation-related field changes, a new instance
+has to be created.
+
+@experimental
+
+@see @ref AbsoluteTransformations2D, @ref AbsoluteTransformations3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SCENETOOLS_EXPORT AbsoluteTransformations {
+    public:
+        /**
+         * @brief Constructor
+         * @param scene                 Scene to calculate the transformations
+         *      for
+         * @param globalTransformation  Global transformation to prepend
+         *
+         * The @ref Trade::SceneField::Parent field is expected to be
+         * contained in the scene, having no cycles or duplicates, and the
+         * scene is expected to be 2D or 3D, matching @p dimensions. The
+         * @p scene is expected to stay in scope for the whole lifetime of the
+         * instance. Calls @ref SceneTools::parentsBreadthFirst() internally and
+         * calculates transformations of all objects, i.e. the same as
+         * calling @ref updateAll().
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        explicit AbsoluteTransformations(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation = {});
+        #else
+        /* To avoid including Matrix3 / Matrix4 */
+        explicit AbsoluteTransformations(const Trade::SceneData& scene, const MatrixTypeFor<dimensions, Float>& globalTransformation);
+        explicit AbsoluteTransformations(const Trade::SceneData& scene);
+        #endif
+
+        /** @brief Copying is not allowed */
+        AbsoluteTransformations(const AbsoluteTransformations<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        AbsoluteTransformations(AbsoluteTransformations<dimensions>&&) noexcept;
+
+        ~AbsoluteTransformations();
+
+        /** @brief Copying is not allowed */
+        AbsoluteTransformations<dimensions>& operator=(const AbsoluteTransformations<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        AbsoluteTransformations<dimensions>& operator=(AbsoluteTransformations<dimensions>&&) noexcept;
+
+        /** @brief Scene the transformations are calculated for */
+        const Trade::SceneData& scene() const { return *_scene; }
+
+        /**
+         * @brief Parents in a breadth-first order
+         *
+         * Same as the output of @ref SceneTools::parentsBreadthFirst() at the
+         * time the instance was constructed.
+         */
+        Containers::ArrayView<const Containers::Pair<UnsignedInt, Int>> parentsBreadthFirst() const { return _parents; }
+
+        /**
+         * @brief Children of given object
+         *
+         * Direct children of @p object in the order they're listed in the
+         * @ref Trade::SceneField::Parent field. Expects that @p object is
+         * less than @ref Trade::SceneData::mappingBound(), returns an empty
+         * view if the object has no children or isn't a part of the
+         * hierarchy.
+         */
+        Containers::StridedArrayView1D<const UnsignedInt> childrenFor(UnsignedLong object) const;
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Indexed by object ID, size is equal to
+         * @ref Trade::SceneData::mappingBound(). Objects that aren't a part
+         * of the hierarchy have the transformation set to an identity.
+         */
+        Containers::ArrayView<const MatrixTypeFor<dimensions, Float>> transformations() const;
+
+        /**
+         * @brief Absolute transformation of given object
+         *
+         * Expects that @p object is less than
+         * @ref Trade::SceneData::mappingBound().
+         * @see @ref transformations()
+         */
+        MatrixTypeFor<dimensions, Float> transformationFor(UnsignedLong object) const;
+
+        /**
+         * @brief Recalculate transformations of given objects and their children
+         *
+         * Expects that all @p objects are less than
+         * @ref Trade::SceneData::mappingBound(), objects that aren't a part
+         * of the hierarchy are ignored. The local transformations are read
+         * from the scene at the time this function is called.
+         */
+        void update(const Containers::StridedArrayView1D<const UnsignedInt>& objects);
+
+        /**
+         * @overload
+         */
+        void update(std::initializer_list<UnsignedInt> objects);
+
+        /**
+         * @brief Recalculate transformations of all objects
+         *
+         * Reads all local transformations from the scene and recalculates
+         * the whole hierarchy in a breadth-first order.
+         */
+        void updateAll();
+
+    private:
+        /* Fetches a local transformation of given object, or an identity if
+           the object has no transformation */
+        MAGNUM_SCENETOOLS_LOCAL MatrixTypeFor<dimensions, Float> localTransformationFor(UnsignedInt object) const;
+
+        const Trade::SceneData* _scene;
+        Containers::Array<Containers::Pair<UnsignedInt, Int>> _parents;
+        /* Position of each object in the breadth-first order, i.e. an index
+           into _parents, ~UnsignedInt{} if the object isn't in the
+           hierarchy */
+        Containers::Array<UnsignedInt> _breadthFirstPositions;
+        /* Offset and count of direct children in _parents, for each item of
+           _parents */
+        Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> _children;
+        /* Offset into the transformation fields for each object,
+           ~std::size_t{} if the object has no transformation */
+        Containers::Array<std::size_t> _transformationOffsets;
+        /* Views on the transformation-related fields and their types,
+           queried upfront to avoid a field lookup for each object in
+           update(). Either the transformation field is non-empty or any of
+           the TRS fields, consistently with which fields
+           Trade::SceneData::transformations2DInto() /
+           transformations3DInto() use. */
+        Containers::StridedArrayView2D<const char> _transformationField,
+            _translationField, _rotationField, _scalingField;
+        Trade::SceneFieldType _transformationFieldType{},
+            _translationFieldType{}, _rotationFieldType{}, _scalingFieldType{};
+        /* Absolute transformation for each object, shifted by one, with the
+           first item being the global transformation */
+        Containers::Array<MatrixTypeFor<dimensions, Float>> _transformations;
+        /* Scratch memory for update(), kept to avoid repeated allocations.
+           The bit array marks already processed items of _parents and is
+           all zeros outside of update(). */
+        Containers::Array<UnsignedInt> _queue;
+        Containers::BitArray _processed;
+};
+
+/**
+@brief Incrementally updated absolute 2D transformations
+@m_since_latest
+
+@experimental
+*/
+typedef AbsoluteTransformations<2> AbsoluteTransformations2D;
+
+/**
+@brief Incrementally updated absolute 3D transformations
+@m_since_latest
+
+@experimental
+*/
+typedef AbsoluteTransformations<3> AbsoluteTransformations3D;
+
+}}
+
+#endif
@@ -0,0 +1,213 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchMeshes.h"
+
+#include <algorithm>
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* Orders meshes by their primitive and vertex layout. Returns a negative
+   value, zero or a positive value depending on whether the layout of the
+   first mesh is ordered before, is the same or is ordered after the second. */
+int compareMeshLayouts(const Trade::MeshData& a, const Trade::MeshData& b) {
+    if(a.primitive() != b.primitive())
+        return UnsignedInt(a.primitive()) < UnsignedInt(b.primitive()) ? -1 : 1;
+    if(a.attributeCount() != b.attributeCount())
+        return a.attributeCount() < b.attributeCount() ? -1 : 1;
+    for(UnsignedInt i = 0; i != a.attributeCount(); ++i) {
+        if(a.attributeName(i) != b.attributeName(i))
+            return UnsignedShort(a.attributeName(i)) < UnsignedShort(b.attributeName(i)) ? -1 : 1;
+        if(a.attributeFormat(i) != b.attributeFormat(i))
+            return UnsignedInt(a.attributeFormat(i)) < UnsignedInt(b.attributeFormat(i)) ? -1 : 1;
+        if(a.attributeArraySize(i) != b.attributeArraySize(i))
+            return a.attributeArraySize(i) < b.attributeArraySize(i) ? -1 : 1;
+        if(a.attributeMorphTargetId(i) != b.attributeMorphTargetId(i))
+            return a.attributeMorphTargetId(i) < b.attributeMorphTargetId(i) ? -1 : 1;
+    }
+    return 0;
+}
+
+}
+
+Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>> batchMeshes3D(const Trade::SceneData& scene, const Containers::Iterable<const Trade::MeshData>& meshes, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(scene.is3D(),
+        "SceneTools::batchMeshes3D(): the scene is not 3D", (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::batchMeshes3D(): the scene has no hierarchy", (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+
+    /* Nothing to batch */
+    if(!scene.hasField(Trade::SceneField::Mesh))
+        return {Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}};
+
+    const Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene.meshesMaterialsAsArray();
+
+    /* Gather the unique referenced meshes, checking that they're in bounds */
+    Containers::BitArray referencedMeshes{ValueInit, meshes.size()};
+    Containers::Array<UnsignedInt> uniqueMeshes;
+    for(const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& meshMaterial: meshesMaterials) {
+        const UnsignedInt mesh = meshMaterial.second().first();
+        CORRADE_ASSERT(mesh < meshes.size(),
+            "SceneTools::batchMeshes3D(): index" << mesh << "out of range for" << meshes.size() << "meshes", (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+        if(referencedMeshes[mesh])
+            continue;
+        referencedMeshes.set(mesh);
+        arrayAppend(uniqueMeshes, mesh);
+    }
+
+    /* Check that the referenced meshes can be transformed and concatenated
+       upfront, so the batches don't need to be checked on the worker
+       threads */
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt id: uniqueMeshes) {
+        const Trade::MeshData& mesh = meshes[id];
+        const MeshPrimitive primitive = mesh.primitive();
+        CORRADE_ASSERT(!isMeshPrimitiveImplementationSpecific(primitive) &&
+            primitive != MeshPrimitive::LineStrip &&
+            primitive != MeshPrimitive::LineLoop &&
+            primitive != MeshPrimitive::TriangleStrip &&
+            primitive != MeshPrimitive::TriangleFan,
+            "SceneTools::batchMeshes3D(): can't concatenate mesh" << id << "with" << primitive, (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+        CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+            "SceneTools::batchMeshes3D(): mesh" << id << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()), (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+        for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+            const VertexFormat format = mesh.attributeFormat(i);
+            CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+                "SceneTools::batchMeshes3D(): attribute" << i << "of mesh" << id << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format), (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+        }
+        const Containers::Optional<UnsignedInt> positionAttributeId = mesh.findAttributeId(Trade::MeshAttribute::Position);
+        CORRADE_ASSERT(positionAttributeId,
+            "SceneTools::batchMeshes3D(): mesh" << id << "has no positions", (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+        CORRADE_ASSERT(vertexFormatComponentCount(mesh.attributeFormat(*positionAttributeId)) == 3,
+            "SceneTools::batchMeshes3D(): expected 3D positions in mesh" << id << "but got" << mesh.attributeFormat(*positionAttributeId), (Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>>{Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}, {}}));
+    }
+    #endif
+
+    /* Assign a layout class to each referenced mesh, meshes with the same
+       primitive and vertex layout get the same class. Sorting the unique
+       meshes first makes this O(n log n) instead of comparing each mesh with
+       all others. */
+    std::sort(uniqueMeshes.begin(), uniqueMeshes.end(), [&meshes](UnsignedInt a, UnsignedInt b) {
+        return compareMeshLayouts(meshes[a], meshes[b]) < 0;
+    });
+    Containers::Array<UnsignedInt> meshLayoutClasses{NoInit, meshes.size()};
+    UnsignedInt layoutClass = 0;
+    for(std::size_t i = 0; i != uniqueMeshes.size(); ++i) {
+        if(i && compareMeshLayouts(meshes[uniqueMeshes[i - 1]], meshes[uniqueMeshes[i]]) != 0)
+            ++layoutClass;
+        meshLayoutClasses[uniqueMeshes[i]] = layoutClass;
+    }
+
+    /* Calculate a stable permutation that puts entries with the same material
+       and mesh layout next to each other */
+    Containers::Array<UnsignedInt> permutation{NoInit, meshesMaterials.size()};
+    for(std::size_t i = 0; i != permutation.size(); ++i)
+        permutation[i] = UnsignedInt(i);
+    std::stable_sort(permutation.begin(), permutation.end(), [&meshesMaterials, &meshLayoutClasses](UnsignedInt a, UnsignedInt b) {
+        const Int materialA = meshesMaterials[a].second().second();
+        const Int materialB = meshesMaterials[b].second().second();
+        return materialA < materialB || (materialA == materialB &&
+            meshLayoutClasses[meshesMaterials[a].second().first()] < meshLayoutClasses[meshesMaterials[b].second().first()]);
+    });
+
+    /* Find where each batch starts in the permutation */
+    Containers::Array<UnsignedInt> batchOffsets;
+    for(std::size_t i = 0; i != permutation.size(); ++i) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterial = meshesMaterials[permutation[i]].second();
+        if(!i || meshMaterial.second() != meshesMaterials[permutation[i - 1]].second().second() || meshLayoutClasses[meshMaterial.first()] != meshLayoutClasses[meshesMaterials[permutation[i - 1]].second().first()])
+            arrayAppend(batchOffsets, UnsignedInt(i));
+    }
+    arrayAppend(batchOffsets, UnsignedInt(permutation.size()));
+    const std::size_t batchCount = batchOffsets.size() - 1;
+
+    const Containers::Array<Matrix4> transformations = absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh, {}, threadCount);
+
+    /* Transform and concatenate the batches. Each batch writes only to its
+       own output slot, so they can be processed in parallel. Transformed
+       copies are kept only for the batch being processed to not have the
+       whole flattened scene in memory at once. */
+    Containers::Array<Trade::MeshData> outMeshes{NoInit, batchCount};
+    std::size_t totalVertexCount = 0;
+    for(const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& meshMaterial: meshesMaterials)
+        totalVertexCount += meshes[meshMaterial.second().first()].vertexCount();
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(totalVertexCount, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Magnum::Implementation::parallelFor(batchCount, actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        Containers::Array<Trade::MeshData> transformed;
+        for(std::size_t i = begin; i != end; ++i) {
+            arrayClear(transformed);
+            arrayReserve(transformed, batchOffsets[i + 1] - batchOffsets[i]);
+            for(std::size_t j = batchOffsets[i]; j != batchOffsets[i + 1]; ++j) {
+                const UnsignedInt entry = permutation[j];
+                arrayAppend(transformed, MeshTools::transform3D(meshes[meshesMaterials[entry].second().first()], transformations[entry]));
+            }
+
+            new(&outMeshes[i]) Trade::MeshData{MeshTools::concatenate(transformed)};
+        }
+    });
+
+    /* Output a scene with one object per batch, all fields sharing a single
+       implicit mapping */
+    Containers::ArrayView<UnsignedInt> outMapping;
+    Containers::ArrayView<Int> outParents;
+    Containers::ArrayView<UnsignedInt> outMeshIds;
+    Containers::ArrayView<Int> outMaterials;
+    Containers::Array<char> outData = Containers::ArrayTuple{
+        {NoInit, batchCount, outMapping},
+        {NoInit, batchCount, outParents},
+        {NoInit, batchCount, outMeshIds},
+        {NoInit, batchCount, outMaterials},
+    };
+    for(std::size_t i = 0; i != batchCount; ++i) {
+        outMapping[i] = UnsignedInt(i);
+        outParents[i] = -1;
+        outMeshIds[i] = UnsignedInt(i);
+        outMaterials[i] = meshesMaterials[permutation[batchOffsets[i]]].second().second();
+    }
+
+    return {Trade::SceneData{Trade::SceneMappingType::UnsignedInt, batchCount, Utility::move(outData), {
+        Trade::SceneFieldData{Trade::SceneField::Parent, outMapping, outParents, Trade::SceneFieldFlag::ImplicitMapping},
+        Trade::SceneFieldData{Trade::SceneField::Mesh, outMapping, outMeshIds, Trade::SceneFieldFlag::ImplicitMapping},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial, outMapping, outMaterials, Trade::SceneFieldFlag::ImplicitMapping},
+    }}, Utility::move(outMeshes)};
+}
+
+}}
@@ -0,0 +1,106 @@
+#ifndef Magnum_SceneTools_BatchMeshes_h
+#define Magnum_SceneTools_BatchMeshes_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::batchMeshes3D()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Pair.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Flatten a 3D mesh hierarchy into per-material mesh batches
+@param scene        Input scene
+@param meshes       Meshes referenced by the @ref Trade::SceneField::Mesh
+    field of @p scene
+@param threadCount  Count of threads to use. Use @cpp 0 @ce to autodetect
+    from the hardware concurrency.
+@m_since_latest
+
+Calculates absolute transformations of all @ref Trade::SceneField::Mesh
+entries using @ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&, UnsignedInt),
+bakes them into copies of the referenced meshes with
+@ref MeshTools::transform3D() and concatenates all entries that have the same
+@ref Trade::SceneField::MeshMaterial, the same @ref MeshPrimitive and the same
+vertex layout --- i.e., the same attribute names, formats, array sizes and
+morph target IDs in the same order --- into a single mesh using
+@ref MeshTools::concatenate(). Relative order of the entries in each batch is
+preserved. The index type of the batch meshes is always
+@ref MeshIndexType::UnsignedInt if any mesh in the batch is indexed, see
+@ref MeshTools::concatenate() for more information.
+
+The returned scene contains one object for each batch, with the
+@ref Trade::SceneField::Parent, @relativeref{Trade::SceneField,Mesh} and
+@relativeref{Trade::SceneField,MeshMaterial} fields sharing a single
+@ref Trade::SceneFieldFlag::ImplicitMapping object mapping. All objects are in
+the root and have no transformation fields, as the transformations are
+already baked into the meshes. The @ref Trade::SceneField::Mesh field indexes
+the returned mesh list and the batches are sorted by the material ID, with
+@cpp -1 @ce first for meshes that have no material assigned, so static
+geometry can be drawn with a single draw call for each material. Meshes of
+the same material but with a different vertex layout end up in multiple
+batches next to each other. If @p scene has no @ref Trade::SceneField::Mesh
+field, the returned scene has no objects and the mesh list is empty.
+
+Expects that @p scene is 3D and has a @ref Trade::SceneField::Parent field,
+that all @ref Trade::SceneField::Mesh entries are in bounds for @p meshes, and
+that the referenced meshes have a three-dimensional
+@ref Trade::MeshAttribute::Position, a primitive that isn't
+@ref MeshPrimitive::LineStrip, @relativeref{MeshPrimitive,LineLoop},
+@relativeref{MeshPrimitive,TriangleStrip} or
+@relativeref{MeshPrimitive,TriangleFan} and no implementation-specific
+primitive, index type or vertex formats. Use @ref MeshTools::generateIndices()
+to convert strips, loops and fans to the corresponding indexed primitives
+first.
+
+With @p threadCount larger than @cpp 1 @ce the transformation calculation is
+parallelized as described in
+@ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&, UnsignedInt)
+and the batches are then transformed and concatenated in parallel, with each
+thread processing a contiguous range of batches. The output is the same
+regardless of the thread count used. Peak memory use is the output plus the
+transformed copies of meshes in batches that are processed at the same time.
+
+@note This function is available only if Magnum is compiled with
+    `MAGNUM_WITH_MESHTOOLS` enabled (done by default). See
+    @ref building-features for more information.
+
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>> batchMeshes3D(const Trade::SceneData& scene, const Containers::Iterable<const Trade::MeshData>& meshes, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
@@ -0,0 +1,401 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Intersection.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+struct BoundingVolumeHierarchy::Node {
+    Range3D bounds;
+    /* For leaf nodes offset into _instances, for internal nodes index of the
+       right child. The left child is always right after its parent. */
+    UnsignedInt offset;
+    /* Instance count for leaf nodes, 0 for internal nodes */
+    UnsignedInt count;
+};
+
+namespace {
+
+/* Max depth of the hierarchy, used for the traversal stack. As each split
+   halves the instance count, it's at most 33 for 2^32 instances. */
+constexpr std::size_t MaxDepth = 64;
+
+/* Node counts of subtrees with n and n + 1 instances. With the median split,
+   children of a node with n instances have floor(n/2) and ceil(n/2)
+   instances, so sizes on each level of the tree differ by at most one and
+   it's enough to recurse just once to calculate both. */
+Containers::Pair<std::size_t, std::size_t> nodeCountsFor(const std::size_t n) {
+    if(n + 1 <= BoundingVolumeHierarchy::LeafSize)
+        return {1, 1};
+
+    const Containers::Pair<std::size_t, std::size_t> half = nodeCountsFor(n/2);
+    /* n = 2m has children m, m and n + 1 = 2m + 1 has m, m + 1 */
+    if(n % 2 == 0) return {
+        n <= BoundingVolumeHierarchy::LeafSize ? 1 : 1 + 2*half.first(),
+        1 + half.first() + half.second()
+    };
+    /* n = 2m + 1 has children m, m + 1 and n + 1 = 2m + 2 has m + 1, m + 1 */
+    return {
+        n <= BoundingVolumeHierarchy::LeafSize ? 1 : 1 + half.first() + half.second(),
+        1 + 2*half.second()
+    };
+}
+
+std::size_t nodeCountFor(const std::size_t n) {
+    return n ? nodeCountsFor(n).first() : 0;
+}
+
+Range3D joinBounds(const Range3D& a, const Range3D& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+/* Axis-aligned box enclosing a transformed box. Assumes the transformation
+   is affine. */
+Range3D transformBounds(const Matrix4& transformation, const Range3D& bounds) {
+    const Vector3 center = transformation.transformPoint(bounds.center());
+    const Matrix3x3 rotationScaling = transformation.rotationScaling();
+    const Vector3 halfSize = bounds.size()*0.5f;
+    Vector3 extents;
+    for(std::size_t i = 0; i != 3; ++i)
+        extents[i] = Math::dot(Math::abs(rotationScaling.row(i)), halfSize);
+    return {center - extents, center + extents};
+}
+
+/* Calculates bounds of all mesh instances in the scene, in order of the
+   Mesh field */
+Containers::Array<Range3D> meshInstanceBounds(const char* const messagePrefix, const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const UnsignedInt threadCount, Containers::Array<UnsignedInt>* const objects) {
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    #endif
+    CORRADE_ASSERT(scene.is3D(),
+        messagePrefix << "the scene is not 3D", {});
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    CORRADE_ASSERT(meshFieldId,
+        messagePrefix << "the scene has no meshes", {});
+
+    const std::size_t size = scene.fieldSize(*meshFieldId);
+    Containers::Array<UnsignedInt> mapping{NoInit, size};
+    Containers::Array<UnsignedInt> meshes{NoInit, size};
+    scene.meshesMaterialsInto(mapping, meshes, nullptr);
+
+    /* If the scene has no transformations, the absolute transformations are
+       all identities. Otherwise it needs a hierarchy to calculate them. */
+    Containers::Array<Matrix4> transformations;
+    if(scene.transformationFieldSize())
+        transformations = absoluteFieldTransformations3D(scene, *meshFieldId, {}, threadCount);
+
+    Containers::Array<Range3D> out{NoInit, size};
+    for(std::size_t i = 0; i != size; ++i) {
+        CORRADE_ASSERT(meshes[i] < meshBounds.size(),
+            messagePrefix << "mesh" << meshes[i] << "out of range for" << meshBounds.size() << "mesh bounds", {});
+        out[i] = transformations.isEmpty() ? meshBounds[meshes[i]] :
+            transformBounds(transformations[i], meshBounds[meshes[i]]);
+    }
+
+    if(objects)
+        *objects = Utility::move(mapping);
+    return out;
+}
+
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Range3D>& bounds, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(objects.size() == bounds.size(),
+        "SceneTools::BoundingVolumeHierarchy: expected the same number of objects and bounds but got" << objects.size() << "and" << bounds.size(), );
+    CORRADE_ASSERT(objects.size() <= 0xffffffffu,
+        "SceneTools::BoundingVolumeHierarchy: expected at most 4294967295 instances but got" << objects.size(), );
+
+    const std::size_t instanceCount = objects.size();
+    _objects = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+    Utility::copy(objects, _objects);
+    _instanceBounds = Containers::Array<Range3D>{NoInit, instanceCount};
+    Utility::copy(bounds, _instanceBounds);
+    _nodes = Containers::Array<Node>{NoInit, nodeCountFor(instanceCount)};
+    _parents = Containers::Array<UnsignedInt>{NoInit, _nodes.size()};
+    _instances = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+    for(std::size_t i = 0; i != instanceCount; ++i)
+        _instances[i] = UnsignedInt(i);
+    _instanceLeaves = Containers::Array<UnsignedInt>{NoInit, instanceCount};
+    if(!instanceCount)
+        return;
+
+    Containers::Array<Vector3> centers{NoInit, instanceCount};
+    for(std::size_t i = 0; i != instanceCount; ++i)
+        centers[i] = _instanceBounds[i].center();
+
+    /* Split the first few levels on this thread until there's enough
+       subtrees for all threads, then build the subtrees in parallel. As the
+       node count of each subtree depends only on its instance count, each
+       subtree has its place in the node array known upfront and the result
+       is the same regardless of the thread count. */
+    struct Subtree {
+        UnsignedInt node, parent, begin, end;
+    };
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(instanceCount, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Containers::Array<Subtree> subtrees;
+    arrayAppend(subtrees, Subtree{0, ~UnsignedInt{}, 0, UnsignedInt(instanceCount)});
+    while(subtrees.size() < 4*std::size_t(actualThreadCount)) {
+        Containers::Array<Subtree> next;
+        arrayReserve(next, 2*subtrees.size());
+        for(const Subtree& s: subtrees) {
+            if(s.end - s.begin <= LeafSize) {
+                arrayAppend(next, s);
+                continue;
+            }
+
+            const UnsignedInt mid = splitNode(centers, s.node, s.parent, s.begin, s.end);
+            arrayAppend(next, Subtree{s.node + 1, s.node, s.begin, mid});
+            arrayAppend(next, Subtree{_nodes[s.node].offset, s.node, mid, s.end});
+        }
+
+        /* Nothing left to split */
+        if(next.size() == subtrees.size())
+            break;
+        subtrees = Utility::move(next);
+    }
+
+    Magnum::Implementation::parallelFor(subtrees.size(), actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(const Subtree& s: subtrees.slice(begin, end))
+            buildSubtree(centers, s.node, s.parent, s.begin, s.end);
+    });
+
+    refitInternal(threadCount);
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const UnsignedInt threadCount) {
+    Containers::Array<UnsignedInt> objects;
+    const Containers::Array<Range3D> bounds = meshInstanceBounds("SceneTools::BoundingVolumeHierarchy:", scene, meshBounds, threadCount, &objects);
+    *this = BoundingVolumeHierarchy{objects, bounds, threadCount};
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept = default;
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy() = default;
+
+BoundingVolumeHierarchy& BoundingVolumeHierarchy::operator=(BoundingVolumeHierarchy&&) noexcept = default;
+
+std::size_t BoundingVolumeHierarchy::nodeCount() const {
+    return _nodes.size();
+}
+
+Range3D BoundingVolumeHierarchy::bounds() const {
+    return _nodes.isEmpty() ? Range3D{} : _nodes[0].bounds;
+}
+
+UnsignedInt BoundingVolumeHierarchy::splitNode(const Containers::ArrayView<const Vector3> centers, const UnsignedInt node, const UnsignedInt parent, const UnsignedInt begin, const UnsignedInt end) {
+    _parents[node] = parent;
+
+    /* Keep instances in the leaves in their original order to make the
+       query output order less arbitrary */
+    if(end - begin <= LeafSize) {
+        std::sort(_instances.data() + begin, _instances.data() + end);
+        _nodes[node].offset = begin;
+        _nodes[node].count = end - begin;
+        for(UnsignedInt i = begin; i != end; ++i)
+            _instanceLeaves[_instances[i]] = node;
+        return ~UnsignedInt{};
+    }
+
+    /* Split at the median of the centers along the longest axis of their
+       bounds, comparing the instance IDs as well to have the order
+       well-defined for equal centers */
+    Vector3 min = centers[_instances[begin]];
+    Vector3 max = min;
+    for(UnsignedInt i = begin + 1; i != end; ++i) {
+        min = Math::min(min, centers[_instances[i]]);
+        max = Math::max(max, centers[_instances[i]]);
+    }
+    const Vector3 size = max - min;
+    const std::size_t axis = size.x() >= size.y() && size.x() >= size.z() ? 0 : size.y() >= size.z() ? 1 : 2;
+
+    const UnsignedInt mid = begin + (end - begin)/2;
+    std::nth_element(_instances.data() + begin, _instances.data() + mid, _instances.data() + end, [&centers, axis](const UnsignedInt a, const UnsignedInt b) {
+        const Float ca = centers[a][axis];
+        const Float cb = centers[b][axis];
+        return ca < cb || (ca == cb && a < b);
+    });
+
+    _nodes[node].offset = node + 1 + nodeCountFor(mid - begin);
+    _nodes[node].count = 0;
+    return mid;
+}
+
+void BoundingVolumeHierarchy::buildSubtree(const Containers::ArrayView<const Vector3> centers, const UnsignedInt node, const UnsignedInt parent, const UnsignedInt begin, const UnsignedInt end) {
+    /* The depth is logarithmic, so there's no risk of a stack overflow */
+    const UnsignedInt mid = splitNode(centers, node, parent, begin, end);
+    if(mid == ~UnsignedInt{})
+        return;
+
+    buildSubtree(centers, node + 1, node, begin, mid);
+    buildSubtree(centers, _nodes[node].offset, node, mid, end);
+}
+
+Range3D BoundingVolumeHierarchy::leafBounds(const Node& node) const {
+    Range3D bounds = _instanceBounds[_instances[node.offset]];
+    for(UnsignedInt i = node.offset + 1, end = node.offset + node.count; i != end; ++i)
+        bounds = joinBounds(bounds, _instanceBounds[_instances[i]]);
+    return bounds;
+}
+
+void BoundingVolumeHierarchy::refitInternal(const UnsignedInt threadCount) {
+    /* Leaf nodes are independent, calculate their bounds in parallel */
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(_instanceBounds.size(), threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Magnum::Implementation::parallelFor(_nodes.size(), actualThreadCount, Magnum::Implementation::ParallelForMinChunkSize/LeafSize, [&](const std::size_t begin, const std::size_t end) {
+        for(Node& node: _nodes.slice(begin, end))
+            if(node.count)
+                node.bounds = leafBounds(node);
+    });
+
+    /* Children always have a larger index than their parent, so going in a
+       reverse order guarantees both children are calculated already. There's
+       only about a quarter as many internal nodes as there are instances, so
+       this is done on a single thread. */
+    for(std::size_t i = _nodes.size(); i != 0; --i) {
+        Node& node = _nodes[i - 1];
+        if(!node.count)
+            node.bounds = joinBounds(_nodes[i].bounds, _nodes[node.offset].bounds);
+    }
+}
+
+void BoundingVolumeHierarchy::refit(const Containers::StridedArrayView1D<const Range3D>& bounds, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(bounds.size() == _instanceBounds.size(),
+        "SceneTools::BoundingVolumeHierarchy::refit(): expected" << _instanceBounds.size() << "bounds but got" << bounds.size(), );
+
+    Utility::copy(bounds, _instanceBounds);
+    refitInternal(threadCount);
+}
+
+void BoundingVolumeHierarchy::refit(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, const UnsignedInt threadCount) {
+    #ifndef CORRADE_NO_ASSERT
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    #endif
+    CORRADE_ASSERT(!meshFieldId || scene.fieldSize(*meshFieldId) == _instanceBounds.size(),
+        "SceneTools::BoundingVolumeHierarchy::refit(): expected" << _instanceBounds.size() << "mesh instances but got" << scene.fieldSize(*meshFieldId), );
+    const Containers::Array<Range3D> bounds = meshInstanceBounds("SceneTools::BoundingVolumeHierarchy::refit():", scene, meshBounds, threadCount, nullptr);
+    #ifndef CORRADE_NO_ASSERT
+    /* The assertion was already printed, bail */
+    if(bounds.size() != _instanceBounds.size())
+        return;
+    #endif
+    refit(bounds, threadCount);
+}
+
+void BoundingVolumeHierarchy::update(const Containers::StridedArrayView1D<const UnsignedInt>& instances, const Containers::StridedArrayView1D<const Range3D>& bounds) {
+    CORRADE_ASSERT(instances.size() == bounds.size(),
+        "SceneTools::BoundingVolumeHierarchy::update(): expected the same number of instances and bounds but got" << instances.size() << "and" << bounds.size(), );
+
+    for(std::size_t i = 0; i != instances.size(); ++i) {
+        const UnsignedInt instance = instances[i];
+        CORRADE_ASSERT(instance < _instanceBounds.size(),
+            "SceneTools::BoundingVolumeHierarchy::update(): index" << instance << "out of range for" << _instanceBounds.size() << "instances", );
+        _instanceBounds[instance] = bounds[i];
+    }
+
+    /* Recalculate bounds of the leaf containing each instance and all its
+       parents. Bounds can both grow and shrink, so it has to go all the way
+       up to the root every time. */
+    for(const UnsignedInt instance: instances) {
+        const UnsignedInt leaf = _instanceLeaves[instance];
+        _nodes[leaf].bounds = leafBounds(_nodes[leaf]);
+        for(UnsignedInt node = _parents[leaf]; node != ~UnsignedInt{}; node = _parents[node])
+            _nodes[node].bounds = joinBounds(_nodes[node + 1].bounds, _nodes[_nodes[node].offset].bounds);
+    }
+}
+
+template<class Predicate> std::size_t BoundingVolumeHierarchy::queryInto(const Predicate& predicate, const Containers::StridedArrayView1D<UnsignedInt>& objects) const {
+    if(_nodes.isEmpty())
+        return 0;
+
+    /* Depth-first traversal, visiting the left child first */
+    UnsignedInt stack[MaxDepth];
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    std::size_t count = 0;
+    while(stackSize) {
+        const Node& node = _nodes[stack[--stackSize]];
+        if(!predicate(node.bounds))
+            continue;
+
+        if(node.count) {
+            for(UnsignedInt i = node.offset, iEnd = node.offset + node.count; i != iEnd; ++i) {
+                const UnsignedInt instance = _instances[i];
+                if(!predicate(_instanceBounds[instance]))
+                    continue;
+                if(count < objects.size())
+                    objects[count] = _objects[instance];
+                ++count;
+            }
+        } else {
+            CORRADE_INTERNAL_ASSERT(stackSize + 2 <= MaxDepth);
+            stack[stackSize++] = node.offset;
+            stack[stackSize++] = UnsignedInt(&node - _nodes.data()) + 1;
+        }
+    }
+
+    return count;
+}
+
+std::size_t BoundingVolumeHierarchy::objectsInFrustumInto(const Frustum& frustum, const Containers::StridedArrayView1D<UnsignedInt>& objects) const {
+    return queryInto([&frustum](const Range3D& bounds) {
+        return Math::Intersection::rangeFrustum(bounds, frustum);
+    }, objects);
+}
+
+std::size_t BoundingVolumeHierarchy::objectsOnRayInto(const Vector3& origin, const Vector3& direction, const Containers::StridedArrayView1D<UnsignedInt>& objects) const {
+    /* Same as Math::Intersection::rayRange(), but additionally discarding
+       intersections behind the ray origin */
+    const Vector3 inverseDirection = 1.0f/direction;
+    return queryInto([&origin, &inverseDirection](const Range3D& bounds) {
+        const Vector3 t0 = (bounds.min() - origin)*inverseDirection;
+        const Vector3 t1 = (bounds.max() - origin)*inverseDirection;
+        const Containers::Pair<Vector3, Vector3> tMinMax = Math::minmax(t0, t1);
+        const Float tMax = tMinMax.second().min();
+        return tMinMax.first().max() <= tMax && tMax >= 0.0f;
+    }, objects);
+}
+
+std::size_t BoundingVolumeHierarchy::objectsInRangeInto(const Range3D& range, const Containers::StridedArrayView1D<UnsignedInt>& objects) const {
+    return queryInto([&range](const Range3D& bounds) {
+        return Math::intersects(bounds, range);
+    }, objects);
+}
+
+}}
@@ -0,0 +1,276 @@
+#ifndef Magnum_SceneTools_BoundingVolumeHierarchy_h
+#define Magnum_SceneTools_BoundingVolumeHierarchy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::BoundingVolumeHierarchy
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Bounding volume hierarchy over scene instances
+@m_since_latest
+
+A flattened hierarchy of axis-aligned bounding boxes over a set of instances,
+each having an object ID and a bounding @ref Range3D, for spatial queries such
+as frustum culling with @ref objectsInFrustumInto(), ray picking with
+@ref objectsOnRayInto() or region selection with @ref objectsInRangeInto().
+
+The instances can be either specified directly, or taken from the
+@ref Trade::SceneField::Mesh field of a scene, in which case each mesh
+assignment is one instance. Bounds of each instance are then calculated from
+bounds of the referenced mesh, usually obtained with
+@ref MeshTools::boundingRange(), and the absolute transformation of the object
+calculated with @ref absoluteFieldTransformations3D():
+
+@snippet SceneTools.cpp BoundingVolumeHierarchy-usage
+
+The hierarchy is built top-down by splitting the instances at the median of
+their bounding box centers along the longest axis until there's at most
+@ref LeafSize instances left, which makes the tree balanced and its depth
+logarithmic. The nodes are stored in a depth-first order with the left child
+always directly following its parent, which means children always have a
+larger index than their parent. Thanks to that, when the instances move,
+bounds of all nodes can be updated in a single linear pass with @ref refit()
+or @ref update() without changing the tree structure. That's considerably
+faster than building a new hierarchy, but the query performance can degrade
+if the instances move far from their original positions.
+
+The queries traverse the hierarchy depth-first, always visiting the left child
+first and listing instances in a leaf node in their original order. The
+output order is thus the same for the same input regardless of the thread
+count used to build the hierarchy, but isn't sorted in any particular way.
+
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT BoundingVolumeHierarchy {
+    public:
+        enum: UnsignedInt {
+            /** Max count of instances in a leaf node */
+            LeafSize = 4
+        };
+
+        /**
+         * @brief Construct from instance bounds
+         * @param objects       Object ID of each instance
+         * @param bounds        Bounds of each instance
+         * @param threadCount   Count of threads to use. Use @cpp 0 @ce to
+         *      autodetect from the hardware concurrency.
+         *
+         * The @p objects and @p bounds views are expected to have the same
+         * size. With @p threadCount larger than @cpp 1 @ce the subtrees are
+         * built in parallel after the first few levels of the hierarchy are
+         * split on the calling thread. The resulting hierarchy is the same
+         * regardless of the thread count used. Small inputs are always
+         * processed on a single thread.
+         */
+        explicit BoundingVolumeHierarchy(const Containers::StridedArrayView1D<const UnsignedInt>& objects, const Containers::StridedArrayView1D<const Range3D>& bounds, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Construct from mesh instances in a scene
+         * @param scene         Scene to take the instances from
+         * @param meshBounds    Bounds of each mesh referenced by the scene
+         * @param threadCount   Count of threads to use. Use @cpp 0 @ce to
+         *      autodetect from the hardware concurrency.
+         *
+         * Each entry of the @ref Trade::SceneField::Mesh field becomes one
+         * instance, with its bounds being an axis-aligned box enclosing the
+         * corresponding item of @p meshBounds transformed with the absolute
+         * transformation of given object. The scene is expected to be 3D,
+         * contain the @ref Trade::SceneField::Mesh field and
+         * @ref Trade::SceneField::Parent field if it contains any
+         * transformations, and all mesh IDs are expected to be less than
+         * size of @p meshBounds. The @p threadCount is used both for
+         * @ref absoluteFieldTransformations3D() and for building the
+         * hierarchy.
+         */
+        explicit BoundingVolumeHierarchy(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, UnsignedInt threadCount = 1);
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy&) = delete;
+
+        /** @brief Move constructor */
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept;
+
+        ~BoundingVolumeHierarchy();
+
+        /** @brief Copying is not allowed */
+        BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy&) = delete;
+
+        /** @brief Move assignment */
+        BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) noexcept;
+
+        /** @brief Instance count */
+        std::size_t instanceCount() const { return _objects.size(); }
+
+        /**
+         * @brief Node count
+         *
+         * Zero if there are no instances, one if there's at most
+         * @ref LeafSize instances.
+         */
+        std::size_t nodeCount() const;
+
+        /** @brief Object IDs of all instances */
+        Containers::ArrayView<const UnsignedInt> objects() const { return _objects; }
+
+        /**
+         * @brief Bounds of all instances
+         *
+         * As passed to the constructor or to the last @ref refit() or
+         * @ref update() call.
+         */
+        Containers::ArrayView<const Range3D> instanceBounds() const { return _instanceBounds; }
+
+        /**
+         * @brief Bounds of all instances together
+         *
+         * Returns a default-constructed @ref Range3D if there are no
+         * instances.
+         */
+        Range3D bounds() const;
+
+        /**
+         * @brief Update bounds of all instances
+         * @param bounds        New bounds of each instance
+         * @param threadCount   Count of threads to use. Use @cpp 0 @ce to
+         *      autodetect from the hardware concurrency.
+         *
+         * Expects that @p bounds has the same size as @ref instanceCount().
+         * Recalculates bounds of all nodes in the hierarchy while keeping
+         * its structure.
+         */
+        void refit(const Containers::StridedArrayView1D<const Range3D>& bounds, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Update bounds of all mesh instances from a scene
+         *
+         * Calculates the instance bounds from @p scene and @p meshBounds
+         * the same way as @ref BoundingVolumeHierarchy(const Trade::SceneData&, const Containers::StridedArrayView1D<const Range3D>&, UnsignedInt)
+         * and delegates to @ref refit(const Containers::StridedArrayView1D<const Range3D>&, UnsignedInt).
+         * Expects that the @ref Trade::SceneField::Mesh field has the same
+         * size as @ref instanceCount().
+         */
+        void refit(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const Range3D>& meshBounds, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Update bounds of given instances
+         * @param instances     Instance IDs
+         * @param bounds        New bounds of each instance listed in
+         *      @p instances
+         *
+         * Expects that @p instances and @p bounds have the same size and all
+         * instance IDs are less than @ref instanceCount(). Recalculates just
+         * the nodes containing the instances and their parents, which is
+         * faster than @ref refit() if only a small portion of the instances
+         * moves.
+         */
+        void update(const Containers::StridedArrayView1D<const UnsignedInt>& instances, const Containers::StridedArrayView1D<const Range3D>& bounds);
+
+        /**
+         * @brief Query objects in a frustum
+         * @param frustum       Frustum
+         * @param objects       Where to put the object IDs
+         * @return Total count of instances in the frustum
+         *
+         * Puts object IDs of all instances with bounds intersecting
+         * @p frustum, as calculated by @ref Math::Intersection::rangeFrustum(),
+         * into @p objects. If an object has more instances, its ID is listed
+         * more than once. If @p objects is too small to contain all of them,
+         * only the first ones are written, but the returned value is always
+         * the total count, thus a return value larger than the size of
+         * @p objects means the query has to be repeated with a larger
+         * output view.
+         */
+        std::size_t objectsInFrustumInto(const Frustum& frustum, const Containers::StridedArrayView1D<UnsignedInt>& objects) const;
+
+        /**
+         * @brief Query objects on a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param objects       Where to put the object IDs
+         * @return Total count of instances on the ray
+         *
+         * Puts object IDs of all instances with bounds intersected by a ray
+         * starting at @p origin and going in @p direction, as calculated by
+         * @ref Math::Intersection::rayRange(), into @p objects. The
+         * @p direction doesn't need to be normalized. The output is not
+         * sorted by distance. See @ref objectsInFrustumInto() for a
+         * description of the output and return value behavior.
+         */
+        std::size_t objectsOnRayInto(const Vector3& origin, const Vector3& direction, const Containers::StridedArrayView1D<UnsignedInt>& objects) const;
+
+        /**
+         * @brief Query objects in a range
+         * @param range         Range
+         * @param objects       Where to put the object IDs
+         * @return Total count of instances in the range
+         *
+         * Puts object IDs of all instances with bounds intersecting
+         * @p range, as calculated by @ref Math::intersects(), into
+         * @p objects. See @ref objectsInFrustumInto() for a description of
+         * the output and return value behavior.
+         */
+        std::size_t objectsInRangeInto(const Range3D& range, const Containers::StridedArrayView1D<UnsignedInt>& objects) const;
+
+    private:
+        struct Node;
+
+        /* Splits given instance range, saving the split to the node.
+           Returns the split position or ~UnsignedInt{} if the node is a
+           leaf. */
+        MAGNUM_SCENETOOLS_LOCAL UnsignedInt splitNode(Containers::ArrayView<const Vector3> centers, UnsignedInt node, UnsignedInt parent, UnsignedInt begin, UnsignedInt end);
+        MAGNUM_SCENETOOLS_LOCAL void buildSubtree(Containers::ArrayView<const Vector3> centers, UnsignedInt node, UnsignedInt parent, UnsignedInt begin, UnsignedInt end);
+        MAGNUM_SCENETOOLS_LOCAL Range3D leafBounds(const Node& node) const;
+        /* Recalculates bounds of all nodes from _instanceBounds */
+        MAGNUM_SCENETOOLS_LOCAL void refitInternal(UnsignedInt threadCount);
+        template<class Predicate> MAGNUM_SCENETOOLS_LOCAL std::size_t queryInto(const Predicate& predicate, const Containers::StridedArrayView1D<UnsignedInt>& objects) const;
+
+        Containers::Array<UnsignedInt> _objects;
+        Containers::Array<Range3D> _instanceBounds;
+        /* Nodes in a depth-first order */
+        Containers::Array<Node> _nodes;
+        /* Parent of each node, ~UnsignedInt{} for the root */
+        Containers::Array<UnsignedInt> _parents;
+        /* Instance IDs in order they're referenced by leaf nodes */
+        Containers::Array<UnsignedInt> _instances;
+        /* Leaf node containing given instance */
+        Containers::Array<UnsignedInt> _instanceLeaves;
+};
+
+}}
+
+#endif
@@ -30,23 +30,23 @@
 
 namespace Magnum { namespace SceneTools {
 
-Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields) {
+Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields, const UnsignedInt threadCount) {
     /* See the function documentation for details why is it inlined in a helper
        header */
     /** @todo move everything here once that's dropped */
-    return Implementation::combineFields(mappingType, mappingBound, fields);
+    return Implementation::combineFields(mappingType, mappingBound, fields, threadCount);
 }
 
-Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const std::initializer_list<Trade::SceneFieldData> fields) {
-    return combineFields(mappingType, mappingBound, Containers::arrayView(fields));
+Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const std::initializer_list<Trade::SceneFieldData> fields, const UnsignedInt threadCount) {
+    return combineFields(mappingType, mappingBound, Containers::arrayView(fields), threadCount);
 }
 
-Trade::SceneData combineFields(const Trade::SceneData& scene) {
+Trade::SceneData combineFields(const Trade::SceneData& scene, const UnsignedInt threadCount) {
     /* Can't just pass scene.fieldData() directly as those can be offset-only */
     Containers::Array<Trade::SceneFieldData> fields{NoInit, scene.fieldCount()};
     for(std::size_t i = 0; i != fields.size(); ++i)
         fields[i] = scene.fieldData(i);
-    return combineFields(scene.mappingType(), scene.mappingBound(), fields);
+    return combineFields(scene.mappingType(), scene.mappingBound(), fields, threadCount);
 }
 
 }}
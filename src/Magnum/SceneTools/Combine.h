@@ -62,27 +62,34 @@ used to calculate the total string data size. Note that offset-only
 The resulting fields are always tightly packed (not interleaved). Returned data
 flags have both @ref Trade::DataFlag::Mutable and @ref Trade::DataFlag::Owned,
 so mutable attribute access is guaranteed.
+
+The output layout is calculated upfront and the data are then copied field by
+field. With @p threadCount larger than @cpp 1 @ce the copying is done in
+parallel, with large fields additionally split into multiple chunks. Use
+@cpp 0 @ce to autodetect the thread count from the hardware concurrency. The
+output is the same regardless of the thread count used, small inputs are
+always processed on a single thread.
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, Containers::ArrayView<const Trade::SceneFieldData> fields);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, Containers::ArrayView<const Trade::SceneFieldData> fields, UnsignedInt threadCount = 1);
 
 /**
 @overload
 @m_since_latest
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, std::initializer_list<Trade::SceneFieldData> fields);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(Trade::SceneMappingType mappingType, UnsignedLong mappingBound, std::initializer_list<Trade::SceneFieldData> fields, UnsignedInt threadCount = 1);
 
 /**
 @brief Combine scene fields from scratch
 @m_since_latest
 
-Calls @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>)
+Calls @ref combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>, UnsignedInt)
 with mapping type, bound and fields coming from @p scene. Useful for
 conveniently repacking an existing scene and throwing away data not referenced
 by any field.
 @see @ref filterFields(), @ref filterOnlyFields(), @ref filterExceptFields(),
-    @ref copy(const Trade::SceneData&)
+    @ref copy(const Trade::SceneData&, UnsignedInt)
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(const Trade::SceneData& scene);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData combineFields(const Trade::SceneData& scene, UnsignedInt threadCount = 1);
 
 }}
 
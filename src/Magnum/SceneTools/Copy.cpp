@@ -29,10 +29,18 @@
 #include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools {
 
+namespace {
+
+/* Copying less bytes than this on a single thread isn't worth the overhead */
+constexpr std::size_t ParallelMinChunkSize = 1024*1024;
+
+}
+
 Trade::SceneData reference(const Trade::SceneData& scene) {
     return Trade::SceneData{scene.mappingType(), scene.mappingBound(),
         {}, scene.data(), Trade::sceneFieldDataNonOwningArray(scene.fieldData())};
@@ -47,14 +55,14 @@ Trade::SceneData mutableReference(Trade::SceneData& scene) {
         Trade::DataFlag::Mutable, scene.mutableData(), Trade::sceneFieldDataNonOwningArray(scene.fieldData())};
 }
 
-Trade::SceneData copy(const Trade::SceneData& scene) {
+Trade::SceneData copy(const Trade::SceneData& scene, const UnsignedInt threadCount) {
     return copy(Trade::SceneData{scene.mappingType(), scene.mappingBound(),
         {}, scene.data(),
         Trade::sceneFieldDataNonOwningArray(scene.fieldData()),
-        scene.importerState()});
+        scene.importerState()}, threadCount);
 }
 
-Trade::SceneData copy(Trade::SceneData&& scene) {
+Trade::SceneData copy(Trade::SceneData&& scene, const UnsignedInt threadCount) {
     /* Transfer data if they're owned and mutable, allocate a copy otherwise.
        Save also the original data view for new field pointer calculation. */
     const Containers::ArrayView<const char> originalData = scene.data();
@@ -63,7 +71,9 @@ Trade::SceneData copy(Trade::SceneData&& scene) {
         data = scene.releaseData();
     else {
         data = Containers::Array<char>{NoInit, originalData.size()};
-        Utility::copy(originalData, data);
+        Magnum::Implementation::parallelFor(originalData.size(), threadCount, ParallelMinChunkSize, [&](const std::size_t begin, const std::size_t end) {
+            Utility::copy(originalData.slice(begin, end), data.slice(begin, end));
+        });
     }
 
     /* There's no way to know if field data are owned until we release them and
@@ -46,9 +46,13 @@ All other properties such as the mapping bound or importer state are passed
 through unchanged, the data layout isn't changed in any way. The resulting
 @ref Trade::SceneData::dataFlags() are always @ref Trade::DataFlag::Owned and
 @ref Trade::DataFlag::Mutable.
-@see @ref copy(Trade::SceneData&&)
+
+With @p threadCount larger than @cpp 1 @ce the data are copied in parallel
+chunks. Use @cpp 0 @ce to autodetect the thread count from the hardware
+concurrency. Small data are always copied on a single thread.
+@see @ref copy(Trade::SceneData&&, UnsignedInt)
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData copy(const Trade::SceneData& scene);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData copy(const Trade::SceneData& scene, UnsignedInt threadCount = 1);
 
 /**
 @brief Make a scene with owned data
@@ -59,9 +63,10 @@ If @ref Trade::SceneData::dataFlags() are not @ref Trade::DataFlag::Owned and
 allocates a copy of @ref Trade::SceneData::data() or
 @relativeref{Trade::SceneData,fieldData()}, otherwise transfers their
 ownership. The resulting data are always owned and mutable, the data layout
-isn't changed in any way.
+isn't changed in any way. The @p threadCount is used for the data copy the
+same way as in @ref copy(const Trade::SceneData&, UnsignedInt).
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData copy(Trade::SceneData&& scene);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData copy(Trade::SceneData&& scene, UnsignedInt threadCount = 1);
 
 /**
 @brief Create an immutable reference on a @ref Trade::SceneData
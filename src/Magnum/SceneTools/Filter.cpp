@@ -26,7 +26,7 @@
 
 #include "Filter.h"
 
-#include <map>
+#include <algorithm>
 #include <Corrade/Containers/ArrayTuple.h>
 #include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/BitArrayView.h>
@@ -34,8 +34,11 @@
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Utility/BitAlgorithms.h>
 
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneTools/Combine.h"
 #include "Magnum/SceneTools/Copy.h"
+#include "Magnum/SceneTools/Implementation/uniqueMappings.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools {
@@ -103,7 +106,7 @@ Trade::SceneData filterExceptFields(Trade::SceneData&& scene, std::initializer_l
     return filterExceptFields(Utility::move(scene), Containers::arrayView(fields));
 }
 
-Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
+Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, const UnsignedInt threadCount) {
     /* Track unique mapping views (pointer, size, stride) so fields that shared
        a mapping before stay shared after as well -- if they're filtered, they
        will have the mapping allocated in SharedMapping::filteredMapping()
@@ -114,7 +117,7 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
        such as for TRS fields so we don't need to special-case that here again. */
     struct SharedMapping {
         /* How many times given mapping is shared */
-        UnsignedInt count = 1;
+        UnsignedInt count = 0;
         /* How many times given mapping is filtered. Should be either 0 or same
            as `count`. */
         UnsignedInt filteredCount = 0;
@@ -130,20 +133,11 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
         /** @todo any idea how to do this without the throwaway allocations? */
         Containers::Array<char> filteredMapping;
     };
-    /* A map<tuple> is used because it has conveniently implemented ordering,
-       an unordered_map couldn't be used without manually implementing a
-       std::tuple hash because STL DOES NOT HAVE IT, UGH. */
-    std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping> uniqueMappings;
-    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
-        /* Skip empty fields as those make no sense to include for sharing */
-        if(!scene.fieldSize(i))
-            continue;
-
-        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
-        const std::pair<std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping>::iterator, bool> inserted = uniqueMappings.emplace(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0]), SharedMapping{});
-        if(!inserted.second)
-            ++inserted.first->second.count;
-    }
+    Containers::Array<UnsignedInt> mappingIds{NoInit, scene.fieldCount()};
+    Containers::Array<SharedMapping> uniqueMappings{ValueInit, Implementation::uniqueMappingsInto(scene, mappingIds)};
+    for(const UnsignedInt mappingId: mappingIds)
+        if(mappingId != ~UnsignedInt{})
+            ++uniqueMappings[mappingId].count;
 
     /* Copy all field metadata. By default, if the field isn't referenced, it's
        kept in full. Can't use Utility::copy() on the whole fieldData() array
@@ -159,6 +153,7 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
     #ifndef CORRADE_NO_ASSERT
     Containers::BitArray usedFields{ValueInit, scene.fieldCount()};
     #endif
+    std::size_t totalFilteredSize = 0;
     for(std::size_t i = 0; i != entriesToKeep.size(); ++i) {
         const UnsignedInt fieldId = entriesToKeep[i].first();
         const Containers::BitArrayView mask = entriesToKeep[i].second();
@@ -181,17 +176,17 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
             "SceneTools::filterFieldEntries(): filtering bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
 
         /* Skip empty fields as there's nothing to do for them and they don't
-           even have an entry in the uniqueMappings map. But do that only after
-           doing all checks for them for consistent behavior. */
+           even have an entry in the uniqueMappings array. But do that only
+           after doing all checks for them for consistent behavior. */
         if(!scene.fieldSize(fieldId))
             continue;
 
-        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(fieldId);
-        SharedMapping& sharedMapping = uniqueMappings.at(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0]));
+        SharedMapping& sharedMapping = uniqueMappings[mappingIds[fieldId]];
 
         /* If the mapping is shared, pass a pre-allocated array with the final
            contents to combineFields() to keep the sharing */
         const std::size_t filteredFieldSize = mask.count();
+        totalFilteredSize += filteredFieldSize;
         Containers::StridedArrayView1D<const void> filteredMapping;
         if(sharedMapping.count > 1) {
             /* This is the first mask that filters a shared mapping, allocate
@@ -241,38 +236,45 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
     }
 
     #ifndef CORRADE_NO_ASSERT
-    for(const std::pair<const std::tuple<const void*, std::size_t, std::ptrdiff_t>, SharedMapping>& i: uniqueMappings) {
-        CORRADE_ASSERT(!i.second.filteredCount || i.second.count == i.second.filteredCount,
-            "SceneTools::filterFieldEntries(): field" << scene.fieldName(entriesToKeep[i.second.maskIndex].first()) << "shares mapping with" << i.second.count << "fields but only" << i.second.filteredCount << "are filtered",
+    for(const SharedMapping& i: uniqueMappings) {
+        CORRADE_ASSERT(!i.filteredCount || i.count == i.filteredCount,
+            "SceneTools::filterFieldEntries(): field" << scene.fieldName(entriesToKeep[i.maskIndex].first()) << "shares mapping with" << i.count << "fields but only" << i.filteredCount << "are filtered",
             (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
     }
     #endif
 
-    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields);
-
-    for(const Containers::Pair<UnsignedInt, Containers::BitArrayView>& i: entriesToKeep) {
-        /* Skip empty fields as there's nothing to do for them and they don't
-           even have an entry in the uniqueMappings map */
-        if(!scene.fieldSize(i.first()))
-            continue;
-
-        /* Copy the mapping only if it isn't shared among more fields -- in
-           that case it got already copied above */
-        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i.first());
-        if(uniqueMappings.at(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0])).count == 1)
-            Utility::copyMasked(mapping, i.second(), out.mutableMapping(i.first()));
-
-        Utility::copyMasked(scene.field(i.first()), i.second(), out.mutableField(i.first()));
-    }
+    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields, threadCount);
+
+    /* The output fields are all disjoint, so they can be copied in parallel.
+       Decide on the thread count based on the total amount of entries to
+       copy, not the field count, so scenes with just a few huge fields
+       benefit as well but many tiny fields don't cause threads to be spawned
+       for nothing. */
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(totalFilteredSize, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Magnum::Implementation::parallelFor(entriesToKeep.size(), actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(const Containers::Pair<UnsignedInt, Containers::BitArrayView>& i: entriesToKeep.slice(begin, end)) {
+            /* Skip empty fields as there's nothing to do for them and they
+               don't even have an entry in the uniqueMappings array */
+            if(!scene.fieldSize(i.first()))
+                continue;
+
+            /* Copy the mapping only if it isn't shared among more fields --
+               in that case it got already copied above */
+            if(uniqueMappings[mappingIds[i.first()]].count == 1)
+                Utility::copyMasked(scene.mapping(i.first()), i.second(), out.mutableMapping(i.first()));
+
+            Utility::copyMasked(scene.field(i.first()), i.second(), out.mutableField(i.first()));
+        }
+    });
 
     return out;
 }
 
-Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep) {
-    return filterFieldEntries(scene, Containers::arrayView(entriesToKeep));
+Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, const UnsignedInt threadCount) {
+    return filterFieldEntries(scene, Containers::arrayView(entriesToKeep), threadCount);
 }
 
-Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep) {
+Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Containers::ArrayView<const Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep, const UnsignedInt threadCount) {
     Containers::Array<Containers::Pair<UnsignedInt, Containers::BitArrayView>> out{NoInit, entriesToKeep.size()};
     for(std::size_t i = 0; i != entriesToKeep.size(); ++i) {
         const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(entriesToKeep[i].first());
@@ -281,80 +283,48 @@ Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const Contain
         out[i] = {*fieldId, entriesToKeep[i].second()};
     }
 
-    return filterFieldEntries(scene, out);
+    return filterFieldEntries(scene, out, threadCount);
 }
 
-Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep) {
-    return filterFieldEntries(scene, Containers::arrayView(entriesToKeep));
+Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, const std::initializer_list<Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep, const UnsignedInt threadCount) {
+    return filterFieldEntries(scene, Containers::arrayView(entriesToKeep), threadCount);
 }
 
 namespace {
 
-template<class T> std::size_t filterObjectsImplementation(const Trade::SceneData& scene, const Containers::ArrayView<Containers::Pair<UnsignedInt, Containers::BitArrayView>> fieldStorage, const Containers::MutableBitArrayView maskStorage, const Containers::BitArrayView objects, std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, Containers::Optional<UnsignedInt>>& uniqueMappings) {
-    std::size_t fieldOffset = 0;
-    std::size_t maskOffset = 0;
-    for(UnsignedInt fieldId = 0; fieldId != scene.fieldCount(); ++fieldId) {
-        /* Skip empty fields as there's nothing to do for them and they don't
-           even have an entry in the uniqueMappings map */
-        if(!scene.fieldSize(fieldId))
-            continue;
-
-        const Containers::StridedArrayView1D<const T> mapping = scene.mapping<T>(fieldId);
-
-        /* Shared mappings need to stay shared, thus filterFieldEntries() needs
-           to get the exact same mask for such fields -- for implementation
-           simplicity not just the bit values but the actual view */
-        Containers::Optional<UnsignedInt>& sharedMapping = uniqueMappings.at(std::make_tuple(mapping.data(), mapping.size(), mapping.stride()));
-
-        /* If a mask was already calculated for this mapping, reuse the view */
-        if(sharedMapping) {
-            /* If the field wasn't filtered in any way, it wasn't added to the
-               list, which is indicated by ~UnsignedInt{}. Do nothing in that
-               case. */
-            if(*sharedMapping != ~UnsignedInt{})
-                fieldStorage[fieldOffset++] = {fieldId, fieldStorage[*sharedMapping].second()};
-
-        /* If not, calculate the mask and remember it for potential other
-           fields that share the same mapping view */
-        } else {
-            const Containers::MutableBitArrayView mask = maskStorage.sliceSize(maskOffset, mapping.size());
-
-            bool anyFiltered = false;
-            for(std::size_t i = 0; i != mapping.size(); ++i) {
-                /** @todo ugh! mask.set(i, objects[mapping[i]]) and then .all()
-                    once it's implemented (needs BMI variants similarly to
-                    count()) */
-                if(objects[mapping[i]])
-                    mask.set(i);
-                else {
-                    anyFiltered = true;
-                    mask.reset(i);
-                }
-            }
-
-            /* Only add the field to the list if it's not all 1s */
-            if(anyFiltered) {
-                sharedMapping = fieldOffset;
-                fieldStorage[fieldOffset++] = {fieldId, mask};
-                /* Not bothering with rounding this to whole bytes as
-                   Utility::copyMasked() has to special-case the begin/end
-                   anyway */
-                maskOffset += mask.size();
-            } else {
-                sharedMapping = ~UnsignedInt{};
-            }
+/* Calculates masks of mapping entries that are set in `objects` for all
+   unique mappings. Each mask occupies whole bytes starting at the offset in
+   `maskOffsets`, which has one more item for the end of the last mask. Bits
+   are calculated a whole byte at a time, and because the masks are rounded
+   to whole bytes, the work can be split across threads at arbitrary byte
+   boundaries without needing any synchronization. */
+template<class T> void filterObjectsMasksInto(const Trade::SceneData& scene, const Containers::ArrayView<const UnsignedInt> mappingFieldIds, const Containers::ArrayView<const std::size_t> maskOffsets, const Containers::BitArrayView objects, const Containers::ArrayView<char> maskStorage, const UnsignedInt threadCount) {
+    Containers::Array<Containers::StridedArrayView1D<const T>> mappings{mappingFieldIds.size()};
+    for(std::size_t i = 0; i != mappingFieldIds.size(); ++i)
+        mappings[i] = scene.mapping<T>(mappingFieldIds[i]);
+
+    Magnum::Implementation::parallelFor(maskStorage.size(), threadCount, Magnum::Implementation::ParallelForMinChunkSize/8, [&](const std::size_t begin, const std::size_t end) {
+        /* Find the mask the first byte of this chunk belongs to, then go
+           linearly */
+        std::size_t mappingId = std::upper_bound(maskOffsets.begin(), maskOffsets.end(), begin) - maskOffsets.begin() - 1;
+        for(std::size_t byte = begin; byte != end; ++byte) {
+            while(byte == maskOffsets[mappingId + 1])
+                ++mappingId;
+
+            const Containers::StridedArrayView1D<const T>& mapping = mappings[mappingId];
+            const std::size_t first = (byte - maskOffsets[mappingId])*8;
+            const std::size_t last = Math::min(first + 8, mapping.size());
+            UnsignedByte bits = 0;
+            for(std::size_t i = first; i != last; ++i)
+                bits |= UnsignedByte(objects[mapping[i]]) << (i - first);
+            maskStorage[byte] = char(bits);
         }
-    }
-
-    CORRADE_INTERNAL_ASSERT(fieldOffset <= fieldStorage.size());
-    CORRADE_INTERNAL_ASSERT(maskOffset <= maskStorage.size());
-
-    return fieldOffset;
+    });
 }
 
 }
 
-Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::BitArrayView objects) {
+Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::BitArrayView objects, const UnsignedInt threadCount) {
     CORRADE_ASSERT(objects.size() == scene.mappingBound(),
         "SceneTools::filterObjects(): expected" << scene.mappingBound() << "bits but got" << objects.size(), (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
 
@@ -367,54 +337,80 @@ Trade::SceneData filterObjects(const Trade::SceneData& scene, const Containers::
         this API to be usable, storing also mapping back to the original ID in
         the scene, and an `unpackObjects()` that restores the original IDs */
 
-    /* Count the total count of bits possibly needed */
-    std::size_t bitCount = 0;
-    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i)
-        bitCount += scene.fieldSize(i);
-
-    /* Allocate scratch memory for all the bits and field references */
+    /* Allocate scratch memory for unique mapping IDs, the first field using
+       each unique mapping and byte offsets of their masks, and the field
+       references. Unique mapping count is at most the field count. */
+    Containers::ArrayView<UnsignedInt> mappingIds;
+    Containers::ArrayView<UnsignedInt> mappingFieldIds;
+    Containers::ArrayView<std::size_t> maskOffsets;
+    Containers::MutableBitArrayView filteredMappings;
     Containers::ArrayView<Containers::Pair<UnsignedInt, Containers::BitArrayView>> fieldStorage;
-    Containers::MutableBitArrayView maskStorage;
     Containers::ArrayTuple storage{
-        {NoInit, scene.fieldCount(), fieldStorage},
-        {NoInit, bitCount, maskStorage}
+        {NoInit, scene.fieldCount(), mappingIds},
+        {NoInit, scene.fieldCount(), mappingFieldIds},
+        {NoInit, scene.fieldCount() + 1, maskOffsets},
+        {ValueInit, scene.fieldCount(), filteredMappings},
+        {NoInit, scene.fieldCount(), fieldStorage}
     };
 
-    /* Collect a map of unique mappings. The value is a placeholder where
-       filterObjectsImplementation() will subsequently record a reference to a
-       BitArrayView that should be used for all fields. */
-    std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, Containers::Optional<UnsignedInt>> uniqueMappings;
-    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
-        /* Skip empty fields as those make no sense to include for sharing */
-        if(!scene.fieldSize(i))
-            continue;
-
-        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
-        uniqueMappings.emplace(std::make_tuple(mapping.data(), mapping.size()[0], mapping.stride()[0]), Containers::NullOpt);
+    /* Shared mappings need to stay shared, thus filterFieldEntries() needs
+       to get the exact same mask for such fields -- for implementation
+       simplicity not just the bit values but the actual view. Calculate just
+       one mask for each unique mapping, with the masks rounded to whole
+       bytes. */
+    const UnsignedInt uniqueMappingCount = Implementation::uniqueMappingsInto(scene, mappingIds);
+    maskOffsets[0] = 0;
+    {
+        UnsignedInt nextMappingId = 0;
+        for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+            if(mappingIds[i] != nextMappingId)
+                continue;
+            mappingFieldIds[nextMappingId] = i;
+            maskOffsets[nextMappingId + 1] = maskOffsets[nextMappingId] + (scene.fieldSize(i) + 7)/8;
+            ++nextMappingId;
+        }
+        CORRADE_INTERNAL_ASSERT(nextMappingId == uniqueMappingCount);
     }
+    Containers::Array<char> maskStorage{NoInit, maskOffsets[uniqueMappingCount]};
 
-    /* Delegate to a concrete filtering implementation based on used mapping
-       type. Returns the prefix of fieldStorage that got filled, with fields
-       that didn't need to be changed omitted. */
-    std::size_t fieldCount = ~std::size_t{};
+    /* Delegate to a concrete mask calculation implementation based on used
+       mapping type */
     switch(scene.mappingType()) {
         case Trade::SceneMappingType::UnsignedByte:
-            fieldCount = filterObjectsImplementation<UnsignedByte>(scene, fieldStorage, maskStorage, objects, uniqueMappings);
+            filterObjectsMasksInto<UnsignedByte>(scene, mappingFieldIds.prefix(uniqueMappingCount), maskOffsets.prefix(uniqueMappingCount + 1), objects, maskStorage, threadCount);
             break;
         case Trade::SceneMappingType::UnsignedShort:
-            fieldCount = filterObjectsImplementation<UnsignedShort>(scene, fieldStorage, maskStorage, objects, uniqueMappings);
+            filterObjectsMasksInto<UnsignedShort>(scene, mappingFieldIds.prefix(uniqueMappingCount), maskOffsets.prefix(uniqueMappingCount + 1), objects, maskStorage, threadCount);
             break;
         case Trade::SceneMappingType::UnsignedInt:
-            fieldCount = filterObjectsImplementation<UnsignedInt>(scene, fieldStorage, maskStorage, objects, uniqueMappings);
+            filterObjectsMasksInto<UnsignedInt>(scene, mappingFieldIds.prefix(uniqueMappingCount), maskOffsets.prefix(uniqueMappingCount + 1), objects, maskStorage, threadCount);
             break;
         case Trade::SceneMappingType::UnsignedLong:
-            fieldCount = filterObjectsImplementation<UnsignedLong>(scene, fieldStorage, maskStorage, objects, uniqueMappings);
+            filterObjectsMasksInto<UnsignedLong>(scene, mappingFieldIds.prefix(uniqueMappingCount), maskOffsets.prefix(uniqueMappingCount + 1), objects, maskStorage, threadCount);
             break;
     }
-    CORRADE_INTERNAL_ASSERT(fieldCount != ~std::size_t{});
+
+    /* A mapping needs to be filtered only if its mask isn't all 1s, which is
+       checked with a popcount */
+    for(UnsignedInt i = 0; i != uniqueMappingCount; ++i) {
+        const std::size_t size = scene.fieldSize(mappingFieldIds[i]);
+        if(Containers::BitArrayView{maskStorage + maskOffsets[i], 0, size}.count() != size)
+            filteredMappings.set(i);
+    }
+
+    /* List all fields that have their mapping filtered, with fields that
+       didn't need to be changed omitted. Fields sharing the same mapping get
+       the same mask view. */
+    std::size_t fieldCount = 0;
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const UnsignedInt mappingId = mappingIds[i];
+        if(mappingId == ~UnsignedInt{} || !filteredMappings[mappingId])
+            continue;
+        fieldStorage[fieldCount++] = {i, Containers::BitArrayView{maskStorage + maskOffsets[mappingId], 0, scene.fieldSize(i)}};
+    }
 
     /* Delegate the rest to the low-level field entry filtering API */
-    return filterFieldEntries(scene, fieldStorage.prefix(fieldCount));
+    return filterFieldEntries(scene, fieldStorage.prefix(fieldCount), threadCount);
 }
 
 }}
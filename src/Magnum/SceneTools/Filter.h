@@ -48,7 +48,7 @@ for which the corresponding bit in @p fieldsToKeep was set. The size of
 
 This function only operates on the field metadata --- if you'd like to have
 the data repacked to contain just the remaining fields as well, pass
-the output to @ref combineFields(const Trade::SceneData&).
+the output to @ref combineFields(const Trade::SceneData&, UnsignedInt).
 @see @ref reference(), @ref filterOnlyFields(), @ref filterExceptFields()
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFields(const Trade::SceneData& scene, Containers::BitArrayView fieldsToKeep);
@@ -76,7 +76,7 @@ field was listed just once.
 
 This function only operates on the field metadata --- if you'd like to have
 the data repacked to contain just the remaining fields as well, pass
-the output to @ref combineFields(const Trade::SceneData&).
+the output to @ref combineFields(const Trade::SceneData&, UnsignedInt).
 @see @ref reference(), @ref filterFields(), @ref filterExceptFields()
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterOnlyFields(const Trade::SceneData& scene, Containers::ArrayView<const Trade::SceneField> fields);
@@ -116,7 +116,7 @@ fields was listed just once.
 
 This function only operates on the field metadata --- if you'd like to have
 the data repacked to contain just the remaining fields as well, pass
-the output to @ref combineFields(const Trade::SceneData&).
+the output to @ref combineFields(const Trade::SceneData&, UnsignedInt).
 @see @ref reference(), @ref filterFields(), @ref filterOnlyFields()
 */
 MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterExceptFields(const Trade::SceneData& scene, Containers::ArrayView<const Trade::SceneField> fields);
@@ -189,15 +189,21 @@ mapping as well) need to be listed if they're not filtered:
 
 At the moment, @ref Trade::SceneFieldType::Bit and string fields can't be
 filtered, only passed through.
+
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, the filtered field and mapping data are copied
+to the output in parallel, with each thread processing a contiguous range of
+@p entriesToKeep. The output is the same regardless of the thread count used.
+Small scenes are always processed on a single thread.
 @experimental
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, UnsignedInt threadCount = 1);
 
 /**
 @overload
 @m_since_latest
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<UnsignedInt, Containers::BitArrayView>> entriesToKeep, UnsignedInt threadCount = 1);
 
 /**
 @brief Filter individual entries of named fields in a scene
@@ -205,18 +211,18 @@ MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneD
 
 Translates field names in @p entriesToKeep to field IDs using
 @ref Trade::SceneData::fieldId() and delegates to
-@ref filterFieldEntries(const Trade::SceneData&, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>).
+@ref filterFieldEntries(const Trade::SceneData&, Containers::ArrayView<const Containers::Pair<UnsignedInt, Containers::BitArrayView>>, UnsignedInt).
 Expects that all listed fields exist in @p scene, see the referenced function
 documentation for other expectations.
 @experimental
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, Containers::ArrayView<const Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep, UnsignedInt threadCount = 1);
 
 /**
 @overload
 @m_since_latest
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterFieldEntries(const Trade::SceneData& scene, std::initializer_list<Containers::Pair<Trade::SceneField, Containers::BitArrayView>> entriesToKeep, UnsignedInt threadCount = 1);
 
 /**
 @brief Filter objects in a scene
@@ -237,10 +243,17 @@ the data in any other way. If there are references to the removed objects from
 other fields such as @ref Trade::SceneField::Parent, it's the responsibility of
 the caller to deal with them either before or after calling this API, otherwise
 the returned data may end up being unusable.
+
+The mask of entries to keep is calculated just once for each unique mapping
+view. With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect
+it from the hardware concurrency, the masks are calculated in parallel and
+@ref filterFieldEntries() is called with the same thread count. The output is
+the same regardless of the thread count used. Small scenes are always
+processed on a single thread.
 @experimental
 @see @ref childrenDepthFirst()
 */
-MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterObjects(const Trade::SceneData& scene, Containers::BitArrayView objectsToKeep);
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData filterObjects(const Trade::SceneData& scene, Containers::BitArrayView objectsToKeep, UnsignedInt threadCount = 1);
 
 }}
 
@@ -56,7 +56,7 @@ namespace Magnum { namespace SceneTools {
 /**
 @brief Flatten a 2D mesh hierarchy
 
-@m_deprecated_since_latest Use @ref absoluteFieldTransformations2D(const Trade::SceneData&, Trade::SceneField, const Matrix3&)
+@m_deprecated_since_latest Use @ref absoluteFieldTransformations2D(const Trade::SceneData&, Trade::SceneField, const Matrix3&, UnsignedInt)
     with @ref Trade::SceneField::Mesh together with
     @ref Trade::SceneData::meshesMaterialsAsArray() instead.
 */
@@ -68,7 +68,7 @@ CORRADE_DEPRECATED("use absoluteFieldTransformations2D() instead") MAGNUM_SCENET
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
 
-@m_deprecated_since_latest Use @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, Trade::SceneField, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&)
+@m_deprecated_since_latest Use @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, Trade::SceneField, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&, UnsignedInt)
     with @ref Trade::SceneField::Mesh instead.
 */
 CORRADE_DEPRECATED("use absoluteFieldTransformations2DInto() instead") MAGNUM_SCENETOOLS_EXPORT void flattenMeshHierarchy2DInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
@@ -76,7 +76,7 @@ CORRADE_DEPRECATED("use absoluteFieldTransformations2DInto() instead") MAGNUM_SC
 /**
 @brief Flatten a 3D mesh hierarchy
 
-@m_deprecated_since_latest Use @ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&)
+@m_deprecated_since_latest Use @ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&, UnsignedInt)
     with @ref Trade::SceneField::Mesh together with
     @ref Trade::SceneData::meshesMaterialsAsArray() instead.
 */
@@ -88,7 +88,7 @@ CORRADE_DEPRECATED("use absoluteFieldTransformations3D() instead") MAGNUM_SCENET
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
 
-@m_deprecated_since_latest Use @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, Trade::SceneField, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&)
+@m_deprecated_since_latest Use @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, Trade::SceneField, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&, UnsignedInt)
     with @ref Trade::SceneField::Mesh instead.
 */
 CORRADE_DEPRECATED("use absoluteFieldTransformations3DInto() instead") MAGNUM_SCENETOOLS_EXPORT void flattenMeshHierarchy3DInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
@@ -34,24 +34,159 @@
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools {
 
-Containers::Array<Containers::Pair<UnsignedInt, Int>> parentsBreadthFirst(const Trade::SceneData& scene) {
+namespace {
+
+/* Max size of the per-thread children histograms relative to the parent
+   count */
+constexpr std::size_t ParallelMaxHistogramRatio = 8;
+
+/* Calculates per-parent children offsets and a list of children sorted by the
+   parent in a stable way using a counting sort, running on given count of
+   threads. Each thread counts its chunk of `parents` into a histogram of its
+   own, the histograms are then converted to output offsets for each chunk,
+   so the result is the same regardless of the thread count. Fills
+   `childrenOffsets` in the same way as the serial variant in
+   parentsBreadthFirstInto() does, i.e. with
+   `[childrenOffsets[i + 1], childrenOffsets[i + 2])` being a range in
+   `children` containing children of object `i`. */
+void parallelChildrenInto(const Containers::ArrayView<const Containers::Pair<UnsignedInt, Int>> parents, const UnsignedInt mappingBound, const UnsignedInt threadCount, const Containers::ArrayView<UnsignedInt> childrenOffsets, const Containers::ArrayView<UnsignedInt> children) {
+    /* Histogram for each key, which is the parent ID + 1, for each thread */
+    const std::size_t keyCount = std::size_t(mappingBound) + 1;
+    Containers::Array<UnsignedInt> histograms{ValueInit, keyCount*threadCount};
+
+    /* Each thread counts children of its own chunk of the parent list. Calling
+       parallelFor() with the count equal to the thread count, so each call
+       gets exactly one chunk index. */
+    Implementation::parallelFor(threadCount, threadCount, 1, [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        for(std::size_t chunk = chunkBegin; chunk != chunkEnd; ++chunk) {
+            const Containers::ArrayView<UnsignedInt> histogram = histograms.sliceSize(chunk*keyCount, keyCount);
+            for(const Containers::Pair<UnsignedInt, Int>& parent: parents.slice(parents.size()*chunk/threadCount, parents.size()*(chunk + 1)/threadCount)) {
+                CORRADE_INTERNAL_ASSERT(parent.first() < mappingBound && (parent.second() == -1 || UnsignedInt(parent.second()) < mappingBound));
+                ++histogram[parent.second() + 1];
+            }
+        }
+    });
+
+    /* Total count of children for each key, calculated in parallel over key
+       ranges, put to the childrenOffsets array shifted by one */
+    Implementation::parallelFor(keyCount, threadCount, Implementation::ParallelForMinChunkSize, [&](const std::size_t keyBegin, const std::size_t keyEnd) {
+        for(std::size_t key = keyBegin; key != keyEnd; ++key) {
+            UnsignedInt count = 0;
+            for(std::size_t chunk = 0; chunk != threadCount; ++chunk)
+                count += histograms[chunk*keyCount + key];
+            childrenOffsets[key + 1] = count;
+        }
+    });
+
+    /* Convert the total counts to a running offset serially, this is just an
+       addition for each key. Then `[childrenOffsets[i + 1],
+       childrenOffsets[i + 2])` is the range of children for object `i`. */
+    childrenOffsets[0] = 0;
+    for(std::size_t key = 0; key != keyCount; ++key)
+        childrenOffsets[key + 1] += childrenOffsets[key];
+    CORRADE_INTERNAL_ASSERT(childrenOffsets[keyCount] == parents.size());
+
+    /* Convert the per-chunk histograms to output offsets for each chunk, again
+       in parallel over key ranges */
+    Implementation::parallelFor(keyCount, threadCount, Implementation::ParallelForMinChunkSize, [&](const std::size_t keyBegin, const std::size_t keyEnd) {
+        for(std::size_t key = keyBegin; key != keyEnd; ++key) {
+            UnsignedInt offset = childrenOffsets[key];
+            for(std::size_t chunk = 0; chunk != threadCount; ++chunk) {
+                UnsignedInt& count = histograms[chunk*keyCount + key];
+                const UnsignedInt nextOffset = offset + count;
+                count = offset;
+                offset = nextOffset;
+            }
+        }
+    });
+
+    /* Each thread then puts its chunk of children to the output. The ranges
+       are disjoint for each chunk, so there's no synchronization needed. */
+    Implementation::parallelFor(threadCount, threadCount, 1, [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        for(std::size_t chunk = chunkBegin; chunk != chunkEnd; ++chunk) {
+            const Containers::ArrayView<UnsignedInt> offsets = histograms.sliceSize(chunk*keyCount, keyCount);
+            for(const Containers::Pair<UnsignedInt, Int>& parent: parents.slice(parents.size()*chunk/threadCount, parents.size()*(chunk + 1)/threadCount))
+                children[offsets[parent.second() + 1]++] = parent.first();
+        }
+    });
+}
+
+/* Calculates per-parent children offsets and a list of children sorted by the
+   parent, either serially or with parallelChildrenInto(), with the same
+   result. The `childrenOffsets` array is expected to have mappingBound + 3
+   zero-initialized items. */
+void childrenInto(const Containers::ArrayView<const Containers::Pair<UnsignedInt, Int>> parents, const UnsignedInt mappingBound, const UnsignedInt threadCount, const Containers::ArrayView<UnsignedInt> childrenOffsets, const Containers::ArrayView<UnsignedInt> children) {
+    /* Each thread needs its own histogram of mappingBound + 1 items. Besides
+       limiting the thread count by the parent count, limit it also so the
+       histograms together don't take more than ParallelMaxHistogramRatio
+       times the parent list, and to not have more threads than there would
+       be for processing the histogram itself. */
+    const std::size_t keyCount = std::size_t(mappingBound) + 1;
+    UnsignedInt actualThreadCount = Math::min(
+        Implementation::parallelForThreadCount(parents.size(), threadCount, Implementation::ParallelForMinChunkSize),
+        Implementation::parallelForThreadCount(mappingBound, threadCount, Implementation::ParallelForMinChunkSize));
+    const std::size_t maxHistogramThreadCount = parents.size()*ParallelMaxHistogramRatio/keyCount;
+    if(actualThreadCount > maxHistogramThreadCount)
+        actualThreadCount = Math::max(UnsignedInt(maxHistogramThreadCount), 1u);
+
+    /* With multiple threads, sort the children in parallel. The serial
+       variant below doesn't need any extra memory for the histograms. */
+    if(actualThreadCount > 1) {
+        parallelChildrenInto(parents, mappingBound, actualThreadCount, childrenOffsets, children);
+        return;
+    }
+
+    /* Children offset for each node including root. First calculate the count
+       of children for each, skipping the first element (parent.second() can be
+       -1, accounting for that as well)... */
+    for(const Containers::Pair<UnsignedInt, Int>& parent: parents) {
+        CORRADE_INTERNAL_ASSERT(parent.first() < mappingBound && (parent.second() == -1 || UnsignedInt(parent.second()) < mappingBound));
+        ++childrenOffsets[parent.second() + 2];
+    }
+
+    /* ... then convert the counts to a running offset. Now
+       `[childrenOffsets[i + 2], childrenOffsets[i + 3])` contains a range in
+       which the `children` array below contains a list of children for `i`. */
+    UnsignedInt offset = 0;
+    for(UnsignedInt& i: childrenOffsets) {
+        UnsignedInt nextOffset = offset + i;
+        i = offset;
+        offset = nextOffset;
+    }
+    CORRADE_INTERNAL_ASSERT(offset == parents.size());
+
+    /* Go through the parent list again, convert that to child ranges. The
+       childrenOffsets array gets shifted by one element by the process, thus
+       now `[childrenOffsets[i + 1], childrenOffsets[i + 2])` contains a range
+       in which the `children` array below contains a list of children for
+       `i`. */
+    for(const Containers::Pair<UnsignedInt, Int>& parent: parents)
+        children[childrenOffsets[parent.second() + 2]++] = parent.first();
+}
+
+}
+
+Containers::Array<Containers::Pair<UnsignedInt, Int>> parentsBreadthFirst(const Trade::SceneData& scene, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
     CORRADE_ASSERT(parentFieldId,
         "SceneTools::parentsBreadthFirst(): the scene has no hierarchy", {});
     Containers::Array<Containers::Pair<UnsignedInt, Int>> out{NoInit, scene.fieldSize(*parentFieldId)};
     parentsBreadthFirstInto(scene,
         stridedArrayView(out).slice(&decltype(out)::Type::first),
-        stridedArrayView(out).slice(&decltype(out)::Type::second));
+        stridedArrayView(out).slice(&decltype(out)::Type::second),
+        threadCount);
     return out;
 }
 
-void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Int>& parentDestination) {
+void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Int>& parentDestination, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
     CORRADE_ASSERT(parentFieldId,
         "SceneTools::parentsBreadthFirstInto(): the scene has no hierarchy", );
@@ -84,32 +219,10 @@ void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::St
         stridedArrayView(parents).slice(&decltype(parents)::Type::second)
     );
 
-    /* Children offset for each node including root. First calculate the count
-       of children for each, skipping the first element (parent.second() can be
-       -1, accounting for that as well)... */
-    for(const Containers::Pair<UnsignedInt, Int>& parent: parents) {
-        CORRADE_INTERNAL_ASSERT(parent.first() < scene.mappingBound() && (parent.second() == -1 || UnsignedInt(parent.second()) < scene.mappingBound()));
-        ++childrenOffsets[parent.second() + 2];
-    }
-
-    /* ... then convert the counts to a running offset. Now
-       `[childrenOffsets[i + 2], childrenOffsets[i + 3])` contains a range in
-       which the `children` array below contains a list of children for `i`. */
-    UnsignedInt offset = 0;
-    for(UnsignedInt& i: childrenOffsets) {
-        UnsignedInt nextOffset = offset + i;
-        i = offset;
-        offset = nextOffset;
-    }
-    CORRADE_INTERNAL_ASSERT(offset == parents.size());
-
-    /* Go through the parent list again, convert that to child ranges. The
-       childrenOffsets array gets shifted by one element by the process, thus
-       now `[childrenOffsets[i + 1], childrenOffsets[i + 2])` contains a range
-       in which the `children` array below contains a list of children for
-       `i`. */
-    for(const Containers::Pair<UnsignedInt, Int>& parent: parents)
-        children[childrenOffsets[parent.second() + 2]++] = parent.first();
+    /* Convert the parent list to child ranges, now
+       `[childrenOffsets[i + 1], childrenOffsets[i + 2])` contains a range in
+       which the `children` array contains a list of children for `i` */
+    childrenInto(parents, scene.mappingBound(), threadCount, childrenOffsets, children);
 
     /* Go breadth-first (so we have nodes sharing the same parent next to each
        other) and build a list of (id, parent id) where a parent is always
@@ -139,18 +252,19 @@ void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::St
         "SceneTools::parentsBreadthFirst(): hierarchy is sparse", );
 }
 
-Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> childrenDepthFirst(const Trade::SceneData& scene) {
+Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> childrenDepthFirst(const Trade::SceneData& scene, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
     CORRADE_ASSERT(parentFieldId,
         "SceneTools::childrenDepthFirst(): the scene has no hierarchy", {});
     Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> out{NoInit, scene.fieldSize(*parentFieldId)};
     childrenDepthFirstInto(scene,
         stridedArrayView(out).slice(&decltype(out)::Type::first),
-        stridedArrayView(out).slice(&decltype(out)::Type::second));
+        stridedArrayView(out).slice(&decltype(out)::Type::second),
+        threadCount);
     return out;
 }
 
-void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<UnsignedInt>& childCountDestination) {
+void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<UnsignedInt>& childCountDestination, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> parentFieldId = scene.findFieldId(Trade::SceneField::Parent);
     CORRADE_ASSERT(parentFieldId,
         "SceneTools::childrenDepthFirstInto(): the scene has no hierarchy", );
@@ -185,32 +299,10 @@ void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::Str
         stridedArrayView(parents).slice(&decltype(parents)::Type::second)
     );
 
-    /* Children offset for each node including root. First calculate the count
-       of children for each, skipping the first element (parent.second() can be
-       -1, accounting for that as well)... */
-    for(const Containers::Pair<UnsignedInt, Int>& parent: parents) {
-        CORRADE_INTERNAL_ASSERT(parent.first() < scene.mappingBound() && (parent.second() == -1 || UnsignedInt(parent.second()) < scene.mappingBound()));
-        ++childrenOffsets[parent.second() + 2];
-    }
-
-    /* ... then convert the counts to a running offset. Now
-       `[childrenOffsets[i + 2], childrenOffsets[i + 3])` contains a range in
-       which the `children` array below contains a list of children for `i`. */
-    UnsignedInt offset = 0;
-    for(UnsignedInt& i: childrenOffsets) {
-        UnsignedInt nextOffset = offset + i;
-        i = offset;
-        offset = nextOffset;
-    }
-    CORRADE_INTERNAL_ASSERT(offset == parents.size());
-
-    /* Go through the parent list again, convert that to child ranges. The
-       childrenOffsets array gets shifted by one element by the process, thus
-       now `[childrenOffsets[i + 1], childrenOffsets[i + 2])` contains a range
-       in which the `children` array below contains a list of children for
-       `i`. */
-    for(const Containers::Pair<UnsignedInt, Int>& parent: parents)
-        children[childrenOffsets[parent.second() + 2]++] = parent.first();
+    /* Convert the parent list to child ranges, now
+       `[childrenOffsets[i + 1], childrenOffsets[i + 2])` contains a range in
+       which the `children` array contains a list of children for `i` */
+    childrenInto(parents, scene.mappingBound(), threadCount, childrenOffsets, children);
 
     UnsignedInt outputOffset = 0;
     std::size_t parentsToProcessOffset = 0;
@@ -278,7 +370,7 @@ template<> struct SceneDataDimensionTraits<3> {
     }
 };
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     CORRADE_ASSERT(SceneDataDimensionTraits<dimensions>::isDimensions(scene),
         "SceneTools::absoluteFieldTransformations(): the scene is not" << dimensions << Debug::nospace << "D", );
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
@@ -303,7 +395,8 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
     };
     parentsBreadthFirstInto(scene,
         stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::first),
-        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second));
+        stridedArrayView(orderedClusteredParents).slice(&decltype(orderedClusteredParents)::Type::second),
+        threadCount);
     SceneDataDimensionTraits<dimensions>::transformationsInto(scene,
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::first),
         stridedArrayView(transformations).slice(&decltype(transformations)::Type::second));
@@ -318,116 +411,160 @@ template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementa
         absoluteTransformations[transformation.first() + 1] = transformation.second();
     }
 
-    /* Turn the transformations into absolute */
-    for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
-        absoluteTransformations[parentOffset.first() + 1] =
-            absoluteTransformations[parentOffset.second() + 1]*
-            absoluteTransformations[parentOffset.first() + 1];
+    /* Turn the transformations into absolute. With a single thread simply go
+       through the breadth-first list, since a parent is always before its
+       children, its absolute transformation is already calculated. */
+    const UnsignedInt actualThreadCount = Implementation::parallelForThreadCount(orderedClusteredParents.size(), threadCount, Implementation::ParallelForMinChunkSize);
+    if(actualThreadCount <= 1) {
+        for(const Containers::Pair<UnsignedInt, Int>& parentOffset: orderedClusteredParents) {
+            absoluteTransformations[parentOffset.first() + 1] =
+                absoluteTransformations[parentOffset.second() + 1]*
+                absoluteTransformations[parentOffset.first() + 1];
+        }
+
+    /* With multiple threads, find boundaries of each hierarchy level first.
+       The breadth-first order has objects sorted by their depth, so each
+       level is a contiguous range of the list, and objects in a particular
+       level depend only on objects in the previous level. Each level can then
+       be processed in parallel, with the result being exactly the same as in
+       the serial case. */
+    } else {
+        Containers::Array<UnsignedInt> depths{NoInit, std::size_t(scene.mappingBound() + 1)};
+        Containers::Array<std::size_t> levelOffsets;
+        depths[0] = 0;
+        arrayAppend(levelOffsets, 0);
+        UnsignedInt currentDepth = 1;
+        for(std::size_t i = 0; i != orderedClusteredParents.size(); ++i) {
+            const Containers::Pair<UnsignedInt, Int>& parentOffset = orderedClusteredParents[i];
+            const UnsignedInt depth = depths[parentOffset.second() + 1] + 1;
+            depths[parentOffset.first() + 1] = depth;
+            if(depth != currentDepth) {
+                CORRADE_INTERNAL_DEBUG_ASSERT(depth == currentDepth + 1);
+                arrayAppend(levelOffsets, i);
+                currentDepth = depth;
+            }
+        }
+        arrayAppend(levelOffsets, orderedClusteredParents.size());
+
+        for(std::size_t level = 0; level + 1 != levelOffsets.size(); ++level) {
+            const Containers::ArrayView<const Containers::Pair<UnsignedInt, Int>> levelParents = orderedClusteredParents.slice(levelOffsets[level], levelOffsets[level + 1]);
+            Implementation::parallelFor(levelParents.size(), actualThreadCount, Implementation::ParallelForMinChunkSize, [&](const std::size_t begin, const std::size_t end) {
+                for(const Containers::Pair<UnsignedInt, Int>& parentOffset: levelParents.slice(begin, end)) {
+                    absoluteTransformations[parentOffset.first() + 1] =
+                        absoluteTransformations[parentOffset.second() + 1]*
+                        absoluteTransformations[parentOffset.first() + 1];
+                }
+            });
+        }
     }
 
     /* Allocate the output array, retrieve mesh & material IDs and assign
        absolute transformations to each. The matrix location is abused for
        object mapping, which is subsequently replaced by the absolute object
-       transformation for given mesh. */
+       transformation for given mesh. Each item reads the mapping from the
+       same location it then writes to, so the items can be processed in
+       parallel. */
     const auto mapping = Containers::arrayCast<UnsignedInt>(outputTransformations);
     scene.mappingInto(fieldId, mapping);
-    for(std::size_t i = 0; i != mapping.size(); ++i) {
-        CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
-        outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
-    }
+    Implementation::parallelFor(mapping.size(), threadCount, Implementation::ParallelForMinChunkSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            CORRADE_INTERNAL_ASSERT(mapping[i] < scene.mappingBound());
+            outputTransformations[i] = absoluteTransformations[mapping[i] + 1];
+        }
+    });
 }
 
-template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> void absoluteFieldTransformationsIntoImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<MatrixTypeFor<dimensions, Float>>& outputTransformations, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformationsInto(): field" << field << "not found", );
 
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, outputTransformations, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, outputTransformations, globalTransformation, threadCount);
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const UnsignedInt fieldId, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     CORRADE_ASSERT(fieldId < scene.fieldCount(),
         "SceneTools::absoluteFieldTransformations(): index" << fieldId << "out of range for" << scene.fieldCount() << "fields", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, fieldId, out, globalTransformation, threadCount);
     return out;
 }
 
-template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation) {
+template<UnsignedInt dimensions> Containers::Array<MatrixTypeFor<dimensions, Float>> absoluteFieldTransformationsImplementation(const Trade::SceneData& scene, const Trade::SceneField field, const MatrixTypeFor<dimensions, Float>& globalTransformation, const UnsignedInt threadCount) {
     const Containers::Optional<UnsignedInt> fieldId = scene.findFieldId(field);
     CORRADE_ASSERT(fieldId,
         "SceneTools::absoluteFieldTransformations(): field" << field << "not found", {});
 
     Containers::Array<MatrixTypeFor<dimensions, Float>> out{NoInit, scene.fieldSize(*fieldId)};
-    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, out, globalTransformation);
+    absoluteFieldTransformationsIntoImplementation<dimensions>(scene, *fieldId, out, globalTransformation, threadCount);
     return out;
 }
 
 }
 
-Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation);
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<2>(scene, field, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<2>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, field, {}, 1);
 }
 
-Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation);
+Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<2>(scene, fieldId, {}, 1);
 }
 
-void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, globalTransformation);
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, field, transformations, {}, 1);
 }
 
-void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, globalTransformation);
+void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<2>(scene, fieldId, transformations, {}, 1);
 }
 
-Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation);
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<3>(scene, field, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const Trade::SceneField field) {
-    return absoluteFieldTransformationsImplementation<3>(scene, field, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, field, {}, 1);
 }
 
-Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation);
+Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, globalTransformation, threadCount);
 }
 
 Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, const UnsignedInt fieldId) {
-    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {});
+    return absoluteFieldTransformationsImplementation<3>(scene, fieldId, {}, 1);
 }
 
-void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, globalTransformation);
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, field, transformations, {}, 1);
 }
 
-void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, globalTransformation);
+void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, const UnsignedInt threadCount) {
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, globalTransformation, threadCount);
 }
 
 void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, const UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations) {
-    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {});
+    return absoluteFieldTransformationsIntoImplementation<3>(scene, fieldId, transformations, {}, 1);
 }
 
 }}
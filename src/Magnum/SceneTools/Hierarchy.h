@@ -58,11 +58,21 @@ complexity, with @f$ n @f$ being @ref Trade::SceneData::mappingBound(). The
 having no cycles (i.e., every node listed just once) and not being sparse
 (i.e., every node listed in the field reachable from the root).
 
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, the children of each object are gathered using
+a parallel counting sort, which needs an additional temporary histogram of
+@ref Trade::SceneData::mappingBound() items for each thread. The thread count
+is limited so the histograms together are at most eight times larger than the
+@ref Trade::SceneField::Parent field, which means sparse scenes with a large
+mapping bound use fewer threads. The breadth-first traversal itself is always
+done serially and the output is the same regardless of the thread count used.
+Small scenes are always processed on a single thread.
+
 @experimental
 
 @see @ref Trade::SceneData::hasField(), @ref childrenDepthFirst()
 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Pair<UnsignedInt, Int>> parentsBreadthFirst(const Trade::SceneData& scene);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Pair<UnsignedInt, Int>> parentsBreadthFirst(const Trade::SceneData& scene, UnsignedInt threadCount = 1);
 
 /**
 @brief Retrieve parents in a breadth-first order into a pre-allocated view
@@ -78,7 +88,7 @@ views have a size equal to size of the @ref Trade::SceneField::Parent view in
 @see @ref Trade::SceneData::fieldSize(SceneField) const,
     @ref childrenDepthFirstInto()
 */
-MAGNUM_SCENETOOLS_EXPORT void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Int>& parentDestination);
+MAGNUM_SCENETOOLS_EXPORT void parentsBreadthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Int>& parentDestination, UnsignedInt threadCount = 1);
 
 /**
 @brief Retrieve children in a depth-first order
@@ -109,11 +119,17 @@ complexity, with @f$ n @f$ being @ref Trade::SceneData::mappingBound(). The
 having no cycles (i.e., every node listed just once) and not being sparse
 (i.e., every node listed in the field reachable from the root).
 
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, the children of each object are gathered in
+parallel the same way as in @ref parentsBreadthFirst(), with the same memory
+limits. The depth-first traversal itself is always done serially and the output
+is the same regardless of the thread count used.
+
 @experimental
 
 @see @ref Trade::SceneData::hasField(), @ref parentsBreadthFirst()
 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> childrenDepthFirst(const Trade::SceneData& scene);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> childrenDepthFirst(const Trade::SceneData& scene, UnsignedInt threadCount = 1);
 
 /**
 @brief Retrieve children in a depth-first order into a pre-allocated view
@@ -129,7 +145,7 @@ in @p scene.
 @see @ref Trade::SceneData::fieldSize(SceneField) const,
     @ref parentsBreadthFirstInto()
 */
-MAGNUM_SCENETOOLS_EXPORT void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<UnsignedInt>& childCountDestination);
+MAGNUM_SCENETOOLS_EXPORT void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<UnsignedInt>& childCountDestination, UnsignedInt threadCount = 1);
 
 /**
 @brief Calculate absolute 2D transformations for given field
@@ -147,6 +163,16 @@ memory complexity, with @f$ m @f$ being size of @p fieldId and @f$ n @f$ being
 @ref Trade::SceneData::mappingBound(). The function calls
 @ref parentsBreadthFirst() internally.
 
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, @ref parentsBreadthFirst() is called with the
+same thread count and objects in each level of the hierarchy get their
+transformations calculated in parallel. The output is the same regardless of
+the thread count used. Small scenes are always processed on a single thread.
+The @p threadCount is accepted only after @p globalTransformation, so a
+@cpp {} @ce passed as the third argument is always an identity transformation
+and never a thread count. To use multiple threads without a global
+transformation, pass @cpp {} @ce as @p globalTransformation.
+
 The returned data are in the same order as object mapping entries in
 @p fieldId. Fields attached to objects without a @ref Trade::SceneField::Parent
 or to objects in loose hierarchy subtrees will have their transformation set to
@@ -160,16 +186,16 @@ single mesh:
 
 @experimental
 
-@see @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&),
+@see @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, UnsignedInt),
     @ref absoluteFieldTransformations2DInto(),
     @ref absoluteFieldTransformations3D(), @ref Trade::SceneData::hasField(),
     @ref Trade::SceneData::is2D()
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, UnsignedInt fieldId);
 #endif
 
@@ -178,15 +204,15 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations
 @m_since_latest
 
 Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
-delegates to @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&).
+delegates to @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, UnsignedInt).
 The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations2D(const Trade::SceneData& scene, Trade::SceneField field);
 #endif
 
@@ -196,19 +222,21 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix3> absoluteFieldTransformations
 @param[in]  fieldId         Field to calculate the transformations for
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
+@param[in]  threadCount     Count of threads to use. If @cpp 0 @ce, the
+    count is autodetected from the hardware concurrency.
 @m_since_latest
 
-A variant of @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&)
+A variant of @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, UnsignedInt)
 that fills existing memory instead of allocating a new array. The
 @p transformations array is expected to have the same size as the @p fieldId.
 @see @ref Trade::SceneData::fieldSize()
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix3>& transformations);
 #endif
 
@@ -217,15 +245,15 @@ MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::Sc
 @m_since_latest
 
 Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
-delegates to @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&)
+delegates to @ref absoluteFieldTransformations2DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix3>&, const Matrix3&, UnsignedInt)
 The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix3 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations, const Matrix3& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations2DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix3>& transformations);
 #endif
 
@@ -245,6 +273,14 @@ memory complexity, with @f$ m @f$ being size of @p fieldId and @f$ n @f$ being
 @ref Trade::SceneData::mappingBound(). The function calls
 @ref parentsBreadthFirst() internally.
 
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, @ref parentsBreadthFirst() is called with the
+same thread count and objects in each level of the hierarchy get their
+transformations calculated in parallel. The output is the same regardless of
+the thread count used. Small scenes are always processed on a single thread.
+See @ref absoluteFieldTransformations2D(const Trade::SceneData&, UnsignedInt, const Matrix3&, UnsignedInt)
+for why @p threadCount is accepted only after @p globalTransformation.
+
 The returned data are in the same order as object mapping entries in
 @p fieldId. Fields attached to objects without a @ref Trade::SceneField::Parent
 or to objects in loose hierarchy subtrees will have their transformation set to
@@ -258,16 +294,16 @@ single mesh:
 
 @experimental
 
-@see @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&),
+@see @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&, UnsignedInt),
     @ref absoluteFieldTransformations3DInto(),
     @ref absoluteFieldTransformations2D(), @ref Trade::SceneData::hasField(),
     @ref Trade::SceneData::is3D()
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, UnsignedInt fieldId);
 #endif
 
@@ -276,15 +312,15 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations
 @m_since_latest
 
 Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
-delegates to @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&).
+delegates to @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&, UnsignedInt).
 The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations3D(const Trade::SceneData& scene, Trade::SceneField field);
 #endif
 
@@ -294,19 +330,21 @@ MAGNUM_SCENETOOLS_EXPORT Containers::Array<Matrix4> absoluteFieldTransformations
 @param[in]  fieldId         Field to calculate the transformations for
 @param[out] transformations Where to put the calculated transformations
 @param[in]  globalTransformation Global transformation to prepend
+@param[in]  threadCount     Count of threads to use. If @cpp 0 @ce, the
+    count is autodetected from the hardware concurrency.
 @m_since_latest
 
-A variant of @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&)
+A variant of @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&, UnsignedInt)
 that fills existing memory instead of allocating a new array. The
 @p transformations array is expected to have the same size as the @p fieldId.
 @see @ref Trade::SceneData::fieldSize()
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, UnsignedInt fieldId, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
@@ -315,15 +353,15 @@ MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::Sc
 @m_since_latest
 
 Translates @p field to a field ID using @ref Trade::SceneData::fieldId() and
-delegates to @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&)
+delegates to @ref absoluteFieldTransformations3DInto(const Trade::SceneData&, UnsignedInt, const Containers::StridedArrayView1D<Matrix4>&, const Matrix4&, UnsignedInt)
 The @p field is expected to exist in @p scene.
 @experimental
 */
 #ifdef DOXYGEN_GENERATING_OUTPUT
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {});
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation = {}, UnsignedInt threadCount = 1);
 #else
 /* To avoid including Matrix4 */
-MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation);
+MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations, const Matrix4& globalTransformation, UnsignedInt threadCount = 1);
 MAGNUM_SCENETOOLS_EXPORT void absoluteFieldTransformations3DInto(const Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<Matrix4>& transformations);
 #endif
 
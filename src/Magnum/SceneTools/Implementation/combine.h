@@ -35,6 +35,7 @@
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Trade/SceneData.h"
@@ -58,37 +59,86 @@ union CombineItemView {
     Containers::MutableStringView strings;
 };
 
-template<class T> void combineCopyMappings(const Containers::ArrayView<const Trade::SceneFieldData> fields, const Containers::ArrayView<const CombineItemView> itemViews, const Containers::ArrayView<const Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> itemViewMappings) {
-    std::size_t latestMapping = 0;
-    for(std::size_t i = 0; i != fields.size(); ++i) {
-        /* If there are no shared object mappings, itemViewMappings should be
-           monotonically increasing. If it's not, it means the mapping is
-           shared with something earlier which got already copied -- skip. */
-        const std::size_t mapping = itemViewMappings[i].first();
-        if(i && mapping <= latestMapping)
-            continue;
-        latestMapping = mapping;
-
-        /* If the field has null object data, no need to copy anything. This
-           covers reserved fields but also fields of zero size. */
-        if(!fields[i].mappingData())
-            continue;
-
-        /* The additional cast to 2D has to be there in order to ensure the
-           second dimension is contiguous which Math::castInto() requires */
-        /** @todo this is an error-prone mess, fix better */
-        const Containers::StridedArrayView1D<const void> src = fields[i].mappingData();
-        const Containers::StridedArrayView2D<T> dst = Containers::arrayCast<2, T>(Containers::arrayCast<1, T>(itemViews[mapping].types));
-        if(fields[i].mappingType() == Trade::SceneMappingType::UnsignedByte)
-            Math::castInto(Containers::arrayCast<2, const UnsignedByte>(Containers::arrayCast<const UnsignedByte>(src)), dst);
-        else if(fields[i].mappingType() == Trade::SceneMappingType::UnsignedShort)
-            Math::castInto(Containers::arrayCast<2, const UnsignedShort>(Containers::arrayCast<const UnsignedShort>(src)), dst);
-        else if(fields[i].mappingType() == Trade::SceneMappingType::UnsignedInt)
-            Math::castInto(Containers::arrayCast<2, const UnsignedInt>(Containers::arrayCast<const UnsignedInt>(src)), dst);
-        else if(fields[i].mappingType() == Trade::SceneMappingType::UnsignedLong)
-            Math::castInto(Containers::arrayCast<2, const UnsignedLong>(Containers::arrayCast<const UnsignedLong>(src)), dst);
+enum class CombineCopyJobType: UnsignedByte {
+    Mapping,
+    Field,
+    String
+};
+
+struct CombineCopyJob {
+    CombineCopyJobType type;
+    UnsignedInt field;
+    std::size_t begin, end;
+};
+
+template<class T> void combineCopyMapping(const Trade::SceneFieldData& field, const Containers::StridedArrayView2D<char>& dst, const std::size_t begin, const std::size_t end) {
+    /* The additional cast to 2D has to be there in order to ensure the second
+       dimension is contiguous which Math::castInto() requires */
+    /** @todo this is an error-prone mess, fix better */
+    const Containers::StridedArrayView1D<const void> src = field.mappingData();
+    const Containers::StridedArrayView2D<T> dstT = Containers::arrayCast<2, T>(Containers::arrayCast<1, T>(dst.slice(begin, end)));
+    if(field.mappingType() == Trade::SceneMappingType::UnsignedByte)
+        Math::castInto(Containers::arrayCast<2, const UnsignedByte>(Containers::arrayCast<const UnsignedByte>(src).slice(begin, end)), dstT);
+    else if(field.mappingType() == Trade::SceneMappingType::UnsignedShort)
+        Math::castInto(Containers::arrayCast<2, const UnsignedShort>(Containers::arrayCast<const UnsignedShort>(src).slice(begin, end)), dstT);
+    else if(field.mappingType() == Trade::SceneMappingType::UnsignedInt)
+        Math::castInto(Containers::arrayCast<2, const UnsignedInt>(Containers::arrayCast<const UnsignedInt>(src).slice(begin, end)), dstT);
+    else if(field.mappingType() == Trade::SceneMappingType::UnsignedLong)
+        Math::castInto(Containers::arrayCast<2, const UnsignedLong>(Containers::arrayCast<const UnsignedLong>(src).slice(begin, end)), dstT);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+inline void combineCopy(const Trade::SceneMappingType mappingType, const Containers::ArrayView<const Trade::SceneFieldData> fields, const Containers::ArrayView<const CombineItemView> itemViews, const Containers::ArrayView<const Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> itemViewMappings, const CombineCopyJob& job) {
+    const Trade::SceneFieldData& field = fields[job.field];
+
+    /* Copy the mapping data over and cast them as necessary */
+    if(job.type == CombineCopyJobType::Mapping) {
+        const Containers::StridedArrayView2D<char> dst = itemViews[itemViewMappings[job.field].first()].types;
+        if(mappingType == Trade::SceneMappingType::UnsignedByte)
+            combineCopyMapping<UnsignedByte>(field, dst, job.begin, job.end);
+        else if(mappingType == Trade::SceneMappingType::UnsignedShort)
+            combineCopyMapping<UnsignedShort>(field, dst, job.begin, job.end);
+        else if(mappingType == Trade::SceneMappingType::UnsignedInt)
+            combineCopyMapping<UnsignedInt>(field, dst, job.begin, job.end);
+        else if(mappingType == Trade::SceneMappingType::UnsignedLong)
+            combineCopyMapping<UnsignedLong>(field, dst, job.begin, job.end);
         else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-    }
+
+    /* Copy the field data over. No special handling needed here. Bit fields
+       are never split into multiple jobs as neighboring rows may share the
+       same byte. */
+    } else if(job.type == CombineCopyJobType::Field) {
+        const Trade::SceneFieldType fieldType = field.fieldType();
+        if(fieldType == Trade::SceneFieldType::Bit) {
+            /** @todo this needs Utility::copy() for bits, which is HARD */
+            const Containers::StridedBitArrayView2D src = field.fieldBitData();
+            const Containers::MutableStridedBitArrayView2D dst = itemViews[itemViewMappings[job.field].second()].bits;
+            const std::size_t arraySize = field.fieldArraySize() ? field.fieldArraySize() : 1;
+            for(std::size_t j = job.begin; j != job.end; ++j) {
+                const Containers::StridedBitArrayView1D srcI = src[j];
+                const Containers::MutableStridedBitArrayView1D dstI = dst[j];
+                for(std::size_t k = 0; k != arraySize; ++k)
+                    dstI.set(k, srcI[k]);
+            }
+        } else {
+            /** @todo isn't there some less awful way to create a 2D view, sigh */
+            Utility::copy(Containers::arrayCast<2, const char>(field.fieldData(), sceneFieldTypeSize(fieldType)*(field.fieldArraySize() ? field.fieldArraySize() : 1)).slice(job.begin, job.end), itemViews[itemViewMappings[job.field].second()].types.slice(job.begin, job.end));
+        }
+
+    /* If the field is a string, copy also the actual string data. The size
+       was calculated when allocating and is recorded into the output view,
+       the job range is in bytes. */
+    } else if(job.type == CombineCopyJobType::String) {
+        const Containers::MutableStringView dst = itemViews[itemViewMappings[job.field].third()].strings;
+        Utility::copy(Containers::arrayView(field.stringData() + job.begin, job.end - job.begin), dst.slice(job.begin, job.end));
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Adds jobs covering [0, size) of given field, split into chunks of
+   `chunkSize` */
+inline void combineAddCopyJobs(Containers::Array<CombineCopyJob>& jobs, const CombineCopyJobType type, const UnsignedInt field, const std::size_t size, const std::size_t chunkSize) {
+    for(std::size_t begin = 0; begin < size; begin += chunkSize)
+        arrayAppend(jobs, InPlaceInit, type, field, begin, Math::min(begin + chunkSize, size));
 }
 
 /* Offsets have the total string size as the last item. If it's null-terminated
@@ -114,7 +164,7 @@ template<class T> std::size_t stringRangeNullTerminatedFieldSize(const char* str
     return max + 1;
 }
 
-inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields) {
+inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType, const UnsignedLong mappingBound, const Containers::ArrayView<const Trade::SceneFieldData> fields, const UnsignedInt threadCount = 1) {
     #ifndef CORRADE_NO_ASSERT
     /* Offset-only fields are not allowed as there's no data to refer them to.
        This has to be checked before shared scene field mapping, otherwise it'd
@@ -308,59 +358,50 @@ inline Trade::SceneData combineFields(const Trade::SceneMappingType mappingType,
     Containers::Array<char> outData = Containers::ArrayTuple{items};
     CORRADE_INTERNAL_ASSERT(!outData.deleter());
 
-    /* Copy the mapping data over and cast them as necessary */
-    if(mappingType == Trade::SceneMappingType::UnsignedByte)
-        combineCopyMappings<UnsignedByte>(fields, itemViews, itemViewMappings);
-    else if(mappingType == Trade::SceneMappingType::UnsignedShort)
-        combineCopyMappings<UnsignedShort>(fields, itemViews, itemViewMappings);
-    else if(mappingType == Trade::SceneMappingType::UnsignedInt)
-        combineCopyMappings<UnsignedInt>(fields, itemViews, itemViewMappings);
-    else if(mappingType == Trade::SceneMappingType::UnsignedLong)
-        combineCopyMappings<UnsignedLong>(fields, itemViews, itemViewMappings);
-    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-
-    /* Copy the field data over. No special handling needed here. */
+    /* Gather the copy jobs. If the work is split across multiple threads,
+       large fields are split into chunks, otherwise there's one job per
+       field. */
+    std::size_t totalSize = 0;
+    for(const Trade::SceneFieldData& field: fields)
+        totalSize += field.size();
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(totalSize, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    const std::size_t chunkSize = actualThreadCount == 1 ? ~std::size_t{} : Magnum::Implementation::ParallelForMinChunkSize;
+    Containers::Array<CombineCopyJob> jobs;
+    std::size_t latestMapping = 0;
     for(std::size_t i = 0; i != fields.size(); ++i) {
         const Trade::SceneFieldData& field = fields[i];
-        const Trade::SceneFieldType fieldType = field.fieldType();
-        if(fieldType == Trade::SceneFieldType::Bit) {
-            const Containers::StridedBitArrayView2D src = field.fieldBitData();
-
-            /* If the field has null field data, no need to copy anything. This
-               covers reserved fields but also fields of zero size. */
-            if(!src.data())
-                continue;
-
-            /** @todo this needs Utility::copy() for bits, which is HARD */
-            const Containers::MutableStridedBitArrayView2D dst = itemViews[itemViewMappings[i].second()].bits;
-            const std::size_t arraySize = field.fieldArraySize() ? field.fieldArraySize() : 1;
-            for(std::size_t j = 0, iMax = field.size(); j != iMax; ++j) {
-                const Containers::StridedBitArrayView1D srcI = src[j];
-                const Containers::MutableStridedBitArrayView1D dstI = dst[j];
-                for(std::size_t k = 0; k != arraySize; ++k)
-                    dstI.set(k, srcI[k]);
-            }
-        } else {
-            const Containers::StridedArrayView1D<const void> src = field.fieldData();
 
-            /* If the field has null field data, no need to copy anything. This
-               covers reserved fields but also fields of zero size. */
-            if(!src.data())
-                continue;
-
-            /** @todo isn't there some less awful way to create a 2D view, sigh */
-            Utility::copy(Containers::arrayCast<2, const char>(src, sceneFieldTypeSize(fieldType)*(field.fieldArraySize() ? field.fieldArraySize() : 1)), itemViews[itemViewMappings[i].second()].types);
+        /* If there are no shared object mappings, itemViewMappings should be
+           monotonically increasing. If it's not, it means the mapping is
+           shared with something earlier which got already copied -- skip. If
+           the field has null object data, no need to copy anything either.
+           This covers reserved fields but also fields of zero size. */
+        const std::size_t mapping = itemViewMappings[i].first();
+        if(!i || mapping > latestMapping) {
+            latestMapping = mapping;
+            if(field.mappingData().data())
+                combineAddCopyJobs(jobs, CombineCopyJobType::Mapping, UnsignedInt(i), field.size(), chunkSize);
+        }
 
-            /* If the field is a string, copy also the actual string data. The
-               size was calculated above and is recorded into the output
-               view. */
-            if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
-                const Containers::MutableStringView dst = itemViews[itemViewMappings[i].third()].strings;
-                Utility::copy(Containers::arrayView(field.stringData(), dst.size()), dst);
-            }
+        /* Same for null field data */
+        const Trade::SceneFieldType fieldType = field.fieldType();
+        if(fieldType == Trade::SceneFieldType::Bit) {
+            if(field.fieldBitData().data())
+                combineAddCopyJobs(jobs, CombineCopyJobType::Field, UnsignedInt(i), field.size(), ~std::size_t{});
+        } else if(field.fieldData().data()) {
+            combineAddCopyJobs(jobs, CombineCopyJobType::Field, UnsignedInt(i), field.size(), chunkSize);
+            if(Trade::Implementation::isSceneFieldTypeString(fieldType))
+                combineAddCopyJobs(jobs, CombineCopyJobType::String, UnsignedInt(i), itemViews[itemViewMappings[i].third()].strings.size(), chunkSize);
         }
     }
 
+    /* Execute the jobs. With a single thread it's all done on the calling
+       thread in the order the jobs were added. */
+    Magnum::Implementation::parallelFor(jobs.size(), actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            combineCopy(mappingType, fields, itemViews, itemViewMappings, jobs[i]);
+    });
+
     /* Map the fields to the new data */
     Containers::Array<Trade::SceneFieldData> outFields{ValueInit, fields.size()};
     for(std::size_t i = 0; i != fields.size(); ++i) {
@@ -0,0 +1,48 @@
+#ifndef Magnum_SceneTools_Implementation_copyPermuted_h
+#define Magnum_SceneTools_Implementation_copyPermuted_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace SceneTools { namespace Implementation {
+
+/* Copies rows of src to dst in order given by the permutation. The second
+   dimension is expected to be contiguous for both, which is always the case
+   for scene mapping and field views. */
+inline void copyPermuted(const Containers::StridedArrayView2D<const char>& src, const Containers::ArrayView<const UnsignedInt> permutation, const Containers::StridedArrayView2D<char>& dst) {
+    CORRADE_INTERNAL_ASSERT(src.size() == dst.size() && src.isContiguous<1>() && dst.isContiguous<1>());
+    const std::size_t rowSize = src.size()[1];
+    for(std::size_t i = 0; i != permutation.size(); ++i)
+        std::memcpy(dst[i].data(), src[permutation[i]].data(), rowSize);
+}
+
+}}}
+
+#endif
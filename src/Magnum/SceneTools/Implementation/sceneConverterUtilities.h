@@ -26,6 +26,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm> /* std::sort() */
 #include <cctype> /* std::isupper() */
 #include <sstream>
 #include <unordered_map> /* sceneFieldNames */
@@ -160,6 +161,11 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
         std::size_t dataSize;
         Trade::DataFlags dataFlags;
         Containers::String name;
+        /* Mesh instance count, count of unique mesh and material combinations
+           among them and instance count of the largest combination */
+        std::size_t meshInstanceCount;
+        std::size_t meshInstanceGroupCount;
+        std::size_t meshInstanceGroupMaxSize;
         /* Populated only if --object-hierarchy is set */
         Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> childrenDepthFirst;
     };
@@ -173,6 +179,35 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
         Containers::String name;
     };
 
+    /* With --probe, only data counts and image properties are printed. Nothing
+       except image headers gets imported. */
+    if(args.isSet("probe")) {
+        bool error = false;
+        Containers::Array<Trade::Implementation::ImageInfo> imageInfos;
+        if(args.isSet("info") || args.isSet("info-images"))
+            imageInfos = Trade::Implementation::imageInfo(importer, error, importTime, true);
+
+        const Containers::Pair<const char*, UnsignedLong> counts[]{
+            {"Scenes:", importer.sceneCount()},
+            {"Objects:", importer.objectCount()},
+            {"Animations:", importer.animationCount()},
+            {"2D skins:", importer.skin2DCount()},
+            {"3D skins:", importer.skin3DCount()},
+            {"Lights:", importer.lightCount()},
+            {"Cameras:", importer.cameraCount()},
+            {"Materials:", importer.materialCount()},
+            {"Meshes:", importer.meshCount()},
+            {"Textures:", importer.textureCount()},
+        };
+        for(const Containers::Pair<const char*, UnsignedLong>& count: counts) {
+            if(!count.second()) continue;
+            Debug{useColor} << Debug::boldColor(Debug::Color::Default) << count.first() << Debug::resetColor << count.second();
+        }
+
+        Trade::Implementation::printImageInfo(useColor, imageInfos, nullptr, nullptr, nullptr, true);
+        return error;
+    }
+
     /* Parse everything first to avoid errors interleaved with output */
     bool error = false;
 
@@ -231,11 +266,33 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
             if(args.isSet("info") || args.isSet("info-scenes")) for(UnsignedInt j = 0; j != scene->fieldCount(); ++j) {
                 const Trade::SceneField name = scene->fieldName(j);
 
-                if(name == Trade::SceneField::Mesh) for(const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& meshMaterial: scene->meshesMaterialsAsArray()) {
-                    if(meshMaterial.second().first() < meshReferenceCount.size())
-                        ++meshReferenceCount[meshMaterial.second().first()];
-                    if(UnsignedInt(meshMaterial.second().second()) < materialReferenceCount.size())
-                        ++materialReferenceCount[meshMaterial.second().second()];
+                if(name == Trade::SceneField::Mesh) {
+                    Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene->meshesMaterialsAsArray();
+                    for(const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& meshMaterial: meshesMaterials) {
+                        if(meshMaterial.second().first() < meshReferenceCount.size())
+                            ++meshReferenceCount[meshMaterial.second().first()];
+                        if(UnsignedInt(meshMaterial.second().second()) < materialReferenceCount.size())
+                            ++materialReferenceCount[meshMaterial.second().second()];
+                    }
+
+                    /* Instancing statistics. Sort by the mesh and material
+                       and count the runs, which is the same as what
+                       SceneTools::groupMeshInstances() would produce, but
+                       without copying the whole scene. */
+                    std::sort(meshesMaterials.begin(), meshesMaterials.end(), [](const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& a, const Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>& b) {
+                        return a.second().first() < b.second().first() ||
+                            (a.second().first() == b.second().first() &&
+                             a.second().second() < b.second().second());
+                    });
+                    info.meshInstanceCount = meshesMaterials.size();
+                    for(std::size_t k = 0, runBegin = 0; k != meshesMaterials.size(); ++k) {
+                        if(k + 1 != meshesMaterials.size() && meshesMaterials[k + 1].second() == meshesMaterials[k].second())
+                            continue;
+
+                        ++info.meshInstanceGroupCount;
+                        info.meshInstanceGroupMaxSize = Math::max(info.meshInstanceGroupMaxSize, k + 1 - runBegin);
+                        runBegin = k + 1;
+                    }
                 }
 
                 if(name == Trade::SceneField::Skin) for(const Containers::Pair<UnsignedInt, UnsignedInt> skin: scene->skinsAsArray()) {
@@ -607,7 +664,7 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
 
     Containers::Array<Trade::Implementation::ImageInfo> imageInfos;
     if(args.isSet("info") || args.isSet("info-images")) {
-        imageInfos = Trade::Implementation::imageInfo(importer, error, importTime);
+        imageInfos = Trade::Implementation::imageInfo(importer, error, importTime, false);
     }
 
     /* Print default scene also if sceneInfos is empty (for example due to an
@@ -680,6 +737,14 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
             }
         }
 
+        if(info.meshInstanceCount)
+            d << Debug::newline << "  Mesh instances:" << info.meshInstanceCount
+                << "in" << info.meshInstanceGroupCount
+                << (info.meshInstanceGroupCount == 1 ?
+                    "unique mesh and material combination, at most" :
+                    "unique mesh and material combinations, at most")
+                << info.meshInstanceGroupMaxSize << "per combination";
+
         if(args.isSet("object-hierarchy") && objectInfos) {
             d << Debug::newline << "  Object hierarchy:";
 
@@ -1156,7 +1221,7 @@ bool printInfo(const Debug::Flags useColor, const bool useColor24, const Utility
             << Debug::resetColor << Debug::nospace << "}";
     }
 
-    Trade::Implementation::printImageInfo(useColor, imageInfos, image1DReferenceCount, image2DReferenceCount, image3DReferenceCount);
+    Trade::Implementation::printImageInfo(useColor, imageInfos, image1DReferenceCount, image2DReferenceCount, image3DReferenceCount, false);
 
     return error;
 }
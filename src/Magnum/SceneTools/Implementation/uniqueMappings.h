@@ -0,0 +1,108 @@
+#ifndef Magnum_SceneTools_Implementation_uniqueMappings_h
+#define Magnum_SceneTools_Implementation_uniqueMappings_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/ArrayTuple.h>
+
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Implementation {
+
+struct MappingView {
+    const void* data;
+    std::size_t size;
+    std::ptrdiff_t stride;
+};
+
+inline bool operator==(const MappingView& a, const MappingView& b) {
+    return a.data == b.data && a.size == b.size && a.stride == b.stride;
+}
+
+/* Fibonacci hashing of the pointer, size and stride combined, taking the top
+   `bits` bits of the product */
+inline std::size_t hashMappingView(const MappingView& view, const UnsignedInt bits) {
+    UnsignedLong hash = UnsignedLong(reinterpret_cast<std::uintptr_t>(view.data));
+    hash ^= UnsignedLong(view.size) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    hash ^= UnsignedLong(view.stride) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return std::size_t((hash*0x9e3779b97f4a7c15ull) >> (64 - bits));
+}
+
+/* Assigns an ID to each unique mapping view (pointer, size, stride) in the
+   scene and saves it for every field into `mappingIds`, with the IDs being
+   assigned in order the mappings are first encountered. Empty fields make no
+   sense to include for sharing and get ~UnsignedInt{}. Returns the count of
+   unique mappings. Uses an open-addressing hash table with linear probing
+   that's at least twice as large as the field count, so with the hash above
+   the probe sequences are short even for scenes with thousands of fields. */
+inline UnsignedInt uniqueMappingsInto(const Trade::SceneData& scene, const Containers::ArrayView<UnsignedInt> mappingIds) {
+    const UnsignedInt fieldCount = scene.fieldCount();
+    CORRADE_INTERNAL_ASSERT(mappingIds.size() == fieldCount);
+
+    UnsignedInt bits = 1;
+    while((std::size_t{1} << bits) < 2*std::size_t(fieldCount))
+        ++bits;
+
+    /* Each slot contains ID of the first field that has given mapping view,
+       or ~UnsignedInt{} if it's empty */
+    Containers::ArrayView<MappingView> views;
+    Containers::ArrayView<UnsignedInt> slots;
+    Containers::ArrayTuple storage{
+        {NoInit, fieldCount, views},
+        {NoInit, std::size_t{1} << bits, slots}
+    };
+    for(UnsignedInt& slot: slots)
+        slot = ~UnsignedInt{};
+    const std::size_t slotMask = slots.size() - 1;
+
+    UnsignedInt uniqueCount = 0;
+    for(UnsignedInt i = 0; i != fieldCount; ++i) {
+        if(!scene.fieldSize(i)) {
+            mappingIds[i] = ~UnsignedInt{};
+            continue;
+        }
+
+        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
+        views[i] = {mapping.data(), mapping.size()[0], mapping.stride()[0]};
+        for(std::size_t slot = hashMappingView(views[i], bits); ; slot = (slot + 1) & slotMask) {
+            if(slots[slot] == ~UnsignedInt{}) {
+                slots[slot] = i;
+                mappingIds[i] = uniqueCount++;
+                break;
+            }
+            if(views[slots[slot]] == views[i]) {
+                mappingIds[i] = mappingIds[slots[slot]];
+                break;
+            }
+        }
+    }
+
+    return uniqueCount;
+}
+
+}}}
+
+#endif
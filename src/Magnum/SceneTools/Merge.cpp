@@ -0,0 +1,473 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Merge.h"
+
+#include <map>
+#include <algorithm>
+#include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneTools/Implementation/uniqueMappings.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+/* Fields that can be remapped through a table, in order they're stored in
+   the per-scene remapping table list */
+constexpr Trade::SceneField RemappableFields[]{
+    Trade::SceneField::Mesh,
+    Trade::SceneField::MeshMaterial,
+    Trade::SceneField::Light,
+    Trade::SceneField::Camera,
+    Trade::SceneField::Skin
+};
+
+UnsignedInt remappableFieldIndex(const Trade::SceneField name) {
+    for(UnsignedInt i = 0; i != Containers::arraySize(RemappableFields); ++i)
+        if(RemappableFields[i] == name) return i;
+    return ~UnsignedInt{};
+}
+
+struct MergedField {
+    Trade::SceneField name;
+    Trade::SceneFieldType type;
+    UnsignedShort arraySize;
+    Trade::SceneFieldFlags flags;
+    /* Mapping class, fields with the same class share the mapping */
+    UnsignedInt mappingClass;
+    /* Index in RemappableFields or ~UnsignedInt{} */
+    UnsignedInt remappableIndex;
+    std::size_t size;
+};
+
+/* Per-scene properties of each merged field */
+struct MergedSceneField {
+    /* ID of the field in the scene or ~UnsignedInt{} if not present */
+    UnsignedInt fieldId;
+    /* ID of the field the mapping is taken from, different from fieldId if
+       the field is filled with defaults for the scene, ~UnsignedInt{} if
+       there's no entries for the scene */
+    UnsignedInt mappingFieldId;
+    /* Offset of the scene entries in the merged field */
+    std::size_t offset;
+};
+
+/* Converts unsigned index fields to 32 bits, optionally remapping them */
+template<class T> void mergeUnsignedIndicesInto(const Containers::StridedArrayView1D<const void>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst, const Containers::StridedArrayView1D<const UnsignedInt>* const table) {
+    const Containers::StridedArrayView1D<const T> srcT = Containers::arrayCast<const T>(src);
+    if(table) for(std::size_t i = 0; i != srcT.size(); ++i)
+        dst[i] = (*table)[srcT[i]];
+    else for(std::size_t i = 0; i != srcT.size(); ++i)
+        dst[i] = srcT[i];
+}
+
+/* Converts signed index fields to 32 bits, either remapping them or adding
+   an offset, while keeping negative values as -1 */
+template<class T> void mergeSignedIndicesInto(const Containers::StridedArrayView1D<const void>& src, const Containers::StridedArrayView1D<Int>& dst, const Containers::StridedArrayView1D<const UnsignedInt>* const table, const Int offset) {
+    const Containers::StridedArrayView1D<const T> srcT = Containers::arrayCast<const T>(src);
+    for(std::size_t i = 0; i != srcT.size(); ++i) {
+        const T index = srcT[i];
+        if(index < 0)
+            dst[i] = -1;
+        else if(table)
+            dst[i] = Int((*table)[index]);
+        else
+            dst[i] = Int(index) + offset;
+    }
+}
+
+#ifndef CORRADE_NO_ASSERT
+/* Returns one more than the max non-negative index in given field */
+template<class T> std::size_t mergeIndexBound(const Containers::StridedArrayView1D<const void>& src) {
+    std::size_t bound = 0;
+    for(const T i: Containers::arrayCast<const T>(src)) {
+        const Long index = i;
+        if(index >= 0 && std::size_t(index) >= bound) bound = std::size_t(index) + 1;
+    }
+    return bound;
+}
+
+std::size_t mergeIndexBound(const Trade::SceneData& scene, const UnsignedInt fieldId) {
+    const Containers::StridedArrayView1D<const void> src = scene.field(fieldId);
+    switch(scene.fieldType(fieldId)) {
+        case Trade::SceneFieldType::UnsignedByte: return mergeIndexBound<UnsignedByte>(src);
+        case Trade::SceneFieldType::UnsignedShort: return mergeIndexBound<UnsignedShort>(src);
+        case Trade::SceneFieldType::UnsignedInt: return mergeIndexBound<UnsignedInt>(src);
+        case Trade::SceneFieldType::Byte: return mergeIndexBound<Byte>(src);
+        case Trade::SceneFieldType::Short: return mergeIndexBound<Short>(src);
+        case Trade::SceneFieldType::Int: return mergeIndexBound<Int>(src);
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+#endif
+
+template<class T> void mergeFillInto(const Containers::StridedArrayView2D<char>& dst, const T& value) {
+    for(T& i: Containers::arrayCast<1, T>(dst))
+        i = value;
+}
+
+/* Fills entries of a field that's not present in given scene but has to share
+   the mapping with a field that is */
+void mergeFillDefaultsInto(const Trade::SceneField name, const Trade::SceneFieldType type, const Containers::StridedArrayView2D<char>& dst) {
+    if(name == Trade::SceneField::MeshMaterial)
+        mergeFillInto(dst, Int{-1});
+    else if(name == Trade::SceneField::Translation) {
+        for(Containers::StridedArrayView1D<char> i: dst)
+            for(char& j: i) j = 0;
+    } else if(name == Trade::SceneField::Rotation) {
+        if(type == Trade::SceneFieldType::Complex)
+            mergeFillInto(dst, Complex{});
+        else if(type == Trade::SceneFieldType::Complexd)
+            mergeFillInto(dst, Complexd{});
+        else if(type == Trade::SceneFieldType::Quaternion)
+            mergeFillInto(dst, Quaternion{});
+        else if(type == Trade::SceneFieldType::Quaterniond)
+            mergeFillInto(dst, Quaterniond{});
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    } else if(name == Trade::SceneField::Scaling) {
+        if(type == Trade::SceneFieldType::Vector2)
+            mergeFillInto(dst, Vector2{1.0f});
+        else if(type == Trade::SceneFieldType::Vector2d)
+            mergeFillInto(dst, Vector2d{1.0});
+        else if(type == Trade::SceneFieldType::Vector3)
+            mergeFillInto(dst, Vector3{1.0f});
+        else if(type == Trade::SceneFieldType::Vector3d)
+            mergeFillInto(dst, Vector3d{1.0});
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Copies data of a single field from a single scene to the output */
+void mergeFieldInto(const Trade::SceneData& scene, const MergedField& field, const MergedSceneField& sceneField, const Containers::StridedArrayView1D<const UnsignedInt>* const table, const UnsignedInt objectOffset, const Containers::StridedArrayView2D<char>& dst) {
+    /* The field isn't present in the scene, but shares a mapping with a field
+       that is. Fill it with defaults. */
+    if(sceneField.fieldId == ~UnsignedInt{}) {
+        mergeFillDefaultsInto(field.name, field.type, dst);
+        return;
+    }
+
+    const Containers::StridedArrayView1D<const void> src = scene.field(sceneField.fieldId);
+    const Trade::SceneFieldType srcType = scene.fieldType(sceneField.fieldId);
+
+    /* Parent and material IDs, converted to Int and offset / remapped */
+    if(field.name == Trade::SceneField::Parent ||
+       field.name == Trade::SceneField::MeshMaterial) {
+        const Containers::StridedArrayView1D<Int> dstInt = Containers::arrayCast<1, Int>(dst);
+        const Int offset = field.name == Trade::SceneField::Parent ? Int(objectOffset) : 0;
+        if(srcType == Trade::SceneFieldType::Byte)
+            mergeSignedIndicesInto<Byte>(src, dstInt, table, offset);
+        else if(srcType == Trade::SceneFieldType::Short)
+            mergeSignedIndicesInto<Short>(src, dstInt, table, offset);
+        else if(srcType == Trade::SceneFieldType::Int)
+            mergeSignedIndicesInto<Int>(src, dstInt, table, offset);
+        else if(srcType == Trade::SceneFieldType::Long)
+            mergeSignedIndicesInto<Long>(src, dstInt, table, offset);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    /* Other index fields, converted to UnsignedInt and remapped */
+    } else if(field.remappableIndex != ~UnsignedInt{}) {
+        const Containers::StridedArrayView1D<UnsignedInt> dstUnsignedInt = Containers::arrayCast<1, UnsignedInt>(dst);
+        if(srcType == Trade::SceneFieldType::UnsignedByte)
+            mergeUnsignedIndicesInto<UnsignedByte>(src, dstUnsignedInt, table);
+        else if(srcType == Trade::SceneFieldType::UnsignedShort)
+            mergeUnsignedIndicesInto<UnsignedShort>(src, dstUnsignedInt, table);
+        else if(srcType == Trade::SceneFieldType::UnsignedInt)
+            mergeUnsignedIndicesInto<UnsignedInt>(src, dstUnsignedInt, table);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    /* Everything else is copied as-is */
+    } else Utility::copy(Containers::arrayCast<2, const char>(src, dst.size()[1]), dst);
+}
+
+}
+
+Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, const Containers::ArrayView<const Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>> indexRemapping, const UnsignedInt threadCount) {
+    const std::size_t sceneCount = scenes.size();
+    constexpr std::size_t remappableFieldCount = Containers::arraySize(RemappableFields);
+
+    /* Calculate object offsets of all scenes */
+    Containers::Array<UnsignedLong> objectOffsets{NoInit, sceneCount + 1};
+    objectOffsets[0] = 0;
+    for(std::size_t i = 0; i != sceneCount; ++i)
+        objectOffsets[i + 1] = objectOffsets[i] + scenes[i].mappingBound();
+    const UnsignedLong mappingBound = objectOffsets[sceneCount];
+    CORRADE_ASSERT(mappingBound <= 0xffffffffull,
+        "SceneTools::merge(): expected total mapping bound to fit into 32 bits but got" << mappingBound, (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    /* Gather the remapping tables for each scene */
+    Containers::Array<const Containers::StridedArrayView1D<const UnsignedInt>*> tables{ValueInit, sceneCount*remappableFieldCount};
+    for(std::size_t i = 0; i != indexRemapping.size(); ++i) {
+        const Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>& remapping = indexRemapping[i];
+        CORRADE_ASSERT(remapping.first() < sceneCount,
+            "SceneTools::merge(): index remapping" << i << "references scene" << remapping.first() << "but only" << sceneCount << "scenes were passed", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        const UnsignedInt remappableIndex = remappableFieldIndex(remapping.second());
+        CORRADE_ASSERT(remappableIndex != ~UnsignedInt{},
+            "SceneTools::merge(): index remapping" << i << "references field" << remapping.second() << "which can't be remapped", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        const Containers::StridedArrayView1D<const UnsignedInt>*& table = tables[remapping.first()*remappableFieldCount + remappableIndex];
+        CORRADE_ASSERT(!table,
+            "SceneTools::merge(): index remapping" << i << "references" << remapping.second() << "of scene" << remapping.first() << "which was already remapped", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        table = &remapping.third();
+    }
+
+    /* Collect unique fields from all scenes in order they're first
+       encountered */
+    Containers::Array<MergedField> fields;
+    std::map<Trade::SceneField, UnsignedInt> fieldIds;
+    for(std::size_t i = 0; i != sceneCount; ++i) {
+        const Trade::SceneData& scene = scenes[i];
+        for(UnsignedInt j = 0; j != scene.fieldCount(); ++j) {
+            const Trade::SceneField name = scene.fieldName(j);
+            Trade::SceneFieldType type = scene.fieldType(j);
+            CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(type),
+                "SceneTools::merge(): merging string fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            CORRADE_ASSERT(type != Trade::SceneFieldType::Bit,
+                "SceneTools::merge(): merging bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+            /* Index fields are converted to 32 bits */
+            const UnsignedInt remappableIndex = remappableFieldIndex(name);
+            if(name == Trade::SceneField::Parent ||
+               name == Trade::SceneField::MeshMaterial)
+                type = Trade::SceneFieldType::Int;
+            else if(remappableIndex != ~UnsignedInt{})
+                type = Trade::SceneFieldType::UnsignedInt;
+
+            const std::pair<std::map<Trade::SceneField, UnsignedInt>::iterator, bool> inserted = fieldIds.emplace(name, UnsignedInt(fields.size()));
+            if(inserted.second) {
+                arrayAppend(fields, InPlaceInit, name, type, scene.fieldArraySize(j), Trade::SceneFieldFlags{}, 0u, remappableIndex, std::size_t{});
+                continue;
+            }
+
+            #ifndef CORRADE_NO_ASSERT
+            const MergedField& field = fields[inserted.first->second];
+            CORRADE_ASSERT(field.type == type && field.arraySize == scene.fieldArraySize(j),
+                "SceneTools::merge(): expected" << name << "in scene" << i << "to be" << field.type << "with array size" << field.arraySize << "but got" << type << "with array size" << scene.fieldArraySize(j), (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            #endif
+        }
+    }
+
+    /* Gather per-scene properties of all fields. Besides fields present in the
+       scene, a field that's present elsewhere and is required to share the
+       mapping with a field that is in this scene takes the mapping from it
+       and is filled with defaults. */
+    const std::size_t fieldCount = fields.size();
+    Containers::Array<MergedSceneField> sceneFields{NoInit, sceneCount*fieldCount};
+    Containers::Array<UnsignedInt> mappingIds;
+    Containers::Array<Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>> mappingClasses{NoInit, fieldCount};
+    Containers::Array<UnsignedInt> fieldMappingClasses{ValueInit, fieldCount};
+    std::size_t totalSize = 0;
+    for(std::size_t i = 0; i != sceneCount; ++i) {
+        const Trade::SceneData& scene = scenes[i];
+        const Containers::ArrayView<MergedSceneField> merged = sceneFields.sliceSize(i*fieldCount, fieldCount);
+        for(MergedSceneField& field: merged) {
+            field.fieldId = ~UnsignedInt{};
+            field.mappingFieldId = ~UnsignedInt{};
+        }
+        for(UnsignedInt j = 0; j != scene.fieldCount(); ++j) {
+            MergedSceneField& field = merged[fieldIds.find(scene.fieldName(j))->second];
+            field.fieldId = j;
+            field.mappingFieldId = j;
+        }
+
+        const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+        Containers::Optional<UnsignedInt> trsFieldId = scene.findFieldId(Trade::SceneField::Translation);
+        if(!trsFieldId) trsFieldId = scene.findFieldId(Trade::SceneField::Rotation);
+        if(!trsFieldId) trsFieldId = scene.findFieldId(Trade::SceneField::Scaling);
+        for(std::size_t j = 0; j != fieldCount; ++j) {
+            MergedSceneField& field = merged[j];
+            if(field.fieldId != ~UnsignedInt{})
+                continue;
+
+            const Trade::SceneField name = fields[j].name;
+            if(name == Trade::SceneField::MeshMaterial && meshFieldId)
+                field.mappingFieldId = *meshFieldId;
+            else if((name == Trade::SceneField::Translation ||
+                     name == Trade::SceneField::Rotation ||
+                     name == Trade::SceneField::Scaling) && trsFieldId)
+                field.mappingFieldId = *trsFieldId;
+            else CORRADE_ASSERT(name != Trade::SceneField::Mesh || !scene.hasField(Trade::SceneField::MeshMaterial),
+                "SceneTools::merge(): scene" << i << "has a" << Trade::SceneField::MeshMaterial << "field without" << Trade::SceneField::Mesh << "but other scenes have" << Trade::SceneField::Mesh, (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        }
+
+        /* Calculate offsets of the scene entries in the merged fields, and
+           check that remapped indices are in bounds */
+        for(std::size_t j = 0; j != fieldCount; ++j) {
+            MergedSceneField& field = merged[j];
+            field.offset = fields[j].size;
+            if(field.mappingFieldId == ~UnsignedInt{})
+                continue;
+
+            const std::size_t size = scene.fieldSize(field.mappingFieldId);
+            fields[j].size += size;
+            totalSize += size;
+
+            #ifndef CORRADE_NO_ASSERT
+            if(fields[j].remappableIndex != ~UnsignedInt{} && field.fieldId != ~UnsignedInt{}) {
+                if(const Containers::StridedArrayView1D<const UnsignedInt>* const table = tables[i*remappableFieldCount + fields[j].remappableIndex]) {
+                    const std::size_t bound = mergeIndexBound(scene, field.fieldId);
+                    CORRADE_ASSERT(bound <= table->size(),
+                        "SceneTools::merge(): index" << bound - 1 << "out of range for" << table->size() << "remapping table entries in" << fields[j].name << "of scene" << i, (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+                }
+            }
+            #endif
+        }
+
+        /* Refine the mapping classes. Fields stay in the same class only if
+           they share the mapping in all scenes, which is done by sorting
+           them by the class from previous scenes and the mapping ID in this
+           scene, and assigning a new class to each unique pair. Empty and
+           not present fields have the mapping ID ~UnsignedInt{}. */
+        arrayResize(mappingIds, NoInit, scene.fieldCount());
+        Implementation::uniqueMappingsInto(scene, mappingIds);
+        for(std::size_t j = 0; j != fieldCount; ++j) {
+            const UnsignedInt mappingFieldId = merged[j].mappingFieldId;
+            mappingClasses[j] = {fieldMappingClasses[j], mappingFieldId == ~UnsignedInt{} ? ~UnsignedInt{} : mappingIds[mappingFieldId], UnsignedInt(j)};
+        }
+        std::sort(mappingClasses.begin(), mappingClasses.end(), [](const Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>& a, const Containers::Triple<UnsignedInt, UnsignedInt, UnsignedInt>& b) {
+            return a.first() < b.first() || (a.first() == b.first() && a.second() < b.second());
+        });
+        UnsignedInt mappingClass = 0;
+        for(std::size_t j = 0; j != fieldCount; ++j) {
+            if(j && (mappingClasses[j].first() != mappingClasses[j - 1].first() || mappingClasses[j].second() != mappingClasses[j - 1].second()))
+                ++mappingClass;
+            fieldMappingClasses[mappingClasses[j].third()] = mappingClass;
+        }
+    }
+
+    /* Calculate the output flags. Ordered mapping stays ordered if it's
+       ordered in all scenes, implicit mapping stays implicit if it's implicit
+       in all scenes and contiguous. */
+    for(std::size_t i = 0; i != fieldCount; ++i) {
+        MergedField& field = fields[i];
+        field.mappingClass = fieldMappingClasses[i];
+
+        bool ordered = true, implicit = true;
+        UnsignedLong nextObject = 0;
+        for(std::size_t j = 0; j != sceneCount; ++j) {
+            const Trade::SceneData& scene = scenes[j];
+            const MergedSceneField& sceneField = sceneFields[j*fieldCount + i];
+            if(sceneField.fieldId != ~UnsignedInt{})
+                field.flags |= scene.fieldFlags(sceneField.fieldId) & Trade::SceneFieldFlag::MultiEntry;
+            if(sceneField.mappingFieldId == ~UnsignedInt{} || !scene.fieldSize(sceneField.mappingFieldId))
+                continue;
+
+            const Trade::SceneFieldFlags flags = scene.fieldFlags(sceneField.mappingFieldId);
+            if(!(flags >= Trade::SceneFieldFlag::OrderedMapping))
+                ordered = false;
+            if(!(flags >= Trade::SceneFieldFlag::ImplicitMapping) || objectOffsets[j] != nextObject)
+                implicit = false;
+            nextObject = objectOffsets[j] + scene.fieldSize(sceneField.mappingFieldId);
+        }
+        if(implicit)
+            field.flags |= Trade::SceneFieldFlag::ImplicitMapping;
+        else if(ordered)
+            field.flags |= Trade::SceneFieldFlag::OrderedMapping;
+    }
+
+    /* Allocate everything in a single allocation, with one mapping view for
+       each mapping class */
+    const std::size_t mappingClassCount = fieldCount ? *std::max_element(fieldMappingClasses.begin(), fieldMappingClasses.end()) + 1 : 0;
+    Containers::Array<UnsignedInt> mappingClassFields{NoInit, mappingClassCount};
+    for(std::size_t i = fieldCount; i != 0; --i)
+        mappingClassFields[fields[i - 1].mappingClass] = i - 1;
+    Containers::Array<Containers::StridedArrayView2D<char>> mappingViews{ValueInit, mappingClassCount};
+    Containers::Array<Containers::StridedArrayView2D<char>> fieldViews{ValueInit, fieldCount};
+    Containers::Array<Containers::ArrayTuple::Item> items;
+    arrayReserve(items, mappingClassCount + fieldCount);
+    for(std::size_t i = 0; i != mappingClassCount; ++i)
+        arrayAppend(items, InPlaceInit, NoInit, fields[mappingClassFields[i]].size, sizeof(UnsignedInt), alignof(UnsignedInt), mappingViews[i]);
+    for(const MergedField& field: fields)
+        arrayAppend(items, InPlaceInit, NoInit, field.size, Trade::sceneFieldTypeSize(field.type)*(field.arraySize ? field.arraySize : 1), Trade::sceneFieldTypeAlignment(field.type), fieldViews[&field - fields.data()]);
+    Containers::Array<char> data = Containers::ArrayTuple{items};
+    CORRADE_INTERNAL_ASSERT(!data.deleter());
+
+    /* Copy the mappings and field data of all scenes. The scenes write to
+       disjoint ranges of the output, so they can be processed in parallel.
+       The thread count is decided based on the total count of entries to
+       copy, not the scene count, so a few huge scenes benefit as well but
+       many tiny scenes don't cause threads to be spawned for nothing. */
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(totalSize, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Magnum::Implementation::parallelFor(sceneCount, actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const Trade::SceneData& scene = scenes[i];
+            const Containers::ArrayView<const MergedSceneField> merged = sceneFields.sliceSize(i*fieldCount, fieldCount);
+            const UnsignedInt objectOffset = UnsignedInt(objectOffsets[i]);
+
+            for(std::size_t j = 0; j != mappingClassCount; ++j) {
+                const MergedSceneField& field = merged[mappingClassFields[j]];
+                if(field.mappingFieldId == ~UnsignedInt{})
+                    continue;
+
+                const Containers::StridedArrayView1D<UnsignedInt> dst = Containers::arrayCast<1, UnsignedInt>(mappingViews[j]).sliceSize(field.offset, scene.fieldSize(field.mappingFieldId));
+                scene.mappingInto(field.mappingFieldId, dst);
+                for(UnsignedInt& object: dst)
+                    object += objectOffset;
+            }
+
+            for(std::size_t j = 0; j != fieldCount; ++j) {
+                const MergedSceneField& field = merged[j];
+                if(field.mappingFieldId == ~UnsignedInt{})
+                    continue;
+
+                mergeFieldInto(scene, fields[j], field,
+                    fields[j].remappableIndex == ~UnsignedInt{} ? nullptr : tables[i*remappableFieldCount + fields[j].remappableIndex],
+                    objectOffset,
+                    fieldViews[j].sliceSize(field.offset, scene.fieldSize(field.mappingFieldId)));
+            }
+        }
+    });
+
+    Containers::Array<Trade::SceneFieldData> outFields{NoInit, fieldCount};
+    for(std::size_t i = 0; i != fieldCount; ++i) {
+        const MergedField& field = fields[i];
+        outFields[i] = Trade::SceneFieldData{field.name,
+            mappingViews[field.mappingClass],
+            field.type, fieldViews[i],
+            field.arraySize, field.flags};
+    }
+
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, mappingBound, Utility::move(data), Utility::move(outFields)};
+}
+
+Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, const std::initializer_list<Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>> indexRemapping, const UnsignedInt threadCount) {
+    return merge(scenes, Containers::arrayView(indexRemapping), threadCount);
+}
+
+Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, const UnsignedInt threadCount) {
+    return merge(scenes, nullptr, threadCount);
+}
+
+}}
@@ -0,0 +1,127 @@
+#ifndef Magnum_SceneTools_Merge_h
+#define Magnum_SceneTools_Merge_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::merge()
+ * @m_since_latest
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Iterable.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Merge multiple scenes together
+@param scenes           Scenes to merge
+@param indexRemapping   Scene ID, field and index remapping table triplets
+@param threadCount      Count of threads to use. Use @cpp 0 @ce to autodetect
+    from the hardware concurrency.
+@m_since_latest
+
+Concatenates entries of all fields from all @p scenes into a single
+@ref Trade::SceneData, in the order the fields are first encountered in the
+scenes. Objects of each scene are offset by a sum of
+@ref Trade::SceneData::mappingBound() of all scenes before, which is also the
+@ref Trade::SceneData::mappingBound() of the output, and the
+@ref Trade::SceneField::Parent field is offset accordingly as well, with
+@cpp -1 @ce staying unchanged. The output mapping type is always
+@ref Trade::SceneMappingType::UnsignedInt, which means the total mapping bound
+is expected to fit into 32 bits.
+
+The @ref Trade::SceneField::Mesh, @relativeref{Trade::SceneField,MeshMaterial},
+@relativeref{Trade::SceneField,Light}, @relativeref{Trade::SceneField,Camera}
+and @relativeref{Trade::SceneField,Skin} fields are by default copied as-is.
+If the scenes reference a combined list of meshes, materials etc., their
+indices can be remapped through tables passed in @p indexRemapping, where
+each item is a scene ID, one of the above fields and a table that maps an
+index in given scene to an index in the output. Each scene and field
+combination is expected to be listed at most once and all indices in the
+field are expected to be in bounds for the table. A @cpp -1 @ce in
+@relativeref{Trade::SceneField,MeshMaterial} stays unchanged. The
+@ref Trade::SceneField::Parent field is always converted to
+@ref Trade::SceneFieldType::Int, @relativeref{Trade::SceneField,MeshMaterial}
+to @ref Trade::SceneFieldType::Int as well and the remaining above fields to
+@ref Trade::SceneFieldType::UnsignedInt, all other fields of the same name are
+expected to have the same type and array size in all scenes.
+
+If fields share their object mapping in all scenes they're present in, the
+sharing is preserved in the output. If some scenes contain just a subset of
+@ref Trade::SceneField::Translation, @relativeref{Trade::SceneField,Rotation}
+and @relativeref{Trade::SceneField,Scaling}, the missing fields are filled with
+an identity transformation for objects from such scenes, and similarly,
+@relativeref{Trade::SceneField,MeshMaterial} is filled with @cpp -1 @ce for
+scenes that contain just @relativeref{Trade::SceneField,Mesh}. A scene that
+contains @relativeref{Trade::SceneField,MeshMaterial} without
+@relativeref{Trade::SceneField,Mesh} is expected to not be merged with a scene
+that contains @relativeref{Trade::SceneField,Mesh}.
+
+As objects from each scene get a disjoint range of IDs in increasing order,
+@ref Trade::SceneFieldFlag::OrderedMapping is preserved if the field has it
+in all scenes it's present in. @ref Trade::SceneFieldFlag::ImplicitMapping is
+preserved if the field has it in all scenes and the resulting object mapping
+is contiguous, i.e. if the field covers all objects in all scenes except for
+the last one it's present in. Flag @ref Trade::SceneFieldFlag::MultiEntry is
+set if the field has it in any scene. At the moment, @ref Trade::SceneFieldType::Bit
+and string fields can't be merged.
+
+All data are put into a single allocation sized upfront and
+@ref Trade::SceneData::importerState() isn't preserved. The amount of work is
+linear in the total count of field entries. With @p threadCount larger than
+@cpp 1 @ce the entries of each scene are copied to the output in parallel. The
+output is the same regardless of the thread count used. Small scenes are
+always processed on a single thread.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, Containers::ArrayView<const Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>> indexRemapping, UnsignedInt threadCount = 1);
+
+/**
+@overload
+@m_since_latest
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, std::initializer_list<Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>> indexRemapping, UnsignedInt threadCount = 1);
+
+/**
+@brief Merge multiple scenes together without remapping indices
+@m_since_latest
+
+Same as calling @ref merge(const Containers::Iterable<const Trade::SceneData>&, Containers::ArrayView<const Containers::Triple<UnsignedInt, Trade::SceneField, Containers::StridedArrayView1D<const UnsignedInt>>>, UnsignedInt)
+with an empty @p indexRemapping.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData merge(const Containers::Iterable<const Trade::SceneData>& scenes, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
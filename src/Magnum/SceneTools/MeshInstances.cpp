@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshInstances.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/Triple.h>
+
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Implementation/copyPermuted.h"
+#include "Magnum/SceneTools/Implementation/uniqueMappings.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+Trade::SceneData groupMeshInstances(const Trade::SceneData& scene) {
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(Trade::SceneField::Mesh);
+    CORRADE_ASSERT(meshFieldId,
+        "SceneTools::groupMeshInstances(): field" << Trade::SceneField::Mesh << "not found", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    /* Calculate a stable permutation that puts entries with the same mesh and
+       material next to each other */
+    const Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene.meshesMaterialsAsArray();
+    Containers::Array<UnsignedInt> permutation{NoInit, meshesMaterials.size()};
+    for(std::size_t i = 0; i != permutation.size(); ++i)
+        permutation[i] = UnsignedInt(i);
+    std::stable_sort(permutation.begin(), permutation.end(), [&meshesMaterials](UnsignedInt a, UnsignedInt b) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialA = meshesMaterials[a].second();
+        const Containers::Pair<UnsignedInt, Int>& meshMaterialB = meshesMaterials[b].second();
+        return meshMaterialA.first() < meshMaterialB.first() ||
+            (meshMaterialA.first() == meshMaterialB.first() &&
+             meshMaterialA.second() < meshMaterialB.second());
+    });
+
+    /* Find all fields that share the mapping with the mesh field. Those are
+       reordered, the rest is copied as-is. */
+    Containers::Array<UnsignedInt> mappingIds{NoInit, scene.fieldCount()};
+    Implementation::uniqueMappingsInto(scene, mappingIds);
+    const UnsignedInt meshMappingId = mappingIds[*meshFieldId];
+
+    /* The permuted mapping is passed to combineFields() directly in order to
+       preserve the sharing in the output */
+    const std::size_t mappingTypeSize = Trade::sceneMappingTypeSize(scene.mappingType());
+    const std::size_t meshFieldSize = permutation.size();
+    Containers::Array<char> permutedMapping{NoInit, meshFieldSize*mappingTypeSize};
+    const Containers::StridedArrayView2D<char> permutedMapping2D{permutedMapping, {meshFieldSize, mappingTypeSize}};
+    Implementation::copyPermuted(scene.mapping(*meshFieldId), permutation, permutedMapping2D);
+
+    Containers::Array<Trade::SceneFieldData> fields{ValueInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        if(meshMappingId == ~UnsignedInt{} || mappingIds[i] != meshMappingId) {
+            fields[i] = scene.fieldData(i);
+            continue;
+        }
+
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(fieldType),
+            "SceneTools::groupMeshInstances(): reordering string fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        CORRADE_ASSERT(fieldType != Trade::SceneFieldType::Bit,
+            "SceneTools::groupMeshInstances(): reordering bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+        /* The output views are absolute and the mapping is no longer
+           guaranteed to be sorted */
+        const Trade::SceneFieldFlags flags = scene.fieldFlags(i) & ~(Trade::SceneFieldFlag::OffsetOnly|Trade::SceneFieldFlag::ImplicitMapping);
+        const std::size_t fieldTypeSize = Trade::sceneFieldTypeSize(fieldType)*(scene.fieldArraySize(i) ? scene.fieldArraySize(i) : 1);
+        fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+            scene.mappingType(), Containers::StridedArrayView1D<const void>{permutedMapping, meshFieldSize, std::ptrdiff_t(mappingTypeSize)},
+            fieldType, Containers::StridedArrayView1D<const void>{{nullptr, fieldTypeSize*meshFieldSize}, meshFieldSize, std::ptrdiff_t(fieldTypeSize)}, scene.fieldArraySize(i), flags};
+    }
+
+    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields);
+
+    /* Copy the reordered field data */
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        if(meshMappingId == ~UnsignedInt{} || mappingIds[i] != meshMappingId)
+            continue;
+
+        Implementation::copyPermuted(scene.field(i), permutation, out.mutableField(i));
+    }
+
+    return out;
+}
+
+Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>> meshInstanceRuns(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Mesh),
+        "SceneTools::meshInstanceRuns(): field" << Trade::SceneField::Mesh << "not found", {});
+
+    const Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>> meshesMaterials = scene.meshesMaterialsAsArray();
+
+    /* Count the runs first to allocate the output just once */
+    std::size_t runCount = 0;
+    for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
+        if(!i || meshesMaterials[i].second() != meshesMaterials[i - 1].second())
+            ++runCount;
+    }
+
+    Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>> out{NoInit, runCount};
+    std::size_t run = ~std::size_t{};
+    for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
+        const Containers::Pair<UnsignedInt, Int>& meshMaterial = meshesMaterials[i].second();
+        if(!i || meshMaterial != meshesMaterials[i - 1].second())
+            out[++run] = Containers::triple(meshMaterial.first(), meshMaterial.second(), 0u);
+        ++out[run].third();
+    }
+
+    return out;
+}
+
+}}
@@ -0,0 +1,96 @@
+#ifndef Magnum_SceneTools_MeshInstances_h
+#define Magnum_SceneTools_MeshInstances_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::groupMeshInstances(), @ref Magnum::SceneTools::meshInstanceRuns()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Group mesh instances by their mesh and material
+@m_since_latest
+
+Returns a copy of @p scene with entries of the @ref Trade::SceneField::Mesh
+field and all fields that share its object mapping, such as
+@relativeref{Trade::SceneField,MeshMaterial}, reordered so that all entries
+referencing the same mesh and material combination form a contiguous run. The
+runs are sorted by the mesh ID and then by the material ID, the reordering is
+stable, i.e. entries in each run stay in the order they were in the original
+field. Other fields are copied unchanged. Use @ref meshInstanceRuns() to
+retrieve the runs from the output and
+@ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&, UnsignedInt)
+with @ref Trade::SceneField::Mesh to get a per-instance transformation array
+in the same order. A renderer can then draw each run with a single instanced
+draw call:
+
+@snippet SceneTools.cpp groupMeshInstances
+
+Expects that the scene has a @ref Trade::SceneField::Mesh field. As the object
+mapping of the reordered fields is generally no longer sorted,
+@ref Trade::SceneFieldFlag::OrderedMapping and
+@relativeref{Trade::SceneFieldFlag,ImplicitMapping} is removed from them. Use
+@ref Trade::SceneData::buildObjectIndex() if fast object lookup is needed on
+the output, as @ref orderMappings() would undo the grouping. At the moment,
+@ref Trade::SceneFieldType::Bit and string fields sharing the object mapping
+with @ref Trade::SceneField::Mesh can't be reordered. The data repacking is
+performed using @ref combineFields(), see its documentation for more
+information.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData groupMeshInstances(const Trade::SceneData& scene);
+
+/**
+@brief Runs of mesh instances with the same mesh and material
+@m_since_latest
+
+Returns a list of mesh ID, material ID and count of consecutive
+@ref Trade::SceneField::Mesh field entries that reference the same mesh and
+material combination. The material ID is @cpp -1 @ce if the scene has no
+@ref Trade::SceneField::MeshMaterial field or if given entry has no material
+assigned. The run counts sum up to the @ref Trade::SceneField::Mesh field size,
+i.e. the run offsets can be calculated as a prefix sum of the counts.
+
+For an arbitrary scene the runs are usually short, on a scene processed with
+@ref groupMeshInstances() there's exactly one run for each unique mesh and
+material combination. Expects that the scene has a
+@ref Trade::SceneField::Mesh field.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<Containers::Triple<UnsignedInt, Int, UnsignedInt>> meshInstanceRuns(const Trade::SceneData& scene);
+
+}}
+
+#endif
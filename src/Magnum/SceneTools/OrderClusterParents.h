@@ -51,7 +51,7 @@ namespace Magnum { namespace SceneTools {
 
 /**
 @brief Calculate ordered and clustered parents
-@m_deprecated_since_latest Use @ref parentsBreadthFirst(const Trade::SceneData&)
+@m_deprecated_since_latest Use @ref parentsBreadthFirst(const Trade::SceneData&, UnsignedInt)
     instead.
 */
 inline CORRADE_DEPRECATED("use parentsBreadthFirst() instead") Containers::Array<Containers::Pair<UnsignedInt, Int>> orderClusterParents(const Trade::SceneData& scene) {
@@ -60,7 +60,7 @@ inline CORRADE_DEPRECATED("use parentsBreadthFirst() instead") Containers::Array
 
 /**
 @brief Calculate ordered and clustered parents
-@m_deprecated_since_latest Use @ref parentsBreadthFirstInto(const Trade::SceneData&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<Int>&)
+@m_deprecated_since_latest Use @ref parentsBreadthFirstInto(const Trade::SceneData&, const Containers::StridedArrayView1D<UnsignedInt>&, const Containers::StridedArrayView1D<Int>&, UnsignedInt)
     instead.
 */
 inline CORRADE_DEPRECATED("use parentsBreadthFirstInto() instead") void orderClusterParentsInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<Int>& parentDestination) {
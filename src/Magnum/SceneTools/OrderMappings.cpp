@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OrderMappings.h"
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Implementation/copyPermuted.h"
+#include "Magnum/SceneTools/Implementation/uniqueMappings.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+struct SortedMapping {
+    /* How many fields share given mapping */
+    UnsignedInt count = 0;
+    /* ID of the first field using given mapping */
+    UnsignedInt fieldId = ~UnsignedInt{};
+    /* Whether any field using given mapping is marked as ordered, in which
+       case it's ordered by contract and doesn't need to be checked */
+    bool ordered = false;
+    /* Whether the mapping needs sorting. Calculated in parallel, so it's not
+       a bitfield to avoid data races on neighboring items. */
+    bool needsSorting = false;
+    /* Stable sorting permutation for the mapping, empty if it doesn't need
+       sorting */
+    Containers::Array<UnsignedInt> permutation;
+    /* Sorted mapping data if the mapping is shared among more fields and
+       needs sorting, in order to have combineFields() preserve their
+       sharing in the output */
+    Containers::Array<char> sortedMapping;
+};
+
+/* Calculates a stable sorting permutation for the mapping if it's not sorted
+   already. If it's shared, also fills in the sorted mapping data. */
+template<class T> void sortMapping(const Trade::SceneData& scene, SortedMapping& sortedMapping) {
+    const Containers::StridedArrayView1D<const T> mapping = scene.mapping<T>(sortedMapping.fieldId);
+    if(std::is_sorted(mapping.begin(), mapping.end()))
+        return;
+
+    sortedMapping.needsSorting = true;
+    sortedMapping.permutation = Containers::Array<UnsignedInt>{NoInit, mapping.size()};
+    for(std::size_t i = 0; i != mapping.size(); ++i)
+        sortedMapping.permutation[i] = UnsignedInt(i);
+    std::stable_sort(sortedMapping.permutation.begin(), sortedMapping.permutation.end(), [&mapping](UnsignedInt a, UnsignedInt b) {
+        return mapping[a] < mapping[b];
+    });
+
+    if(sortedMapping.count > 1) {
+        sortedMapping.sortedMapping = Containers::Array<char>{NoInit, mapping.size()*sizeof(T)};
+        const Containers::ArrayView<T> sorted = Containers::arrayCast<T>(sortedMapping.sortedMapping);
+        for(std::size_t i = 0; i != mapping.size(); ++i)
+            sorted[i] = mapping[sortedMapping.permutation[i]];
+    }
+}
+
+}
+
+Trade::SceneData orderMappings(const Trade::SceneData& scene, const UnsignedInt threadCount) {
+    /* Find unique mappings, so mappings shared among multiple fields are
+       sorted just once and stay shared in the output */
+    Containers::Array<UnsignedInt> mappingIds{NoInit, scene.fieldCount()};
+    Containers::Array<SortedMapping> sortedMappings{ValueInit, Implementation::uniqueMappingsInto(scene, mappingIds)};
+    std::size_t totalSize = 0;
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const UnsignedInt mappingId = mappingIds[i];
+        if(mappingId == ~UnsignedInt{})
+            continue;
+
+        SortedMapping& sortedMapping = sortedMappings[mappingId];
+        if(!sortedMapping.count++) {
+            sortedMapping.fieldId = i;
+            totalSize += scene.fieldSize(i);
+        }
+        if(scene.fieldFlags(i) >= Trade::SceneFieldFlag::OrderedMapping)
+            sortedMapping.ordered = true;
+    }
+
+    /* Sort the mappings that aren't known to be ordered. The mappings are
+       independent, so they can be processed in parallel. Decide on the thread
+       count based on the total amount of entries, not the mapping count, so
+       scenes with just a few huge fields benefit as well but many tiny fields
+       don't cause threads to be spawned for nothing. */
+    const UnsignedInt actualThreadCount = Magnum::Implementation::parallelForThreadCount(totalSize, threadCount, Magnum::Implementation::ParallelForMinChunkSize);
+    Magnum::Implementation::parallelFor(sortedMappings.size(), actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(SortedMapping& sortedMapping: sortedMappings.slice(begin, end)) {
+            if(sortedMapping.ordered)
+                continue;
+
+            switch(scene.mappingType()) {
+                case Trade::SceneMappingType::UnsignedByte:
+                    sortMapping<UnsignedByte>(scene, sortedMapping);
+                    break;
+                case Trade::SceneMappingType::UnsignedShort:
+                    sortMapping<UnsignedShort>(scene, sortedMapping);
+                    break;
+                case Trade::SceneMappingType::UnsignedInt:
+                    sortMapping<UnsignedInt>(scene, sortedMapping);
+                    break;
+                case Trade::SceneMappingType::UnsignedLong:
+                    sortMapping<UnsignedLong>(scene, sortedMapping);
+                    break;
+            }
+        }
+    });
+
+    /* Copy all field metadata. Fields that are already marked as ordered or
+       are empty are kept as-is. Can't use Utility::copy() on the whole
+       fieldData() array as those can be offset-only. */
+    Containers::Array<Trade::SceneFieldData> fields{ValueInit, scene.fieldCount()};
+    const std::size_t mappingTypeSize = Trade::sceneMappingTypeSize(scene.mappingType());
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        /* The views are always absolute in the output */
+        const Trade::SceneFieldFlags fieldFlags = scene.fieldFlags(i) & ~Trade::SceneFieldFlag::OffsetOnly;
+        if(mappingIds[i] == ~UnsignedInt{} || fieldFlags >= Trade::SceneFieldFlag::OrderedMapping) {
+            fields[i] = scene.fieldData(i);
+            continue;
+        }
+
+        const Trade::SceneField name = scene.fieldName(i);
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        const SortedMapping& sortedMapping = sortedMappings[mappingIds[i]];
+
+        /* If the mapping is already sorted, pass the original views through,
+           just with the flag added */
+        if(!sortedMapping.needsSorting) {
+            if(fieldType == Trade::SceneFieldType::Bit) {
+                if(scene.fieldArraySize(i))
+                    fields[i] = Trade::SceneFieldData{name, scene.mapping(i), scene.fieldBitArrays(i), fieldFlags|Trade::SceneFieldFlag::OrderedMapping};
+                else
+                    fields[i] = Trade::SceneFieldData{name, scene.mapping(i), scene.fieldBits(i), fieldFlags|Trade::SceneFieldFlag::OrderedMapping};
+            } else if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+                fields[i] = Trade::SceneFieldData{name, scene.mapping(i), scene.fieldStringData(i), fieldType, scene.field(i), fieldFlags|Trade::SceneFieldFlag::OrderedMapping};
+            } else {
+                fields[i] = Trade::SceneFieldData{name, scene.mapping(i), fieldType, scene.field(i), scene.fieldArraySize(i), fieldFlags|Trade::SceneFieldFlag::OrderedMapping};
+            }
+            continue;
+        }
+
+        CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(fieldType),
+            "SceneTools::orderMappings(): ordering string fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+        CORRADE_ASSERT(fieldType != Trade::SceneFieldType::Bit,
+            "SceneTools::orderMappings(): ordering bit fields is not implemented yet, sorry", (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+        /* If the mapping is shared, pass the already sorted array to
+           combineFields() to keep the sharing, otherwise make it a
+           placeholder */
+        const std::size_t fieldSize = scene.fieldSize(i);
+        const Containers::StridedArrayView1D<const void> mapping =
+            sortedMapping.count > 1 ?
+                Containers::StridedArrayView1D<const void>{sortedMapping.sortedMapping, fieldSize, std::ptrdiff_t(mappingTypeSize)} :
+                Containers::StridedArrayView1D<const void>{{nullptr, mappingTypeSize*fieldSize}, fieldSize, std::ptrdiff_t(mappingTypeSize)};
+
+        const std::size_t fieldTypeSize = Trade::sceneFieldTypeSize(fieldType)*(scene.fieldArraySize(i) ? scene.fieldArraySize(i) : 1);
+        fields[i] = Trade::SceneFieldData{name,
+            scene.mappingType(), mapping,
+            fieldType, Containers::StridedArrayView1D<const void>{{nullptr, fieldTypeSize*fieldSize}, fieldSize, std::ptrdiff_t(fieldTypeSize)}, scene.fieldArraySize(i), fieldFlags|Trade::SceneFieldFlag::OrderedMapping};
+    }
+
+    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields, threadCount);
+
+    /* The output fields are all disjoint, so they can be copied in parallel,
+       again deciding on the thread count based on the total amount of
+       entries */
+    Magnum::Implementation::parallelFor(scene.fieldCount(), actualThreadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            if(mappingIds[i] == ~UnsignedInt{} || scene.fieldFlags(i) >= Trade::SceneFieldFlag::OrderedMapping)
+                continue;
+
+            const SortedMapping& sortedMapping = sortedMappings[mappingIds[i]];
+            if(!sortedMapping.needsSorting)
+                continue;
+
+            /* Copy the mapping only if it isn't shared among more fields --
+               in that case it got already sorted above */
+            if(sortedMapping.count == 1)
+                Implementation::copyPermuted(scene.mapping(i), sortedMapping.permutation, out.mutableMapping(i));
+
+            Implementation::copyPermuted(scene.field(i), sortedMapping.permutation, out.mutableField(i));
+        }
+    });
+
+    return out;
+}
+
+}}
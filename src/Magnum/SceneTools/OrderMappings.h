@@ -0,0 +1,75 @@
+#ifndef Magnum_SceneTools_OrderMappings_h
+#define Magnum_SceneTools_OrderMappings_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::orderMappings()
+ * @m_since_latest
+ */
+
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Order object mappings of all fields in a scene
+@m_since_latest
+
+Returns a copy of @p scene with entries of every field sorted by their object
+mapping and @ref Trade::SceneFieldFlag::OrderedMapping set, which makes
+@ref Trade::SceneData::findFieldObjectOffset() and all APIs that depend on it
+use a binary search instead of a linear one. The sorting is stable, i.e.
+entries mapped to the same object stay in the order they were in the original
+field. Compared to @ref Trade::SceneData::buildObjectIndex() this doesn't need
+any additional memory to be kept alongside the scene, but the order of field
+entries changes.
+
+Fields that are already marked with @ref Trade::SceneFieldFlag::OrderedMapping
+or @relativeref{Trade::SceneFieldFlag,ImplicitMapping} are passed through
+unchanged, fields that have their mapping already sorted are passed through
+with just @ref Trade::SceneFieldFlag::OrderedMapping added. If any fields
+share their mapping views, such as @ref Trade::SceneField::Mesh and
+@relativeref{Trade::SceneField,MeshMaterial}, the mapping is sorted just once
+and the sharing is preserved in the output. The data repacking is performed
+using @ref combineFields(), see its documentation for more information.
+
+At the moment, @ref Trade::SceneFieldType::Bit and string fields can't be
+sorted, only passed through if their mapping is already sorted.
+
+With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to autodetect it
+from the hardware concurrency, the unique mappings are sorted and the field
+data are copied to the output in parallel, with each thread processing a
+contiguous range of fields. The output is the same regardless of the thread
+count used. Small scenes are always processed on a single thread.
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData orderMappings(const Trade::SceneData& scene, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
@@ -0,0 +1,289 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SceneBuilder.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+
+#include "Magnum/Trade/ArrayAllocator.h"
+
+namespace Magnum { namespace SceneTools {
+
+namespace {
+
+struct Field {
+    Trade::SceneField name;
+    Trade::SceneFieldType type;
+    UnsignedShort arraySize;
+    /* Mapping group the field is in */
+    UnsignedInt group;
+    /* Offset of the field in the group record */
+    std::size_t offset;
+};
+
+/* Fields sharing the object mapping, stored interleaved with the mapping
+   being first in each record */
+struct Group {
+    Containers::Array<char> data;
+    std::size_t size;
+    /* Size of the record without the trailing padding */
+    std::size_t end;
+    std::size_t stride;
+    std::size_t alignment;
+};
+
+inline std::size_t alignUp(const std::size_t value, const std::size_t alignment) {
+    return (value + alignment - 1)/alignment*alignment;
+}
+
+/* View on a single member of all records in a group. Empty views point to
+   the beginning of the data to stay in bounds. */
+Containers::StridedArrayView2D<char> recordView(const Containers::ArrayView<char> data, const std::size_t offset, const std::size_t size, const std::size_t width, const std::size_t stride) {
+    return {data, data.data() + (size ? offset : 0), {size, width}, {std::ptrdiff_t(stride), 1}};
+}
+
+/* Adds a field to a group that has no entries yet, so the record layout can
+   be changed freely */
+UnsignedInt addFieldToGroup(Containers::Array<Field>& fields, Group& group, const UnsignedInt groupId, const Trade::SceneField name, const Trade::SceneFieldType type, const UnsignedShort arraySize) {
+    const std::size_t alignment = Trade::sceneFieldTypeAlignment(type);
+    const std::size_t offset = alignUp(group.end, alignment);
+    group.end = offset + Trade::sceneFieldTypeSize(type)*(arraySize ? arraySize : 1);
+    if(alignment > group.alignment) group.alignment = alignment;
+    group.stride = alignUp(group.end, group.alignment);
+
+    arrayAppend(fields, Field{name, type, arraySize, groupId, offset});
+    return UnsignedInt(fields.size() - 1);
+}
+
+}
+
+struct SceneBuilder::State {
+    UnsignedLong mappingBound{};
+    Containers::Array<Field> fields;
+    Containers::Array<Group> groups;
+};
+
+SceneBuilder::SceneBuilder(): _state{InPlaceInit} {}
+
+SceneBuilder::SceneBuilder(SceneBuilder&&) noexcept = default;
+
+SceneBuilder::~SceneBuilder() = default;
+
+SceneBuilder& SceneBuilder::operator=(SceneBuilder&&) noexcept = default;
+
+UnsignedLong SceneBuilder::mappingBound() const {
+    return _state->mappingBound;
+}
+
+UnsignedInt SceneBuilder::addObject() {
+    return addObjects(1);
+}
+
+UnsignedInt SceneBuilder::addObjects(const UnsignedInt count) {
+    CORRADE_ASSERT(_state->mappingBound + count <= 0xffffffffull,
+        "SceneTools::SceneBuilder::addObjects(): adding" << count << "objects to" << _state->mappingBound << "would exceed a 32-bit mapping bound", {});
+    const UnsignedInt first = UnsignedInt(_state->mappingBound);
+    _state->mappingBound += count;
+    return first;
+}
+
+UnsignedInt SceneBuilder::fieldCount() const {
+    return UnsignedInt(_state->fields.size());
+}
+
+Trade::SceneField SceneBuilder::fieldName(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _state->fields.size(),
+        "SceneTools::SceneBuilder::fieldName(): index" << fieldId << "out of range for" << _state->fields.size() << "fields", {});
+    return _state->fields[fieldId].name;
+}
+
+Trade::SceneFieldType SceneBuilder::fieldType(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _state->fields.size(),
+        "SceneTools::SceneBuilder::fieldType(): index" << fieldId << "out of range for" << _state->fields.size() << "fields", {});
+    return _state->fields[fieldId].type;
+}
+
+UnsignedShort SceneBuilder::fieldArraySize(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _state->fields.size(),
+        "SceneTools::SceneBuilder::fieldArraySize(): index" << fieldId << "out of range for" << _state->fields.size() << "fields", {});
+    return _state->fields[fieldId].arraySize;
+}
+
+Containers::Optional<UnsignedInt> SceneBuilder::findFieldId(const Trade::SceneField name) const {
+    for(std::size_t i = 0; i != _state->fields.size(); ++i)
+        if(_state->fields[i].name == name) return UnsignedInt(i);
+    return {};
+}
+
+std::size_t SceneBuilder::fieldSize(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _state->fields.size(),
+        "SceneTools::SceneBuilder::fieldSize(): index" << fieldId << "out of range for" << _state->fields.size() << "fields", {});
+    return _state->groups[_state->fields[fieldId].group].size;
+}
+
+UnsignedInt SceneBuilder::addField(const Trade::SceneField name, const Trade::SceneFieldType type, const UnsignedShort arraySize) {
+    State& state = *_state;
+    /* Validate before adding the group so a failed graceful assert doesn't
+       leave an empty group behind */
+    CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(type),
+        "SceneTools::SceneBuilder::addField(): string fields are not supported yet, sorry", {});
+    CORRADE_ASSERT(type != Trade::SceneFieldType::Bit,
+        "SceneTools::SceneBuilder::addField(): bit fields are not supported yet, sorry", {});
+    CORRADE_ASSERT(!findFieldId(name),
+        "SceneTools::SceneBuilder::addField(): field" << name << "already added", {});
+
+    arrayAppend(state.groups, Group{{}, 0, sizeof(UnsignedInt), sizeof(UnsignedInt), alignof(UnsignedInt)});
+    return addFieldToGroup(state.fields, state.groups.back(), state.groups.size() - 1, name, type, arraySize);
+}
+
+UnsignedInt SceneBuilder::addField(const UnsignedInt sharedMappingFieldId, const Trade::SceneField name, const Trade::SceneFieldType type, const UnsignedShort arraySize) {
+    State& state = *_state;
+    CORRADE_ASSERT(sharedMappingFieldId < state.fields.size(),
+        "SceneTools::SceneBuilder::addField(): index" << sharedMappingFieldId << "out of range for" << state.fields.size() << "fields", {});
+    CORRADE_ASSERT(!Trade::Implementation::isSceneFieldTypeString(type),
+        "SceneTools::SceneBuilder::addField(): string fields are not supported yet, sorry", {});
+    CORRADE_ASSERT(type != Trade::SceneFieldType::Bit,
+        "SceneTools::SceneBuilder::addField(): bit fields are not supported yet, sorry", {});
+    CORRADE_ASSERT(!findFieldId(name),
+        "SceneTools::SceneBuilder::addField(): field" << name << "already added", {});
+    const UnsignedInt group = state.fields[sharedMappingFieldId].group;
+    CORRADE_ASSERT(!state.groups[group].size,
+        "SceneTools::SceneBuilder::addField(): can't share a mapping with" << state.fields[sharedMappingFieldId].name << "as it already has" << state.groups[group].size << "entries", {});
+
+    return addFieldToGroup(state.fields, state.groups[group], group, name, type, arraySize);
+}
+
+void SceneBuilder::reserve(const UnsignedInt fieldId, const std::size_t size) {
+    State& state = *_state;
+    CORRADE_ASSERT(fieldId < state.fields.size(),
+        "SceneTools::SceneBuilder::reserve(): index" << fieldId << "out of range for" << state.fields.size() << "fields", );
+    Group& g = state.groups[state.fields[fieldId].group];
+    arrayReserve<Trade::ArrayAllocator>(g.data, size*g.stride);
+}
+
+std::size_t SceneBuilder::addEntry(const UnsignedInt fieldId, const UnsignedInt object) {
+    State& state = *_state;
+    CORRADE_ASSERT(fieldId < state.fields.size(),
+        "SceneTools::SceneBuilder::addEntry(): index" << fieldId << "out of range for" << state.fields.size() << "fields", {});
+    CORRADE_ASSERT(object < state.mappingBound,
+        "SceneTools::SceneBuilder::addEntry(): object" << object << "out of range for" << state.mappingBound << "objects", {});
+    Group& g = state.groups[state.fields[fieldId].group];
+
+    /* Zero-initialize the whole record including padding so the output
+       doesn't contain uninitialized memory */
+    const Containers::ArrayView<char> record = arrayAppend<Trade::ArrayAllocator>(g.data, NoInit, g.stride);
+    std::memset(record.data(), 0, record.size());
+    *reinterpret_cast<UnsignedInt*>(record.data()) = object;
+    return g.size++;
+}
+
+Containers::StridedArrayView1D<UnsignedInt> SceneBuilder::mutableMapping(const UnsignedInt fieldId) {
+    State& state = *_state;
+    CORRADE_ASSERT(fieldId < state.fields.size(),
+        "SceneTools::SceneBuilder::mutableMapping(): index" << fieldId << "out of range for" << state.fields.size() << "fields", {});
+    Group& g = state.groups[state.fields[fieldId].group];
+    return Containers::arrayCast<1, UnsignedInt>(recordView(g.data, 0, g.size, sizeof(UnsignedInt), g.stride));
+}
+
+Containers::StridedArrayView2D<char> SceneBuilder::mutableField(const UnsignedInt fieldId) {
+    State& state = *_state;
+    CORRADE_ASSERT(fieldId < state.fields.size(),
+        "SceneTools::SceneBuilder::mutableField(): index" << fieldId << "out of range for" << state.fields.size() << "fields", {});
+    const Field& field = state.fields[fieldId];
+    Group& g = state.groups[field.group];
+    return recordView(g.data, field.offset, g.size, Trade::sceneFieldTypeSize(field.type)*(field.arraySize ? field.arraySize : 1), g.stride);
+}
+
+Trade::SceneData SceneBuilder::build() {
+    State& state = *_state;
+
+    /* Pick the largest group, its array gets grown in place to fit the
+       others and is then adopted by the output */
+    std::size_t largest = 0;
+    for(std::size_t i = 1; i < state.groups.size(); ++i)
+        if(state.groups[i].data.size() > state.groups[largest].data.size())
+            largest = i;
+
+    /* Calculate offsets of the other groups in the output. Empty groups are
+       pointed to the beginning, which is always in bounds. */
+    Containers::Array<std::size_t> offsets{ValueInit, state.groups.size()};
+    std::size_t dataSize = state.groups.isEmpty() ? 0 : state.groups[largest].data.size();
+    for(std::size_t i = 0; i != state.groups.size(); ++i) {
+        if(i == largest || !state.groups[i].size) continue;
+        offsets[i] = alignUp(dataSize, state.groups[i].alignment);
+        dataSize = offsets[i] + state.groups[i].data.size();
+    }
+
+    Containers::Array<char> data;
+    if(!state.groups.isEmpty()) {
+        data = Utility::move(state.groups[largest].data);
+        if(dataSize != data.size())
+            arrayResize<Trade::ArrayAllocator>(data, NoInit, dataSize);
+        for(std::size_t i = 0; i != state.groups.size(); ++i) {
+            if(i == largest || !state.groups[i].size) continue;
+            std::memcpy(data.data() + offsets[i], state.groups[i].data.data(), state.groups[i].data.size());
+        }
+    }
+
+    /* Detect ordered and implicit mappings for each group */
+    Containers::Array<Trade::SceneFieldFlags> flags{ValueInit, state.groups.size()};
+    for(std::size_t i = 0; i != state.groups.size(); ++i) {
+        const Group& g = state.groups[i];
+        const Containers::StridedArrayView1D<const UnsignedInt> mapping = Containers::arrayCast<1, const UnsignedInt>(recordView(data, offsets[i], g.size, sizeof(UnsignedInt), g.stride));
+        bool ordered = true;
+        bool implicit = true;
+        for(std::size_t j = 0; j != mapping.size(); ++j) {
+            if(mapping[j] != j) implicit = false;
+            if(j && mapping[j] < mapping[j - 1]) {
+                ordered = false;
+                break;
+            }
+        }
+        if(implicit)
+            flags[i] = Trade::SceneFieldFlag::ImplicitMapping;
+        else if(ordered)
+            flags[i] = Trade::SceneFieldFlag::OrderedMapping;
+    }
+
+    Containers::Array<Trade::SceneFieldData> fields{ValueInit, state.fields.size()};
+    for(std::size_t i = 0; i != state.fields.size(); ++i) {
+        const Field& field = state.fields[i];
+        const Group& g = state.groups[field.group];
+        fields[i] = Trade::SceneFieldData{field.name,
+            recordView(data, offsets[field.group], g.size, sizeof(UnsignedInt), g.stride),
+            field.type,
+            recordView(data, offsets[field.group] + field.offset, g.size, Trade::sceneFieldTypeSize(field.type)*(field.arraySize ? field.arraySize : 1), g.stride),
+            field.arraySize, flags[field.group]};
+    }
+
+    const UnsignedLong mappingBound = state.mappingBound;
+    state = State{};
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, mappingBound, Utility::move(data), Utility::move(fields)};
+}
+
+}}
@@ -0,0 +1,304 @@
+#ifndef Magnum_SceneTools_SceneBuilder_h
+#define Magnum_SceneTools_SceneBuilder_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneTools::SceneBuilder
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Incremental scene builder
+@m_since_latest
+
+Builds a @ref Trade::SceneData by incrementally adding objects, fields and
+field entries, for example when converting a scene from a format where the
+total object and entry count isn't known upfront. Fields are added with
+@ref addField(), entries with @ref addEntry() and the result is produced with
+@ref build():
+
+@snippet SceneTools.cpp SceneBuilder-usage
+
+@section SceneTools-SceneBuilder-storage Data storage
+
+Each field, together with all fields sharing its object mapping, is stored in
+a single interleaved growable array allocated with @ref Trade::ArrayAllocator,
+with the @ref Trade::SceneMappingType::UnsignedInt object mapping followed by
+the field data in each record. Adding an entry is thus amortized constant time
+and doesn't cause any reallocation of other fields. Use @ref reserve() if the
+final entry count is known upfront.
+
+In @ref build(), the largest of these arrays is grown in place to fit the
+remaining ones and is then adopted by the returned @ref Trade::SceneData
+without a copy, the remaining arrays are copied after it. Fields that have
+their object mapping monotonically increasing get
+@ref Trade::SceneFieldFlag::OrderedMapping set and fields that have the
+mapping equal to a @cpp 0 @ce to @cpp n - 1 @ce sequence get
+@ref Trade::SceneFieldFlag::ImplicitMapping set, which makes
+@ref Trade::SceneData::findFieldObjectOffset() and related APIs faster on the
+result.
+
+String and @ref Trade::SceneFieldType::Bit fields aren't supported at the
+moment.
+@experimental
+*/
+class MAGNUM_SCENETOOLS_EXPORT SceneBuilder {
+    public:
+        /** @brief Constructor */
+        explicit SceneBuilder();
+
+        /** @brief Copying is not allowed */
+        SceneBuilder(const SceneBuilder&) = delete;
+
+        /** @brief Move constructor */
+        SceneBuilder(SceneBuilder&&) noexcept;
+
+        ~SceneBuilder();
+
+        /** @brief Copying is not allowed */
+        SceneBuilder& operator=(const SceneBuilder&) = delete;
+
+        /** @brief Move assignment */
+        SceneBuilder& operator=(SceneBuilder&&) noexcept;
+
+        /**
+         * @brief Object mapping bound
+         *
+         * Count of objects added with @ref addObject() and
+         * @ref addObjects() so far. Used as
+         * @ref Trade::SceneData::mappingBound() of the built scene.
+         */
+        UnsignedLong mappingBound() const;
+
+        /**
+         * @brief Add an object
+         *
+         * Returns ID of the added object.
+         * @see @ref addObjects()
+         */
+        UnsignedInt addObject();
+
+        /**
+         * @brief Add objects
+         *
+         * Returns ID of the first added object, the remaining objects have
+         * consecutive IDs. Expects that the resulting @ref mappingBound()
+         * fits into 32 bits, as the built scene uses a
+         * @ref Trade::SceneMappingType::UnsignedInt mapping.
+         * @see @ref addObject()
+         */
+        UnsignedInt addObjects(UnsignedInt count);
+
+        /** @brief Field count */
+        UnsignedInt fieldCount() const;
+
+        /**
+         * @brief Field name
+         *
+         * The @p fieldId is expected to be smaller than @ref fieldCount().
+         */
+        Trade::SceneField fieldName(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Field type
+         *
+         * The @p fieldId is expected to be smaller than @ref fieldCount().
+         */
+        Trade::SceneFieldType fieldType(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Field array size
+         *
+         * The @p fieldId is expected to be smaller than @ref fieldCount().
+         */
+        UnsignedShort fieldArraySize(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Find an ID of a named field
+         *
+         * If the field isn't present, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<UnsignedInt> findFieldId(Trade::SceneField name) const;
+
+        /**
+         * @brief Field size
+         *
+         * Count of entries in given field and all fields sharing its object
+         * mapping. The @p fieldId is expected to be smaller than
+         * @ref fieldCount().
+         */
+        std::size_t fieldSize(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Add a field
+         * @param name          Field name
+         * @param type          Field type
+         * @param arraySize     Field array size. Use @cpp 0 @ce for non-array
+         *      fields.
+         *
+         * Returns ID of the added field. The field gets its own object
+         * mapping. Expects that a field of the same @p name wasn't added
+         * already and that @p type is not
+         * @ref Trade::SceneFieldType::Bit or any of the string types.
+         */
+        UnsignedInt addField(Trade::SceneField name, Trade::SceneFieldType type, UnsignedShort arraySize = 0);
+
+        /**
+         * @brief Add a field sharing object mapping with another field
+         * @param sharedMappingFieldId  Field to share the object mapping with
+         * @param name          Field name
+         * @param type          Field type
+         * @param arraySize     Field array size. Use @cpp 0 @ce for non-array
+         *      fields.
+         *
+         * Returns ID of the added field. Entries added to any of the fields
+         * sharing the object mapping are added to all of them. In addition to
+         * the constraints listed in
+         * @ref addField(Trade::SceneField, Trade::SceneFieldType, UnsignedShort)
+         * expects that @p sharedMappingFieldId is smaller than
+         * @ref fieldCount() and that no entries were added to it yet.
+         */
+        UnsignedInt addField(UnsignedInt sharedMappingFieldId, Trade::SceneField name, Trade::SceneFieldType type, UnsignedShort arraySize = 0);
+
+        /**
+         * @brief Reserve memory for field entries
+         *
+         * Reserves memory for @p size entries in given field and all fields
+         * sharing its object mapping. Does nothing if the capacity is already
+         * large enough. The @p fieldId is expected to be smaller than
+         * @ref fieldCount().
+         */
+        void reserve(UnsignedInt fieldId, std::size_t size);
+
+        /**
+         * @brief Add a field entry
+         *
+         * Adds an entry for @p object to given field and all fields sharing
+         * its object mapping, with the field data zero-initialized. Returns
+         * ID of the added entry, which can be used to index
+         * @ref mutableField() views. Expects that @p fieldId is smaller than
+         * @ref fieldCount() and @p object is smaller than
+         * @ref mappingBound().
+         *
+         * Adding an entry may reallocate the storage of given field,
+         * invalidating all views returned from @ref mutableMapping() and
+         * @ref mutableField() for it and for all fields sharing its mapping.
+         */
+        std::size_t addEntry(UnsignedInt fieldId, UnsignedInt object);
+
+        /**
+         * @brief Add a field entry with a value
+         *
+         * Calls @ref addEntry(UnsignedInt, UnsignedInt) and then writes
+         * @p value to the added entry through @ref mutableField(). Fields
+         * sharing the object mapping get their entry zero-initialized.
+         */
+        template<class T> std::size_t addEntry(UnsignedInt fieldId, UnsignedInt object, const T& value);
+
+        /**
+         * @brief Mutable object mapping data for given field
+         *
+         * The @p fieldId is expected to be smaller than @ref fieldCount().
+         * The view is invalidated by a subsequent @ref addEntry() or
+         * @ref reserve() on given field or any field sharing its mapping.
+         */
+        Containers::StridedArrayView1D<UnsignedInt> mutableMapping(UnsignedInt fieldId);
+
+        /**
+         * @brief Mutable data for given field
+         *
+         * The second dimension represents the actual data type (its size is
+         * equal to type size, or type size multiplied by array size for
+         * array fields). The @p fieldId is expected to be smaller than
+         * @ref fieldCount(). The view is invalidated by a subsequent
+         * @ref addEntry() or @ref reserve() on given field or any field
+         * sharing its mapping.
+         */
+        Containers::StridedArrayView2D<char> mutableField(UnsignedInt fieldId);
+
+        /**
+         * @brief Mutable data for given field in a concrete type
+         *
+         * Same as above, except that it requires the field to not be an
+         * array field and @p T to correspond to @ref fieldType(). Use the
+         * type-erased @ref mutableField(UnsignedInt) for array fields.
+         */
+        template<class T> Containers::StridedArrayView1D<T> mutableField(UnsignedInt fieldId);
+
+        /**
+         * @brief Build the scene
+         *
+         * Returns a scene with @ref Trade::SceneMappingType::UnsignedInt
+         * object mapping, @ref mappingBound() as its mapping bound and all
+         * fields in the order they were added. See
+         * @ref SceneTools-SceneBuilder-storage for details about how the data
+         * are transferred and which field flags are set. After calling this
+         * function the builder is reset to its initial state.
+         */
+        Trade::SceneData build();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+template<class T> std::size_t SceneBuilder::addEntry(const UnsignedInt fieldId, const UnsignedInt object, const T& value) {
+    const std::size_t id = addEntry(fieldId, object);
+    const Containers::StridedArrayView1D<T> data = mutableField<T>(fieldId);
+    #ifdef CORRADE_GRACEFUL_ASSERT /* Sigh. Brittle. Better idea? */
+    if(id >= data.size())
+        return id;
+    #endif
+    data[id] = value;
+    return id;
+}
+
+template<class T> Containers::StridedArrayView1D<T> SceneBuilder::mutableField(const UnsignedInt fieldId) {
+    Containers::StridedArrayView2D<char> data = mutableField(fieldId);
+    #ifdef CORRADE_GRACEFUL_ASSERT /* Sigh. Brittle. Better idea? */
+    if(!data.stride()[1])
+        return {};
+    #endif
+    CORRADE_ASSERT(Trade::Implementation::SceneFieldTypeTraits<T>::isCompatible(fieldType(fieldId)),
+        "SceneTools::SceneBuilder::mutableField():" << fieldName(fieldId) << "is" << fieldType(fieldId) << "but requested a type equivalent to" << Trade::Implementation::SceneFieldTypeFor<T>::type(), {});
+    CORRADE_ASSERT(!fieldArraySize(fieldId),
+        "SceneTools::SceneBuilder::mutableField():" << fieldName(fieldId) << "is an array field, use the type-erased variant to access it", {});
+    return Containers::arrayCast<1, T>(data);
+}
+
+}}
+
+#endif
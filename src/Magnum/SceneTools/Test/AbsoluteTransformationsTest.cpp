@@ -0,0 +1,594 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneTools/AbsoluteTransformations.h"
+#include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct AbsoluteTransformationsTest: TestSuite::Tester {
+    explicit AbsoluteTransformationsTest();
+
+    void construct2D();
+    void construct3D();
+    void constructTranslationRotationScaling();
+    void constructNotMatchingDimensions();
+    void constructNoParentField();
+    void constructCopy();
+    void constructMove();
+
+    void childrenForInvalid();
+    void transformationForInvalid();
+
+    void update();
+    void updateOverlappingSubtrees();
+    void updateNotInHierarchy();
+    void updateInvalid();
+    void updateTranslationRotationScaling();
+    void updateConvertedTransformation();
+    void updateAll();
+};
+
+using namespace Math::Literals;
+
+/*
+        0T            5T    7T
+       / \
+      1T  2T
+     / \
+    3T  4
+        |
+        6T
+
+    Object 4 has no transformation, object 7 isn't a part of the hierarchy.
+*/
+struct Scene {
+    struct Parent {
+        UnsignedShort object;
+        Short parent;
+    } parents[7];
+
+    struct Transformation {
+        UnsignedShort object;
+        Matrix3 transformation2D;
+        Matrix4 transformation3D;
+    } transforms[7];
+};
+
+Scene sceneData() {
+    return {
+        {{3, 1},
+         {5, -1},
+         {1, 0},
+         {6, 4},
+         {0, -1},
+         {4, 1},
+         {2, 0}},
+        {{0, Matrix3::translation({1.0f, 0.0f}),
+             Matrix4::translation({1.0f, 0.0f, 0.0f})},
+         {1, Matrix3::scaling({2.0f, 3.0f}),
+             Matrix4::scaling({2.0f, 3.0f, 4.0f})},
+         {2, Matrix3::rotation(35.0_degf),
+             Matrix4::rotationZ(35.0_degf)},
+         {3, Matrix3::translation({0.0f, 2.0f}),
+             Matrix4::translation({0.0f, 2.0f, 0.0f})},
+         {5, Matrix3::translation({-1.0f, 0.5f}),
+             Matrix4::translation({-1.0f, 0.5f, 3.0f})},
+         {6, Matrix3::rotation(-15.0_degf),
+             Matrix4::rotationX(-15.0_degf)},
+         {7, Matrix3::translation({4.0f, 4.0f}),
+             Matrix4::translation({4.0f, 4.0f, 4.0f})}}
+    };
+}
+
+Trade::SceneData scene3D(Scene& data) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 8, Trade::DataFlag::Mutable, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::transformation3D)},
+    }};
+}
+
+/* Absolute transformations of all objects calculated by hand from the local
+   transformations in the data */
+Containers::Array<Matrix4> expected3D(const Scene& data, const Matrix4& global = {}) {
+    Containers::Array<Matrix4> out{ValueInit, 8};
+    out[0] = global*data.transforms[0].transformation3D;
+    out[1] = out[0]*data.transforms[1].transformation3D;
+    out[2] = out[0]*data.transforms[2].transformation3D;
+    out[3] = out[1]*data.transforms[3].transformation3D;
+    out[4] = out[1];
+    out[5] = global*data.transforms[4].transformation3D;
+    out[6] = out[4]*data.transforms[5].transformation3D;
+    /* Object 7 isn't in the hierarchy and stays at an identity */
+    return out;
+}
+
+AbsoluteTransformationsTest::AbsoluteTransformationsTest() {
+    addTests({&AbsoluteTransformationsTest::construct2D,
+              &AbsoluteTransformationsTest::construct3D,
+              &AbsoluteTransformationsTest::constructTranslationRotationScaling,
+              &AbsoluteTransformationsTest::constructNotMatchingDimensions,
+              &AbsoluteTransformationsTest::constructNoParentField,
+              &AbsoluteTransformationsTest::constructCopy,
+              &AbsoluteTransformationsTest::constructMove,
+
+              &AbsoluteTransformationsTest::childrenForInvalid,
+              &AbsoluteTransformationsTest::transformationForInvalid,
+
+              &AbsoluteTransformationsTest::update,
+              &AbsoluteTransformationsTest::updateOverlappingSubtrees,
+              &AbsoluteTransformationsTest::updateNotInHierarchy,
+              &AbsoluteTransformationsTest::updateInvalid,
+              &AbsoluteTransformationsTest::updateTranslationRotationScaling,
+              &AbsoluteTransformationsTest::updateConvertedTransformation,
+              &AbsoluteTransformationsTest::updateAll});
+}
+
+void AbsoluteTransformationsTest::construct2D() {
+    Scene data = sceneData();
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 8, {}, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::transformation2D)},
+    }};
+
+    const Matrix3 global = Matrix3::scaling(Vector2{0.5f});
+    AbsoluteTransformations2D absolute{scene, global};
+    CORRADE_COMPARE(&absolute.scene(), &scene);
+
+    Matrix3 expected[8];
+    expected[0] = global*data.transforms[0].transformation2D;
+    expected[1] = expected[0]*data.transforms[1].transformation2D;
+    expected[2] = expected[0]*data.transforms[2].transformation2D;
+    expected[3] = expected[1]*data.transforms[3].transformation2D;
+    expected[4] = expected[1];
+    expected[5] = global*data.transforms[4].transformation2D;
+    expected[6] = expected[4]*data.transforms[5].transformation2D;
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        Containers::arrayView(expected),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(absolute.transformationFor(3), expected[3]);
+}
+
+void AbsoluteTransformationsTest::construct3D() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    AbsoluteTransformations3D absolute{scene};
+    CORRADE_COMPARE(&absolute.scene(), &scene);
+    CORRADE_COMPARE_AS(absolute.parentsBreadthFirst(),
+        SceneTools::parentsBreadthFirst(scene),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(absolute.transformationFor(6), expected3D(data)[6]);
+
+    /* Children are in the order they're listed in the parent field */
+    CORRADE_COMPARE_AS(absolute.childrenFor(0),
+        Containers::arrayView<UnsignedInt>({1, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(absolute.childrenFor(1),
+        Containers::arrayView<UnsignedInt>({3, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(absolute.childrenFor(4),
+        Containers::arrayView<UnsignedInt>({6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(absolute.childrenFor(6).size(), 0);
+    CORRADE_COMPARE(absolute.childrenFor(5).size(), 0);
+    /* Not in the hierarchy */
+    CORRADE_COMPARE(absolute.childrenFor(7).size(), 0);
+
+    /* Should be the same as the batch function */
+    Containers::Array<Matrix4> fieldTransformations = absoluteFieldTransformations3D(scene, Trade::SceneField::Parent);
+    Containers::StridedArrayView1D<const UnsignedShort> parentMapping = scene.mapping<UnsignedShort>(Trade::SceneField::Parent);
+    for(std::size_t i = 0; i != parentMapping.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(absolute.transformationFor(parentMapping[i]), fieldTransformations[i]);
+    }
+}
+
+void AbsoluteTransformationsTest::constructTranslationRotationScaling() {
+    /* Same hierarchy as above, but with just a translation field to verify
+       the per-object lookup works with TRS fields as well */
+    const struct Data {
+        struct Parent {
+            UnsignedInt object;
+            Int parent;
+        } parents[4];
+        struct Translation {
+            UnsignedInt object;
+            Vector3 translation;
+        } translations[3];
+    } data[]{{
+        {{2, 0}, {0, -1}, {1, 0}, {3, 1}},
+        {{3, {0.0f, 0.0f, 3.0f}},
+         {0, {1.0f, 0.0f, 0.0f}},
+         {1, {0.0f, 2.0f, 0.0f}}}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 4, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::object),
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::stridedArrayView(data->translations)
+                .slice(&Data::Translation::object),
+            Containers::stridedArrayView(data->translations)
+                .slice(&Data::Translation::translation)},
+    }};
+
+    AbsoluteTransformations3D absolute{scene};
+    CORRADE_COMPARE_AS(absolute.transformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 3.0f})
+    }), TestSuite::Compare::Container);
+
+    /* The update goes through a different code path than the initial
+       calculation, it should give the same result */
+    absolute.update({0, 2});
+    CORRADE_COMPARE_AS(absolute.transformations(), Containers::arrayView({
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 0.0f}),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::translation({1.0f, 2.0f, 3.0f})
+    }), TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::constructNotMatchingDimensions() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    Containers::String out;
+    Error redirectError{&out};
+    AbsoluteTransformations2D{scene};
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations: the scene is not 2D\n");
+}
+
+void AbsoluteTransformationsTest::constructNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation, Trade::SceneMappingType::UnsignedInt, nullptr, Trade::SceneFieldType::Matrix4x4, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    AbsoluteTransformations3D{scene};
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations: the scene has no hierarchy\n");
+}
+
+void AbsoluteTransformationsTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<AbsoluteTransformations3D>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<AbsoluteTransformations3D>{});
+}
+
+void AbsoluteTransformationsTest::constructMove() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+    Scene anotherData = sceneData();
+    Trade::SceneData anotherScene = scene3D(anotherData);
+
+    AbsoluteTransformations3D a{scene};
+    const Matrix4* transformations = a.transformations().data();
+
+    AbsoluteTransformations3D b{Utility::move(a)};
+    CORRADE_COMPARE(&b.scene(), &scene);
+    CORRADE_COMPARE(b.transformations().data(), transformations);
+    CORRADE_COMPARE_AS(b.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+
+    AbsoluteTransformations3D c{anotherScene};
+    c = Utility::move(b);
+    CORRADE_COMPARE(&c.scene(), &scene);
+    CORRADE_COMPARE(c.transformations().data(), transformations);
+
+    /* Update should work on the moved-to instance */
+    data.transforms[0].transformation3D = Matrix4::translation({0.0f, 0.0f, -1.0f});
+    c.update({0});
+    CORRADE_COMPARE_AS(c.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<AbsoluteTransformations3D>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<AbsoluteTransformations3D>::value);
+}
+
+void AbsoluteTransformationsTest::childrenForInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+    AbsoluteTransformations3D absolute{scene};
+
+    Containers::String out;
+    Error redirectError{&out};
+    absolute.childrenFor(8);
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations::childrenFor(): index 8 out of range for 8 objects\n");
+}
+
+void AbsoluteTransformationsTest::transformationForInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+    AbsoluteTransformations3D absolute{scene};
+
+    Containers::String out;
+    Error redirectError{&out};
+    absolute.transformationFor(8);
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations::transformationFor(): index 8 out of range for 8 objects\n");
+}
+
+void AbsoluteTransformationsTest::update() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    const Matrix4 global = Matrix4::rotationY(90.0_degf);
+    AbsoluteTransformations3D absolute{scene, global};
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data, global),
+        TestSuite::Compare::Container);
+
+    /* Modify transformation of object 1 through the scene, its whole subtree
+       should get updated */
+    Containers::Array<Matrix4> expectedBefore = expected3D(data, global);
+    scene.mutableField<Matrix4>(Trade::SceneField::Transformation)[1] = Matrix4::translation({0.0f, 0.0f, 5.0f});
+    absolute.update({1});
+    Containers::Array<Matrix4> expectedAfter = expected3D(data, global);
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expectedAfter,
+        TestSuite::Compare::Container);
+    /* Objects outside of the subtree are the same as before */
+    CORRADE_COMPARE(expectedAfter[0], expectedBefore[0]);
+    CORRADE_COMPARE(expectedAfter[2], expectedBefore[2]);
+    CORRADE_COMPARE(expectedAfter[5], expectedBefore[5]);
+    CORRADE_VERIFY(expectedAfter[6] != expectedBefore[6]);
+
+    /* Modifying a transformation without passing the object to update()
+       doesn't update anything */
+    data.transforms[4].transformation3D = Matrix4::scaling(Vector3{7.0f});
+    absolute.update({2});
+    CORRADE_COMPARE(absolute.transformationFor(5), expectedAfter[5]);
+    absolute.update({5});
+    CORRADE_COMPARE(absolute.transformationFor(5), global*Matrix4::scaling(Vector3{7.0f}));
+}
+
+void AbsoluteTransformationsTest::updateOverlappingSubtrees() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    AbsoluteTransformations3D absolute{scene};
+
+    /* Change a parent and a nested child, and a leaf in an unrelated subtree.
+       Pass them in a reverse order and with duplicates, the parent should
+       still be processed first and no object twice. */
+    data.transforms[0].transformation3D = Matrix4::translation({0.0f, 1.0f, 0.0f});
+    data.transforms[5].transformation3D = Matrix4::rotationY(45.0_degf);
+    data.transforms[4].transformation3D = Matrix4::translation({0.0f, 0.0f, 1.0f});
+    const UnsignedInt objects[]{6, 5, 6, 0, 0};
+    absolute.update(objects);
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+
+    /* Doing that again should give the same result, i.e. there's no leftover
+       state from the previous update */
+    absolute.update(objects);
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::updateNotInHierarchy() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    AbsoluteTransformations3D absolute{scene};
+
+    /* Object 7 isn't in the hierarchy, so it's ignored and stays at
+       identity */
+    data.transforms[6].transformation3D = Matrix4::translation({3.0f, 3.0f, 3.0f});
+    absolute.update({7});
+    CORRADE_COMPARE(absolute.transformationFor(7), Matrix4{});
+
+    /* Empty update is a no-op */
+    absolute.update({});
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::updateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+    AbsoluteTransformations3D absolute{scene};
+
+    Containers::String out;
+    Error redirectError{&out};
+    absolute.update({3, 8});
+    CORRADE_COMPARE(out, "SceneTools::AbsoluteTransformations::update(): index 8 out of range for 8 objects\n");
+}
+
+void AbsoluteTransformationsTest::updateTranslationRotationScaling() {
+    /* Same hierarchy as in constructTranslationRotationScaling(), but with
+       all three TRS fields, one of them with doubles. Unlike the initial
+       calculation, update() converts the field data on its own, so compare
+       its output to a freshly constructed instance. */
+    struct Data {
+        struct Parent {
+            UnsignedInt object;
+            Int parent;
+        } parents[4];
+        struct Trs {
+            UnsignedInt object;
+            Vector3d translation;
+            Quaternion rotation;
+            Vector3 scaling;
+        } trs[3];
+    } data[]{{
+        {{2, 0}, {0, -1}, {1, 0}, {3, 1}},
+        {{3, {0.0, 0.0, 3.0}, Quaternion::rotation(35.0_degf, Vector3::yAxis()), {1.0f, 2.0f, 1.0f}},
+         {0, {1.0, 0.0, 0.0}, {}, Vector3{2.0f}},
+         {1, {0.0, 2.0, 0.0}, Quaternion::rotation(-15.0_degf, Vector3::xAxis()), {3.0f, 1.0f, 1.0f}}}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 4, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::object),
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::object),
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::translation)},
+        Trade::SceneFieldData{Trade::SceneField::Rotation,
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::object),
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::rotation)},
+        Trade::SceneFieldData{Trade::SceneField::Scaling,
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::object),
+            Containers::stridedArrayView(data->trs)
+                .slice(&Data::Trs::scaling)},
+    }};
+
+    AbsoluteTransformations3D absolute{scene};
+
+    data->trs[1].translation = {0.0, 0.0, -1.0};
+    data->trs[2].rotation = Quaternion::rotation(90.0_degf, Vector3::zAxis());
+    absolute.update({0, 1});
+    CORRADE_COMPARE(absolute.transformationFor(0),
+        Matrix4::translation({0.0f, 0.0f, -1.0f})*
+        Matrix4::scaling(Vector3{2.0f}));
+
+    AbsoluteTransformations3D expected{scene};
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected.transformations(),
+        TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::updateConvertedTransformation() {
+    /* Same as above, but with a 2D transformation field that isn't a
+       Matrix3 */
+    struct Data {
+        struct Parent {
+            UnsignedInt object;
+            Int parent;
+        } parents[4];
+        struct Transformation {
+            UnsignedInt object;
+            Matrix3x2d transformation;
+        } transformations[3];
+    } data[]{{
+        {{2, 0}, {0, -1}, {1, 0}, {3, 1}},
+        {{3, Matrix3x2d{Matrix3d::translation({0.0, 3.0})}},
+         {0, Matrix3x2d{Matrix3d::rotation(35.0_deg)}},
+         {1, Matrix3x2d{Matrix3d::scaling({2.0, 1.0})}}}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 4, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::object),
+            Containers::stridedArrayView(data->parents)
+                .slice(&Data::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data->transformations)
+                .slice(&Data::Transformation::object),
+            Containers::stridedArrayView(data->transformations)
+                .slice(&Data::Transformation::transformation)},
+    }};
+
+    AbsoluteTransformations2D absolute{scene};
+
+    data->transformations[1].transformation = Matrix3x2d{Matrix3d::translation({1.0, -1.0})};
+    absolute.update({0});
+    CORRADE_COMPARE(absolute.transformationFor(3),
+        Matrix3::translation({1.0f, -1.0f})*
+        Matrix3::scaling({2.0f, 1.0f})*
+        Matrix3::translation({0.0f, 3.0f}));
+
+    AbsoluteTransformations2D expected{scene};
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected.transformations(),
+        TestSuite::Compare::Container);
+}
+
+void AbsoluteTransformationsTest::updateAll() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    AbsoluteTransformations3D absolute{scene};
+
+    data.transforms[0].transformation3D = Matrix4::translation({0.0f, 1.0f, 0.0f});
+    data.transforms[3].transformation3D = Matrix4::rotationY(45.0_degf);
+    data.transforms[4].transformation3D = Matrix4::translation({0.0f, 0.0f, 1.0f});
+    absolute.updateAll();
+    CORRADE_COMPARE_AS(absolute.transformations(),
+        expected3D(data),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::AbsoluteTransformationsTest)
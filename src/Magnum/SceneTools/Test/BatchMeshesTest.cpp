@@ -0,0 +1,304 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneTools/BatchMeshes.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct BatchMeshesTest: TestSuite::Tester {
+    explicit BatchMeshesTest();
+
+    void batchMeshes();
+    void batchMeshesNoMeshField();
+    void batchMeshesInvalid();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} BatchMeshesData[]{
+    {"single thread", 1},
+    {"four threads", 4},
+    {"autodetected thread count", 0},
+};
+
+BatchMeshesTest::BatchMeshesTest() {
+    addInstancedTests({&BatchMeshesTest::batchMeshes},
+        Containers::arraySize(BatchMeshesData));
+
+    addTests({&BatchMeshesTest::batchMeshesNoMeshField,
+              &BatchMeshesTest::batchMeshesInvalid});
+}
+
+void BatchMeshesTest::batchMeshes() {
+    auto&& data = BatchMeshesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const struct {
+        UnsignedInt parentMapping[6]{0, 1, 2, 3, 4, 5};
+        Int parents[6]{-1, 0, -1, 0, -1, -1};
+        UnsignedInt translationMapping[3]{0, 1, 4};
+        Vector3 translations[3]{
+            {10.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 5.0f}
+        };
+        UnsignedInt meshMapping[5]{1, 2, 3, 4, 5};
+        UnsignedInt meshes[5]{0, 1, 0, 2, 1};
+        Int meshMaterials[5]{2, -1, 2, 2, 0};
+    } sceneData[1];
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 6, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(sceneData->parentMapping),
+            Containers::arrayView(sceneData->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(sceneData->translationMapping),
+            Containers::arrayView(sceneData->translations)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(sceneData->meshMapping),
+            Containers::arrayView(sceneData->meshes)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(sceneData->meshMapping),
+            Containers::arrayView(sceneData->meshMaterials)},
+    }};
+
+    /* Mesh 0 and 1 have the same layout even though one is indexed and the
+       other not, mesh 2 has normals in addition */
+    const UnsignedShort indices0[]{0, 1, 2};
+    const Vector3 positions0[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    };
+    const Vector3 positions1[]{
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f}
+    };
+    const struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+    } vertices2[]{
+        {{0.0f, 0.0f, 0.0f}, Vector3::zAxis()},
+        {{1.0f, 0.0f, 0.0f}, Vector3::zAxis()},
+        {{0.0f, 1.0f, 0.0f}, Vector3::zAxis()},
+    };
+    const Containers::StridedArrayView1D<const Vertex> vertices2View = vertices2;
+    const Trade::MeshData meshes[]{
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, indices0, Trade::MeshIndexData{indices0},
+            {}, positions0, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions0)}
+            }},
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, positions1, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, Containers::arrayView(positions1)}
+            }},
+        Trade::MeshData{MeshPrimitive::Triangles,
+            {}, vertices2, {
+                Trade::MeshAttributeData{Trade::MeshAttribute::Position, vertices2View.slice(&Vertex::position)},
+                Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertices2View.slice(&Vertex::normal)}
+            }},
+    };
+
+    Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>> out = SceneTools::batchMeshes3D(scene, meshes, data.threadCount);
+
+    /* One object for each batch, sorted by material, with meshes of the same
+       material and different layout being separate batches */
+    CORRADE_COMPARE(out.first().mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(out.first().mappingBound(), 4);
+    CORRADE_COMPARE(out.first().fieldCount(), 3);
+    CORRADE_COMPARE(out.first().fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(out.first().mapping<UnsignedInt>(Trade::SceneField::Parent),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView<Int>({-1, -1, -1, -1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().field<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.first().field<Int>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Int>({-1, 0, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(out.first().mapping(Trade::SceneField::Mesh).data(), out.first().mapping(Trade::SceneField::Parent).data());
+    CORRADE_COMPARE(out.first().mapping(Trade::SceneField::MeshMaterial).data(), out.first().mapping(Trade::SceneField::Parent).data());
+
+    CORRADE_COMPARE(out.second().size(), 4);
+
+    /* Object 2 with no material and no transformation */
+    CORRADE_VERIFY(!out.second()[0].isIndexed());
+    CORRADE_COMPARE_AS(out.second()[0].attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(positions1),
+        TestSuite::Compare::Container);
+
+    /* Object 5 with material 0 and no transformation */
+    CORRADE_VERIFY(!out.second()[1].isIndexed());
+    CORRADE_COMPARE_AS(out.second()[1].attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView(positions1),
+        TestSuite::Compare::Container);
+
+    /* Objects 1 and 3, with the transformation of the parent baked in, in
+       the original relative order */
+    CORRADE_COMPARE(out.second()[2].indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(out.second()[2].indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 4, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second()[2].attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {10.0f, 1.0f, 0.0f},
+            {11.0f, 1.0f, 0.0f},
+            {10.0f, 2.0f, 0.0f},
+            {10.0f, 0.0f, 0.0f},
+            {11.0f, 0.0f, 0.0f},
+            {10.0f, 1.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+
+    /* Object 4 with normals, which aren't affected by the translation */
+    CORRADE_VERIFY(!out.second()[3].isIndexed());
+    CORRADE_COMPARE_AS(out.second()[3].attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 5.0f},
+            {1.0f, 0.0f, 5.0f},
+            {0.0f, 1.0f, 5.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.second()[3].attribute<Vector3>(Trade::MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+            Vector3::zAxis(),
+        }), TestSuite::Compare::Container);
+}
+
+void BatchMeshesTest::batchMeshesNoMeshField() {
+    const struct {
+        UnsignedInt mapping[2]{0, 1};
+        Int parents[2]{-1, 0};
+        Vector3 translations[2]{};
+    } data[1];
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->translations)},
+    }};
+
+    Containers::Pair<Trade::SceneData, Containers::Array<Trade::MeshData>> out = SceneTools::batchMeshes3D(scene, Containers::ArrayView<const Trade::MeshData>{});
+    CORRADE_COMPARE(out.first().mappingBound(), 0);
+    CORRADE_COMPARE(out.first().fieldCount(), 0);
+    CORRADE_COMPARE(out.second().size(), 0);
+}
+
+void BatchMeshesTest::batchMeshesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedInt mapping[1]{0};
+        Int parents[1]{-1};
+        Vector3 translations[1]{};
+        UnsignedInt meshes[1]{};
+    } data[1];
+
+    Trade::SceneData notThreeD{Trade::SceneMappingType::UnsignedInt, 1, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+    }};
+    Trade::SceneData noHierarchy{Trade::SceneMappingType::UnsignedInt, 1, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->translations)},
+    }};
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 1, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->translations)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+    }};
+
+    const UnsignedShort indices[3]{};
+    Trade::MeshData strip{MeshPrimitive::TriangleStrip, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+    }};
+    Trade::MeshData implementationSpecificIndexType{MeshPrimitive::Triangles,
+        {}, indices, Trade::MeshIndexData{meshIndexTypeWrap(0xcaca), Containers::stridedArrayView(indices)},
+        {}, nullptr, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr}
+        }};
+    Trade::MeshData implementationSpecificVertexFormat{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector3, nullptr},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, vertexFormatWrap(0xdead), nullptr}
+    }};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Normal, VertexFormat::Vector3, nullptr}
+    }};
+    Trade::MeshData positions2D{MeshPrimitive::Triangles, nullptr, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position, VertexFormat::Vector2, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::batchMeshes3D(notThreeD, {strip});
+    SceneTools::batchMeshes3D(noHierarchy, {strip});
+    SceneTools::batchMeshes3D(scene, Containers::ArrayView<const Trade::MeshData>{});
+    SceneTools::batchMeshes3D(scene, {strip});
+    SceneTools::batchMeshes3D(scene, {implementationSpecificIndexType});
+    SceneTools::batchMeshes3D(scene, {implementationSpecificVertexFormat});
+    SceneTools::batchMeshes3D(scene, {noPositions});
+    SceneTools::batchMeshes3D(scene, {positions2D});
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::batchMeshes3D(): the scene is not 3D\n"
+        "SceneTools::batchMeshes3D(): the scene has no hierarchy\n"
+        "SceneTools::batchMeshes3D(): index 0 out of range for 0 meshes\n"
+        "SceneTools::batchMeshes3D(): can't concatenate mesh 0 with MeshPrimitive::TriangleStrip\n"
+        "SceneTools::batchMeshes3D(): mesh 0 has an implementation-specific index type 0xcaca\n"
+        "SceneTools::batchMeshes3D(): attribute 1 of mesh 0 has an implementation-specific format 0xdead\n"
+        "SceneTools::batchMeshes3D(): mesh 0 has no positions\n"
+        "SceneTools::batchMeshes3D(): expected 3D positions in mesh 0 but got VertexFormat::Vector2\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::BatchMeshesTest)
@@ -0,0 +1,526 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/BoundingVolumeHierarchy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct BoundingVolumeHierarchyTest: TestSuite::Tester {
+    explicit BoundingVolumeHierarchyTest();
+
+    void construct();
+    void constructEmpty();
+    void constructSingleLeaf();
+    void constructScene();
+    void constructSceneNoTransformations();
+    void constructInvalid();
+    void constructSceneInvalid();
+    void constructCopy();
+    void constructMove();
+
+    void queryOutputTooSmall();
+
+    void refit();
+    void refitScene();
+    void refitInvalid();
+    void update();
+    void updateInvalid();
+
+    void multipleThreads();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"autodetected thread count", 0}
+};
+
+BoundingVolumeHierarchyTest::BoundingVolumeHierarchyTest() {
+    addTests({&BoundingVolumeHierarchyTest::construct,
+              &BoundingVolumeHierarchyTest::constructEmpty,
+              &BoundingVolumeHierarchyTest::constructSingleLeaf,
+              &BoundingVolumeHierarchyTest::constructScene,
+              &BoundingVolumeHierarchyTest::constructSceneNoTransformations,
+              &BoundingVolumeHierarchyTest::constructInvalid,
+              &BoundingVolumeHierarchyTest::constructSceneInvalid,
+              &BoundingVolumeHierarchyTest::constructCopy,
+              &BoundingVolumeHierarchyTest::constructMove,
+
+              &BoundingVolumeHierarchyTest::queryOutputTooSmall,
+
+              &BoundingVolumeHierarchyTest::refit,
+              &BoundingVolumeHierarchyTest::refitScene,
+              &BoundingVolumeHierarchyTest::refitInvalid,
+              &BoundingVolumeHierarchyTest::update,
+              &BoundingVolumeHierarchyTest::updateInvalid});
+
+    addInstancedTests({&BoundingVolumeHierarchyTest::multipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+}
+
+/* Unit boxes along the X axis, with a gap of one unit between each, and
+   object IDs starting from 100 */
+const UnsignedInt LineObjects[]{
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109
+};
+const Range3D LineBounds[]{
+    {{ 0.0f, 0.0f, 0.0f}, { 1.0f, 1.0f, 1.0f}},
+    {{ 2.0f, 0.0f, 0.0f}, { 3.0f, 1.0f, 1.0f}},
+    {{ 4.0f, 0.0f, 0.0f}, { 5.0f, 1.0f, 1.0f}},
+    {{ 6.0f, 0.0f, 0.0f}, { 7.0f, 1.0f, 1.0f}},
+    {{ 8.0f, 0.0f, 0.0f}, { 9.0f, 1.0f, 1.0f}},
+    {{10.0f, 0.0f, 0.0f}, {11.0f, 1.0f, 1.0f}},
+    {{12.0f, 0.0f, 0.0f}, {13.0f, 1.0f, 1.0f}},
+    {{14.0f, 0.0f, 0.0f}, {15.0f, 1.0f, 1.0f}},
+    {{16.0f, 0.0f, 0.0f}, {17.0f, 1.0f, 1.0f}},
+    {{18.0f, 0.0f, 0.0f}, {19.0f, 1.0f, 1.0f}},
+};
+
+void BoundingVolumeHierarchyTest::construct() {
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+    CORRADE_COMPARE(bvh.instanceCount(), 10);
+    /* Root, two children with 5 instances, each split into two leaves */
+    CORRADE_COMPARE(bvh.nodeCount(), 7);
+    CORRADE_COMPARE_AS(bvh.objects(),
+        Containers::arrayView(LineObjects),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.instanceBounds(),
+        Containers::arrayView(LineBounds),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{0.0f, 0.0f, 0.0f}, {19.0f, 1.0f, 1.0f}}));
+
+    /* The left subtree is always visited first and instances in leaves are
+       in their original order, which means the output is ordered along the X
+       axis */
+    UnsignedInt objects[10];
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{3.5f, 0.5f, 0.5f}, {6.5f, 2.0f, 2.0f}}, objects), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects).prefix(2),
+        Containers::arrayView<UnsignedInt>({102, 103}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-5.0f, 2.0f, 0.0f}, {25.0f, 3.0f, 1.0f}}, objects), 0);
+
+    /* Plane equations with the inside in the positive direction */
+    const Frustum frustum{
+        {1.0f, 0.0f, 0.0f, -3.5f},
+        {-1.0f, 0.0f, 0.0f, 6.5f},
+        {0.0f, 1.0f, 0.0f, 10.0f},
+        {0.0f, -1.0f, 0.0f, 10.0f},
+        {0.0f, 0.0f, 1.0f, 10.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+    CORRADE_COMPARE(bvh.objectsInFrustumInto(frustum, objects), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects).prefix(2),
+        Containers::arrayView<UnsignedInt>({102, 103}),
+        TestSuite::Compare::Container);
+
+    /* The whole line */
+    CORRADE_COMPARE(bvh.objectsOnRayInto({-1.0f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}, objects), 10);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects),
+        Containers::arrayView<UnsignedInt>({100, 101, 102, 103, 104, 105, 106, 107, 108, 109}),
+        TestSuite::Compare::Container);
+
+    /* Boxes behind the ray origin aren't included, the one the origin is
+       inside of is */
+    CORRADE_COMPARE(bvh.objectsOnRayInto({12.5f, 0.5f, 0.5f}, {2.0f, 0.0f, 0.0f}, objects), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects).prefix(4),
+        Containers::arrayView<UnsignedInt>({106, 107, 108, 109}),
+        TestSuite::Compare::Container);
+
+    /* A diagonal ray missing everything */
+    CORRADE_COMPARE(bvh.objectsOnRayInto({-1.0f, 2.0f, 0.5f}, {1.0f, 1.0f, 0.0f}, objects), 0);
+}
+
+void BoundingVolumeHierarchyTest::constructEmpty() {
+    BoundingVolumeHierarchy bvh{nullptr, nullptr};
+    CORRADE_COMPARE(bvh.instanceCount(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.bounds(), Range3D{});
+
+    UnsignedInt objects[1];
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}, objects), 0);
+}
+
+void BoundingVolumeHierarchyTest::constructSingleLeaf() {
+    BoundingVolumeHierarchy bvh{
+        Containers::arrayView(LineObjects).prefix(BoundingVolumeHierarchy::LeafSize),
+        Containers::arrayView(LineBounds).prefix(BoundingVolumeHierarchy::LeafSize)};
+    CORRADE_COMPARE(bvh.instanceCount(), 4);
+    CORRADE_COMPARE(bvh.nodeCount(), 1);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{0.0f, 0.0f, 0.0f}, {7.0f, 1.0f, 1.0f}}));
+
+    UnsignedInt objects[4];
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-1.0f, 0.0f, 0.0f}, {20.0f, 1.0f, 1.0f}}, objects), 4);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects),
+        Containers::arrayView<UnsignedInt>({100, 101, 102, 103}),
+        TestSuite::Compare::Container);
+}
+
+struct Scene {
+    struct Parent {
+        UnsignedInt object;
+        Int parent;
+    } parents[4];
+    struct Transformation {
+        UnsignedInt object;
+        Matrix4 transformation;
+    } transforms[3];
+    struct Mesh {
+        UnsignedInt object;
+        UnsignedInt mesh;
+    } meshes[4];
+};
+
+Scene sceneData() {
+    return Scene{
+        {{0, -1}, {1, 0}, {2, 0}, {3, -1}},
+        {{0, Matrix4::translation({10.0f, 0.0f, 0.0f})},
+         {1, Matrix4::rotationZ(90.0_degf)},
+         {2, Matrix4::scaling({2.0f, 3.0f, 4.0f})}},
+        /* Object 1 has two meshes */
+        {{3, 1}, {1, 0}, {2, 1}, {1, 1}}
+    };
+}
+
+Trade::SceneData scene3D(Scene& data) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 4, Trade::DataFlag::Mutable, Containers::arrayView(&data, 1), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::object),
+            Containers::stridedArrayView(data.parents)
+                .slice(&Scene::Parent::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::object),
+            Containers::stridedArrayView(data.transforms)
+                .slice(&Scene::Transformation::transformation)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::object),
+            Containers::stridedArrayView(data.meshes)
+                .slice(&Scene::Mesh::mesh)},
+    }};
+}
+
+const Range3D MeshBounds[]{
+    {{0.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 1.0f}},
+    {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+};
+
+void BoundingVolumeHierarchyTest::constructScene() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    BoundingVolumeHierarchy bvh{scene, MeshBounds};
+    CORRADE_COMPARE(bvh.instanceCount(), 4);
+    CORRADE_COMPARE_AS(bvh.objects(),
+        Containers::arrayView<UnsignedInt>({3, 1, 2, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.instanceBounds(), Containers::arrayView<Range3D>({
+        /* Object 3 has no transformation */
+        {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+        /* Object 1 is translated by the parent and rotated */
+        {{9.0f, 0.0f, 0.0f}, {10.0f, 2.0f, 1.0f}},
+        /* Object 2 is translated by the parent and scaled */
+        {{8.0f, -3.0f, -4.0f}, {12.0f, 3.0f, 4.0f}},
+        {{9.0f, -1.0f, -1.0f}, {11.0f, 1.0f, 1.0f}},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{-1.0f, -3.0f, -4.0f}, {12.0f, 3.0f, 4.0f}}));
+
+    UnsignedInt objects[4];
+    CORRADE_COMPARE(bvh.objectsOnRayInto({9.5f, 1.5f, 10.0f}, {0.0f, 0.0f, -1.0f}, objects), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects).prefix(2),
+        Containers::arrayView<UnsignedInt>({1, 2}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::constructSceneNoTransformations() {
+    const struct {
+        UnsignedInt mapping[2]{5, 1};
+        UnsignedInt meshes[2]{1, 0};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 6, {}, data, {
+        /* To mark the scene as 3D */
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Matrix4x4, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+    }};
+
+    BoundingVolumeHierarchy bvh{scene, MeshBounds};
+    CORRADE_COMPARE_AS(bvh.objects(),
+        Containers::arrayView<UnsignedInt>({5, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(bvh.instanceBounds(), Containers::arrayView<Range3D>({
+        MeshBounds[1],
+        MeshBounds[0]
+    }), TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::constructInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    BoundingVolumeHierarchy{Containers::arrayView(LineObjects).exceptSuffix(1), LineBounds};
+    CORRADE_COMPARE(out, "SceneTools::BoundingVolumeHierarchy: expected the same number of objects and bounds but got 9 and 10\n");
+}
+
+void BoundingVolumeHierarchyTest::constructSceneInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    Trade::SceneData scene2D{Trade::SceneMappingType::UnsignedInt, 1, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Matrix3x3, nullptr},
+    }};
+    Trade::SceneData noMeshes{Trade::SceneMappingType::UnsignedInt, 1, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Matrix4x4, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    BoundingVolumeHierarchy{scene2D, MeshBounds};
+    BoundingVolumeHierarchy{noMeshes, MeshBounds};
+    BoundingVolumeHierarchy{scene, Containers::arrayView(MeshBounds).prefix(1)};
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::BoundingVolumeHierarchy: the scene is not 3D\n"
+        "SceneTools::BoundingVolumeHierarchy: the scene has no meshes\n"
+        "SceneTools::BoundingVolumeHierarchy: mesh 1 out of range for 1 mesh bounds\n",
+        TestSuite::Compare::String);
+}
+
+void BoundingVolumeHierarchyTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<BoundingVolumeHierarchy>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<BoundingVolumeHierarchy>{});
+}
+
+void BoundingVolumeHierarchyTest::constructMove() {
+    BoundingVolumeHierarchy a{LineObjects, LineBounds};
+
+    BoundingVolumeHierarchy b = Utility::move(a);
+    CORRADE_COMPARE(b.instanceCount(), 10);
+    CORRADE_COMPARE(b.nodeCount(), 7);
+
+    BoundingVolumeHierarchy c{nullptr, nullptr};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.instanceCount(), 10);
+    CORRADE_COMPARE(c.nodeCount(), 7);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BoundingVolumeHierarchy>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BoundingVolumeHierarchy>::value);
+}
+
+void BoundingVolumeHierarchyTest::queryOutputTooSmall() {
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+
+    /* Only the first three get written, but the total count is returned */
+    UnsignedInt objects[5]{};
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-1.0f, 0.0f, 0.0f}, {20.0f, 1.0f, 1.0f}}, Containers::arrayView(objects).prefix(3)), 10);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects),
+        Containers::arrayView<UnsignedInt>({100, 101, 102, 0, 0}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-1.0f, 0.0f, 0.0f}, {20.0f, 1.0f, 1.0f}}, nullptr), 10);
+}
+
+void BoundingVolumeHierarchyTest::refit() {
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+
+    /* Move everything up by 10 units and the first instance far away */
+    Range3D bounds[10];
+    for(std::size_t i = 0; i != 10; ++i)
+        bounds[i] = LineBounds[i].translated({0.0f, 10.0f, 0.0f});
+    bounds[0] = bounds[0].translated({100.0f, 0.0f, 0.0f});
+
+    bvh.refit(bounds);
+    CORRADE_COMPARE(bvh.nodeCount(), 7);
+    CORRADE_COMPARE_AS(bvh.instanceBounds(),
+        Containers::arrayView(bounds),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{2.0f, 10.0f, 0.0f}, {101.0f, 11.0f, 1.0f}}));
+
+    UnsignedInt objects[10];
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{0.0f, 0.0f, 0.0f}, {20.0f, 1.0f, 1.0f}}, objects), 0);
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{95.0f, 10.0f, 0.0f}, {105.0f, 11.0f, 1.0f}}, objects), 1);
+    CORRADE_COMPARE(objects[0], 100);
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{3.5f, 10.5f, 0.5f}, {6.5f, 12.0f, 2.0f}}, objects), 2);
+    CORRADE_COMPARE_AS(Containers::arrayView(objects).prefix(2),
+        Containers::arrayView<UnsignedInt>({102, 103}),
+        TestSuite::Compare::Container);
+}
+
+void BoundingVolumeHierarchyTest::refitScene() {
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    BoundingVolumeHierarchy bvh{scene, MeshBounds};
+
+    /* Move the root object */
+    data.transforms[0].transformation = Matrix4::translation({-10.0f, 0.0f, 0.0f});
+    bvh.refit(scene, MeshBounds);
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{-12.0f, -3.0f, -4.0f}, {1.0f, 3.0f, 4.0f}}));
+    CORRADE_COMPARE(bvh.instanceBounds()[1], (Range3D{{-11.0f, 0.0f, 0.0f}, {-10.0f, 2.0f, 1.0f}}));
+}
+
+void BoundingVolumeHierarchyTest::refitInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Scene data = sceneData();
+    Trade::SceneData scene = scene3D(data);
+
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+
+    Containers::String out;
+    Error redirectError{&out};
+    bvh.refit(Containers::arrayView(LineBounds).exceptSuffix(1));
+    bvh.refit(scene, MeshBounds);
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::BoundingVolumeHierarchy::refit(): expected 10 bounds but got 9\n"
+        "SceneTools::BoundingVolumeHierarchy::refit(): expected 10 mesh instances but got 4\n",
+        TestSuite::Compare::String);
+}
+
+void BoundingVolumeHierarchyTest::update() {
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+
+    /* Move object 104 to the front and object 106 up. The bounds of the
+       whole tree should grow on both sides. */
+    bvh.update(Containers::arrayView<UnsignedInt>({4, 6}), Containers::arrayView<Range3D>({
+        {{-10.0f, 0.0f, 0.0f}, {-9.0f, 1.0f, 1.0f}},
+        {{12.0f, 10.0f, 0.0f}, {13.0f, 11.0f, 1.0f}}
+    }));
+    CORRADE_COMPARE(bvh.instanceBounds()[4], (Range3D{{-10.0f, 0.0f, 0.0f}, {-9.0f, 1.0f, 1.0f}}));
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{-10.0f, 0.0f, 0.0f}, {19.0f, 11.0f, 1.0f}}));
+
+    UnsignedInt objects[10];
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{-11.0f, 0.0f, 0.0f}, {-8.0f, 1.0f, 1.0f}}, objects), 1);
+    CORRADE_COMPARE(objects[0], 104);
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{11.5f, 0.0f, 0.0f}, {13.5f, 1.0f, 1.0f}}, objects), 0);
+    CORRADE_COMPARE(bvh.objectsInRangeInto({{11.5f, 10.0f, 0.0f}, {13.5f, 11.0f, 1.0f}}, objects), 1);
+    CORRADE_COMPARE(objects[0], 106);
+
+    /* Moving the object back shrinks the bounds again, giving the same result
+       as if the whole tree was refit */
+    bvh.update(Containers::arrayView<UnsignedInt>({4}), Containers::arrayView(LineBounds).slice(4, 5));
+    CORRADE_COMPARE(bvh.bounds(), (Range3D{{0.0f, 0.0f, 0.0f}, {19.0f, 11.0f, 1.0f}}));
+
+    Range3D bounds[10];
+    Utility::copy(bvh.instanceBounds(), bounds);
+    BoundingVolumeHierarchy fullRefit{LineObjects, LineBounds};
+    fullRefit.refit(bounds);
+    CORRADE_COMPARE(fullRefit.bounds(), bvh.bounds());
+}
+
+void BoundingVolumeHierarchyTest::updateInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    BoundingVolumeHierarchy bvh{LineObjects, LineBounds};
+
+    Containers::String out;
+    Error redirectError{&out};
+    bvh.update(Containers::arrayView<UnsignedInt>({4, 6}), Containers::arrayView(LineBounds).prefix(1));
+    bvh.update(Containers::arrayView<UnsignedInt>({10}), Containers::arrayView(LineBounds).prefix(1));
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::BoundingVolumeHierarchy::update(): expected the same number of instances and bounds but got 2 and 1\n"
+        "SceneTools::BoundingVolumeHierarchy::update(): index 10 out of range for 10 instances\n",
+        TestSuite::Compare::String);
+}
+
+void BoundingVolumeHierarchyTest::multipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to not be processed on a single thread, with the
+       instances scattered in a pseudorandom way */
+    Containers::Array<UnsignedInt> objects{NoInit, 200000};
+    Containers::Array<Range3D> bounds{NoInit, 200000};
+    for(UnsignedInt i = 0; i != objects.size(); ++i) {
+        objects[i] = i;
+        const Vector3 center{
+            Float((i*7919u)%1000u),
+            Float((i*6271u)%997u),
+            Float((i*4441u)%991u)};
+        bounds[i] = Range3D::fromCenter(center, Vector3{0.5f + (i % 7)*0.25f});
+    }
+
+    BoundingVolumeHierarchy expected{objects, bounds};
+    BoundingVolumeHierarchy bvh{objects, bounds, data.threadCount};
+    CORRADE_COMPARE(bvh.nodeCount(), expected.nodeCount());
+    CORRADE_COMPARE(bvh.bounds(), expected.bounds());
+
+    /* The tree structure is the same regardless of thread count, so the
+       queries produce the same output in the same order */
+    Containers::Array<UnsignedInt> expectedOut{NoInit, objects.size()};
+    Containers::Array<UnsignedInt> out{NoInit, objects.size()};
+    const Range3D range{{100.0f, 200.0f, 300.0f}, {400.0f, 500.0f, 600.0f}};
+    const std::size_t expectedCount = expected.objectsInRangeInto(range, expectedOut);
+    CORRADE_COMPARE_AS(expectedCount, std::size_t{1000}, TestSuite::Compare::Greater);
+    CORRADE_COMPARE(bvh.objectsInRangeInto(range, out), expectedCount);
+    CORRADE_COMPARE_AS(out.prefix(expectedCount),
+        expectedOut.prefix(expectedCount),
+        TestSuite::Compare::Container);
+
+    /* Refitting in parallel gives the same result as well */
+    for(Range3D& i: bounds)
+        i = i.translated({1.0f, 2.0f, 3.0f});
+    expected.refit(bounds);
+    bvh.refit(bounds, data.threadCount);
+    CORRADE_COMPARE(bvh.bounds(), expected.bounds());
+    const std::size_t expectedRefitCount = expected.objectsInRangeInto(range, expectedOut);
+    CORRADE_COMPARE(bvh.objectsInRangeInto(range, out), expectedRefitCount);
+    CORRADE_COMPARE_AS(out.prefix(expectedRefitCount),
+        expectedOut.prefix(expectedRefitCount),
+        TestSuite::Compare::Container);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::BoundingVolumeHierarchyTest)
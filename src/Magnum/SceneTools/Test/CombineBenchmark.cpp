@@ -0,0 +1,136 @@
+/*
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneTools/Combine.h"
+#include "Magnum/SceneTools/Copy.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct CombineBenchmark: TestSuite::Tester {
+    explicit CombineBenchmark();
+
+    void combineFields();
+    void copy();
+
+    private:
+        Containers::Array<char> _data;
+        Containers::Optional<Trade::SceneData> _scene;
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadCountData[]{
+    {"single thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"autodetected thread count", 0},
+};
+
+/* Large enough for the parallel processing to make sense */
+constexpr std::size_t ObjectCount = 1000000;
+
+CombineBenchmark::CombineBenchmark() {
+    addInstancedBenchmarks({&CombineBenchmark::combineFields,
+                            &CombineBenchmark::copy}, 10,
+        Containers::arraySize(ThreadCountData));
+
+    /* A typical scene with a hierarchy, TRS transformations and a mesh with
+       a material assigned to each object, all interleaved so the
+       combineFields() has to do a strided copy */
+    struct Object {
+        UnsignedInt mapping;
+        Int parent;
+        Vector3 translation;
+        Quaternion rotation;
+        Vector3 scaling;
+        UnsignedInt mesh;
+        Int meshMaterial;
+    };
+    _data = Containers::Array<char>{NoInit, ObjectCount*sizeof(Object)};
+    const Containers::ArrayView<Object> objects = Containers::arrayCast<Object>(_data);
+    for(std::size_t i = 0; i != ObjectCount; ++i) {
+        objects[i].mapping = i;
+        objects[i].parent = Int(i/2) - 1;
+        objects[i].translation = Vector3{Float(i)};
+        objects[i].rotation = Quaternion{};
+        objects[i].scaling = Vector3{1.0f};
+        objects[i].mesh = i % 17;
+        objects[i].meshMaterial = i % 5;
+    }
+
+    const Containers::StridedArrayView1D<Object> view = objects;
+    _scene.emplace(Trade::SceneMappingType::UnsignedInt, ObjectCount, Trade::DataFlags{}, _data, Containers::array({
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&Object::mapping), view.slice(&Object::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            view.slice(&Object::mapping), view.slice(&Object::translation)},
+        Trade::SceneFieldData{Trade::SceneField::Rotation,
+            view.slice(&Object::mapping), view.slice(&Object::rotation)},
+        Trade::SceneFieldData{Trade::SceneField::Scaling,
+            view.slice(&Object::mapping), view.slice(&Object::scaling)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            view.slice(&Object::mapping), view.slice(&Object::mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            view.slice(&Object::mapping), view.slice(&Object::meshMaterial)},
+    }));
+}
+
+void CombineBenchmark::combineFields() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size = SceneTools::combineFields(*_scene, data.threadCount).data().size();
+
+    /* The mapping is shared by all fields, so it's there just once */
+    CORRADE_COMPARE(size, ObjectCount*(4 + 4 + 12 + 16 + 12 + 4 + 4));
+}
+
+void CombineBenchmark::copy() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size = SceneTools::copy(*_scene, data.threadCount).data().size();
+
+    CORRADE_COMPARE(size, _data.size());
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::CombineBenchmark)
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -53,6 +54,7 @@ struct CombineTest: TestSuite::Tester {
     void fieldsMappingSharedFieldPlaceholder();
     void fieldsMappingSharedTRSPlaceholder();
     void fieldsMappingSharedMeshMaterialPlaceholder();
+    void fieldsMultipleThreads();
 
     void fieldsSharedMappingExpected();
     void fieldsStringPlaceholder();
@@ -148,6 +150,15 @@ const struct {
         true},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} FieldsMultipleThreadsData[]{
+    {"single thread", 1},
+    {"4 threads", 4},
+    {"autodetected thread count", 0},
+};
+
 CombineTest::CombineTest() {
     addInstancedTests({&CombineTest::fields},
         Containers::arraySize(FieldsData));
@@ -169,6 +180,9 @@ CombineTest::CombineTest() {
     addInstancedTests({&CombineTest::fieldsMappingSharedMeshMaterialPlaceholder},
         Containers::arraySize(FieldsMappingSharedMeshMaterialPlaceholderData));
 
+    addInstancedTests({&CombineTest::fieldsMultipleThreads},
+        Containers::arraySize(FieldsMultipleThreadsData));
+
     addTests({&CombineTest::fieldsSharedMappingExpected,
               &CombineTest::fieldsStringPlaceholder,
               &CombineTest::fieldsOffsetOnly,
@@ -984,6 +998,79 @@ void CombineTest::fieldsMappingSharedMeshMaterialPlaceholder() {
         TestSuite::Compare::Container);
 }
 
+void CombineTest::fieldsMultipleThreads() {
+    auto&& data = FieldsMultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough for the fields to get split into multiple chunks, mapping
+       of different types to test casting, a shared mapping, a bit field and
+       a string field */
+    const std::size_t count = 100000;
+    Containers::Array<UnsignedInt> meshMapping{NoInit, count};
+    Containers::Array<UnsignedShort> meshes{NoInit, count};
+    Containers::Array<Int> meshMaterials{NoInit, count};
+    Containers::Array<UnsignedLong> parentMapping{NoInit, count};
+    Containers::Array<UnsignedInt> parentMappingExpected{NoInit, count};
+    Containers::Array<Int> parents{NoInit, count};
+    Containers::BitArray visible{ValueInit, count};
+    Containers::Array<UnsignedInt> nameOffsets{NoInit, count};
+    Containers::String names{NoInit, count};
+    for(std::size_t i = 0; i != count; ++i) {
+        meshMapping[i] = count - i - 1;
+        meshes[i] = i % 3;
+        meshMaterials[i] = Int(i % 7) - 1;
+        parentMapping[i] = i;
+        parentMappingExpected[i] = i;
+        parents[i] = Int(i) - 1;
+        if(i % 5 == 0) visible.set(i);
+        nameOffsets[i] = i + 1;
+        names[i] = 'a' + i % 26;
+    }
+
+    Trade::SceneData scene = combineFields(Trade::SceneMappingType::UnsignedInt, count, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(meshMapping),
+            Containers::arrayView(meshes)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(meshMapping),
+            Containers::arrayView(meshMaterials)},
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(parentMapping),
+            Containers::arrayView(parents)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(0),
+            Containers::arrayView(parentMapping),
+            Containers::StridedBitArrayView1D{visible}},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(1),
+            Containers::arrayView(meshMapping),
+            names.data(), Trade::SceneFieldType::StringOffset32,
+            Containers::arrayView(nameOffsets)},
+    }, data.threadCount);
+
+    CORRADE_COMPARE(scene.fieldCount(), 5);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        meshMapping,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<UnsignedShort>(Trade::SceneField::Mesh),
+        meshes,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.mapping(Trade::SceneField::MeshMaterial).data(), scene.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE_AS(scene.field<Int>(Trade::SceneField::MeshMaterial),
+        meshMaterials,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(Trade::SceneField::Parent),
+        parentMappingExpected,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Int>(Trade::SceneField::Parent),
+        parents,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.fieldBits(Trade::sceneFieldCustom(0)),
+        Containers::StridedBitArrayView1D{visible},
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene.mapping(Trade::sceneFieldCustom(1)).data(), scene.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE(Containers::StringView{scene.fieldStringData(Trade::sceneFieldCustom(1)), count}, names);
+    CORRADE_COMPARE(scene.fieldStrings(Trade::sceneFieldCustom(1))[count - 1], "d");
+}
+
 void CombineTest::fieldsSharedMappingExpected() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
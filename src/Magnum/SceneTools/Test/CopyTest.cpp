@@ -40,6 +40,7 @@ struct CopyTest: TestSuite::Tester {
     explicit CopyTest();
 
     void copy();
+    void copyMultipleThreads();
 
     void copyRvalueNotOwned();
     void copyRvalueDataFieldsOwned();
@@ -54,10 +55,22 @@ struct CopyTest: TestSuite::Tester {
     void mutableReferenceNotMutable();
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} CopyMultipleThreadsData[]{
+    {"single thread", 1},
+    {"4 threads", 4},
+    {"autodetected thread count", 0},
+};
+
 CopyTest::CopyTest() {
-    addTests({&CopyTest::copy,
+    addTests({&CopyTest::copy});
 
-              &CopyTest::copyRvalueNotOwned,
+    addInstancedTests({&CopyTest::copyMultipleThreads},
+        Containers::arraySize(CopyMultipleThreadsData));
+
+    addTests({&CopyTest::copyRvalueNotOwned,
               &CopyTest::copyRvalueDataFieldsOwned,
               &CopyTest::copyRvalueDataOwned,
               &CopyTest::copyRvalueFieldsOwned,
@@ -188,6 +201,38 @@ void CopyTest::copy() {
     CORRADE_VERIFY(!fieldData.deleter());
 }
 
+void CopyTest::copyMultipleThreads() {
+    auto&& data = CopyMultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough for the data to get split into multiple chunks */
+    const std::size_t count = 1000000;
+    Containers::Array<char> sceneData{NoInit, count*(sizeof(UnsignedInt) + sizeof(Int))};
+    const Containers::ArrayView<UnsignedInt> mapping = Containers::arrayCast<UnsignedInt>(sceneData.prefix(count*sizeof(UnsignedInt)));
+    const Containers::ArrayView<Int> parents = Containers::arrayCast<Int>(sceneData.exceptPrefix(count*sizeof(UnsignedInt)));
+    for(std::size_t i = 0; i != count; ++i) {
+        mapping[i] = UnsignedInt(i);
+        parents[i] = Int(i) - 1;
+    }
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, count, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent, mapping, parents}
+    }};
+
+    Trade::SceneData copy = SceneTools::copy(scene, data.threadCount);
+    CORRADE_COMPARE(copy.dataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_VERIFY(copy.data().data() != sceneData.data());
+    CORRADE_COMPARE_AS(copy.data(),
+        sceneData,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(copy.mapping<UnsignedInt>(Trade::SceneField::Parent),
+        mapping,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(copy.field<Int>(Trade::SceneField::Parent),
+        parents,
+        TestSuite::Compare::Container);
+}
+
 void CopyTest::copyRvalueNotOwned() {
     struct Data {
         UnsignedShort parentMapping[2];
@@ -25,6 +25,7 @@
 */
 
 #include <Corrade/Containers/BitArray.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/StridedBitArrayView.h>
@@ -69,6 +70,7 @@ struct FilterTest: TestSuite::Tester {
     void objectsSharedMapping();
     void objectsSharedMappingAllRemoved();
     void objectsWrongBitCount();
+    void objectsMultipleThreads();
 };
 
 using namespace Math::Literals;
@@ -95,6 +97,15 @@ const struct {
     {"by name", true}
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"autodetected thread count", 0}
+};
+
 FilterTest::FilterTest() {
     addTests({&FilterTest::fields});
 
@@ -131,6 +142,9 @@ FilterTest::FilterTest() {
               &FilterTest::objectsSharedMapping,
               &FilterTest::objectsSharedMappingAllRemoved,
               &FilterTest::objectsWrongBitCount});
+
+    addInstancedTests({&FilterTest::objectsMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
 }
 
 void FilterTest::fields() {
@@ -1263,6 +1277,104 @@ void FilterTest::objectsWrongBitCount() {
     CORRADE_COMPARE(out, "SceneTools::filterObjects(): expected 176 bits but got 177\n");
 }
 
+void FilterTest::objectsMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough fields to be split among threads, and a lot of small
+       fields with pairwise shared mappings to stress the mapping
+       deduplication */
+    struct Data {
+        UnsignedInt meshMaterialMapping[100000];
+        UnsignedInt mesh[100000];
+        Int meshMaterial[100000];
+        UnsignedInt lightMapping[50001];
+        UnsignedInt light[50001];
+        UnsignedInt customMapping[200][10];
+        Float custom[400][10];
+    };
+    Containers::Array<Data> sceneData{ValueInit, 1};
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->meshMaterialMapping); ++i) {
+        sceneData->meshMaterialMapping[i] = (i*7919) % 200000;
+        sceneData->mesh[i] = i;
+        sceneData->meshMaterial[i] = -Int(i);
+    }
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->lightMapping); ++i) {
+        sceneData->lightMapping[i] = i*2;
+        sceneData->light[i] = i*2;
+    }
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->customMapping); ++i)
+        for(UnsignedInt j = 0; j != 10; ++j)
+            sceneData->customMapping[i][j] = i*10 + j;
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->custom); ++i)
+        for(UnsignedInt j = 0; j != 10; ++j)
+            sceneData->custom[i][j] = i + j*0.5f;
+
+    Containers::Array<Trade::SceneFieldData> fields;
+    arrayAppend(fields, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(sceneData->meshMaterialMapping),
+            Containers::arrayView(sceneData->mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(sceneData->meshMaterialMapping),
+            Containers::arrayView(sceneData->meshMaterial)},
+        Trade::SceneFieldData{Trade::SceneField::Light,
+            Containers::arrayView(sceneData->lightMapping),
+            Containers::arrayView(sceneData->light)},
+    });
+    /* Each pair of custom fields shares the same mapping */
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->custom); ++i)
+        arrayAppend(fields, Trade::SceneFieldData{Trade::sceneFieldCustom(i),
+            Containers::arrayView(sceneData->customMapping[i/2]),
+            Containers::arrayView(sceneData->custom[i])});
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 200000, {}, Containers::arrayView(sceneData), Utility::move(fields)};
+
+    Containers::BitArray objectsToKeep{ValueInit, std::size_t(scene.mappingBound())};
+    for(std::size_t i = 0; i != objectsToKeep.size(); ++i)
+        if(i % 3) objectsToKeep.set(i);
+
+    Trade::SceneData expected = filterObjects(scene, objectsToKeep);
+    Trade::SceneData filtered = filterObjects(scene, objectsToKeep, data.threadCount);
+    CORRADE_COMPARE(filtered.fieldCount(), expected.fieldCount());
+
+    /* Roughly a third of everything is removed */
+    CORRADE_COMPARE(expected.fieldSize(Trade::SceneField::Mesh), 66669);
+    CORRADE_COMPARE(expected.fieldSize(Trade::SceneField::Light), 33334);
+
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        expected.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedInt>(Trade::SceneField::Mesh),
+        expected.field<UnsignedInt>(Trade::SceneField::Mesh),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<Int>(Trade::SceneField::MeshMaterial),
+        expected.field<Int>(Trade::SceneField::MeshMaterial),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.mapping<UnsignedInt>(Trade::SceneField::Light),
+        expected.mapping<UnsignedInt>(Trade::SceneField::Light),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(filtered.field<UnsignedInt>(Trade::SceneField::Light),
+        expected.field<UnsignedInt>(Trade::SceneField::Light),
+        TestSuite::Compare::Container);
+
+    /* Sharing is preserved */
+    CORRADE_COMPARE(filtered.mapping(Trade::SceneField::MeshMaterial).data(),
+        filtered.mapping(Trade::SceneField::Mesh).data());
+    for(UnsignedInt i = 0; i != Containers::arraySize(sceneData->custom); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE_AS(filtered.mapping<UnsignedInt>(Trade::sceneFieldCustom(i)),
+            expected.mapping<UnsignedInt>(Trade::sceneFieldCustom(i)),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(filtered.field<Float>(Trade::sceneFieldCustom(i)),
+            expected.field<Float>(Trade::sceneFieldCustom(i)),
+            TestSuite::Compare::Container);
+        if(i % 2) CORRADE_COMPARE(
+            filtered.mapping(Trade::sceneFieldCustom(i)).data(),
+            filtered.mapping(Trade::sceneFieldCustom(i - 1)).data());
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::FilterTest)
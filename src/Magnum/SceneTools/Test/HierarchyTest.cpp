@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/Triple.h>
@@ -54,6 +55,9 @@ struct HierarchyTest: TestSuite::Tester {
     void parentsBreadthFirstChildrenDepthFirstCyclicDeep();
     void parentsBreadthFirstChildrenDepthFirstSparseAndCyclic();
 
+    void parentsBreadthFirstMultipleThreads();
+    void childrenDepthFirstMultipleThreads();
+
     void absoluteFieldTransformations2D();
     void absoluteFieldTransformations3D();
 
@@ -64,6 +68,9 @@ struct HierarchyTest: TestSuite::Tester {
     void absoluteFieldTransformationsInto2D();
     void absoluteFieldTransformationsInto3D();
     void absoluteFieldTransformationsIntoInvalidSize();
+
+    void absoluteFieldTransformations2DMultipleThreads();
+    void absoluteFieldTransformations3DMultipleThreads();
 };
 
 using namespace Math::Literals;
@@ -117,6 +124,15 @@ const struct {
         5},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"autodetected thread count", 0}
+};
+
 HierarchyTest::HierarchyTest() {
     addTests({&HierarchyTest::parentsBreadthFirstChildrenDepthFirst,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSingleBranch,
@@ -132,6 +148,10 @@ HierarchyTest::HierarchyTest() {
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstCyclicDeep,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSparseAndCyclic});
 
+    addInstancedTests({&HierarchyTest::parentsBreadthFirstMultipleThreads,
+                       &HierarchyTest::childrenDepthFirstMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+
     addInstancedTests({&HierarchyTest::absoluteFieldTransformations2D,
                        &HierarchyTest::absoluteFieldTransformations3D},
         Containers::arraySize(TestData));
@@ -145,6 +165,10 @@ HierarchyTest::HierarchyTest() {
         Containers::arraySize(IntoData));
 
     addTests({&HierarchyTest::absoluteFieldTransformationsIntoInvalidSize});
+
+    addInstancedTests({&HierarchyTest::absoluteFieldTransformations2DMultipleThreads,
+                       &HierarchyTest::absoluteFieldTransformations3DMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
 }
 
 void HierarchyTest::parentsBreadthFirstChildrenDepthFirst() {
@@ -481,6 +505,108 @@ void HierarchyTest::parentsBreadthFirstChildrenDepthFirstSparseAndCyclic() {
         "SceneTools::childrenDepthFirst(): hierarchy is cyclic\n");
 }
 
+struct LargeHierarchy {
+    UnsignedInt object;
+    Int parent;
+    Matrix3 transformation2D;
+    Matrix4 transformation3D;
+};
+
+/* Generates a hierarchy with four levels, the last two large enough to be
+   split among multiple threads. Object IDs are shuffled and the field lists
+   children before their parents to not have the input already in a
+   breadth-first order. */
+Containers::Array<LargeHierarchy> largeHierarchy() {
+    const UnsignedInt levelSizes[]{4, 100, 40000, 60000};
+    const UnsignedInt count = 4 + 100 + 40000 + 60000;
+
+    Containers::Array<LargeHierarchy> out{NoInit, count};
+    UnsignedInt seed = 1;
+    UnsignedInt levelBegin = 0;
+    UnsignedInt previousLevelBegin = 0;
+    for(UnsignedInt levelSize: levelSizes) {
+        for(UnsignedInt i = levelBegin; i != levelBegin + levelSize; ++i) {
+            seed = seed*1103515245u + 12345u;
+            LargeHierarchy& item = out[count - i - 1];
+            /* 7919 is a prime, so this is a permutation of [0, count) */
+            item.object = UnsignedInt(std::size_t(i)*7919 % count);
+            item.parent = levelBegin == 0 ? -1 : Int(std::size_t(previousLevelBegin + (seed >> 8) % (levelBegin - previousLevelBegin))*7919 % count);
+            item.transformation2D =
+                Matrix3::translation({Float(i % 7) - 3.0f, Float(i % 5)*0.5f})*
+                Matrix3::rotation(Deg(Float(i % 360)));
+            item.transformation3D =
+                Matrix4::translation({Float(i % 7) - 3.0f, Float(i % 5)*0.5f, Float(i % 3)})*
+                Matrix4::rotationY(Deg(Float(i % 360)));
+        }
+        previousLevelBegin = levelBegin;
+        levelBegin += levelSize;
+    }
+
+    return out;
+}
+
+void HierarchyTest::parentsBreadthFirstMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<LargeHierarchy> hierarchy = largeHierarchy();
+    Containers::StridedArrayView1D<LargeHierarchy> view = hierarchy;
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, hierarchy.size(), {}, Containers::arrayView(hierarchy), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::parent)}
+    }};
+
+    /* The output should be exactly the same as with a single thread */
+    Containers::Array<Containers::Pair<UnsignedInt, Int>> expected = SceneTools::parentsBreadthFirst(scene);
+    CORRADE_COMPARE(expected.size(), hierarchy.size());
+    CORRADE_COMPARE_AS(SceneTools::parentsBreadthFirst(scene, data.threadCount),
+        expected,
+        TestSuite::Compare::Container);
+
+    Containers::Array<UnsignedInt> mapping{NoInit, hierarchy.size()};
+    Containers::Array<Int> parents{NoInit, hierarchy.size()};
+    SceneTools::parentsBreadthFirstInto(scene, mapping, parents, data.threadCount);
+    CORRADE_COMPARE_AS(stridedArrayView(mapping),
+        stridedArrayView(expected).slice(&Containers::Pair<UnsignedInt, Int>::first),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(parents),
+        stridedArrayView(expected).slice(&Containers::Pair<UnsignedInt, Int>::second),
+        TestSuite::Compare::Container);
+}
+
+void HierarchyTest::childrenDepthFirstMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<LargeHierarchy> hierarchy = largeHierarchy();
+    Containers::StridedArrayView1D<LargeHierarchy> view = hierarchy;
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, hierarchy.size(), {}, Containers::arrayView(hierarchy), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::parent)}
+    }};
+
+    /* The output should be exactly the same as with a single thread */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> expected = SceneTools::childrenDepthFirst(scene);
+    CORRADE_COMPARE(expected.size(), hierarchy.size());
+    CORRADE_COMPARE_AS(SceneTools::childrenDepthFirst(scene, data.threadCount),
+        expected,
+        TestSuite::Compare::Container);
+
+    Containers::Array<UnsignedInt> mapping{NoInit, hierarchy.size()};
+    Containers::Array<UnsignedInt> childCount{NoInit, hierarchy.size()};
+    SceneTools::childrenDepthFirstInto(scene, mapping, childCount, data.threadCount);
+    CORRADE_COMPARE_AS(stridedArrayView(mapping),
+        stridedArrayView(expected).slice(&Containers::Pair<UnsignedInt, UnsignedInt>::first),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(stridedArrayView(childCount),
+        stridedArrayView(expected).slice(&Containers::Pair<UnsignedInt, UnsignedInt>::second),
+        TestSuite::Compare::Container);
+}
+
 const struct Scene {
     /* Using smaller types to verify we don't have unnecessarily hardcoded
        32-bit types */
@@ -889,6 +1015,98 @@ void HierarchyTest::absoluteFieldTransformationsIntoInvalidSize() {
         "SceneTools::absoluteFieldTransformationsInto(): bad output size, expected 5 but got 4\n");
 }
 
+void HierarchyTest::absoluteFieldTransformations2DMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<LargeHierarchy> hierarchy = largeHierarchy();
+    Containers::StridedArrayView1D<LargeHierarchy> view = hierarchy;
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, hierarchy.size(), {}, Containers::arrayView(hierarchy), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::transformation2D)}
+    }};
+
+    /* The output should be exactly the same as with a single thread */
+    const Matrix3 globalTransformation = Matrix3::scaling(Vector2{0.5f});
+    Containers::Array<Matrix3> expected = SceneTools::absoluteFieldTransformations2D(scene, Trade::SceneField::Transformation, globalTransformation);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations2D(scene, Trade::SceneField::Transformation, globalTransformation, data.threadCount),
+        expected,
+        TestSuite::Compare::Container);
+
+    Containers::Array<Matrix3> out{NoInit, hierarchy.size()};
+    SceneTools::absoluteFieldTransformations2DInto(scene, 1, out, globalTransformation, data.threadCount);
+    CORRADE_COMPARE_AS(out,
+        expected,
+        TestSuite::Compare::Container);
+
+    /* With the thread count, an identity global transformation is passed
+       as `{}`. Passing just `{}` as the third argument should be an
+       identity transformation as well, not a thread count. */
+    Containers::Array<Matrix3> expectedIdentity = SceneTools::absoluteFieldTransformations2D(scene, Trade::SceneField::Transformation);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations2D(scene, Trade::SceneField::Transformation, {}, data.threadCount),
+        expectedIdentity,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations2D(scene, 1, {}),
+        expectedIdentity,
+        TestSuite::Compare::Container);
+
+    SceneTools::absoluteFieldTransformations2DInto(scene, 1, out, {}, data.threadCount);
+    CORRADE_COMPARE_AS(out,
+        expectedIdentity,
+        TestSuite::Compare::Container);
+}
+
+void HierarchyTest::absoluteFieldTransformations3DMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<LargeHierarchy> hierarchy = largeHierarchy();
+    Containers::StridedArrayView1D<LargeHierarchy> view = hierarchy;
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, hierarchy.size(), {}, Containers::arrayView(hierarchy), {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::parent)},
+        Trade::SceneFieldData{Trade::SceneField::Transformation,
+            view.slice(&LargeHierarchy::object),
+            view.slice(&LargeHierarchy::transformation3D)}
+    }};
+
+    /* The output should be exactly the same as with a single thread */
+    const Matrix4 globalTransformation = Matrix4::scaling(Vector3{0.5f});
+    Containers::Array<Matrix4> expected = SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Transformation, globalTransformation);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Transformation, globalTransformation, data.threadCount),
+        expected,
+        TestSuite::Compare::Container);
+
+    Containers::Array<Matrix4> out{NoInit, hierarchy.size()};
+    SceneTools::absoluteFieldTransformations3DInto(scene, 1, out, globalTransformation, data.threadCount);
+    CORRADE_COMPARE_AS(out,
+        expected,
+        TestSuite::Compare::Container);
+
+    /* With the thread count, an identity global transformation is passed
+       as `{}`. Passing just `{}` as the third argument should be an
+       identity transformation as well, not a thread count. */
+    Containers::Array<Matrix4> expectedIdentity = SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Transformation);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Transformation, {}, data.threadCount),
+        expectedIdentity,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(SceneTools::absoluteFieldTransformations3D(scene, 1, {}),
+        expectedIdentity,
+        TestSuite::Compare::Container);
+
+    SceneTools::absoluteFieldTransformations3DInto(scene, 1, out, {}, data.threadCount);
+    CORRADE_COMPARE_AS(out,
+        expectedIdentity,
+        TestSuite::Compare::Container);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::HierarchyTest)
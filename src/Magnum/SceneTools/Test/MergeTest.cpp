@@ -0,0 +1,567 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneTools/Merge.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct MergeTest: TestSuite::Tester {
+    explicit MergeTest();
+
+    void merge();
+    void mergeIndexRemapping();
+    void mergeMappingSharingNotPreserved();
+    void mergeFlags();
+    void mergeEmpty();
+    void mergeMultipleThreads();
+
+    void mergeInvalidMappingBound();
+    void mergeInvalidIndexRemapping();
+    void mergeInvalidField();
+};
+
+const struct {
+    const char* name;
+    Trade::SceneFieldFlags flagsA, flagsB;
+    UnsignedInt mappingBoundA;
+    Trade::SceneFieldFlags expected;
+} FlagsData[]{
+    {"none", {}, {}, 3, {}},
+    {"ordered",
+        Trade::SceneFieldFlag::OrderedMapping,
+        Trade::SceneFieldFlag::OrderedMapping, 3,
+        Trade::SceneFieldFlag::OrderedMapping},
+    {"ordered in just one scene",
+        Trade::SceneFieldFlag::OrderedMapping, {}, 3,
+        {}},
+    {"implicit",
+        Trade::SceneFieldFlag::ImplicitMapping,
+        Trade::SceneFieldFlag::ImplicitMapping, 3,
+        Trade::SceneFieldFlag::ImplicitMapping},
+    {"implicit with a gap",
+        Trade::SceneFieldFlag::ImplicitMapping,
+        Trade::SceneFieldFlag::ImplicitMapping, 4,
+        Trade::SceneFieldFlag::OrderedMapping},
+    {"implicit and ordered",
+        Trade::SceneFieldFlag::ImplicitMapping,
+        Trade::SceneFieldFlag::OrderedMapping, 3,
+        Trade::SceneFieldFlag::OrderedMapping},
+    {"multi-entry in just one scene",
+        Trade::SceneFieldFlag::MultiEntry|Trade::SceneFieldFlag::OrderedMapping,
+        Trade::SceneFieldFlag::OrderedMapping, 3,
+        Trade::SceneFieldFlag::MultiEntry|Trade::SceneFieldFlag::OrderedMapping},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"single thread", 1},
+    {"four threads", 4},
+    {"autodetected thread count", 0},
+};
+
+MergeTest::MergeTest() {
+    addTests({&MergeTest::merge,
+              &MergeTest::mergeIndexRemapping,
+              &MergeTest::mergeMappingSharingNotPreserved});
+
+    addInstancedTests({&MergeTest::mergeFlags},
+        Containers::arraySize(FlagsData));
+
+    addTests({&MergeTest::mergeEmpty});
+
+    addInstancedTests({&MergeTest::mergeMultipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+
+    addTests({&MergeTest::mergeInvalidMappingBound,
+              &MergeTest::mergeInvalidIndexRemapping,
+              &MergeTest::mergeInvalidField});
+}
+
+const struct SceneA {
+    UnsignedByte parentMapping[3]{0, 1, 2};
+    Byte parents[3]{-1, 0, 1};
+    UnsignedByte meshMapping[2]{2, 0};
+    UnsignedShort meshes[2]{1, 0};
+    Byte meshMaterials[2]{-1, 2};
+    UnsignedByte translationMapping[1]{1};
+    Vector3 translations[1]{{1.0f, 2.0f, 3.0f}};
+    UnsignedByte customMapping[1]{0};
+    Float custom[1]{5.0f};
+} DataA[1]{};
+
+const struct SceneB {
+    UnsignedInt parentMapping[4]{0, 1, 2, 3};
+    Int parents[4]{-1, 0, 0, 2};
+    UnsignedInt meshMapping[2]{3, 1};
+    UnsignedByte meshes[2]{2, 2};
+    UnsignedInt rotationMapping[1]{2};
+    Quaternion rotations[1]{Quaternion{{1.0f, 0.0f, 0.0f}, 0.0f}};
+} DataB[1]{};
+
+/* Different mapping types, index field types, a material field just in one
+   of them and a disjoint subset of TRS fields */
+Trade::SceneData sceneA() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedByte, 3, {}, DataA, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(DataA->parentMapping),
+            Containers::arrayView(DataA->parents),
+            Trade::SceneFieldFlag::ImplicitMapping},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(DataA->meshMapping),
+            Containers::arrayView(DataA->meshes)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(DataA->meshMapping),
+            Containers::arrayView(DataA->meshMaterials)},
+        Trade::SceneFieldData{Trade::SceneField::Translation,
+            Containers::arrayView(DataA->translationMapping),
+            Containers::arrayView(DataA->translations)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(DataA->customMapping),
+            Containers::arrayView(DataA->custom)},
+    }};
+}
+
+Trade::SceneData sceneB() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 4, {}, DataB, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(DataB->meshMapping),
+            Containers::arrayView(DataB->meshes)},
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(DataB->parentMapping),
+            Containers::arrayView(DataB->parents),
+            Trade::SceneFieldFlag::ImplicitMapping},
+        Trade::SceneFieldData{Trade::SceneField::Rotation,
+            Containers::arrayView(DataB->rotationMapping),
+            Containers::arrayView(DataB->rotations)},
+    }};
+}
+
+void MergeTest::merge() {
+    Trade::SceneData a = sceneA();
+    Trade::SceneData b = sceneB();
+
+    Trade::SceneData merged = SceneTools::merge({a, b});
+    CORRADE_COMPARE(merged.mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(merged.mappingBound(), 7);
+
+    /* Fields are in order they're first encountered */
+    CORRADE_COMPARE(merged.fieldCount(), 6);
+    CORRADE_COMPARE(merged.fieldName(0), Trade::SceneField::Parent);
+    CORRADE_COMPARE(merged.fieldName(1), Trade::SceneField::Mesh);
+    CORRADE_COMPARE(merged.fieldName(2), Trade::SceneField::MeshMaterial);
+    CORRADE_COMPARE(merged.fieldName(3), Trade::SceneField::Translation);
+    CORRADE_COMPARE(merged.fieldName(4), Trade::sceneFieldCustom(3));
+    CORRADE_COMPARE(merged.fieldName(5), Trade::SceneField::Rotation);
+
+    /* Parents are offset and converted to Int, the mapping is still
+       implicit */
+    CORRADE_COMPARE(merged.fieldType(Trade::SceneField::Parent), Trade::SceneFieldType::Int);
+    CORRADE_COMPARE(merged.fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::SceneField::Parent),
+        Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 4, 5, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView<Int>({-1, 0, 1, -1, 3, 3, 5}),
+        TestSuite::Compare::Container);
+
+    /* Meshes are converted to UnsignedInt, materials to Int and filled with
+       -1 for the scene that doesn't have them */
+    CORRADE_COMPARE(merged.fieldType(Trade::SceneField::Mesh), Trade::SceneFieldType::UnsignedInt);
+    CORRADE_COMPARE(merged.fieldType(Trade::SceneField::MeshMaterial), Trade::SceneFieldType::Int);
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({2, 0, 6, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({1, 0, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Int>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Int>({-1, 2, -1, -1}),
+        TestSuite::Compare::Container);
+
+    /* TRS fields are filled with identity for scenes that don't have them */
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::SceneField::Translation),
+        Containers::arrayView<UnsignedInt>({1, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Vector3>(Trade::SceneField::Translation),
+        Containers::arrayView<Vector3>({{1.0f, 2.0f, 3.0f}, {}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Quaternion>(Trade::SceneField::Rotation),
+        Containers::arrayView<Quaternion>({{}, {{1.0f, 0.0f, 0.0f}, 0.0f}}),
+        TestSuite::Compare::Container);
+
+    /* Other fields are copied as-is */
+    CORRADE_COMPARE(merged.fieldType(Trade::sceneFieldCustom(3)), Trade::SceneFieldType::Float);
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::sceneFieldCustom(3)),
+        Containers::arrayView<UnsignedInt>({0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Float>(Trade::sceneFieldCustom(3)),
+        Containers::arrayView<Float>({5.0f}),
+        TestSuite::Compare::Container);
+
+    /* Mapping sharing is preserved, including the filled-in fields */
+    CORRADE_COMPARE(merged.mapping(Trade::SceneField::MeshMaterial).data(), merged.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE(merged.mapping(Trade::SceneField::Rotation).data(), merged.mapping(Trade::SceneField::Translation).data());
+    CORRADE_VERIFY(merged.mapping(Trade::SceneField::Mesh).data() != merged.mapping(Trade::SceneField::Parent).data());
+    CORRADE_VERIFY(merged.mapping(Trade::sceneFieldCustom(3)).data() != merged.mapping(Trade::SceneField::Parent).data());
+}
+
+void MergeTest::mergeIndexRemapping() {
+    Trade::SceneData a = sceneA();
+    Trade::SceneData b = sceneB();
+
+    const UnsignedInt meshesA[]{5, 6};
+    const UnsignedInt materialsA[]{0, 0, 7};
+    const UnsignedInt meshesB[]{0, 0, 9};
+    Trade::SceneData merged = SceneTools::merge({a, b}, {
+        {0, Trade::SceneField::Mesh, meshesA},
+        {1, Trade::SceneField::Mesh, meshesB},
+        {0, Trade::SceneField::MeshMaterial, materialsA},
+    });
+    CORRADE_COMPARE(merged.mappingBound(), 7);
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({2, 0, 6, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({6, 5, 9, 9}),
+        TestSuite::Compare::Container);
+    /* -1 stays unchanged */
+    CORRADE_COMPARE_AS(merged.field<Int>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Int>({-1, 7, -1, -1}),
+        TestSuite::Compare::Container);
+
+    /* Parents aren't affected by the remapping */
+    CORRADE_COMPARE_AS(merged.field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView<Int>({-1, 0, 1, -1, 3, 3, 5}),
+        TestSuite::Compare::Container);
+}
+
+void MergeTest::mergeMappingSharingNotPreserved() {
+    const struct {
+        UnsignedShort mapping[2]{0, 1};
+        UnsignedShort mappingCopy[2]{0, 1};
+        UnsignedInt meshes[2]{3, 4};
+        Float custom[2]{1.0f, 2.0f};
+    } data[1];
+
+    /* The custom field shares the mapping with meshes in the first scene but
+       not in the second, even though the contents are the same */
+    Trade::SceneData a{Trade::SceneMappingType::UnsignedShort, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->custom)},
+    }};
+    Trade::SceneData b{Trade::SceneMappingType::UnsignedShort, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(data->mappingCopy),
+            Containers::arrayView(data->custom)},
+    }};
+
+    Trade::SceneData mergedAA = SceneTools::merge({a, a});
+    CORRADE_COMPARE(mergedAA.mapping(Trade::sceneFieldCustom(3)).data(), mergedAA.mapping(Trade::SceneField::Mesh).data());
+
+    Trade::SceneData mergedAB = SceneTools::merge({a, b});
+    CORRADE_VERIFY(mergedAB.mapping(Trade::sceneFieldCustom(3)).data() != mergedAB.mapping(Trade::SceneField::Mesh).data());
+
+    /* The contents are the same in both cases */
+    for(Trade::SceneData* merged: {&mergedAA, &mergedAB}) {
+        CORRADE_COMPARE_AS(merged->mapping<UnsignedInt>(Trade::SceneField::Mesh),
+            Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(merged->mapping<UnsignedInt>(Trade::sceneFieldCustom(3)),
+            Containers::arrayView<UnsignedInt>({0, 1, 2, 3}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(merged->field<UnsignedInt>(Trade::SceneField::Mesh),
+            Containers::arrayView<UnsignedInt>({3, 4, 3, 4}),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(merged->field<Float>(Trade::sceneFieldCustom(3)),
+            Containers::arrayView<Float>({1.0f, 2.0f, 1.0f, 2.0f}),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MergeTest::mergeFlags() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const struct {
+        UnsignedInt mapping[3]{0, 1, 2};
+        Float custom[3]{};
+    } sceneData[1];
+
+    Trade::SceneData a{Trade::SceneMappingType::UnsignedInt, data.mappingBoundA, {}, sceneData, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->custom), data.flagsA},
+    }};
+    Trade::SceneData b{Trade::SceneMappingType::UnsignedInt, 2, {}, sceneData, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(sceneData->mapping).prefix(2),
+            Containers::arrayView(sceneData->custom).prefix(2), data.flagsB},
+    }};
+
+    Trade::SceneData merged = SceneTools::merge({a, b});
+    CORRADE_COMPARE(merged.fieldFlags(0), data.expected);
+}
+
+void MergeTest::mergeEmpty() {
+    /* No scenes at all */
+    {
+        Trade::SceneData merged = SceneTools::merge(Containers::ArrayView<const Trade::SceneData>{});
+        CORRADE_COMPARE(merged.mappingType(), Trade::SceneMappingType::UnsignedInt);
+        CORRADE_COMPARE(merged.mappingBound(), 0);
+        CORRADE_COMPARE(merged.fieldCount(), 0);
+    }
+
+    /* Scenes with no fields, the mapping bound is still summed up */
+    {
+        Trade::SceneData a{Trade::SceneMappingType::UnsignedByte, 3, nullptr, {}};
+        Trade::SceneData b{Trade::SceneMappingType::UnsignedLong, 4, nullptr, {}};
+        Trade::SceneData merged = SceneTools::merge({a, b});
+        CORRADE_COMPARE(merged.mappingType(), Trade::SceneMappingType::UnsignedInt);
+        CORRADE_COMPARE(merged.mappingBound(), 7);
+        CORRADE_COMPARE(merged.fieldCount(), 0);
+    }
+}
+
+void MergeTest::mergeMultipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    struct Entry {
+        UnsignedInt mapping;
+        Int parent;
+        UnsignedInt mesh;
+    };
+
+    /* Scenes large enough to be processed on multiple threads, with a
+       remapping table for one of them */
+    Containers::Array<Entry> entries[3];
+    Containers::Array<Trade::SceneData> scenes;
+    const UnsignedInt meshRemapping[]{0, 20, 40, 60, 80, 100, 120, 140, 160, 180, 200, 220, 240};
+    std::size_t totalSize = 0;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const std::size_t size = 20000 + i*1000;
+        entries[i] = Containers::Array<Entry>{NoInit, size};
+        for(std::size_t j = 0; j != size; ++j) {
+            entries[i][j].mapping = UnsignedInt(j);
+            entries[i][j].parent = Int(j) - 1;
+            entries[i][j].mesh = (j*7 + i) % 13;
+        }
+        totalSize += size;
+
+        const Containers::StridedArrayView1D<const Entry> view = entries[i];
+        arrayAppend(scenes, InPlaceInit, Trade::SceneMappingType::UnsignedInt, size, Trade::DataFlags{}, Containers::arrayView(entries[i]), Containers::Array<Trade::SceneFieldData>{InPlaceInit, {
+            Trade::SceneFieldData{Trade::SceneField::Parent,
+                view.slice(&Entry::mapping),
+                view.slice(&Entry::parent),
+                Trade::SceneFieldFlag::ImplicitMapping},
+            Trade::SceneFieldData{Trade::SceneField::Mesh,
+                view.slice(&Entry::mapping),
+                view.slice(&Entry::mesh),
+                Trade::SceneFieldFlag::ImplicitMapping},
+        }});
+    }
+
+    Trade::SceneData merged = SceneTools::merge(scenes, {
+        {1, Trade::SceneField::Mesh, meshRemapping}
+    }, data.threadCount);
+    CORRADE_COMPARE(merged.mappingBound(), UnsignedLong(totalSize));
+    CORRADE_COMPARE(merged.fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE(merged.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE(merged.mapping(Trade::SceneField::Mesh).data(), merged.mapping(Trade::SceneField::Parent).data());
+
+    Containers::Array<UnsignedInt> expectedMapping{NoInit, totalSize};
+    Containers::Array<Int> expectedParents{NoInit, totalSize};
+    Containers::Array<UnsignedInt> expectedMeshes{NoInit, totalSize};
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i != 3; ++i) {
+        for(std::size_t j = 0; j != entries[i].size(); ++j) {
+            expectedMapping[offset + j] = UnsignedInt(offset + j);
+            expectedParents[offset + j] = j ? Int(offset + j - 1) : -1;
+            expectedMeshes[offset + j] = i == 1 ? meshRemapping[entries[i][j].mesh] : entries[i][j].mesh;
+        }
+        offset += entries[i].size();
+    }
+
+    CORRADE_COMPARE_AS(merged.mapping<UnsignedInt>(Trade::SceneField::Parent),
+        expectedMapping,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<Int>(Trade::SceneField::Parent),
+        expectedParents,
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(merged.field<UnsignedInt>(Trade::SceneField::Mesh),
+        expectedMeshes,
+        TestSuite::Compare::Container);
+}
+
+void MergeTest::mergeInvalidMappingBound() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData a{Trade::SceneMappingType::UnsignedInt, 0x80000000ull, nullptr, {}};
+
+    /* This is fine */
+    Trade::SceneData b{Trade::SceneMappingType::UnsignedInt, 0x7fffffffull, nullptr, {}};
+    CORRADE_COMPARE(SceneTools::merge({a, b}).mappingBound(), 0xffffffffull);
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::merge({a, a});
+    CORRADE_COMPARE(out, "SceneTools::merge(): expected total mapping bound to fit into 32 bits but got 4294967296\n");
+}
+
+void MergeTest::mergeInvalidIndexRemapping() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData a = sceneA();
+    Trade::SceneData b = sceneB();
+
+    const UnsignedInt table[2]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::merge({a, b}, {
+        {0, Trade::SceneField::Mesh, table},
+        {2, Trade::SceneField::Mesh, table},
+    });
+    SceneTools::merge({a, b}, {
+        {0, Trade::SceneField::Parent, table},
+    });
+    SceneTools::merge({a, b}, {
+        {1, Trade::SceneField::Light, table},
+        {1, Trade::SceneField::Light, table},
+    });
+    /* Mesh 2 in the second scene is out of range, the first is fine */
+    SceneTools::merge({a, b}, {
+        {0, Trade::SceneField::Mesh, table},
+        {1, Trade::SceneField::Mesh, table},
+    });
+    /* -1 in materials isn't taken into account */
+    SceneTools::merge({a, b}, {
+        {0, Trade::SceneField::MeshMaterial, Containers::arrayView(table).prefix(1)},
+    });
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::merge(): index remapping 1 references scene 2 but only 2 scenes were passed\n"
+        "SceneTools::merge(): index remapping 0 references field Trade::SceneField::Parent which can't be remapped\n"
+        "SceneTools::merge(): index remapping 1 references Trade::SceneField::Light of scene 1 which was already remapped\n"
+        "SceneTools::merge(): index 2 out of range for 2 remapping table entries in Trade::SceneField::Mesh of scene 1\n"
+        "SceneTools::merge(): index 2 out of range for 1 remapping table entries in Trade::SceneField::MeshMaterial of scene 0\n",
+        TestSuite::Compare::String);
+}
+
+void MergeTest::mergeInvalidField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedInt mapping[2]{1, 0};
+        UnsignedInt meshes[2]{};
+        Int materials[2]{};
+        Float floats[2]{};
+        Int ints[2]{};
+        Int intArrays[6]{};
+        UnsignedInt nameRangeNullTerminated[2]{};
+        char nameString[1]{};
+        bool visible[2]{};
+    } data[1];
+
+    Trade::SceneData floatField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->floats)},
+    }};
+    Trade::SceneData intField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->ints)},
+    }};
+    Trade::SceneData intArrayField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(3),
+            Containers::arrayView(data->mapping),
+            Containers::StridedArrayView2D<const Int>{data->intArrays, {2, 3}}},
+    }};
+    Trade::SceneData stringField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->mapping),
+            data->nameString, Trade::SceneFieldType::StringRangeNullTerminated32,
+            Containers::arrayView(data->nameRangeNullTerminated)},
+    }};
+    Trade::SceneData bitField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(16),
+            Containers::arrayView(data->mapping),
+            Containers::stridedArrayView(data->visible).sliceBit(0)},
+    }};
+    Trade::SceneData meshes{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+    }};
+    Trade::SceneData materials{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->materials)},
+    }};
+
+    /* A material field without meshes is fine if no other scene has meshes */
+    CORRADE_COMPARE(SceneTools::merge({materials, materials}).fieldCount(), 1);
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::merge({floatField, intField});
+    SceneTools::merge({intArrayField, floatField});
+    SceneTools::merge({floatField, stringField});
+    SceneTools::merge({bitField});
+    SceneTools::merge({meshes, materials});
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::merge(): expected Trade::SceneField::Custom(3) in scene 1 to be Trade::SceneFieldType::Float with array size 0 but got Trade::SceneFieldType::Int with array size 0\n"
+        "SceneTools::merge(): expected Trade::SceneField::Custom(3) in scene 1 to be Trade::SceneFieldType::Int with array size 3 but got Trade::SceneFieldType::Float with array size 0\n"
+        "SceneTools::merge(): merging string fields is not implemented yet, sorry\n"
+        "SceneTools::merge(): merging bit fields is not implemented yet, sorry\n"
+        "SceneTools::merge(): scene 1 has a Trade::SceneField::MeshMaterial field without Trade::SceneField::Mesh but other scenes have Trade::SceneField::Mesh\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::MergeTest)
@@ -0,0 +1,309 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/Triple.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/SceneTools/MeshInstances.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct MeshInstancesTest: TestSuite::Tester {
+    explicit MeshInstancesTest();
+
+    void groupMeshInstances();
+    void groupMeshInstancesNoMaterials();
+    void groupMeshInstancesEmpty();
+    void groupMeshInstancesInvalid();
+
+    void meshInstanceRuns();
+    void meshInstanceRunsNoMaterials();
+    void meshInstanceRunsEmpty();
+    void meshInstanceRunsInvalid();
+};
+
+MeshInstancesTest::MeshInstancesTest() {
+    addTests({&MeshInstancesTest::groupMeshInstances,
+              &MeshInstancesTest::groupMeshInstancesNoMaterials,
+              &MeshInstancesTest::groupMeshInstancesEmpty,
+              &MeshInstancesTest::groupMeshInstancesInvalid,
+
+              &MeshInstancesTest::meshInstanceRuns,
+              &MeshInstancesTest::meshInstanceRunsNoMaterials,
+              &MeshInstancesTest::meshInstanceRunsEmpty,
+              &MeshInstancesTest::meshInstanceRunsInvalid});
+}
+
+struct Scene {
+    UnsignedShort parentMapping[6];
+    Int parents[6];
+    struct Mesh {
+        UnsignedShort mapping;
+        UnsignedInt mesh;
+        Int material;
+        Float custom;
+    } meshes[6];
+};
+
+const Scene Data[]{{
+    {0, 1, 2, 3, 4, 5},
+    {-1, 0, 0, 1, 1, 2},
+    {{4, 2, 0, 0.0f},
+     {1, 1, -1, 1.0f},
+     {3, 2, 1, 2.0f},
+     {0, 1, -1, 3.0f},
+     {2, 2, 0, 4.0f},
+     {5, 0, 3, 5.0f}}
+}};
+
+Trade::SceneData sceneData(Trade::SceneFieldFlags meshFlags = {}) {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 6, {}, Data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(Data->parentMapping),
+            Containers::arrayView(Data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::mapping),
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::mesh), meshFlags},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::mapping),
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::material)},
+        /* A custom field sharing the mapping with meshes, should get
+           reordered as well */
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::mapping),
+            Containers::stridedArrayView(Data->meshes).slice(&Scene::Mesh::custom)},
+    }};
+}
+
+void MeshInstancesTest::groupMeshInstances() {
+    /* The flag isn't true but it should get removed anyway */
+    Trade::SceneData grouped = SceneTools::groupMeshInstances(sceneData(Trade::SceneFieldFlag::OrderedMapping));
+    CORRADE_COMPARE(grouped.mappingType(), Trade::SceneMappingType::UnsignedShort);
+    CORRADE_COMPARE(grouped.mappingBound(), 6);
+    CORRADE_COMPARE(grouped.fieldCount(), 4);
+
+    /* The parent field stays the same */
+    CORRADE_COMPARE_AS(grouped.mapping<UnsignedShort>(Trade::SceneField::Parent),
+        Containers::arrayView(Data->parentMapping),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(grouped.field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView(Data->parents),
+        TestSuite::Compare::Container);
+
+    /* The mesh field is sorted by mesh and material, the rest of the fields
+       sharing the mapping is reordered the same, keeping the original order
+       in each group */
+    CORRADE_COMPARE(grouped.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlags{});
+    CORRADE_COMPARE_AS(grouped.mapping<UnsignedShort>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedShort>({5, 1, 0, 4, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(grouped.field<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({0, 1, 1, 2, 2, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(grouped.field<Int>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Int>({3, -1, -1, 0, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(grouped.field<Float>(Trade::sceneFieldCustom(15)),
+        Containers::arrayView<Float>({5.0f, 1.0f, 3.0f, 0.0f, 4.0f, 2.0f}),
+        TestSuite::Compare::Container);
+
+    /* The mapping sharing is preserved */
+    CORRADE_COMPARE(grouped.mapping(Trade::SceneField::MeshMaterial).data(), grouped.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE(grouped.mapping(Trade::sceneFieldCustom(15)).data(), grouped.mapping(Trade::SceneField::Mesh).data());
+
+    /* Each mesh and material combination is a single run now */
+    CORRADE_COMPARE_AS(SceneTools::meshInstanceRuns(grouped), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {0, 3, 1},
+        {1, -1, 2},
+        {2, 0, 2},
+        {2, 1, 1}
+    })), TestSuite::Compare::Container);
+}
+
+void MeshInstancesTest::groupMeshInstancesNoMaterials() {
+    const struct {
+        UnsignedInt mapping[5]{0, 1, 2, 3, 4};
+        UnsignedByte meshes[5]{3, 1, 3, 3, 1};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 5, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes),
+            Trade::SceneFieldFlag::ImplicitMapping},
+    }};
+
+    Trade::SceneData grouped = SceneTools::groupMeshInstances(scene);
+    CORRADE_COMPARE(grouped.fieldCount(), 1);
+    CORRADE_COMPARE(grouped.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlags{});
+    CORRADE_COMPARE(grouped.fieldType(Trade::SceneField::Mesh), Trade::SceneFieldType::UnsignedByte);
+    CORRADE_COMPARE_AS(grouped.mapping<UnsignedInt>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({1, 4, 0, 2, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(grouped.field<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({1, 1, 3, 3, 3}),
+        TestSuite::Compare::Container);
+}
+
+void MeshInstancesTest::groupMeshInstancesEmpty() {
+    const struct {
+        UnsignedInt parentMapping[2]{0, 1};
+        Int parents[2]{-1, 0};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->parentMapping),
+            Containers::arrayView(data->parents)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+    }};
+
+    Trade::SceneData grouped = SceneTools::groupMeshInstances(scene);
+    CORRADE_COMPARE(grouped.fieldCount(), 2);
+    CORRADE_COMPARE(grouped.fieldSize(Trade::SceneField::Mesh), 0);
+    CORRADE_COMPARE_AS(grouped.field<Int>(Trade::SceneField::Parent),
+        Containers::arrayView(data->parents),
+        TestSuite::Compare::Container);
+}
+
+void MeshInstancesTest::groupMeshInstancesInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedInt mapping[2]{1, 0};
+        UnsignedInt meshes[2]{};
+        UnsignedInt nameRangeNullTerminated[2]{};
+        char nameString[1]{};
+        bool visible[2]{};
+    } data[1];
+
+    Trade::SceneData noMeshes{Trade::SceneMappingType::UnsignedInt, 2, nullptr, {}};
+    Trade::SceneData stringField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->mapping),
+            data->nameString, Trade::SceneFieldType::StringRangeNullTerminated32,
+            Containers::arrayView(data->nameRangeNullTerminated)},
+    }};
+    Trade::SceneData bitField{Trade::SceneMappingType::UnsignedInt, 2, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(16),
+            Containers::arrayView(data->mapping),
+            Containers::stridedArrayView(data->visible).sliceBit(0)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::groupMeshInstances(noMeshes);
+    SceneTools::groupMeshInstances(stringField);
+    SceneTools::groupMeshInstances(bitField);
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::groupMeshInstances(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::groupMeshInstances(): reordering string fields is not implemented yet, sorry\n"
+        "SceneTools::groupMeshInstances(): reordering bit fields is not implemented yet, sorry\n",
+        TestSuite::Compare::String);
+}
+
+void MeshInstancesTest::meshInstanceRuns() {
+    /* Without grouping, only consecutive entries with the same mesh and
+       material are merged together */
+    const struct {
+        UnsignedInt mapping[6]{0, 1, 2, 3, 4, 5};
+        UnsignedInt meshes[6]{2, 2, 1, 1, 1, 2};
+        Int materials[6]{0, 0, 0, 5, 5, 0};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 6, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->materials)},
+    }};
+
+    CORRADE_COMPARE_AS(SceneTools::meshInstanceRuns(scene), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {2, 0, 2},
+        {1, 0, 1},
+        {1, 5, 2},
+        {2, 0, 1}
+    })), TestSuite::Compare::Container);
+}
+
+void MeshInstancesTest::meshInstanceRunsNoMaterials() {
+    const struct {
+        UnsignedInt mapping[4]{0, 1, 2, 3};
+        UnsignedInt meshes[4]{2, 2, 2, 7};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 4, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->mapping),
+            Containers::arrayView(data->meshes)},
+    }};
+
+    CORRADE_COMPARE_AS(SceneTools::meshInstanceRuns(scene), (Containers::arrayView<Containers::Triple<UnsignedInt, Int, UnsignedInt>>({
+        {2, -1, 3},
+        {7, -1, 1}
+    })), TestSuite::Compare::Container);
+}
+
+void MeshInstancesTest::meshInstanceRunsEmpty() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 4, nullptr, {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+    }};
+
+    CORRADE_COMPARE(SceneTools::meshInstanceRuns(scene).size(), 0);
+}
+
+void MeshInstancesTest::meshInstanceRunsInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 2, nullptr, {}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::meshInstanceRuns(scene);
+    CORRADE_COMPARE(out, "SceneTools::meshInstanceRuns(): field Trade::SceneField::Mesh not found\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::MeshInstancesTest)
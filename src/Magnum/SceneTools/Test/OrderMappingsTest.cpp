@@ -0,0 +1,398 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/SceneTools/OrderMappings.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct OrderMappingsTest: TestSuite::Tester {
+    explicit OrderMappingsTest();
+
+    template<class T> void test();
+    void alreadyOrdered();
+    void offsetOnly();
+    void stringField();
+    void bitField();
+    void multipleThreads();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} MultipleThreadsData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"autodetected thread count", 0}
+};
+
+OrderMappingsTest::OrderMappingsTest() {
+    addTests({&OrderMappingsTest::test<UnsignedByte>,
+              &OrderMappingsTest::test<UnsignedShort>,
+              &OrderMappingsTest::test<UnsignedInt>,
+              &OrderMappingsTest::test<UnsignedLong>,
+              &OrderMappingsTest::alreadyOrdered,
+              &OrderMappingsTest::offsetOnly,
+              &OrderMappingsTest::stringField,
+              &OrderMappingsTest::bitField});
+
+    addInstancedTests({&OrderMappingsTest::multipleThreads},
+        Containers::arraySize(MultipleThreadsData));
+}
+
+template<class T> void OrderMappingsTest::test() {
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+
+    const struct {
+        T meshMapping[6]{7, 3, 15, 3, 2, 7};
+        UnsignedByte mesh[6]{0, 1, 2, 3, 4, 5};
+        Int meshMaterial[6]{-1, 11, 22, 33, 44, 55};
+        T lightMapping[4]{1, 2, 2, 6};
+        UnsignedInt light[4]{10, 20, 30, 40};
+        T parentMapping[3]{2, 3, 8};
+        Short parents[3]{-1, 2, 3};
+        T customMapping[3]{5, 1, 3};
+        Vector2 custom[3][2]{
+            {{1.0f, 2.0f}, {3.0f, 4.0f}},
+            {{5.0f, 6.0f}, {7.0f, 8.0f}},
+            {{9.0f, 0.0f}, {1.0f, 2.0f}}
+        };
+    } data[1];
+
+    Trade::SceneData scene{Trade::Implementation::sceneMappingTypeFor<T>(), 76, {}, data, {
+        /* These two share the mapping, which should be sorted just once and
+           stay shared */
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(data->meshMapping),
+            Containers::arrayView(data->meshMaterial)},
+        /* This one is sorted already, gets just the flag added */
+        Trade::SceneFieldData{Trade::SceneField::Light,
+            Containers::arrayView(data->lightMapping),
+            Containers::arrayView(data->light)},
+        /* This one is marked as ordered already, gets passed through */
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->parentMapping),
+            Containers::arrayView(data->parents),
+            Trade::SceneFieldFlag::OrderedMapping},
+        /* This one is empty */
+        Trade::SceneFieldData{Trade::SceneField::Camera,
+            Containers::ArrayView<T>{},
+            Containers::ArrayView<UnsignedByte>{}},
+        /* An array field */
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->customMapping),
+            Containers::StridedArrayView2D<const Vector2>{Containers::arrayView(&data->custom[0][0], 6), {3, 2}}},
+    }};
+
+    Trade::SceneData ordered = orderMappings(scene);
+    CORRADE_COMPARE(ordered.fieldCount(), 6);
+    CORRADE_COMPARE(ordered.mappingType(), Trade::Implementation::sceneMappingTypeFor<T>());
+    CORRADE_COMPARE(ordered.mappingBound(), 76);
+
+    /* The sort is stable, so entries for the same object stay in the
+       original order */
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<T>(Trade::SceneField::Mesh),
+        Containers::arrayView<T>({2, 3, 3, 7, 7, 15}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<UnsignedByte>(Trade::SceneField::Mesh),
+        Containers::arrayView<UnsignedByte>({4, 1, 3, 0, 5, 2}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::SceneField::MeshMaterial), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.field<Int>(Trade::SceneField::MeshMaterial),
+        Containers::arrayView<Int>({44, 11, 33, -1, 55, 22}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(ordered.mapping(Trade::SceneField::Mesh).data(), ordered.mapping(Trade::SceneField::MeshMaterial).data());
+
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::SceneField::Light), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<T>(Trade::SceneField::Light),
+        Containers::arrayView<T>({1, 2, 2, 6}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<UnsignedInt>(Trade::SceneField::Light),
+        Containers::arrayView<UnsignedInt>({10, 20, 30, 40}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<T>(Trade::SceneField::Parent),
+        Containers::arrayView<T>({2, 3, 8}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<Short>(Trade::SceneField::Parent),
+        Containers::arrayView<Short>({-1, 2, 3}),
+        TestSuite::Compare::Container);
+
+    /* Empty fields are passed through without changing the flags */
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::SceneField::Camera), Trade::SceneFieldFlags{});
+    CORRADE_COMPARE(ordered.fieldSize(Trade::SceneField::Camera), 0);
+
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::sceneFieldCustom(15)), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE(ordered.fieldArraySize(Trade::sceneFieldCustom(15)), 2);
+    CORRADE_COMPARE_AS(ordered.mapping<T>(Trade::sceneFieldCustom(15)),
+        Containers::arrayView<T>({1, 3, 5}),
+        TestSuite::Compare::Container);
+    Containers::StridedArrayView2D<const Vector2> custom = ordered.field<Vector2[]>(Trade::sceneFieldCustom(15));
+    CORRADE_COMPARE_AS(custom[0],
+        Containers::arrayView<Vector2>({{5.0f, 6.0f}, {7.0f, 8.0f}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(custom[1],
+        Containers::arrayView<Vector2>({{9.0f, 0.0f}, {1.0f, 2.0f}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(custom[2],
+        Containers::arrayView<Vector2>({{1.0f, 2.0f}, {3.0f, 4.0f}}),
+        TestSuite::Compare::Container);
+
+    /* The lookup now uses a binary search, and gives the same result as the
+       linear search on the original */
+    CORRADE_COMPARE(ordered.findFieldObjectOffset(Trade::SceneField::Mesh, 7), 3);
+    CORRADE_COMPARE(ordered.findFieldObjectOffset(Trade::SceneField::Mesh, 7, 4), 4);
+    CORRADE_COMPARE(ordered.findFieldObjectOffset(Trade::SceneField::Mesh, 8), Containers::NullOpt);
+}
+
+void OrderMappingsTest::alreadyOrdered() {
+    /* String and bit fields can be passed through if their mapping is sorted
+       already, getting just the flag added */
+    const struct {
+        UnsignedInt nameMapping[2]{3, 5};
+        UnsignedInt nameRangeNullTerminated[2]{4, 8};
+        char nameString[8]{'a', 'b', 'c', '\0', 'd', 'e', 'f', '\0'};
+        UnsignedInt visibilityMapping[3]{1, 1, 4};
+        bool visible[3]{true, false, true};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 76, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->nameMapping),
+            data->nameString, Trade::SceneFieldType::StringRangeNullTerminated32,
+            Containers::arrayView(data->nameRangeNullTerminated)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(16),
+            Containers::arrayView(data->visibilityMapping),
+            Containers::stridedArrayView(data->visible).sliceBit(0)},
+    }};
+
+    Trade::SceneData ordered = orderMappings(scene);
+    CORRADE_COMPARE(ordered.fieldCount(), 2);
+
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::sceneFieldCustom(15)), Trade::SceneFieldFlag::OrderedMapping|Trade::SceneFieldFlag::NullTerminatedString);
+    CORRADE_COMPARE_AS(ordered.mapping<UnsignedInt>(Trade::sceneFieldCustom(15)),
+        Containers::arrayView<UnsignedInt>({3, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.fieldStrings(Trade::sceneFieldCustom(15)),
+        (Containers::StringIterable{"abc", "def"}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(ordered.fieldFlags(Trade::sceneFieldCustom(16)), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<UnsignedInt>(Trade::sceneFieldCustom(16)),
+        Containers::arrayView<UnsignedInt>({1, 1, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.fieldBits(Trade::sceneFieldCustom(16)),
+        Containers::stridedArrayView({true, false, true}).sliceBit(0),
+        TestSuite::Compare::Container);
+}
+
+void OrderMappingsTest::offsetOnly() {
+    struct Data {
+        UnsignedInt mapping[3];
+        Float values[3];
+        UnsignedInt sortedMapping[2];
+        Short sortedValues[2];
+    } data[1]{{
+        {5, 1, 3},
+        {0.5f, 1.5f, 2.5f},
+        {2, 4},
+        {-3, 7}
+    }};
+
+    /* Both the sorted and the passed-through field should have the
+       OffsetOnly flag removed as the output views are absolute */
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 6, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15), 3,
+            Trade::SceneMappingType::UnsignedInt, offsetof(Data, mapping), sizeof(UnsignedInt),
+            Trade::SceneFieldType::Float, offsetof(Data, values), sizeof(Float)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(16), 2,
+            Trade::SceneMappingType::UnsignedInt, offsetof(Data, sortedMapping), sizeof(UnsignedInt),
+            Trade::SceneFieldType::Short, offsetof(Data, sortedValues), sizeof(Short)},
+    }};
+    CORRADE_COMPARE(scene.fieldFlags(0), Trade::SceneFieldFlag::OffsetOnly);
+    CORRADE_COMPARE(scene.fieldFlags(1), Trade::SceneFieldFlag::OffsetOnly);
+
+    Trade::SceneData ordered = orderMappings(scene);
+    CORRADE_COMPARE(ordered.fieldCount(), 2);
+
+    CORRADE_COMPARE(ordered.fieldFlags(0), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<UnsignedInt>(0),
+        Containers::arrayView<UnsignedInt>({1, 3, 5}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<Float>(0),
+        Containers::arrayView<Float>({1.5f, 2.5f, 0.5f}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(ordered.fieldFlags(1), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(ordered.mapping<UnsignedInt>(1),
+        Containers::arrayView<UnsignedInt>({2, 4}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<Short>(1),
+        Containers::arrayView<Short>({-3, 7}),
+        TestSuite::Compare::Container);
+}
+
+void OrderMappingsTest::stringField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedShort nameMapping[2]{5, 3};
+        UnsignedInt nameRangeNullTerminated[2]{};
+        char nameString[1]{};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 76, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->nameMapping),
+            data->nameString, Trade::SceneFieldType::StringRangeNullTerminated32,
+            Containers::arrayView(data->nameRangeNullTerminated)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    orderMappings(scene);
+    CORRADE_COMPARE(out, "SceneTools::orderMappings(): ordering string fields is not implemented yet, sorry\n");
+}
+
+void OrderMappingsTest::bitField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedShort visibilityMapping[2]{5, 3};
+        bool visible[2]{};
+    } data[1];
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 76, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->visibilityMapping),
+            Containers::stridedArrayView(data->visible).sliceBit(0)},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    orderMappings(scene);
+    CORRADE_COMPARE(out, "SceneTools::orderMappings(): ordering bit fields is not implemented yet, sorry\n");
+}
+
+void OrderMappingsTest::multipleThreads() {
+    auto&& data = MultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to not be processed on a single thread. One shared mapping
+       that needs sorting, one unshared that needs sorting and one that's
+       sorted already. */
+    struct Data {
+        UnsignedInt meshMapping[100000];
+        UnsignedInt mesh[100000];
+        Int meshMaterial[100000];
+        UnsignedInt lightMapping[50000];
+        UnsignedInt light[50000];
+        UnsignedInt cameraMapping[30000];
+        UnsignedInt camera[30000];
+    };
+    Containers::Array<char> storage{ValueInit, sizeof(Data)};
+    Data& d = *reinterpret_cast<Data*>(storage.data());
+    for(UnsignedInt i = 0; i != Containers::arraySize(d.meshMapping); ++i) {
+        d.meshMapping[i] = (i*7919)%30011;
+        d.mesh[i] = i;
+        d.meshMaterial[i] = -Int(i);
+    }
+    for(UnsignedInt i = 0; i != Containers::arraySize(d.lightMapping); ++i) {
+        d.lightMapping[i] = 40000 - i/2;
+        d.light[i] = i;
+    }
+    for(UnsignedInt i = 0; i != Containers::arraySize(d.cameraMapping); ++i) {
+        d.cameraMapping[i] = i;
+        d.camera[i] = i*3;
+    }
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 40001, Utility::move(storage), {
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(d.meshMapping),
+            Containers::arrayView(d.mesh)},
+        Trade::SceneFieldData{Trade::SceneField::MeshMaterial,
+            Containers::arrayView(d.meshMapping),
+            Containers::arrayView(d.meshMaterial)},
+        Trade::SceneFieldData{Trade::SceneField::Light,
+            Containers::arrayView(d.lightMapping),
+            Containers::arrayView(d.light)},
+        Trade::SceneFieldData{Trade::SceneField::Camera,
+            Containers::arrayView(d.cameraMapping),
+            Containers::arrayView(d.camera)},
+    }};
+
+    Trade::SceneData expected = orderMappings(scene);
+    Trade::SceneData ordered = orderMappings(scene, data.threadCount);
+    CORRADE_COMPARE(ordered.fieldCount(), 4);
+    CORRADE_COMPARE(ordered.mapping(Trade::SceneField::Mesh).data(), ordered.mapping(Trade::SceneField::MeshMaterial).data());
+    for(UnsignedInt i = 0; i != ordered.fieldCount(); ++i) {
+        CORRADE_ITERATION(ordered.fieldName(i));
+        CORRADE_COMPARE(ordered.fieldFlags(i), Trade::SceneFieldFlag::OrderedMapping);
+        CORRADE_COMPARE_AS(ordered.mapping<UnsignedInt>(i),
+            expected.mapping<UnsignedInt>(i),
+            TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE_AS(ordered.field<UnsignedInt>(Trade::SceneField::Mesh),
+        expected.field<UnsignedInt>(Trade::SceneField::Mesh),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<Int>(Trade::SceneField::MeshMaterial),
+        expected.field<Int>(Trade::SceneField::MeshMaterial),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<UnsignedInt>(Trade::SceneField::Light),
+        expected.field<UnsignedInt>(Trade::SceneField::Light),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(ordered.field<UnsignedInt>(Trade::SceneField::Camera),
+        expected.field<UnsignedInt>(Trade::SceneField::Camera),
+        TestSuite::Compare::Container);
+
+    /* Spot-check that the output is actually sorted and stable */
+    Containers::StridedArrayView1D<const UnsignedInt> lightMapping = ordered.mapping<UnsignedInt>(Trade::SceneField::Light);
+    Containers::StridedArrayView1D<const UnsignedInt> light = ordered.field<UnsignedInt>(Trade::SceneField::Light);
+    CORRADE_COMPARE(lightMapping[0], 15001);
+    CORRADE_COMPARE(light[0], 49998);
+    CORRADE_COMPARE(light[1], 49999);
+    CORRADE_COMPARE(lightMapping[49999], 40000);
+    CORRADE_COMPARE(light[49998], 0);
+    CORRADE_COMPARE(light[49999], 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::OrderMappingsTest)
@@ -0,0 +1,372 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneTools/SceneBuilder.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct SceneBuilderTest: TestSuite::Tester {
+    explicit SceneBuilderTest();
+
+    void construct();
+    void constructMove();
+
+    void build();
+    void buildFlags();
+    void buildArrayField();
+    void buildEmpty();
+    void buildResets();
+    void reserve();
+
+    void mutableFieldWrongType();
+    void invalid();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt objects[4];
+    std::size_t count;
+    Trade::SceneFieldFlags expected;
+} FlagsData[]{
+    {"none", {2, 0, 1}, 3, {}},
+    {"ordered", {0, 2, 2, 3}, 4, Trade::SceneFieldFlag::OrderedMapping},
+    {"implicit", {0, 1, 2, 3}, 4, Trade::SceneFieldFlag::ImplicitMapping},
+    {"implicit prefix", {0, 1}, 2, Trade::SceneFieldFlag::ImplicitMapping},
+    {"empty", {}, 0, Trade::SceneFieldFlag::ImplicitMapping},
+};
+
+SceneBuilderTest::SceneBuilderTest() {
+    addTests({&SceneBuilderTest::construct,
+              &SceneBuilderTest::constructMove,
+
+              &SceneBuilderTest::build});
+
+    addInstancedTests({&SceneBuilderTest::buildFlags},
+        Containers::arraySize(FlagsData));
+
+    addTests({&SceneBuilderTest::buildArrayField,
+              &SceneBuilderTest::buildEmpty,
+              &SceneBuilderTest::buildResets,
+              &SceneBuilderTest::reserve,
+
+              &SceneBuilderTest::mutableFieldWrongType,
+              &SceneBuilderTest::invalid});
+}
+
+void SceneBuilderTest::construct() {
+    SceneBuilder builder;
+    CORRADE_COMPARE(builder.mappingBound(), 0);
+    CORRADE_COMPARE(builder.fieldCount(), 0);
+
+    CORRADE_COMPARE(builder.addObject(), 0);
+    CORRADE_COMPARE(builder.addObjects(3), 1);
+    CORRADE_COMPARE(builder.addObject(), 4);
+    CORRADE_COMPARE(builder.mappingBound(), 5);
+
+    CORRADE_COMPARE(builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int), 0);
+    CORRADE_COMPARE(builder.addField(Trade::SceneField::Mesh, Trade::SceneFieldType::UnsignedShort), 1);
+    CORRADE_COMPARE(builder.addField(1, Trade::sceneFieldCustom(15), Trade::SceneFieldType::Float, 3), 2);
+    CORRADE_COMPARE(builder.fieldCount(), 3);
+    CORRADE_COMPARE(builder.fieldName(2), Trade::sceneFieldCustom(15));
+    CORRADE_COMPARE(builder.fieldType(2), Trade::SceneFieldType::Float);
+    CORRADE_COMPARE(builder.fieldArraySize(2), 3);
+    CORRADE_COMPARE(builder.findFieldId(Trade::SceneField::Mesh), 1);
+    CORRADE_COMPARE(builder.findFieldId(Trade::SceneField::Light), Containers::NullOpt);
+
+    CORRADE_COMPARE(builder.addEntry(1, 3), 0);
+    CORRADE_COMPARE(builder.addEntry(2, 4), 1);
+    CORRADE_COMPARE(builder.fieldSize(0), 0);
+    CORRADE_COMPARE(builder.fieldSize(1), 2);
+    CORRADE_COMPARE(builder.fieldSize(2), 2);
+
+    /* Entries added to a field are added to all fields sharing its mapping,
+       zero-initialized */
+    CORRADE_COMPARE_AS(builder.mutableMapping(1), Containers::arrayView<UnsignedInt>({
+        3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(builder.mutableMapping(2), Containers::arrayView<UnsignedInt>({
+        3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(builder.mutableField<UnsignedShort>(1), Containers::arrayView<UnsignedShort>({
+        0, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(builder.mutableField(2).size(), (Containers::Size2D{2, 12}));
+}
+
+void SceneBuilderTest::constructMove() {
+    SceneBuilder a;
+    a.addObjects(3);
+    a.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+
+    SceneBuilder b = Utility::move(a);
+    CORRADE_COMPARE(b.mappingBound(), 3);
+    CORRADE_COMPARE(b.fieldCount(), 1);
+
+    SceneBuilder c;
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.mappingBound(), 3);
+    CORRADE_COMPARE(c.fieldCount(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SceneBuilder>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SceneBuilder>::value);
+}
+
+void SceneBuilderTest::build() {
+    SceneBuilder builder;
+    UnsignedInt parent = builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    UnsignedInt translation = builder.addField(Trade::SceneField::Translation, Trade::SceneFieldType::Vector3d);
+    UnsignedInt mesh = builder.addField(Trade::SceneField::Mesh, Trade::SceneFieldType::UnsignedByte);
+    UnsignedInt meshMaterial = builder.addField(mesh, Trade::SceneField::MeshMaterial, Trade::SceneFieldType::Int);
+
+    /* Interleaving object and entry addition */
+    for(Int i = 0; i != 5; ++i) {
+        UnsignedInt object = builder.addObject();
+        builder.addEntry(parent, object, i - 1);
+    }
+    builder.addEntry(translation, 3, Vector3d{1.0, 2.0, 3.0});
+    builder.addEntry(translation, 1, Vector3d{4.0, 5.0, 6.0});
+    builder.addEntry(mesh, 2, UnsignedByte{7});
+    std::size_t id = builder.addEntry(mesh, 4, UnsignedByte{6});
+    builder.mutableField<Int>(meshMaterial)[id] = 12;
+
+    Trade::SceneData scene = builder.build();
+    CORRADE_COMPARE(scene.mappingType(), Trade::SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(scene.mappingBound(), 5);
+    CORRADE_COMPARE(scene.fieldCount(), 4);
+
+    CORRADE_COMPARE(scene.fieldName(0), Trade::SceneField::Parent);
+    CORRADE_COMPARE(scene.fieldFlags(0), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(0), Containers::arrayView<UnsignedInt>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Int>(0), Containers::arrayView<Int>({
+        -1, 0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(scene.fieldName(1), Trade::SceneField::Translation);
+    CORRADE_COMPARE(scene.fieldFlags(1), Trade::SceneFieldFlags{});
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(1), Containers::arrayView<UnsignedInt>({
+        3, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Vector3d>(1), Containers::arrayView<Vector3d>({
+        {1.0, 2.0, 3.0},
+        {4.0, 5.0, 6.0}
+    }), TestSuite::Compare::Container);
+
+    /* Fields sharing the mapping have the same flags */
+    CORRADE_COMPARE(scene.fieldName(2), Trade::SceneField::Mesh);
+    CORRADE_COMPARE(scene.fieldFlags(2), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE(scene.fieldName(3), Trade::SceneField::MeshMaterial);
+    CORRADE_COMPARE(scene.fieldFlags(3), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE(scene.mapping(2).data(), scene.mapping(3).data());
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(2), Containers::arrayView<UnsignedInt>({
+        2, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<UnsignedByte>(2), Containers::arrayView<UnsignedByte>({
+        7, 6
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Int>(3), Containers::arrayView<Int>({
+        0, 12
+    }), TestSuite::Compare::Container);
+}
+
+void SceneBuilderTest::buildFlags() {
+    auto&& data = FlagsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    SceneBuilder builder;
+    builder.addObjects(4);
+    UnsignedInt field = builder.addField(Trade::SceneField::Light, Trade::SceneFieldType::UnsignedInt);
+    for(std::size_t i = 0; i != data.count; ++i)
+        builder.addEntry(field, data.objects[i], UnsignedInt(i));
+
+    Trade::SceneData scene = builder.build();
+    CORRADE_COMPARE(scene.fieldFlags(0), data.expected);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(0), Containers::arrayView(data.objects).prefix(data.count), TestSuite::Compare::Container);
+}
+
+void SceneBuilderTest::buildArrayField() {
+    SceneBuilder builder;
+    builder.addObjects(2);
+    UnsignedInt field = builder.addField(Trade::sceneFieldCustom(3), Trade::SceneFieldType::Short, 3);
+    builder.addEntry(field, 1);
+    builder.addEntry(field, 0);
+    Containers::StridedArrayView2D<Short> shorts = Containers::arrayCast<2, Short>(builder.mutableField(field));
+    shorts[0][0] = 1;
+    shorts[0][2] = 3;
+    shorts[1][1] = -2;
+
+    Trade::SceneData scene = builder.build();
+    CORRADE_COMPARE(scene.fieldArraySize(0), 3);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedInt>(0), Containers::arrayView<UnsignedInt>({
+        1, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Short[]>(0)[0], Containers::arrayView<Short>({
+        1, 0, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Short[]>(0)[1], Containers::arrayView<Short>({
+        0, -2, 0
+    }), TestSuite::Compare::Container);
+}
+
+void SceneBuilderTest::buildEmpty() {
+    {
+        SceneBuilder builder;
+        Trade::SceneData scene = builder.build();
+        CORRADE_COMPARE(scene.mappingBound(), 0);
+        CORRADE_COMPARE(scene.fieldCount(), 0);
+    } {
+        SceneBuilder builder;
+        builder.addObjects(3);
+        builder.addField(Trade::SceneField::Mesh, Trade::SceneFieldType::UnsignedInt);
+        builder.addField(Trade::SceneField::Camera, Trade::SceneFieldType::UnsignedInt);
+        builder.addEntry(1, 2, 5u);
+
+        Trade::SceneData scene = builder.build();
+        CORRADE_COMPARE(scene.mappingBound(), 3);
+        CORRADE_COMPARE(scene.fieldCount(), 2);
+        CORRADE_COMPARE(scene.fieldSize(0), 0);
+        CORRADE_COMPARE(scene.fieldSize(1), 1);
+        CORRADE_COMPARE_AS(scene.field<UnsignedInt>(1), Containers::arrayView<UnsignedInt>({
+            5
+        }), TestSuite::Compare::Container);
+    }
+}
+
+void SceneBuilderTest::buildResets() {
+    SceneBuilder builder;
+    builder.addObjects(2);
+    builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addEntry(0, 1, -1);
+
+    Trade::SceneData scene = builder.build();
+    CORRADE_COMPARE(scene.fieldCount(), 1);
+    CORRADE_COMPARE(builder.mappingBound(), 0);
+    CORRADE_COMPARE(builder.fieldCount(), 0);
+
+    /* The builder can be reused */
+    builder.addObject();
+    builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addEntry(0, 0, -1);
+    Trade::SceneData scene2 = builder.build();
+    CORRADE_COMPARE(scene2.mappingBound(), 1);
+    CORRADE_COMPARE(scene2.fieldSize(0), 1);
+}
+
+void SceneBuilderTest::reserve() {
+    SceneBuilder builder;
+    builder.addObjects(100);
+    UnsignedInt field = builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.reserve(field, 100);
+    builder.addEntry(field, 0, -1);
+    const void* data = builder.mutableMapping(field).data();
+    for(UnsignedInt i = 1; i != 100; ++i)
+        builder.addEntry(field, i, Int(i) - 1);
+
+    /* No reallocation happened after the reserve */
+    CORRADE_COMPARE(builder.mutableMapping(field).data(), data);
+
+    /* The only group is adopted by the scene without a copy */
+    Trade::SceneData scene = builder.build();
+    CORRADE_COMPARE(scene.data().data(), data);
+    CORRADE_COMPARE(scene.fieldSize(0), 100);
+    CORRADE_COMPARE(scene.fieldFlags(0), Trade::SceneFieldFlag::ImplicitMapping);
+}
+
+void SceneBuilderTest::mutableFieldWrongType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SceneBuilder builder;
+    builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addField(Trade::sceneFieldCustom(3), Trade::SceneFieldType::Float, 2);
+
+    Containers::String out;
+    Error redirectError{&out};
+    builder.mutableField<UnsignedInt>(0);
+    builder.mutableField<Float>(1);
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::SceneBuilder::mutableField(): Trade::SceneField::Parent is Trade::SceneFieldType::Int but requested a type equivalent to Trade::SceneFieldType::UnsignedInt\n"
+        "SceneTools::SceneBuilder::mutableField(): Trade::SceneField::Custom(3) is an array field, use the type-erased variant to access it\n",
+        TestSuite::Compare::String);
+}
+
+void SceneBuilderTest::invalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SceneBuilder builder;
+    builder.addObjects(2);
+    builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addEntry(0, 1, -1);
+
+    Containers::String out;
+    Error redirectError{&out};
+    builder.fieldName(1);
+    builder.fieldType(1);
+    builder.fieldArraySize(1);
+    builder.fieldSize(1);
+    builder.addField(Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addField(Trade::sceneFieldCustom(3), Trade::SceneFieldType::StringOffset32);
+    builder.addField(Trade::sceneFieldCustom(3), Trade::SceneFieldType::Bit);
+    builder.addField(1, Trade::sceneFieldCustom(3), Trade::SceneFieldType::Int);
+    builder.addField(0, Trade::SceneField::Parent, Trade::SceneFieldType::Int);
+    builder.addField(0, Trade::sceneFieldCustom(3), Trade::SceneFieldType::Int);
+    builder.reserve(1, 10);
+    builder.addEntry(1, 0);
+    builder.addEntry(0, 2);
+    builder.mutableMapping(1);
+    builder.mutableField(1);
+    builder.addObjects(0xfffffffeu);
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::SceneBuilder::fieldName(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::fieldType(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::fieldArraySize(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::fieldSize(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::addField(): field Trade::SceneField::Parent already added\n"
+        "SceneTools::SceneBuilder::addField(): string fields are not supported yet, sorry\n"
+        "SceneTools::SceneBuilder::addField(): bit fields are not supported yet, sorry\n"
+        "SceneTools::SceneBuilder::addField(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::addField(): field Trade::SceneField::Parent already added\n"
+        "SceneTools::SceneBuilder::addField(): can't share a mapping with Trade::SceneField::Parent as it already has 1 entries\n"
+        "SceneTools::SceneBuilder::reserve(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::addEntry(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::addEntry(): object 2 out of range for 2 objects\n"
+        "SceneTools::SceneBuilder::mutableMapping(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::mutableField(): index 1 out of range for 1 fields\n"
+        "SceneTools::SceneBuilder::addObjects(): adding 4294967294 objects to 2 would exceed a 32-bit mapping bound\n",
+        TestSuite::Compare::String);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneBuilderTest)
@@ -63,6 +63,7 @@ struct SceneConverterImplementationTest: TestSuite::Tester {
     /* Image info further tested in ImageConverterImplementationTest */
     void infoReferenceCount();
     void infoError();
+    void infoProbe();
 
     Utility::Arguments _infoArgs;
 
@@ -150,7 +151,8 @@ SceneConverterImplementationTest::SceneConverterImplementationTest() {
         Containers::arraySize(InfoOneOrAllData));
 
     addTests({&SceneConverterImplementationTest::infoReferenceCount,
-              &SceneConverterImplementationTest::infoError});
+              &SceneConverterImplementationTest::infoError,
+              &SceneConverterImplementationTest::infoProbe});
 
     /* A subset of arguments needed by the info printing code */
     _infoArgs.addBooleanOption("info")
@@ -164,6 +166,7 @@ SceneConverterImplementationTest::SceneConverterImplementationTest() {
              .addBooleanOption("info-meshes")
              .addBooleanOption("info-textures")
              .addBooleanOption("info-images")
+             .addBooleanOption("probe")
              .addBooleanOption("bounds")
              .addBooleanOption("object-hierarchy");
 
@@ -1398,6 +1401,52 @@ void SceneConverterImplementationTest::infoError() {
         "Object 0: A name\n");
 }
 
+void SceneConverterImplementationTest::infoProbe() {
+    struct Importer: Trade::AbstractImporter {
+        Trade::ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedLong doObjectCount() const override { return 5; }
+        UnsignedInt doMaterialCount() const override { return 2; }
+
+        /* None of these should get called */
+        UnsignedInt doMeshCount() const override { return 3; }
+        Containers::Optional<Trade::MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called.");
+            return {};
+        }
+        Containers::Optional<Trade::MaterialData> doMaterial(UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called.");
+            return {};
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<Trade::ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            CORRADE_FAIL("This shouldn't be called.");
+            return {};
+        }
+        Containers::Optional<Trade::ImageProperties2D> doImage2DProperties(UnsignedInt, UnsignedInt) override {
+            return Trade::ImageProperties2D{PixelFormat::RGBA8Unorm, {256, 128}};
+        }
+    } importer;
+
+    const char* argv[]{"", "--info", "--probe"};
+    CORRADE_VERIFY(_infoArgs.tryParse(Containers::arraySize(argv), argv));
+
+    std::chrono::high_resolution_clock::duration time;
+
+    Containers::String out;
+    Debug redirectOutput{&out};
+    CORRADE_VERIFY(Implementation::printInfo(Debug::Flag::DisableColors, {}, _infoArgs, importer, time) == false);
+    CORRADE_COMPARE(out,
+        "Objects: 5\n"
+        "Materials: 2\n"
+        "Meshes: 3\n"
+        "2D image 0:\n"
+        "  Level 0: {256, 128} @ RGBA8Unorm\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneConverterImplementationTest)
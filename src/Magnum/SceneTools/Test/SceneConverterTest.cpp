@@ -25,13 +25,16 @@
 */
 
 #include <cstdlib>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/File.h>
+#include <Corrade/TestSuite/Compare/FileToString.h>
 #include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/Utility/Format.h>
@@ -40,6 +43,8 @@
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/ImportCache.h"
+#include "Magnum/Trade/SceneData.h"
 
 #include "configure.h"
 
@@ -51,6 +56,10 @@ struct SceneConverterTest: TestSuite::Tester {
     void info();
     void convert();
     void error();
+
+    void groupMeshInstances();
+    void cache();
+    void cacheReferencedFileChanged();
 };
 
 using namespace Containers::Literals;
@@ -301,6 +310,19 @@ const struct {
         "Mesh 0 duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    {"two meshes + scene, remove duplicate vertices, two threads", {InPlaceInit, {
+            "--remove-duplicate-vertices", "-j", "2",
+            "-I", "GltfImporter", "-C", "GltfSceneConverter",
+            /* Removing the generator identifier for a smaller file */
+            "-c", "generator=",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-quads-duplicates.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-quads.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        /* The meshes are processed in parallel but should be added in the
+           original order, producing the same file as on a single thread */
+        "two-quads.gltf", "two-quads.bin",
+        {}},
     {"one implicit mesh, remove duplicate vertices fuzzy", {InPlaceInit, {
             "--remove-duplicate-vertices-fuzzy", "1.0e-1",
             Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-duplicates-fuzzy.obj"),
@@ -672,6 +694,19 @@ const struct {
         {"StbResizeImageConverter", "PngImageConverter"}, nullptr,
         "images-2d-1x1.gltf", "images-2d-1x1.bin",
         {}},
+    {"2D image converter, two images, two threads", {InPlaceInit, {
+            "-P", "StbResizeImageConverter", "-p", "size=\"1 1\"", "-j", "2",
+            /* Removing the generator identifier for a smaller file, bundling
+               the images to avoid having too many files */
+            "-c", "bundleImages,generator=",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/images-2d.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/images-2d-1x1.gltf")
+        }},
+        "GltfImporter", "PngImporter", "GltfSceneConverter",
+        {"StbResizeImageConverter", "PngImageConverter"}, nullptr,
+        /* Same output as on a single thread */
+        "images-2d-1x1.gltf", "images-2d-1x1.bin",
+        {}},
     {"2D image converter, two images, verbose", {InPlaceInit, {
             "-I", "GltfImporter", "-C", "GltfSceneConverter",
             "-P", "StbResizeImageConverter", "-p", "size=\"1 1\"",
@@ -1028,6 +1063,12 @@ const struct {
         }},
         nullptr, nullptr, nullptr, nullptr,
         "The --mesh and --concatenate-meshes options are mutually exclusive\n"},
+    {"negative --cache-size-limit", {InPlaceInit, {
+            "--cache-size-limit", "-1", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        /* Would otherwise wrap around to a huge value */
+        "The --cache-size-limit option expects a non-negative value but got -1\n"},
     {"--mesh-level but no --mesh", {InPlaceInit, {
             "--mesh-level", "0", "a", "b"
         }},
@@ -1038,6 +1079,11 @@ const struct {
         }},
         nullptr, nullptr, nullptr, nullptr,
         "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes\n"},
+    {"--probe without --info", {InPlaceInit, {
+            "--probe", "a", "b"
+        }},
+        nullptr, nullptr, nullptr, nullptr,
+        "The --probe option can be only used together with --info or other data-related --info-* options\n"},
     {"--prefer without a colon", {InPlaceInit, {
             "--prefer", "PngImporter=StbImageImporter", "a", "b",
         }},
@@ -1417,6 +1463,10 @@ SceneConverterTest::SceneConverterTest() {
     addInstancedTests({&SceneConverterTest::error},
         Containers::arraySize(ErrorData));
 
+    addTests({&SceneConverterTest::groupMeshInstances,
+              &SceneConverterTest::cache,
+              &SceneConverterTest::cacheReferencedFileChanged});
+
     /* Create output dir, if doesn't already exist */
     Utility::Path::make(Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles"));
 }
@@ -1577,6 +1627,225 @@ void SceneConverterTest::error() {
     #endif
 }
 
+void SceneConverterTest::groupMeshInstances() {
+    #ifndef SCENECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-sceneconverter not built, can't test");
+    #else
+    /* Check if required plugins can be loaded. Catches also ABI and interface
+       mismatch errors. */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractSceneConverter> converterManager{MAGNUM_PLUGINS_SCENECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("GltfImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("GltfImporter plugin can't be loaded.");
+    if(!(importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    /* The glTF format has the mesh assignment directly in nodes and thus
+       loses the order of the mesh field. Convert to a serialized blob instead
+       to verify the output is actually grouped. */
+    const Containers::String input = Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/mesh-instances.gltf");
+    const Containers::String output = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/mesh-instances-grouped.blob");
+    if(Utility::Path::exists(output))
+        CORRADE_VERIFY(Utility::Path::remove(output));
+
+    Containers::Pair<bool, Containers::String> converted = call({
+        "-I", "GltfImporter", "-C", "MagnumSceneConverter",
+        "--group-mesh-instances", "-v", input, output});
+    CORRADE_COMPARE_AS(converted.second(),
+        "Mesh instance grouping in scene 0: 4 -> 2 runs of 4 instances\n",
+        TestSuite::Compare::StringContains);
+    CORRADE_VERIFY(converted.first());
+
+    /* Objects sharing the same mesh are next to each other now, in the
+       original relative order */
+    Containers::Pointer<Trade::AbstractImporter> importer = importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openFile(output));
+    Containers::Optional<Trade::SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE_AS(scene->meshesMaterialsAsArray(), (Containers::arrayView<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>>({
+        {0, {0, -1}},
+        {2, {0, -1}},
+        {1, {1, -1}},
+        {3, {1, -1}},
+    })), TestSuite::Compare::Container);
+
+    /* The --info-scenes statistics are the same as for the original file,
+       they count the combinations and not the runs */
+    for(const Containers::Pair<Containers::StringView, Containers::StringView> file: {
+        Containers::pair("GltfImporter"_s, Containers::StringView{input}),
+        Containers::pair("MagnumImporter"_s, Containers::StringView{output})
+    }) {
+        CORRADE_ITERATION(file.first());
+        Containers::Pair<bool, Containers::String> info = call({
+            "-I", file.first(), "--info-scenes", file.second()});
+        CORRADE_COMPARE_AS(info.second(),
+            "  Mesh instances: 4 in 2 unique mesh and material combinations, at most 2 per combination\n",
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(info.first());
+    }
+    #endif
+}
+
+void SceneConverterTest::cache() {
+    #ifndef SCENECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-sceneconverter not built, can't test");
+    #else
+    /* Check if required plugins can be loaded. Catches also ABI and interface
+       mismatch errors. */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractSceneConverter> converterManager{MAGNUM_PLUGINS_SCENECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("GltfImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("GltfImporter plugin can't be loaded.");
+    if(!(importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(converterManager.load("GltfSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("GltfSceneConverter plugin can't be loaded.");
+    if(!(converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    /* Start with an empty cache */
+    const Containers::String cacheDir = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/cache");
+    Trade::ImportCache{cacheDir, 1024*1024}.clear();
+
+    const Containers::String input = Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-triangles-transformed.gltf");
+    /* The output file name is the same for both runs as it's referenced
+       from the glTF */
+    const Containers::String output = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-triangles-transformed-cached.gltf");
+    const Containers::String outputBin = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-triangles-transformed-cached.bin");
+    const Containers::Array<Containers::String> args{InPlaceInit, {
+        "-I", "GltfImporter", "-C", "GltfSceneConverter", "-c", "generator=",
+        "--cache-dir", cacheDir, "--cache-size-limit", "1", "-v",
+        input, output
+    }};
+
+    /* A cold run doesn't find the input in the cache, imports it, stores the
+       result to the cache and converts the cached data */
+    Containers::String coldOutput, coldOutputBin;
+    {
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Didn't find {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(converted.first());
+
+        /* The data and a list of files the importer read */
+        Trade::ImportCache cache{cacheDir, 1024*1024};
+        CORRADE_COMPARE(cache.count(), 2);
+        CORRADE_VERIFY(cache.size());
+
+        Containers::Optional<Containers::String> outputData = Utility::Path::readString(output);
+        Containers::Optional<Containers::String> outputBinData = Utility::Path::readString(outputBin);
+        CORRADE_VERIFY(outputData);
+        CORRADE_VERIFY(outputBinData);
+        coldOutput = Utility::move(*outputData);
+        coldOutputBin = Utility::move(*outputBinData);
+    }
+
+    /* A second run is served from the cache, producing the same output */
+    {
+        CORRADE_VERIFY(Utility::Path::remove(output));
+        CORRADE_VERIFY(Utility::Path::remove(outputBin));
+
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Found {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(converted.first());
+
+        CORRADE_COMPARE(Trade::ImportCache(cacheDir, 1024*1024).count(), 2);
+        CORRADE_COMPARE_AS(output,
+            coldOutput,
+            TestSuite::Compare::FileToString);
+        CORRADE_COMPARE_AS(outputBin,
+            coldOutputBin,
+            TestSuite::Compare::FileToString);
+    }
+    #endif
+}
+
+void SceneConverterTest::cacheReferencedFileChanged() {
+    #ifndef SCENECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-sceneconverter not built, can't test");
+    #else
+    /* Check if required plugins can be loaded. Catches also ABI and interface
+       mismatch errors. */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractSceneConverter> converterManager{MAGNUM_PLUGINS_SCENECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("GltfImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("GltfImporter plugin can't be loaded.");
+    if(!(importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(converterManager.load("GltfSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("GltfSceneConverter plugin can't be loaded.");
+    if(!(converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    /* Start with an empty cache */
+    const Containers::String cacheDir = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/cache-referenced");
+    Trade::ImportCache{cacheDir, 1024*1024}.clear();
+
+    /* Copy the glTF together with its buffer, which gets modified later */
+    const Containers::String inputDir = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/cache-referenced-input");
+    CORRADE_VERIFY(Utility::Path::make(inputDir));
+    const Containers::String input = Utility::Path::join(inputDir, "two-triangles-transformed.gltf");
+    const Containers::String inputBin = Utility::Path::join(inputDir, "two-triangles-transformed.bin");
+    CORRADE_VERIFY(Utility::Path::copy(Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-triangles-transformed.gltf"), input));
+    CORRADE_VERIFY(Utility::Path::copy(Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-triangles-transformed.bin"), inputBin));
+
+    const Containers::String output = Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-triangles-transformed-cached-referenced.gltf");
+    const Containers::Array<Containers::String> args{InPlaceInit, {
+        "-I", "GltfImporter", "-C", "GltfSceneConverter", "-c", "generator=",
+        "--cache-dir", cacheDir, "-v",
+        input, output
+    }};
+
+    {
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Didn't find {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(converted.first());
+    } {
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Found {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(converted.first());
+    }
+
+    /* Change the Z coordinate of the last vertex to 1.0f. The glTF itself
+       stays the same, but the result shouldn't be served from the cache
+       anymore. */
+    {
+        Containers::Optional<Containers::Array<char>> bin = Utility::Path::read(inputBin);
+        CORRADE_VERIFY(bin);
+        CORRADE_COMPARE(bin->size(), 72);
+        const Float one = 1.0f;
+        std::memcpy(bin->data() + 68, &one, sizeof(Float));
+        CORRADE_VERIFY(Utility::Path::write(inputBin, *bin));
+
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Didn't find {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(converted.first());
+    }
+
+    /* Removing the referenced file is a miss as well, the import then fails */
+    {
+        CORRADE_VERIFY(Utility::Path::remove(inputBin));
+
+        Containers::Pair<bool, Containers::String> converted = call(args);
+        CORRADE_COMPARE_AS(converted.second(),
+            Utility::format("Didn't find {} in the cache as ", input),
+            TestSuite::Compare::StringContains);
+        CORRADE_VERIFY(!converted.first());
+    }
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::SceneConverterTest)
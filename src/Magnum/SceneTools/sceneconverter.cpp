@@ -24,9 +24,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/DebugStl.h> /** @todo remove once Arguments is std::string-free */
@@ -34,6 +38,7 @@
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* parseNumberSequence() */
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MaterialTools/PhongToPbrMetallicRoughness.h"
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Concatenate.h"
@@ -42,12 +47,15 @@
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
+#include "Magnum/SceneTools/MeshInstances.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImportCache.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 
 #include "Magnum/Implementation/converterUtilities.h"
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/SceneTools/Implementation/sceneConverterUtilities.h"
 
 namespace Magnum {
@@ -184,9 +192,10 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-C|--converter PLUGIN]... [-P|--image-converter PLUGIN]...
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
-    [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
+    [--map] [--cache-dir DIR] [--cache-size-limit MB] [-j|--jobs N]
+    [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
     [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
-    [--remove-duplicate-materials]
+    [--remove-duplicate-materials] [--group-mesh-instances]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
@@ -197,8 +206,10 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [--info-converter] [--info-image-converter] [--info-animations]
     [--info-images] [--info-lights] [--info-cameras] [--info-materials]
     [--info-meshes] [--info-objects] [--info-scenes] [--info-skins]
-    [--info-textures] [--info] [--color on|4bit|off|auto] [--bounds]
-    [--object-hierarchy] [-v|--verbose] [--profile] [--] input output
+    [--info-textures] [--info] [--probe] [--color on|4bit|off|auto] [--bounds]
+    [--object-hierarchy] [-v|--verbose] [--profile]
+    [--profile-format text|json|csv] [--profile-output FILE] [--trace FILE]
+    [--] input output
 @endcode
 
 Arguments:
@@ -219,6 +230,12 @@ Arguments:
 -   `--set plugin:key=val,key2=val2,…` ---  set global plugin(s) option
 -   `--map` --- memory-map the input for zero-copy import (works only for
     standalone files)
+-   `--cache-dir DIR` --- cache imported and processed data in given
+    directory
+-   `--cache-size-limit MB` --- size limit of the cache directory (default:
+    `1024`)
+-   `-j`, `--jobs N` --- import and process images and meshes on given count
+    of threads, `0` for all available (default: `1`)
 -   `--only-mesh-attributes N1,N2-N3…` --- include only mesh attributes of
     given IDs in the output. See
     @relativeref{Corrade,Utility::String::parseNumberSequence()} for syntax
@@ -233,6 +250,9 @@ Arguments:
     using @ref MaterialTools::phongToPbrMetallicRoughness()
 -   `--remove-duplicate-materials` --- remove duplicate materials using
     @ref MaterialTools::removeDuplicatesInPlace()
+-   `--group-mesh-instances` --- group mesh instances sharing the same mesh
+    and material using @ref SceneTools::groupMeshInstances()
+    @m_class{m-label m-warning} **experimental**
 -   `-i`, `--importer-options key=val,key2=val2,…` --- configuration options to
     pass to the importer
 -   `-c`, `--converter-options key=val,key2=val2,…` --- configuration options
@@ -268,11 +288,18 @@ Arguments:
 -   `--info-textures` --- print into about textures in the input file and exit
 -   `--info` --- print info about everything in the input file and exit, same
     as specifying all other data-related `--info-*` options together
+-   `--probe` --- with `--info` or any other data-related `--info-*` option,
+    print just data counts and image properties without importing anything
 -   `--color` --- colored output for `--info` (default: `auto`)
 -   `--bounds` --- show bounds of known attributes in `--info` output
 -   `--object-hierarchy` --- visualize object hierarchy in `--info` output
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
 -   `--profile` --- measure import and conversion time
+-   `--profile-format text|json|csv` --- format of the `--profile` output
+    (default: `text`)
+-   `--profile-output FILE` --- save the `--profile` output to a file instead,
+    implies `--profile`
+-   `--trace FILE` --- save a Chrome trace of all import and conversion steps
 
 If any of the `--info-importer`, `--info-converter` or `--info-image-converter`
 options are given, the utility will print information about given plugin
@@ -288,6 +315,14 @@ one data references another and both `--info-*` options are specified, the
 output will also list reference count (for example, `--info-scenes` together
 with `--info-meshes` will print how many objects reference given mesh).
 
+If `--probe` is given together with the data-related `--info-*` options,
+only the count of each data type is printed, together with image properties
+queried through @relativeref{Trade,AbstractImporter::image2DProperties()} and
+related APIs if `--info` or `--info-images` is specified. Nothing else is
+imported, which makes it considerably faster for large files. Whether the
+image properties are retrieved without decoding the image depends on the
+importer plugin.
+
 The `-i`, `-c` and `-m` arguments accept a comma-separated list of key/value
 pairs to set in the importer / converter plugin configuration. If the `=`
 character is omitted, it's equivalent to saying `key=true`; configuration
@@ -318,6 +353,15 @@ The `--remove-duplicate-vertices`, `--phong-to-pbr` and
 `--remove-duplicate-materials` operations are performed on meshes and materials
 before passing them to any converter.
 
+If `--group-mesh-instances` is given, mesh assignments in all scenes are
+reordered with @ref SceneTools::groupMeshInstances() so all objects sharing the
+same mesh and material combination form a contiguous run, which allows
+renderers to draw each run with a single instanced draw. It's done after
+`--remove-duplicate-materials`, which can make more combinations equivalent.
+The `--info-scenes` output lists the count of mesh instances together with the
+count of unique mesh and material combinations and the size of the largest
+one, allowing to estimate the benefit of instancing upfront.
+
 If `--concatenate-meshes` is given, all meshes of the input file are
 first concatenated into a single mesh using @ref MeshTools::concatenate(), with
 the scene hierarchy transformation baked in using
@@ -325,6 +369,44 @@ the scene hierarchy transformation baked in using
 remaining operations. Only attributes that are present in the first mesh are
 taken, if `--only-mesh-attributes` is specified as well, the IDs reference
 attributes of the first mesh.
+
+If `--cache-dir` is given, the imported and processed data are stored in given
+directory using @ref Trade::ImportCache, serialized with
+@relativeref{Trade,MagnumSceneConverter} and keyed by contents of the input
+file, all options that affect the imported and processed data and the resolved
+plugin directories, so a different `--plugin-dir` results in a cache miss. If
+the same input file is converted again with the same options, the data are
+imported from the cache with @relativeref{Trade,MagnumImporter} instead,
+skipping the original import and all processing. Least recently used entries
+are removed when the cache size exceeds `--cache-size-limit`. Files the
+importer reads in addition to the input file, such as external glTF buffers or
+images, are hashed as well, and a change in any of them results in a cache
+miss. This requires the importer to support file callbacks, otherwise the
+result isn't cached. If the input contains data that can't be stored in the
+blob format, such as animations, lights, cameras or skins, the result isn't
+cached.
+
+If `-j` / `--jobs` is given, import and processing of images with `-P` and
+meshes with `--remove-duplicate-vertices`, `--remove-duplicate-vertices-fuzzy`
+or `-M` is done on given count of threads. Each thread uses its own plugin
+managers, importer instance opened on the input file and converter instances,
+so the plugins don't need to be thread-safe. The results are passed to the
+scene converter in the original order, so the output is the same regardless
+of the thread count. Verbose output from different threads may however
+interleave. As the input file is opened once for each thread, memory use
+grows with the thread count.
+
+If `--profile` is given, the utility prints time spent in import and
+conversion, followed by a breakdown by stage --- opening the file, importing,
+each processing operation and each converter plugin --- together with the
+amount of data each stage consumed and produced and peak memory usage of the
+process. With `--profile-format json` or `csv`, the output contains also a
+record for every processed item and is printed to the standard output or saved
+to a file given by `--profile-output`. All times in it are in microseconds and
+sizes in bytes. The `--trace` option saves the same records in the Trace Event
+Format, which can be opened in `chrome://tracing` or
+[Perfetto](https://ui.perfetto.dev/) to see how the work was distributed across
+threads. Peak memory usage is currently reported only on Unix platforms.
 */
 
 }
@@ -354,7 +436,310 @@ bool isDataInfoRequested(const Utility::Arguments& args) {
            args.isSet("info");
 }
 
-template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
+/* Files read by the importer through a file callback on a --cache-dir miss,
+   each with a key calculated from its contents. These are stored in the cache
+   alongside the data, and the data key includes them, so a change in any
+   file referenced by the input, such as an external glTF buffer or image,
+   results in a cache miss. The callback is shared by importers of all
+   workers, so it's guarded by a mutex. */
+struct CacheFiles {
+    std::mutex mutex;
+    Containers::Array<Containers::Pair<Containers::String, Containers::String>> keys;
+    /* Data passed to the importers, kept until they're closed */
+    Containers::Array<Containers::Pair<Containers::String, Containers::Array<char>>> data;
+};
+
+Containers::Optional<Containers::ArrayView<const char>> cacheFileCallback(const std::string& filename, const InputFileCallbackPolicy policy, CacheFiles& files) {
+    const Containers::StringView name{filename.data(), filename.size()};
+    std::lock_guard<std::mutex> lock{files.mutex};
+
+    if(policy == InputFileCallbackPolicy::Close) {
+        for(Containers::Pair<Containers::String, Containers::Array<char>>& data: files.data) {
+            if(data.first() != name || !data.second())
+                continue;
+            data.second() = {};
+            break;
+        }
+        return {};
+    }
+
+    Containers::Optional<Containers::Array<char>> data = Utility::Path::read(name);
+    if(!data)
+        return {};
+
+    bool recorded = false;
+    for(const Containers::Pair<Containers::String, Containers::String>& key: files.keys)
+        if(key.first() == name) recorded = true;
+    if(!recorded)
+        arrayAppend(files.keys, InPlaceInit, Containers::String{name}, Trade::ImportCache::key(*data, {}));
+
+    /* Moving the array into the list keeps the memory at the same
+       location */
+    const Containers::ArrayView<const char> view = *data;
+    arrayAppend(files.data, InPlaceInit, Containers::String{name}, *Utility::move(data));
+    return view;
+}
+
+/* Key of the cached data, derived from the key of the input file and options
+   and from keys of all files the importer read through a file callback */
+Containers::String cacheDataKey(const Containers::StringView inputKey, const Containers::ArrayView<const Containers::Pair<Containers::String, Containers::String>> files) {
+    Containers::Array<Containers::String> options;
+    for(const Containers::Pair<Containers::String, Containers::String>& file: files)
+        arrayAppend(options, Utility::format("{} {}", file.second(), file.first()));
+    return Trade::ImportCache::key(inputKey, "\n"_s.join(options));
+}
+
+/* Name of the cache entry listing the files the importer read through a file
+   callback, one per line */
+Containers::String cacheFilesKey(const Containers::StringView inputKey) {
+    return inputKey + ".files"_s;
+}
+
+/* Plugin managers, with the image converter manager registered as an
+   external manager of the scene converter manager. With -j, each thread gets
+   its own set, as plugin managers aren't thread-safe and importers may load
+   and instantiate other plugins during import. */
+struct Managers {
+    explicit Managers(const Utility::Arguments& args);
+
+    PluginManager::Manager<Trade::AbstractImporter> importerManager;
+    /* Image converter manager for potential dependencies. Needs to be
+       constructed before the scene converter manager for proper destruction
+       order. */
+    PluginManager::Manager<Trade::AbstractImageConverter> imageConverterManager;
+    PluginManager::Manager<Trade::AbstractSceneConverter> converterManager;
+};
+
+Managers::Managers(const Utility::Arguments& args):
+    importerManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        args.value("plugin-dir").empty() ? Containers::String{} :
+        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
+        #endif
+    },
+    imageConverterManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        args.value("plugin-dir").empty() ? Containers::String{} :
+        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
+        #endif
+    },
+    converterManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        args.value("plugin-dir").empty() ? Containers::String{} :
+        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractSceneConverter::pluginSearchPaths().back()))
+        #endif
+    }
+{
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    static_cast<void>(args);
+    #endif
+    converterManager.registerExternalManager(imageConverterManager);
+}
+
+/* Options that affect the imported and processed data, used together with
+   the input file contents to form a --cache-dir key. Options affecting only
+   the output, such as -C and -c, aren't included as the cache stores data
+   before they're passed to the scene converter. The resolved plugin
+   directories are included as well, so running the same input with a
+   different plugin build isn't a hit. */
+Containers::String cacheOptions(const Utility::Arguments& args, const Managers& managers) {
+    Containers::Array<Containers::String> options;
+    for(const char* const option: {"importer",
+                                   "importer-options",
+                                   "only-mesh-attributes",
+                                   "remove-duplicate-vertices-fuzzy",
+                                   "mesh",
+                                   "mesh-level"})
+        arrayAppend(options, Utility::format("{}={}", option, args.value<Containers::StringView>(option)));
+    for(const char* const option: {"remove-duplicate-vertices",
+                                   "phong-to-pbr",
+                                   "remove-duplicate-materials",
+                                   "group-mesh-instances",
+                                   "passthrough-on-image-converter-failure",
+                                   "passthrough-on-mesh-converter-failure",
+                                   "concatenate-meshes"})
+        arrayAppend(options, Utility::format("{}={}", option, args.isSet(option) ? "true" : "false"));
+    for(const char* const option: {"prefer",
+                                   "set",
+                                   "image-converter",
+                                   "image-converter-options",
+                                   "mesh-converter",
+                                   "mesh-converter-options"})
+        for(std::size_t i = 0, iMax = args.arrayValueCount(option); i != iMax; ++i)
+            arrayAppend(options, Utility::format("{}[{}]={}", option, i, args.arrayValue<Containers::StringView>(option, i)));
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    arrayAppend(options, Utility::format("plugin-dir[importer]={}", managers.importerManager.pluginDirectory()));
+    arrayAppend(options, Utility::format("plugin-dir[imageconverter]={}", managers.imageConverterManager.pluginDirectory()));
+    arrayAppend(options, Utility::format("plugin-dir[sceneconverter]={}", managers.converterManager.pluginDirectory()));
+    #else
+    static_cast<void>(managers);
+    #endif
+
+    return "\n"_s.join(options);
+}
+
+/* Applies --prefer and --set options to the managers */
+bool configureManagers(const Utility::Arguments& args, Managers& managers) {
+    /* Set preferred plugins */
+    for(std::size_t i = 0, iMax = args.arrayValueCount("prefer"); i != iMax; ++i) {
+        const auto value = args.arrayValue<Containers::StringView>("prefer", i);
+        const Containers::Array3<Containers::StringView> aliasNames = value.partition(':');
+        if(!aliasNames[1]) {
+            Error{} << "Invalid --prefer option" << value;
+            return false;
+        }
+
+        /* Figure out manager name */
+        PluginManager::AbstractManager* manager;
+        if(aliasNames[0].hasSuffix("Importer"_s))
+            manager = &managers.importerManager;
+        else if(aliasNames[0].hasSuffix("ImageConverter"_s))
+            manager = &managers.imageConverterManager;
+        else if(aliasNames[0].hasSuffix("SceneConverter"_s))
+            manager = &managers.converterManager;
+        else {
+            Error{} << "Alias" << aliasNames[0] << "not recognized for a --prefer option";
+            return false;
+        }
+
+        /* The alias has to be found, otherwise it'd assert */
+        if(manager->loadState(aliasNames[0]) == PluginManager::LoadState::NotFound) {
+            Error{} << "Alias" << aliasNames[0] << "not found for a --prefer option";
+            return false;
+        }
+
+        /* Check that the names actually provide given alias, otherwise it'd
+           assert */
+        const Containers::Array<Containers::StringView> names = aliasNames[2].splitWithoutEmptyParts(',');
+        for(const Containers::StringView name: names) {
+            /* Not found plugins are allowed in the list */
+            const PluginManager::PluginMetadata* const metadata = manager->metadata(name);
+            if(!metadata)
+                continue;
+
+            bool found = false;
+            for(const Containers::StringView provides: metadata->provides()) {
+                if(provides == aliasNames[0]) {
+                    found = true;
+                    break;
+                }
+            }
+            if(!found) {
+                Error{} << name << "doesn't provide" << aliasNames[0] << "for a --prefer option";
+                return false;
+            }
+        }
+
+        manager->setPreferredPlugins(aliasNames[0], names);
+    }
+
+    /* Set global plugin options */
+    for(std::size_t i = 0, iMax = args.arrayValueCount("set"); i != iMax; ++i) {
+        const auto value = args.arrayValue<Containers::StringView>("set", i);
+        const Containers::Array3<Containers::StringView> nameOptions = value.partition(':');
+        if(!nameOptions[1]) {
+            Error{} << "Invalid --set option" << value;
+            return false;
+        }
+
+        /* Figure out manager name */
+        PluginManager::AbstractManager* manager;
+        if(nameOptions[0].hasSuffix("Importer"_s))
+            manager = &managers.importerManager;
+        else if(nameOptions[0].hasSuffix("ImageConverter"_s))
+            manager = &managers.imageConverterManager;
+        else if(nameOptions[0].hasSuffix("SceneConverter"_s))
+            manager = &managers.converterManager;
+        else {
+            Error{} << "Plugin" << nameOptions[0] << "not recognized for a --set option";
+            return false;
+        }
+
+        /* Get the metadata to access global configuration */
+        PluginManager::PluginMetadata* const metadata = manager->metadata(nameOptions[0]);
+        if(!metadata) {
+            Error{} << "Plugin" << nameOptions[0] << "not found for a --set option";
+            return false;
+        }
+
+        /* Set options. Doing things like --set AnyImageImporter:foo=bar makes
+           no sense, so this isn't excluding any "Any*" plugins from the
+           unrecognized option warnings */
+        Implementation::setOptions(nameOptions[0], metadata->configuration(), {}, nameOptions[2]);
+    }
+
+    return true;
+}
+
+/* Per-thread state for image and mesh processing. The first worker uses the
+   importer and plugin managers created in main(), additional workers created
+   with -j own theirs. */
+struct Worker {
+    explicit Worker(const Utility::Arguments& args): imageConverters{ValueInit, args.arrayValueCount("image-converter")}, meshConverters{ValueInit, args.arrayValueCount("mesh-converter")} {}
+
+    /* Declared first so they're destroyed after all plugin instances */
+    Containers::Pointer<Managers> managerStorage;
+    Containers::Pointer<Trade::AbstractImporter> importerStorage;
+    Managers* managers{};
+    Trade::AbstractImporter* importer{};
+    /* Instantiated on first use and then reused for all images and meshes
+       processed by the same worker */
+    Containers::Array<Containers::Pointer<Trade::AbstractImageConverter>> imageConverters;
+    Containers::Array<Containers::Pointer<Trade::AbstractSceneConverter>> meshConverters;
+    /* Shared by all workers, null if profiling isn't requested */
+    Trade::Implementation::Profiler* profiler{};
+    std::chrono::high_resolution_clock::duration importTime{};
+    std::chrono::high_resolution_clock::duration conversionTime{};
+};
+
+/* Data sizes, for profiling */
+std::size_t dataSize(const Trade::MeshData& mesh) {
+    return mesh.indexData().size() + mesh.vertexData().size();
+}
+
+template<UnsignedInt dimensions> std::size_t dataSize(const Trade::ImageData<dimensions>& image) {
+    return image.data().size();
+}
+
+/* Calls function(worker, i) for each i in [0, count), each worker on its own
+   thread. Items are picked from a shared counter so all threads stay busy
+   even if the items differ in size. Stops at the first failure and returns
+   the exit code from it, or 0 on success. With a single worker the items are
+   processed in order on the calling thread. */
+template<class F> int forEachItem(const Containers::ArrayView<Worker> workers, const std::size_t count, F&& function) {
+    std::atomic<std::size_t> next{0};
+    std::atomic<int> exitCode{0};
+    Magnum::Implementation::parallelFor(workers.size(), workers.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t w = begin; w != end; ++w) {
+            for(std::size_t i; !exitCode && (i = next++) < count; ) {
+                if(const int result = function(workers[w], UnsignedInt(i))) {
+                    int expected = 0;
+                    exitCode.compare_exchange_strong(expected, result);
+                }
+            }
+        }
+    });
+    return exitCode;
+}
+
+/* Adds durations measured by the workers to the totals and resets them. The
+   workers run in parallel, so only the longest one counts. */
+void collectDurations(const Containers::ArrayView<Worker> workers, std::chrono::high_resolution_clock::duration& importConversionTime, std::chrono::high_resolution_clock::duration& conversionTime) {
+    std::chrono::high_resolution_clock::duration maxImportTime{};
+    std::chrono::high_resolution_clock::duration maxConversionTime{};
+    for(Worker& worker: workers) {
+        if(worker.importTime > maxImportTime)
+            maxImportTime = worker.importTime;
+        if(worker.conversionTime > maxConversionTime)
+            maxConversionTime = worker.conversionTime;
+        worker.importTime = {};
+        worker.conversionTime = {};
+    }
+    importConversionTime += maxImportTime;
+    conversionTime += maxConversionTime;
+}
+
+template<UnsignedInt dimensions> bool runImageConverters(Worker& worker, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
     const bool passthroughOnConversionFailure = args.isSet("passthrough-on-image-converter-failure");
 
     for(std::size_t j = 0, imageConverterCount = args.arrayValueCount("image-converter"); j != imageConverterCount; ++j) {
@@ -367,18 +752,21 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
             d << "with" << imageConverterName << Debug::nospace << "...";
         }
 
-        Containers::Pointer<Trade::AbstractImageConverter> imageConverter = imageConverterManager.loadAndInstantiate(imageConverterName);
+        Containers::Pointer<Trade::AbstractImageConverter>& imageConverter = worker.imageConverters[j];
         if(!imageConverter) {
-            Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
-            return false;
-        }
+            PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager = worker.managers->imageConverterManager;
+            if(!(imageConverter = imageConverterManager.loadAndInstantiate(imageConverterName))) {
+                Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
+                return false;
+            }
 
-        /* Set options, if passed. The AnyImageConverter check makes no
-            sense here, is just there because the helper wants it */
-        if(args.isSet("verbose"))
-            imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(j < args.arrayValueCount("image-converter-options"))
-            Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
+            /* Set options, if passed. The AnyImageConverter check makes no
+                sense here, is just there because the helper wants it */
+            if(args.isSet("verbose"))
+                imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
+            if(j < args.arrayValueCount("image-converter-options"))
+                Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
+        }
 
         Trade::ImageConverterFeatures expectedFeatures;
         if(dimensions == 2) {
@@ -404,7 +792,13 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
         /** @todo handle image levels here, once GltfSceneConverter is capable
             of converting them (which needs AbstractImageConverter to be
             reworked around ImageData) */
-        if(Containers::Optional<Trade::ImageData<dimensions>> converted = imageConverter->convert(*image)) {
+        Containers::Optional<Trade::ImageData<dimensions>> converted;
+        {
+            Trade::Implementation::Duration d{worker.conversionTime, worker.profiler, imageConverterName, dimensions == 2 ? "2D image"_s : "3D image"_s, Int(i)};
+            if((converted = imageConverter->convert(*image)))
+                d.setBytes(dataSize(*image), dataSize(*converted));
+        }
+        if(converted) {
             image = Utility::move(converted);
         } else if(passthroughOnConversionFailure) {
             Warning{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName << Debug::nospace << ", passing the original through";
@@ -419,6 +813,102 @@ template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<
 
 }
 
+/* Runs duplicate removal and -M converters on given mesh. Returns 0 on
+   success and an exit code otherwise. */
+int processMesh(Worker& worker, const Utility::Arguments& args, const UnsignedInt i, const bool singleMesh, Containers::Optional<Trade::MeshData>& mesh) {
+    const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
+
+    /* Duplicate removal */
+    if(args.isSet("remove-duplicate-vertices") ||
+       args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
+    {
+        const UnsignedInt beforeVertexCount = mesh->vertexCount();
+        const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
+
+        /** @todo accept two values for float and double fuzzy
+            comparison, or maybe also different for positions, normals
+            and texcoords? ugh... */
+        if(fuzzy) {
+            Trade::Implementation::Duration d{worker.conversionTime, worker.profiler, "remove-duplicate-vertices-fuzzy"_s, "mesh"_s, Int(i)};
+            const std::size_t sizeBefore = dataSize(*mesh);
+            mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
+            d.setBytes(sizeBefore, dataSize(*mesh));
+        } else {
+            Trade::Implementation::Duration d{worker.conversionTime, worker.profiler, "remove-duplicate-vertices"_s, "mesh"_s, Int(i)};
+            const std::size_t sizeBefore = dataSize(*mesh);
+            mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
+            d.setBytes(sizeBefore, dataSize(*mesh));
+        }
+
+        if(args.isSet("verbose")) {
+            Debug d;
+            /* Mesh index 0 would be confusing in case of
+                --concatenate-meshes and plain wrong with --mesh, so
+                don't even print it */
+            if(singleMesh)
+                d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
+            else
+                d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
+            d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
+        }
+    }
+
+    /* Arbitrary mesh converters */
+    for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
+        const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+        if(args.isSet("verbose")) {
+            Debug d;
+            d << "Processing mesh" << i;
+            if(meshConverterCount > 1)
+                d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
+            d << "with" << meshConverterName << Debug::nospace << "...";
+        }
+
+        Containers::Pointer<Trade::AbstractSceneConverter>& meshConverter = worker.meshConverters[j];
+        if(!meshConverter) {
+            PluginManager::Manager<Trade::AbstractSceneConverter>& converterManager = worker.managers->converterManager;
+            if(!(meshConverter = converterManager.loadAndInstantiate(meshConverterName))) {
+                Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
+                return 2;
+            }
+
+            /* Set options, if passed. The AnySceneConverter check
+               makes no sense here, is just there because the helper
+               wants it */
+            if(args.isSet("verbose"))
+                meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
+            if(j < args.arrayValueCount("mesh-converter-options"))
+                Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+        }
+
+        if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
+            Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
+            return 1;
+        }
+
+        /** @todo handle mesh levels here, once any plugin is capable
+            of converting them */
+        Containers::Optional<Trade::MeshData> converted;
+        {
+            Trade::Implementation::Duration d{worker.conversionTime, worker.profiler, meshConverterName, "mesh"_s, Int(i)};
+            if((converted = meshConverter->convert(*mesh)))
+                d.setBytes(dataSize(*mesh), dataSize(*converted));
+        }
+        if(converted) {
+            mesh = Utility::move(converted);
+        } else if(passthroughOnConversionFailure) {
+            Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
+        } else {
+            Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+}
+
 int main(int argc, char** argv) {
     Utility::Arguments args;
     args.addArgument("input").setHelp("input", "input file")
@@ -435,11 +925,15 @@ int main(int argc, char** argv) {
         #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
         .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
         #endif
+        .addOption("cache-dir").setHelp("cache-dir", "cache imported and processed data in given directory", "DIR")
+        .addOption("cache-size-limit", "1024").setHelp("cache-size-limit", "size limit of the cache directory", "MB")
+        .addOption('j', "jobs", "1").setHelp("jobs", "import and process images and meshes on given count of threads, 0 for all available", "N")
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
         .addBooleanOption("phong-to-pbr").setHelp("phong-to-pbr", "convert Phong materials to PBR metallic/roughness")
         .addBooleanOption("remove-duplicate-materials").setHelp("remove-duplicate-materials", "remove duplicate materials")
+        .addBooleanOption("group-mesh-instances").setHelp("group-mesh-instances", "group mesh instances sharing the same mesh and material")
         .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
         .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
         .addArrayOption('p', "image-converter-options").setHelp("image-converter-options", "configuration options to pass to the image converter(s)", "key=val,key2=val2,…")
@@ -463,11 +957,15 @@ int main(int argc, char** argv) {
         .addBooleanOption("info-skins").setHelp("info-skins", "print info about skins in the input file and exit")
         .addBooleanOption("info-textures").setHelp("info-textures", "print info about textures in the input file and exit")
         .addBooleanOption("info").setHelp("info", "print info about everything in the input file and exit, same as specifying all other data-related --info-* options together")
+        .addBooleanOption("probe").setHelp("probe", "with --info or any other data-related --info-* option, print just data counts and image properties without importing anything")
         .addOption("color", "auto").setHelp("color", "colored output for --info", "on|4bit|off|auto")
         .addBooleanOption("bounds").setHelp("bounds", "show bounds of known attributes in --info output")
         .addBooleanOption("object-hierarchy").setHelp("object-hierarchy", "visualize object hierarchy in --info output")
         .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
         .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .addOption("profile-format", "text").setHelp("profile-format", "format of the --profile output", "text|json|csv")
+        .addOption("profile-output").setHelp("profile-output", "save the --profile output to a file instead, implies --profile", "FILE")
+        .addOption("trace").setHelp("trace", "save a Chrome trace of all import and conversion steps", "FILE")
         .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
             /* If --info for plugins is passed, we don't need the input */
             if(error == Utility::Arguments::ParseError::MissingArgument &&
@@ -497,6 +995,10 @@ one data references another and both --info-* options are specified, the output
 will also list reference count (for example, --info-scenes together with
 --info-meshes will print how many objects reference given mesh).
 
+If --probe is given together with the data-related --info-* options, only the
+count of each data type is printed, together with image properties if --info
+or --info-images is specified. Nothing else is imported.
+
 The -i, -c and -m arguments accept a comma-separated list of key/value
 pairs to set in the importer / converter plugin configuration. If the =
 character is omitted, it's equivalent to saying key=true; configuration
@@ -522,11 +1024,39 @@ The --remove-duplicate-vertices, --phong-to-pbr and
 --remove-duplicate-materials operations are performed on meshes and materials
 before passing them to any converter.
 
+If --group-mesh-instances is given, mesh assignments in all scenes are
+reordered so all objects sharing the same mesh and material combination form a
+contiguous run. It's done after --remove-duplicate-materials, which can make
+more combinations equivalent.
+
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
 in, and then passed through the remaining operations. Only attributes that are
 present in the first mesh are taken, if --only-mesh-attributes is specified as
-well, the IDs reference attributes of the first mesh.)")
+well, the IDs reference attributes of the first mesh.
+
+If --cache-dir is given, the imported and processed data are stored in given
+directory, keyed by contents of the input file, all options that affect the
+imported and processed data and the resolved plugin directories. If the same
+input file is converted again with the same options, the data are imported
+from the cache instead, skipping the original import and all processing.
+Least recently used entries are removed when the cache size exceeds
+--cache-size-limit. Files the importer reads in addition to the input file are
+hashed as well, and a change in any of them results in a cache miss.
+
+If -j is given, import and processing of images and meshes is done on given
+count of threads, with the results passed to the scene converter in the
+original order.
+
+If --profile is given, the utility prints time spent in import and conversion,
+followed by a breakdown by stage (opening the file, importing, each processing
+operation and each converter plugin) together with the amount of data each
+stage consumed and produced and peak memory usage. With --profile-format json
+or csv, the output contains also a record for every processed item and is
+printed to the standard output or saved to a file given by --profile-output.
+All times in it are in microseconds and sizes in bytes. The --trace option
+saves the same records in the Trace Event Format, viewable in chrome://tracing
+or Perfetto.)")
         .parse(argc, argv);
 
     /* Colored output. Enable only if a TTY. */
@@ -568,6 +1098,10 @@ well, the IDs reference attributes of the first mesh.)")
         if(isPluginInfoRequested(args) || isDataInfoRequested(args))
             Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
     }
+    if(args.isSet("probe") && !isDataInfoRequested(args)) {
+        Error{} << "The --probe option can be only used together with --info or other data-related --info-* options";
+        return 1;
+    }
     if(args.isSet("concatenate-meshes") && args.value<Containers::StringView>("mesh")) {
         Error{} << "The --mesh and --concatenate-meshes options are mutually exclusive";
         return 1;
@@ -582,121 +1116,35 @@ well, the IDs reference attributes of the first mesh.)")
         Error{} << "The --only-mesh-attributes option can only be used with --mesh or --concatenate-meshes";
         return 1;
     }
-
-    /* Importer manager */
-    PluginManager::Manager<Trade::AbstractImporter> importerManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
-        #endif
-    };
-
-    /* Image converter manager for potential dependencies. Needs to be
-       constructed before the scene converter manager for proper destruction
-       order. */
-    PluginManager::Manager<Trade::AbstractImageConverter> imageConverterManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
-        #endif
-    };
-
-    /* Scene converter manager, register the image converter manager with it */
-    PluginManager::Manager<Trade::AbstractSceneConverter> converterManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractSceneConverter::pluginSearchPaths().back()))
-        #endif
-    };
-    converterManager.registerExternalManager(imageConverterManager);
-
-    /* Set preferred plugins */
-    for(std::size_t i = 0, iMax = args.arrayValueCount("prefer"); i != iMax; ++i) {
-        const auto value = args.arrayValue<Containers::StringView>("prefer", i);
-        const Containers::Array3<Containers::StringView> aliasNames = value.partition(':');
-        if(!aliasNames[1]) {
-            Error{} << "Invalid --prefer option" << value;
-            return 1;
-        }
-
-        /* Figure out manager name */
-        PluginManager::AbstractManager* manager;
-        if(aliasNames[0].hasSuffix("Importer"_s))
-            manager = &importerManager;
-        else if(aliasNames[0].hasSuffix("ImageConverter"_s))
-            manager = &imageConverterManager;
-        else if(aliasNames[0].hasSuffix("SceneConverter"_s))
-            manager = &converterManager;
-        else {
-            Error{} << "Alias" << aliasNames[0] << "not recognized for a --prefer option";
-            return 1;
-        }
-
-        /* The alias has to be found, otherwise it'd assert */
-        if(manager->loadState(aliasNames[0]) == PluginManager::LoadState::NotFound) {
-            Error{} << "Alias" << aliasNames[0] << "not found for a --prefer option";
-            return 1;
-        }
-
-        /* Check that the names actually provide given alias, otherwise it'd
-           assert */
-        const Containers::Array<Containers::StringView> names = aliasNames[2].splitWithoutEmptyParts(',');
-        for(const Containers::StringView name: names) {
-            /* Not found plugins are allowed in the list */
-            const PluginManager::PluginMetadata* const metadata = manager->metadata(name);
-            if(!metadata)
-                continue;
-
-            bool found = false;
-            for(const Containers::StringView provides: metadata->provides()) {
-                if(provides == aliasNames[0]) {
-                    found = true;
-                    break;
-                }
-            }
-            if(!found) {
-                Error{} << name << "doesn't provide" << aliasNames[0] << "for a --prefer option";
-                return 1;
-            }
-        }
-
-        manager->setPreferredPlugins(aliasNames[0], names);
+    if(args.isSet("group-mesh-instances") && (args.value<Containers::StringView>("mesh") || args.isSet("concatenate-meshes"))) {
+        Error{} << "The --group-mesh-instances option can't be used with --mesh or --concatenate-meshes";
+        return 1;
+    }
+    /* Utility::Arguments parses the value with strtoul(), which silently
+       wraps negative values around */
+    if(args.value<Containers::StringView>("cache-size-limit").trimmed().hasPrefix('-')) {
+        Error{} << "The --cache-size-limit option expects a non-negative value but got" << args.value<Containers::StringView>("cache-size-limit");
+        return 1;
     }
 
-    /* Set global plugin options */
-    for(std::size_t i = 0, iMax = args.arrayValueCount("set"); i != iMax; ++i) {
-        const auto value = args.arrayValue<Containers::StringView>("set", i);
-        const Containers::Array3<Containers::StringView> nameOptions = value.partition(':');
-        if(!nameOptions[1]) {
-            Error{} << "Invalid --set option" << value;
-            return 1;
-        }
+    if(!Trade::Implementation::checkProfileOptions(args))
+        return 1;
 
-        /* Figure out manager name */
-        PluginManager::AbstractManager* manager;
-        if(nameOptions[0].hasSuffix("Importer"_s))
-            manager = &importerManager;
-        else if(nameOptions[0].hasSuffix("ImageConverter"_s))
-            manager = &imageConverterManager;
-        else if(nameOptions[0].hasSuffix("SceneConverter"_s))
-            manager = &converterManager;
-        else {
-            Error{} << "Plugin" << nameOptions[0] << "not recognized for a --set option";
-            return 1;
-        }
+    /* Collects per-stage and per-item timings, shared with all workers */
+    Containers::Optional<Trade::Implementation::Profiler> profilerStorage;
+    if(Trade::Implementation::isProfileRequested(args))
+        profilerStorage.emplace();
+    Trade::Implementation::Profiler* const profiler = profilerStorage ? &*profilerStorage : nullptr;
 
-        /* Get the metadata to access global configuration */
-        PluginManager::PluginMetadata* const metadata = manager->metadata(nameOptions[0]);
-        if(!metadata) {
-            Error{} << "Plugin" << nameOptions[0] << "not found for a --set option";
-            return 1;
-        }
+    /* Plugin managers */
+    Managers managers{args};
+    PluginManager::Manager<Trade::AbstractImporter>& importerManager = managers.importerManager;
+    PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager = managers.imageConverterManager;
+    PluginManager::Manager<Trade::AbstractSceneConverter>& converterManager = managers.converterManager;
 
-        /* Set options. Doing things like --set AnyImageImporter:foo=bar makes
-           no sense, so this isn't excluding any "Any*" plugins from the
-           unrecognized option warnings */
-        Implementation::setOptions(nameOptions[0], metadata->configuration(), {}, nameOptions[2]);
-    }
+    /* Set preferred plugins and global plugin options */
+    if(!configureManagers(args, managers))
+        return 1;
 
     /* Print plugin info, if requested */
     /** @todo these all duplicate plugin loading & option setting, move to
@@ -746,6 +1194,10 @@ well, the IDs reference attributes of the first mesh.)")
         return 0;
     }
 
+    /* Declared before the importer so it's destroyed after it, as the
+       importer may still call the file callback on close */
+    CacheFiles cacheFiles;
+
     Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
     if(!importer) {
         Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
@@ -765,23 +1217,103 @@ well, the IDs reference attributes of the first mesh.)")
        conversion are measured separately. */
     std::chrono::high_resolution_clock::duration importConversionTime{};
 
-    /* Open the file or map it if requested */
+    /* Look up the input in the cache, if requested. Not done for --info, as
+       that's meant to show the original file contents. The file gets read
+       again by the importer on a cache miss, but that's negligible compared
+       to the actual import and processing.
+
+       The lookup is done in two steps. The key of the input file contents and
+       options gives a list of files the importer read when the entry was
+       stored, and the data key is then calculated from the current contents
+       of all those. */
+    Containers::Optional<Trade::ImportCache> cache;
+    Containers::String cacheKey;
+    Containers::Optional<Containers::Array<char>> cachedData;
+    if(args.value<Containers::StringView>("cache-dir") && !isDataInfoRequested(args)) {
+        if(!(importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded) ||
+           !(converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        {
+            Warning{} << "MagnumImporter and MagnumSceneConverter plugins are needed for --cache-dir, not caching";
+        } else if(!(importer->features() & (Trade::ImporterFeature::FileCallback|Trade::ImporterFeature::OpenData))) {
+            Warning{} << "The importer doesn't support file callbacks, files referenced by" << args.value<Containers::StringView>("input") << "can't be tracked for --cache-dir, not caching";
+        } else {
+            Trade::Implementation::Duration d{importConversionTime, profiler, "cache-lookup"_s, args.value<Containers::StringView>("input")};
+            Containers::Optional<Containers::Array<char>> input = Utility::Path::read(args.value("input"));
+            if(!input) {
+                Error() << "Cannot open file" << args.value("input");
+                return 3;
+            }
+
+            cache.emplace(args.value<Containers::StringView>("cache-dir"), std::size_t{args.value<UnsignedInt>("cache-size-limit")}*1024*1024);
+            cacheKey = Trade::ImportCache::key(*input, cacheOptions(args, managers));
+
+            /* If any of the files is missing now, it's a miss */
+            std::size_t filesSize = 0;
+            if(Containers::Optional<Containers::Array<char>> fileList = cache->find(cacheFilesKey(cacheKey))) {
+                Containers::Array<Containers::Pair<Containers::String, Containers::String>> files;
+                bool filesValid = true;
+                for(const Containers::StringView filename: Containers::StringView{*fileList}.splitWithoutEmptyParts('\n')) {
+                    Containers::Optional<Containers::Array<char>> file;
+                    if(!Utility::Path::exists(filename) || !(file = Utility::Path::read(filename))) {
+                        filesValid = false;
+                        break;
+                    }
+                    filesSize += file->size();
+                    arrayAppend(files, InPlaceInit, Containers::String{filename}, Trade::ImportCache::key(*file, {}));
+                }
+                if(filesValid)
+                    cachedData = cache->find(cacheDataKey(cacheKey, files));
+            }
+
+            d.setBytes(input->size() + filesSize, cachedData ? cachedData->size() : 0);
+            if(args.isSet("verbose"))
+                Debug{} << (cachedData ? "Found" : "Didn't find") << args.value<Containers::StringView>("input") << "in the cache as" << cacheKey;
+
+            /* On a miss, record all files the importer reads */
+            if(!cachedData)
+                importer->setFileCallback(cacheFileCallback, cacheFiles);
+        }
+    }
+
+    /* Kept in scope for the whole lifetime of the importer */
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
+    #endif
+
+    /* On a cache hit, import the cached data instead of the original file.
+       All processing is skipped below as the data are processed already. */
+    if(cachedData) {
+        importer = importerManager.instantiate("MagnumImporter");
+        if(args.isSet("verbose"))
+            importer->addFlags(Trade::ImporterFlag::Verbose);
+
+        Trade::Implementation::Duration d{importConversionTime, profiler, "open"_s, args.value<Containers::StringView>("input")};
+        d.setBytes(cachedData->size(), 0);
+        if(!importer->openMemory(*cachedData)) {
+            Error() << "Cannot open cached data for" << args.value("input");
+            return 3;
+        }
+
+    /* Otherwise open the file or map it if requested */
+    } else
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     if(args.isSet("map")) {
-        Trade::Implementation::Duration d{importConversionTime};
+        Trade::Implementation::Duration d{importConversionTime, profiler, "open"_s, args.value<Containers::StringView>("input")};
         if(!(mapped = Utility::Path::mapRead(args.value("input"))) || !importer->openMemory(*mapped)) {
             Error() << "Cannot memory-map file" << args.value("input");
             return 3;
         }
+        d.setBytes(mapped->size(), 0);
     } else
     #endif
     {
-        Trade::Implementation::Duration d{importConversionTime};
+        Trade::Implementation::Duration d{importConversionTime, profiler, "open"_s, args.value<Containers::StringView>("input")};
         if(!importer->openFile(args.value("input"))) {
             Error() << "Cannot open file" << args.value("input");
             return 3;
         }
+        if(profiler)
+            d.setBytes(Trade::Implementation::fileSize(args.value<Containers::StringView>("input")), 0);
     }
 
     /* Print file info, if requested */
@@ -798,23 +1330,29 @@ well, the IDs reference attributes of the first mesh.)")
     /* Wow, C++, you suck. This implicitly initializes to random shit?! */
     std::chrono::high_resolution_clock::duration conversionTime{};
 
-    /* Import all scenes, in case something later needs to modify them. There's
-       currently no other operations done on those. */
+    /* If the data came from the cache, they're processed already and all
+       operations below are skipped */
+    const bool cacheHit = !!cachedData;
+
+    /* Import all scenes, in case something later needs to modify them */
     Containers::Array<Trade::SceneData> scenes;
-    if(args.isSet("remove-duplicate-materials")) {
+    if(!cacheHit && (args.isSet("remove-duplicate-materials") ||
+                     args.isSet("group-mesh-instances")))
+    {
         arrayReserve(scenes, importer->sceneCount());
 
         for(UnsignedInt i = 0; i != importer->sceneCount(); ++i) {
             Containers::Optional<Trade::SceneData> scene;
             {
-                Trade::Implementation::Duration d{importConversionTime};
+                Trade::Implementation::Duration d{importConversionTime, profiler, "import"_s, "scene"_s, Int(i)};
                 if(!(scene = importer->scene(i))) {
                     Error{} << "Cannot import scene" << i;
                     return 1;
                 }
             }
 
-            /* There's currently no operations done on scenes directly */
+            /* Operations done on scenes directly are performed only after
+               materials are processed below */
 
             arrayAppend(scenes, *Utility::move(scene));
         }
@@ -824,7 +1362,7 @@ well, the IDs reference attributes of the first mesh.)")
        After that, the importer is changed to one that contains just a single
        mesh... */
     bool singleMesh = false;
-    if(args.isSet("concatenate-meshes") || args.value<Containers::StringView>("mesh")) {
+    if(!cacheHit && (args.isSet("concatenate-meshes") || args.value<Containers::StringView>("mesh"))) {
         singleMesh = true;
         /* ... and subsequent conversion deals with just meshes, throwing away
            materials and everything else (if present). */
@@ -843,12 +1381,13 @@ well, the IDs reference attributes of the first mesh.)")
             /** @todo handle mesh levels here, once any plugin is capable of
                 importing them */
             for(std::size_t i = 0, iMax = importer->meshCount(); i != iMax; ++i) {
-                Trade::Implementation::Duration d{importConversionTime};
+                Trade::Implementation::Duration d{importConversionTime, profiler, "import"_s, "mesh"_s, Int(i)};
                 Containers::Optional<Trade::MeshData> meshToConcatenate = importer->mesh(i);
                 if(!meshToConcatenate) {
                     Error{} << "Cannot import mesh" << i;
                     return 1;
                 }
+                d.setBytes(0, dataSize(*meshToConcatenate));
 
                 arrayAppend(meshes, *Utility::move(meshToConcatenate));
             }
@@ -864,7 +1403,7 @@ well, the IDs reference attributes of the first mesh.)")
                         original behavior only being achievable if everything
                         except meshes and scene hierarchy is filtered away */
                     const UnsignedInt defaultScene = importer->defaultScene() == -1 ? 0 : importer->defaultScene();
-                    Trade::Implementation::Duration d{importConversionTime};
+                    Trade::Implementation::Duration d{importConversionTime, profiler, "import"_s, "scene"_s, Int(defaultScene)};
                     if(!(scene = importer->scene(defaultScene))) {
                         Error{} << "Cannot import scene" << defaultScene << "for mesh concatenation";
                         return 1;
@@ -877,7 +1416,7 @@ well, the IDs reference attributes of the first mesh.)")
                     SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
                 Containers::Array<Trade::MeshData> flattenedMeshes;
                 {
-                    Trade::Implementation::Duration d{conversionTime};
+                    Trade::Implementation::Duration d{conversionTime, profiler, "flatten-meshes"_s};
                     /** @todo once there are 2D scenes, check the scene is 3D */
                     for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
                         arrayAppend(flattenedMeshes, MeshTools::transform3D(
@@ -888,20 +1427,22 @@ well, the IDs reference attributes of the first mesh.)")
             }
 
             {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, "concatenate-meshes"_s};
                 /** @todo this will assert if the meshes have incompatible primitives
                     (such as some triangles, some lines), or if they have
                     loops/strips/fans -- handle that explicitly */
                 mesh = MeshTools::concatenate(meshes);
+                d.setBytes(0, dataSize(*mesh));
             }
 
         /* Otherwise import just one */
         } else {
-            Trade::Implementation::Duration d{importConversionTime};
+            Trade::Implementation::Duration d{importConversionTime, profiler, "import"_s, "mesh"_s, args.value<Int>("mesh")};
             if(!(mesh = importer->mesh(args.value<UnsignedInt>("mesh"), args.value<UnsignedInt>("mesh-level")))) {
                 Error{} << "Cannot import the mesh";
                 return 4;
             }
+            d.setBytes(0, dataSize(*mesh));
         }
 
         /* Filter mesh attributes, if requested */
@@ -984,11 +1525,84 @@ well, the IDs reference attributes of the first mesh.)")
             *previousImporter);
     }
 
-    /* Operations to perform on all images in the importer. If there are any,
-       images are supplied manually to the converter from the array below. */
+    /* Operations to perform on all images and meshes in the importer. If
+       there are any, they're supplied manually to the converter from the
+       arrays below. */
+    const bool processImages = !cacheHit && args.arrayValueCount("image-converter");
+    const bool processMeshes = !cacheHit &&
+        (args.isSet("remove-duplicate-vertices") ||
+         args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
+         args.arrayValueCount("mesh-converter"));
+
+    /* The first worker uses the importer and plugin managers from above and
+       is the only one unless -j is specified */
+    Containers::Array<Worker> workers;
+    {
+        Worker& worker = arrayAppend(workers, InPlaceInit, args);
+        worker.managers = &managers;
+        worker.importer = importer.get();
+        worker.profiler = profiler;
+    }
+
+    /* With -j, create additional workers, each with its own plugin managers
+       and an importer opened on the same file. Not done with --mesh or
+       --concatenate-meshes, as then there's just a single mesh and no
+       images. */
+    if(!singleMesh && (processImages || processMeshes)) {
+        UnsignedInt itemCount = 0;
+        if(processImages)
+            itemCount = Math::max(importer->image2DCount(), importer->image3DCount());
+        if(processMeshes)
+            itemCount = Math::max(itemCount, importer->meshCount());
+
+        const UnsignedInt threadCount = Magnum::Implementation::parallelForThreadCount(itemCount, args.value<UnsignedInt>("jobs"), 1);
+        if(threadCount > 1 && args.isSet("verbose"))
+            Debug{} << "Processing" << itemCount << "items on" << threadCount << "threads";
+
+        for(UnsignedInt i = 1; i < threadCount; ++i) {
+            Worker& worker = arrayAppend(workers, InPlaceInit, args);
+            worker.managerStorage.emplace(args);
+            worker.managers = worker.managerStorage.get();
+            worker.profiler = profiler;
+
+            /* Warnings about unrecognized options were printed for the first
+               worker already, don't repeat them. Errors can't happen either
+               as the same was done above already. */
+            Warning redirectWarning{nullptr};
+            configureManagers(args, *worker.managers);
+            if(!(worker.importerStorage = worker.managers->importerManager.loadAndInstantiate(args.value("importer"))))
+                return 1;
+            worker.importer = worker.importerStorage.get();
+
+            if(args.isSet("verbose"))
+                worker.importer->addFlags(Trade::ImporterFlag::Verbose);
+            Implementation::setOptions(*worker.importer, "AnySceneImporter", args.value("importer-options"));
+            /* Images and meshes may reference external files that get
+               loaded only on the worker importers */
+            if(cache)
+                worker.importer->setFileCallback(cacheFileCallback, cacheFiles);
+
+            Trade::Implementation::Duration d{importConversionTime, profiler, "open"_s, args.value<Containers::StringView>("input")};
+            #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+            if(mapped) {
+                if(!worker.importer->openMemory(*mapped)) {
+                    Error() << "Cannot memory-map file" << args.value("input");
+                    return 3;
+                }
+            } else
+            #endif
+            if(!worker.importer->openFile(args.value("input"))) {
+                Error() << "Cannot open file" << args.value("input");
+                return 3;
+            }
+        }
+    }
+
+    /* Images and meshes are imported and processed on all workers, and then
+       put back in the original order so the output is deterministic */
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
-    if(args.arrayValueCount("image-converter")) {
+    if(processImages) {
         /** @todo implement once there's any file format capable of storing
             these */
         if(importer->image1DCount()) {
@@ -996,159 +1610,89 @@ well, the IDs reference attributes of the first mesh.)")
             return 1;
         }
 
-        for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
-            Containers::Optional<Trade::ImageData2D> image;
+        /** @todo handle image levels once GltfSceneConverter can save them
+            (which needs AbstractImageConverter to be reworked around
+            ImageData) -- there could be an image2DOffsets array saying which
+            subrange is levels for which image */
+        Containers::Array<Containers::Optional<Trade::ImageData2D>> processedImages2D{ValueInit, importer->image2DCount()};
+        if(const int exitCode = forEachItem(workers, processedImages2D.size(), [&](Worker& worker, const UnsignedInt i) -> int {
             {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image2D(i))) {
+                Trade::Implementation::Duration d{worker.importTime, worker.profiler, "import"_s, "2D image"_s, Int(i)};
+                if(!(processedImages2D[i] = worker.importer->image2D(i))) {
                     Error{} << "Cannot import 2D image" << i;
                     return 1;
                 }
+                d.setBytes(0, dataSize(*processedImages2D[i]));
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
-
-            arrayAppend(images2D, *Utility::move(image));
-        }
+            return runImageConverters(worker, args, i, processedImages2D[i]) ? 0 : 1;
+        }))
+            return exitCode;
 
-        for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
-            Containers::Optional<Trade::ImageData3D> image;
+        Containers::Array<Containers::Optional<Trade::ImageData3D>> processedImages3D{ValueInit, importer->image3DCount()};
+        if(const int exitCode = forEachItem(workers, processedImages3D.size(), [&](Worker& worker, const UnsignedInt i) -> int {
             {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image3D(i))) {
+                Trade::Implementation::Duration d{worker.importTime, worker.profiler, "import"_s, "3D image"_s, Int(i)};
+                if(!(processedImages3D[i] = worker.importer->image3D(i))) {
                     Error{} << "Cannot import 3D image" << i;
                     return 1;
                 }
+                d.setBytes(0, dataSize(*processedImages3D[i]));
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
+            return runImageConverters(worker, args, i, processedImages3D[i]) ? 0 : 1;
+        }))
+            return exitCode;
+
+        collectDurations(workers, importConversionTime, conversionTime);
 
+        arrayReserve(images2D, processedImages2D.size());
+        for(Containers::Optional<Trade::ImageData2D>& image: processedImages2D)
+            arrayAppend(images2D, *Utility::move(image));
+        arrayReserve(images3D, processedImages3D.size());
+        for(Containers::Optional<Trade::ImageData3D>& image: processedImages3D)
             arrayAppend(images3D, *Utility::move(image));
-        }
     }
 
-    /* Operations to perform on all meshes in the importer. If there are any,
-       meshes are supplied manually to the converter from the array below. */
     Containers::Array<Trade::MeshData> meshes;
-    if(args.isSet("remove-duplicate-vertices") ||
-       args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy") ||
-       args.arrayValueCount("mesh-converter"))
-    {
-        const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
-
-        arrayReserve(meshes, importer->meshCount());
-
-        for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
-            Containers::Optional<Trade::MeshData> mesh;
+    if(processMeshes) {
+        Containers::Array<Containers::Optional<Trade::MeshData>> processedMeshes{ValueInit, importer->meshCount()};
+        if(const int exitCode = forEachItem(workers, processedMeshes.size(), [&](Worker& worker, const UnsignedInt i) -> int {
             {
                 /** @todo handle mesh levels here, once any plugin is capable
                     of importing them */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(mesh = importer->mesh(i))) {
+                Trade::Implementation::Duration d{worker.importTime, worker.profiler, "import"_s, "mesh"_s, Int(i)};
+                if(!(processedMeshes[i] = worker.importer->mesh(i))) {
                     Error{} << "Cannot import mesh" << i;
                     return 1;
                 }
+                d.setBytes(0, dataSize(*processedMeshes[i]));
             }
 
-            /* Duplicate removal */
-            if(args.isSet("remove-duplicate-vertices") ||
-               args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
-            {
-                const UnsignedInt beforeVertexCount = mesh->vertexCount();
-                const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
-
-                /** @todo accept two values for float and double fuzzy
-                    comparison, or maybe also different for positions, normals
-                    and texcoords? ugh... */
-                if(fuzzy) {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
-                } else {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
-                }
-
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    /* Mesh index 0 would be confusing in case of
-                        --concatenate-meshes and plain wrong with --mesh, so
-                        don't even print it */
-                    if(singleMesh)
-                        d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
-                    else
-                        d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
-                    d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
-                }
-            }
-
-            /* Arbitrary mesh converters */
-            for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
-                const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    d << "Processing mesh" << i;
-                    if(meshConverterCount > 1)
-                        d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
-                    d << "with" << meshConverterName << Debug::nospace << "...";
-                }
-
-                Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
-                if(!meshConverter) {
-                    Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
-                    return 2;
-                }
-
-                /* Set options, if passed. The AnySceneConverter check makes no
-                   sense here, is just there because the helper wants it */
-                if(args.isSet("verbose"))
-                    meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
-                if(j < args.arrayValueCount("mesh-converter-options"))
-                    Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
-
-                if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
-                    Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
-                    return 1;
-                }
+            return processMesh(worker, args, i, singleMesh, processedMeshes[i]);
+        }))
+            return exitCode;
 
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of converting them */
-                if(Containers::Optional<Trade::MeshData> converted = meshConverter->convert(*mesh)) {
-                    mesh = Utility::move(converted);
-                } else if(passthroughOnConversionFailure) {
-                    Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
-                } else {
-                    Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
-                    return 1;
-                }
-            }
+        collectDurations(workers, importConversionTime, conversionTime);
 
+        arrayReserve(meshes, processedMeshes.size());
+        for(Containers::Optional<Trade::MeshData>& mesh: processedMeshes)
             arrayAppend(meshes, *Utility::move(mesh));
-        }
     }
 
     /* Operations to perform on all materials in the importer. If there are
        any, materials are supplied manually to the converter from the array
        below. */
     Containers::Array<Trade::MaterialData> materials;
-    if(args.isSet("phong-to-pbr") ||
-       args.isSet("remove-duplicate-materials"))
+    if(!cacheHit && (args.isSet("phong-to-pbr") ||
+                     args.isSet("remove-duplicate-materials")))
     {
         arrayReserve(materials, importer->materialCount());
 
         for(UnsignedInt i = 0; i != importer->materialCount(); ++i) {
             Containers::Optional<Trade::MaterialData> material;
             {
-                Trade::Implementation::Duration d{importConversionTime};
+                Trade::Implementation::Duration d{importConversionTime, profiler, "import"_s, "material"_s, Int(i)};
                 if(!(material = importer->material(i))) {
                     Error{} << "Cannot import material" << i;
                     return 1;
@@ -1160,7 +1704,7 @@ well, the IDs reference attributes of the first mesh.)")
                 if(args.isSet("verbose"))
                     Debug{} << "Converting material" << i << "to PBR";
 
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, "phong-to-pbr"_s, "material"_s, Int(i)};
                 /** @todo make the flags configurable as well? then the below
                     assert can actually fire, convert to a runtime error */
                 material = MaterialTools::phongToPbrMetallicRoughness(*material, MaterialTools::PhongToPbrMetallicRoughnessFlag::DropUnconvertibleAttributes);
@@ -1172,7 +1716,7 @@ well, the IDs reference attributes of the first mesh.)")
 
         /* Duplicate removal */
         if(args.isSet("remove-duplicate-materials")) {
-            Trade::Implementation::Duration d{conversionTime};
+            Trade::Implementation::Duration d{conversionTime, profiler, "remove-duplicate-materials"_s};
 
             Containers::Pair<Containers::Array<UnsignedInt>, std::size_t> mapping = MaterialTools::removeDuplicatesInPlace(materials);
             if(args.isSet("verbose"))
@@ -1198,15 +1742,52 @@ well, the IDs reference attributes of the first mesh.)")
         }
     }
 
+    /* Mesh instance grouping. Done only after material deduplication, as that
+       may make more mesh and material combinations the same. */
+    if(!cacheHit && args.isSet("group-mesh-instances")) {
+        CORRADE_INTERNAL_ASSERT(scenes.size() == importer->sceneCount());
+        for(UnsignedInt i = 0; i != scenes.size(); ++i) {
+            if(!scenes[i].hasField(Trade::SceneField::Mesh))
+                continue;
+
+            Trade::Implementation::Duration d{conversionTime, profiler, "group-mesh-instances"_s, "scene"_s, Int(i)};
+            const std::size_t runCountBefore = args.isSet("verbose") ? SceneTools::meshInstanceRuns(scenes[i]).size() : 0;
+            scenes[i] = SceneTools::groupMeshInstances(scenes[i]);
+            if(args.isSet("verbose"))
+                Debug{} << "Mesh instance grouping in scene" << i << Debug::nospace << ":" << runCountBefore << "->" << SceneTools::meshInstanceRuns(scenes[i]).size() << "runs of" << scenes[i].fieldSize(Trade::SceneField::Mesh) << "instances";
+        }
+    }
+
+    /* On a cache miss, the processed data are first serialized with
+       MagnumSceneConverter in an extra conversion step, stored in the cache
+       and then imported back with MagnumImporter for the actual conversion.
+       That way the output is the same for both a cache hit and a miss. If the
+       serialized format can't represent everything the importer has, the
+       result isn't cached at all as a subsequent cache hit would lose
+       data. */
+    bool storeToCache = false;
+    if(cache && !cacheHit) {
+        Containers::Pointer<Trade::AbstractSceneConverter> cacheConverter = converterManager.instantiate("MagnumSceneConverter");
+        if(const Trade::SceneContents unsupported = Trade::sceneContentsFor(*importer) & ~Trade::sceneContentsFor(*cacheConverter))
+            Warning{} << "Not caching" << args.value<Containers::StringView>("input") << "as" << unsupported << "can't be cached";
+        else storeToCache = true;
+    }
+
     /* Assume there's always one passed --converter option less, and the last
        is implicitly AnySceneConverter. All converters except the last one are
        expected to support Convert{Mesh,Multiple} and the mesh/scene is "piped"
        from one to the other. If the last converter supports
        Convert{Mesh,Multiple}ToFile instead of Convert{Mesh,Multiple}, it's
        used instead of the last implicit AnySceneConverter. */
-    for(std::size_t i = 0, converterCount = args.arrayValueCount("converter"); i <= converterCount; ++i) {
+    for(std::size_t step = 0, cacheStepCount = storeToCache ? 1 : 0, converterCount = args.arrayValueCount("converter"); step <= converterCount + cacheStepCount; ++step) {
+        /* The cache step, if any, is before all others */
+        const bool isCacheStep = step < cacheStepCount;
+        const std::size_t i = step - cacheStepCount;
+
         /* Load converter plugin */
-        const Containers::StringView converterName = i == converterCount ?
+        const Containers::StringView converterName =
+            isCacheStep ? "MagnumSceneConverter"_s :
+            i == converterCount ?
             "AnySceneConverter"_s : args.arrayValue<Containers::StringView>("converter", i);
         Containers::Pointer<Trade::AbstractSceneConverter> converter = converterManager.loadAndInstantiate(converterName);
         if(!converter) {
@@ -1217,14 +1798,16 @@ well, the IDs reference attributes of the first mesh.)")
         /* Set options, if passed */
         if(args.isSet("verbose"))
             converter->addFlags(Trade::SceneConverterFlag::Verbose);
-        if(i < args.arrayValueCount("converter-options"))
+        if(!isCacheStep && i < args.arrayValueCount("converter-options"))
             Implementation::setOptions(*converter, "AnySceneConverter", args.arrayValue("converter-options", i));
 
         /* Decide if this is the last converter, capable of saving to a file */
-        const bool isLastConverter = i + 1 >= converterCount && (converter->features() & (Trade::SceneConverterFeature::ConvertMeshToFile|Trade::SceneConverterFeature::ConvertMultipleToFile));
+        const bool isLastConverter = !isCacheStep && i + 1 >= converterCount && (converter->features() & (Trade::SceneConverterFeature::ConvertMeshToFile|Trade::SceneConverterFeature::ConvertMultipleToFile));
 
         /* No verbose output for just one converter */
-        if(converterCount > 1 && args.isSet("verbose")) {
+        if(isCacheStep && args.isSet("verbose")) {
+            Debug{} << "Storing to the cache with" << converterName << Debug::nospace << "...";
+        } else if(converterCount > 1 && args.isSet("verbose")) {
             if(isLastConverter) {
                 Debug{} << "Saving output (" << Debug::nospace << (i+1) << Debug::nospace << "/" << Debug::nospace << converterCount << Debug::nospace << ") with" << converterName << Debug::nospace << "...";
             } else {
@@ -1237,13 +1820,21 @@ well, the IDs reference attributes of the first mesh.)")
            the end), output to a file */
         if(isLastConverter) {
             {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "begin"_s};
                 if(!converter->beginFile(args.value("output"))) {
                     Error{} << "Cannot begin conversion of file" << args.value("output");
                     return 1;
                 }
             }
 
+        /* This is the cache step, convert to data */
+        } else if(isCacheStep) {
+            Trade::Implementation::Duration d{conversionTime, profiler, converterName, "begin"_s};
+            if(!converter->beginData()) {
+                Error{} << "Cannot begin conversion for the cache";
+                return 1;
+            }
+
         /* This is not the last converter, expect that it's capable of
            converting to an importer instance (or a MeshData wrapped in an
            importer instance) */
@@ -1254,7 +1845,7 @@ well, the IDs reference attributes of the first mesh.)")
             }
 
             {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "begin"_s};
                 if(!converter->begin()) {
                     Error{} << "Cannot begin importer conversion";
                     return 1;
@@ -1278,7 +1869,8 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Images2D)) {
                 Warning{} << "Ignoring" << images2D.size() << "2D images not supported by the converter";
             } else for(UnsignedInt j = 0; j != images2D.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "2D image"_s, Int(j)};
+                d.setBytes(dataSize(images2D[j]), 0);
                 if(!converter->add(images2D[j], contents & Trade::SceneContent::Names ? importer->image2DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 2D image" << j;
                     return 1;
@@ -1301,7 +1893,8 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Images3D)) {
                 Warning{} << "Ignoring" << images3D.size() << "3D images not supported by the converter";
             } else for(UnsignedInt j = 0; j != images3D.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "3D image"_s, Int(j)};
+                d.setBytes(dataSize(images3D[j]), 0);
                 if(!converter->add(images3D[j], contents & Trade::SceneContent::Names ? importer->image3DName(j) : Containers::String{})) {
                     Error{} << "Cannot add 3D image" << j;
                     return 1;
@@ -1330,9 +1923,10 @@ well, the IDs reference attributes of the first mesh.)")
                     support meshes (URDF exporter, for example? glXF?) */
                 Warning{} << "Ignoring" << meshes.size() << "meshes not supported by the converter";
             } else for(UnsignedInt j = 0; j != meshes.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "mesh"_s, Int(j)};
 
                 const Trade::MeshData& mesh = meshes[j];
+                d.setBytes(dataSize(mesh), 0);
 
                 /* Propagate custom attribute names, skip ones that are empty.
                    Compared to data names this is done always to avoid
@@ -1388,7 +1982,7 @@ well, the IDs reference attributes of the first mesh.)")
                      Trade::SceneContent::Textures|
                      Trade::SceneContent::Names);
 
-                Trade::Implementation::Duration d{importConversionTime};
+                Trade::Implementation::Duration d{importConversionTime, profiler, converterName, "material dependencies"_s};
                 if(!converter->addSupportedImporterContents(*importer, materialDependencies)) {
                     Error{} << "Cannot add material dependencies";
                     return 5;
@@ -1403,7 +1997,7 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Materials)) {
                 Warning{} << "Ignoring" << materials.size() << "materials not supported by the converter";
             } else for(UnsignedInt j = 0; j != materials.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "material"_s, Int(j)};
 
                 if(!converter->add(materials[j], contents & Trade::SceneContent::Names ? importer->materialName(j) : Containers::String{})) {
                     Error{} << "Cannot add material" << j;
@@ -1440,7 +2034,7 @@ well, the IDs reference attributes of the first mesh.)")
                       Trade::SceneContent::Scenes|
                       Trade::SceneContent::Animations);
 
-                Trade::Implementation::Duration d{importConversionTime};
+                Trade::Implementation::Duration d{importConversionTime, profiler, converterName, "scene dependencies"_s};
                 if(!converter->addSupportedImporterContents(*importer, sceneDependencies)) {
                     Error{} << "Cannot add scene dependencies";
                     return 5;
@@ -1455,7 +2049,7 @@ well, the IDs reference attributes of the first mesh.)")
             if(!(Trade::sceneContentsFor(*converter) & Trade::SceneContent::Scenes)) {
                 Warning{} << "Ignoring" << scenes.size() << "scenes not supported by the converter";
             } else for(UnsignedInt j = 0; j != scenes.size(); ++j) {
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "scene"_s, Int(j)};
 
                 if(!converter->add(scenes[j], contents & Trade::SceneContent::Names ? importer->sceneName(j) : Containers::String{})) {
                     Error{} << "Cannot add scene" << j;
@@ -1479,7 +2073,7 @@ well, the IDs reference attributes of the first mesh.)")
         }
 
         {
-            Trade::Implementation::Duration d{importConversionTime};
+            Trade::Implementation::Duration d{importConversionTime, profiler, converterName, "importer contents"_s};
             if(!converter->addSupportedImporterContents(*importer, contents)) {
                 Error{} << "Cannot add importer contents";
                 return 5;
@@ -1489,14 +2083,61 @@ well, the IDs reference attributes of the first mesh.)")
         /* This is the last --converter (or the implicit AnySceneConverter at
            the end), end the file and exit the loop */
         if(isLastConverter) {
-            Trade::Implementation::Duration d{conversionTime};
+            Trade::Implementation::Duration d{conversionTime, profiler, converterName, "end"_s};
             if(!converter->endFile()) {
                 Error{} << "Cannot end conversion of file" << args.value("output");
                 return 5;
             }
+            if(profiler)
+                d.setBytes(0, Trade::Implementation::fileSize(args.value<Containers::StringView>("output")));
 
             break;
 
+        /* This is the cache step, store the data and import them back for
+           the next loop iteration. Failure to store isn't fatal, the data
+           are still used for the rest of the conversion. */
+        } else if(isCacheStep) {
+            {
+                Trade::Implementation::Duration d{conversionTime, profiler, converterName, "end"_s};
+                if(!(cachedData = converter->endData())) {
+                    Error{} << "Cannot end conversion for the cache";
+                    return 1;
+                }
+                d.setBytes(0, cachedData->size());
+            }
+
+            {
+                Trade::Implementation::Duration d{conversionTime, profiler, "cache-store"_s, args.value<Containers::StringView>("input")};
+                d.setBytes(cachedData->size(), cachedData->size());
+
+                /* The workers are done at this point, so no locking needed.
+                   Filenames containing a newline can't be put into the list,
+                   don't cache in that case as a change in them wouldn't be
+                   detected. */
+                Containers::Array<Containers::StringView> filenames;
+                bool filenamesValid = true;
+                for(const Containers::Pair<Containers::String, Containers::String>& file: cacheFiles.keys) {
+                    if(file.first().contains('\n'))
+                        filenamesValid = false;
+                    arrayAppend(filenames, file.first());
+                }
+                const Containers::String fileList = "\n"_s.join(filenames);
+                if(!filenamesValid)
+                    Warning{} << "Not caching" << args.value<Containers::StringView>("input") << "as it references a file with a newline in its name";
+                else if(cache->store(cacheDataKey(cacheKey, cacheFiles.keys), *cachedData))
+                    cache->store(cacheFilesKey(cacheKey), Containers::StringView{fileList});
+            }
+
+            Trade::Implementation::Duration d{importConversionTime, profiler, "open"_s, "cached data"_s};
+            d.setBytes(cachedData->size(), 0);
+            importer = importerManager.instantiate("MagnumImporter");
+            if(args.isSet("verbose"))
+                importer->addFlags(Trade::ImporterFlag::Verbose);
+            if(!importer->openMemory(*cachedData)) {
+                Error{} << "Cannot import data stored to the cache";
+                return 1;
+            }
+
         /* This is not the last converter, save the resulting importer instance
            for the next loop iteration. By design, the importer should not
            depend on any data from the converter instance, only on the
@@ -1504,7 +2145,7 @@ well, the IDs reference attributes of the first mesh.)")
            a different one in the next iteration and keeping just the importer
            returned from it. */
         } else {
-            Trade::Implementation::Duration d{conversionTime};
+            Trade::Implementation::Duration d{conversionTime, profiler, converterName, "end"_s};
             if(!(importer = converter->end())) {
                 Error{} << "Cannot end importer conversion";
                 return 1;
@@ -1512,8 +2153,10 @@ well, the IDs reference attributes of the first mesh.)")
         }
     }
 
-    if(args.isSet("profile")) {
+    if(args.isSet("profile") && args.value<Containers::StringView>("profile-format") == "text"_s) {
         Debug{} << "Import and conversion took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importConversionTime).count())/1.0e3f << "seconds, conversion"
             << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
     }
+    if(profiler && !Trade::Implementation::outputProfile(args, *profiler))
+        return 1;
 }
@@ -0,0 +1,620 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compress.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const CompressionQuality value) {
+    debug << "TextureTools::CompressionQuality" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case CompressionQuality::v: return debug << "::" #v;
+        _c(Fast)
+        _c(Normal)
+        _c(High)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedInt(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+/* All block encoders below operate on floating-point values in the [0, 255]
+   range. The per-pixel loops are written over fixed-size arrays with no
+   data-dependent control flow so the compiler can vectorize them. Using the
+   generic Math::Vector instead of Vector3 / Vector4 so the helpers below can
+   deduce the array size. */
+typedef Math::Vector<1, Float> Value;
+typedef Math::Vector<3, Float> Rgb;
+typedef Math::Vector<4, Float> Rgba;
+
+/* Fetches a 4x4 block of pixels, replicating edge pixels for images with size
+   not divisible by four */
+template<class T> void fetchBlock(const Containers::StridedArrayView2D<const T>& pixels, const std::size_t blockY, const std::size_t blockX, T(&out)[16]) {
+    const std::size_t maxY = pixels.size()[0] - 1;
+    const std::size_t maxX = pixels.size()[1] - 1;
+    for(std::size_t y = 0; y != 4; ++y) {
+        const Containers::StridedArrayView1D<const T> row = pixels[Math::min(blockY*4 + y, maxY)];
+        for(std::size_t x = 0; x != 4; ++x)
+            out[y*4 + x] = row[Math::min(blockX*4 + x, maxX)];
+    }
+}
+
+template<std::size_t size> void writeLittleEndian(char* const out, const UnsignedLong value) {
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = char((value >> (i*8)) & 0xff);
+}
+
+/* Mean and a principal axis of given values, calculated using a power
+   iteration on the covariance matrix. If the values are all the same, the
+   returned axis is zero. */
+template<std::size_t size> Math::Vector<size, Float> principalAxis(const Math::Vector<size, Float>(&values)[16], const Math::Vector<size, Float>& mean) {
+    Math::Matrix<size, Float> covariance{Math::ZeroInit};
+    for(const Math::Vector<size, Float>& value: values) {
+        const Math::Vector<size, Float> d = value - mean;
+        for(std::size_t col = 0; col != size; ++col)
+            covariance[col] += d*d[col];
+    }
+
+    /* Start with the largest-variance channel and not e.g. a vector of ones,
+       as that could be orthogonal to the actual principal axis */
+    Math::Vector<size, Float> axis;
+    std::size_t largest = 0;
+    for(std::size_t i = 1; i != size; ++i)
+        if(covariance[i][i] > covariance[largest][largest]) largest = i;
+    axis[largest] = 1.0f;
+
+    for(std::size_t i = 0; i != 8; ++i) {
+        const Math::Vector<size, Float> next = covariance*axis;
+        const Float length = next.length();
+        if(length < 1.0e-6f) return {};
+        axis = next/length;
+    }
+
+    return axis;
+}
+
+/* Endpoints along an axis passing through the mean, clamped to the value
+   range */
+template<std::size_t size> void endpointsAlongAxis(const Math::Vector<size, Float>(&values)[16], const Math::Vector<size, Float>& mean, const Math::Vector<size, Float>& axis, Math::Vector<size, Float>& first, Math::Vector<size, Float>& second) {
+    Float min = 0.0f, max = 0.0f;
+    for(const Math::Vector<size, Float>& value: values) {
+        const Float t = Math::dot(value - mean, axis);
+        min = Math::min(min, t);
+        max = Math::max(max, t);
+    }
+    first = Math::clamp(mean + axis*max, 0.0f, 255.0f);
+    second = Math::clamp(mean + axis*min, 0.0f, 255.0f);
+}
+
+/* Endpoints from a bounding box, with the diagonal picked according to the
+   sign of a covariance of each channel with the first one */
+template<std::size_t size> void endpointsFromBoundingBox(const Math::Vector<size, Float>(&values)[16], const Math::Vector<size, Float>& mean, Math::Vector<size, Float>& first, Math::Vector<size, Float>& second) {
+    Math::Vector<size, Float> min{255.0f}, max{0.0f};
+    Math::Vector<size, Float> covariance;
+    for(const Math::Vector<size, Float>& value: values) {
+        min = Math::min(min, value);
+        max = Math::max(max, value);
+        covariance += (value - mean)*(value[0] - mean[0]);
+    }
+
+    /* Inset the box slightly, which on average reduces the error as the
+       extremes are rarely hit exactly */
+    const Math::Vector<size, Float> inset = (max - min)/16.0f;
+    min += inset;
+    max -= inset;
+
+    first = max;
+    second = min;
+    for(std::size_t i = 1; i != size; ++i) if(covariance[i] < 0.0f) {
+        first[i] = min[i];
+        second[i] = max[i];
+    }
+}
+
+/* Least-squares fit of two endpoints to values, given interpolation weights
+   of each value. Returns false if the system is degenerate, i.e. all values
+   using the same weight. */
+template<std::size_t size> bool leastSquaresEndpoints(const Math::Vector<size, Float>(&values)[16], const Float(&weights)[16], Math::Vector<size, Float>& first, Math::Vector<size, Float>& second) {
+    Float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f;
+    Math::Vector<size, Float> alphaX, betaX;
+    for(std::size_t i = 0; i != 16; ++i) {
+        const Float beta = weights[i];
+        const Float alpha = 1.0f - beta;
+        alpha2 += alpha*alpha;
+        beta2 += beta*beta;
+        alphaBeta += alpha*beta;
+        alphaX += values[i]*alpha;
+        betaX += values[i]*beta;
+    }
+
+    const Float determinant = alpha2*beta2 - alphaBeta*alphaBeta;
+    if(Math::abs(determinant) < 1.0e-6f) return false;
+
+    first = Math::clamp((alphaX*beta2 - betaX*alphaBeta)/determinant, 0.0f, 255.0f);
+    second = Math::clamp((betaX*alpha2 - alphaX*alphaBeta)/determinant, 0.0f, 255.0f);
+    return true;
+}
+
+/* Picks the nearest palette entry for each value, returns the total squared
+   error */
+template<std::size_t size, std::size_t paletteSize> Float pickIndices(const Math::Vector<size, Float>(&values)[16], const Math::Vector<size, Float>(&palette)[paletteSize], UnsignedByte(&indices)[16]) {
+    Float error = 0.0f;
+    for(std::size_t i = 0; i != 16; ++i) {
+        Float best = (values[i] - palette[0]).dot();
+        UnsignedByte bestIndex = 0;
+        for(std::size_t j = 1; j != paletteSize; ++j) {
+            const Float distance = (values[i] - palette[j]).dot();
+            if(distance < best) {
+                best = distance;
+                bestIndex = UnsignedByte(j);
+            }
+        }
+        indices[i] = bestIndex;
+        error += best;
+    }
+    return error;
+}
+
+/* BC1 color block, shared by BC1, BC2 and BC3 */
+
+UnsignedShort packRgb565(const Rgb& color) {
+    return (UnsignedShort(Math::round(color[0]*(31.0f/255.0f))) << 11)|
+           (UnsignedShort(Math::round(color[1]*(63.0f/255.0f))) << 5)|
+            UnsignedShort(Math::round(color[2]*(31.0f/255.0f)));
+}
+
+Rgb unpackRgb565(const UnsignedShort color) {
+    const UnsignedInt r = (color >> 11) & 0x1f;
+    const UnsignedInt g = (color >> 5) & 0x3f;
+    const UnsignedInt b = color & 0x1f;
+    return {Float((r << 3)|(r >> 2)),
+            Float((g << 2)|(g >> 4)),
+            Float((b << 3)|(b >> 2))};
+}
+
+/* Quantizes the endpoints, picks indices and returns the error. The first
+   endpoint is always larger than the second, unless they're equal. */
+Float quantizeColorBlock(const Rgb(&colors)[16], const Rgb& first, const Rgb& second, UnsignedShort& first565, UnsignedShort& second565, UnsignedByte(&indices)[16]) {
+    first565 = packRgb565(first);
+    second565 = packRgb565(second);
+    if(first565 < second565) {
+        const UnsignedShort tmp = first565;
+        first565 = second565;
+        second565 = tmp;
+    }
+
+    const Rgb a = unpackRgb565(first565);
+    const Rgb b = unpackRgb565(second565);
+    const Rgb palette[]{
+        a,
+        b,
+        (a*2.0f + b)/3.0f,
+        (a + b*2.0f)/3.0f
+    };
+    return pickIndices(colors, palette, indices);
+}
+
+void encodeColorBlock(const Rgb(&colors)[16], const CompressionQuality quality, char* const out) {
+    Rgb mean;
+    for(const Rgb& color: colors) mean += color;
+    mean /= 16.0f;
+
+    Rgb first, second;
+    if(quality == CompressionQuality::Fast)
+        endpointsFromBoundingBox(colors, mean, first, second);
+    else
+        endpointsAlongAxis(colors, mean, principalAxis(colors, mean), first, second);
+
+    UnsignedShort first565, second565;
+    UnsignedByte indices[16];
+    Float error = quantizeColorBlock(colors, first, second, first565, second565, indices);
+
+    /* Refine the endpoints with a least-squares fit to the picked indices,
+       keep the result only if it's actually better */
+    if(quality == CompressionQuality::High) for(std::size_t iteration = 0; iteration != 2 && error > 0.0f; ++iteration) {
+        constexpr Float IndexWeights[]{0.0f, 1.0f, 1.0f/3.0f, 2.0f/3.0f};
+        Float weights[16];
+        for(std::size_t i = 0; i != 16; ++i)
+            weights[i] = IndexWeights[indices[i]];
+        if(!leastSquaresEndpoints(colors, weights, first, second)) break;
+
+        UnsignedShort refinedFirst565, refinedSecond565;
+        UnsignedByte refinedIndices[16];
+        const Float refinedError = quantizeColorBlock(colors, first, second, refinedFirst565, refinedSecond565, refinedIndices);
+        if(refinedError >= error) break;
+
+        error = refinedError;
+        first565 = refinedFirst565;
+        second565 = refinedSecond565;
+        for(std::size_t i = 0; i != 16; ++i) indices[i] = refinedIndices[i];
+    }
+
+    /* If both endpoints are the same, the block would be interpreted in the
+       three-color mode in BC1. Index 0 is the same in both, use just that. */
+    UnsignedInt packedIndices = 0;
+    if(first565 != second565) for(std::size_t i = 0; i != 16; ++i)
+        packedIndices |= UnsignedInt(indices[i]) << (i*2);
+
+    writeLittleEndian<2>(out + 0, first565);
+    writeLittleEndian<2>(out + 2, second565);
+    writeLittleEndian<4>(out + 4, packedIndices);
+}
+
+/* BC4 block, shared by BC3, BC4 and BC5 */
+
+Float quantizeValueBlock(const Value(&values)[16], const UnsignedByte first, const UnsignedByte second, UnsignedByte(&indices)[16]) {
+    const Float a = first;
+    const Float b = second;
+    Value palette[8]{
+        Value{a},
+        Value{b}
+    };
+    /* Eight-value mode if first > second, six-value with 0 and 255
+       otherwise */
+    if(first > second) {
+        for(std::size_t i = 2; i != 8; ++i)
+            palette[i][0] = Math::round(((8 - i)*a + (i - 1)*b)/7.0f);
+    } else {
+        for(std::size_t i = 2; i != 6; ++i)
+            palette[i][0] = Math::round(((6 - i)*a + (i - 1)*b)/5.0f);
+        palette[6][0] = 0.0f;
+        palette[7][0] = 255.0f;
+    }
+    return pickIndices(values, palette, indices);
+}
+
+void encodeValueBlock(const Value(&values)[16], const CompressionQuality quality, char* const out) {
+    Float min = 255.0f, max = 0.0f;
+    for(const Value& value: values) {
+        min = Math::min(min, value[0]);
+        max = Math::max(max, value[0]);
+    }
+
+    /* The eight-value mode with max and min as endpoints. If they're equal,
+       the block is implicitly in the six-value mode, but index 0 is the same
+       in both. */
+    UnsignedByte first = UnsignedByte(max);
+    UnsignedByte second = UnsignedByte(min);
+    UnsignedByte indices[16];
+    Float error = quantizeValueBlock(values, first, second, indices);
+
+    /* For high quality try also the six-value mode, with the extremes
+       excluded from the range as those can be represented exactly */
+    if(quality == CompressionQuality::High && error > 0.0f) {
+        Float innerMin = 255.0f, innerMax = 0.0f;
+        for(const Value& value: values) {
+            if(value[0] == 0.0f || value[0] == 255.0f) continue;
+            innerMin = Math::min(innerMin, value[0]);
+            innerMax = Math::max(innerMax, value[0]);
+        }
+        if(innerMin <= innerMax) {
+            UnsignedByte sixValueIndices[16];
+            const Float sixValueError = quantizeValueBlock(values, UnsignedByte(innerMin), UnsignedByte(innerMax), sixValueIndices);
+            if(sixValueError < error) {
+                error = sixValueError;
+                first = UnsignedByte(innerMin);
+                second = UnsignedByte(innerMax);
+                for(std::size_t i = 0; i != 16; ++i) indices[i] = sixValueIndices[i];
+            }
+        }
+    }
+
+    UnsignedLong packedIndices = 0;
+    for(std::size_t i = 0; i != 16; ++i)
+        packedIndices |= UnsignedLong(indices[i]) << (i*3);
+
+    out[0] = char(first);
+    out[1] = char(second);
+    writeLittleEndian<6>(out + 2, packedIndices);
+}
+
+/* BC7 mode 6 block */
+
+constexpr Float Bc7Weights[]{
+    0.0f/64.0f, 4.0f/64.0f, 9.0f/64.0f, 13.0f/64.0f,
+    17.0f/64.0f, 21.0f/64.0f, 26.0f/64.0f, 30.0f/64.0f,
+    34.0f/64.0f, 38.0f/64.0f, 43.0f/64.0f, 47.0f/64.0f,
+    51.0f/64.0f, 55.0f/64.0f, 60.0f/64.0f, 64.0f/64.0f
+};
+constexpr UnsignedInt Bc7IntegerWeights[]{
+    0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+};
+
+/* Quantizes an endpoint to 7 bits per channel and a shared P-bit, picking the
+   P-bit that results in a lower error */
+void quantizeBc7Endpoint(const Rgba& endpoint, Vector4ub& quantized, UnsignedByte& pBit) {
+    Float bestError{};
+    for(UnsignedByte p = 0; p != 2; ++p) {
+        Vector4ub candidate;
+        Float error = 0.0f;
+        for(std::size_t i = 0; i != 4; ++i) {
+            candidate[i] = UnsignedByte(Math::clamp(Math::round((endpoint[i] - p)*0.5f), 0.0f, 127.0f));
+            error += Math::pow<2>(endpoint[i] - (candidate[i]*2 + p));
+        }
+        if(p == 0 || error < bestError) {
+            bestError = error;
+            quantized = candidate;
+            pBit = p;
+        }
+    }
+}
+
+Float quantizeBc7Block(const Rgba(&pixels)[16], const Rgba& first, const Rgba& second, Vector4ub(&endpoints)[2], UnsignedByte(&pBits)[2], UnsignedByte(&indices)[16]) {
+    quantizeBc7Endpoint(first, endpoints[0], pBits[0]);
+    quantizeBc7Endpoint(second, endpoints[1], pBits[1]);
+
+    /* Interpolate exactly the same way as the decoder does */
+    const Math::Vector4<UnsignedInt> a = Math::Vector4<UnsignedInt>{endpoints[0]}*2 + Math::Vector4<UnsignedInt>{pBits[0]};
+    const Math::Vector4<UnsignedInt> b = Math::Vector4<UnsignedInt>{endpoints[1]}*2 + Math::Vector4<UnsignedInt>{pBits[1]};
+    Rgba palette[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        palette[i] = Rgba{(a*(64 - Bc7IntegerWeights[i]) + b*Bc7IntegerWeights[i] + Math::Vector4<UnsignedInt>{32})/64};
+
+    return pickIndices(pixels, palette, indices);
+}
+
+/* Writes bits LSB-first into a 128-bit block */
+struct BitWriter {
+    explicit BitWriter(char* const out): data{out}, offset{} {
+        for(std::size_t i = 0; i != 16; ++i) data[i] = 0;
+    }
+
+    void write(const UnsignedInt value, const UnsignedInt bits) {
+        for(UnsignedInt i = 0; i != bits; ++i, ++offset)
+            if(value & (1u << i))
+                data[offset/8] = char(data[offset/8]|(1 << (offset%8)));
+    }
+
+    char* data;
+    UnsignedInt offset;
+};
+
+void encodeBc7Block(const Rgba(&pixels)[16], const CompressionQuality quality, char* const out) {
+    Rgba mean;
+    for(const Rgba& pixel: pixels) mean += pixel;
+    mean /= 16.0f;
+
+    Rgba first, second;
+    if(quality == CompressionQuality::Fast)
+        endpointsFromBoundingBox(pixels, mean, first, second);
+    else
+        endpointsAlongAxis(pixels, mean, principalAxis(pixels, mean), first, second);
+
+    Vector4ub endpoints[2];
+    UnsignedByte pBits[2];
+    UnsignedByte indices[16];
+    Float error = quantizeBc7Block(pixels, first, second, endpoints, pBits, indices);
+
+    if(quality == CompressionQuality::High) for(std::size_t iteration = 0; iteration != 2 && error > 0.0f; ++iteration) {
+        Float weights[16];
+        for(std::size_t i = 0; i != 16; ++i)
+            weights[i] = Bc7Weights[indices[i]];
+        if(!leastSquaresEndpoints(pixels, weights, first, second)) break;
+
+        Vector4ub refinedEndpoints[2];
+        UnsignedByte refinedPBits[2];
+        UnsignedByte refinedIndices[16];
+        const Float refinedError = quantizeBc7Block(pixels, first, second, refinedEndpoints, refinedPBits, refinedIndices);
+        if(refinedError >= error) break;
+
+        error = refinedError;
+        for(std::size_t i = 0; i != 2; ++i) {
+            endpoints[i] = refinedEndpoints[i];
+            pBits[i] = refinedPBits[i];
+        }
+        for(std::size_t i = 0; i != 16; ++i) indices[i] = refinedIndices[i];
+    }
+
+    /* The highest bit of the first index is implicitly zero, if it isn't,
+       swap the endpoints and invert the indices */
+    if(indices[0] & 0x8) {
+        const Vector4ub tmpEndpoint = endpoints[0];
+        endpoints[0] = endpoints[1];
+        endpoints[1] = tmpEndpoint;
+        const UnsignedByte tmpPBit = pBits[0];
+        pBits[0] = pBits[1];
+        pBits[1] = tmpPBit;
+        for(UnsignedByte& index: indices) index = 15 - index;
+    }
+
+    BitWriter writer{out};
+    writer.write(1 << 6, 7);
+    for(std::size_t channel = 0; channel != 4; ++channel) {
+        writer.write(endpoints[0][channel], 7);
+        writer.write(endpoints[1][channel], 7);
+    }
+    writer.write(pBits[0], 1);
+    writer.write(pBits[1], 1);
+    writer.write(indices[0], 3);
+    for(std::size_t i = 1; i != 16; ++i)
+        writer.write(indices[i], 4);
+    CORRADE_INTERNAL_DEBUG_ASSERT(writer.offset == 128);
+}
+
+/* Per-format block fetch & encode */
+
+template<class T> void encodeBc1Block(const Containers::StridedArrayView2D<const T>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    T block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+    Rgb colors[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        colors[i] = Rgb{Float(block[i][0]), Float(block[i][1]), Float(block[i][2])};
+    encodeColorBlock(colors, quality, out);
+}
+
+void encodeBc2Block(const Containers::StridedArrayView2D<const Vector4ub>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    Vector4ub block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+
+    UnsignedLong packedAlpha = 0;
+    Rgb colors[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        packedAlpha |= UnsignedLong(Math::round(block[i].w()*(15.0f/255.0f))) << (i*4);
+        colors[i] = Rgb{block[i].xyz()};
+    }
+
+    writeLittleEndian<8>(out, packedAlpha);
+    encodeColorBlock(colors, quality, out + 8);
+}
+
+void encodeBc3Block(const Containers::StridedArrayView2D<const Vector4ub>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    Vector4ub block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+
+    Value alphas[16];
+    Rgb colors[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        alphas[i][0] = block[i].w();
+        colors[i] = Rgb{block[i].xyz()};
+    }
+
+    encodeValueBlock(alphas, quality, out);
+    encodeColorBlock(colors, quality, out + 8);
+}
+
+void encodeBc4Block(const Containers::StridedArrayView2D<const UnsignedByte>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    UnsignedByte block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+
+    Value values[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        values[i][0] = block[i];
+
+    encodeValueBlock(values, quality, out);
+}
+
+void encodeBc5Block(const Containers::StridedArrayView2D<const Vector2ub>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    Vector2ub block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+
+    Value red[16];
+    Value green[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        red[i][0] = block[i].x();
+        green[i][0] = block[i].y();
+    }
+
+    encodeValueBlock(red, quality, out);
+    encodeValueBlock(green, quality, out + 8);
+}
+
+void encodeBc7Block(const Containers::StridedArrayView2D<const Vector4ub>& pixels, const std::size_t blockY, const std::size_t blockX, const CompressionQuality quality, char* const out) {
+    Vector4ub block[16];
+    fetchBlock(pixels, blockY, blockX, block);
+
+    Rgba values[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        values[i] = Rgba{block[i]};
+
+    encodeBc7Block(values, quality, out);
+}
+
+template<std::size_t blockDataSize, class T, void(*encode)(const Containers::StridedArrayView2D<const T>&, std::size_t, std::size_t, CompressionQuality, char*)> CompressedImage2D compressInternal(const ImageView2D& image, const CompressedPixelFormat format, const CompressionQuality quality, const UnsignedInt threadCount) {
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    Containers::Array<char> data{NoInit, std::size_t(blockCount.product())*blockDataSize};
+
+    /* Each thread gets a contiguous range of block rows */
+    const Containers::StridedArrayView2D<const T> pixels = image.pixels<T>();
+    const std::size_t blockRowSize = blockCount.x()*blockDataSize;
+    Implementation::parallelFor(blockCount.y(), threadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            char* const row = data + y*blockRowSize;
+            for(std::size_t x = 0, xMax = blockCount.x(); x != xMax; ++x)
+                encode(pixels, y, x, quality, row + x*blockDataSize);
+        }
+    });
+
+    return CompressedImage2D{format, image.size(), Utility::move(data), image.flags()};
+}
+
+}
+
+CompressedImage2D compressBc1(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    const PixelFormat format = image.format();
+    if(format == PixelFormat::RGB8Unorm || format == PixelFormat::RGB8Srgb)
+        return compressInternal<8, Vector3ub, encodeBc1Block<Vector3ub>>(image, format == PixelFormat::RGB8Srgb ?
+            CompressedPixelFormat::Bc1RGBSrgb : CompressedPixelFormat::Bc1RGBUnorm, quality, threadCount);
+    if(format == PixelFormat::RGBA8Unorm || format == PixelFormat::RGBA8Srgb)
+        return compressInternal<8, Vector4ub, encodeBc1Block<Vector4ub>>(image, format == PixelFormat::RGBA8Srgb ?
+            CompressedPixelFormat::Bc1RGBSrgb : CompressedPixelFormat::Bc1RGBUnorm, quality, threadCount);
+    CORRADE_ASSERT_UNREACHABLE("TextureTools::compressBc1(): expected an 8-bit three- or four-component format but got" << format, (CompressedImage2D{}));
+}
+
+CompressedImage2D compressBc2(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    const PixelFormat format = image.format();
+    CORRADE_ASSERT(format == PixelFormat::RGBA8Unorm || format == PixelFormat::RGBA8Srgb,
+        "TextureTools::compressBc2(): expected an 8-bit four-component format but got" << format, (CompressedImage2D{}));
+    return compressInternal<16, Vector4ub, encodeBc2Block>(image, format == PixelFormat::RGBA8Srgb ?
+        CompressedPixelFormat::Bc2RGBASrgb : CompressedPixelFormat::Bc2RGBAUnorm, quality, threadCount);
+}
+
+CompressedImage2D compressBc3(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    const PixelFormat format = image.format();
+    CORRADE_ASSERT(format == PixelFormat::RGBA8Unorm || format == PixelFormat::RGBA8Srgb,
+        "TextureTools::compressBc3(): expected an 8-bit four-component format but got" << format, (CompressedImage2D{}));
+    return compressInternal<16, Vector4ub, encodeBc3Block>(image, format == PixelFormat::RGBA8Srgb ?
+        CompressedPixelFormat::Bc3RGBASrgb : CompressedPixelFormat::Bc3RGBAUnorm, quality, threadCount);
+}
+
+CompressedImage2D compressBc4(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(image.format() == PixelFormat::R8Unorm,
+        "TextureTools::compressBc4(): expected" << PixelFormat::R8Unorm << "but got" << image.format(), (CompressedImage2D{}));
+    return compressInternal<8, UnsignedByte, encodeBc4Block>(image, CompressedPixelFormat::Bc4RUnorm, quality, threadCount);
+}
+
+CompressedImage2D compressBc5(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(image.format() == PixelFormat::RG8Unorm,
+        "TextureTools::compressBc5(): expected" << PixelFormat::RG8Unorm << "but got" << image.format(), (CompressedImage2D{}));
+    return compressInternal<16, Vector2ub, encodeBc5Block>(image, CompressedPixelFormat::Bc5RGUnorm, quality, threadCount);
+}
+
+CompressedImage2D compressBc7(const ImageView2D& image, const CompressionQuality quality, const UnsignedInt threadCount) {
+    const PixelFormat format = image.format();
+    CORRADE_ASSERT(format == PixelFormat::RGBA8Unorm || format == PixelFormat::RGBA8Srgb,
+        "TextureTools::compressBc7(): expected an 8-bit four-component format but got" << format, (CompressedImage2D{}));
+    return compressInternal<16, Vector4ub, encodeBc7Block>(image, format == PixelFormat::RGBA8Srgb ?
+        CompressedPixelFormat::Bc7RGBASrgb : CompressedPixelFormat::Bc7RGBAUnorm, quality, threadCount);
+}
+
+}}
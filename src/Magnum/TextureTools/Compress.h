@@ -0,0 +1,175 @@
+#ifndef Magnum_TextureTools_Compress_h
+#define Magnum_TextureTools_Compress_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::TextureTools::CompressionQuality, function @ref Magnum::TextureTools::compressBc1(), @ref Magnum::TextureTools::compressBc2(), @ref Magnum::TextureTools::compressBc3(), @ref Magnum::TextureTools::compressBc4(), @ref Magnum::TextureTools::compressBc5(), @ref Magnum::TextureTools::compressBc7()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Block compression quality
+@m_since_latest
+
+@see @ref compressBc1(), @ref compressBc2(), @ref compressBc3(),
+    @ref compressBc4(), @ref compressBc5(), @ref compressBc7()
+*/
+enum class CompressionQuality: UnsignedByte {
+    /**
+     * Endpoints are picked from a bounding box of each block with no further
+     * refinement. Fastest, but produces visible artifacts on blocks with
+     * colors that don't lie on a bounding box diagonal.
+     */
+    Fast,
+
+    /**
+     * Endpoints are picked along a principal axis of colors in each block.
+     * A good compromise between speed and quality, used by default.
+     */
+    Normal,
+
+    /**
+     * Like @ref CompressionQuality::Normal, but the endpoints are
+     * additionally refined with a least-squares fit to the selected indices
+     * and the alternative interpolation modes are tried as well for BC4 and
+     * BC5 blocks. About two to three times slower than
+     * @ref CompressionQuality::Normal.
+     */
+    High
+};
+
+/**
+@debugoperatorenum{CompressionQuality}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, CompressionQuality value);
+
+/**
+@brief Compress an image to BC1
+@param image        Input image
+@param quality      Compression quality
+@param threadCount  Count of threads to use. If @cpp 0 @ce, the count is
+    autodetected from the hardware concurrency.
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::RGB8Unorm,
+@relativeref{PixelFormat,RGBA8Unorm}, @relativeref{PixelFormat,RGB8Srgb} or
+@relativeref{PixelFormat,RGBA8Srgb}. The output is
+@ref CompressedPixelFormat::Bc1RGBUnorm or
+@relativeref{CompressedPixelFormat,Bc1RGBSrgb} depending on whether the input
+is sRGB, the alpha channel, if present, is ignored. Blocks are always encoded
+in the four-color mode.
+
+The image is split into 4x4 blocks, with size not divisible by four the edge
+pixels get replicated to fill the remaining space in the last block row and
+column. With @p threadCount larger than @cpp 1 @ce the rows of blocks are
+distributed across given count of threads, the output is the same
+regardless of the thread count used. Image flags are passed through unchanged.
+@see @ref Math::yFlipBc1InPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc1(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+/**
+@brief Compress an image to BC2
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::RGBA8Unorm or
+@relativeref{PixelFormat,RGBA8Srgb}. The output is
+@ref CompressedPixelFormat::Bc2RGBAUnorm or
+@relativeref{CompressedPixelFormat,Bc2RGBASrgb} depending on whether the input
+is sRGB. Color is encoded the same way as in @ref compressBc1(), alpha is
+quantized to 4 bits with no further processing. See @ref compressBc1() for
+more information.
+@see @ref Math::yFlipBc2InPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc2(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+/**
+@brief Compress an image to BC3
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::RGBA8Unorm or
+@relativeref{PixelFormat,RGBA8Srgb}. The output is
+@ref CompressedPixelFormat::Bc3RGBAUnorm or
+@relativeref{CompressedPixelFormat,Bc3RGBASrgb} depending on whether the input
+is sRGB. Color is encoded the same way as in @ref compressBc1(), alpha the same
+way as in @ref compressBc4(). See @ref compressBc1() for more information.
+@see @ref Math::yFlipBc3InPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc3(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+/**
+@brief Compress an image to BC4
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::R8Unorm, the output is
+@ref CompressedPixelFormat::Bc4RUnorm. With @ref CompressionQuality::High both
+the eight-value and the six-value interpolation mode is tried and the one with
+a lower error is picked, otherwise just the eight-value mode is used. See
+@ref compressBc1() for more information.
+@see @ref Math::yFlipBc4InPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc4(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+/**
+@brief Compress an image to BC5
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::RG8Unorm, the output is
+@ref CompressedPixelFormat::Bc5RGUnorm. Each channel is encoded separately the
+same way as in @ref compressBc4(). See @ref compressBc1() for more
+information.
+@see @ref Math::yFlipBc5InPlace()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc5(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+/**
+@brief Compress an image to BC7
+@m_since_latest
+
+Expects that @p image is @ref PixelFormat::RGBA8Unorm or
+@relativeref{PixelFormat,RGBA8Srgb}. The output is
+@ref CompressedPixelFormat::Bc7RGBAUnorm or
+@relativeref{CompressedPixelFormat,Bc7RGBASrgb} depending on whether the input
+is sRGB.
+
+At the moment, all blocks are encoded using BC7 mode 6, i.e. a single subset
+with 7-bit RGBA endpoints, a unique P-bit per endpoint and 4-bit indices. That
+gives a significantly better quality than @ref compressBc3() on most inputs,
+but doesn't reach the quality of encoders that explore all eight BC7 modes and
+partitionings. See @ref compressBc1() for more information.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT CompressedImage2D compressBc7(const ImageView2D& image, CompressionQuality quality = CompressionQuality::Normal, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
@@ -0,0 +1,464 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mipmap.h"
+
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/EnumSet.hpp>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const MipmapFilter value) {
+    debug << "TextureTools::MipmapFilter" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case MipmapFilter::v: return debug << "::" #v;
+        _c(Box)
+        _c(Kaiser)
+        _c(Lanczos)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedInt(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlag value) {
+    debug << "TextureTools::MipmapFlag" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case MipmapFlag::v: return debug << "::" #v;
+        _c(PreserveAlphaCoverage)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedInt(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MipmapFlags value) {
+    return Containers::enumSetDebugOutput(debug, value, "TextureTools::MipmapFlags{}", {
+        MipmapFlag::PreserveAlphaCoverage
+    });
+}
+
+namespace {
+
+enum class Encoding: UnsignedByte {
+    Unorm,
+    Srgb,
+    Float
+};
+
+/* Channel count is zero for unsupported formats */
+struct FormatInfo {
+    UnsignedInt channelCount;
+    Encoding encoding;
+};
+
+FormatInfo formatInfo(const PixelFormat format) {
+    switch(format) {
+        #define _c(format, channelCount, encoding) case PixelFormat::format: \
+            return {channelCount, Encoding::encoding};
+        _c(R8Unorm, 1, Unorm)
+        _c(RG8Unorm, 2, Unorm)
+        _c(RGB8Unorm, 3, Unorm)
+        _c(RGBA8Unorm, 4, Unorm)
+        _c(R8Srgb, 1, Srgb)
+        _c(RG8Srgb, 2, Srgb)
+        _c(RGB8Srgb, 3, Srgb)
+        _c(RGBA8Srgb, 4, Srgb)
+        _c(R32F, 1, Float)
+        _c(RG32F, 2, Float)
+        _c(RGB32F, 3, Float)
+        _c(RGBA32F, 4, Float)
+        #undef _c
+        default: return {};
+    }
+}
+
+Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f :
+        Math::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+Float linearToSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f :
+        1.055f*Math::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+/* Minimal count of rows each thread processes, so tiny levels at the end of
+   the chain don't spawn threads for just a handful of values */
+std::size_t minRowsPerThread(const std::size_t rowSize) {
+    return Math::max(std::size_t{1}, Magnum::Implementation::ParallelForMinChunkSize/Math::max(rowSize, std::size_t{1}));
+}
+
+/* Converts the input pixels to a tightly packed array of linear floats. The
+   pixel view is [z][y][x][byte], the output is in the same order with
+   channelCount floats per pixel. */
+void decode(const Containers::StridedArrayView4D<const char>& pixels, const FormatInfo& info, Float* const out, const UnsignedInt threadCount) {
+    const std::size_t height = pixels.size()[1];
+    const std::size_t width = pixels.size()[2];
+    const std::size_t channelCount = info.channelCount;
+    const std::size_t rowSize = width*channelCount;
+
+    /* All 8-bit values decode through a table, with sRGB conversion applied
+       only to the RGB channels */
+    Float unormTable[256];
+    Float srgbTable[256];
+    for(std::size_t i = 0; i != 256; ++i) {
+        unormTable[i] = i/255.0f;
+        srgbTable[i] = srgbToLinear(unormTable[i]);
+    }
+    const Float* tables[4]{unormTable, unormTable, unormTable, unormTable};
+    if(info.encoding == Encoding::Srgb)
+        for(std::size_t i = 0; i != Math::min(channelCount, std::size_t{3}); ++i)
+            tables[i] = srgbTable;
+
+    Implementation::parallelFor(pixels.size()[0]*height, threadCount, minRowsPerThread(rowSize), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const char* const input = static_cast<const char*>(pixels.data()) + std::ptrdiff_t(row/height)*pixels.stride()[0] + std::ptrdiff_t(row%height)*pixels.stride()[1];
+            Float* const output = out + row*rowSize;
+            for(std::size_t x = 0; x != width; ++x) {
+                const char* const pixel = input + std::ptrdiff_t(x)*pixels.stride()[2];
+                if(info.encoding == Encoding::Float)
+                    std::memcpy(output + x*channelCount, pixel, channelCount*sizeof(Float));
+                else for(std::size_t c = 0; c != channelCount; ++c)
+                    output[x*channelCount + c] = tables[c][UnsignedByte(pixel[c])];
+            }
+        }
+    });
+}
+
+/* Converts linear floats back to the output format, with the fourth channel
+   optionally scaled for alpha coverage preservation */
+void encode(const Float* const in, const FormatInfo& info, const Vector3i& size, const Float alphaScale, char* const out, const std::size_t rowStride, const UnsignedInt threadCount) {
+    const std::size_t channelCount = info.channelCount;
+    const std::size_t rowSize = size.x()*channelCount;
+    const std::size_t srgbChannelCount = info.encoding == Encoding::Srgb ?
+        Math::min(channelCount, std::size_t{3}) : 0;
+
+    Implementation::parallelFor(std::size_t(size.z()*size.y()), threadCount, minRowsPerThread(rowSize), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const Float* const input = in + row*rowSize;
+            char* const output = out + row*rowStride;
+            for(std::size_t i = 0; i != rowSize; ++i) {
+                const std::size_t c = i % channelCount;
+                Float value = input[i];
+                if(c == 3 && alphaScale != 1.0f)
+                    value = Math::min(value*alphaScale, 1.0f);
+
+                if(info.encoding == Encoding::Float) {
+                    std::memcpy(output + i*sizeof(Float), &value, sizeof(Float));
+                    continue;
+                }
+
+                value = Math::clamp(value, 0.0f, 1.0f);
+                if(c < srgbChannelCount)
+                    value = linearToSrgb(value);
+                output[i] = char(UnsignedByte(value*255.0f + 0.5f));
+            }
+        }
+    });
+}
+
+/* Filter taps for downsampling a single dimension. Each output item has the
+   same count of taps, unused ones have a zero weight, which keeps the inner
+   loops free of data-dependent control flow. */
+struct Taps {
+    std::size_t count;
+    Containers::Array<std::size_t> indices;
+    Containers::Array<Float> weights;
+};
+
+/* Both Kaiser and Lanczos span three output pixels in each direction */
+constexpr Float FilterRadius = 3.0f;
+constexpr Float KaiserAlpha = 4.0f;
+
+Float sinc(Float x) {
+    if(Math::abs(x) < 1.0e-6f) return 1.0f;
+    x *= Constants::pi();
+    return std::sin(x)/x;
+}
+
+/* Modified Bessel function of the first kind of order zero */
+Float besselI0(const Float x) {
+    Float sum = 1.0f;
+    Float term = 1.0f;
+    for(Int k = 1; k != 32 && term > sum*1.0e-8f; ++k) {
+        term *= Math::pow<2>(x/(2.0f*k));
+        sum += term;
+    }
+    return sum;
+}
+
+Float filterWeight(const MipmapFilter filter, const Float x) {
+    if(Math::abs(x) >= FilterRadius) return 0.0f;
+
+    if(filter == MipmapFilter::Lanczos)
+        return sinc(x)*sinc(x/FilterRadius);
+    if(filter == MipmapFilter::Kaiser)
+        return sinc(x)*besselI0(KaiserAlpha*std::sqrt(1.0f - Math::pow<2>(x/FilterRadius)))/besselI0(KaiserAlpha);
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+Taps calculateTaps(const std::size_t inputSize, const std::size_t outputSize, const MipmapFilter filter) {
+    const Float scale = Float(inputSize)/outputSize;
+    const Float radius = filter == MipmapFilter::Box ? scale*0.5f : FilterRadius*scale;
+
+    Taps taps;
+    taps.count = std::size_t(Math::ceil(2.0f*radius)) + 1;
+    taps.indices = Containers::Array<std::size_t>{ValueInit, outputSize*taps.count};
+    taps.weights = Containers::Array<Float>{ValueInit, outputSize*taps.count};
+
+    for(std::size_t o = 0; o != outputSize; ++o) {
+        const Float center = (o + 0.5f)*scale;
+        const Long first = Long(Math::floor(center - radius));
+        std::size_t* const indices = taps.indices + o*taps.count;
+        Float* const weights = taps.weights + o*taps.count;
+
+        Float sum = 0.0f;
+        for(std::size_t t = 0; t != taps.count; ++t) {
+            const Long i = first + Long(t);
+
+            /* Box weight is the overlap of the input pixel with the area
+               covered by the output pixel, other filters are sampled at the
+               input pixel center */
+            Float weight;
+            if(filter == MipmapFilter::Box)
+                weight = Math::max(0.0f, Math::min(Float(i + 1), center + radius) - Math::max(Float(i), center - radius));
+            else
+                weight = filterWeight(filter, (i + 0.5f - center)/scale);
+
+            /* Replicate edge pixels for taps outside of the image */
+            indices[t] = std::size_t(Math::clamp(i, Long{0}, Long(inputSize) - 1));
+            weights[t] = weight;
+            sum += weight;
+        }
+
+        for(std::size_t t = 0; t != taps.count; ++t)
+            weights[t] /= sum;
+    }
+
+    return taps;
+}
+
+/* Downsamples the innermost pixel dimension. Input is rowCount rows of
+   inputWidth pixels, output has outputWidth pixels in each row. */
+Containers::Array<Float> downsampleRows(const Containers::ArrayView<const Float> input, const std::size_t rowCount, const std::size_t inputWidth, const std::size_t outputWidth, const std::size_t channelCount, const MipmapFilter filter, const UnsignedInt threadCount) {
+    const Taps taps = calculateTaps(inputWidth, outputWidth, filter);
+    Containers::Array<Float> output{NoInit, rowCount*outputWidth*channelCount};
+
+    Implementation::parallelFor(rowCount, threadCount, minRowsPerThread(inputWidth*channelCount), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const Float* const in = input + row*inputWidth*channelCount;
+            Float* const out = output + row*outputWidth*channelCount;
+            for(std::size_t x = 0; x != outputWidth; ++x) {
+                const std::size_t* const indices = taps.indices + x*taps.count;
+                const Float* const weights = taps.weights + x*taps.count;
+                for(std::size_t c = 0; c != channelCount; ++c) {
+                    Float sum = 0.0f;
+                    for(std::size_t t = 0; t != taps.count; ++t)
+                        sum += weights[t]*in[indices[t]*channelCount + c];
+                    out[x*channelCount + c] = sum;
+                }
+            }
+        }
+    });
+
+    return output;
+}
+
+/* Downsamples an outer dimension. The input is outerCount blocks of
+   inputSize slices, each slice consisting of sliceRowCount contiguous rows of
+   rowSize floats. Rows are the unit of work distributed across threads, and
+   are combined as a whole, which the compiler can vectorize. */
+Containers::Array<Float> downsampleSlices(const Containers::ArrayView<const Float> input, const std::size_t outerCount, const std::size_t inputSize, const std::size_t outputSize, const std::size_t sliceRowCount, const std::size_t rowSize, const MipmapFilter filter, const UnsignedInt threadCount) {
+    const Taps taps = calculateTaps(inputSize, outputSize, filter);
+    Containers::Array<Float> output{NoInit, outerCount*outputSize*sliceRowCount*rowSize};
+
+    Implementation::parallelFor(outerCount*outputSize*sliceRowCount, threadCount, minRowsPerThread(rowSize*taps.count), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const std::size_t sliceRow = row % sliceRowCount;
+            const std::size_t o = (row/sliceRowCount) % outputSize;
+            const std::size_t outer = row/(sliceRowCount*outputSize);
+            const std::size_t* const indices = taps.indices + o*taps.count;
+            const Float* const weights = taps.weights + o*taps.count;
+
+            Float* const out = output + row*rowSize;
+            for(std::size_t i = 0; i != rowSize; ++i) out[i] = 0.0f;
+            for(std::size_t t = 0; t != taps.count; ++t) {
+                const Float weight = weights[t];
+                const Float* const in = input + ((outer*inputSize + indices[t])*sliceRowCount + sliceRow)*rowSize;
+                for(std::size_t i = 0; i != rowSize; ++i)
+                    out[i] += weight*in[i];
+            }
+        }
+    });
+
+    return output;
+}
+
+/* Fraction of pixels with scaled alpha above given reference */
+Float alphaCoverage(const Containers::ArrayView<const Float> data, const std::size_t rowCount, const std::size_t width, const Float reference, const Float scale, const UnsignedInt threadCount) {
+    Containers::Array<std::size_t> rowCounts{NoInit, rowCount};
+    Implementation::parallelFor(rowCount, threadCount, minRowsPerThread(width), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const Float* const in = data + row*width*4;
+            std::size_t count = 0;
+            for(std::size_t x = 0; x != width; ++x)
+                count += Math::min(in[x*4 + 3]*scale, 1.0f) > reference ? 1 : 0;
+            rowCounts[row] = count;
+        }
+    });
+
+    std::size_t count = 0;
+    for(const std::size_t i: rowCounts) count += i;
+    return Float(count)/(rowCount*width);
+}
+
+/* Finds an alpha scale for which the coverage is closest to the target using
+   a bisection, as the coverage is monotonic in the scale */
+Float alphaCoverageScale(const Containers::ArrayView<const Float> data, const std::size_t rowCount, const std::size_t width, const Float reference, const Float targetCoverage, const UnsignedInt threadCount) {
+    Float min = 0.0f;
+    Float max = 4.0f;
+    Float bestScale = 1.0f;
+    Float bestDifference = Math::abs(alphaCoverage(data, rowCount, width, reference, 1.0f, threadCount) - targetCoverage);
+    for(std::size_t i = 0; i != 10 && bestDifference > 0.0f; ++i) {
+        const Float scale = (min + max)*0.5f;
+        const Float coverage = alphaCoverage(data, rowCount, width, reference, scale, threadCount);
+        const Float difference = Math::abs(coverage - targetCoverage);
+        if(difference < bestDifference) {
+            bestDifference = difference;
+            bestScale = scale;
+        }
+
+        if(coverage < targetCoverage) min = scale;
+        else max = scale;
+    }
+
+    return bestScale;
+}
+
+template<UnsignedInt dimensions> Containers::Array<Image<dimensions>> generateMipmapsInternal(const ImageView<dimensions>& image, const FormatInfo& info, const Containers::StridedArrayView4D<const char>& pixels, const Vector3i& downsample, const MipmapFilter filter, const MipmapFlags flags, const Float alphaCoverageReference, const UnsignedInt threadCount) {
+    Vector3i size{Int(pixels.size()[2]), Int(pixels.size()[1]), Int(pixels.size()[0])};
+    if(!size.product()) return {};
+
+    /* Each dimension that's downsampled is halved until it reaches 1 */
+    const auto nextLevelSize = [&downsample](const Vector3i& previous) {
+        return Vector3i{Math::max(previous/(downsample + Vector3i{1}), Vector3i{1})};
+    };
+    std::size_t levelCount = 0;
+    for(Vector3i levelSize = size; nextLevelSize(levelSize) != levelSize; levelSize = nextLevelSize(levelSize))
+        ++levelCount;
+
+    /* The images have no default constructor, they're placement-constructed
+       below */
+    Containers::Array<Image<dimensions>> out{NoInit, levelCount};
+
+    const std::size_t channelCount = info.channelCount;
+    Containers::Array<Float> current{NoInit, std::size_t(size.product())*channelCount};
+    decode(pixels, info, current, threadCount);
+
+    Float targetCoverage{};
+    if(flags & MipmapFlag::PreserveAlphaCoverage)
+        targetCoverage = alphaCoverage(current, size.z()*size.y(), size.x(), alphaCoverageReference, 1.0f, threadCount);
+
+    for(std::size_t level = 0; level != levelCount; ++level) {
+        const Vector3i next = nextLevelSize(size);
+
+        /* Downsample X first as that reduces the amount of data the other
+           passes have to go through the most */
+        if(next.x() != size.x())
+            current = downsampleRows(current, size.z()*size.y(), size.x(), next.x(), channelCount, filter, threadCount);
+        const std::size_t rowSize = next.x()*channelCount;
+        if(next.y() != size.y())
+            current = downsampleSlices(current, size.z(), size.y(), next.y(), 1, rowSize, filter, threadCount);
+        if(next.z() != size.z())
+            current = downsampleSlices(current, 1, size.z(), next.z(), next.y(), rowSize, filter, threadCount);
+        size = next;
+
+        /* The scale is applied only to the output, the next level is
+           calculated from unscaled values so the error doesn't accumulate */
+        const Float alphaScale = flags & MipmapFlag::PreserveAlphaCoverage ?
+            alphaCoverageScale(current, size.z()*size.y(), size.x(), alphaCoverageReference, targetCoverage, threadCount) : 1.0f;
+
+        /* Output with the default four-byte row alignment */
+        const std::size_t pixelSize = image.pixelSize();
+        const std::size_t rowStride = (size.x()*pixelSize + 3)/4*4;
+        Containers::Array<char> data{ValueInit, rowStride*size.y()*size.z()};
+        encode(current, info, size, alphaScale, data, rowStride, threadCount);
+
+        new(&out[level]) Image<dimensions>{image.format(), Math::Vector<dimensions, Int>::pad(size), Utility::move(data), image.flags()};
+    }
+
+    return out;
+}
+
+}
+
+Containers::Array<Image2D> generateMipmaps(const ImageView2D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaCoverageReference, const UnsignedInt threadCount) {
+    const FormatInfo info = formatInfo(image.format());
+    CORRADE_ASSERT(info.channelCount,
+        "TextureTools::generateMipmaps(): unsupported format" << image.format(), {});
+    CORRADE_ASSERT(!(flags & MipmapFlag::PreserveAlphaCoverage) || info.channelCount == 4,
+        "TextureTools::generateMipmaps(): alpha coverage preservation expects a four-component format but got" << image.format(), {});
+
+    /* Y is not downsampled for 1D array images */
+    const Vector3i downsample{1, image.flags() & ImageFlag2D::Array ? 0 : 1, 0};
+    return generateMipmapsInternal(image, info, image.pixels().expanded<0>(Containers::Size2D{1, std::size_t(image.size().y())}), downsample, filter, flags, alphaCoverageReference, threadCount);
+}
+
+Containers::Array<Image3D> generateMipmaps(const ImageView3D& image, const MipmapFilter filter, const MipmapFlags flags, const Float alphaCoverageReference, const UnsignedInt threadCount) {
+    const FormatInfo info = formatInfo(image.format());
+    CORRADE_ASSERT(info.channelCount,
+        "TextureTools::generateMipmaps(): unsupported format" << image.format(), {});
+    CORRADE_ASSERT(!(flags & MipmapFlag::PreserveAlphaCoverage) || info.channelCount == 4,
+        "TextureTools::generateMipmaps(): alpha coverage preservation expects a four-component format but got" << image.format(), {});
+
+    /* Z is not downsampled for 2D array and cube map images */
+    const Vector3i downsample{1, 1, image.flags() & (ImageFlag3D::Array|ImageFlag3D::CubeMap) ? 0 : 1};
+    return generateMipmapsInternal(image, info, image.pixels(), downsample, filter, flags, alphaCoverageReference, threadCount);
+}
+
+}}
@@ -0,0 +1,162 @@
+#ifndef Magnum_TextureTools_Mipmap_h
+#define Magnum_TextureTools_Mipmap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::TextureTools::MipmapFilter, @ref Magnum::TextureTools::MipmapFlag, enum set @ref Magnum::TextureTools::MipmapFlags, function @ref Magnum::TextureTools::generateMipmaps()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Mipmap downsampling filter
+@m_since_latest
+
+@see @ref generateMipmaps()
+*/
+enum class MipmapFilter: UnsignedByte {
+    /**
+     * Average of all input pixels covered by the output pixel. Fastest, for
+     * power-of-two sizes equivalent to averaging each 2x2 block. Tends to
+     * produce blurry results on lower levels.
+     */
+    Box,
+
+    /**
+     * A Kaiser-windowed sinc with a radius of three output pixels. Preserves
+     * more detail than @ref MipmapFilter::Box with a slight ringing on sharp
+     * edges.
+     */
+    Kaiser,
+
+    /**
+     * A Lanczos filter with a radius of three output pixels. Sharper than
+     * @ref MipmapFilter::Kaiser, but with more pronounced ringing.
+     */
+    Lanczos
+};
+
+/**
+@debugoperatorenum{MipmapFilter}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFilter value);
+
+/**
+@brief Mipmap generation flag
+@m_since_latest
+
+@see @ref MipmapFlags, @ref generateMipmaps()
+*/
+enum class MipmapFlag: UnsignedByte {
+    /**
+     * Scale alpha of each generated level so the fraction of pixels with
+     * alpha above a reference value stays the same as in the input image.
+     * Without this, alpha-tested geometry such as foliage or fences gets
+     * gradually thinner on lower levels. Expects a four-component format.
+     */
+    PreserveAlphaCoverage = 1 << 0
+};
+
+/**
+@debugoperatorenum{MipmapFlag}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFlag value);
+
+/**
+@brief Mipmap generation flags
+@m_since_latest
+
+@see @ref generateMipmaps()
+*/
+typedef Containers::EnumSet<MipmapFlag> MipmapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MipmapFlags)
+
+/**
+@debugoperatorenum{MipmapFlags}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& debug, MipmapFlags value);
+
+/**
+@brief Generate mip levels of a 2D image
+@param image                    Input image
+@param filter                   Downsampling filter
+@param flags                    Flags
+@param alphaCoverageReference   Alpha reference value used with
+    @ref MipmapFlag::PreserveAlphaCoverage, ignored otherwise
+@param threadCount              Count of threads to use. If @cpp 0 @ce, the
+    count is autodetected from the hardware concurrency.
+@m_since_latest
+
+Returns all levels after @p image, i.e. starting with the one of half the
+size, down to a single pixel. Each dimension is halved and rounded down,
+stopping at @cpp 1 @ce. If @p image has @ref ImageFlag2D::Array set, the Y
+dimension is treated as layers and isn't downsampled. For an image that's
+already a single pixel returns an empty array. The returned images have the
+same format and flags as @p image and the default @ref PixelStorage.
+
+Expects that @p image is one of @ref PixelFormat::R8Unorm,
+@relativeref{PixelFormat,RG8Unorm}, @relativeref{PixelFormat,RGB8Unorm},
+@relativeref{PixelFormat,RGBA8Unorm}, the corresponding sRGB formats or
+@relativeref{PixelFormat,R32F}, @relativeref{PixelFormat,RG32F},
+@relativeref{PixelFormat,RGB32F} or @relativeref{PixelFormat,RGBA32F}. Each
+level is calculated from the previous one in floating-point. For sRGB formats
+the RGB channels are converted to linear RGB before filtering and back after,
+the alpha channel is always treated as linear. Edge pixels are replicated for
+filter taps falling outside of the image.
+
+The filtering is done in separate passes along each dimension. With
+@p threadCount larger than @cpp 1 @ce the rows processed by each pass are
+distributed across given count of threads, the output is the same regardless
+of the thread count used.
+@see @ref Math::pack(), @ref Color3::fromSrgb()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image2D> generateMipmaps(const ImageView2D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, Float alphaCoverageReference = 0.5f, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate mip levels of a 3D image
+@m_since_latest
+
+Like @ref generateMipmaps(const ImageView2D&, MipmapFilter, MipmapFlags, Float, UnsignedInt),
+but for a 3D image. If @p image has @ref ImageFlag3D::Array or
+@relativeref{ImageFlag3D,CubeMap} set, the Z dimension is treated as layers
+or faces and isn't downsampled.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image3D> generateMipmaps(const ImageView3D& image, MipmapFilter filter = MipmapFilter::Box, MipmapFlags flags = {}, Float alphaCoverageReference = 0.5f, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
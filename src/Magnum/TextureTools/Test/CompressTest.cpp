@@ -0,0 +1,387 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/Compress.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct CompressTest: TestSuite::Tester {
+    explicit CompressTest();
+
+    void debugCompressionQuality();
+
+    void bc1Solid();
+    void bc1TwoColors();
+    void bc1Srgb();
+    void bc1Rgba();
+    void bc2Solid();
+    void bc3Solid();
+    void bc4Solid();
+    void bc4Gradient();
+    void bc5Solid();
+    void bc7Solid();
+    void bc7TwoColors();
+
+    void nonMultipleOfFour();
+    void empty();
+    void flags();
+    void threads();
+
+    void invalidFormat();
+};
+
+const struct {
+    const char* name;
+    CompressionQuality quality;
+} QualityData[]{
+    {"fast", CompressionQuality::Fast},
+    {"normal", CompressionQuality::Normal},
+    {"high", CompressionQuality::High}
+};
+
+const struct {
+    const char* name;
+    CompressionQuality quality;
+} RefinedQualityData[]{
+    /* Fast is using an inset bounding box, which doesn't result in exact
+       endpoints for two-color blocks */
+    {"normal", CompressionQuality::Normal},
+    {"high", CompressionQuality::High}
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"two threads", 2},
+    {"seven threads", 7},
+    {"more threads than block rows", 100},
+    {"autodetected", 0}
+};
+
+using namespace Math::Literals;
+
+CompressTest::CompressTest() {
+    addTests({&CompressTest::debugCompressionQuality});
+
+    addInstancedTests({&CompressTest::bc1Solid},
+        Containers::arraySize(QualityData));
+
+    addInstancedTests({&CompressTest::bc1TwoColors},
+        Containers::arraySize(RefinedQualityData));
+
+    addTests({&CompressTest::bc1Srgb,
+              &CompressTest::bc1Rgba});
+
+    addInstancedTests({&CompressTest::bc2Solid,
+                       &CompressTest::bc3Solid,
+                       &CompressTest::bc4Solid,
+                       &CompressTest::bc4Gradient,
+                       &CompressTest::bc5Solid,
+                       &CompressTest::bc7Solid},
+        Containers::arraySize(QualityData));
+
+    addInstancedTests({&CompressTest::bc7TwoColors},
+        Containers::arraySize(RefinedQualityData));
+
+    addTests({&CompressTest::nonMultipleOfFour,
+              &CompressTest::empty,
+              &CompressTest::flags});
+
+    addInstancedTests({&CompressTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&CompressTest::invalidFormat});
+}
+
+void CompressTest::debugCompressionQuality() {
+    Containers::String out;
+    Debug{&out} << CompressionQuality::High << CompressionQuality(0xde);
+    CORRADE_COMPARE(out, "TextureTools::CompressionQuality::High TextureTools::CompressionQuality(0xde)\n");
+}
+
+void CompressTest::bc1Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color3ub pixels[16];
+    for(Color3ub& i: pixels) i = 0x336699_rgb;
+
+    CompressedImage2D out = compressBc1(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    /* 0x336699 is exactly representable in RGB565 as 0x3333, all indices
+       are zero */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x33', '\x33', '\x33', '\x33', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc1TwoColors() {
+    auto&& data = RefinedQualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Top half white, bottom half black. Two rows in an image with row
+       padding, to verify the stride is respected */
+    Color3ub pixels[]{
+        0xffffff_rgb, 0xffffff_rgb, 0xffffff_rgb, 0xffffff_rgb, {},
+        0xffffff_rgb, 0xffffff_rgb, 0xffffff_rgb, 0xffffff_rgb, {},
+        0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0x000000_rgb, {},
+        0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0x000000_rgb, {},
+    };
+
+    CompressedImage2D out = compressBc1(ImageView2D{PixelStorage{}.setAlignment(1).setRowLength(5), PixelFormat::RGB8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBUnorm);
+    /* First endpoint is white, second black, four-color mode as the first
+       is larger. First two rows pick index 0, second two index 1. */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xff', '\xff', 0, 0, 0, 0, '\x55', '\x55'
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc1Srgb() {
+    Color3ub pixels[16];
+    for(Color3ub& i: pixels) i = 0x336699_srgb;
+
+    CompressedImage2D out = compressBc1(ImageView2D{PixelFormat::RGB8Srgb, {4, 4}, pixels});
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBSrgb);
+    /* The data are compressed as-is, without any conversion */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x33', '\x33', '\x33', '\x33', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc1Rgba() {
+    Color4ub pixels[16];
+    for(Color4ub& i: pixels) i = 0x33669900_rgba;
+
+    /* Alpha is ignored */
+    CompressedImage2D out = compressBc1(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, pixels});
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBSrgb);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x33', '\x33', '\x33', '\x33', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc2Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub pixels[16];
+    for(Color4ub& i: pixels) i = 0x336699cc_rgba;
+
+    CompressedImage2D out = compressBc2(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc2RGBAUnorm);
+    /* 0xcc is exactly 12/15 */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xcc', '\xcc', '\xcc', '\xcc', '\xcc', '\xcc', '\xcc', '\xcc',
+        '\x33', '\x33', '\x33', '\x33', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc3Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub pixels[16];
+    for(Color4ub& i: pixels) i = 0x336699cc_srgba;
+
+    CompressedImage2D out = compressBc3(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc3RGBASrgb);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xcc', '\xcc', 0, 0, 0, 0, 0, 0,
+        '\x33', '\x33', '\x33', '\x33', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc4Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedByte pixels[16];
+    for(UnsignedByte& i: pixels) i = 0x80;
+
+    CompressedImage2D out = compressBc4(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc4RUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x80', '\x80', 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc4Gradient() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    UnsignedByte pixels[16];
+    for(std::size_t i = 0; i != 16; ++i) pixels[i] = i*17;
+
+    CompressedImage2D out = compressBc4(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc4RUnorm);
+    /* Eight-value mode with 0xff and 0x00 as endpoints, which is also the
+       best option for high quality */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xff', '\x00', '\xc9', '\x6f', '\xb7', '\xe4', '\x26', '\x01'
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc5Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Vector2ub pixels[16];
+    for(Vector2ub& i: pixels) i = {0x80, 0x33};
+
+    CompressedImage2D out = compressBc5(ImageView2D{PixelStorage{}.setAlignment(2), PixelFormat::RG8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc5RGUnorm);
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x80', '\x80', 0, 0, 0, 0, 0, 0,
+        '\x33', '\x33', 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc7Solid() {
+    auto&& data = QualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Color4ub pixels[16];
+    for(Color4ub& i: pixels) i = 0x336699cc_rgba;
+
+    CompressedImage2D out = compressBc7(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc7RGBAUnorm);
+    /* Mode 6, all endpoints 0x34669acc as the channels have mixed parity and
+       so can't be all represented exactly with a single P-bit, indices all
+       zero */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\x40', '\x8d', '\x66', '\x36', '\x6b', '\x36', '\xcd', '\x66',
+        0, 0, 0, 0, 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::bc7TwoColors() {
+    auto&& data = RefinedQualityData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Top half opaque white, bottom half transparent black */
+    Color4ub pixels[16];
+    for(std::size_t i = 0; i != 16; ++i)
+        pixels[i] = i < 8 ? 0xffffffff_rgba : 0x00000000_rgba;
+
+    CompressedImage2D out = compressBc7(ImageView2D{PixelFormat::RGBA8Srgb, {4, 4}, pixels}, data.quality);
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc7RGBASrgb);
+    /* Mode 6, first endpoint 0xffffffff with P-bit 1, second 0x00000000
+       with P-bit 0, first eight indices 0 and the rest 15 */
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        '\xc0', '\x3f', '\xe0', '\x0f', '\xf8', '\x03', '\xfe', '\x80',
+        0, 0, 0, 0, '\xff', '\xff', '\xff', '\xff'
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::nonMultipleOfFour() {
+    /* 5x3 pixels, which makes 2x1 blocks. The right block column has just
+       one pixel that's replicated to the rest and the bottom row gets
+       replicated as well. */
+    Color3ub pixels[]{
+        0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0xffffff_rgb,
+        0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0xffffff_rgb,
+        0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0x000000_rgb, 0xffffff_rgb,
+    };
+
+    CompressedImage2D out = compressBc1(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {5, 3}, pixels});
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{5, 3}));
+    CORRADE_COMPARE_AS(out.data(), Containers::arrayView<char>({
+        0, 0, 0, 0, 0, 0, 0, 0,
+        '\xff', '\xff', '\xff', '\xff', 0, 0, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void CompressTest::empty() {
+    CompressedImage2D out = compressBc7(ImageView2D{PixelFormat::RGBA8Unorm, {0, 0}});
+    CORRADE_COMPARE(out.format(), CompressedPixelFormat::Bc7RGBAUnorm);
+    CORRADE_COMPARE(out.size(), Vector2i{});
+    CORRADE_COMPARE(out.data().size(), 0);
+}
+
+void CompressTest::flags() {
+    Color4ub pixels[16]{};
+
+    CompressedImage2D out = compressBc3(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels, ImageFlag2D::Array});
+    CORRADE_COMPARE(out.flags(), ImageFlag2D::Array);
+}
+
+void CompressTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudorandom data of a size that isn't divisible by four, to have the
+       last block row and column partial */
+    Containers::Array<Color4ub> pixels{NoInit, 67*41};
+    UnsignedInt seed = 1;
+    for(Color4ub& i: pixels) {
+        seed = seed*1103515245u + 12345u;
+        i = {UnsignedByte(seed >> 24), UnsignedByte(seed >> 16), UnsignedByte(seed >> 8), UnsignedByte(seed)};
+    }
+    ImageView2D image{PixelFormat::RGBA8Unorm, {67, 41}, pixels};
+
+    /* The output should be the same regardless of the thread count */
+    CompressedImage2D expected = compressBc7(image, CompressionQuality::Normal, 1);
+    CompressedImage2D actual = compressBc7(image, CompressionQuality::Normal, data.threadCount);
+    CORRADE_COMPARE(actual.size(), expected.size());
+    CORRADE_COMPARE_AS(actual.data(), expected.data(),
+        TestSuite::Compare::Container);
+}
+
+void CompressTest::invalidFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    compressBc1(ImageView2D{PixelFormat::RG8Unorm, {4, 4}});
+    compressBc2(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}});
+    compressBc3(ImageView2D{PixelFormat::RGBA16Unorm, {4, 4}});
+    compressBc4(ImageView2D{PixelFormat::R8Srgb, {4, 4}});
+    compressBc5(ImageView2D{PixelFormat::RG8Snorm, {4, 4}});
+    compressBc7(ImageView2D{PixelFormat::RGBA8Snorm, {4, 4}});
+    CORRADE_COMPARE(out,
+        "TextureTools::compressBc1(): expected an 8-bit three- or four-component format but got PixelFormat::RG8Unorm\n"
+        "TextureTools::compressBc2(): expected an 8-bit four-component format but got PixelFormat::RGB8Unorm\n"
+        "TextureTools::compressBc3(): expected an 8-bit four-component format but got PixelFormat::RGBA16Unorm\n"
+        "TextureTools::compressBc4(): expected PixelFormat::R8Unorm but got PixelFormat::R8Srgb\n"
+        "TextureTools::compressBc5(): expected PixelFormat::RG8Unorm but got PixelFormat::RG8Snorm\n"
+        "TextureTools::compressBc7(): expected an 8-bit four-component format but got PixelFormat::RGBA8Snorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::CompressTest)
@@ -0,0 +1,480 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Mipmap.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct MipmapTest: TestSuite::Tester {
+    explicit MipmapTest();
+
+    void debugFilter();
+    void debugFlag();
+    void debugFlags();
+
+    void levelSizes();
+    void levelSizesArray();
+    void levelSizes3D();
+    void levelSizes3DCubeMap();
+    void singlePixel();
+    void empty();
+
+    void box();
+    void boxNonPowerOfTwo();
+    void boxFloat();
+    void srgb();
+    void constant();
+    void nonConstant();
+    void nonConstant3D();
+    void alphaCoverage();
+
+    void threads();
+
+    void invalidFormat();
+    void alphaCoverageNotFourComponent();
+};
+
+const struct {
+    const char* name;
+    MipmapFilter filter;
+} FilterData[]{
+    {"box", MipmapFilter::Box},
+    {"Kaiser", MipmapFilter::Kaiser},
+    {"Lanczos", MipmapFilter::Lanczos}
+};
+
+/* The expected values are levels concatenated together, each having half
+   the size of the previous. With the Kaiser and Lanczos filters every output
+   pixel reaches past the image edges, which are replicated, and the sharp
+   step rings below zero and above one, which isn't clamped for floats. */
+const struct {
+    const char* name;
+    MipmapFilter filter;
+    bool vertical;
+    std::size_t size;
+    Float input[8];
+    Float expected[7];
+} NonConstantData[]{
+    {"box, ramp", MipmapFilter::Box, false, 8,
+        {0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f},
+        {0.05f, 0.25f, 0.45f, 0.65f,
+         0.15f, 0.55f,
+         0.35f}},
+    {"Kaiser, ramp", MipmapFilter::Kaiser, false, 8,
+        {0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f},
+        {0.049732f, 0.251116f, 0.448884f, 0.650268f,
+         0.146161f, 0.553839f,
+         0.35f}},
+    {"Kaiser, step", MipmapFilter::Kaiser, false, 8,
+        {0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f},
+        {-0.011380f, 0.056923f, 0.943077f, 1.011380f,
+         0.067950f, 0.932050f,
+         0.5f}},
+    {"Kaiser, three pixels", MipmapFilter::Kaiser, false, 3,
+        {0.1f, 0.9f, 0.2f},
+        {0.399320f}},
+    {"Kaiser, five pixels", MipmapFilter::Kaiser, false, 5,
+        {0.8f, 0.0f, 0.4f, 0.2f, 1.0f},
+        {0.354059f, 0.518395f,
+         0.436227f}},
+    {"Kaiser, five pixels, vertical", MipmapFilter::Kaiser, true, 5,
+        {0.8f, 0.0f, 0.4f, 0.2f, 1.0f},
+        {0.354059f, 0.518395f,
+         0.436227f}},
+    {"Lanczos, ramp", MipmapFilter::Lanczos, false, 8,
+        {0.0f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f},
+        {0.047890f, 0.250349f, 0.449651f, 0.652109f,
+         0.143226f, 0.556774f,
+         0.35f}},
+    {"Lanczos, step", MipmapFilter::Lanczos, false, 8,
+        {0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f},
+        {-0.015253f, 0.053615f, 0.946385f, 1.015253f,
+         0.061407f, 0.938593f,
+         0.5f}},
+    {"Lanczos, three pixels", MipmapFilter::Lanczos, false, 3,
+        {0.1f, 0.9f, 0.2f},
+        {0.400734f}},
+    {"Lanczos, five pixels", MipmapFilter::Lanczos, false, 5,
+        {0.8f, 0.0f, 0.4f, 0.2f, 1.0f},
+        {0.350075f, 0.515584f,
+         0.432830f}},
+    {"Lanczos, five pixels, vertical", MipmapFilter::Lanczos, true, 5,
+        {0.8f, 0.0f, 0.4f, 0.2f, 1.0f},
+        {0.350075f, 0.515584f,
+         0.432830f}},
+};
+
+const struct {
+    const char* name;
+    bool preserveAlphaCoverage;
+    std::size_t expectedCoverage;
+} AlphaCoverageData[]{
+    {"", false, 1},
+    {"preserve alpha coverage", true, 2}
+};
+
+const struct {
+    const char* name;
+    MipmapFilter filter;
+    UnsignedInt threadCount;
+} ThreadsData[]{
+    {"box, two threads", MipmapFilter::Box, 2},
+    {"Lanczos, seven threads", MipmapFilter::Lanczos, 7},
+    {"Kaiser, autodetected", MipmapFilter::Kaiser, 0}
+};
+
+MipmapTest::MipmapTest() {
+    addTests({&MipmapTest::debugFilter,
+              &MipmapTest::debugFlag,
+              &MipmapTest::debugFlags,
+
+              &MipmapTest::levelSizes,
+              &MipmapTest::levelSizesArray,
+              &MipmapTest::levelSizes3D,
+              &MipmapTest::levelSizes3DCubeMap,
+              &MipmapTest::singlePixel,
+              &MipmapTest::empty,
+
+              &MipmapTest::box,
+              &MipmapTest::boxNonPowerOfTwo,
+              &MipmapTest::boxFloat,
+              &MipmapTest::srgb});
+
+    addInstancedTests({&MipmapTest::constant},
+        Containers::arraySize(FilterData));
+
+    addInstancedTests({&MipmapTest::nonConstant},
+        Containers::arraySize(NonConstantData));
+
+    addTests({&MipmapTest::nonConstant3D});
+
+    addInstancedTests({&MipmapTest::alphaCoverage},
+        Containers::arraySize(AlphaCoverageData));
+
+    addInstancedTests({&MipmapTest::threads},
+        Containers::arraySize(ThreadsData));
+
+    addTests({&MipmapTest::invalidFormat,
+              &MipmapTest::alphaCoverageNotFourComponent});
+}
+
+void MipmapTest::debugFilter() {
+    Containers::String out;
+    Debug{&out} << MipmapFilter::Lanczos << MipmapFilter(0xde);
+    CORRADE_COMPARE(out, "TextureTools::MipmapFilter::Lanczos TextureTools::MipmapFilter(0xde)\n");
+}
+
+void MipmapTest::debugFlag() {
+    Containers::String out;
+    Debug{&out} << MipmapFlag::PreserveAlphaCoverage << MipmapFlag(0xde);
+    CORRADE_COMPARE(out, "TextureTools::MipmapFlag::PreserveAlphaCoverage TextureTools::MipmapFlag(0xde)\n");
+}
+
+void MipmapTest::debugFlags() {
+    Containers::String out;
+    Debug{&out} << (MipmapFlag::PreserveAlphaCoverage|MipmapFlag(0xe0)) << MipmapFlags{};
+    CORRADE_COMPARE(out, "TextureTools::MipmapFlag::PreserveAlphaCoverage|TextureTools::MipmapFlag(0xe0) TextureTools::MipmapFlags{}\n");
+}
+
+void MipmapTest::levelSizes() {
+    UnsignedByte pixels[8*3]{};
+
+    /* Each dimension is halved separately, stopping at 1 */
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {8, 3}, pixels});
+    CORRADE_COMPARE(out.size(), 3);
+    CORRADE_COMPARE(out[0].format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out[0].size(), (Vector2i{4, 1}));
+    CORRADE_COMPARE(out[1].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(out[2].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(out[2].storage().alignment(), 4);
+}
+
+void MipmapTest::levelSizesArray() {
+    UnsignedByte pixels[4*3]{};
+
+    /* Y is layers, not downsampled */
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {4, 3}, pixels, ImageFlag2D::Array});
+    CORRADE_COMPARE(out.size(), 2);
+    CORRADE_COMPARE(out[0].size(), (Vector2i{2, 3}));
+    CORRADE_COMPARE(out[0].flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(out[1].size(), (Vector2i{1, 3}));
+    CORRADE_COMPARE(out[1].flags(), ImageFlag2D::Array);
+}
+
+void MipmapTest::levelSizes3D() {
+    UnsignedByte pixels[4*4*2]{};
+
+    Containers::Array<Image3D> out = generateMipmaps(ImageView3D{PixelFormat::R8Unorm, {4, 4, 2}, pixels});
+    CORRADE_COMPARE(out.size(), 2);
+    CORRADE_COMPARE(out[0].size(), (Vector3i{2, 2, 1}));
+    CORRADE_COMPARE(out[1].size(), (Vector3i{1, 1, 1}));
+}
+
+void MipmapTest::levelSizes3DCubeMap() {
+    /* Each face has a different value, verify they don't get mixed */
+    Color4ub pixels[4*4*6];
+    for(std::size_t i = 0; i != Containers::arraySize(pixels); ++i)
+        pixels[i] = Color4ub{UnsignedByte(i/16*10)};
+
+    Containers::Array<Image3D> out = generateMipmaps(ImageView3D{PixelFormat::RGBA8Unorm, {4, 4, 6}, pixels, ImageFlag3D::CubeMap}, MipmapFilter::Lanczos);
+    CORRADE_COMPARE(out.size(), 2);
+    CORRADE_COMPARE(out[0].size(), (Vector3i{2, 2, 6}));
+    CORRADE_COMPARE(out[0].flags(), ImageFlag3D::CubeMap);
+    CORRADE_COMPARE(out[1].size(), (Vector3i{1, 1, 6}));
+    CORRADE_COMPARE(out[1].flags(), ImageFlag3D::CubeMap);
+
+    const Containers::StridedArrayView3D<const Color4ub> level = out[1].pixels<Color4ub>();
+    for(std::size_t i = 0; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(level[i][0][0], Color4ub{UnsignedByte(i*10)});
+    }
+}
+
+void MipmapTest::singlePixel() {
+    UnsignedByte pixels[4*4]{};
+
+    CORRADE_COMPARE(generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {1, 1}, pixels}).size(), 0);
+    CORRADE_COMPARE(generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {1, 4}, pixels, ImageFlag2D::Array}).size(), 0);
+}
+
+void MipmapTest::empty() {
+    CORRADE_COMPARE(generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {0, 0}}).size(), 0);
+    CORRADE_COMPARE(generateMipmaps(ImageView3D{PixelFormat::RGBA8Unorm, {4, 0, 2}}).size(), 0);
+}
+
+void MipmapTest::box() {
+    const Color4ub pixels[]{
+        {0, 10, 20, 255}, {4, 14, 24, 255},
+        {8, 18, 28, 0}, {12, 22, 32, 0}
+    };
+
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, pixels});
+    CORRADE_COMPARE(out.size(), 1);
+    CORRADE_COMPARE(out[0].format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(out[0].size(), (Vector2i{1, 1}));
+    /* Alpha is averaged as well, rounding to nearest */
+    CORRADE_COMPARE(out[0].pixels<Color4ub>()[0][0], (Color4ub{6, 16, 26, 128}));
+}
+
+void MipmapTest::boxNonPowerOfTwo() {
+    const UnsignedByte pixels[]{0, 90, 180, 0};
+
+    /* All three pixels contribute equally */
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {3, 1}, pixels});
+    CORRADE_COMPARE(out.size(), 1);
+    CORRADE_COMPARE(out[0].pixels<UnsignedByte>()[0][0], 90);
+}
+
+void MipmapTest::boxFloat() {
+    const Float pixels[]{0.0f, 1.0f, 2.0f, 3.0f};
+
+    /* Floats aren't clamped to the [0, 1] range */
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::R32F, {4, 1}, pixels});
+    CORRADE_COMPARE(out.size(), 2);
+    CORRADE_COMPARE(out[0].format(), PixelFormat::R32F);
+    CORRADE_COMPARE(out[0].pixels<Float>()[0][0], 0.5f);
+    CORRADE_COMPARE(out[0].pixels<Float>()[0][1], 2.5f);
+    CORRADE_COMPARE(out[1].pixels<Float>()[0][0], 1.5f);
+}
+
+void MipmapTest::srgb() {
+    /* Two RGB pixels in a row with four-byte alignment, verifying the row
+       padding is respected */
+    const UnsignedByte pixels[]{
+        0, 0, 0, 255, 255, 255, 0, 0
+    };
+
+    /* Unorm gives the arithmetic mean */
+    Containers::Array<Image2D> linear = generateMipmaps(ImageView2D{PixelFormat::RGB8Unorm, {2, 1}, pixels});
+    CORRADE_COMPARE(linear.size(), 1);
+    CORRADE_COMPARE(linear[0].pixels<Color3ub>()[0][0], (Color3ub{128}));
+
+    /* sRGB averages in linear space, which is brighter after converting back */
+    Containers::Array<Image2D> srgb = generateMipmaps(ImageView2D{PixelFormat::RGB8Srgb, {2, 1}, pixels});
+    CORRADE_COMPARE(srgb.size(), 1);
+    CORRADE_COMPARE(srgb[0].format(), PixelFormat::RGB8Srgb);
+    CORRADE_COMPARE(srgb[0].pixels<Color3ub>()[0][0], (Color3ub{188}));
+}
+
+void MipmapTest::constant() {
+    auto&& data = FilterData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Weights of all filters are normalized, so a constant image stays
+       constant on all levels */
+    Containers::Array<Color4ub> pixels{DirectInit, 13*7, Color4ub{10, 20, 30, 40}};
+
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {13, 7}, pixels}, data.filter);
+    CORRADE_COMPARE(out.size(), 3);
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        for(const Containers::StridedArrayView1D<const Color4ub> row: out[i].pixels<Color4ub>())
+            for(const Color4ub& pixel: row)
+                CORRADE_COMPARE(pixel, (Color4ub{10, 20, 30, 40}));
+    }
+}
+
+void MipmapTest::nonConstant() {
+    auto&& data = NonConstantData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* A single row or a single column, the latter going through the
+       downsampling of outer dimensions */
+    const Vector2i size = data.vertical ? Vector2i{1, Int(data.size)} : Vector2i{Int(data.size), 1};
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::R32F, size, Containers::arrayView(data.input).prefix(data.size)}, data.filter);
+
+    std::size_t offset = 0;
+    std::size_t levelSize = data.size;
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        CORRADE_ITERATION(i);
+        levelSize = Math::max(levelSize/2, std::size_t{1});
+        CORRADE_COMPARE(out[i].size(), (data.vertical ? Vector2i{1, Int(levelSize)} : Vector2i{Int(levelSize), 1}));
+
+        const Containers::StridedArrayView2D<const Float> pixels = out[i].pixels<Float>();
+        for(std::size_t j = 0; j != levelSize; ++j) {
+            CORRADE_ITERATION(j);
+            CORRADE_COMPARE(data.vertical ? pixels[j][0] : pixels[0][j], data.expected[offset + j]);
+        }
+        offset += levelSize;
+    }
+    CORRADE_COMPARE(levelSize, 1);
+}
+
+void MipmapTest::nonConstant3D() {
+    /* All eight pixels of a 2x2x2 image get averaged into one, with the Z
+       dimension downsampled as well as it's not an array */
+    const Float cube[]{
+        0.0f, 0.1f,
+        0.2f, 0.3f,
+
+        0.4f, 0.5f,
+        0.6f, 1.0f
+    };
+    Containers::Array<Image3D> box = generateMipmaps(ImageView3D{PixelFormat::R32F, {2, 2, 2}, cube});
+    CORRADE_COMPARE(box.size(), 1);
+    CORRADE_COMPARE(box[0].size(), (Vector3i{1, 1, 1}));
+    CORRADE_COMPARE(box[0].pixels<Float>()[0][0][0], 0.3875f);
+
+    /* Five slices along Z give the same result as five pixels in a row in
+       the 2D test above, including the edge replication */
+    const Float slices[]{0.8f, 0.0f, 0.4f, 0.2f, 1.0f};
+    Containers::Array<Image3D> lanczos = generateMipmaps(ImageView3D{PixelFormat::R32F, {1, 1, 5}, slices}, MipmapFilter::Lanczos);
+    CORRADE_COMPARE(lanczos.size(), 2);
+    CORRADE_COMPARE(lanczos[0].size(), (Vector3i{1, 1, 2}));
+    CORRADE_COMPARE(lanczos[0].pixels<Float>()[0][0][0], 0.350075f);
+    CORRADE_COMPARE(lanczos[0].pixels<Float>()[1][0][0], 0.515584f);
+    CORRADE_COMPARE(lanczos[1].size(), (Vector3i{1, 1, 1}));
+    CORRADE_COMPARE(lanczos[1].pixels<Float>()[0][0][0], 0.432830f);
+}
+
+void MipmapTest::alphaCoverage() {
+    auto&& data = AlphaCoverageData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Half of the pixels is above the 0.5 reference, after averaging pairs of
+       them only one out of four is */
+    const Color4 pixels[]{
+        {1.0f, 0.6f}, {1.0f, 0.3f},
+        {1.0f, 0.6f}, {1.0f, 0.36f},
+        {1.0f, 0.6f}, {1.0f, 0.2f},
+        {1.0f, 0.9f}, {1.0f, 0.3f}
+    };
+
+    Containers::Array<Image2D> out = generateMipmaps(ImageView2D{PixelFormat::RGBA32F, {8, 1}, pixels}, MipmapFilter::Box, data.preserveAlphaCoverage ? MipmapFlag::PreserveAlphaCoverage : MipmapFlags{}, 0.5f);
+    CORRADE_COMPARE(out.size(), 3);
+
+    std::size_t coverage = 0;
+    for(const Color4& pixel: out[0].pixels<Color4>()[0]) {
+        /* Color channels are never affected */
+        CORRADE_COMPARE(pixel.rgb(), Color3{1.0f});
+        if(pixel.a() > 0.5f) ++coverage;
+    }
+    CORRADE_COMPARE(coverage, data.expectedCoverage);
+}
+
+void MipmapTest::threads() {
+    auto&& data = ThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Pseudorandom data of a size that isn't a power of two */
+    Containers::Array<Color4ub> pixels{NoInit, 67*41};
+    UnsignedInt seed = 1;
+    for(Color4ub& i: pixels) {
+        seed = seed*1103515245u + 12345u;
+        i = {UnsignedByte(seed >> 24), UnsignedByte(seed >> 16), UnsignedByte(seed >> 8), UnsignedByte(seed)};
+    }
+    ImageView2D image{PixelFormat::RGBA8Srgb, {67, 41}, pixels};
+
+    /* The output should be the same regardless of the thread count */
+    Containers::Array<Image2D> expected = generateMipmaps(image, data.filter, MipmapFlag::PreserveAlphaCoverage, 0.5f, 1);
+    Containers::Array<Image2D> actual = generateMipmaps(image, data.filter, MipmapFlag::PreserveAlphaCoverage, 0.5f, data.threadCount);
+    CORRADE_COMPARE(actual.size(), expected.size());
+    for(std::size_t i = 0; i != actual.size(); ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(actual[i].size(), expected[i].size());
+        CORRADE_COMPARE_AS(actual[i].data(), expected[i].data(),
+            TestSuite::Compare::Container);
+    }
+}
+
+void MipmapTest::invalidFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateMipmaps(ImageView2D{PixelFormat::RGBA16Unorm, {4, 4}});
+    generateMipmaps(ImageView3D{PixelFormat::RG8Snorm, {4, 4, 4}});
+    CORRADE_COMPARE(out,
+        "TextureTools::generateMipmaps(): unsupported format PixelFormat::RGBA16Unorm\n"
+        "TextureTools::generateMipmaps(): unsupported format PixelFormat::RG8Snorm\n");
+}
+
+void MipmapTest::alphaCoverageNotFourComponent() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateMipmaps(ImageView2D{PixelFormat::RGB8Unorm, {4, 4}}, MipmapFilter::Box, MipmapFlag::PreserveAlphaCoverage);
+    generateMipmaps(ImageView3D{PixelFormat::RG32F, {4, 4, 4}}, MipmapFilter::Box, MipmapFlag::PreserveAlphaCoverage);
+    CORRADE_COMPARE(out,
+        "TextureTools::generateMipmaps(): alpha coverage preservation expects a four-component format but got PixelFormat::RGB8Unorm\n"
+        "TextureTools::generateMipmaps(): alpha coverage preservation expects a four-component format but got PixelFormat::RG32F\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::MipmapTest)
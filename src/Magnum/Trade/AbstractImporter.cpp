@@ -26,21 +26,27 @@
 
 #include "AbstractImporter.h"
 
+#include <algorithm>
 #include <string> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/PluginManager/Manager.hpp>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/FileCallback.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/PackingBatch.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -186,6 +192,13 @@ void AbstractImporter::clearFlags(ImporterFlags flags) {
     setFlags(_flags & ~flags);
 }
 
+void AbstractImporter::setArena(DataArena* const arena) {
+    _arena = arena;
+    doSetArena(arena);
+}
+
+void AbstractImporter::doSetArena(DataArena*) {}
+
 void AbstractImporter::setFileCallback(Containers::Optional<Containers::ArrayView<const char>>(*callback)(const std::string&, InputFileCallbackPolicy, void*), void* const userData) {
     CORRADE_ASSERT(!isOpened(), "Trade::AbstractImporter::setFileCallback(): can't be set while a file is opened", );
     CORRADE_ASSERT(features() & (ImporterFeature::FileCallback|ImporterFeature::OpenData), "Trade::AbstractImporter::setFileCallback(): importer supports neither loading from data nor via callbacks, callbacks can't be used", );
@@ -1214,6 +1227,144 @@ Containers::Optional<MeshData> AbstractImporter::mesh(const Containers::StringVi
     return mesh(id, level); /* not doMesh(), so we get the checks also */
 }
 
+bool AbstractImporter::meshChunks(const UnsignedInt id, const UnsignedInt level, const std::size_t maxChunkSize, bool(*const callback)(MeshData&&, void*), void* const userData) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::meshChunks(): no file opened", {});
+    CORRADE_ASSERT(id < doMeshCount(), "Trade::AbstractImporter::meshChunks(): index" << id << "out of range for" << doMeshCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in mesh(), check for the range only if requested level is
+       nonzero */
+    if(level) {
+        const UnsignedInt levelCount = doMeshLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::meshChunks(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::meshChunks(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    CORRADE_ASSERT(maxChunkSize,
+        "Trade::AbstractImporter::meshChunks(): expected a non-zero chunk size", {});
+
+    /* Wrap the callback to perform the same custom deleter checks as mesh()
+       does for every chunk */
+    #ifndef CORRADE_NO_ASSERT
+    struct Wrapper {
+        bool(*callback)(MeshData&&, void*);
+        void* userData;
+    } wrapper{callback, userData};
+    return doMeshChunks(id, level, maxChunkSize, [](MeshData&& chunk, void* const userData) {
+        CORRADE_ASSERT(
+            (!chunk._indexData.deleter() || chunk._indexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || chunk._indexData.deleter() == ArrayAllocator<char>::deleter) &&
+            (!chunk._vertexData.deleter() || chunk._vertexData.deleter() == static_cast<void(*)(char*, std::size_t)>(Implementation::nonOwnedArrayDeleter) || chunk._vertexData.deleter() == ArrayAllocator<char>::deleter) &&
+            (!chunk._attributes.deleter() || chunk._attributes.deleter() == static_cast<void(*)(MeshAttributeData*, std::size_t)>(Implementation::nonOwnedArrayDeleter)),
+            "Trade::AbstractImporter::meshChunks(): implementation is not allowed to use a custom Array deleter", false);
+        const Wrapper& wrapper = *static_cast<const Wrapper*>(userData);
+        return wrapper.callback(Utility::move(chunk), wrapper.userData);
+    }, &wrapper);
+    #else
+    return doMeshChunks(id, level, maxChunkSize, callback, userData);
+    #endif
+}
+
+namespace {
+
+/* Count of indices or vertices forming a single primitive, at which a mesh
+   can be split. Zero if a mesh with given primitive can't be split. */
+UnsignedInt meshPrimitiveSplitSize(const MeshPrimitive primitive) {
+    if(primitive == MeshPrimitive::Points) return 1;
+    if(primitive == MeshPrimitive::Lines) return 2;
+    if(primitive == MeshPrimitive::Triangles) return 3;
+    return 0;
+}
+
+}
+
+bool AbstractImporter::doMeshChunks(const UnsignedInt id, const UnsignedInt level, const std::size_t maxChunkSize, bool(*const callback)(MeshData&&, void*), void* const userData) {
+    Containers::Optional<MeshData> mesh = doMesh(id, level);
+    if(!mesh) return false;
+
+    /* Calculate total size of a single vertex. The chunks have all
+       attributes interleaved, which means the vertex size has to fit into
+       the stride limit. */
+    const UnsignedInt primitiveSize = meshPrimitiveSplitSize(mesh->primitive());
+    bool splittable = primitiveSize && !(mesh->isIndexed() && isMeshIndexTypeImplementationSpecific(mesh->indexType()));
+    std::size_t vertexSize = 0;
+    for(UnsignedInt i = 0; splittable && i != mesh->attributeCount(); ++i) {
+        const VertexFormat format = mesh->attributeFormat(i);
+        if(isVertexFormatImplementationSpecific(format))
+            splittable = false;
+        else
+            vertexSize += vertexFormatSize(format)*Math::max(mesh->attributeArraySize(i), UnsignedShort{1});
+    }
+
+    /* Pass the mesh through if it can't be split or if it fits already */
+    if(!splittable || !vertexSize || vertexSize > 32767 ||
+       mesh->indexData().size() + mesh->vertexData().size() <= maxChunkSize)
+        return callback(Utility::move(*mesh), userData);
+
+    /* Element count per chunk, rounded down to whole primitives. In the worst
+       case each index references a different vertex. */
+    const bool indexed = mesh->isIndexed();
+    const std::size_t count = indexed ? mesh->indexCount() : mesh->vertexCount();
+    const std::size_t elementSize = indexed ? vertexSize + sizeof(UnsignedInt) : vertexSize;
+    const std::size_t chunkElementCount = Math::max(maxChunkSize/elementSize/primitiveSize, std::size_t{1})*primitiveSize;
+
+    for(std::size_t begin = 0; begin < count; begin += chunkElementCount) {
+        const std::size_t size = Math::min(chunkElementCount, count - begin);
+
+        /* For an indexed mesh, gather unique vertices referenced by the chunk
+           and remap the indices to them */
+        Containers::Array<char> indexData;
+        Containers::Array<UnsignedInt> vertices;
+        std::size_t vertexCount = size;
+        if(indexed) {
+            indexData = Containers::Array<char>{NoInit, size*sizeof(UnsignedInt)};
+            const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+            const Containers::StridedArrayView2D<const char> indexView = mesh->indices().sliceSize(begin, size);
+            const MeshIndexType indexType = mesh->indexType();
+            if(indexType == MeshIndexType::UnsignedInt)
+                Utility::copy(Containers::arrayCast<1, const UnsignedInt>(indexView), Containers::stridedArrayView(indices));
+            else if(indexType == MeshIndexType::UnsignedShort)
+                Math::castInto(Containers::arrayCast<2, const UnsignedShort>(indexView), Containers::arrayCast<2, UnsignedInt>(Containers::stridedArrayView(indices)));
+            else if(indexType == MeshIndexType::UnsignedByte)
+                Math::castInto(Containers::arrayCast<2, const UnsignedByte>(indexView), Containers::arrayCast<2, UnsignedInt>(Containers::stridedArrayView(indices)));
+            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+            vertices = Containers::Array<UnsignedInt>{NoInit, size};
+            Utility::copy(indices, vertices);
+            std::sort(vertices.begin(), vertices.end());
+            vertexCount = std::size_t(std::unique(vertices.begin(), vertices.end()) - vertices.begin());
+            for(UnsignedInt& index: indices)
+                index = UnsignedInt(std::lower_bound(vertices.begin(), vertices.begin() + vertexCount, index) - vertices.begin());
+        }
+
+        /* Copy the attributes to an interleaved vertex buffer */
+        Containers::Array<char> vertexData{NoInit, vertexCount*vertexSize};
+        Containers::Array<MeshAttributeData> attributes{ValueInit, mesh->attributeCount()};
+        std::size_t offset = 0;
+        for(UnsignedInt i = 0; i != mesh->attributeCount(); ++i) {
+            const Containers::StridedArrayView2D<const char> src = mesh->attribute(i);
+            const std::size_t attributeSize = src.size()[1];
+            const Containers::StridedArrayView2D<char> dst{vertexData, vertexData.data() + offset, {vertexCount, attributeSize}, {std::ptrdiff_t(vertexSize), 1}};
+            if(indexed) for(std::size_t j = 0; j != vertexCount; ++j)
+                Utility::copy(src[vertices[j]], dst[j]);
+            else Utility::copy(src.sliceSize(begin, size), dst);
+
+            attributes[i] = MeshAttributeData{mesh->attributeName(i), mesh->attributeFormat(i), offset, UnsignedInt(vertexCount), std::ptrdiff_t(vertexSize), mesh->attributeArraySize(i), mesh->attributeMorphTargetId(i)};
+            offset += attributeSize;
+        }
+
+        /* If the mesh isn't indexed, indexData is empty and so is the chunk */
+        const MeshIndexData indices = indexed ?
+            MeshIndexData{Containers::arrayCast<const UnsignedInt>(indexData)} :
+            MeshIndexData{};
+        if(!callback(MeshData{mesh->primitive(),
+            Utility::move(indexData), indices,
+            Utility::move(vertexData), Utility::move(attributes),
+            UnsignedInt(vertexCount), mesh->importerState()}, userData))
+            return false;
+    }
+
+    return true;
+}
+
 MeshAttribute AbstractImporter::meshAttributeForName(const Containers::StringView name) {
     const MeshAttribute out = doMeshAttributeForName(name);
     CORRADE_ASSERT(out == MeshAttribute{} || isMeshAttributeCustom(out),
@@ -1518,6 +1669,28 @@ Containers::Optional<ImageData1D> AbstractImporter::image1D(const Containers::St
     return image1D(id, level);
 }
 
+Containers::Optional<ImageProperties1D> AbstractImporter::image1DProperties(const UnsignedInt id, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image1DProperties(): no file opened", {});
+    CORRADE_ASSERT(id < doImage1DCount(), "Trade::AbstractImporter::image1DProperties(): index" << id << "out of range for" << doImage1DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image1D(), checking the range only for a nonzero level */
+    if(level) {
+        const UnsignedInt levelCount = doImage1DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image1DProperties(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image1DProperties(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    return doImage1DProperties(id, level);
+}
+
+Containers::Optional<ImageProperties1D> AbstractImporter::doImage1DProperties(const UnsignedInt id, const UnsignedInt level) {
+    /* Not going through image1D() as the checks were already done in
+       image1DProperties() */
+    const Containers::Optional<ImageData1D> image = doImage1D(id, level);
+    if(!image) return {};
+    return ImageProperties1D{*image};
+}
+
 UnsignedInt AbstractImporter::image2DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DCount(): no file opened", {});
     return doImage2DCount();
@@ -1591,6 +1764,28 @@ Containers::Optional<ImageData2D> AbstractImporter::image2D(const Containers::St
     return image2D(id, level);
 }
 
+Containers::Optional<ImageProperties2D> AbstractImporter::image2DProperties(const UnsignedInt id, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image2DProperties(): no file opened", {});
+    CORRADE_ASSERT(id < doImage2DCount(), "Trade::AbstractImporter::image2DProperties(): index" << id << "out of range for" << doImage2DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image2D(), checking the range only for a nonzero level */
+    if(level) {
+        const UnsignedInt levelCount = doImage2DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image2DProperties(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image2DProperties(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    return doImage2DProperties(id, level);
+}
+
+Containers::Optional<ImageProperties2D> AbstractImporter::doImage2DProperties(const UnsignedInt id, const UnsignedInt level) {
+    /* Not going through image2D() as the checks were already done in
+       image2DProperties() */
+    const Containers::Optional<ImageData2D> image = doImage2D(id, level);
+    if(!image) return {};
+    return ImageProperties2D{*image};
+}
+
 UnsignedInt AbstractImporter::image3DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DCount(): no file opened", {});
     return doImage3DCount();
@@ -1664,6 +1859,28 @@ Containers::Optional<ImageData3D> AbstractImporter::image3D(const Containers::St
     return image3D(id, level);
 }
 
+Containers::Optional<ImageProperties3D> AbstractImporter::image3DProperties(const UnsignedInt id, const UnsignedInt level) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DProperties(): no file opened", {});
+    CORRADE_ASSERT(id < doImage3DCount(), "Trade::AbstractImporter::image3DProperties(): index" << id << "out of range for" << doImage3DCount() << "entries", {});
+    #ifndef CORRADE_NO_ASSERT
+    /* Same as in image3D(), checking the range only for a nonzero level */
+    if(level) {
+        const UnsignedInt levelCount = doImage3DLevelCount(id);
+        CORRADE_ASSERT(levelCount, "Trade::AbstractImporter::image3DProperties(): implementation reported zero levels", {});
+        CORRADE_ASSERT(level < levelCount, "Trade::AbstractImporter::image3DProperties(): level" << level << "out of range for" << levelCount << "entries", {});
+    }
+    #endif
+    return doImage3DProperties(id, level);
+}
+
+Containers::Optional<ImageProperties3D> AbstractImporter::doImage3DProperties(const UnsignedInt id, const UnsignedInt level) {
+    /* Not going through image3D() as the checks were already done in
+       image3DProperties() */
+    const Containers::Optional<ImageData3D> image = doImage3D(id, level);
+    if(!image) return {};
+    return ImageProperties3D{*image};
+}
+
 const void* AbstractImporter::importerState() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::importerState(): no file opened", {});
     return doImporterState();
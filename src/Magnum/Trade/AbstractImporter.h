@@ -324,6 +324,40 @@ name doesn't exist.
 -   Texture names using @ref textureName() & @ref textureForName(), imported
     with @ref texture(Containers::StringView)
 
+@subsection Trade-AbstractImporter-usage-chunks Importing large meshes in chunks
+
+Meshes that are too large to be processed at once can be imported with
+@ref meshChunks(), which passes them to a callback in self-contained chunks
+of a bounded size. How much memory the importer itself needs depends on the
+implementation --- by default the whole mesh is imported first and only then
+split, and for example @ref ObjImporter keeps all vertex data of the mesh in
+memory, bounding only the index data. Chunks can be then processed one by one with MeshTools
+algorithms that don't need to see the whole mesh, such as
+@ref MeshTools::transform3D(). Algorithms that do need global information
+can be done in two passes --- below, bounds of the whole mesh are calculated
+by combining @ref MeshTools::boundingRange() of all chunks with
+@ref Math::join() first, and then all chunks are quantized to the same range
+with @ref MeshTools::quantizePositions():
+
+@snippet Trade.cpp AbstractImporter-usage-chunks
+
+Combined with @ref Utility::Path::mapRead() and @ref openMemory(), the file
+itself isn't loaded into memory, and only the chunks get allocated.
+
+@subsection Trade-AbstractImporter-usage-probing Querying image properties
+
+If only image size or format is needed, such as when building an inventory of
+a large amount of files, @ref image1DProperties(), @ref image2DProperties() and
+@ref image3DProperties() return an @ref ImageProperties instance instead of the
+whole image. Importers that implement them parse just the file header, without
+decoding any pixel data; for others the image gets imported and the pixel data
+discarded. In particular, @ref AnyImageImporter "AnyImageImporter" has a
+@cb{.ini} probe @ce option, with which it recognizes sizes and formats of
+common file formats directly, and instantiates the concrete plugin only once
+actual image data are requested:
+
+@snippet Trade.cpp AbstractImporter-usage-probing
+
 @subsection Trade-AbstractImporter-usage-state Internal importer state
 
 Some importers, especially ones that make use of well-known external libraries,
@@ -547,6 +581,45 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         void clearFlags(ImporterFlags flags);
 
+        /**
+         * @brief Data arena
+         * @m_since_latest
+         *
+         * Arena set with @ref setArena() or @cpp nullptr @ce if none is set.
+         * An implementation can use @ref DataArena::allocate() on it to
+         * place data of returned instances into the arena and pass them to
+         * the @ref MeshData, @ref ImageData or @ref MaterialData constructors
+         * taking @ref DataFlags with @ref DataFlag::ExternallyOwned and
+         * @ref DataFlag::Mutable set. If @cpp nullptr @ce, the data are
+         * expected to be allocated as usual. See @ref Trade-DataArena-usage
+         * for an example.
+         * @see @ref setArena()
+         */
+        DataArena* arena() const { return _arena; }
+
+        /**
+         * @brief Set data arena
+         * @m_since_latest
+         *
+         * Makes @p arena available to the implementation through
+         * @ref arena(). Implementations that support it allocate index,
+         * vertex, image or material data of returned instances directly from
+         * the arena instead of from the heap and mark them with
+         * @ref DataFlag::ExternallyOwned. Such data then stay valid until the
+         * arena is destroyed or @ref DataArena::reset() is called, which
+         * frees all of them at once. Implementations that don't support it
+         * ignore the arena and return data with their usual flags, the
+         * importer never copies data to the arena on its own. See
+         * documentation of a particular importer for more information.
+         *
+         * The arena isn't owned by the importer and is expected to stay in
+         * scope for as long as it's set. Passing @cpp nullptr @ce resets the
+         * behavior back to the default. Can be called both before and after
+         * a file is opened.
+         * @see @ref Trade-DataArena-usage
+         */
+        void setArena(DataArena* arena);
+
         /**
          * @brief File opening callback function
          *
@@ -1349,6 +1422,62 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<MeshData> mesh(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Import a mesh in chunks
+         * @param id            Mesh ID, from range [0, @ref meshCount()).
+         * @param level         Mesh level, from range
+         *      [0, @ref meshLevelCount())
+         * @param maxChunkSize  Maximal size of index and vertex data of a
+         *      single chunk in bytes
+         * @param callback      Function called for each chunk
+         * @param userData      User data passed to @p callback
+         * @m_since_latest
+         *
+         * Instead of returning the whole mesh at once like @ref mesh(),
+         * passes it to @p callback in chunks. Each chunk is a self-contained
+         * @ref MeshData with the same primitive and attributes as the whole
+         * mesh would have, split at primitive boundaries and with index and
+         * vertex data not larger than @p maxChunkSize, unless a single
+         * primitive is larger than that. Vertices shared by primitives in
+         * different chunks are duplicated in each of them, concatenating all
+         * chunks with @ref MeshTools::concatenate() results in a mesh
+         * equivalent to what @ref mesh() returns. If @p callback returns
+         * @cpp false @ce, the import is stopped and the function returns
+         * @cpp false @ce as well.
+         *
+         * What the memory use is bounded by depends on the implementation. By
+         * default the mesh is imported with @ref mesh() and then split into
+         * chunks, which is useful for example with importers that return
+         * views on memory passed to @ref openMemory(), such as a
+         * memory-mapped file, in which case only the chunk data are
+         * allocated. Importers that aren't able to split a mesh, such as if
+         * it has a strip, loop or fan primitive or implementation-specific
+         * index or vertex formats, pass the whole mesh to @p callback as a
+         * single chunk. See documentation of a particular importer for more
+         * information.
+         *
+         * On failure prints a message to @relativeref{Magnum,Error} and
+         * returns @cpp false @ce, however @p callback may have been already
+         * called for some chunks. Expects that a file is opened and that
+         * @p maxChunkSize is not zero.
+         * @see @ref Trade-AbstractImporter-usage-chunks
+         */
+        bool meshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&& chunk, void* userData), void* userData = nullptr);
+
+        /**
+         * @brief Import a mesh in chunks
+         * @m_since_latest
+         *
+         * Equivalent to calling the above with a lambda wrapper that casts
+         * @cpp void* @ce back to @cpp T* @ce and dereferences it in order to
+         * pass it to @p callback.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class T> bool meshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&& chunk, T& userData), T& userData);
+        #else
+        template<class Callback, class T> bool meshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, Callback callback, T& userData);
+        #endif
+
         /**
          * @brief Mesh attribute for given name
          * @m_since{2020,06}
@@ -1635,6 +1764,23 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData1D> image1D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief One-dimensional image properties
+         * @param id        Image ID, from range [0, @ref image1DCount()).
+         * @param level     Mip level, from range [0, @ref image1DLevelCount())
+         * @m_since_latest
+         *
+         * Returns format, size and flags of the image without its pixel
+         * data. Importers that can parse this information from the file
+         * header do so without decoding the image, otherwise the image is
+         * imported with @ref image1D() and its pixel data discarded. On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that a file is
+         * opened.
+         * @see @ref Trade-AbstractImporter-usage-probing
+         */
+        Containers::Optional<ImageProperties1D> image1DProperties(UnsignedInt id, UnsignedInt level = 0);
+
         /**
          * @brief Two-dimensional image count
          *
@@ -1699,6 +1845,23 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData2D> image2D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Two-dimensional image properties
+         * @param id        Image ID, from range [0, @ref image2DCount()).
+         * @param level     Mip level, from range [0, @ref image2DLevelCount())
+         * @m_since_latest
+         *
+         * Returns format, size and flags of the image without its pixel
+         * data. Importers that can parse this information from the file
+         * header do so without decoding the image, otherwise the image is
+         * imported with @ref image2D() and its pixel data discarded. On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that a file is
+         * opened.
+         * @see @ref Trade-AbstractImporter-usage-probing
+         */
+        Containers::Optional<ImageProperties2D> image2DProperties(UnsignedInt id, UnsignedInt level = 0);
+
         /**
          * @brief Three-dimensional image count
          *
@@ -1763,6 +1926,23 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         Containers::Optional<ImageData3D> image3D(Containers::StringView name, UnsignedInt level = 0);
 
+        /**
+         * @brief Three-dimensional image properties
+         * @param id        Image ID, from range [0, @ref image3DCount()).
+         * @param level     Mip level, from range [0, @ref image3DLevelCount())
+         * @m_since_latest
+         *
+         * Returns format, size and flags of the image without its pixel
+         * data. Importers that can parse this information from the file
+         * header do so without decoding the image, otherwise the image is
+         * imported with @ref image3D() and its pixel data discarded. On
+         * failure prints a message to @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that a file is
+         * opened.
+         * @see @ref Trade-AbstractImporter-usage-probing
+         */
+        Containers::Optional<ImageProperties3D> image3DProperties(UnsignedInt id, UnsignedInt level = 0);
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -1830,6 +2010,17 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         virtual void doSetFlags(ImporterFlags flags);
 
+        /**
+         * @brief Implementation for @ref setArena()
+         * @m_since_latest
+         *
+         * Useful when the importer needs to propagate the arena further, such
+         * as to a plugin it delegates to. Default implementation does nothing
+         * and this function doesn't need to be implemented --- the arena is
+         * available through @ref arena().
+         */
+        virtual void doSetArena(DataArena* arena);
+
         /**
          * @brief Implementation for @ref setFileCallback()
          *
@@ -2323,6 +2514,20 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         virtual Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref meshChunks()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doMesh() and splits the result
+         * into chunks. An implementation is expected to stop and return
+         * @cpp false @ce as soon as @p callback returns @cpp false @ce. The
+         * same restrictions on custom @relativeref{Corrade,Containers::Array}
+         * deleters as in @ref doMesh() apply to the chunks. The chunks
+         * shouldn't be allocated from @ref arena(), as that would defeat the
+         * purpose of bounding the memory use.
+         */
+        virtual bool doMeshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&& chunk, void* userData), void* userData);
+
         /**
          * @brief Implementation for @ref meshAttributeForName()
          * @m_since{2020,06}
@@ -2543,6 +2748,16 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image1D() */
         virtual Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref image1DProperties()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doImage1D() and returns
+         * properties of the imported image. Implement to provide the
+         * information without decoding the whole image.
+         */
+        virtual Containers::Optional<ImageProperties1D> doImage1DProperties(UnsignedInt id, UnsignedInt level);
+
         /**
          * @brief Implementation for @ref image2DCount()
          *
@@ -2587,6 +2802,16 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image2D() */
         virtual Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref image2DProperties()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doImage2D() and returns
+         * properties of the imported image. Implement to provide the
+         * information without decoding the whole image.
+         */
+        virtual Containers::Optional<ImageProperties2D> doImage2DProperties(UnsignedInt id, UnsignedInt level);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
@@ -2623,11 +2848,23 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Implementation for @ref image3D() */
         virtual Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level);
 
+        /**
+         * @brief Implementation for @ref image3DProperties()
+         * @m_since_latest
+         *
+         * Default implementation calls @ref doImage3D() and returns
+         * properties of the imported image. Implement to provide the
+         * information without decoding the whole image.
+         */
+        virtual Containers::Optional<ImageProperties3D> doImage3DProperties(UnsignedInt id, UnsignedInt level);
+
         /** @brief Implementation for @ref importerState() */
         virtual const void* doImporterState() const;
 
         ImporterFlags _flags;
 
+        DataArena* _arena{};
+
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
 
@@ -2673,7 +2910,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImporter/0.5.3"
+"cz.mosra.magnum.Trade.AbstractImporter/0.5.5"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -2701,6 +2938,19 @@ template<class Callback, class T> void AbstractImporter::setFileCallback(Callbac
         return reinterpret_cast<Containers::Optional<Containers::ArrayView<const char>>(*)(const std::string&, InputFileCallbackPolicy, T&)>(s.callback)(filename, flags, *static_cast<T*>(const_cast<void*>(s.userData)));
     }, &_fileCallbackTemplate);
 }
+
+template<class Callback, class T> bool AbstractImporter::meshChunks(const UnsignedInt id, const UnsignedInt level, const std::size_t maxChunkSize, Callback callback, T& userData) {
+    /* Unlike with setFileCallback(), the callback is needed only for the
+       duration of this call, so it can be stored on stack */
+    struct Wrapper {
+        bool(*callback)(MeshData&&, T&);
+        T& userData;
+    } wrapper{callback, userData};
+    return meshChunks(id, level, maxChunkSize, [](MeshData&& chunk, void* const userData) {
+        Wrapper& wrapper = *static_cast<Wrapper*>(userData);
+        return wrapper.callback(static_cast<MeshData&&>(chunk), wrapper.userData);
+    }, &wrapper);
+}
 #endif
 
 }}
@@ -0,0 +1,583 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncImporter.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+/* Emscripten has std::thread only if built with -pthread, everything else
+   we support has it always */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+#include <thread>
+#endif
+
+namespace Magnum { namespace Trade {
+
+Debug& operator<<(Debug& debug, const AsyncImporterJobState value) {
+    debug << "Trade::AsyncImporterJobState" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case AsyncImporterJobState::v: return debug << "::" #v;
+        _c(Pending)
+        _c(Running)
+        _c(Finished)
+        _c(Failed)
+        _c(Cancelled)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+enum class JobType: UnsignedByte {
+    Scene,
+    Mesh,
+    Material,
+    Image1D,
+    Image2D,
+    Image3D
+};
+
+struct Result {
+    Containers::Optional<SceneData> scene;
+    Containers::Optional<MeshData> mesh;
+    Containers::Optional<MaterialData> material;
+    Containers::Optional<ImageData1D> image1D;
+    Containers::Optional<ImageData2D> image2D;
+    Containers::Optional<ImageData3D> image3D;
+};
+
+struct Job {
+    JobType type;
+    AsyncImporterJobState state;
+    UnsignedInt id;
+    UnsignedInt level;
+    Result result;
+};
+
+struct QueueItem {
+    Int priority;
+    UnsignedInt job;
+};
+
+/* std::pop_heap() gives back the largest item, so the job with the highest
+   priority and the lowest ID among jobs of the same priority */
+bool queueOrder(const QueueItem& a, const QueueItem& b) {
+    return a.priority < b.priority || (a.priority == b.priority && a.job > b.job);
+}
+
+}
+
+struct AsyncImporter::State {
+    explicit State(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers);
+    ~State();
+
+    void worker(UnsignedInt importer);
+    void runNext(AbstractImporter& importer, std::unique_lock<std::mutex>& lock);
+    void wait(UnsignedInt job, std::unique_lock<std::mutex>& lock);
+    void closeInternal();
+    UnsignedInt load(JobType type, UnsignedInt id, UnsignedInt level, Int priority);
+    template<class T> Containers::Optional<T> take(const char* messagePrefix, const char* typeName, UnsignedInt job, JobType type, Containers::Optional<T> Result::*member);
+
+    static Containers::Optional<Containers::ArrayView<const char>> fileCallback(const std::string& filename, InputFileCallbackPolicy, void* state);
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    #ifdef MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+    Containers::Array<std::thread> threads;
+    #endif
+
+    /* Everything below is guarded by the mutex */
+    mutable std::mutex mutex;
+    /* Signaled when a job gets queued or the threads should quit */
+    std::condition_variable queueCondition;
+    /* Signaled when a job finishes */
+    std::condition_variable doneCondition;
+    Containers::Array<Job> jobs;
+    Containers::Array<QueueItem> queue;
+    UnsignedInt runningCount = 0;
+    bool quit = false;
+
+    /* Guarded by a separate mutex as it's accessed from importer instances
+       while they run jobs */
+    std::mutex fileMutex;
+    std::unordered_map<std::string, Containers::Array<char>> files;
+
+    /* Data passed to openData(), referenced by all instances */
+    Containers::Array<char> data;
+};
+
+AsyncImporter::State::State(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers_): importers{Utility::move(importers_)} {
+    #ifdef MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+    threads = Containers::Array<std::thread>{importers.size() - 1};
+    for(std::size_t i = 0; i != threads.size(); ++i)
+        threads[i] = std::thread{&State::worker, this, UnsignedInt(i + 1)};
+    #endif
+}
+
+AsyncImporter::State::~State() {
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        for(const QueueItem& item: queue)
+            jobs[item.job].state = AsyncImporterJobState::Cancelled;
+        arrayClear(queue);
+        quit = true;
+    }
+    queueCondition.notify_all();
+
+    #ifdef MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+    for(std::thread& thread: threads) thread.join();
+    #endif
+
+    /* Close the importers while the data and files they may reference are
+       still alive */
+    for(Containers::Pointer<AbstractImporter>& importer: importers)
+        importer->close();
+}
+
+void AsyncImporter::State::worker(const UnsignedInt importer) {
+    std::unique_lock<std::mutex> lock{mutex};
+    for(;;) {
+        queueCondition.wait(lock, [this]() { return quit || !queue.isEmpty(); });
+        if(quit) return;
+        runNext(*importers[importer], lock);
+    }
+}
+
+void AsyncImporter::State::runNext(AbstractImporter& importer, std::unique_lock<std::mutex>& lock) {
+    CORRADE_INTERNAL_DEBUG_ASSERT(!queue.isEmpty());
+
+    std::pop_heap(queue.begin(), queue.end(), queueOrder);
+    const UnsignedInt jobId = queue.back().job;
+    arrayRemoveSuffix(queue, 1);
+
+    /* Cancelled jobs are left in the queue and skipped only once they get to
+       the top, to avoid having to search for them in the heap */
+    Job& job = jobs[jobId];
+    if(job.state == AsyncImporterJobState::Cancelled)
+        return;
+
+    job.state = AsyncImporterJobState::Running;
+    const JobType type = job.type;
+    const UnsignedInt id = job.id;
+    const UnsignedInt level = job.level;
+    ++runningCount;
+
+    /* Import without holding the lock. The job array can get reallocated in
+       the meantime if more jobs are queued, so the result is put into a
+       temporary and moved into the job only once the lock is acquired
+       again. */
+    lock.unlock();
+    Result result;
+    bool succeeded{};
+    switch(type) {
+        case JobType::Scene:
+            succeeded = !!(result.scene = importer.scene(id));
+            break;
+        case JobType::Mesh:
+            succeeded = !!(result.mesh = importer.mesh(id, level));
+            break;
+        case JobType::Material:
+            succeeded = !!(result.material = importer.material(id));
+            break;
+        case JobType::Image1D:
+            succeeded = !!(result.image1D = importer.image1D(id, level));
+            break;
+        case JobType::Image2D:
+            succeeded = !!(result.image2D = importer.image2D(id, level));
+            break;
+        case JobType::Image3D:
+            succeeded = !!(result.image3D = importer.image3D(id, level));
+            break;
+    }
+    lock.lock();
+
+    Job& finishedJob = jobs[jobId];
+    finishedJob.result = Utility::move(result);
+    finishedJob.state = succeeded ? AsyncImporterJobState::Finished : AsyncImporterJobState::Failed;
+    --runningCount;
+    doneCondition.notify_all();
+}
+
+void AsyncImporter::State::wait(const UnsignedInt job, std::unique_lock<std::mutex>& lock) {
+    for(;;) {
+        const AsyncImporterJobState state = jobs[job].state;
+        if(state != AsyncImporterJobState::Pending &&
+           state != AsyncImporterJobState::Running)
+            return;
+
+        /* Help with the queued jobs while the job waits to be picked up, but
+           not once it's running on another thread, as then we'd only delay
+           the return */
+        if(state == AsyncImporterJobState::Pending && !queue.isEmpty())
+            runNext(*importers[0], lock);
+        else doneCondition.wait(lock);
+    }
+}
+
+void AsyncImporter::State::closeInternal() {
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        for(const QueueItem& item: queue)
+            jobs[item.job].state = AsyncImporterJobState::Cancelled;
+        arrayClear(queue);
+        doneCondition.wait(lock, [this]() { return !runningCount; });
+        arrayClear(jobs);
+    }
+
+    for(Containers::Pointer<AbstractImporter>& importer: importers)
+        importer->close();
+
+    /* Nothing else can access these anymore, no need to lock */
+    files.clear();
+    data = nullptr;
+}
+
+UnsignedInt AsyncImporter::State::load(const JobType type, const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    UnsignedInt jobId;
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        jobId = jobs.size();
+        Job& job = arrayAppend(jobs, InPlaceInit);
+        job.type = type;
+        job.state = AsyncImporterJobState::Pending;
+        job.id = id;
+        job.level = level;
+        arrayAppend(queue, QueueItem{priority, jobId});
+        std::push_heap(queue.begin(), queue.end(), queueOrder);
+    }
+    queueCondition.notify_one();
+
+    return jobId;
+}
+
+template<class T> Containers::Optional<T> AsyncImporter::State::take(const char* const messagePrefix, const char* const typeName, const UnsignedInt job, const JobType type, Containers::Optional<T> Result::*const member) {
+    std::unique_lock<std::mutex> lock{mutex};
+    CORRADE_ASSERT(job < jobs.size(),
+        messagePrefix << "index" << job << "out of range for" << jobs.size() << "jobs", {});
+    CORRADE_ASSERT(jobs[job].type == type,
+        messagePrefix << "job" << job << "is not a" << typeName << "job", {});
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(messagePrefix);
+    static_cast<void>(typeName);
+    static_cast<void>(type);
+    #endif
+
+    wait(job, lock);
+    return Utility::move(jobs[job].result.*member);
+}
+
+Containers::Optional<Containers::ArrayView<const char>> AsyncImporter::State::fileCallback(const std::string& filename, InputFileCallbackPolicy, void* const state) {
+    State& s = *static_cast<State*>(state);
+
+    /* The lock is held while reading the file so concurrent requests for
+       the same file don't read it twice. Files are kept in memory until the
+       importer is closed, so close requests are ignored. */
+    std::unique_lock<std::mutex> lock{s.fileMutex};
+    auto found = s.files.find(filename);
+    if(found == s.files.end()) {
+        Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+        if(!data) return {};
+        found = s.files.emplace(filename, *Utility::move(data)).first;
+    }
+    return Containers::ArrayView<const char>{found->second};
+}
+
+namespace {
+
+Containers::Array<Containers::Pointer<AbstractImporter>> instantiateImporters(PluginManager::Manager<AbstractImporter>& manager, const Containers::StringView plugin, UnsignedInt threadCount) {
+    CORRADE_ASSERT(manager.loadState(plugin) & PluginManager::LoadState::Loaded,
+        "Trade::AsyncImporter: plugin" << plugin << "is not loaded, use tryCreate() to load it", {});
+
+    #ifdef MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+    if(!threadCount) {
+        threadCount = std::thread::hardware_concurrency();
+        /* The function is allowed to return 0 if it cannot detect */
+        if(!threadCount) threadCount = 1;
+    }
+    #else
+    threadCount = 1;
+    #endif
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers{threadCount};
+    for(Containers::Pointer<AbstractImporter>& importer: importers)
+        importer = manager.instantiate(plugin);
+    return importers;
+}
+
+}
+
+Containers::Optional<AsyncImporter> AsyncImporter::tryCreate(PluginManager::Manager<AbstractImporter>& manager, const Containers::StringView plugin, const UnsignedInt threadCount) {
+    /* The manager prints a message on its own if loading fails */
+    if(!(manager.load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error{} << "Trade::AsyncImporter::tryCreate(): can't load plugin" << plugin;
+        return {};
+    }
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers = instantiateImporters(manager, plugin, threadCount);
+    for(const Containers::Pointer<AbstractImporter>& importer: importers) if(!importer) {
+        Error{} << "Trade::AsyncImporter::tryCreate(): can't instantiate plugin" << plugin;
+        return {};
+    }
+
+    return AsyncImporter{Utility::move(importers)};
+}
+
+AsyncImporter::AsyncImporter(PluginManager::Manager<AbstractImporter>& manager, const Containers::StringView plugin, const UnsignedInt threadCount): AsyncImporter{instantiateImporters(manager, plugin, threadCount)} {}
+
+AsyncImporter::AsyncImporter(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers) {
+    CORRADE_ASSERT(!importers.isEmpty(),
+        "Trade::AsyncImporter: expected at least one importer instance", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != importers.size(); ++i) {
+        CORRADE_ASSERT(importers[i],
+            "Trade::AsyncImporter: importer" << i << "is null", );
+        CORRADE_ASSERT(!importers[i]->isOpened(),
+            "Trade::AsyncImporter: importer" << i << "is already opened", );
+    }
+    #endif
+
+    /* Without threads there's no point in keeping the other instances */
+    #ifndef MAGNUM_TRADE_ASYNCIMPORTER_THREADS
+    arrayRemoveSuffix(importers, importers.size() - 1);
+    #endif
+
+    _state.emplace(Utility::move(importers));
+}
+
+AsyncImporter::AsyncImporter(AsyncImporter&&) noexcept = default;
+
+AsyncImporter::~AsyncImporter() = default;
+
+AsyncImporter& AsyncImporter::operator=(AsyncImporter&&) noexcept = default;
+
+UnsignedInt AsyncImporter::threadCount() const {
+    return _state->importers.size();
+}
+
+AbstractImporter& AsyncImporter::importer() {
+    return *_state->importers[0];
+}
+
+bool AsyncImporter::isOpened() const {
+    return _state->importers[0]->isOpened();
+}
+
+bool AsyncImporter::openFile(const Containers::StringView filename) {
+    close();
+
+    AbstractImporter& first = *_state->importers[0];
+
+    /* Use a caching file callback, unless the user supplied their own or the
+       plugin supports neither callbacks nor loading from data */
+    auto callback = first.fileCallback();
+    void* callbackUserData = first.fileCallbackUserData();
+    if((!callback || callback == State::fileCallback) &&
+       (first.features() & (ImporterFeature::FileCallback|ImporterFeature::OpenData))) {
+        callback = State::fileCallback;
+        callbackUserData = _state.get();
+    }
+
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers) {
+        if(importer.get() != &first) {
+            importer->setFlags(first.flags());
+            importer->configuration() = first.configuration();
+        }
+        if(callback)
+            importer->setFileCallback(callback, callbackUserData);
+        if(!importer->openFile(filename)) {
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool AsyncImporter::openData(const Containers::ArrayView<const void> data) {
+    AbstractImporter& first = *_state->importers[0];
+    CORRADE_ASSERT(first.features() & ImporterFeature::OpenData,
+        "Trade::AsyncImporter::openData(): feature not supported", {});
+
+    close();
+
+    /* Copy the data just once, all instances reference the copy */
+    _state->data = Containers::Array<char>{NoInit, data.size()};
+    Utility::copy(Containers::ArrayView<const char>{static_cast<const char*>(data.data()), data.size()}, _state->data);
+
+    for(Containers::Pointer<AbstractImporter>& importer: _state->importers) {
+        if(importer.get() != &first) {
+            importer->setFlags(first.flags());
+            importer->configuration() = first.configuration();
+        }
+        if(!importer->openMemory(_state->data)) {
+            close();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void AsyncImporter::close() {
+    _state->closeInternal();
+}
+
+UnsignedInt AsyncImporter::jobCount() const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    return _state->jobs.size();
+}
+
+UnsignedInt AsyncImporter::loadScene(const UnsignedInt id, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadScene(): no file opened", {});
+    CORRADE_ASSERT(id < importer().sceneCount(),
+        "Trade::AsyncImporter::loadScene(): index" << id << "out of range for" << importer().sceneCount() << "entries", {});
+    return _state->load(JobType::Scene, id, 0, priority);
+}
+
+UnsignedInt AsyncImporter::loadMesh(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadMesh(): no file opened", {});
+    CORRADE_ASSERT(id < importer().meshCount(),
+        "Trade::AsyncImporter::loadMesh(): index" << id << "out of range for" << importer().meshCount() << "entries", {});
+    CORRADE_ASSERT(!level || level < importer().meshLevelCount(id),
+        "Trade::AsyncImporter::loadMesh(): level" << level << "out of range for" << importer().meshLevelCount(id) << "entries", {});
+    return _state->load(JobType::Mesh, id, level, priority);
+}
+
+UnsignedInt AsyncImporter::loadMaterial(const UnsignedInt id, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadMaterial(): no file opened", {});
+    CORRADE_ASSERT(id < importer().materialCount(),
+        "Trade::AsyncImporter::loadMaterial(): index" << id << "out of range for" << importer().materialCount() << "entries", {});
+    return _state->load(JobType::Material, id, 0, priority);
+}
+
+UnsignedInt AsyncImporter::loadImage1D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadImage1D(): no file opened", {});
+    CORRADE_ASSERT(id < importer().image1DCount(),
+        "Trade::AsyncImporter::loadImage1D(): index" << id << "out of range for" << importer().image1DCount() << "entries", {});
+    CORRADE_ASSERT(!level || level < importer().image1DLevelCount(id),
+        "Trade::AsyncImporter::loadImage1D(): level" << level << "out of range for" << importer().image1DLevelCount(id) << "entries", {});
+    return _state->load(JobType::Image1D, id, level, priority);
+}
+
+UnsignedInt AsyncImporter::loadImage2D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadImage2D(): no file opened", {});
+    CORRADE_ASSERT(id < importer().image2DCount(),
+        "Trade::AsyncImporter::loadImage2D(): index" << id << "out of range for" << importer().image2DCount() << "entries", {});
+    CORRADE_ASSERT(!level || level < importer().image2DLevelCount(id),
+        "Trade::AsyncImporter::loadImage2D(): level" << level << "out of range for" << importer().image2DLevelCount(id) << "entries", {});
+    return _state->load(JobType::Image2D, id, level, priority);
+}
+
+UnsignedInt AsyncImporter::loadImage3D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(isOpened(), "Trade::AsyncImporter::loadImage3D(): no file opened", {});
+    CORRADE_ASSERT(id < importer().image3DCount(),
+        "Trade::AsyncImporter::loadImage3D(): index" << id << "out of range for" << importer().image3DCount() << "entries", {});
+    CORRADE_ASSERT(!level || level < importer().image3DLevelCount(id),
+        "Trade::AsyncImporter::loadImage3D(): level" << level << "out of range for" << importer().image3DLevelCount(id) << "entries", {});
+    return _state->load(JobType::Image3D, id, level, priority);
+}
+
+AsyncImporterJobState AsyncImporter::jobState(const UnsignedInt job) const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    CORRADE_ASSERT(job < _state->jobs.size(),
+        "Trade::AsyncImporter::jobState(): index" << job << "out of range for" << _state->jobs.size() << "jobs", {});
+    return _state->jobs[job].state;
+}
+
+bool AsyncImporter::cancel(const UnsignedInt job) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    CORRADE_ASSERT(job < _state->jobs.size(),
+        "Trade::AsyncImporter::cancel(): index" << job << "out of range for" << _state->jobs.size() << "jobs", {});
+    Job& j = _state->jobs[job];
+    if(j.state != AsyncImporterJobState::Pending)
+        return false;
+
+    /* The job stays in the queue and gets skipped once it's picked up */
+    j.state = AsyncImporterJobState::Cancelled;
+    _state->doneCondition.notify_all();
+    return true;
+}
+
+void AsyncImporter::wait(const UnsignedInt job) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    CORRADE_ASSERT(job < _state->jobs.size(),
+        "Trade::AsyncImporter::wait(): index" << job << "out of range for" << _state->jobs.size() << "jobs", );
+    _state->wait(job, lock);
+}
+
+void AsyncImporter::waitAll() {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    while(!_state->queue.isEmpty())
+        _state->runNext(*_state->importers[0], lock);
+    _state->doneCondition.wait(lock, [this]() { return !_state->runningCount; });
+}
+
+Containers::Optional<SceneData> AsyncImporter::takeScene(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeScene():", "scene", job, JobType::Scene, &Result::scene);
+}
+
+Containers::Optional<MeshData> AsyncImporter::takeMesh(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeMesh():", "mesh", job, JobType::Mesh, &Result::mesh);
+}
+
+Containers::Optional<MaterialData> AsyncImporter::takeMaterial(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeMaterial():", "material", job, JobType::Material, &Result::material);
+}
+
+Containers::Optional<ImageData1D> AsyncImporter::takeImage1D(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeImage1D():", "1D image", job, JobType::Image1D, &Result::image1D);
+}
+
+Containers::Optional<ImageData2D> AsyncImporter::takeImage2D(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeImage2D():", "2D image", job, JobType::Image2D, &Result::image2D);
+}
+
+Containers::Optional<ImageData3D> AsyncImporter::takeImage3D(const UnsignedInt job) {
+    return _state->take("Trade::AsyncImporter::takeImage3D():", "3D image", job, JobType::Image3D, &Result::image3D);
+}
+
+}}
@@ -0,0 +1,428 @@
+#ifndef Magnum_Trade_AsyncImporter_h
+#define Magnum_Trade_AsyncImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AsyncImporter, enum @ref Magnum::Trade::AsyncImporterJobState
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/PluginManager.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Asynchronous importer job state
+@m_since_latest
+
+@see @ref AsyncImporter::jobState()
+*/
+enum class AsyncImporterJobState: UnsignedByte {
+    /** The job is queued and waiting for a thread to pick it up */
+    Pending,
+
+    /** The job is being executed */
+    Running,
+
+    /**
+     * The job finished successfully, its result can be retrieved with one of
+     * the @ref AsyncImporter::takeMesh() etc. functions
+     */
+    Finished,
+
+    /**
+     * The job failed. The importer printed an error message in that case.
+     */
+    Failed,
+
+    /**
+     * The job was cancelled with @ref AsyncImporter::cancel() or
+     * @ref AsyncImporter::close() before it was picked up by a thread
+     */
+    Cancelled
+};
+
+/**
+@debugoperatorenum{AsyncImporterJobState}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, AsyncImporterJobState value);
+
+/**
+@brief Asynchronous importer
+@m_since_latest
+
+Wraps a pool of @ref AbstractImporter instances of the same plugin, each
+opened with the same file, and executes scene, mesh, material and image
+import on multiple threads. Each thread uses its own importer instance, so
+the plugins don't need to be thread-safe.
+
+@section Trade-AsyncImporter-usage Usage
+
+The importer is opened with @ref openFile() or @ref openData(). Then, the
+@ref loadMesh(), @ref loadImage2D() and other functions queue an import job
+and return its ID, which is then passed to @ref takeMesh(), @ref takeImage2D()
+etc. that wait for the job to finish and return its result. Data counts,
+names and other metadata are queried directly on the first importer instance
+accessible through @ref importer().
+
+@snippet Trade.cpp AsyncImporter-usage
+
+Jobs with a higher priority are picked up first, jobs with the same priority
+are executed in the order they were queued. A job that wasn't picked up yet
+can be cancelled with @ref cancel(). Results of finished jobs are kept until
+they're taken or until the importer is closed.
+
+@section Trade-AsyncImporter-threads Thread usage
+
+The @p threadCount passed to the constructor or the count of importer
+instances is the total count of threads used for importing, including the
+calling thread. The first importer instance is used on the calling thread for
+executing queued jobs while waiting in @ref wait(), @ref waitAll() and the
+@ref takeMesh() etc. functions, the remaining instances are used by
+background threads that execute jobs as soon as they're queued. With a single
+importer instance, or if Magnum is built for a platform without thread
+support, jobs are thus executed only once waited for.
+
+The @ref AsyncImporter itself isn't thread-safe and is meant to be used only
+from the thread that created it. In particular, @ref importer() shouldn't be
+accessed from other threads.
+
+@section Trade-AsyncImporter-opening Opening files
+
+On @ref openFile() and @ref openData(), @ref ImporterFlags and configuration
+of @ref importer() are propagated to the other instances, so set them there
+before opening. If the plugin supports @ref ImporterFeature::FileCallback or
+@ref ImporterFeature::OpenData and no file callback is set on
+@ref importer(), @ref openFile() installs a callback on all instances that
+reads each file just once and shares it among the instances until the
+importer is closed, including files referenced from the main file that the
+plugins load lazily during import. If a file callback is set on
+@ref importer(), it's propagated to all instances instead and it has to be
+thread-safe. The @ref openData() function copies the data just once and opens
+all instances with @ref AbstractImporter::openMemory() on the copy.
+*/
+class MAGNUM_TRADE_EXPORT AsyncImporter {
+    public:
+        /**
+         * @brief Try to create from a plugin name
+         * @param manager       Plugin manager
+         * @param plugin        Plugin name
+         * @param threadCount   Count of threads to use, including the calling
+         *      thread. Set to @cpp 0 @ce to use the number of logical CPU
+         *      cores.
+         *
+         * Unlike @ref AsyncImporter(PluginManager::Manager<AbstractImporter>&, Containers::StringView, UnsignedInt),
+         * loads @p plugin in @p manager if not already loaded. If the plugin
+         * can't be loaded or instantiated, prints a message to
+         * @relativeref{Magnum,Error} and returns
+         * @relativeref{Corrade,Containers::NullOpt}.
+         */
+        static Containers::Optional<AsyncImporter> tryCreate(PluginManager::Manager<AbstractImporter>& manager, Containers::StringView plugin, UnsignedInt threadCount);
+
+        /**
+         * @brief Construct from a plugin name
+         * @param manager       Plugin manager
+         * @param plugin        Plugin name
+         * @param threadCount   Count of threads to use, including the calling
+         *      thread. Set to @cpp 0 @ce to use the number of logical CPU
+         *      cores.
+         *
+         * The @p plugin is expected to be loaded in @p manager. Instantiates
+         * one importer for every thread. Use @ref tryCreate() if the plugin
+         * may fail to load.
+         */
+        explicit AsyncImporter(PluginManager::Manager<AbstractImporter>& manager, Containers::StringView plugin, UnsignedInt threadCount);
+
+        /**
+         * @brief Construct from importer instances
+         *
+         * Expects that @p importers is non-empty, none of the items is
+         * @cpp nullptr @ce and none of them is opened. All instances are
+         * expected to be of the same plugin. The first instance is used on
+         * the calling thread, one background thread is created for each of
+         * the remaining instances. On platforms without thread support only
+         * the first instance is used.
+         */
+        explicit AsyncImporter(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers);
+
+        /** @brief Copying is not allowed */
+        AsyncImporter(const AsyncImporter&) = delete;
+
+        /** @brief Move constructor */
+        AsyncImporter(AsyncImporter&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Cancels all pending jobs, waits for running jobs to finish and
+         * stops all background threads.
+         */
+        ~AsyncImporter();
+
+        /** @brief Copying is not allowed */
+        AsyncImporter& operator=(const AsyncImporter&) = delete;
+
+        /** @brief Move assignment */
+        AsyncImporter& operator=(AsyncImporter&&) noexcept;
+
+        /**
+         * @brief Thread count
+         *
+         * Count of threads used for importing, including the calling thread.
+         */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Importer instance used on the calling thread
+         *
+         * Use it for setting flags and configuration before opening a file
+         * and for querying data counts, names and other metadata after. Don't
+         * call its open and close functions directly, use @ref openFile(),
+         * @ref openData() and @ref close() instead.
+         */
+        AbstractImporter& importer();
+
+        /** @brief Whether any file is opened */
+        bool isOpened() const;
+
+        /**
+         * @brief Open a file
+         *
+         * Closes the previous file, if any, and opens @p filename with all
+         * importer instances. See @ref Trade-AsyncImporter-opening for
+         * details. If any of the instances fail to open the file, all are
+         * closed and @cpp false @ce is returned.
+         */
+        bool openFile(Containers::StringView filename);
+
+        /**
+         * @brief Open raw data
+         *
+         * Closes the previous file, if any, copies @p data and opens the copy
+         * with all importer instances. Expects that the plugin supports
+         * @ref ImporterFeature::OpenData. If any of the instances fail to
+         * open the data, all are closed and @cpp false @ce is returned.
+         */
+        bool openData(Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Close currently opened file
+         *
+         * Cancels all pending jobs, waits for running jobs to finish and
+         * closes all importer instances. All job IDs become invalid.
+         */
+        void close();
+
+        /**
+         * @brief Count of queued jobs
+         *
+         * Includes pending, running and already finished jobs. Reset back to
+         * @cpp 0 @ce on @ref close().
+         */
+        UnsignedInt jobCount() const;
+
+        /**
+         * @brief Queue a scene import
+         * @param id        Scene ID, from range [0, @ref AbstractImporter::sceneCount() "importer().sceneCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeScene()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadScene(UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Queue a mesh import
+         * @param id        Mesh ID, from range [0, @ref AbstractImporter::meshCount() "importer().meshCount()")
+         * @param level     Mesh level, from range [0, @ref AbstractImporter::meshLevelCount() "importer().meshLevelCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeMesh()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadMesh(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Queue a material import
+         * @param id        Material ID, from range [0, @ref AbstractImporter::materialCount() "importer().materialCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeMaterial()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadMaterial(UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Queue a 1D image import
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image1DCount() "importer().image1DCount()")
+         * @param level     Image level, from range [0, @ref AbstractImporter::image1DLevelCount() "importer().image1DLevelCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeImage1D()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadImage1D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Queue a 2D image import
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image2DCount() "importer().image2DCount()")
+         * @param level     Image level, from range [0, @ref AbstractImporter::image2DLevelCount() "importer().image2DLevelCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeImage2D()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadImage2D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Queue a 3D image import
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image3DCount() "importer().image3DCount()")
+         * @param level     Image level, from range [0, @ref AbstractImporter::image3DLevelCount() "importer().image3DLevelCount()")
+         * @param priority  Job priority. Jobs with a higher priority are
+         *      executed first.
+         * @return Job ID to be passed to @ref takeImage3D()
+         *
+         * Expects that a file is opened.
+         */
+        UnsignedInt loadImage3D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Job state
+         *
+         * Expects that @p job is less than @ref jobCount(). Doesn't wait for
+         * the job to finish.
+         */
+        AsyncImporterJobState jobState(UnsignedInt job) const;
+
+        /**
+         * @brief Cancel a job
+         *
+         * If the job is @ref AsyncImporterJobState::Pending, it's marked as
+         * @ref AsyncImporterJobState::Cancelled and @cpp true @ce is
+         * returned. Otherwise the job is left to finish and @cpp false @ce is
+         * returned. Expects that @p job is less than @ref jobCount().
+         */
+        bool cancel(UnsignedInt job);
+
+        /**
+         * @brief Wait for a job to finish
+         *
+         * Returns once the job is @ref AsyncImporterJobState::Finished,
+         * @relativeref{AsyncImporterJobState,Failed} or
+         * @relativeref{AsyncImporterJobState,Cancelled}. While the job is
+         * pending, the calling thread executes queued jobs in the order of
+         * their priority. Expects that @p job is less than @ref jobCount().
+         */
+        void wait(UnsignedInt job);
+
+        /**
+         * @brief Wait for all jobs to finish
+         *
+         * The calling thread executes queued jobs until there are none left,
+         * then waits for the background threads to finish theirs.
+         */
+        void waitAll();
+
+        /**
+         * @brief Take a scene import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadScene(). Calls @ref wait() and then moves the result
+         * out. If the job failed, was cancelled or the result was already
+         * taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<SceneData> takeScene(UnsignedInt job);
+
+        /**
+         * @brief Take a mesh import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadMesh(). Calls @ref wait() and then moves the result
+         * out. If the job failed, was cancelled or the result was already
+         * taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<MeshData> takeMesh(UnsignedInt job);
+
+        /**
+         * @brief Take a material import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadMaterial(). Calls @ref wait() and then moves the
+         * result out. If the job failed, was cancelled or the result was
+         * already taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<MaterialData> takeMaterial(UnsignedInt job);
+
+        /**
+         * @brief Take a 1D image import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadImage1D(). Calls @ref wait() and then moves the
+         * result out. If the job failed, was cancelled or the result was
+         * already taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<ImageData1D> takeImage1D(UnsignedInt job);
+
+        /**
+         * @brief Take a 2D image import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadImage2D(). Calls @ref wait() and then moves the
+         * result out. If the job failed, was cancelled or the result was
+         * already taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<ImageData2D> takeImage2D(UnsignedInt job);
+
+        /**
+         * @brief Take a 3D image import result
+         *
+         * Expects that @p job is less than @ref jobCount() and was queued
+         * with @ref loadImage3D(). Calls @ref wait() and then moves the
+         * result out. If the job failed, was cancelled or the result was
+         * already taken, returns @relativeref{Corrade,Containers::NullOpt}.
+         */
+        Containers::Optional<ImageData3D> takeImage3D(UnsignedInt job);
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
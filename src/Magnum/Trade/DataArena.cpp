@@ -0,0 +1,123 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DataArena.h"
+
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+
+namespace Magnum { namespace Trade {
+
+struct DataArena::State {
+    std::size_t blockSize;
+    std::size_t size = 0;
+    std::size_t capacity = 0;
+    Containers::Array<Containers::Array<char>> blocks;
+    /* Free space in the block allocations are served from. Stays valid when
+       the blocks array gets reallocated, as moving an Array doesn't move the
+       memory it points to. */
+    char* current = nullptr;
+    char* end = nullptr;
+};
+
+DataArena::DataArena(const std::size_t blockSize): _state{InPlaceInit} {
+    CORRADE_ASSERT(blockSize,
+        "Trade::DataArena: expected a non-zero block size", );
+    _state->blockSize = blockSize;
+}
+
+DataArena::DataArena(DataArena&&) noexcept = default;
+
+DataArena::~DataArena() = default;
+
+DataArena& DataArena::operator=(DataArena&&) noexcept = default;
+
+std::size_t DataArena::blockSize() const {
+    return _state->blockSize;
+}
+
+std::size_t DataArena::blockCount() const {
+    return _state->blocks.size();
+}
+
+std::size_t DataArena::size() const {
+    return _state->size;
+}
+
+std::size_t DataArena::capacity() const {
+    return _state->capacity;
+}
+
+Containers::ArrayView<char> DataArena::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)),
+        "Trade::DataArena::allocate(): expected alignment to be a power of two but got" << alignment, {});
+
+    if(!size) return {};
+
+    /* Aligning the actual address and not just an offset in the block, as
+       the block allocation itself may have a smaller alignment */
+    const auto align = [alignment](char* const pointer) {
+        return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(pointer) + alignment - 1) & ~std::uintptr_t(alignment - 1));
+    };
+
+    State& state = *_state;
+    char* data = state.current ? align(state.current) : nullptr;
+    if(!data || data > state.end || std::size_t(state.end - data) < size) {
+        /* Allocations that wouldn't fit into a fresh block get a dedicated
+           one, keeping the current block for subsequent allocations */
+        const std::size_t worstCaseSize = size + alignment - 1;
+        const bool dedicated = worstCaseSize > state.blockSize;
+        Containers::Array<char>& block = arrayAppend(state.blocks, Containers::Array<char>{NoInit, dedicated ? worstCaseSize : state.blockSize});
+        state.capacity += block.size();
+        data = align(block.data());
+        if(!dedicated) {
+            state.current = data + size;
+            state.end = block.end();
+        }
+    } else state.current = data + size;
+
+    state.size += size;
+    return {data, size};
+}
+
+Containers::ArrayView<char> DataArena::copy(const Containers::ArrayView<const void> data, const std::size_t alignment) {
+    const Containers::ArrayView<char> out = allocate(data.size(), alignment);
+    /* Not asserting on the output size here, allocate() returns an empty
+       view only for zero size or on a failed assertion */
+    if(!out.isEmpty()) std::memcpy(out.data(), data.data(), data.size());
+    return out;
+}
+
+void DataArena::reset() {
+    _state->blocks = {};
+    _state->current = nullptr;
+    _state->end = nullptr;
+    _state->size = 0;
+    _state->capacity = 0;
+}
+
+}}
@@ -0,0 +1,176 @@
+#ifndef Magnum_Trade_DataArena_h
+#define Magnum_Trade_DataArena_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DataArena
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Arena allocator for imported data
+@m_since_latest
+
+A bump allocator that hands out memory from large blocks and frees all of it
+at once. Meant to be used together with @ref AbstractImporter::setArena(),
+which makes the arena available to importer implementations that can then
+place index, vertex, image and material attribute data of everything they
+return into it instead of having each @ref MeshData, @ref ImageData or
+@ref MaterialData own separate heap allocations.
+
+@section Trade-DataArena-usage Usage
+
+@snippet Trade.cpp DataArena-usage
+
+Data placed into the arena is marked with @ref DataFlag::ExternallyOwned and
+@ref DataFlag::Mutable. Destroying such instances doesn't free anything, the
+memory is released only when the arena is destroyed or @ref reset() is
+called. It's the responsibility of the user to ensure no data referencing
+the arena is used after that.
+
+Using the arena is opt-in for importer implementations, data of importers
+that don't support it are returned with their usual flags and aren't
+affected by @ref reset(). An implementation allocates from
+@ref AbstractImporter::arena() if it's set and passes the memory to the data
+constructors taking @ref DataFlags:
+
+@snippet Trade.cpp DataArena-implementation
+
+@section Trade-DataArena-allocation Allocation strategy
+
+Allocations are served from the most recently created block, advancing a
+pointer in it. If the block doesn't have enough space left, a new block of
+@ref blockSize() bytes is allocated and the remaining space in the previous
+block is abandoned. Allocations larger than @ref blockSize() get a dedicated
+block, which doesn't affect the block that the following allocations are
+served from.
+
+@section Trade-DataArena-thread-safety Thread safety
+
+The arena isn't thread-safe. When importing on multiple threads, for example
+with @ref AsyncImporter, use a separate arena for each importer instance.
+*/
+class MAGNUM_TRADE_EXPORT DataArena {
+    public:
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of each allocated block in bytes
+         *
+         * Doesn't allocate any memory, the first block is allocated on the
+         * first call to @ref allocate(). Expects that @p blockSize is not
+         * zero.
+         */
+        explicit DataArena(std::size_t blockSize = 16*1024*1024);
+
+        /** @brief Copying is not allowed */
+        DataArena(const DataArena&) = delete;
+
+        /** @brief Move constructor */
+        DataArena(DataArena&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all blocks.
+         */
+        ~DataArena();
+
+        /** @brief Copying is not allowed */
+        DataArena& operator=(const DataArena&) = delete;
+
+        /** @brief Move assignment */
+        DataArena& operator=(DataArena&&) noexcept;
+
+        /** @brief Size of each allocated block in bytes */
+        std::size_t blockSize() const;
+
+        /** @brief Count of allocated blocks */
+        std::size_t blockCount() const;
+
+        /**
+         * @brief Total size of all allocations in bytes
+         *
+         * Doesn't include padding inserted to satisfy alignment or space
+         * abandoned at the end of blocks.
+         * @see @ref capacity()
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Total size of all allocated blocks in bytes
+         *
+         * @see @ref size()
+         */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment in bytes
+         *
+         * Returns a view on uninitialized memory that stays valid until the
+         * arena is destroyed or @ref reset() is called. Expects that
+         * @p alignment is a power of two. For @p size being zero returns an
+         * empty view without allocating anything.
+         */
+        Containers::ArrayView<char> allocate(std::size_t size, std::size_t alignment = 16);
+
+        /**
+         * @brief Copy data to the arena
+         *
+         * Calls @ref allocate() with @p alignment and copies @p data to the
+         * returned view.
+         */
+        Containers::ArrayView<char> copy(Containers::ArrayView<const void> data, std::size_t alignment = 16);
+
+        /**
+         * @brief Free all allocations
+         *
+         * Frees all blocks at once. Any data that was allocated from the
+         * arena, such as @ref MeshData, @ref ImageData or @ref MaterialData
+         * instances returned from an importer that allocated them from the
+         * arena, is invalid after this call.
+         */
+        void reset();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,52 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageProperties.h"
+
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+template<UnsignedInt dimensions> ImageProperties<dimensions>::ImageProperties(const ImageData<dimensions>& image) noexcept: _compressed{image.isCompressed()}, _flags{image.flags()}, _size{image.size()} {
+    if(_compressed) _compressedFormat = image.compressedFormat();
+    else _format = image.format();
+}
+
+template<UnsignedInt dimensions> PixelFormat ImageProperties<dimensions>::format() const {
+    CORRADE_ASSERT(!_compressed, "Trade::ImageProperties::format(): the image is compressed", {});
+    return _format;
+}
+
+template<UnsignedInt dimensions> CompressedPixelFormat ImageProperties<dimensions>::compressedFormat() const {
+    CORRADE_ASSERT(_compressed, "Trade::ImageProperties::compressedFormat(): the image is not compressed", {});
+    return _compressedFormat;
+}
+
+template class MAGNUM_TRADE_EXPORT ImageProperties<1>;
+template class MAGNUM_TRADE_EXPORT ImageProperties<2>;
+template class MAGNUM_TRADE_EXPORT ImageProperties<3>;
+
+}}
@@ -0,0 +1,139 @@
+#ifndef Magnum_Trade_ImageProperties_h
+#define Magnum_Trade_ImageProperties_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImageProperties, typedef @ref Magnum::Trade::ImageProperties1D, @ref Magnum::Trade::ImageProperties2D, @ref Magnum::Trade::ImageProperties3D
+ * @m_since_latest
+ */
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Image properties
+@m_since_latest
+
+Describes format, size and flags of an image without containing any pixel
+data. Returned from @ref AbstractImporter::image1DProperties(),
+@ref AbstractImporter::image2DProperties() and
+@ref AbstractImporter::image3DProperties(), which importers can implement by
+parsing just the file header, without decoding the actual image.
+
+Same as with @ref ImageData, the image can be either uncompressed or
+compressed, distinguished with @ref isCompressed(). Uncompressed image format
+is available through @ref format(), compressed through
+@ref compressedFormat().
+@see @ref ImageProperties1D, @ref ImageProperties2D, @ref ImageProperties3D
+*/
+template<UnsignedInt dimensions> class ImageProperties {
+    public:
+        /**
+         * @brief Construct uncompressed image properties
+         * @param format    Pixel format
+         * @param size      Image size
+         * @param flags     Image layout flags
+         */
+        explicit ImageProperties(PixelFormat format, const VectorTypeFor<dimensions, Int>& size, ImageFlags<dimensions> flags = {}) noexcept: _compressed{false}, _flags{flags}, _format{format}, _size{size} {}
+
+        /**
+         * @brief Construct compressed image properties
+         * @param format    Compressed pixel format
+         * @param size      Image size
+         * @param flags     Image layout flags
+         */
+        explicit ImageProperties(CompressedPixelFormat format, const VectorTypeFor<dimensions, Int>& size, ImageFlags<dimensions> flags = {}) noexcept: _compressed{true}, _flags{flags}, _compressedFormat{format}, _size{size} {}
+
+        /**
+         * @brief Construct properties of an existing image
+         *
+         * Takes format, size and flags of @p image, ignoring its pixel data.
+         */
+        explicit ImageProperties(const ImageData<dimensions>& image) noexcept;
+
+        /** @brief Whether the image is compressed */
+        bool isCompressed() const { return _compressed; }
+
+        /** @brief Layout flags */
+        ImageFlags<dimensions> flags() const { return _flags; }
+
+        /**
+         * @brief Format of pixel data
+         *
+         * The image is expected to be uncompressed.
+         * @see @ref isCompressed(), @ref compressedFormat()
+         */
+        PixelFormat format() const;
+
+        /**
+         * @brief Format of compressed pixel data
+         *
+         * The image is expected to be compressed.
+         * @see @ref isCompressed(), @ref format()
+         */
+        CompressedPixelFormat compressedFormat() const;
+
+        /** @brief Image size in pixels */
+        const VectorTypeFor<dimensions, Int>& size() const { return _size; }
+
+    private:
+        bool _compressed;
+        ImageFlags<dimensions> _flags;
+        union {
+            PixelFormat _format;
+            CompressedPixelFormat _compressedFormat;
+        };
+        VectorTypeFor<dimensions, Int> _size;
+};
+
+/**
+@brief One-dimensional image properties
+@m_since_latest
+*/
+typedef ImageProperties<1> ImageProperties1D;
+
+/**
+@brief Two-dimensional image properties
+@m_since_latest
+*/
+typedef ImageProperties<2> ImageProperties2D;
+
+/**
+@brief Three-dimensional image properties
+@m_since_latest
+*/
+typedef ImageProperties<3> ImageProperties3D;
+
+}}
+
+#endif
@@ -42,6 +42,8 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
+#include "Magnum/Trade/Implementation/profiler.h"
 
 namespace Magnum { namespace Trade { namespace Implementation {
 
@@ -151,14 +153,34 @@ void printImageConverterInfo(const Debug::Flags useColor, const Trade::AbstractI
 }
 
 struct Duration {
-    explicit Duration(std::chrono::high_resolution_clock::duration& output): _output(output), _t{std::chrono::high_resolution_clock::now()} {}
+    explicit Duration(std::chrono::high_resolution_clock::duration& output): Duration{output, nullptr, {}} {}
+
+    /* If profiler is non-null, the measured time is additionally recorded
+       there as an event of given stage and item, see Profiler::add() for
+       details. The stage and item views are expected to stay in scope until
+       the destructor. */
+    explicit Duration(std::chrono::high_resolution_clock::duration& output, Profiler* profiler, Containers::StringView stage, Containers::StringView item = {}, Int index = -1): _output(output), _profiler{profiler}, _stage{stage}, _item{item}, _index{index}, _t{std::chrono::high_resolution_clock::now()} {}
 
     ~Duration() {
-        _output += std::chrono::high_resolution_clock::now() - _t;
+        const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+        _output += end - _t;
+        if(_profiler)
+            _profiler->add(_stage, _item, _index, _t, end, _bytesIn, _bytesOut);
+    }
+
+    /* Size of data consumed and produced by the operation, recorded in the
+       profiler event */
+    void setBytes(std::size_t in, std::size_t out) {
+        _bytesIn = in;
+        _bytesOut = out;
     }
 
     private:
         std::chrono::high_resolution_clock::duration& _output;
+        Profiler* _profiler;
+        Containers::StringView _stage, _item;
+        Int _index;
+        std::size_t _bytesIn{}, _bytesOut{};
         std::chrono::high_resolution_clock::time_point _t;
 };
 
@@ -185,13 +207,40 @@ struct ImageInfo {
     Containers::String name;
 };
 
-Containers::Array<ImageInfo> imageInfo(AbstractImporter& importer, bool& error, std::chrono::high_resolution_clock::duration& importTime) {
+/* With probe set, only image*DProperties() are queried, which importers
+   can implement without decoding the image. Data size and flags are left
+   empty in that case. */
+Containers::Array<ImageInfo> imageInfo(AbstractImporter& importer, bool& error, std::chrono::high_resolution_clock::duration& importTime, const bool probe) {
     Containers::Array<ImageInfo> infos;
     for(UnsignedInt i = 0; i != importer.image1DCount(); ++i) {
         const Containers::String name = importer.image1DName(i);
         const UnsignedInt levelCount = importer.image1DLevelCount(i);
 
         for(UnsignedInt j = 0; j != levelCount; ++j) {
+            if(probe) {
+                Containers::Optional<Trade::ImageProperties1D> properties;
+                {
+                    Duration d{importTime};
+                    if(!(properties = importer.image1DProperties(i, j))) {
+                        Error{} << "Can't probe 1D image" << i << "level" << j;
+                        error = true;
+                        continue;
+                    }
+                }
+                arrayAppend(infos, InPlaceInit, i, j,
+                    properties->isCompressed(),
+                    properties->isCompressed() ?
+                        PixelFormat{} : properties->format(),
+                    properties->isCompressed() ?
+                        properties->compressedFormat() : CompressedPixelFormat{},
+                    Vector3i::pad(properties->size()),
+                    std::size_t{},
+                    Trade::DataFlags{},
+                    ImageInfoFlags{properties->flags()},
+                    j ? "" : name);
+                continue;
+            }
+
             Containers::Optional<Trade::ImageData1D> image;
             {
                 Duration d{importTime};
@@ -219,6 +268,30 @@ Containers::Array<ImageInfo> imageInfo(AbstractImporter& importer, bool& error,
         const UnsignedInt levelCount = importer.image2DLevelCount(i);
 
         for(UnsignedInt j = 0; j != levelCount; ++j) {
+            if(probe) {
+                Containers::Optional<Trade::ImageProperties2D> properties;
+                {
+                    Duration d{importTime};
+                    if(!(properties = importer.image2DProperties(i, j))) {
+                        Error{} << "Can't probe 2D image" << i << "level" << j;
+                        error = true;
+                        continue;
+                    }
+                }
+                arrayAppend(infos, InPlaceInit, i, j,
+                    properties->isCompressed(),
+                    properties->isCompressed() ?
+                        PixelFormat{} : properties->format(),
+                    properties->isCompressed() ?
+                        properties->compressedFormat() : CompressedPixelFormat{},
+                    Vector3i::pad(properties->size()),
+                    std::size_t{},
+                    Trade::DataFlags{},
+                    ImageInfoFlags{properties->flags()},
+                    j ? "" : name);
+                continue;
+            }
+
             Containers::Optional<Trade::ImageData2D> image;
             {
                 Duration d{importTime};
@@ -246,6 +319,30 @@ Containers::Array<ImageInfo> imageInfo(AbstractImporter& importer, bool& error,
         const UnsignedInt levelCount = importer.image3DLevelCount(i);
 
         for(UnsignedInt j = 0; j != levelCount; ++j) {
+            if(probe) {
+                Containers::Optional<Trade::ImageProperties3D> properties;
+                {
+                    Duration d{importTime};
+                    if(!(properties = importer.image3DProperties(i, j))) {
+                        Error{} << "Can't probe 3D image" << i << "level" << j;
+                        error = true;
+                        continue;
+                    }
+                }
+                arrayAppend(infos, InPlaceInit, i, j,
+                    properties->isCompressed(),
+                    properties->isCompressed() ?
+                        PixelFormat{} : properties->format(),
+                    properties->isCompressed() ?
+                        properties->compressedFormat() : CompressedPixelFormat{},
+                    properties->size(),
+                    std::size_t{},
+                    Trade::DataFlags{},
+                    ImageInfoFlags{properties->flags()},
+                    j ? "" : name);
+                continue;
+            }
+
             Containers::Optional<Trade::ImageData3D> image;
             {
                 Duration d{importTime};
@@ -272,7 +369,7 @@ Containers::Array<ImageInfo> imageInfo(AbstractImporter& importer, bool& error,
     return infos;
 }
 
-void printImageInfo(const Debug::Flags useColor, const Containers::ArrayView<const ImageInfo> imageInfos, const Containers::ArrayView<const UnsignedInt> image1DReferenceCount, const Containers::ArrayView<const UnsignedInt> image2DReferenceCount, const Containers::ArrayView<const UnsignedInt> image3DReferenceCount) {
+void printImageInfo(const Debug::Flags useColor, const Containers::ArrayView<const ImageInfo> imageInfos, const Containers::ArrayView<const UnsignedInt> image1DReferenceCount, const Containers::ArrayView<const UnsignedInt> image2DReferenceCount, const Containers::ArrayView<const UnsignedInt> image3DReferenceCount, const bool probe) {
     std::size_t totalImageDataSize = 0;
     for(const Trade::Implementation::ImageInfo& info: imageInfos) {
         Debug d{useColor};
@@ -335,7 +432,12 @@ void printImageInfo(const Debug::Flags useColor, const Containers::ArrayView<con
         if(info.compressed)
             d << Debug::color(Debug::Color::Yellow) << info.compressedFormat;
         else d << Debug::color(Debug::Color::Cyan) << info.format;
-        d << Debug::resetColor << "(" << Debug::nospace << Utility::format("{:.1f}", info.dataSize/1024.0f) << "kB";
+        d << Debug::resetColor;
+
+        /* Data size isn't known when probing */
+        if(probe) continue;
+
+        d << "(" << Debug::nospace << Utility::format("{:.1f}", info.dataSize/1024.0f) << "kB";
         if(info.dataFlags != (Trade::DataFlag::Owned|Trade::DataFlag::Mutable))
             d << Debug::nospace << "," << Debug::packed
                 << Debug::color(Debug::Color::Green) << info.dataFlags
@@ -344,7 +446,7 @@ void printImageInfo(const Debug::Flags useColor, const Containers::ArrayView<con
 
         totalImageDataSize += info.dataSize;
     }
-    if(!imageInfos.isEmpty())
+    if(!imageInfos.isEmpty() && !probe)
         Debug{} << "Total image data size:" << Utility::format("{:.1f}", totalImageDataSize/1024.0f) << "kB";
 }
 
@@ -0,0 +1,353 @@
+#ifndef Magnum_Trade_Implementation_profiler_h
+#define Magnum_Trade_Implementation_profiler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/Magnum.h"
+
+/* Emscripten has std::thread only if built with -pthread, everything else
+   we support has it always */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#define MAGNUM_TRADE_IMPLEMENTATION_PROFILER_THREADS
+#include <mutex>
+#include <thread>
+#endif
+
+#ifdef CORRADE_TARGET_UNIX
+#include <sys/resource.h>
+#endif
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Used only in executables where we don't want it to be exported -- in
+   particular magnum-imageconverter, magnum-sceneconverter and their tests */
+namespace {
+
+/* A single measured operation. Times are relative to when the profiler was
+   created. */
+struct ProfileEvent {
+    Containers::String stage;
+    Containers::String item;
+    UnsignedInt thread;
+    std::chrono::high_resolution_clock::duration begin;
+    std::chrono::high_resolution_clock::duration duration;
+    std::size_t bytesIn;
+    std::size_t bytesOut;
+};
+
+/* Collects per-stage and per-item timings for --profile. The add() function
+   can be called from multiple threads. The thread that created the profiler
+   is always numbered 0 and labelled as the main thread, other threads get
+   numbered in the order in which they record their first event. */
+class Profiler {
+    public:
+        explicit Profiler(): _start{std::chrono::high_resolution_clock::now()} {
+            #ifdef MAGNUM_TRADE_IMPLEMENTATION_PROFILER_THREADS
+            arrayAppend(_threads, std::this_thread::get_id());
+            #endif
+        }
+
+        std::chrono::high_resolution_clock::time_point start() const {
+            return _start;
+        }
+
+        Containers::ArrayView<const ProfileEvent> events() const {
+            return _events;
+        }
+
+        /* If index is non-negative, it's appended to the item name, so e.g.
+           "mesh" and 3 becomes "mesh 3" */
+        void add(const Containers::StringView stage, const Containers::StringView item, const Int index, const std::chrono::high_resolution_clock::time_point begin, const std::chrono::high_resolution_clock::time_point end, const std::size_t bytesIn, const std::size_t bytesOut) {
+            Containers::String itemName = index < 0 ? Containers::String{item} : Utility::format("{} {}", item, index);
+
+            #ifdef MAGNUM_TRADE_IMPLEMENTATION_PROFILER_THREADS
+            std::lock_guard<std::mutex> lock{_mutex};
+            const std::thread::id id = std::this_thread::get_id();
+            UnsignedInt thread = 0;
+            while(thread != _threads.size() && _threads[thread] != id)
+                ++thread;
+            if(thread == _threads.size())
+                arrayAppend(_threads, id);
+            #else
+            const UnsignedInt thread = 0;
+            #endif
+
+            arrayAppend(_events, InPlaceInit, Containers::String{stage}, Utility::move(itemName), thread, begin - _start, end - begin, bytesIn, bytesOut);
+        }
+
+    private:
+        std::chrono::high_resolution_clock::time_point _start;
+        #ifdef MAGNUM_TRADE_IMPLEMENTATION_PROFILER_THREADS
+        std::mutex _mutex;
+        Containers::Array<std::thread::id> _threads;
+        #endif
+        Containers::Array<ProfileEvent> _events;
+};
+
+/* Peak resident memory of the process in bytes, or 0 if it can't be queried
+   on given platform */
+std::size_t peakMemoryUsage() {
+    #ifdef CORRADE_TARGET_UNIX
+    rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    /* Linux and BSDs report the value in kilobytes, Apple in bytes */
+    #ifdef CORRADE_TARGET_APPLE
+    return std::size_t(usage.ru_maxrss);
+    #else
+    return std::size_t(usage.ru_maxrss)*1024;
+    #endif
+    #else
+    return 0;
+    #endif
+}
+
+/* Size of given file, or 0 if it can't be queried */
+std::size_t fileSize(const Containers::StringView filename) {
+    const Containers::Optional<std::size_t> size = Utility::Path::size(filename);
+    return size ? *size : 0;
+}
+
+UnsignedLong microseconds(const std::chrono::high_resolution_clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+/* Escapes quotes, backslashes and control characters for a JSON string */
+Containers::String jsonString(const Containers::StringView string) {
+    Containers::Array<char> out;
+    arrayReserve(out, string.size() + 2);
+    arrayAppend(out, '"');
+    for(const char c: string) {
+        if(c == '"' || c == '\\') {
+            arrayAppend(out, {'\\', c});
+        } else if(UnsignedByte(c) < 0x20) {
+            arrayAppend(out, {'\\', 'u', '0', '0',
+                "0123456789abcdef"[UnsignedByte(c) >> 4],
+                "0123456789abcdef"[UnsignedByte(c) & 0xf]});
+        } else arrayAppend(out, c);
+    }
+    arrayAppend(out, '"');
+    return Containers::StringView{out.data(), out.size()};
+}
+
+/* Quotes the value if it contains a comma, a quote or a newline, doubling
+   the quotes */
+Containers::String csvString(const Containers::StringView string) {
+    if(!string.findAny(",\"\r\n"))
+        return string;
+
+    Containers::Array<char> out;
+    arrayReserve(out, string.size() + 2);
+    arrayAppend(out, '"');
+    for(const char c: string) {
+        if(c == '"')
+            arrayAppend(out, {'"', '"'});
+        else
+            arrayAppend(out, c);
+    }
+    arrayAppend(out, '"');
+    return Containers::StringView{out.data(), out.size()};
+}
+
+/* Events aggregated by stage, in order of first appearance */
+struct ProfileStage {
+    Containers::StringView stage;
+    std::size_t count;
+    std::chrono::high_resolution_clock::duration duration;
+    std::size_t bytesIn;
+    std::size_t bytesOut;
+};
+
+Containers::Array<ProfileStage> profileStages(const Profiler& profiler) {
+    Containers::Array<ProfileStage> out;
+    for(const ProfileEvent& event: profiler.events()) {
+        std::size_t i = 0;
+        while(i != out.size() && out[i].stage != event.stage)
+            ++i;
+        if(i == out.size())
+            arrayAppend(out, InPlaceInit, event.stage, std::size_t{}, std::chrono::high_resolution_clock::duration{}, std::size_t{}, std::size_t{});
+
+        ++out[i].count;
+        out[i].duration += event.duration;
+        out[i].bytesIn += event.bytesIn;
+        out[i].bytesOut += event.bytesOut;
+    }
+    return out;
+}
+
+/* All times are in microseconds, sizes in bytes */
+Containers::String profileJson(const Profiler& profiler, const std::chrono::high_resolution_clock::duration totalTime, const std::size_t peakMemory) {
+    using namespace Containers::Literals;
+
+    Containers::Array<Containers::String> out;
+    arrayAppend(out, Utility::format("{{\n  \"totalTime\": {},\n  \"peakMemory\": {},\n  \"stages\": [", microseconds(totalTime), peakMemory));
+
+    const Containers::Array<ProfileStage> stages = profileStages(profiler);
+    for(std::size_t i = 0; i != stages.size(); ++i) {
+        const ProfileStage& stage = stages[i];
+        arrayAppend(out, Utility::format("{}\n    {{\"stage\": {}, \"count\": {}, \"time\": {}, \"bytesIn\": {}, \"bytesOut\": {}}}",
+            i ? "," : "",
+            jsonString(stage.stage), stage.count, microseconds(stage.duration), stage.bytesIn, stage.bytesOut));
+    }
+
+    arrayAppend(out, Containers::String{"\n  ],\n  \"events\": ["_s});
+    for(std::size_t i = 0; i != profiler.events().size(); ++i) {
+        const ProfileEvent& event = profiler.events()[i];
+        arrayAppend(out, Utility::format("{}\n    {{\"stage\": {}, \"item\": {}, \"thread\": {}, \"begin\": {}, \"duration\": {}, \"bytesIn\": {}, \"bytesOut\": {}}}",
+            i ? "," : "",
+            jsonString(event.stage), jsonString(event.item), event.thread, microseconds(event.begin), microseconds(event.duration), event.bytesIn, event.bytesOut));
+    }
+
+    arrayAppend(out, Containers::String{"\n  ]\n}\n"_s});
+    return ""_s.join(out);
+}
+
+/* One row per event, plus a final row with the total time and peak memory
+   usage. All times are in microseconds, sizes in bytes. */
+Containers::String profileCsv(const Profiler& profiler, const std::chrono::high_resolution_clock::duration totalTime, const std::size_t peakMemory) {
+    using namespace Containers::Literals;
+
+    Containers::Array<Containers::String> out;
+    arrayAppend(out, Containers::String{"stage,item,thread,begin,duration,bytesIn,bytesOut,peakMemory\n"_s});
+    for(const ProfileEvent& event: profiler.events())
+        arrayAppend(out, Utility::format("{},{},{},{},{},{},{},\n",
+            csvString(event.stage), csvString(event.item), event.thread, microseconds(event.begin), microseconds(event.duration), event.bytesIn, event.bytesOut));
+    arrayAppend(out, Utility::format("total,,,0,{},,,{}\n", microseconds(totalTime), peakMemory));
+    return ""_s.join(out);
+}
+
+/* Trace Event Format as understood by chrome://tracing, Perfetto and
+   Speedscope, with one complete event per profiled operation and a counter
+   event for the peak memory usage at the end */
+Containers::String profileChromeTrace(const Profiler& profiler, const std::chrono::high_resolution_clock::duration totalTime, const std::size_t peakMemory) {
+    using namespace Containers::Literals;
+
+    Containers::Array<Containers::String> out;
+    arrayAppend(out, Containers::String{"{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"_s});
+
+    UnsignedInt threadCount = 0;
+    for(const ProfileEvent& event: profiler.events())
+        if(event.thread + 1 > threadCount)
+            threadCount = event.thread + 1;
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        arrayAppend(out, Utility::format("{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": {}, \"args\": {{\"name\": \"{}\"}}}},\n",
+            i, i ? Utility::format("worker {}", i) : Containers::String{"main"_s}));
+
+    for(const ProfileEvent& event: profiler.events())
+        arrayAppend(out, Utility::format("{{\"name\": {}, \"cat\": {}, \"ph\": \"X\", \"pid\": 0, \"tid\": {}, \"ts\": {}, \"dur\": {}, \"args\": {{\"bytesIn\": {}, \"bytesOut\": {}}}}},\n",
+            jsonString(event.item ? event.stage + " "_s + event.item : event.stage), jsonString(event.stage), event.thread, microseconds(event.begin), microseconds(event.duration), event.bytesIn, event.bytesOut));
+
+    arrayAppend(out, Utility::format("{{\"name\": \"peakMemory\", \"ph\": \"C\", \"pid\": 0, \"tid\": 0, \"ts\": {}, \"args\": {{\"bytes\": {}}}}}\n]}}\n", microseconds(totalTime), peakMemory));
+    return ""_s.join(out);
+}
+
+/* Whether any of the options that need per-item timings are set */
+bool isProfileRequested(const Utility::Arguments& args) {
+    return args.isSet("profile") ||
+           !args.value<Containers::StringView>("profile-output").isEmpty() ||
+           !args.value<Containers::StringView>("trace").isEmpty();
+}
+
+/* Meant to be called before doing any actual work, so a typo doesn't get
+   discovered only after a long conversion */
+bool checkProfileOptions(const Utility::Arguments& args) {
+    using namespace Containers::Literals;
+
+    const Containers::StringView format = args.value<Containers::StringView>("profile-format");
+    if(format != "text"_s && format != "json"_s && format != "csv"_s) {
+        Error{} << "Unrecognized --profile-format" << format << Debug::nospace << ", expected text, json or csv";
+        return false;
+    }
+    if(format == "text"_s && args.value<Containers::StringView>("profile-output")) {
+        Error{} << "The --profile-output option requires --profile-format json or csv";
+        return false;
+    }
+
+    return true;
+}
+
+/* Prints a per-stage summary for the text --profile-format, or saves / prints
+   the profile in the JSON or CSV format. Saves a Chrome trace if --trace is
+   set. Expects checkProfileOptions() was called before. Returns false if any
+   of the files can't be written. */
+bool outputProfile(const Utility::Arguments& args, const Profiler& profiler) {
+    using namespace Containers::Literals;
+
+    const std::chrono::high_resolution_clock::duration totalTime = std::chrono::high_resolution_clock::now() - profiler.start();
+    const std::size_t peakMemory = peakMemoryUsage();
+
+    const Containers::StringView format = args.value<Containers::StringView>("profile-format");
+    const Containers::StringView output = args.value<Containers::StringView>("profile-output");
+    /* With just --trace, nothing is printed */
+    if(args.isSet("profile") || output) {
+        Containers::String formatted;
+        if(format == "json"_s)
+            formatted = profileJson(profiler, totalTime, peakMemory);
+        else if(format == "csv"_s)
+            formatted = profileCsv(profiler, totalTime, peakMemory);
+
+        /* A text output to a file is disallowed in checkProfileOptions() */
+        if(format == "text"_s) {
+            for(const ProfileStage& stage: profileStages(profiler)) {
+                Debug d;
+                d << " " << stage.stage << Debug::nospace << ":" << stage.count << (stage.count == 1 ? "item," : "items,") << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(stage.duration).count())/1.0e3f << "seconds";
+                if(stage.bytesIn || stage.bytesOut)
+                    d << Debug::nospace << "," << stage.bytesIn << "bytes in," << stage.bytesOut << "bytes out";
+            }
+            if(peakMemory)
+                Debug{} << "Peak memory usage:" << peakMemory/1024/1024.0f << "MB";
+        } else if(output) {
+            if(!Utility::Path::write(output, Containers::StringView{formatted})) {
+                Error{} << "Cannot save the profile to" << output;
+                return false;
+            }
+        } else Debug{Debug::Flag::NoNewlineAtTheEnd} << formatted;
+    }
+
+    if(const Containers::StringView trace = args.value<Containers::StringView>("trace")) {
+        if(!Utility::Path::write(trace, Containers::StringView{profileChromeTrace(profiler, totalTime, peakMemory)})) {
+            Error{} << "Cannot save the trace to" << trace;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+}}}
+
+#endif
@@ -0,0 +1,300 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImportCache.h"
+
+#include <cstdlib>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StaticArray.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+#include <Corrade/Utility/Sha1.h>
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+namespace {
+
+struct Entry {
+    Containers::String key;
+    std::size_t size;
+};
+
+bool isValidKey(const Containers::StringView key) {
+    if(key.isEmpty()) return false;
+    for(const char c: key) {
+        if(!((c >= 'a' && c <= 'z') ||
+             (c >= 'A' && c <= 'Z') ||
+             (c >= '0' && c <= '9') ||
+             c == '-' || c == '_' || c == '.'))
+            return false;
+    }
+    return true;
+}
+
+constexpr Containers::StringView IndexFilename = "index.txt"_s;
+constexpr Containers::StringView IndexTemporaryFilename = "index.txt.tmp"_s;
+
+}
+
+struct ImportCache::State {
+    Containers::String entryPath(Containers::StringView key) const {
+        return Utility::Path::join(directory, key + ".blob"_s);
+    }
+
+    /* Moves entry at given index to the back, making it the most recently
+       used */
+    void markUsed(std::size_t i);
+    /* Removes given count of entries from the front together with their
+       files */
+    void removeLeastRecentlyUsed(std::size_t count);
+    /* Removes least recently used entries until the size fits into the
+       limit, returns whether anything was removed */
+    bool evict();
+    void saveIndex() const;
+
+    Containers::String directory;
+    std::size_t sizeLimit;
+    std::size_t size = 0;
+    /* Ordered from the least recently used */
+    Containers::Array<Entry> entries;
+};
+
+void ImportCache::State::markUsed(const std::size_t i) {
+    Entry entry = Utility::move(entries[i]);
+    for(std::size_t j = i + 1; j != entries.size(); ++j)
+        entries[j - 1] = Utility::move(entries[j]);
+    entries.back() = Utility::move(entry);
+}
+
+void ImportCache::State::removeLeastRecentlyUsed(const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        Utility::Path::remove(entryPath(entries[i].key));
+        size -= entries[i].size;
+    }
+    for(std::size_t i = count; i != entries.size(); ++i)
+        entries[i - count] = Utility::move(entries[i]);
+    arrayRemoveSuffix(entries, count);
+}
+
+bool ImportCache::State::evict() {
+    std::size_t evictCount = 0;
+    for(std::size_t size = this->size; size > sizeLimit; ++evictCount)
+        size -= entries[evictCount].size;
+    removeLeastRecentlyUsed(evictCount);
+    return evictCount;
+}
+
+void ImportCache::State::saveIndex() const {
+    Containers::Array<Containers::String> lines;
+    arrayReserve(lines, entries.size());
+    for(const Entry& entry: entries)
+        arrayAppend(lines, Utility::format("{} {}\n", entry.size, entry.key));
+
+    /* The index is written to a temporary file first and then renamed over
+       the original, so an interrupted write never leaves a truncated index
+       behind. Failure is printed by Path::write() or Path::move() already.
+       Not treated as fatal, the worst that can happen is that the eviction
+       order is lost. */
+    const Containers::String index = ""_s.join(lines);
+    const Containers::String temporaryPath = Utility::Path::join(directory, IndexTemporaryFilename);
+    if(Utility::Path::write(temporaryPath, Containers::StringView{index}))
+        Utility::Path::move(temporaryPath, Utility::Path::join(directory, IndexFilename));
+}
+
+Containers::String ImportCache::key(const Containers::ArrayView<const void> data, const Containers::StringView options) {
+    /* Prefix with the data size so data and options with the same
+       concatenation produce a different key */
+    const UnsignedLong size = data.size();
+
+    Utility::Sha1 sha1;
+    sha1 << Containers::ArrayView<const char>{reinterpret_cast<const char*>(&size), sizeof(size)}
+         << Containers::ArrayView<const char>{static_cast<const char*>(data.data()), data.size()}
+         << Containers::ArrayView<const char>{options.data(), options.size()};
+    const Utility::Sha1::Digest digest = sha1.digest();
+
+    const char* const bytes = digest.byteArray();
+    Containers::String out{NoInit, sizeof(digest)*2};
+    for(std::size_t i = 0; i != sizeof(digest); ++i) {
+        out[i*2 + 0] = "0123456789abcdef"[(UnsignedByte(bytes[i]) >> 4) & 0xf];
+        out[i*2 + 1] = "0123456789abcdef"[UnsignedByte(bytes[i]) & 0xf];
+    }
+    return out;
+}
+
+ImportCache::ImportCache(const Containers::StringView directory, const std::size_t sizeLimit): _state{InPlaceInit} {
+    _state->directory = Containers::String::nullTerminatedGlobalView(directory);
+    _state->sizeLimit = sizeLimit;
+
+    const Containers::String indexPath = Utility::Path::join(directory, IndexFilename);
+    if(!Utility::Path::exists(indexPath))
+        return;
+
+    const Containers::Optional<Containers::String> index = Utility::Path::readString(indexPath);
+    if(!index)
+        return;
+
+    /* Each line is a size followed by a space and a key. Lines that don't
+       match or reference a file that doesn't exist are skipped, the index
+       gets rewritten on next find() or store(). If a key is listed more than
+       once, the last occurrence wins, as it's the most recently used. */
+    for(const Containers::StringView line: index->splitWithoutEmptyParts('\n')) {
+        const Containers::Array3<Containers::StringView> sizeKey = line.partition(' ');
+        if(!sizeKey[0] || !sizeKey[1] || !isValidKey(sizeKey[2]))
+            continue;
+
+        /* The line is a view into the null-terminated index string, so
+           strtoull() stops at the space at the latest */
+        char* end;
+        const std::size_t size = std::strtoull(sizeKey[0].data(), &end, 10);
+        if(end != sizeKey[0].end() || !Utility::Path::exists(_state->entryPath(sizeKey[2])))
+            continue;
+
+        for(std::size_t i = 0; i != _state->entries.size(); ++i) {
+            if(_state->entries[i].key != sizeKey[2])
+                continue;
+
+            _state->markUsed(i);
+            _state->size -= _state->entries.back().size;
+            arrayRemoveSuffix(_state->entries, 1);
+            break;
+        }
+
+        arrayAppend(_state->entries, InPlaceInit, Containers::String{sizeKey[2]}, size);
+        _state->size += size;
+    }
+
+    /* The limit may be smaller than what the cache was populated with */
+    if(_state->evict())
+        _state->saveIndex();
+}
+
+ImportCache::ImportCache(ImportCache&&) noexcept = default;
+
+ImportCache::~ImportCache() = default;
+
+ImportCache& ImportCache::operator=(ImportCache&&) noexcept = default;
+
+Containers::StringView ImportCache::directory() const {
+    return _state->directory;
+}
+
+std::size_t ImportCache::sizeLimit() const {
+    return _state->sizeLimit;
+}
+
+std::size_t ImportCache::count() const {
+    return _state->entries.size();
+}
+
+std::size_t ImportCache::size() const {
+    return _state->size;
+}
+
+bool ImportCache::contains(const Containers::StringView key) const {
+    for(const Entry& entry: _state->entries)
+        if(entry.key == key) return true;
+    return false;
+}
+
+Containers::Optional<Containers::Array<char>> ImportCache::find(const Containers::StringView key) {
+    CORRADE_ASSERT(isValidKey(key),
+        "Trade::ImportCache::find(): invalid key" << key, {});
+
+    for(std::size_t i = 0; i != _state->entries.size(); ++i) {
+        if(_state->entries[i].key != key)
+            continue;
+
+        Containers::Optional<Containers::Array<char>> data = Utility::Path::read(_state->entryPath(key));
+        if(!data) {
+            Error{} << "Trade::ImportCache::find(): cannot read entry" << key;
+            _state->markUsed(i);
+            _state->size -= _state->entries.back().size;
+            arrayRemoveSuffix(_state->entries, 1);
+        } else _state->markUsed(i);
+
+        _state->saveIndex();
+        return data;
+    }
+
+    return {};
+}
+
+bool ImportCache::store(const Containers::StringView key, const Containers::ArrayView<const void> data) {
+    CORRADE_ASSERT(isValidKey(key),
+        "Trade::ImportCache::store(): invalid key" << key, {});
+
+    if(data.size() > _state->sizeLimit) {
+        Error{} << "Trade::ImportCache::store(): entry of" << data.size() << "bytes is larger than the size limit of" << _state->sizeLimit << "bytes";
+        return false;
+    }
+
+    if(!Utility::Path::make(_state->directory)) {
+        Error{} << "Trade::ImportCache::store(): cannot create directory" << _state->directory;
+        return false;
+    }
+
+    /* Remove the previous entry with the same key, if any */
+    for(std::size_t i = 0; i != _state->entries.size(); ++i) {
+        if(_state->entries[i].key != key)
+            continue;
+
+        _state->markUsed(i);
+        _state->size -= _state->entries.back().size;
+        arrayRemoveSuffix(_state->entries, 1);
+        break;
+    }
+
+    if(!Utility::Path::write(_state->entryPath(key), data)) {
+        Error{} << "Trade::ImportCache::store(): cannot write entry" << key;
+        _state->saveIndex();
+        return false;
+    }
+
+    arrayAppend(_state->entries, InPlaceInit, Containers::String{key}, data.size());
+    _state->size += data.size();
+
+    /* Evict least recently used entries until the size fits. The new entry
+       alone always fits, as checked above. */
+    _state->evict();
+
+    _state->saveIndex();
+    return true;
+}
+
+void ImportCache::clear() {
+    _state->removeLeastRecentlyUsed(_state->entries.size());
+
+    const Containers::String indexPath = Utility::Path::join(_state->directory, IndexFilename);
+    if(Utility::Path::exists(indexPath))
+        Utility::Path::remove(indexPath);
+}
+
+}}
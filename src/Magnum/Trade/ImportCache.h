@@ -0,0 +1,198 @@
+#ifndef Magnum_Trade_ImportCache_h
+#define Magnum_Trade_ImportCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImportCache
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Persistent on-disk cache for import results
+@m_since_latest
+
+Stores arbitrary binary data in a directory, identified by a key that's
+derived from contents of the input file and options used to process it.
+Meant to be used together with the @ref MagnumSceneConverter and
+@ref MagnumImporter plugins, which serialize imported and processed
+@ref MeshData, @ref ImageData and other data into a binary blob that can be
+imported back without any parsing or copying, thus skipping the original
+import and processing on a cache hit.
+
+@section Trade-ImportCache-usage Usage
+
+A key is created from the input data with @ref key(), together with a string
+describing all options that affect the result. The @ref find() function then
+either returns the cached data or @relativeref{Corrade,Containers::NullOpt},
+in which case the data is imported and processed as usual, serialized and
+put into the cache with @ref store().
+
+@snippet Trade.cpp ImportCache-usage
+
+The @ref magnum-sceneconverter "magnum-sceneconverter" utility exposes this
+functionality through its `--cache-dir` option.
+
+@section Trade-ImportCache-eviction Size limit and eviction
+
+If a @ref store() makes the total size of all entries larger than
+@ref sizeLimit(), least recently used entries are removed until the size
+fits again. An entry is marked as used when it's stored and each time it's
+returned from @ref find(). The order is kept in an index file in the cache
+directory, which gets rewritten on every @ref find() and @ref store(). The
+file is written to a temporary location first and then renamed, so an
+interrupted write doesn't leave a truncated index behind. The limit is
+enforced also on construction, in case the directory was populated with a
+larger limit before.
+
+@section Trade-ImportCache-limitations Limitations
+
+The key is calculated only from the data it's given, so if the input is for
+example a glTF file referencing external buffers and images, changes in the
+referenced files aren't detected. Include their contents in the key as well
+or clear the cache with @ref clear() in that case.
+
+The cache isn't safe for concurrent use from multiple instances or
+processes. Each instance reads the index file only on construction, and
+writes it without any locking.
+*/
+class MAGNUM_TRADE_EXPORT ImportCache {
+    public:
+        /**
+         * @brief Create a cache key
+         *
+         * Calculates a SHA-1 hash of @p data and @p options and returns it
+         * as a 40-character hexadecimal string. The @p options should
+         * describe everything that affects the cached result, such as the
+         * plugin used for import and processing steps done afterwards.
+         */
+        static Containers::String key(Containers::ArrayView<const void> data, Containers::StringView options);
+
+        /**
+         * @brief Constructor
+         * @param directory     Cache directory
+         * @param sizeLimit     Total size limit of all cached entries, in
+         *      bytes
+         *
+         * Reads the index file in @p directory, if it exists. Entries which
+         * are listed in the index but have their file missing are ignored,
+         * entries listed more than once are counted just once. If the total
+         * size of the entries is larger than @p sizeLimit, least recently
+         * used entries are removed until it fits. If @p directory doesn't
+         * exist, the cache is empty and the directory gets created on first
+         * @ref store().
+         */
+        explicit ImportCache(Containers::StringView directory, std::size_t sizeLimit);
+
+        /** @brief Copying is not allowed */
+        ImportCache(const ImportCache&) = delete;
+
+        /** @brief Move constructor */
+        ImportCache(ImportCache&&) noexcept;
+
+        ~ImportCache();
+
+        /** @brief Copying is not allowed */
+        ImportCache& operator=(const ImportCache&) = delete;
+
+        /** @brief Move assignment */
+        ImportCache& operator=(ImportCache&&) noexcept;
+
+        /** @brief Cache directory */
+        Containers::StringView directory() const;
+
+        /** @brief Total size limit of all cached entries */
+        std::size_t sizeLimit() const;
+
+        /** @brief Count of cached entries */
+        std::size_t count() const;
+
+        /** @brief Total size of all cached entries */
+        std::size_t size() const;
+
+        /**
+         * @brief Whether given entry is in the cache
+         *
+         * Unlike @ref find(), doesn't read the data and doesn't mark the
+         * entry as used.
+         */
+        bool contains(Containers::StringView key) const;
+
+        /**
+         * @brief Find an entry
+         *
+         * If @p key is in the cache, reads its data, marks it as the most
+         * recently used and returns the data. Otherwise returns
+         * @relativeref{Corrade,Containers::NullOpt}. If the entry file can't
+         * be read, an error message is printed, the entry is removed from the
+         * cache and @relativeref{Corrade,Containers::NullOpt} is returned.
+         *
+         * The @p key is expected to be non-empty and consist only of ASCII
+         * letters, digits, @cpp '-' @ce, @cpp '_' @ce and @cpp '.' @ce, which
+         * is the case for keys returned from @ref key().
+         */
+        Containers::Optional<Containers::Array<char>> find(Containers::StringView key);
+
+        /**
+         * @brief Store an entry
+         *
+         * Writes @p data to a file in @ref directory(), creating the
+         * directory if it doesn't exist, and marks the entry as the most
+         * recently used. If an entry with the same @p key is already present,
+         * it's replaced. Then, least recently used entries are removed until
+         * @ref size() fits into @ref sizeLimit().
+         *
+         * If @p data is larger than @ref sizeLimit() or if the directory or
+         * file can't be written, an error message is printed and the function
+         * returns @cpp false @ce. Expectations on the @p key are the same as
+         * in @ref find().
+         */
+        bool store(Containers::StringView key, Containers::ArrayView<const void> data);
+
+        /**
+         * @brief Remove all entries
+         *
+         * Deletes all entry files and the index file. The directory itself
+         * is kept.
+         */
+        void clear();
+
+    private:
+        struct State;
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
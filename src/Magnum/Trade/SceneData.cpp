@@ -38,6 +38,7 @@
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Math/FunctionsBatch.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
@@ -788,6 +789,24 @@ Containers::Array<SceneFieldData> sceneFieldDataNonOwningArray(const Containers:
     return Containers::Array<SceneFieldData>{const_cast<SceneFieldData*>(view.data()), view.size(), Implementation::nonOwnedArrayDeleter};
 }
 
+/* Has to be complete before any constructor, destructor or assignment
+   definition, as those may destroy the _objectIndex pointer */
+struct SceneData::ObjectIndex {
+    struct Field {
+        /* `[offsets[i], offsets[i + 1])` is a range in `entries` containing
+           offsets of object `i` in the field, in an ascending order. The last
+           range gathers entries that are out of the mapping bound, as those
+           can't ever be looked up. Both empty if the index isn't built for
+           given field. */
+        Containers::Array<UnsignedInt> offsets;
+        Containers::Array<UnsignedInt> entries;
+    };
+
+    std::size_t memoryBudget = 0;
+    std::size_t memoryUsage = 0;
+    Containers::Array<Field> fields;
+};
+
 SceneData::SceneData(const SceneMappingType mappingType, const UnsignedLong mappingBound, Containers::Array<char>&& data, Containers::Array<SceneFieldData>&& fields, const void* const importerState) noexcept: _dataFlags{DataFlag::Owned|DataFlag::Mutable}, _mappingType{mappingType}, _dimensions{}, _mappingBound{mappingBound}, _importerState{importerState}, _fields{Utility::move(fields)}, _data{Utility::move(data)} {
     /* Check that mapping type is large enough */
     CORRADE_ASSERT(
@@ -1077,6 +1096,8 @@ SceneData& SceneData::operator=(SceneData&&) noexcept = default;
 Containers::ArrayView<char> SceneData::mutableData() & {
     CORRADE_ASSERT(_dataFlags & DataFlag::Mutable,
         "Trade::SceneData::mutableData(): data not mutable", {});
+    /* The mapping may get changed through the returned view */
+    discardObjectIndices();
     return _data;
 }
 
@@ -1183,6 +1204,80 @@ bool SceneData::hasField(const SceneField name) const {
 
 namespace {
 
+/* Max size of the per-thread histograms relative to the field size */
+constexpr std::size_t ObjectIndexParallelMaxHistogramRatio = 8;
+
+std::size_t objectIndexSize(const UnsignedLong mappingBound, const std::size_t fieldSize) {
+    return sizeof(UnsignedInt)*(mappingBound + 2 + fieldSize);
+}
+
+/* Stable counting sort of field offsets by the object they're mapped to,
+   running on given count of threads. Each thread counts its chunk of the
+   mapping into a histogram of its own, the histograms are then converted to
+   output offsets for each chunk, so the result is the same regardless of the
+   thread count. Same as parallelChildrenInto() in SceneTools/Hierarchy.cpp,
+   except that the keys are object IDs. */
+template<class T> void objectIndexInto(const Containers::StridedArrayView1D<const T>& mapping, const UnsignedLong mappingBound, const UnsignedInt threadCount, const Containers::ArrayView<UnsignedInt> offsets, const Containers::ArrayView<UnsignedInt> entries) {
+    /* Objects out of the mapping bound all go to the last key */
+    const std::size_t keyCount = std::size_t(mappingBound) + 1;
+    Containers::Array<UnsignedInt> histograms{ValueInit, keyCount*threadCount};
+    const std::size_t size = mapping.size();
+
+    /* Each thread counts objects in its own chunk of the mapping. Calling
+       parallelFor() with the count equal to the thread count, so each call
+       gets exactly one chunk index. */
+    Magnum::Implementation::parallelFor(threadCount, threadCount, 1, [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        for(std::size_t chunk = chunkBegin; chunk != chunkEnd; ++chunk) {
+            UnsignedInt* const histogram = histograms + chunk*keyCount;
+            for(std::size_t i = size*chunk/threadCount, end = size*(chunk + 1)/threadCount; i != end; ++i)
+                ++histogram[Math::min(UnsignedLong(mapping[i]), mappingBound)];
+        }
+    });
+
+    /* Total count of entries for each key, calculated in parallel over key
+       ranges, put to the offsets array shifted by one */
+    Magnum::Implementation::parallelFor(keyCount, threadCount, Magnum::Implementation::ParallelForMinChunkSize, [&](const std::size_t keyBegin, const std::size_t keyEnd) {
+        for(std::size_t key = keyBegin; key != keyEnd; ++key) {
+            UnsignedInt count = 0;
+            for(std::size_t chunk = 0; chunk != threadCount; ++chunk)
+                count += histograms[chunk*keyCount + key];
+            offsets[key + 1] = count;
+        }
+    });
+
+    /* Convert the total counts to a running offset serially */
+    offsets[0] = 0;
+    for(std::size_t key = 0; key != keyCount; ++key)
+        offsets[key + 1] += offsets[key];
+    CORRADE_INTERNAL_ASSERT(offsets[keyCount] == size);
+
+    /* Convert the per-chunk histograms to output offsets for each chunk,
+       again in parallel over key ranges */
+    Magnum::Implementation::parallelFor(keyCount, threadCount, Magnum::Implementation::ParallelForMinChunkSize, [&](const std::size_t keyBegin, const std::size_t keyEnd) {
+        for(std::size_t key = keyBegin; key != keyEnd; ++key) {
+            UnsignedInt offset = offsets[key];
+            for(std::size_t chunk = 0; chunk != threadCount; ++chunk) {
+                UnsignedInt& count = histograms[chunk*keyCount + key];
+                const UnsignedInt nextOffset = offset + count;
+                count = offset;
+                offset = nextOffset;
+            }
+        }
+    });
+
+    /* Each thread then puts its chunk of field offsets to the output. The
+       ranges are disjoint for each chunk, so there's no synchronization
+       needed, and because the chunks are ordered, the offsets for each
+       object end up being in an ascending order. */
+    Magnum::Implementation::parallelFor(threadCount, threadCount, 1, [&](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        for(std::size_t chunk = chunkBegin; chunk != chunkEnd; ++chunk) {
+            UnsignedInt* const chunkOffsets = histograms + chunk*keyCount;
+            for(std::size_t i = size*chunk/threadCount, end = size*(chunk + 1)/threadCount; i != end; ++i)
+                entries[chunkOffsets[Math::min(UnsignedLong(mapping[i]), mappingBound)]++] = UnsignedInt(i);
+        }
+    });
+}
+
 /* The `objects` view is already adjusted for `offset`, the offset is needed
    only to return the correct value for ImplicitMapping */
 template<class T> std::size_t findObject(const SceneFieldFlags flags, const Containers::StridedArrayView1D<const void>& mapping, const std::size_t offset, const UnsignedLong object) {
@@ -1219,6 +1314,23 @@ template<class T> std::size_t findObject(const SceneFieldFlags flags, const Cont
 }
 
 std::size_t SceneData::findFieldObjectOffsetInternal(const SceneFieldData& field, const UnsignedLong object, const std::size_t offset) const {
+    /* If there's an object index for given field or it can be lazily built,
+       use it. Fields with ordered or implicit mapping don't need any. */
+    if(_objectIndex && !(field._flags >= SceneFieldFlag::OrderedMapping)) {
+        const UnsignedInt fieldId = UnsignedInt(&field - _fields.data());
+        const bool hasIndex = fieldId < _objectIndex->fields.size() && _objectIndex->fields[fieldId].offsets;
+        if(!hasIndex && field._size <= 0xffffffffu && _objectIndex->memoryUsage + objectIndexSize(_mappingBound, field._size) <= _objectIndex->memoryBudget)
+            buildObjectIndexInternal(fieldId, 1);
+
+        if(fieldId < _objectIndex->fields.size() && _objectIndex->fields[fieldId].offsets) {
+            const ObjectIndex::Field& index = _objectIndex->fields[fieldId];
+            for(std::size_t i = index.offsets[object], end = index.offsets[object + 1]; i != end; ++i)
+                if(index.entries[i] >= offset)
+                    return index.entries[i];
+            return field._size;
+        }
+    }
+
     const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field, offset, field._size - offset);
     const SceneMappingType mappingType = field.mappingType();
     if(mappingType == SceneMappingType::UnsignedInt)
@@ -1318,6 +1430,103 @@ bool SceneData::hasFieldObject(const SceneField fieldName, const UnsignedLong ob
     return findFieldObjectOffsetInternal(field, object, 0) != field._size;
 }
 
+void SceneData::buildObjectIndexInternal(const UnsignedInt fieldId, const UnsignedInt threadCount) const {
+    if(!_objectIndex)
+        _objectIndex.emplace();
+    if(_objectIndex->fields.size() != _fields.size())
+        _objectIndex->fields = Containers::Array<ObjectIndex::Field>{_fields.size()};
+
+    ObjectIndex::Field& index = _objectIndex->fields[fieldId];
+    const SceneFieldData& field = _fields[fieldId];
+    if(index.offsets || field._flags >= SceneFieldFlag::OrderedMapping)
+        return;
+
+    index.offsets = Containers::Array<UnsignedInt>{NoInit, std::size_t(_mappingBound) + 2};
+    index.entries = Containers::Array<UnsignedInt>{NoInit, std::size_t(field._size)};
+    /* Each thread needs its own histogram of mappingBound + 1 items. Besides
+       limiting the thread count by the entry count, limit it also so the
+       histograms together don't take more than
+       ObjectIndexParallelMaxHistogramRatio times the field size, and to not
+       have more threads than there would be for processing the histogram
+       itself. Same as in childrenInto() in SceneTools/Hierarchy.cpp. */
+    const std::size_t keyCount = std::size_t(_mappingBound) + 1;
+    UnsignedInt actualThreadCount = Math::min(
+        Magnum::Implementation::parallelForThreadCount(field._size, threadCount, Magnum::Implementation::ParallelForMinChunkSize),
+        Magnum::Implementation::parallelForThreadCount(keyCount, threadCount, Magnum::Implementation::ParallelForMinChunkSize));
+    const std::size_t maxHistogramThreadCount = std::size_t(field._size)*ObjectIndexParallelMaxHistogramRatio/keyCount;
+    if(actualThreadCount > maxHistogramThreadCount)
+        actualThreadCount = Math::max(UnsignedInt(maxHistogramThreadCount), 1u);
+    const Containers::StridedArrayView1D<const void> mapping = fieldDataMappingViewInternal(field);
+    const SceneMappingType mappingType = field.mappingType();
+    if(mappingType == SceneMappingType::UnsignedInt)
+        objectIndexInto(Containers::arrayCast<const UnsignedInt>(mapping), _mappingBound, actualThreadCount, index.offsets, index.entries);
+    else if(mappingType == SceneMappingType::UnsignedShort)
+        objectIndexInto(Containers::arrayCast<const UnsignedShort>(mapping), _mappingBound, actualThreadCount, index.offsets, index.entries);
+    else if(mappingType == SceneMappingType::UnsignedByte)
+        objectIndexInto(Containers::arrayCast<const UnsignedByte>(mapping), _mappingBound, actualThreadCount, index.offsets, index.entries);
+    else if(mappingType == SceneMappingType::UnsignedLong)
+        objectIndexInto(Containers::arrayCast<const UnsignedLong>(mapping), _mappingBound, actualThreadCount, index.offsets, index.entries);
+    else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+
+    _objectIndex->memoryUsage += objectIndexSize(_mappingBound, field._size);
+}
+
+void SceneData::discardObjectIndices() {
+    if(!_objectIndex)
+        return;
+
+    _objectIndex->fields = {};
+    _objectIndex->memoryUsage = 0;
+}
+
+void SceneData::buildObjectIndex(const UnsignedInt fieldId, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(fieldId < _fields.size(),
+        "Trade::SceneData::buildObjectIndex(): index" << fieldId << "out of range for" << _fields.size() << "fields", );
+    CORRADE_ASSERT(_fields[fieldId]._size <= 0xffffffffu,
+        "Trade::SceneData::buildObjectIndex(): field" << _fields[fieldId]._name << "has" << _fields[fieldId]._size << "entries, expected less than 2^32", );
+    buildObjectIndexInternal(fieldId, threadCount);
+}
+
+void SceneData::buildObjectIndex(const SceneField fieldName, const UnsignedInt threadCount) {
+    const UnsignedInt fieldId = findFieldIdInternal(fieldName);
+    CORRADE_ASSERT(fieldId != ~UnsignedInt{},
+        "Trade::SceneData::buildObjectIndex(): field" << fieldName << "not found", );
+    buildObjectIndex(fieldId, threadCount);
+}
+
+void SceneData::buildObjectIndices(const UnsignedInt threadCount) {
+    for(UnsignedInt i = 0; i != _fields.size(); ++i)
+        if(!(_fields[i]._flags >= SceneFieldFlag::OrderedMapping))
+            buildObjectIndex(i, threadCount);
+}
+
+bool SceneData::hasObjectIndex(const UnsignedInt fieldId) const {
+    CORRADE_ASSERT(fieldId < _fields.size(),
+        "Trade::SceneData::hasObjectIndex(): index" << fieldId << "out of range for" << _fields.size() << "fields", {});
+    return _objectIndex && fieldId < _objectIndex->fields.size() && _objectIndex->fields[fieldId].offsets;
+}
+
+bool SceneData::hasObjectIndex(const SceneField fieldName) const {
+    const UnsignedInt fieldId = findFieldIdInternal(fieldName);
+    CORRADE_ASSERT(fieldId != ~UnsignedInt{},
+        "Trade::SceneData::hasObjectIndex(): field" << fieldName << "not found", {});
+    return hasObjectIndex(fieldId);
+}
+
+std::size_t SceneData::objectIndexMemoryBudget() const {
+    return _objectIndex ? _objectIndex->memoryBudget : 0;
+}
+
+void SceneData::setObjectIndexMemoryBudget(const std::size_t bytes) {
+    if(!_objectIndex)
+        _objectIndex.emplace();
+    _objectIndex->memoryBudget = bytes;
+}
+
+std::size_t SceneData::objectIndexMemoryUsage() const {
+    return _objectIndex ? _objectIndex->memoryUsage : 0;
+}
+
 SceneFieldFlags SceneData::fieldFlags(const SceneField name) const {
     const UnsignedInt fieldId = findFieldIdInternal(name);
     CORRADE_ASSERT(fieldId != ~UnsignedInt{}, "Trade::SceneData::fieldFlags(): field" << name << "not found", {});
@@ -1357,6 +1566,9 @@ Containers::StridedArrayView2D<char> SceneData::mutableMapping(const UnsignedInt
         "Trade::SceneData::mutableMapping(): data not mutable", {});
     CORRADE_ASSERT(fieldId < _fields.size(),
         "Trade::SceneData::mutableMapping(): index" << fieldId << "out of range for" << _fields.size() << "fields", {});
+    /* The mapping may get changed through the returned view, and as it can
+       be shared with other fields, discard indices of all of them */
+    discardObjectIndices();
     const SceneFieldData& field = _fields[fieldId];
     /* Build a 2D view using information about attribute type size */
     const auto out = Containers::arrayCast<2, const char>(
@@ -2949,12 +3161,14 @@ std::vector<UnsignedInt> SceneData::children3D() const {
 #endif
 
 Containers::Array<SceneFieldData> SceneData::releaseFieldData() {
+    discardObjectIndices();
     Containers::Array<SceneFieldData> out = Utility::move(_fields);
     _fields = {};
     return out;
 }
 
 Containers::Array<char> SceneData::releaseData() {
+    discardObjectIndices();
     Containers::Array<char> out = Utility::move(_data);
     _data = {};
     return out;
@@ -31,6 +31,7 @@
  */
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Macros.h> /* CORRADE_UNUSED */
 
@@ -822,7 +823,7 @@ MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, SceneFieldFlags value);
 Convenience type for populating @ref SceneData, see
 @ref Trade-SceneData-populating "its documentation" for an introduction.
 Additionally usable in various @ref SceneTools algorithms such as
-@ref SceneTools::combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>).
+@ref SceneTools::combineFields(Trade::SceneMappingType, UnsignedLong, Containers::ArrayView<const Trade::SceneFieldData>, UnsignedInt).
 
 @section Trade-SceneFieldData-usage Usage
 
@@ -1745,7 +1746,12 @@ depending on what @ref SceneFieldFlags are present for given field, it can be
 done in constant, logarithmic or, worst case, linear time. As such, for general
 scene representations these are suited mainly for introspection and debugging
 purposes and retrieving field data for many objects is better achieved by
-accessing the field data directly.
+accessing the field data directly. Alternatively, if many per-object queries
+are needed on fields with an unordered mapping, an inverse object index can be
+built for them with @ref buildObjectIndex() or lazily within a memory budget
+set by @ref setObjectIndexMemoryBudget(), making the lookup time proportional
+just to the count of entries for given object. Another option is sorting the
+mappings with @ref SceneTools::orderMappings().
 
 @section Trade-SceneData-usage-mutable Mutable data access
 
@@ -2248,8 +2254,12 @@ class MAGNUM_TRADE_EXPORT SceneData {
          * done in an @f$ \mathcal{O}(1) @f$ complexity. Otherwise, if the
          * field has @ref SceneFieldFlag::OrderedMapping, the lookup is done in
          * an @f$ \mathcal{O}(\log{} n) @f$ complexity with @f$ n @f$ being the
-         * size of the field. Otherwise, the lookup is done in an
-         * @f$ \mathcal{O}(n) @f$ complexity.
+         * size of the field. Otherwise, if an object index is present for
+         * the field, the lookup is done in an @f$ \mathcal{O}(k) @f$
+         * complexity with @f$ k @f$ being the count of entries for
+         * @p object in the field, and in an @f$ \mathcal{O}(n) @f$
+         * complexity if not. See @ref buildObjectIndex() and
+         * @ref setObjectIndexMemoryBudget() for more information.
          *
          * You can also use @ref findFieldObjectOffset(SceneField, UnsignedLong, std::size_t) const
          * to directly find offset of an object in given named field.
@@ -2326,6 +2336,126 @@ class MAGNUM_TRADE_EXPORT SceneData {
          */
         bool hasFieldObject(SceneField fieldName, UnsignedLong object) const;
 
+        /**
+         * @brief Build an object index for given field
+         * @m_since_latest
+         *
+         * Builds an inverse index from object IDs to offsets in the field
+         * at index @p fieldId. With the index present,
+         * @ref findFieldObjectOffset(), @ref fieldObjectOffset(),
+         * @ref hasFieldObject() and all per-object convenience accessors such
+         * as @ref meshesMaterialsFor() or @ref transformation3DFor() find the
+         * object in an @f$ \mathcal{O}(k) @f$ complexity with @f$ k @f$ being
+         * the count of entries the object has in given field, i.e. usually
+         * constant, instead of a @f$ \mathcal{O}(n) @f$ linear search. The
+         * @p fieldId is expected to be smaller than @ref fieldCount() and the
+         * field is expected to have less than @f$ 2^{32} @f$ entries.
+         *
+         * The index takes @f$ 4(b + n + 2) @f$ bytes, with @f$ b @f$ being
+         * @ref mappingBound() and @f$ n @f$ the field size. If the field has
+         * @ref SceneFieldFlag::OrderedMapping or
+         * @ref SceneFieldFlag::ImplicitMapping, it doesn't benefit from an
+         * index and the function does nothing. It also does nothing if the
+         * index is already built. Alternatively, use
+         * @ref SceneTools::orderMappings() to sort the field data and have
+         * them marked with @ref SceneFieldFlag::OrderedMapping, which allows
+         * for a logarithmic lookup without any extra memory.
+         *
+         * With @p threadCount larger than @cpp 1 @ce, or @cpp 0 @ce to
+         * autodetect it from the hardware concurrency, the index is built
+         * using a parallel counting sort, which needs additional temporary
+         * memory of @p threadCount times @f$ 4(b + 1) @f$ bytes. The index is
+         * the same regardless of the thread count used. Small fields are
+         * always processed on a single thread.
+         *
+         * Calling @ref mutableData() or @ref mutableMapping() discards
+         * indices of all fields, as the object mapping may change through
+         * the returned views.
+         * @see @ref buildObjectIndex(SceneField, UnsignedInt),
+         *      @ref buildObjectIndices(), @ref hasObjectIndex(),
+         *      @ref setObjectIndexMemoryBudget()
+         */
+        void buildObjectIndex(UnsignedInt fieldId, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Build an object index for given named field
+         * @m_since_latest
+         *
+         * Like @ref buildObjectIndex(UnsignedInt, UnsignedInt), but the
+         * @p fieldName is expected to exist.
+         */
+        void buildObjectIndex(SceneField fieldName, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Build an object index for all fields
+         * @m_since_latest
+         *
+         * Calls @ref buildObjectIndex(UnsignedInt, UnsignedInt) for all
+         * fields that don't have @ref SceneFieldFlag::OrderedMapping or
+         * @ref SceneFieldFlag::ImplicitMapping set.
+         */
+        void buildObjectIndices(UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Whether given field has an object index
+         * @m_since_latest
+         *
+         * The @p fieldId is expected to be smaller than @ref fieldCount().
+         * @see @ref buildObjectIndex(), @ref hasObjectIndex(SceneField) const
+         */
+        bool hasObjectIndex(UnsignedInt fieldId) const;
+
+        /**
+         * @brief Whether given named field has an object index
+         * @m_since_latest
+         *
+         * The @p fieldName is expected to exist.
+         * @see @ref buildObjectIndex(), @ref hasField()
+         */
+        bool hasObjectIndex(SceneField fieldName) const;
+
+        /**
+         * @brief Object index memory budget
+         * @m_since_latest
+         *
+         * Default is @cpp 0 @ce, i.e. no object index is built implicitly.
+         * @see @ref setObjectIndexMemoryBudget(),
+         *      @ref objectIndexMemoryUsage()
+         */
+        std::size_t objectIndexMemoryBudget() const;
+
+        /**
+         * @brief Set object index memory budget
+         * @m_since_latest
+         *
+         * If non-zero, the first lookup of an object in a field without
+         * @ref SceneFieldFlag::OrderedMapping or
+         * @ref SceneFieldFlag::ImplicitMapping through
+         * @ref findFieldObjectOffset() and related APIs lazily builds an
+         * object index for it on a single thread, as long as the total
+         * memory used by all indices stays within @p bytes. Fields that don't
+         * fit into the budget are searched linearly. See
+         * @ref buildObjectIndex() for details about the index size.
+         *
+         * As the index gets built from @cpp const @ce functions, with a
+         * non-zero budget it's no longer safe to query the instance from
+         * multiple threads at the same time. If that's needed, build the
+         * indices upfront with @ref buildObjectIndex() or
+         * @ref buildObjectIndices() instead. Lowering the budget doesn't
+         * discard already built indices.
+         */
+        void setObjectIndexMemoryBudget(std::size_t bytes);
+
+        /**
+         * @brief Object index memory usage
+         * @m_since_latest
+         *
+         * Total size of all object indices built either explicitly with
+         * @ref buildObjectIndex() or lazily with a non-zero
+         * @ref objectIndexMemoryBudget(), in bytes.
+         */
+        std::size_t objectIndexMemoryUsage() const;
+
         /**
          * @brief Flags of a named field
          * @m_since_latest
@@ -3817,6 +3947,11 @@ class MAGNUM_TRADE_EXPORT SceneData {
         MAGNUM_TRADE_LOCAL void meshesMaterialsIntoInternal(UnsignedInt fieldId, std::size_t offset, const Containers::StridedArrayView1D<UnsignedInt>& meshDestination, const Containers::StridedArrayView1D<Int>& meshMaterialDestination) const;
         MAGNUM_TRADE_LOCAL void importerStateIntoInternal(const UnsignedInt fieldId, std::size_t offset, const Containers::StridedArrayView1D<const void*>& destination) const;
 
+        MAGNUM_TRADE_LOCAL void buildObjectIndexInternal(UnsignedInt fieldId, UnsignedInt threadCount) const;
+        MAGNUM_TRADE_LOCAL void discardObjectIndices();
+
+        struct ObjectIndex;
+
         DataFlags _dataFlags;
         SceneMappingType _mappingType;
         UnsignedByte _dimensions;
@@ -3825,6 +3960,9 @@ class MAGNUM_TRADE_EXPORT SceneData {
         const void* _importerState;
         Containers::Array<SceneFieldData> _fields;
         Containers::Array<char> _data;
+        /* Built either explicitly or lazily from const lookup functions,
+           null if no index was requested */
+        mutable Containers::Pointer<ObjectIndex> _objectIndex;
 };
 
 namespace Implementation {
@@ -26,6 +26,7 @@
 
 #include <string> /** @todo remove once file callbacks are std::string-free */
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are std::string-free */
@@ -43,7 +44,9 @@
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/PhongMaterialData.h"
@@ -90,6 +93,8 @@ struct AbstractImporterTest: TestSuite::Tester {
     void setFlagsFileOpened();
     void setFlagsNotImplemented();
 
+    void setArena();
+
     void openDataMemory();
     void openDataMemoryFailed();
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -283,6 +288,19 @@ struct AbstractImporterTest: TestSuite::Tester {
     void meshCustomIndexDataDeleter();
     void meshCustomVertexDataDeleter();
     void meshCustomAttributesDeleter();
+    void meshArena();
+    void meshArenaNotSupported();
+    void meshChunks();
+    void meshChunksIndexed();
+    void meshChunksFits();
+    void meshChunksNotSplittable();
+    void meshChunksFailed();
+    void meshChunksAbort();
+    void meshChunksCustomImplementation();
+    void meshChunksOutOfRange();
+    void meshChunksLevelOutOfRange();
+    void meshChunksZeroSize();
+    void meshChunksCustomDeleter();
 
     void meshAttributeName();
     void meshAttributeNameNotImplemented();
@@ -370,6 +388,11 @@ struct AbstractImporterTest: TestSuite::Tester {
     void image2DNonOwningDeleter();
     void image2DGrowableDeleter();
     void image2DCustomDeleter();
+    void image2DProperties();
+    void image2DPropertiesFailed();
+    void image2DPropertiesCustomImplementation();
+    void image2DPropertiesOutOfRange();
+    void image2DPropertiesLevelOutOfRange();
 
     void image3D();
     void image3DFailed();
@@ -446,7 +469,9 @@ AbstractImporterTest::AbstractImporterTest() {
 
               &AbstractImporterTest::setFlags,
               &AbstractImporterTest::setFlagsFileOpened,
-              &AbstractImporterTest::setFlagsNotImplemented});
+              &AbstractImporterTest::setFlagsNotImplemented,
+
+              &AbstractImporterTest::setArena});
 
     addInstancedTests({&AbstractImporterTest::openDataMemory},
         Containers::arraySize(OpenDataMemoryData));
@@ -660,6 +685,19 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::meshCustomIndexDataDeleter,
               &AbstractImporterTest::meshCustomVertexDataDeleter,
               &AbstractImporterTest::meshCustomAttributesDeleter,
+              &AbstractImporterTest::meshArena,
+              &AbstractImporterTest::meshArenaNotSupported,
+              &AbstractImporterTest::meshChunks,
+              &AbstractImporterTest::meshChunksIndexed,
+              &AbstractImporterTest::meshChunksFits,
+              &AbstractImporterTest::meshChunksNotSplittable,
+              &AbstractImporterTest::meshChunksFailed,
+              &AbstractImporterTest::meshChunksAbort,
+              &AbstractImporterTest::meshChunksCustomImplementation,
+              &AbstractImporterTest::meshChunksOutOfRange,
+              &AbstractImporterTest::meshChunksLevelOutOfRange,
+              &AbstractImporterTest::meshChunksZeroSize,
+              &AbstractImporterTest::meshChunksCustomDeleter,
 
               &AbstractImporterTest::meshAttributeName,
               &AbstractImporterTest::meshAttributeNameNotImplemented,
@@ -747,6 +785,11 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image2DNonOwningDeleter,
               &AbstractImporterTest::image2DGrowableDeleter,
               &AbstractImporterTest::image2DCustomDeleter,
+              &AbstractImporterTest::image2DProperties,
+              &AbstractImporterTest::image2DPropertiesFailed,
+              &AbstractImporterTest::image2DPropertiesCustomImplementation,
+              &AbstractImporterTest::image2DPropertiesOutOfRange,
+              &AbstractImporterTest::image2DPropertiesLevelOutOfRange,
 
               &AbstractImporterTest::image3D,
               &AbstractImporterTest::image3DFailed,
@@ -923,6 +966,31 @@ void AbstractImporterTest::setFlagsNotImplemented() {
     /* Should just work, no need to implement the function */
 }
 
+void AbstractImporterTest::setArena() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        void doSetArena(DataArena* arena) override {
+            _arena = arena;
+        }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        DataArena* _arena{};
+    } importer;
+    CORRADE_COMPARE(importer.arena(), nullptr);
+    CORRADE_COMPARE(importer._arena, nullptr);
+
+    /* Unlike flags, the arena can be set with a file opened */
+    DataArena arena;
+    importer.setArena(&arena);
+    CORRADE_COMPARE(importer.arena(), &arena);
+    CORRADE_COMPARE(importer._arena, &arena);
+
+    importer.setArena(nullptr);
+    CORRADE_COMPARE(importer.arena(), nullptr);
+    CORRADE_COMPARE(importer._arena, nullptr);
+}
+
 void AbstractImporterTest::openDataMemory() {
     auto&& data = OpenDataMemoryData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -2099,6 +2167,7 @@ void AbstractImporterTest::thingNoFile() {
 
     importer.mesh(42);
     importer.mesh("foo");
+    importer.meshChunks(42, 0, 1024, [](MeshData&&, void*) { return true; });
     importer.material(42);
     importer.material("foo");
     importer.texture(42);
@@ -2110,6 +2179,9 @@ void AbstractImporterTest::thingNoFile() {
     importer.image2D("foo");
     importer.image3D(42);
     importer.image3D("foo");
+    importer.image1DProperties(42);
+    importer.image2DProperties(42);
+    importer.image3DProperties(42);
 
     importer.importerState();
 
@@ -2131,6 +2203,7 @@ void AbstractImporterTest::thingNoFile() {
 
         "Trade::AbstractImporter::mesh(): no file opened\n"
         "Trade::AbstractImporter::mesh(): no file opened\n"
+        "Trade::AbstractImporter::meshChunks(): no file opened\n"
         "Trade::AbstractImporter::material(): no file opened\n"
         "Trade::AbstractImporter::material(): no file opened\n"
         "Trade::AbstractImporter::texture(): no file opened\n"
@@ -2142,6 +2215,9 @@ void AbstractImporterTest::thingNoFile() {
         "Trade::AbstractImporter::image2D(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
         "Trade::AbstractImporter::image3D(): no file opened\n"
+        "Trade::AbstractImporter::image1DProperties(): no file opened\n"
+        "Trade::AbstractImporter::image2DProperties(): no file opened\n"
+        "Trade::AbstractImporter::image3DProperties(): no file opened\n"
 
         "Trade::AbstractImporter::importerState(): no file opened\n");
 }
@@ -6307,6 +6383,448 @@ void AbstractImporterTest::meshCustomAttributesDeleter() {
     );
 }
 
+void AbstractImporterTest::meshArena() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            const UnsignedByte indices[]{2, 0, 1};
+            const Vector2 positions[]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+
+            /* Allocate from the arena if there's one */
+            if(arena()) {
+                Containers::ArrayView<char> indexData = arena()->copy(indices);
+                Containers::ArrayView<char> vertexData = arena()->copy(positions);
+                return MeshData{MeshPrimitive::Triangles,
+                    DataFlag::ExternallyOwned|DataFlag::Mutable, indexData, MeshIndexData{Containers::arrayCast<UnsignedByte>(indexData)},
+                    DataFlag::ExternallyOwned|DataFlag::Mutable, vertexData, {
+                        MeshAttributeData{MeshAttribute::Position, Containers::arrayCast<Vector2>(vertexData)}
+                    }};
+            }
+
+            Containers::Array<char> indexData{InPlaceInit, Containers::arrayCast<const char>(Containers::arrayView(indices))};
+            Containers::Array<char> vertexData{InPlaceInit, Containers::arrayCast<const char>(Containers::arrayView(positions))};
+            MeshIndexData meshIndices{Containers::arrayCast<UnsignedByte>(indexData)};
+            MeshAttributeData positionAttribute{MeshAttribute::Position, Containers::arrayCast<Vector2>(vertexData)};
+            return MeshData{MeshPrimitive::Triangles,
+                Utility::move(indexData), meshIndices,
+                Utility::move(vertexData), {positionAttribute}};
+        }
+    } importer;
+
+    DataArena arena;
+    importer.setArena(&arena);
+    CORRADE_COMPARE(importer.arena(), &arena);
+
+    /* The data allocated by the implementation from the arena are passed
+       through as-is */
+    Containers::Optional<MeshData> data = importer.mesh(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->indexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE_AS(data->indices<UnsignedByte>(), Containers::arrayView<UnsignedByte>({
+        2, 0, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(data->attribute<Vector2>(MeshAttribute::Position), Containers::arrayView<Vector2>({
+        {1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(arena.size(), 3 + 3*sizeof(Vector2));
+    CORRADE_COMPARE(arena.blockCount(), 1);
+
+    /* Resetting the arena back makes the implementation return owned data
+       again */
+    importer.setArena(nullptr);
+    CORRADE_COMPARE(importer.arena(), nullptr);
+
+    Containers::Optional<MeshData> owned = importer.mesh(0);
+    CORRADE_VERIFY(owned);
+    CORRADE_COMPARE(owned->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(owned->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(arena.size(), 3 + 3*sizeof(Vector2));
+}
+
+void AbstractImporterTest::meshArenaNotSupported() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> indexData{InPlaceInit, {2, 0, 1}};
+            MeshIndexData indices{Containers::arrayCast<UnsignedByte>(indexData)};
+            Containers::Array<char> vertexData{ValueInit, 3*sizeof(Vector2)};
+            MeshAttributeData positions{MeshAttribute::Position, Containers::arrayCast<Vector2>(vertexData)};
+            indexDataPointer = indexData.data();
+            vertexDataPointer = vertexData.data();
+            return MeshData{MeshPrimitive::Triangles,
+                Utility::move(indexData), indices,
+                Utility::move(vertexData), {positions}};
+        }
+
+        const void* indexDataPointer{};
+        const void* vertexDataPointer{};
+    } importer;
+
+    DataArena arena;
+    importer.setArena(&arena);
+
+    /* An implementation that ignores the arena gets its data returned
+       untouched, nothing is copied into the arena */
+    Containers::Optional<MeshData> data = importer.mesh(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(static_cast<const void*>(data->indexData().data()), importer.indexDataPointer);
+    CORRADE_COMPARE(static_cast<const void*>(data->vertexData().data()), importer.vertexDataPointer);
+    CORRADE_COMPARE(arena.size(), 0);
+    CORRADE_COMPARE(arena.blockCount(), 0);
+}
+
+void AbstractImporterTest::meshChunks() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Triangles,
+                DataFlags{}, positions, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+                }};
+        }
+
+        Vector2 positions[12]{
+            {0.0f, 0.0f}, {0.0f, 1.0f}, {0.0f, 2.0f},
+            {1.0f, 0.0f}, {1.0f, 1.0f}, {1.0f, 2.0f},
+            {2.0f, 0.0f}, {2.0f, 1.0f}, {2.0f, 2.0f},
+            {3.0f, 0.0f}, {3.0f, 1.0f}, {3.0f, 2.0f},
+        };
+    } importer;
+
+    struct {
+        UnsignedInt chunkCount = 0;
+        Containers::Array<Vector2> positions;
+    } state;
+
+    /* 50 bytes fit six vertices but only two whole triangles, so there's
+       two chunks. Using the templated overload to verify it works. */
+    CORRADE_VERIFY(importer.meshChunks(0, 0, 50, [](MeshData&& chunk, decltype(state)& state) {
+        CORRADE_COMPARE(chunk.primitive(), MeshPrimitive::Triangles);
+        CORRADE_VERIFY(!chunk.isIndexed());
+        CORRADE_COMPARE(chunk.vertexCount(), 6);
+        CORRADE_COMPARE(chunk.attributeCount(), 1);
+        CORRADE_COMPARE(chunk.vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        for(const Vector2& position: chunk.attribute<Vector2>(MeshAttribute::Position))
+            arrayAppend(state.positions, position);
+        ++state.chunkCount;
+        return true;
+    }, state));
+    CORRADE_COMPARE(state.chunkCount, 2);
+    CORRADE_COMPARE_AS(state.positions, Containers::arrayView(importer.positions),
+        TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::meshChunksIndexed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Triangles,
+                DataFlags{}, indices, MeshIndexData{indices},
+                DataFlags{}, vertices, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::stridedArrayView(vertices).slice(&Vertex::position)},
+                    MeshAttributeData{MeshAttribute::ObjectId, Containers::stridedArrayView(vertices).slice(&Vertex::objectId)}
+                }};
+        }
+
+        UnsignedShort indices[9]{
+            0, 1, 2,
+            0, 2, 3,
+            3, 2, 1
+        };
+        struct Vertex {
+            Vector2 position;
+            UnsignedShort objectId;
+        } vertices[4]{
+            {{0.0f, 0.0f}, 10},
+            {{1.0f, 0.0f}, 11},
+            {{1.0f, 1.0f}, 12},
+            {{0.0f, 1.0f}, 13}
+        };
+    } importer;
+
+    struct Chunk {
+        Containers::Array<UnsignedInt> indices;
+        Containers::Array<Vector2> positions;
+        Containers::Array<UnsignedInt> objectIds;
+    };
+    Containers::Array<Chunk> chunks;
+
+    /* Each index can reference a different vertex in the worst case, so for
+       10 bytes per vertex and 4 bytes per index there's exactly one triangle
+       in 40 bytes */
+    CORRADE_VERIFY(importer.meshChunks(0, 0, 40, [](MeshData&& chunk, void* userData) {
+        CORRADE_COMPARE(chunk.primitive(), MeshPrimitive::Triangles);
+        CORRADE_VERIFY(chunk.isIndexed());
+        CORRADE_COMPARE(chunk.indexType(), MeshIndexType::UnsignedInt);
+        CORRADE_COMPARE(chunk.indexCount(), 3);
+        /* The attributes are interleaved without any padding */
+        CORRADE_COMPARE(chunk.attributeStride(MeshAttribute::Position), 10);
+        CORRADE_COMPARE(chunk.attributeOffset(MeshAttribute::ObjectId), 8);
+        arrayAppend(*static_cast<Containers::Array<Chunk>*>(userData), Chunk{
+            chunk.indicesAsArray(),
+            chunk.positions2DAsArray(),
+            chunk.objectIdsAsArray()});
+        return true;
+    }, &chunks));
+    CORRADE_COMPARE(chunks.size(), 3);
+
+    /* Only the vertices referenced by each chunk are present, in their
+       original order */
+    CORRADE_COMPARE_AS(chunks[0].indices, Containers::arrayView<UnsignedInt>({
+        0, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[0].positions, Containers::arrayView<Vector2>({
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[0].objectIds, Containers::arrayView<UnsignedInt>({
+        10, 11, 12
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(chunks[1].indices, Containers::arrayView<UnsignedInt>({
+        0, 1, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[1].positions, Containers::arrayView<Vector2>({
+        {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[1].objectIds, Containers::arrayView<UnsignedInt>({
+        10, 12, 13
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE_AS(chunks[2].indices, Containers::arrayView<UnsignedInt>({
+        2, 1, 0
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[2].positions, Containers::arrayView<Vector2>({
+        {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[2].objectIds, Containers::arrayView<UnsignedInt>({
+        11, 12, 13
+    }), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::meshChunksFits() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Triangles,
+                DataFlags{}, indexData, MeshIndexData{indexData},
+                DataFlags{}, positions, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+                }};
+        }
+
+        UnsignedByte indexData[3]{2, 0, 1};
+        Vector2 positions[3]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+    } importer;
+
+    /* The whole mesh is 27 bytes, so it's passed through as-is */
+    Int called = 0;
+    CORRADE_VERIFY(importer.meshChunks(0, 0, 27, [](MeshData&& chunk, Int& called) {
+        CORRADE_COMPARE(chunk.indexType(), MeshIndexType::UnsignedByte);
+        CORRADE_COMPARE(chunk.vertexDataFlags(), DataFlags{});
+        CORRADE_COMPARE(chunk.vertexCount(), 3);
+        ++called;
+        return true;
+    }, called));
+    CORRADE_COMPARE(called, 1);
+}
+
+void AbstractImporterTest::meshChunksNotSplittable() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::TriangleStrip,
+                DataFlags{}, positions, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+                }};
+        }
+
+        Vector2 positions[4]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}, {7.0f, 8.0f}};
+    } importer;
+
+    /* A strip can't be split at an arbitrary place, so it's passed through
+       as a whole even though it's over the budget */
+    Int called = 0;
+    CORRADE_VERIFY(importer.meshChunks(0, 0, 8, [](MeshData&& chunk, Int& called) {
+        CORRADE_COMPARE(chunk.primitive(), MeshPrimitive::TriangleStrip);
+        CORRADE_COMPARE(chunk.vertexCount(), 4);
+        ++called;
+        return true;
+    }, called));
+    CORRADE_COMPARE(called, 1);
+}
+
+void AbstractImporterTest::meshChunksFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return {};
+        }
+    } importer;
+
+    Int called = 0;
+    CORRADE_VERIFY(!importer.meshChunks(0, 0, 1024, [](MeshData&&, Int& called) {
+        ++called;
+        return true;
+    }, called));
+    CORRADE_COMPARE(called, 0);
+}
+
+void AbstractImporterTest::meshChunksAbort() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+            return MeshData{MeshPrimitive::Points,
+                DataFlags{}, positions, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+                }};
+        }
+
+        Vector2 positions[4]{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}, {7.0f, 8.0f}};
+    } importer;
+
+    /* Each point is a separate chunk, returning false from the callback
+       stops the import after the second one */
+    Int called = 0;
+    CORRADE_VERIFY(!importer.meshChunks(0, 0, 8, [](MeshData&&, Int& called) {
+        return ++called != 2;
+    }, called));
+    CORRADE_COMPARE(called, 2);
+}
+
+void AbstractImporterTest::meshChunksCustomImplementation() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 2; }
+        UnsignedInt doMeshLevelCount(UnsignedInt) override { return 3; }
+        bool doMeshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&&, void*), void* userData) override {
+            CORRADE_COMPARE(id, 1);
+            CORRADE_COMPARE(level, 2);
+            CORRADE_COMPARE(maxChunkSize, 1024);
+            return callback(MeshData{MeshPrimitive::Points, 1}, userData) &&
+                   callback(MeshData{MeshPrimitive::Points, 2}, userData);
+        }
+    } importer;
+
+    UnsignedInt vertexCount = 0;
+    CORRADE_VERIFY(importer.meshChunks(1, 2, 1024, [](MeshData&& chunk, UnsignedInt& vertexCount) {
+        vertexCount += chunk.vertexCount();
+        return true;
+    }, vertexCount));
+    CORRADE_COMPARE(vertexCount, 3);
+}
+
+void AbstractImporterTest::meshChunksOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.meshChunks(8, 0, 1024, [](MeshData&&, void*) { return true; });
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::meshChunks(): index 8 out of range for 8 entries\n");
+}
+
+void AbstractImporterTest::meshChunksLevelOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 8; }
+        UnsignedInt doMeshLevelCount(UnsignedInt) override { return 3; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.meshChunks(7, 3, 1024, [](MeshData&&, void*) { return true; });
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::meshChunks(): level 3 out of range for 3 entries\n");
+}
+
+void AbstractImporterTest::meshChunksZeroSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.meshChunks(0, 0, 0, [](MeshData&&, void*) { return true; });
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::meshChunks(): expected a non-zero chunk size\n");
+}
+
+void AbstractImporterTest::meshChunksCustomDeleter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 1; }
+        bool doMeshChunks(UnsignedInt, UnsignedInt, std::size_t, bool(*callback)(MeshData&&, void*), void* userData) override {
+            return callback(MeshData{MeshPrimitive::Triangles, Containers::Array<char>{data, 1, [](char*, std::size_t) {}}, MeshIndexData{MeshIndexType::UnsignedByte, data}, 1}, userData);
+        }
+
+        char data[1];
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.meshChunks(0, 0, 1024, [](MeshData&&, void*) { return true; }));
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::meshChunks(): implementation is not allowed to use a custom Array deleter\n");
+}
+
 void AbstractImporterTest::meshAttributeName() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7877,6 +8395,100 @@ void AbstractImporterTest::image2DCustomDeleter() {
         "Trade::AbstractImporter::image2D(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::image2DProperties() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override {
+            if(id == 7 && level == 2)
+                return ImageData2D{PixelFormat::RG8Unorm, {2, 1}, Containers::Array<char>{NoInit, 4}, ImageFlag2D::Array};
+            return {};
+        }
+    } importer;
+
+    Containers::Optional<ImageProperties2D> properties = importer.image2DProperties(7, 2);
+    CORRADE_VERIFY(properties);
+    CORRADE_VERIFY(!properties->isCompressed());
+    CORRADE_COMPARE(properties->format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(properties->flags(), ImageFlag2D::Array);
+}
+
+void AbstractImporterTest::image2DPropertiesFailed() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            return {};
+        }
+    } importer;
+
+    /* The importer is expected to print an error message on its own */
+    CORRADE_VERIFY(!importer.image2DProperties(0));
+}
+
+void AbstractImporterTest::image2DPropertiesCustomImplementation() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageProperties2D> doImage2DProperties(UnsignedInt, UnsignedInt) override {
+            return ImageProperties2D{CompressedPixelFormat::Bc1RGBAUnorm, {16, 8}};
+        }
+        /* doImage2D() isn't implemented and thus would assert if called */
+    } importer;
+
+    Containers::Optional<ImageProperties2D> properties = importer.image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_VERIFY(properties->isCompressed());
+    CORRADE_COMPARE(properties->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{16, 8}));
+}
+
+void AbstractImporterTest::image2DPropertiesOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.image2DProperties(8);
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::image2DProperties(): index 8 out of range for 8 entries\n");
+}
+
+void AbstractImporterTest::image2DPropertiesLevelOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 8; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 3; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.image2DProperties(7, 3);
+    CORRADE_COMPARE(out, "Trade::AbstractImporter::image2DProperties(): level 3 out of range for 3 entries\n");
+}
+
 void AbstractImporterTest::image3D() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
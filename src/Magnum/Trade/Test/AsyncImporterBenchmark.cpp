@@ -0,0 +1,111 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct AsyncImporterBenchmark: TestSuite::Tester {
+    explicit AsyncImporterBenchmark();
+
+    void load();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadCountData[]{
+    {"single thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+
+/* Large enough for the parallel processing to make sense */
+constexpr UnsignedInt MeshCount = 2000;
+
+/* Simulates a CPU-bound importer such as one decoding compressed data. Each
+   byte of the opened data is one mesh. */
+struct FakeImporter: AbstractImporter {
+    ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+    bool doIsOpened() const override { return _count; }
+    void doClose() override { _count = 0; }
+    void doOpenData(Containers::Array<char>&& data, DataFlags) override {
+        _count = data.size();
+    }
+
+    UnsignedInt doMeshCount() const override { return _count; }
+    Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+        volatile UnsignedInt out = id;
+        for(UnsignedInt i = 0; i != 20000; ++i)
+            out = out*31 + i;
+        return MeshData{MeshPrimitive::Points, id};
+    }
+
+    UnsignedInt _count = 0;
+};
+
+AsyncImporterBenchmark::AsyncImporterBenchmark() {
+    addInstancedBenchmarks({&AsyncImporterBenchmark::load}, 5,
+        Containers::arraySize(ThreadCountData));
+}
+
+void AsyncImporterBenchmark::load() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    for(UnsignedInt i = 0; i != data.threadCount; ++i)
+        arrayAppend(importers, Containers::pointer<FakeImporter>());
+    AsyncImporter importer{Utility::move(importers)};
+
+    const Containers::Array<char> file{ValueInit, MeshCount};
+    CORRADE_VERIFY(importer.openData(file));
+
+    UnsignedInt vertexCount = 0;
+    CORRADE_BENCHMARK(1) {
+        vertexCount = 0;
+        const UnsignedInt first = importer.jobCount();
+        for(UnsignedInt i = 0; i != MeshCount; ++i)
+            importer.loadMesh(i);
+        for(UnsignedInt i = 0; i != MeshCount; ++i)
+            vertexCount += importer.takeMesh(first + i)->vertexCount();
+    }
+
+    CORRADE_COMPARE(vertexCount, MeshCount*(MeshCount - 1)/2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImporterBenchmark)
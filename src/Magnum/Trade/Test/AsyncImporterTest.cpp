@@ -0,0 +1,771 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct AsyncImporterTest: TestSuite::Tester {
+    explicit AsyncImporterTest();
+
+    void debugJobState();
+
+    void construct();
+    void constructNoImporters();
+    void constructNullImporter();
+    void constructOpenedImporter();
+    void constructMove();
+    void tryCreateLoadFailed();
+
+    void openData();
+    void openDataNotSupported();
+    void openDataFailed();
+    void openFile();
+    void openFileUserCallback();
+    void close();
+
+    void loadAllTypes();
+    void loadNotOpened();
+    void loadOutOfRange();
+
+    void priority();
+    void cancel();
+    void failed();
+    void takeTwice();
+    void takeWrongType();
+    void jobOutOfRange();
+
+    void stress();
+};
+
+/* Mirrors the condition in AsyncImporter.cpp */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+constexpr bool HasThreads = true;
+#else
+constexpr bool HasThreads = false;
+#endif
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} StressData[]{
+    {"single thread", 1},
+    {"2 threads", 2},
+    {"7 threads", 7},
+};
+
+/* Each byte of the opened data describes one resource of every type. The
+   value is the amount of busy work done when importing it, zero means
+   the import fails. */
+struct FakeImporter: AbstractImporter {
+    explicit FakeImporter(Containers::Array<UnsignedInt>* order = nullptr, bool failOpen = false): order{order}, failOpen{failOpen} {}
+
+    ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+    bool doIsOpened() const override { return opened; }
+    void doClose() override {
+        opened = false;
+        data = nullptr;
+    }
+
+    void doOpenData(Containers::Array<char>&& data_, DataFlags) override {
+        if(failOpen) {
+            Error{} << "FakeImporter: open failed";
+            return;
+        }
+
+        opened = true;
+        dataPointer = data_.data();
+        data = Containers::Array<char>{NoInit, data_.size()};
+        Utility::copy(data_, data);
+    }
+
+    UnsignedInt doSceneCount() const override { return data.size(); }
+    Containers::Optional<SceneData> doScene(UnsignedInt id) override {
+        if(!work(id)) return {};
+        return SceneData{SceneMappingType::UnsignedInt, id, nullptr, {}};
+    }
+
+    UnsignedInt doMeshCount() const override { return data.size(); }
+    UnsignedInt doMeshLevelCount(UnsignedInt) override { return 2; }
+    Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override {
+        if(!work(id)) return {};
+        return MeshData{MeshPrimitive::Points, id*10 + level};
+    }
+
+    UnsignedInt doMaterialCount() const override { return data.size(); }
+    Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override {
+        if(!work(id)) return {};
+        return MaterialData{MaterialType::Flat, {
+            {MaterialAttribute::AlphaMask, Float(id)}
+        }};
+    }
+
+    UnsignedInt doImage1DCount() const override { return data.size(); }
+    Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt) override {
+        if(!work(id)) return {};
+        return ImageData1D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, Int(id), Containers::Array<char>{ValueInit, id}};
+    }
+
+    UnsignedInt doImage2DCount() const override { return data.size(); }
+    Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt) override {
+        if(!work(id)) return {};
+        return ImageData2D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {Int(id), 1}, Containers::Array<char>{ValueInit, id}};
+    }
+
+    UnsignedInt doImage3DCount() const override { return data.size(); }
+    Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt) override {
+        if(!work(id)) return {};
+        return ImageData3D{PixelStorage{}.setAlignment(1), PixelFormat::R8Unorm, {Int(id), 1, 1}, Containers::Array<char>{ValueInit, id}};
+    }
+
+    bool work(UnsignedInt id) {
+        if(order) arrayAppend(*order, id);
+
+        const UnsignedByte amount = data[id];
+        if(!amount) {
+            Error{} << "FakeImporter: import of" << id << "failed";
+            return false;
+        }
+
+        /* Some busy work that the compiler can't optimize away */
+        volatile UnsignedInt out = id;
+        for(UnsignedInt i = 0; i != amount*100u; ++i)
+            out = out*31 + i;
+        return true;
+    }
+
+    Containers::Array<UnsignedInt>* order;
+    bool failOpen;
+    bool opened = false;
+    const char* dataPointer = nullptr;
+    Containers::Array<char> data;
+};
+
+Containers::Array<Containers::Pointer<AbstractImporter>> fakeImporters(UnsignedInt count, Containers::Array<UnsignedInt>* order = nullptr) {
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    for(UnsignedInt i = 0; i != count; ++i)
+        arrayAppend(importers, Containers::pointer<FakeImporter>(order));
+    return importers;
+}
+
+AsyncImporterTest::AsyncImporterTest() {
+    addTests({&AsyncImporterTest::debugJobState,
+
+              &AsyncImporterTest::construct,
+              &AsyncImporterTest::constructNoImporters,
+              &AsyncImporterTest::constructNullImporter,
+              &AsyncImporterTest::constructOpenedImporter,
+              &AsyncImporterTest::constructMove,
+              &AsyncImporterTest::tryCreateLoadFailed,
+
+              &AsyncImporterTest::openData,
+              &AsyncImporterTest::openDataNotSupported,
+              &AsyncImporterTest::openDataFailed,
+              &AsyncImporterTest::openFile,
+              &AsyncImporterTest::openFileUserCallback,
+              &AsyncImporterTest::close,
+
+              &AsyncImporterTest::loadAllTypes,
+              &AsyncImporterTest::loadNotOpened,
+              &AsyncImporterTest::loadOutOfRange,
+
+              &AsyncImporterTest::priority,
+              &AsyncImporterTest::cancel,
+              &AsyncImporterTest::failed,
+              &AsyncImporterTest::takeTwice,
+              &AsyncImporterTest::takeWrongType,
+              &AsyncImporterTest::jobOutOfRange});
+
+    addInstancedTests({&AsyncImporterTest::stress},
+        Containers::arraySize(StressData));
+}
+
+void AsyncImporterTest::debugJobState() {
+    Containers::String out;
+    Debug{&out} << AsyncImporterJobState::Cancelled << AsyncImporterJobState(0xde);
+    CORRADE_COMPARE(out, "Trade::AsyncImporterJobState::Cancelled Trade::AsyncImporterJobState(0xde)\n");
+}
+
+void AsyncImporterTest::construct() {
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers = fakeImporters(3);
+    AbstractImporter* first = importers[0].get();
+
+    AsyncImporter importer{Utility::move(importers)};
+    CORRADE_COMPARE(importer.threadCount(), HasThreads ? 3 : 1);
+    CORRADE_COMPARE(&importer.importer(), first);
+    CORRADE_VERIFY(!importer.isOpened());
+    CORRADE_COMPARE(importer.jobCount(), 0);
+}
+
+void AsyncImporterTest::constructNoImporters() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    AsyncImporter{Containers::Array<Containers::Pointer<AbstractImporter>>{}};
+    CORRADE_COMPARE(out, "Trade::AsyncImporter: expected at least one importer instance\n");
+}
+
+void AsyncImporterTest::constructNullImporter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers = fakeImporters(3);
+    importers[2] = nullptr;
+
+    Containers::String out;
+    Error redirectError{&out};
+    AsyncImporter{Utility::move(importers)};
+    CORRADE_COMPARE(out, "Trade::AsyncImporter: importer 2 is null\n");
+}
+
+void AsyncImporterTest::constructOpenedImporter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers = fakeImporters(3);
+    const char data[]{1};
+    CORRADE_VERIFY(importers[1]->openData(data));
+
+    Containers::String out;
+    Error redirectError{&out};
+    AsyncImporter{Utility::move(importers)};
+    CORRADE_COMPARE(out, "Trade::AsyncImporter: importer 1 is already opened\n");
+}
+
+void AsyncImporterTest::constructMove() {
+    AsyncImporter a{fakeImporters(2)};
+    const char data[]{1, 1, 1};
+    CORRADE_VERIFY(a.openData(data));
+    UnsignedInt job = a.loadMesh(2);
+
+    AsyncImporter b{Utility::move(a)};
+    CORRADE_VERIFY(b.isOpened());
+    CORRADE_COMPARE(b.jobCount(), 1);
+
+    AsyncImporter c{fakeImporters(1)};
+    c = Utility::move(b);
+    CORRADE_VERIFY(c.isOpened());
+    Containers::Optional<MeshData> mesh = c.takeMesh(job);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), 20);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<AsyncImporter>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<AsyncImporter>::value);
+}
+
+void AsyncImporterTest::tryCreateLoadFailed() {
+    PluginManager::Manager<AbstractImporter> manager{"nonexistent"};
+
+    /* The plugin manager prints its own message before, not checking that */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!AsyncImporter::tryCreate(manager, "NonexistentImporter", 2));
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::AsyncImporter::tryCreate(): can't load plugin NonexistentImporter\n",
+        TestSuite::Compare::StringHasSuffix);
+}
+
+void AsyncImporterTest::openData() {
+    AsyncImporter importer{fakeImporters(3)};
+    importer.importer().setFlags(ImporterFlag::Verbose);
+    importer.importer().configuration().setValue("someOption", 17);
+
+    const char data[]{1, 1, 1, 1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(importer.isOpened());
+    CORRADE_COMPARE(importer.importer().meshCount(), 5);
+
+    /* All instances should be opened with the same flags and configuration,
+       referencing the same copy of the data */
+    auto& first = static_cast<FakeImporter&>(importer.importer());
+    CORRADE_VERIFY(first.dataPointer);
+    CORRADE_VERIFY(first.dataPointer != data);
+
+    /* The other instances aren't directly accessible, so check their
+       effect through the results instead. Every job is run by some instance,
+       and a mismatch in the opened data would show up in the counts. */
+    Containers::Array<UnsignedInt> jobs;
+    for(UnsignedInt i = 0; i != 5; ++i)
+        arrayAppend(jobs, importer.loadMesh(i));
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> mesh = importer.takeMesh(jobs[i]);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexCount(), i*10);
+    }
+}
+
+void AsyncImporterTest::openDataNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct Importer: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+    };
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    arrayAppend(importers, Containers::pointer<Importer>());
+    AsyncImporter importer{Utility::move(importers)};
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.openData(nullptr);
+    CORRADE_COMPARE(out, "Trade::AsyncImporter::openData(): feature not supported\n");
+}
+
+void AsyncImporterTest::openDataFailed() {
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    arrayAppend(importers, Containers::pointer<FakeImporter>());
+    arrayAppend(importers, Containers::pointer<FakeImporter>(nullptr, true));
+    AbstractImporter* first = importers[0].get();
+    AsyncImporter importer{Utility::move(importers)};
+
+    const char data[]{1, 1};
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        /* Without threads the failing instance gets dropped in the
+           constructor */
+        CORRADE_COMPARE(importer.openData(data), !HasThreads);
+    }
+    if(HasThreads) {
+        CORRADE_COMPARE(out, "FakeImporter: open failed\n");
+        /* The instances that succeeded should be closed again */
+        CORRADE_VERIFY(!first->isOpened());
+        CORRADE_VERIFY(!importer.isOpened());
+    }
+}
+
+void AsyncImporterTest::openFile() {
+    AsyncImporter importer{fakeImporters(3)};
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+    CORRADE_COMPARE(importer.importer().meshCount(), 1);
+
+    /* The file gets read through a caching callback, so the data isn't
+       owned by the importer */
+    CORRADE_VERIFY(importer.importer().fileCallback());
+    auto& first = static_cast<FakeImporter&>(importer.importer());
+    CORRADE_VERIFY(first.dataPointer);
+
+    /* Opening again should reuse the callback and not fail on it being
+       already set */
+    CORRADE_VERIFY(importer.openFile(Utility::Path::join(TRADE_TEST_DIR, "file.bin")));
+    CORRADE_VERIFY(importer.isOpened());
+
+    Containers::Optional<MeshData> mesh = importer.takeMesh(importer.loadMesh(0, 1));
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), 1);
+}
+
+void AsyncImporterTest::openFileUserCallback() {
+    AsyncImporter importer{fakeImporters(3)};
+
+    struct State {
+        UnsignedInt calls = 0;
+        const char data[3]{1, 1, 1};
+    } state;
+    importer.importer().setFileCallback([](const std::string&, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(policy == InputFileCallbackPolicy::Close)
+            return {};
+        ++state.calls;
+        return Containers::arrayView(state.data);
+    }, state);
+
+    CORRADE_VERIFY(importer.openFile("some-file.bin"));
+    CORRADE_COMPARE(importer.importer().meshCount(), 3);
+
+    /* The user callback is propagated to all instances */
+    CORRADE_COMPARE(state.calls, importer.threadCount());
+    CORRADE_COMPARE(static_cast<FakeImporter&>(importer.importer()).dataPointer, state.data);
+}
+
+void AsyncImporterTest::close() {
+    Containers::Array<UnsignedInt> order;
+    AsyncImporter importer{fakeImporters(1, &order)};
+
+    const char data[]{1, 1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+    importer.loadMesh(0);
+    importer.loadMesh(1);
+    CORRADE_COMPARE(importer.jobCount(), 2);
+
+    /* With a single instance nothing gets run until waited on, so the jobs
+       get cancelled without running */
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+    CORRADE_COMPARE(importer.jobCount(), 0);
+    CORRADE_COMPARE_AS(order, Containers::arrayView<UnsignedInt>({}),
+        TestSuite::Compare::Container);
+
+    /* Closing again is a no-op */
+    importer.close();
+    CORRADE_VERIFY(!importer.isOpened());
+}
+
+void AsyncImporterTest::loadAllTypes() {
+    AsyncImporter importer{fakeImporters(2)};
+
+    const char data[]{1, 1, 1, 1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+
+    UnsignedInt scene = importer.loadScene(3);
+    UnsignedInt mesh = importer.loadMesh(4, 1);
+    UnsignedInt material = importer.loadMaterial(2);
+    UnsignedInt image1D = importer.loadImage1D(1);
+    UnsignedInt image2D = importer.loadImage2D(2);
+    UnsignedInt image3D = importer.loadImage3D(3);
+    CORRADE_COMPARE(importer.jobCount(), 6);
+
+    importer.waitAll();
+    for(UnsignedInt i = 0; i != 6; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(importer.jobState(i), AsyncImporterJobState::Finished);
+    }
+
+    Containers::Optional<SceneData> sceneData = importer.takeScene(scene);
+    CORRADE_VERIFY(sceneData);
+    CORRADE_COMPARE(sceneData->mappingBound(), 3);
+
+    Containers::Optional<MeshData> meshData = importer.takeMesh(mesh);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->vertexCount(), 41);
+
+    Containers::Optional<MaterialData> materialData = importer.takeMaterial(material);
+    CORRADE_VERIFY(materialData);
+    CORRADE_COMPARE(materialData->alphaMask(), 2.0f);
+
+    Containers::Optional<ImageData1D> image1DData = importer.takeImage1D(image1D);
+    CORRADE_VERIFY(image1DData);
+    CORRADE_COMPARE(image1DData->size(), 1);
+
+    Containers::Optional<ImageData2D> image2DData = importer.takeImage2D(image2D);
+    CORRADE_VERIFY(image2DData);
+    CORRADE_COMPARE(image2DData->size(), (Vector2i{2, 1}));
+
+    Containers::Optional<ImageData3D> image3DData = importer.takeImage3D(image3D);
+    CORRADE_VERIFY(image3DData);
+    CORRADE_COMPARE(image3DData->size(), (Vector3i{3, 1, 1}));
+}
+
+void AsyncImporterTest::loadNotOpened() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AsyncImporter importer{fakeImporters(1)};
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.loadScene(0);
+    importer.loadMesh(0);
+    importer.loadMaterial(0);
+    importer.loadImage1D(0);
+    importer.loadImage2D(0);
+    importer.loadImage3D(0);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::loadScene(): no file opened\n"
+        "Trade::AsyncImporter::loadMesh(): no file opened\n"
+        "Trade::AsyncImporter::loadMaterial(): no file opened\n"
+        "Trade::AsyncImporter::loadImage1D(): no file opened\n"
+        "Trade::AsyncImporter::loadImage2D(): no file opened\n"
+        "Trade::AsyncImporter::loadImage3D(): no file opened\n",
+        TestSuite::Compare::String);
+}
+
+void AsyncImporterTest::loadOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AsyncImporter importer{fakeImporters(1)};
+    const char data[]{1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.loadScene(2);
+    importer.loadMesh(2);
+    importer.loadMesh(1, 2);
+    importer.loadMaterial(2);
+    importer.loadImage1D(2);
+    importer.loadImage1D(1, 1);
+    importer.loadImage2D(2);
+    importer.loadImage2D(1, 1);
+    importer.loadImage3D(2);
+    importer.loadImage3D(1, 1);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::loadScene(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadMesh(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadMesh(): level 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadMaterial(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadImage1D(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadImage1D(): level 1 out of range for 1 entries\n"
+        "Trade::AsyncImporter::loadImage2D(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadImage2D(): level 1 out of range for 1 entries\n"
+        "Trade::AsyncImporter::loadImage3D(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::loadImage3D(): level 1 out of range for 1 entries\n",
+        TestSuite::Compare::String);
+
+    /* No jobs should have been queued */
+    CORRADE_COMPARE(importer.jobCount(), 0);
+}
+
+void AsyncImporterTest::priority() {
+    /* With a single instance the jobs are run only from waitAll(), which
+       makes the order deterministic */
+    Containers::Array<UnsignedInt> order;
+    AsyncImporter importer{fakeImporters(1, &order)};
+
+    const char data[]{1, 1, 1, 1, 1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+    importer.loadMesh(0);
+    importer.loadMesh(1, 0, 5);
+    importer.loadImage2D(2, 0, -3);
+    importer.loadMesh(3, 0, 5);
+    importer.loadMaterial(4);
+    importer.loadMesh(5, 0, 10);
+    CORRADE_COMPARE(importer.jobState(1), AsyncImporterJobState::Pending);
+
+    /* Same priority is processed in the order of submission */
+    importer.waitAll();
+    CORRADE_COMPARE_AS(order, Containers::arrayView<UnsignedInt>({
+        5, 1, 3, 0, 4, 2
+    }), TestSuite::Compare::Container);
+}
+
+void AsyncImporterTest::cancel() {
+    Containers::Array<UnsignedInt> order;
+    AsyncImporter importer{fakeImporters(1, &order)};
+
+    const char data[]{1, 1, 1, 1};
+    CORRADE_VERIFY(importer.openData(data));
+    UnsignedInt a = importer.loadMesh(0);
+    UnsignedInt b = importer.loadMesh(1);
+    UnsignedInt c = importer.loadMesh(2);
+    UnsignedInt d = importer.loadMesh(3, 0, 1);
+
+    CORRADE_VERIFY(importer.cancel(b));
+    CORRADE_COMPARE(importer.jobState(b), AsyncImporterJobState::Cancelled);
+    /* Cancelling a second time does nothing */
+    CORRADE_VERIFY(!importer.cancel(b));
+
+    /* Waiting for a cancelled job returns immediately and doesn't run
+       anything */
+    importer.wait(b);
+    CORRADE_COMPARE_AS(order, Containers::arrayView<UnsignedInt>({}),
+        TestSuite::Compare::Container);
+
+    /* Waiting for a job runs everything that's queued before it */
+    importer.wait(a);
+    CORRADE_COMPARE(importer.jobState(d), AsyncImporterJobState::Finished);
+    CORRADE_COMPARE(importer.jobState(a), AsyncImporterJobState::Finished);
+    CORRADE_COMPARE(importer.jobState(c), AsyncImporterJobState::Pending);
+
+    /* A finished job can't be cancelled anymore */
+    CORRADE_VERIFY(!importer.cancel(a));
+
+    importer.waitAll();
+    CORRADE_COMPARE_AS(order, Containers::arrayView<UnsignedInt>({
+        3, 0, 2
+    }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(!importer.takeMesh(b));
+    CORRADE_VERIFY(importer.takeMesh(c));
+}
+
+void AsyncImporterTest::failed() {
+    AsyncImporter importer{fakeImporters(1)};
+
+    const char data[]{1, 0, 1};
+    CORRADE_VERIFY(importer.openData(data));
+    UnsignedInt a = importer.loadMesh(0);
+    UnsignedInt b = importer.loadMesh(1);
+    UnsignedInt c = importer.loadMesh(2);
+
+    /* With a single instance the job runs on the calling thread, so the
+       redirection catches it */
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        importer.waitAll();
+    }
+    CORRADE_COMPARE(out, "FakeImporter: import of 1 failed\n");
+    CORRADE_COMPARE(importer.jobState(a), AsyncImporterJobState::Finished);
+    CORRADE_COMPARE(importer.jobState(b), AsyncImporterJobState::Failed);
+    CORRADE_COMPARE(importer.jobState(c), AsyncImporterJobState::Finished);
+    CORRADE_VERIFY(!importer.takeMesh(b));
+    CORRADE_VERIFY(importer.takeMesh(c));
+}
+
+void AsyncImporterTest::takeTwice() {
+    AsyncImporter importer{fakeImporters(2)};
+
+    const char data[]{1};
+    CORRADE_VERIFY(importer.openData(data));
+    UnsignedInt job = importer.loadMesh(0);
+
+    CORRADE_VERIFY(importer.takeMesh(job));
+    /* The job stays finished, but the data is moved out */
+    CORRADE_COMPARE(importer.jobState(job), AsyncImporterJobState::Finished);
+    CORRADE_VERIFY(!importer.takeMesh(job));
+}
+
+void AsyncImporterTest::takeWrongType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AsyncImporter importer{fakeImporters(1)};
+    const char data[]{1};
+    CORRADE_VERIFY(importer.openData(data));
+    UnsignedInt mesh = importer.loadMesh(0);
+    UnsignedInt image = importer.loadImage2D(0);
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.takeScene(mesh);
+    importer.takeMesh(image);
+    importer.takeMaterial(mesh);
+    importer.takeImage1D(mesh);
+    importer.takeImage2D(mesh);
+    importer.takeImage3D(mesh);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::takeScene(): job 0 is not a scene job\n"
+        "Trade::AsyncImporter::takeMesh(): job 1 is not a mesh job\n"
+        "Trade::AsyncImporter::takeMaterial(): job 0 is not a material job\n"
+        "Trade::AsyncImporter::takeImage1D(): job 0 is not a 1D image job\n"
+        "Trade::AsyncImporter::takeImage2D(): job 0 is not a 2D image job\n"
+        "Trade::AsyncImporter::takeImage3D(): job 0 is not a 3D image job\n",
+        TestSuite::Compare::String);
+}
+
+void AsyncImporterTest::jobOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    AsyncImporter importer{fakeImporters(1)};
+    const char data[]{1};
+    CORRADE_VERIFY(importer.openData(data));
+    importer.loadMesh(0);
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.jobState(1);
+    importer.cancel(1);
+    importer.wait(1);
+    importer.takeScene(1);
+    importer.takeMesh(1);
+    importer.takeMaterial(1);
+    importer.takeImage1D(1);
+    importer.takeImage2D(1);
+    importer.takeImage3D(1);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::jobState(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::cancel(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::wait(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeScene(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeMesh(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeMaterial(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeImage1D(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeImage2D(): index 1 out of range for 1 jobs\n"
+        "Trade::AsyncImporter::takeImage3D(): index 1 out of range for 1 jobs\n",
+        TestSuite::Compare::String);
+}
+
+void AsyncImporterTest::stress() {
+    auto&& data = StressData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncImporter importer{fakeImporters(data.threadCount)};
+
+    /* A lot of resources of varying cost, none failing */
+    Containers::Array<char> fileData{NoInit, 2000};
+    for(std::size_t i = 0; i != fileData.size(); ++i)
+        fileData[i] = 1 + i % 37;
+    CORRADE_VERIFY(importer.openData(fileData));
+
+    /* Queue meshes and images interleaved with various priorities, cancel
+       every seventh and take every eleventh right away while others are
+       still being queued */
+    Containers::Array<bool> cancelled{ValueInit, fileData.size()*2};
+    for(UnsignedInt i = 0; i != fileData.size(); ++i) {
+        const UnsignedInt mesh = importer.loadMesh(i, 0, i % 5);
+        const UnsignedInt image = importer.loadImage2D(i, 0, -Int(i % 3));
+        CORRADE_COMPARE(mesh, i*2);
+        CORRADE_COMPARE(image, i*2 + 1);
+
+        if(i % 7 == 0)
+            cancelled[mesh] = importer.cancel(mesh);
+        if(i % 11 == 0) {
+            Containers::Optional<ImageData2D> imageData = importer.takeImage2D(image);
+            CORRADE_VERIFY(imageData);
+            CORRADE_COMPARE(imageData->size().x(), Int(i));
+        }
+    }
+
+    importer.waitAll();
+    CORRADE_COMPARE(importer.jobCount(), fileData.size()*2);
+
+    for(UnsignedInt i = 0; i != fileData.size(); ++i) {
+        CORRADE_ITERATION(i);
+
+        Containers::Optional<MeshData> mesh = importer.takeMesh(i*2);
+        if(cancelled[i*2]) {
+            CORRADE_COMPARE(importer.jobState(i*2), AsyncImporterJobState::Cancelled);
+            CORRADE_VERIFY(!mesh);
+        } else {
+            CORRADE_COMPARE(importer.jobState(i*2), AsyncImporterJobState::Finished);
+            CORRADE_VERIFY(mesh);
+            CORRADE_COMPARE(mesh->vertexCount(), i*10);
+        }
+
+        CORRADE_COMPARE(importer.jobState(i*2 + 1), AsyncImporterJobState::Finished);
+        if(i % 11 == 0) continue;
+        Containers::Optional<ImageData2D> image = importer.takeImage2D(i*2 + 1);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size().x(), Int(i));
+    }
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImporterTest)
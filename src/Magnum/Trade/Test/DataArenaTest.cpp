@@ -0,0 +1,259 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <type_traits>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Trade/DataArena.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct DataArenaTest: TestSuite::Tester {
+    explicit DataArenaTest();
+
+    void construct();
+    void constructZeroBlockSize();
+    void constructMove();
+
+    void allocate();
+    void allocateAligned();
+    void allocateInvalidAlignment();
+    void allocateZeroSize();
+    void allocateNewBlock();
+    void allocateDedicatedBlock();
+
+    void copy();
+    void reset();
+};
+
+const struct {
+    const char* name;
+    std::size_t alignment;
+} AllocateAlignedData[]{
+    {"1", 1},
+    {"4", 4},
+    {"16", 16},
+    {"64", 64},
+    {"4096, larger than the block", 4096}
+};
+
+DataArenaTest::DataArenaTest() {
+    addTests({&DataArenaTest::construct,
+              &DataArenaTest::constructZeroBlockSize,
+              &DataArenaTest::constructMove,
+
+              &DataArenaTest::allocate});
+
+    addInstancedTests({&DataArenaTest::allocateAligned},
+        Containers::arraySize(AllocateAlignedData));
+
+    addTests({&DataArenaTest::allocateInvalidAlignment,
+              &DataArenaTest::allocateZeroSize,
+              &DataArenaTest::allocateNewBlock,
+              &DataArenaTest::allocateDedicatedBlock,
+
+              &DataArenaTest::copy,
+              &DataArenaTest::reset});
+}
+
+void DataArenaTest::construct() {
+    DataArena arena{1024};
+    CORRADE_COMPARE(arena.blockSize(), 1024);
+    CORRADE_COMPARE(arena.blockCount(), 0);
+    CORRADE_COMPARE(arena.size(), 0);
+    CORRADE_COMPARE(arena.capacity(), 0);
+}
+
+void DataArenaTest::constructZeroBlockSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    DataArena{0};
+    CORRADE_COMPARE(out, "Trade::DataArena: expected a non-zero block size\n");
+}
+
+void DataArenaTest::constructMove() {
+    DataArena a{1024};
+    Containers::ArrayView<char> data = a.allocate(16);
+    data[0] = 'a';
+
+    /* The memory stays at the same location */
+    DataArena b{Utility::move(a)};
+    CORRADE_COMPARE(b.blockSize(), 1024);
+    CORRADE_COMPARE(b.blockCount(), 1);
+    CORRADE_COMPARE(b.size(), 16);
+    CORRADE_COMPARE(data[0], 'a');
+
+    DataArena c{2048};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.blockSize(), 1024);
+    CORRADE_COMPARE(c.blockCount(), 1);
+    CORRADE_COMPARE(c.size(), 16);
+    CORRADE_COMPARE(data[0], 'a');
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<DataArena>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<DataArena>::value);
+}
+
+void DataArenaTest::allocate() {
+    DataArena arena{1024};
+
+    Containers::ArrayView<char> a = arena.allocate(16);
+    Containers::ArrayView<char> b = arena.allocate(32);
+    CORRADE_COMPARE(a.size(), 16);
+    CORRADE_COMPARE(b.size(), 32);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+    CORRADE_COMPARE(arena.size(), 48);
+    CORRADE_COMPARE(arena.capacity(), 1024);
+
+    /* Both are served from the same block, one after another */
+    CORRADE_COMPARE(static_cast<void*>(b.data()), static_cast<void*>(a.data() + 16));
+}
+
+void DataArenaTest::allocateAligned() {
+    auto&& data = AllocateAlignedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    DataArena arena{1024};
+
+    /* Shift the current position to not be aligned */
+    arena.allocate(1, 1);
+
+    Containers::ArrayView<char> out = arena.allocate(3, data.alignment);
+    CORRADE_COMPARE(out.size(), 3);
+    CORRADE_COMPARE_AS(reinterpret_cast<std::uintptr_t>(out.data()), data.alignment,
+        TestSuite::Compare::Divisible);
+    CORRADE_COMPARE(arena.size(), 4);
+}
+
+void DataArenaTest::allocateInvalidAlignment() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    DataArena arena{1024};
+
+    Containers::String out;
+    Error redirectError{&out};
+    arena.allocate(16, 0);
+    arena.allocate(16, 3);
+    CORRADE_COMPARE(out,
+        "Trade::DataArena::allocate(): expected alignment to be a power of two but got 0\n"
+        "Trade::DataArena::allocate(): expected alignment to be a power of two but got 3\n");
+}
+
+void DataArenaTest::allocateZeroSize() {
+    DataArena arena{1024};
+
+    Containers::ArrayView<char> out = arena.allocate(0);
+    CORRADE_VERIFY(!out.data());
+    CORRADE_COMPARE(out.size(), 0);
+    CORRADE_COMPARE(arena.blockCount(), 0);
+    CORRADE_COMPARE(arena.size(), 0);
+}
+
+void DataArenaTest::allocateNewBlock() {
+    DataArena arena{64};
+
+    Containers::ArrayView<char> a = arena.allocate(48, 1);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+
+    /* Doesn't fit into the remaining 16 bytes, a new block is created */
+    Containers::ArrayView<char> b = arena.allocate(32, 1);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+    CORRADE_COMPARE(arena.size(), 80);
+    CORRADE_COMPARE(arena.capacity(), 128);
+
+    /* Next allocation is served from the new block */
+    Containers::ArrayView<char> c = arena.allocate(16, 1);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+    CORRADE_COMPARE(static_cast<void*>(c.data()), static_cast<void*>(b.data() + 32));
+
+    /* Data in the previous block is still there */
+    a[0] = 'a';
+    CORRADE_COMPARE(a[0], 'a');
+}
+
+void DataArenaTest::allocateDedicatedBlock() {
+    DataArena arena{64};
+
+    Containers::ArrayView<char> a = arena.allocate(16, 1);
+
+    /* Larger than the block size, gets its own block */
+    Containers::ArrayView<char> b = arena.allocate(1000, 1);
+    CORRADE_COMPARE(b.size(), 1000);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+    CORRADE_COMPARE(arena.size(), 1016);
+    CORRADE_COMPARE(arena.capacity(), 1064);
+
+    /* The next allocation continues in the original block */
+    Containers::ArrayView<char> c = arena.allocate(16, 1);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+    CORRADE_COMPARE(static_cast<void*>(c.data()), static_cast<void*>(a.data() + 16));
+}
+
+void DataArenaTest::copy() {
+    DataArena arena{1024};
+
+    const char data[]{'h', 'e', 'l', 'l', 'o'};
+    Containers::ArrayView<char> out = arena.copy(data);
+    CORRADE_VERIFY(static_cast<void*>(out.data()) != data);
+    CORRADE_COMPARE_AS(out, Containers::arrayView(data),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(arena.size(), 5);
+
+    /* Empty input doesn't allocate */
+    CORRADE_COMPARE(arena.copy(nullptr).size(), 0);
+    CORRADE_COMPARE(arena.size(), 5);
+}
+
+void DataArenaTest::reset() {
+    DataArena arena{64};
+    arena.allocate(48);
+    arena.allocate(48);
+    arena.allocate(1000);
+    CORRADE_COMPARE(arena.blockCount(), 3);
+
+    arena.reset();
+    CORRADE_COMPARE(arena.blockSize(), 64);
+    CORRADE_COMPARE(arena.blockCount(), 0);
+    CORRADE_COMPARE(arena.size(), 0);
+    CORRADE_COMPARE(arena.capacity(), 0);
+
+    /* The arena is usable again after */
+    Containers::ArrayView<char> out = arena.allocate(16);
+    CORRADE_COMPARE(out.size(), 16);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DataArenaTest)
@@ -25,6 +25,9 @@
 */
 
 #include <sstream> /** @todo remove once Configuration is stream-free */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+#include <thread>
+#endif
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/TestSuite/Compare/String.h>
@@ -52,6 +55,15 @@ struct ImageConverterImplementationTest: TestSuite::Tester {
 
     void info();
     void infoError();
+    void infoProbe();
+
+    void profileStages();
+    void profileThreads();
+    void profileJson();
+    void profileJsonEscaping();
+    void profileCsv();
+    void profileCsvEscaping();
+    void profileChromeTrace();
 
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<Trade::AbstractImporter> _importerManager{"nonexistent"};
@@ -70,7 +82,16 @@ ImageConverterImplementationTest::ImageConverterImplementationTest() {
               &ImageConverterImplementationTest::converterInfoExtensionMimeTypeNoFileConversion,
 
               &ImageConverterImplementationTest::info,
-              &ImageConverterImplementationTest::infoError});
+              &ImageConverterImplementationTest::infoError,
+              &ImageConverterImplementationTest::infoProbe,
+
+              &ImageConverterImplementationTest::profileStages,
+              &ImageConverterImplementationTest::profileThreads,
+              &ImageConverterImplementationTest::profileJson,
+              &ImageConverterImplementationTest::profileJsonEscaping,
+              &ImageConverterImplementationTest::profileCsv,
+              &ImageConverterImplementationTest::profileCsvEscaping,
+              &ImageConverterImplementationTest::profileChromeTrace});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -473,20 +494,20 @@ void ImageConverterImplementationTest::info() {
 
     bool error = false;
     std::chrono::high_resolution_clock::duration time;
-    Containers::Array<Implementation::ImageInfo> infos = Implementation::imageInfo(importer, error, time);
+    Containers::Array<Implementation::ImageInfo> infos = Implementation::imageInfo(importer, error, time, false);
     CORRADE_VERIFY(!error);
     CORRADE_COMPARE(infos.size(), 13);
 
     /* Print to visually verify coloring */
     {
         Debug{} << "======================== visual color verification start =======================";
-        Implementation::printImageInfo(Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors, infos, nullptr, nullptr, nullptr);
+        Implementation::printImageInfo(Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors, infos, nullptr, nullptr, nullptr, false);
         Debug{} << "======================== visual color verification end =========================";
     }
 
     Containers::String out;
     Debug redirectOutput{&out};
-    Implementation::printImageInfo(Debug::Flag::DisableColors, infos, nullptr, nullptr, nullptr);
+    Implementation::printImageInfo(Debug::Flag::DisableColors, infos, nullptr, nullptr, nullptr, false);
     CORRADE_COMPARE_AS(out,
         Utility::Path::join(TRADE_TEST_DIR, "ImageConverterImplementationTestFiles/info.txt"),
         TestSuite::Compare::StringToFile);
@@ -522,7 +543,7 @@ void ImageConverterImplementationTest::infoError() {
     Containers::String out;
     Debug redirectOutput{&out};
     Error redirectError{&out};
-    Containers::Array<Implementation::ImageInfo> infos = Implementation::imageInfo(importer, error, time);
+    Containers::Array<Implementation::ImageInfo> infos = Implementation::imageInfo(importer, error, time, false);
     /* It should return a failure and no output */
     CORRADE_VERIFY(error);
     CORRADE_VERIFY(infos.isEmpty());
@@ -542,6 +563,179 @@ void ImageConverterImplementationTest::infoError() {
         "Can't import 3D image 1 level 0\n");
 }
 
+void ImageConverterImplementationTest::infoProbe() {
+    struct Importer: Trade::AbstractImporter {
+        Trade::ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        /* Only properties are implemented, image import would assert */
+        UnsignedInt doImage2DCount() const override { return 2; }
+        UnsignedInt doImage2DLevelCount(UnsignedInt id) override {
+            return id == 0 ? 2 : 1;
+        }
+        Containers::String doImage2DName(UnsignedInt id) override {
+            return id == 0 ? "Mipmapped" : "";
+        }
+        Containers::Optional<Trade::ImageProperties2D> doImage2DProperties(UnsignedInt id, UnsignedInt level) override {
+            if(id == 0 && level == 0)
+                return Trade::ImageProperties2D{PixelFormat::RGBA8Unorm, {256, 128}};
+            if(id == 0 && level == 1)
+                return Trade::ImageProperties2D{PixelFormat::RGBA8Unorm, {128, 64}};
+            if(id == 1 && level == 0)
+                return Trade::ImageProperties2D{CompressedPixelFormat::Bc3RGBAUnorm, {16, 16}, ImageFlag2D::Array};
+            CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+        }
+    } importer;
+
+    bool error = false;
+    std::chrono::high_resolution_clock::duration time;
+    Containers::Array<Implementation::ImageInfo> infos = Implementation::imageInfo(importer, error, time, true);
+    CORRADE_VERIFY(!error);
+    CORRADE_COMPARE(infos.size(), 3);
+
+    /* Data size isn't printed as it's unknown */
+    Containers::String out;
+    Debug redirectOutput{&out};
+    Implementation::printImageInfo(Debug::Flag::DisableColors, infos, nullptr, nullptr, nullptr, true);
+    CORRADE_COMPARE(out,
+        "2D image 0: Mipmapped\n"
+        "  Level 0: {256, 128} @ RGBA8Unorm\n"
+        "  Level 1: {128, 64} @ RGBA8Unorm\n"
+        "2D image 1:\n"
+        "  Level 0: Array {16, 16} @ Bc3RGBAUnorm\n");
+}
+
+/* Events with deterministic times for the output tests */
+void populateProfiler(Implementation::Profiler& profiler) {
+    const std::chrono::high_resolution_clock::time_point start = profiler.start();
+    profiler.add("open", "a.png", -1, start, start + std::chrono::microseconds{1500}, 1024, 0);
+    profiler.add("import", "mesh", 3, start + std::chrono::microseconds{1500}, start + std::chrono::microseconds{4000}, 0, 2048);
+    profiler.add("MeshOptimizerSceneConverter", "mesh", 3, start + std::chrono::microseconds{4000}, start + std::chrono::microseconds{4250}, 2048, 1536);
+    profiler.add("import", "mesh", 4, start + std::chrono::microseconds{4250}, start + std::chrono::microseconds{5250}, 0, 512);
+}
+
+void ImageConverterImplementationTest::profileStages() {
+    Implementation::Profiler profiler;
+    populateProfiler(profiler);
+
+    CORRADE_COMPARE(profiler.events().size(), 4);
+    CORRADE_COMPARE(profiler.events()[1].stage, "import");
+    CORRADE_COMPARE(profiler.events()[1].item, "mesh 3");
+    CORRADE_COMPARE(profiler.events()[0].item, "a.png");
+
+    Containers::Array<Implementation::ProfileStage> stages = Implementation::profileStages(profiler);
+    CORRADE_COMPARE(stages.size(), 3);
+    CORRADE_COMPARE(stages[0].stage, "open");
+    CORRADE_COMPARE(stages[0].count, 1);
+    CORRADE_COMPARE(stages[1].stage, "import");
+    CORRADE_COMPARE(stages[1].count, 2);
+    CORRADE_COMPARE(Implementation::microseconds(stages[1].duration), 3500);
+    CORRADE_COMPARE(stages[1].bytesIn, 0);
+    CORRADE_COMPARE(stages[1].bytesOut, 2560);
+    CORRADE_COMPARE(stages[2].stage, "MeshOptimizerSceneConverter");
+    CORRADE_COMPARE(stages[2].count, 1);
+    CORRADE_COMPARE(stages[2].bytesIn, 2048);
+    CORRADE_COMPARE(stages[2].bytesOut, 1536);
+}
+
+void ImageConverterImplementationTest::profileThreads() {
+    #if defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
+    CORRADE_SKIP("Threads not available on this platform.");
+    #else
+    Implementation::Profiler profiler;
+    const std::chrono::high_resolution_clock::time_point start = profiler.start();
+    std::thread{[&]{
+        profiler.add("import", "mesh", 0, start, start, 0, 0);
+    }}.join();
+    profiler.add("import", "mesh", 1, start, start, 0, 0);
+    std::thread{[&]{
+        profiler.add("import", "mesh", 2, start, start, 0, 0);
+    }}.join();
+
+    /* The thread that created the profiler is always 0 even if a worker
+       records an event first, others are numbered in order of their first
+       event */
+    CORRADE_COMPARE(profiler.events().size(), 3);
+    CORRADE_COMPARE(profiler.events()[0].thread, 1);
+    CORRADE_COMPARE(profiler.events()[1].thread, 0);
+    CORRADE_COMPARE(profiler.events()[2].thread, 2);
+
+    /* So the worker isn't labelled as main in the trace */
+    Containers::String trace = Implementation::profileChromeTrace(profiler, std::chrono::microseconds{}, 0);
+    CORRADE_COMPARE_AS(trace,
+        "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 0, \"args\": {\"name\": \"main\"}},\n"
+        "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 1, \"args\": {\"name\": \"worker 1\"}},\n",
+        TestSuite::Compare::StringContains);
+    #endif
+}
+
+void ImageConverterImplementationTest::profileJson() {
+    Implementation::Profiler profiler;
+    populateProfiler(profiler);
+
+    CORRADE_COMPARE_AS(Implementation::profileJson(profiler, std::chrono::microseconds{6000}, 65536),
+        "{\n"
+        "  \"totalTime\": 6000,\n"
+        "  \"peakMemory\": 65536,\n"
+        "  \"stages\": [\n"
+        "    {\"stage\": \"open\", \"count\": 1, \"time\": 1500, \"bytesIn\": 1024, \"bytesOut\": 0},\n"
+        "    {\"stage\": \"import\", \"count\": 2, \"time\": 3500, \"bytesIn\": 0, \"bytesOut\": 2560},\n"
+        "    {\"stage\": \"MeshOptimizerSceneConverter\", \"count\": 1, \"time\": 250, \"bytesIn\": 2048, \"bytesOut\": 1536}\n"
+        "  ],\n"
+        "  \"events\": [\n"
+        "    {\"stage\": \"open\", \"item\": \"a.png\", \"thread\": 0, \"begin\": 0, \"duration\": 1500, \"bytesIn\": 1024, \"bytesOut\": 0},\n"
+        "    {\"stage\": \"import\", \"item\": \"mesh 3\", \"thread\": 0, \"begin\": 1500, \"duration\": 2500, \"bytesIn\": 0, \"bytesOut\": 2048},\n"
+        "    {\"stage\": \"MeshOptimizerSceneConverter\", \"item\": \"mesh 3\", \"thread\": 0, \"begin\": 4000, \"duration\": 250, \"bytesIn\": 2048, \"bytesOut\": 1536},\n"
+        "    {\"stage\": \"import\", \"item\": \"mesh 4\", \"thread\": 0, \"begin\": 4250, \"duration\": 1000, \"bytesIn\": 0, \"bytesOut\": 512}\n"
+        "  ]\n"
+        "}\n",
+        TestSuite::Compare::String);
+}
+
+void ImageConverterImplementationTest::profileJsonEscaping() {
+    CORRADE_COMPARE(Implementation::jsonString("C:\\path\\\"quoted\".png"),
+        "\"C:\\\\path\\\\\\\"quoted\\\".png\"");
+    CORRADE_COMPARE(Implementation::jsonString("tab\tnewline\n"),
+        "\"tab\\u0009newline\\u000a\"");
+}
+
+void ImageConverterImplementationTest::profileCsv() {
+    Implementation::Profiler profiler;
+    populateProfiler(profiler);
+
+    CORRADE_COMPARE_AS(Implementation::profileCsv(profiler, std::chrono::microseconds{6000}, 65536),
+        "stage,item,thread,begin,duration,bytesIn,bytesOut,peakMemory\n"
+        "open,a.png,0,0,1500,1024,0,\n"
+        "import,mesh 3,0,1500,2500,0,2048,\n"
+        "MeshOptimizerSceneConverter,mesh 3,0,4000,250,2048,1536,\n"
+        "import,mesh 4,0,4250,1000,0,512,\n"
+        "total,,,0,6000,,,65536\n",
+        TestSuite::Compare::String);
+}
+
+void ImageConverterImplementationTest::profileCsvEscaping() {
+    CORRADE_COMPARE(Implementation::csvString("plain file.png"), "plain file.png");
+    CORRADE_COMPARE(Implementation::csvString("a,b.png"), "\"a,b.png\"");
+    CORRADE_COMPARE(Implementation::csvString("\"quoted\".png"), "\"\"\"quoted\"\".png\"");
+}
+
+void ImageConverterImplementationTest::profileChromeTrace() {
+    Implementation::Profiler profiler;
+    populateProfiler(profiler);
+
+    CORRADE_COMPARE_AS(Implementation::profileChromeTrace(profiler, std::chrono::microseconds{6000}, 65536),
+        "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"
+        "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 0, \"args\": {\"name\": \"main\"}},\n"
+        "{\"name\": \"open a.png\", \"cat\": \"open\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": 0, \"dur\": 1500, \"args\": {\"bytesIn\": 1024, \"bytesOut\": 0}},\n"
+        "{\"name\": \"import mesh 3\", \"cat\": \"import\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": 1500, \"dur\": 2500, \"args\": {\"bytesIn\": 0, \"bytesOut\": 2048}},\n"
+        "{\"name\": \"MeshOptimizerSceneConverter mesh 3\", \"cat\": \"MeshOptimizerSceneConverter\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": 4000, \"dur\": 250, \"args\": {\"bytesIn\": 2048, \"bytesOut\": 1536}},\n"
+        "{\"name\": \"import mesh 4\", \"cat\": \"import\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": 4250, \"dur\": 1000, \"args\": {\"bytesIn\": 0, \"bytesOut\": 512}},\n"
+        "{\"name\": \"peakMemory\", \"ph\": \"C\", \"pid\": 0, \"tid\": 0, \"ts\": 6000, \"args\": {\"bytes\": 65536}}\n"
+        "]}\n",
+        TestSuite::Compare::String);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageConverterImplementationTest)
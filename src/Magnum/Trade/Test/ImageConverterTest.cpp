@@ -26,17 +26,21 @@
 
 #include <cstdlib>
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
+#include "Magnum/Trade/ImageData.h"
 
 #include "configure.h"
 
@@ -46,6 +50,10 @@ struct ImageConverterTest: TestSuite::Tester {
     explicit ImageConverterTest();
 
     void info();
+    void batch();
+    void batchFailure();
+    void error();
+    void mipmapsError();
 };
 
 using namespace Containers::Literals;
@@ -89,6 +97,13 @@ const struct {
         /** @todo change to something else once we have a plugin that can
             zero-copy pass the imported data */
         "info-data.txt"},
+    /* TgaImporter doesn't implement image properties, so this goes through
+       the default implementation */
+    {"data, probe", {InPlaceInit, {
+            "-I", "TgaImporter", "--info", "--probe", Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga")
+        }},
+        "TgaImporter", nullptr,
+        "info-data-probe.txt"},
     {"data, ignored output file", {InPlaceInit, {
             "-I", "TgaImporter", "--info", Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga"), "whatever.png"
         }},
@@ -96,10 +111,79 @@ const struct {
         "info-data-ignored-output.txt"}
 };
 
+const struct {
+    const char* name;
+    bool batchFile;
+    const char* jobs;
+} BatchData[]{
+    {"command line", false, "0"},
+    {"command line, single thread", false, "1"},
+    {"batch file", true, "2"},
+};
+
+const struct {
+    TestSuite::TestCaseDescriptionSourceLocation name;
+    Containers::Array<Containers::String> args;
+    const char* message;
+} ErrorData[]{
+    {"mipmaps with levels", {InPlaceInit, {
+            "--mipmaps", "--levels", "a.tga", "b.tga", "out.ktx2"
+        }},
+        "The --mipmaps option can't be combined with --levels or --info\n"},
+    {"mipmaps with info", {InPlaceInit, {
+            "--mipmaps", "--info", "a.tga"
+        }},
+        "The --mipmaps option can't be combined with --levels or --info\n"},
+    {"invalid mipmap filter", {InPlaceInit, {
+            "--mipmaps", "--mipmap-filter", "bicubic", "a.tga", "out.ktx2"
+        }},
+        "Invalid --mipmap-filter value bicubic, expected box, kaiser or lanczos\n"},
+    {"invalid mipmap alpha coverage", {InPlaceInit, {
+            "--mipmaps", "--mipmap-alpha-coverage", "half", "a.tga", "out.ktx2"
+        }},
+        "Invalid --mipmap-alpha-coverage value half, expected a number between 0 and 1\n"},
+    {"mipmap alpha coverage with trailing characters", {InPlaceInit, {
+            "--mipmaps", "--mipmap-alpha-coverage", "0.5x", "a.tga", "out.ktx2"
+        }},
+        "Invalid --mipmap-alpha-coverage value 0.5x, expected a number between 0 and 1\n"},
+    {"mipmap alpha coverage out of range", {InPlaceInit, {
+            "--mipmaps", "--mipmap-alpha-coverage", "1.5", "a.tga", "out.ktx2"
+        }},
+        "Invalid --mipmap-alpha-coverage value 1.5, expected a number between 0 and 1\n"},
+};
+
+const struct {
+    const char* name;
+    const char* format;
+    std::size_t dataSize;
+    const char* alphaCoverage;
+    const char* message;
+} MipmapsErrorData[]{
+    {"unsupported format", "R16Unorm", 2*2*2, nullptr,
+        "The --mipmaps option isn't implemented for PixelFormat::R16Unorm\n"},
+    {"depth format", "Depth32F", 2*2*4, nullptr,
+        "The --mipmaps option isn't implemented for PixelFormat::Depth32F\n"},
+    {"alpha coverage on RGB", "RGB8Unorm", 2*2*3, "0.5",
+        "The --mipmap-alpha-coverage option expects a four-component format but got PixelFormat::RGB8Unorm\n"},
+    {"alpha coverage on RG", "RG32F", 2*2*8, "0.5",
+        "The --mipmap-alpha-coverage option expects a four-component format but got PixelFormat::RG32F\n"},
+};
+
 ImageConverterTest::ImageConverterTest() {
     addInstancedTests({&ImageConverterTest::info},
         Containers::arraySize(InfoData));
 
+    addInstancedTests({&ImageConverterTest::batch},
+        Containers::arraySize(BatchData));
+
+    addTests({&ImageConverterTest::batchFailure});
+
+    addInstancedTests({&ImageConverterTest::error},
+        Containers::arraySize(ErrorData));
+
+    addInstancedTests({&ImageConverterTest::mipmapsError},
+        Containers::arraySize(MipmapsErrorData));
+
     /* Create output dir, if doesn't already exist */
     Utility::Path::make(Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles"));
 }
@@ -154,6 +238,181 @@ void ImageConverterTest::info() {
     #endif
 }
 
+void ImageConverterTest::batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+    if(!(converterManager.load("TgaImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImageConverter plugin can't be loaded.");
+
+    const Containers::String input = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga");
+    const Containers::String outputs[]{
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch0.tga"),
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch1.tga"),
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch2.tga"),
+    };
+    for(const Containers::String& output: outputs)
+        if(Utility::Path::exists(output))
+            CORRADE_VERIFY(Utility::Path::remove(output));
+
+    Containers::Array<Containers::String> args{InPlaceInit, {
+        "-I", "TgaImporter", "-C", "TgaImageConverter", "-j", data.jobs
+    }};
+    if(data.batchFile) {
+        const Containers::String batchFile = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch.txt");
+        CORRADE_VERIFY(Utility::Path::write(batchFile, Utility::format(
+            "# Comments and empty lines are ignored\n"
+            "{} {}\n"
+            "\n"
+            "  {}\t{}\n"
+            "{} {}\n",
+            input, outputs[0], input, outputs[1], input, outputs[2])));
+        arrayAppend(args, {"--batch-file"_s, batchFile});
+    } else {
+        arrayAppend(args, "--batch"_s);
+        for(const Containers::String& output: outputs)
+            arrayAppend(args, {input, output});
+    }
+
+    Containers::Pair<bool, Containers::String> output = call(args);
+    CORRADE_COMPARE(output.second(), "");
+    CORRADE_VERIFY(output.first());
+
+    Containers::Pointer<AbstractImporter> importer = importerManager.instantiate("TgaImporter");
+    CORRADE_VERIFY(importer->openFile(input));
+    Containers::Optional<ImageData2D> expected = importer->image2D(0);
+    CORRADE_VERIFY(expected);
+
+    for(const Containers::String& file: outputs) {
+        CORRADE_ITERATION(file);
+        CORRADE_VERIFY(importer->openFile(file));
+        Containers::Optional<ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), expected->size());
+        CORRADE_COMPARE(image->format(), expected->format());
+        CORRADE_COMPARE_AS(image->data(), expected->data(),
+            TestSuite::Compare::Container);
+    }
+    #endif
+}
+
+void ImageConverterTest::batchFailure() {
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+    if(!(converterManager.load("TgaImageConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImageConverter plugin can't be loaded.");
+
+    const Containers::String input = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga");
+    const Containers::String nonexistent = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/nonexistent.tga");
+    const Containers::String outputs[]{
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-failure0.tga"),
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-failure1.tga"),
+        Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-failure2.tga"),
+    };
+    for(const Containers::String& output: outputs)
+        if(Utility::Path::exists(output))
+            CORRADE_VERIFY(Utility::Path::remove(output));
+    const Containers::String profile = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/batch-failure.csv");
+    if(Utility::Path::exists(profile))
+        CORRADE_VERIFY(Utility::Path::remove(profile));
+
+    /* The middle item fails, the other two should still get converted and
+       the profile should be aggregated from both threads */
+    Containers::Pair<bool, Containers::String> output = call({
+        "-I", "TgaImporter", "-C", "TgaImageConverter", "-j", "2",
+        "--profile-format", "csv", "--profile-output", profile,
+        "--batch",
+        input, outputs[0],
+        nonexistent, outputs[1],
+        input, outputs[2]
+    });
+    CORRADE_COMPARE_AS(output.second(),
+        Utility::format("Cannot convert {} to {}\n", nonexistent, outputs[1]),
+        TestSuite::Compare::StringContains);
+    CORRADE_COMPARE_AS(output.second(),
+        "1 out of 3 conversions failed\n",
+        TestSuite::Compare::StringHasSuffix);
+    CORRADE_VERIFY(!output.first());
+
+    CORRADE_VERIFY(Utility::Path::exists(outputs[0]));
+    CORRADE_VERIFY(!Utility::Path::exists(outputs[1]));
+    CORRADE_VERIFY(Utility::Path::exists(outputs[2]));
+
+    /* The profile is still written even though one conversion failed, and
+       contains an import and a conversion event for each successful item */
+    Containers::Optional<Containers::String> csv = Utility::Path::readString(profile);
+    CORRADE_VERIFY(csv);
+    CORRADE_COMPARE_AS(*csv,
+        "stage,item,thread,begin,duration,bytesIn,bytesOut,peakMemory\n",
+        TestSuite::Compare::StringHasPrefix);
+    std::size_t openCount = 0, conversionCount = 0;
+    for(const Containers::StringView line: csv->splitWithoutEmptyParts('\n')) {
+        if(line.hasPrefix(Utility::format("open,{},", input)))
+            ++openCount;
+        else if(line.hasPrefix(Utility::format("TgaImageConverter,{},", outputs[0])) ||
+                line.hasPrefix(Utility::format("TgaImageConverter,{},", outputs[2])))
+            ++conversionCount;
+    }
+    CORRADE_COMPARE(openCount, 2);
+    CORRADE_COMPARE(conversionCount, 2);
+    CORRADE_COMPARE_AS(*csv,
+        "\ntotal,,,0,",
+        TestSuite::Compare::StringContains);
+    #endif
+}
+
+void ImageConverterTest::error() {
+    auto&& data = ErrorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    /* The options are checked before any file is opened, so no plugins are
+       needed */
+    Containers::Pair<bool, Containers::String> output = call(data.args);
+    CORRADE_COMPARE(output.second(), data.message);
+    CORRADE_VERIFY(!output.first());
+    #endif
+}
+
+void ImageConverterTest::mipmapsError() {
+    auto&& data = MipmapsErrorData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    /* A raw 2x2 input, so no importer plugin is needed. The format is checked
+       before the converter gets loaded, so no converter plugin either. */
+    const Containers::String input = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/mipmaps.bin");
+    CORRADE_VERIFY(Utility::Path::write(input, Containers::Array<char>{ValueInit, data.dataSize}));
+
+    Containers::Array<Containers::String> args{InPlaceInit, {
+        "-I", Utility::format("raw:{}", data.format), "--mipmaps"
+    }};
+    if(data.alphaCoverage)
+        arrayAppend(args, {"--mipmap-alpha-coverage"_s, data.alphaCoverage});
+    arrayAppend(args, {input, Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/mipmaps.ktx2")});
+
+    Containers::Pair<bool, Containers::String> output = call(args);
+    CORRADE_COMPARE(output.second(), data.message);
+    CORRADE_VERIFY(!output.first());
+    #endif
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageConverterTest)
@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImagePropertiesTest: TestSuite::Tester {
+    explicit ImagePropertiesTest();
+
+    void construct();
+    void constructCompressed();
+    void constructFromImage();
+    void constructFromImageCompressed();
+
+    void formatWrongType();
+};
+
+ImagePropertiesTest::ImagePropertiesTest() {
+    addTests({&ImagePropertiesTest::construct,
+              &ImagePropertiesTest::constructCompressed,
+              &ImagePropertiesTest::constructFromImage,
+              &ImagePropertiesTest::constructFromImageCompressed,
+
+              &ImagePropertiesTest::formatWrongType});
+}
+
+void ImagePropertiesTest::construct() {
+    ImageProperties2D properties{PixelFormat::RGBA8Unorm, {256, 128}, ImageFlag2D::Array};
+    CORRADE_VERIFY(!properties.isCompressed());
+    CORRADE_COMPARE(properties.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(properties.size(), (Vector2i{256, 128}));
+    CORRADE_COMPARE(properties.flags(), ImageFlag2D::Array);
+}
+
+void ImagePropertiesTest::constructCompressed() {
+    ImageProperties3D properties{CompressedPixelFormat::Bc1RGBAUnorm, {64, 64, 6}, ImageFlag3D::CubeMap};
+    CORRADE_VERIFY(properties.isCompressed());
+    CORRADE_COMPARE(properties.compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(properties.size(), (Vector3i{64, 64, 6}));
+    CORRADE_COMPARE(properties.flags(), ImageFlag3D::CubeMap);
+}
+
+void ImagePropertiesTest::constructFromImage() {
+    ImageData2D image{PixelFormat::RG16F, {3, 2}, Containers::Array<char>{NoInit, 3*2*4}, ImageFlag2D::Array};
+
+    ImageProperties2D properties{image};
+    CORRADE_VERIFY(!properties.isCompressed());
+    CORRADE_COMPARE(properties.format(), PixelFormat::RG16F);
+    CORRADE_COMPARE(properties.size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(properties.flags(), ImageFlag2D::Array);
+}
+
+void ImagePropertiesTest::constructFromImageCompressed() {
+    ImageData2D image{CompressedPixelFormat::Bc3RGBAUnorm, {8, 4}, Containers::Array<char>{NoInit, 2*16}};
+
+    ImageProperties2D properties{image};
+    CORRADE_VERIFY(properties.isCompressed());
+    CORRADE_COMPARE(properties.compressedFormat(), CompressedPixelFormat::Bc3RGBAUnorm);
+    CORRADE_COMPARE(properties.size(), (Vector2i{8, 4}));
+    CORRADE_COMPARE(properties.flags(), ImageFlags2D{});
+}
+
+void ImagePropertiesTest::formatWrongType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ImageProperties2D a{PixelFormat::R8Unorm, {1, 1}};
+    ImageProperties2D b{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    a.compressedFormat();
+    b.format();
+    CORRADE_COMPARE(out,
+        "Trade::ImageProperties::compressedFormat(): the image is not compressed\n"
+        "Trade::ImageProperties::format(): the image is compressed\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImagePropertiesTest)
@@ -0,0 +1,444 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/Trade/ImportCache.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImportCacheTest: TestSuite::Tester {
+    explicit ImportCacheTest();
+
+    void key();
+
+    void constructEmpty();
+    void constructMove();
+
+    void storeFind();
+    void storeReplace();
+    void storeTooLarge();
+    void storeInvalidKey();
+    void findNotFound();
+    void findInvalidKey();
+    void findFileMissing();
+
+    void evict();
+    void evictPersistent();
+    void evictOnConstruction();
+    void indexInvalidEntries();
+    void indexDuplicateEntries();
+    void indexNoTemporaryFile();
+
+    void clear();
+};
+
+using namespace Containers::Literals;
+
+ImportCacheTest::ImportCacheTest() {
+    addTests({&ImportCacheTest::key,
+
+              &ImportCacheTest::constructEmpty,
+              &ImportCacheTest::constructMove,
+
+              &ImportCacheTest::storeFind,
+              &ImportCacheTest::storeReplace,
+              &ImportCacheTest::storeTooLarge,
+              &ImportCacheTest::storeInvalidKey,
+              &ImportCacheTest::findNotFound,
+              &ImportCacheTest::findInvalidKey,
+              &ImportCacheTest::findFileMissing,
+
+              &ImportCacheTest::evict,
+              &ImportCacheTest::evictPersistent,
+              &ImportCacheTest::evictOnConstruction,
+              &ImportCacheTest::indexInvalidEntries,
+              &ImportCacheTest::indexDuplicateEntries,
+              &ImportCacheTest::indexNoTemporaryFile,
+
+              &ImportCacheTest::clear});
+}
+
+/* Returns an empty directory for given test case */
+Containers::String emptyDirectory(Containers::StringView name) {
+    const Containers::String directory = Utility::Path::join(Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImportCacheTestFiles"), name);
+    if(Utility::Path::exists(directory)) {
+        Containers::Optional<Containers::Array<Containers::String>> files = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDirectories|Utility::Path::ListFlag::SkipDotAndDotDot);
+        CORRADE_INTERNAL_ASSERT(files);
+        for(const Containers::String& file: *files)
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::remove(Utility::Path::join(directory, file)));
+    }
+    return directory;
+}
+
+void ImportCacheTest::key() {
+    const Containers::String a = ImportCache::key("hello"_s, "options");
+
+    /* 40 hexadecimal digits */
+    CORRADE_COMPARE(a.size(), 40);
+    for(const char c: a) {
+        CORRADE_ITERATION(c);
+        CORRADE_VERIFY((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'));
+    }
+
+    /* Same input gives the same key */
+    CORRADE_COMPARE(ImportCache::key("hello"_s, "options"), a);
+
+    /* Different data or options give a different key */
+    CORRADE_VERIFY(ImportCache::key("hellO"_s, "options") != a);
+    CORRADE_VERIFY(ImportCache::key("hello"_s, "option") != a);
+
+    /* The boundary between data and options matters as well */
+    CORRADE_VERIFY(ImportCache::key("helloo"_s, "ptions") != a);
+}
+
+void ImportCacheTest::constructEmpty() {
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImportCacheTestFiles/nonexistent");
+    CORRADE_VERIFY(!Utility::Path::exists(directory));
+
+    ImportCache cache{directory, 1024};
+    CORRADE_COMPARE(cache.directory(), directory);
+    CORRADE_COMPARE(cache.sizeLimit(), 1024);
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+
+    /* The directory isn't created until something gets stored */
+    CORRADE_VERIFY(!Utility::Path::exists(directory));
+}
+
+void ImportCacheTest::constructMove() {
+    const Containers::String directory = emptyDirectory("move");
+
+    ImportCache a{directory, 1024};
+    CORRADE_VERIFY(a.store("a", "hello"_s));
+
+    ImportCache b = Utility::move(a);
+    CORRADE_COMPARE(b.directory(), directory);
+    CORRADE_COMPARE(b.count(), 1);
+
+    ImportCache c{directory, 16};
+    c = Utility::move(b);
+    CORRADE_COMPARE(c.sizeLimit(), 1024);
+    CORRADE_COMPARE(c.count(), 1);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<ImportCache>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<ImportCache>::value);
+}
+
+void ImportCacheTest::storeFind() {
+    const Containers::String directory = emptyDirectory("storeFind");
+
+    {
+        ImportCache cache{directory, 1024};
+        CORRADE_VERIFY(cache.store("first", "hello"_s));
+        CORRADE_VERIFY(cache.store("second", "world!"_s));
+        CORRADE_COMPARE(cache.count(), 2);
+        CORRADE_COMPARE(cache.size(), 11);
+        CORRADE_VERIFY(cache.contains("first"));
+        CORRADE_VERIFY(cache.contains("second"));
+        CORRADE_VERIFY(!cache.contains("third"));
+
+        Containers::Optional<Containers::Array<char>> data = cache.find("first");
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE_AS(Containers::StringView{*data}, "hello",
+            TestSuite::Compare::String);
+    }
+
+    /* A new instance should see the same entries */
+    ImportCache cache{directory, 1024};
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.size(), 11);
+
+    Containers::Optional<Containers::Array<char>> data = cache.find("second");
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(Containers::StringView{*data}, "world!",
+        TestSuite::Compare::String);
+}
+
+void ImportCacheTest::storeReplace() {
+    const Containers::String directory = emptyDirectory("storeReplace");
+
+    ImportCache cache{directory, 1024};
+    CORRADE_VERIFY(cache.store("a", "hello"_s));
+    CORRADE_VERIFY(cache.store("a", "hey"_s));
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.size(), 3);
+
+    Containers::Optional<Containers::Array<char>> data = cache.find("a");
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE_AS(Containers::StringView{*data}, "hey",
+        TestSuite::Compare::String);
+}
+
+void ImportCacheTest::storeTooLarge() {
+    const Containers::String directory = emptyDirectory("storeTooLarge");
+
+    ImportCache cache{directory, 4};
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.store("a", "hello"_s));
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(out, "Trade::ImportCache::store(): entry of 5 bytes is larger than the size limit of 4 bytes\n");
+}
+
+void ImportCacheTest::storeInvalidKey() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ImportCache cache{emptyDirectory("storeInvalidKey"), 1024};
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.store("", "hello"_s);
+    cache.store("../a", "hello"_s);
+    CORRADE_COMPARE_AS(out,
+        "Trade::ImportCache::store(): invalid key \n"
+        "Trade::ImportCache::store(): invalid key ../a\n",
+        TestSuite::Compare::String);
+}
+
+void ImportCacheTest::findNotFound() {
+    ImportCache cache{emptyDirectory("findNotFound"), 1024};
+    CORRADE_VERIFY(cache.store("a", "hello"_s));
+
+    /* Not an error, nothing printed */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.find("b"));
+    CORRADE_COMPARE(out, "");
+}
+
+void ImportCacheTest::findInvalidKey() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ImportCache cache{emptyDirectory("findInvalidKey"), 1024};
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.find("a b");
+    CORRADE_COMPARE(out, "Trade::ImportCache::find(): invalid key a b\n");
+}
+
+void ImportCacheTest::findFileMissing() {
+    const Containers::String directory = emptyDirectory("findFileMissing");
+
+    ImportCache cache{directory, 1024};
+    CORRADE_VERIFY(cache.store("a", "hello"_s));
+    CORRADE_VERIFY(cache.store("b", "world"_s));
+    CORRADE_VERIFY(Utility::Path::remove(Utility::Path::join(directory, "a.blob")));
+
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_VERIFY(!cache.find("a"));
+    }
+    /* There's an error from Path::read() first, which is system-specific */
+    CORRADE_COMPARE_AS(out,
+        "Trade::ImportCache::find(): cannot read entry a\n",
+        TestSuite::Compare::StringHasSuffix);
+
+    /* The entry is removed */
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.size(), 5);
+    CORRADE_VERIFY(!cache.contains("a"));
+}
+
+void ImportCacheTest::evict() {
+    const Containers::String directory = emptyDirectory("evict");
+
+    ImportCache cache{directory, 10};
+    CORRADE_VERIFY(cache.store("a", "aaaa"_s));
+    CORRADE_VERIFY(cache.store("b", "bbbb"_s));
+
+    /* Using the first makes the second least recently used */
+    CORRADE_VERIFY(cache.find("a"));
+
+    /* Storing another exceeds the limit, the second one gets evicted
+       together with its file */
+    CORRADE_VERIFY(cache.store("c", "cccc"_s));
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.size(), 8);
+    CORRADE_VERIFY(cache.contains("a"));
+    CORRADE_VERIFY(!cache.contains("b"));
+    CORRADE_VERIFY(cache.contains("c"));
+    CORRADE_VERIFY(Utility::Path::exists(Utility::Path::join(directory, "a.blob")));
+    CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "b.blob")));
+    CORRADE_VERIFY(Utility::Path::exists(Utility::Path::join(directory, "c.blob")));
+
+    /* An entry large enough evicts everything else */
+    CORRADE_VERIFY(cache.store("d", "dddddddddd"_s));
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.size(), 10);
+    CORRADE_VERIFY(cache.contains("d"));
+}
+
+void ImportCacheTest::evictPersistent() {
+    const Containers::String directory = emptyDirectory("evictPersistent");
+
+    {
+        ImportCache cache{directory, 10};
+        CORRADE_VERIFY(cache.store("a", "aaaa"_s));
+        CORRADE_VERIFY(cache.store("b", "bbbb"_s));
+        CORRADE_VERIFY(cache.find("a"));
+    }
+
+    /* The use order is remembered across instances, so the second one gets
+       evicted */
+    ImportCache cache{directory, 10};
+    CORRADE_VERIFY(cache.store("c", "cccc"_s));
+    CORRADE_VERIFY(cache.contains("a"));
+    CORRADE_VERIFY(!cache.contains("b"));
+    CORRADE_VERIFY(cache.contains("c"));
+}
+
+void ImportCacheTest::evictOnConstruction() {
+    const Containers::String directory = emptyDirectory("evictOnConstruction");
+
+    {
+        ImportCache cache{directory, 12};
+        CORRADE_VERIFY(cache.store("a", "aaaa"_s));
+        CORRADE_VERIFY(cache.store("b", "bbbb"_s));
+        CORRADE_VERIFY(cache.store("c", "cccc"_s));
+        CORRADE_VERIFY(cache.find("a"));
+    }
+
+    /* Opening with a smaller limit evicts the least recently used entries
+       right away, together with their files */
+    {
+        ImportCache cache{directory, 8};
+        CORRADE_COMPARE(cache.count(), 2);
+        CORRADE_COMPARE(cache.size(), 8);
+        CORRADE_VERIFY(cache.contains("a"));
+        CORRADE_VERIFY(!cache.contains("b"));
+        CORRADE_VERIFY(cache.contains("c"));
+        CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "b.blob")));
+    }
+
+    /* The index is updated as well */
+    ImportCache cache{directory, 1024};
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.size(), 8);
+}
+
+void ImportCacheTest::indexInvalidEntries() {
+    const Containers::String directory = emptyDirectory("indexInvalidEntries");
+    CORRADE_VERIFY(Utility::Path::make(directory));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "a.blob"), "hello"_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "c.blob"), "hey"_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "index.txt"),
+        "5 a\n"
+        /* File doesn't exist */
+        "4 b\n"
+        /* Missing size */
+        " c\n"
+        /* Invalid size */
+        "3x c\n"
+        /* Invalid key */
+        "3 ../c\n"
+        /* Missing key */
+        "3\n"_s));
+
+    ImportCache cache{directory, 1024};
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.size(), 5);
+    CORRADE_VERIFY(cache.contains("a"));
+}
+
+void ImportCacheTest::indexDuplicateEntries() {
+    const Containers::String directory = emptyDirectory("indexDuplicateEntries");
+    CORRADE_VERIFY(Utility::Path::make(directory));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "a.blob"), "hello"_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "b.blob"), "hey"_s));
+    CORRADE_VERIFY(Utility::Path::write(Utility::Path::join(directory, "index.txt"),
+        "5 a\n"
+        "3 b\n"
+        "5 a\n"_s));
+
+    /* The entry is counted just once, and the last occurrence makes it the
+       most recently used, so b gets evicted first */
+    ImportCache cache{directory, 10};
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.size(), 8);
+
+    CORRADE_VERIFY(cache.store("c", "ccc"_s));
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.size(), 8);
+    CORRADE_VERIFY(cache.contains("a"));
+    CORRADE_VERIFY(!cache.contains("b"));
+    CORRADE_VERIFY(cache.contains("c"));
+}
+
+void ImportCacheTest::indexNoTemporaryFile() {
+    const Containers::String directory = emptyDirectory("indexNoTemporaryFile");
+
+    ImportCache cache{directory, 1024};
+    CORRADE_VERIFY(cache.store("a", "hello"_s));
+    CORRADE_VERIFY(cache.store("b", "hey"_s));
+    CORRADE_VERIFY(cache.find("a"));
+
+    /* The index is written to a temporary file and renamed over the
+       original, so no temporary file should stay behind */
+    CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "index.txt.tmp")));
+    Containers::Optional<Containers::String> index = Utility::Path::readString(Utility::Path::join(directory, "index.txt"));
+    CORRADE_VERIFY(index);
+    CORRADE_COMPARE_AS(*index,
+        "3 b\n"
+        "5 a\n",
+        TestSuite::Compare::String);
+}
+
+void ImportCacheTest::clear() {
+    const Containers::String directory = emptyDirectory("clear");
+
+    ImportCache cache{directory, 1024};
+    CORRADE_VERIFY(cache.store("a", "hello"_s));
+    CORRADE_VERIFY(cache.store("b", "world"_s));
+
+    cache.clear();
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "a.blob")));
+    CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "b.blob")));
+    CORRADE_VERIFY(!Utility::Path::exists(Utility::Path::join(directory, "index.txt")));
+
+    /* The directory itself stays */
+    CORRADE_VERIFY(Utility::Path::exists(directory));
+    CORRADE_COMPARE(ImportCache(directory, 1024).count(), 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImportCacheTest)
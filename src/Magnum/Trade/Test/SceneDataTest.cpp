@@ -169,6 +169,11 @@ struct SceneDataTest: TestSuite::Tester {
     template<class T> void findFieldObjectOffset();
     void findFieldObjectOffsetInvalidOffset();
     void fieldObjectOffsetNotFound();
+    template<class T> void findFieldObjectOffsetObjectIndex();
+    void objectIndex();
+    void objectIndexLazy();
+    void objectIndexMultipleThreads();
+    void objectIndexInvalid();
 
     template<class T> void mappingAsArrayByIndex();
     template<class T> void mappingAsArrayByName();
@@ -307,6 +312,15 @@ const struct {
         {5, 5, 5, 5, 5}, 5, 4, Containers::NullOpt}
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ObjectIndexMultipleThreadsData[]{
+    {"2 threads", 2},
+    {"5 threads", 5},
+    {"autodetected thread count", 0}
+};
+
 const struct {
     const char* name;
     std::size_t offset;
@@ -534,7 +548,22 @@ SceneDataTest::SceneDataTest() {
     }, Containers::arraySize(FindFieldObjectOffsetData));
 
     addTests({&SceneDataTest::findFieldObjectOffsetInvalidOffset,
-              &SceneDataTest::fieldObjectOffsetNotFound,
+              &SceneDataTest::fieldObjectOffsetNotFound});
+
+    addInstancedTests<SceneDataTest>({
+        &SceneDataTest::findFieldObjectOffsetObjectIndex<UnsignedByte>,
+        &SceneDataTest::findFieldObjectOffsetObjectIndex<UnsignedShort>,
+        &SceneDataTest::findFieldObjectOffsetObjectIndex<UnsignedInt>,
+        &SceneDataTest::findFieldObjectOffsetObjectIndex<UnsignedLong>
+    }, Containers::arraySize(FindFieldObjectOffsetData));
+
+    addTests({&SceneDataTest::objectIndex,
+              &SceneDataTest::objectIndexLazy});
+
+    addInstancedTests({&SceneDataTest::objectIndexMultipleThreads},
+        Containers::arraySize(ObjectIndexMultipleThreadsData));
+
+    addTests({&SceneDataTest::objectIndexInvalid,
 
               &SceneDataTest::mappingAsArrayByIndex<UnsignedByte>,
               &SceneDataTest::mappingAsArrayByIndex<UnsignedShort>,
@@ -4375,6 +4404,236 @@ void SceneDataTest::fieldObjectOffsetNotFound() {
         "Trade::SceneData::fieldObjectOffset(): object 1 not found in field Trade::SceneField::Mesh starting at offset 2\n");
 }
 
+template<class T> void SceneDataTest::findFieldObjectOffsetObjectIndex() {
+    setTestCaseTemplateName(NameTraits<T>::name());
+
+    auto&& data = FindFieldObjectOffsetData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Same as findFieldObjectOffset(), but with an object index built
+       upfront. It's not built for ordered or implicit fields. */
+
+    struct Field {
+        T object;
+        UnsignedInt mesh;
+    } fields[5]{
+        {T(data.mapping[0]), 0},
+        {T(data.mapping[1]), 0},
+        {T(data.mapping[2]), 0},
+        {T(data.mapping[3]), 0},
+        {T(data.mapping[4]), 0}
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{Implementation::sceneMappingTypeFor<T>(), 7, {}, fields, {
+        /* Test also with a completely empty field */
+        SceneFieldData{SceneField::Parent, Implementation::sceneMappingTypeFor<T>(), nullptr, SceneFieldType::Int, nullptr},
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh), data.flags}
+    }};
+    scene.buildObjectIndices();
+    CORRADE_VERIFY(scene.hasObjectIndex(0));
+    CORRADE_COMPARE(scene.hasObjectIndex(1), !(data.flags >= SceneFieldFlag::OrderedMapping));
+
+    /* An empty field should not find anything for any query with any flags */
+    if(data.offset == 0) {
+        CORRADE_COMPARE(scene.findFieldObjectOffset(0, data.object), Containers::NullOpt);
+        CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Parent, data.object), Containers::NullOpt);
+        CORRADE_VERIFY(!scene.hasFieldObject(0, data.object));
+        CORRADE_VERIFY(!scene.hasFieldObject(SceneField::Parent, data.object));
+    }
+
+    CORRADE_COMPARE(scene.findFieldObjectOffset(1, data.object, data.offset), data.expected);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, data.object, data.offset), data.expected);
+    if(data.offset == 0) {
+        CORRADE_COMPARE(scene.hasFieldObject(1, data.object), !!data.expected);
+        CORRADE_COMPARE(scene.hasFieldObject(SceneField::Mesh, data.object), !!data.expected);
+    }
+
+    if(data.expected) {
+        CORRADE_COMPARE(scene.fieldObjectOffset(1, data.object, data.offset), *data.expected);
+        CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, data.object, data.offset), *data.expected);
+    }
+}
+
+void SceneDataTest::objectIndex() {
+    struct Field {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Int meshMaterial;
+    };
+    struct Data {
+        Field fields[5];
+        UnsignedInt parentMapping[3];
+        Int parents[3];
+    } data[]{{{
+        {4, 1, -1},
+        {1, 3, 2},
+        {2, 4, 7},
+        {0, 5, 1},
+        {2, 5, 0}
+    }, {0, 1, 2}, {-1, 0, 0}}};
+    Containers::StridedArrayView1D<Field> view = data->fields;
+
+    SceneData scene{SceneMappingType::UnsignedInt, 7, DataFlag::Mutable, data, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)},
+        SceneFieldData{SceneField::MeshMaterial, view.slice(&Field::object), view.slice(&Field::meshMaterial)},
+        /* An ordered field doesn't get an index */
+        SceneFieldData{SceneField::Parent, Containers::arrayView(data->parentMapping), Containers::arrayView(data->parents), SceneFieldFlag::OrderedMapping}
+    }};
+    CORRADE_VERIFY(!scene.hasObjectIndex(0));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::MeshMaterial));
+    CORRADE_COMPARE(scene.objectIndexMemoryBudget(), 0);
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 0);
+
+    /* No index is built implicitly by default */
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 2), 2);
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Mesh));
+
+    scene.buildObjectIndex(SceneField::Mesh);
+    CORRADE_VERIFY(scene.hasObjectIndex(0));
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::MeshMaterial));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Parent));
+    /* Offsets for 7 objects + 2, and 5 entries */
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 4*(7 + 2 + 5));
+
+    /* Building again does nothing */
+    scene.buildObjectIndex(0);
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 4*(7 + 2 + 5));
+
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 4), 0);
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 2), 2);
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 2, 3), 4);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 2, 5), Containers::NullOpt);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 3), Containers::NullOpt);
+    CORRADE_VERIFY(!scene.hasFieldObject(SceneField::Mesh, 6));
+
+    /* Convenience accessors use the index as well */
+    CORRADE_COMPARE_AS(scene.meshesMaterialsFor(2),
+        (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({{4, 7}, {5, 0}})),
+        TestSuite::Compare::Container);
+
+    /* All fields except the ordered one */
+    scene.buildObjectIndices();
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::MeshMaterial));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Parent));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 2*4*(7 + 2 + 5));
+
+    /* Mutable mapping access discards all indices, as the mapping is shared
+       and can change */
+    scene.mutableMapping<UnsignedInt>(SceneField::Mesh)[0] = 3;
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::MeshMaterial));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 0);
+    CORRADE_COMPARE(scene.findFieldObjectOffset(SceneField::Mesh, 4), Containers::NullOpt);
+
+    scene.buildObjectIndex(SceneField::MeshMaterial);
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::MeshMaterial));
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::MeshMaterial, 3), 0);
+    scene.mutableData();
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::MeshMaterial));
+}
+
+void SceneDataTest::objectIndexLazy() {
+    struct Field {
+        UnsignedShort object;
+        UnsignedInt mesh;
+        UnsignedInt light;
+    } fields[]{
+        {4, 1, 0},
+        {1, 3, 1},
+        {2, 4, 2},
+        {0, 5, 3},
+        {2, 5, 4}
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    SceneData scene{SceneMappingType::UnsignedShort, 7, {}, fields, {
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)},
+        SceneFieldData{SceneField::Light, view.slice(&Field::object).exceptSuffix(1), view.slice(&Field::light).exceptSuffix(1)},
+    }};
+
+    /* Enough for the mesh field but not for both */
+    scene.setObjectIndexMemoryBudget(4*(7 + 2 + 5) + 4*(7 + 2 + 4) - 1);
+    CORRADE_COMPARE(scene.objectIndexMemoryBudget(), 4*(7 + 2 + 5) + 4*(7 + 2 + 4) - 1);
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Light));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 0);
+
+    /* First lookup builds the index */
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Mesh, 2, 3), 4);
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::Mesh));
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Light));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 4*(7 + 2 + 5));
+
+    /* The other field doesn't fit anymore, it's searched linearly */
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Light, 0), 3);
+    CORRADE_VERIFY(!scene.hasObjectIndex(SceneField::Light));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 4*(7 + 2 + 5));
+
+    /* Explicit build ignores the budget */
+    scene.buildObjectIndex(SceneField::Light);
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::Light));
+    CORRADE_COMPARE(scene.objectIndexMemoryUsage(), 4*(7 + 2 + 5) + 4*(7 + 2 + 4));
+    CORRADE_COMPARE(scene.fieldObjectOffset(SceneField::Light, 0), 3);
+}
+
+void SceneDataTest::objectIndexMultipleThreads() {
+    auto&& data = ObjectIndexMultipleThreadsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Large enough to be split among threads, with various objects having
+       zero, one or several entries */
+    Containers::Array<UnsignedInt> mapping{NoInit, 100000};
+    for(std::size_t i = 0; i != mapping.size(); ++i)
+        mapping[i] = (i*7919) % 30011;
+    Containers::ArrayView<const UnsignedInt> mappingView = mapping;
+
+    SceneData scene{SceneMappingType::UnsignedInt, 40000, {}, mapping, {
+        SceneFieldData{SceneField::Mesh, mappingView, mappingView}
+    }};
+    scene.buildObjectIndex(SceneField::Mesh, data.threadCount);
+    CORRADE_VERIFY(scene.hasObjectIndex(SceneField::Mesh));
+
+    /* Each entry is found when starting at its own offset, and following
+       the offsets for each object visits every entry exactly once */
+    std::size_t count = 0;
+    for(UnsignedInt object = 0; object != scene.mappingBound(); ++object) {
+        for(Containers::Optional<std::size_t> offset = scene.findFieldObjectOffset(0, object); offset; offset = scene.findFieldObjectOffset(0, object, *offset + 1)) {
+            CORRADE_ITERATION(object);
+            CORRADE_COMPARE(mapping[*offset], object);
+            ++count;
+        }
+    }
+    CORRADE_COMPARE(count, mapping.size());
+    for(std::size_t i = 0; i != mapping.size(); i += 97) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(scene.findFieldObjectOffset(0, mapping[i], i), i);
+    }
+}
+
+void SceneDataTest::objectIndexInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    SceneData scene{SceneMappingType::UnsignedInt, 7, nullptr, {
+        SceneFieldData{SceneField::Mesh, SceneMappingType::UnsignedInt, nullptr, SceneFieldType::UnsignedInt, nullptr}
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    scene.buildObjectIndex(1);
+    scene.buildObjectIndex(SceneField::Light);
+    scene.hasObjectIndex(1);
+    scene.hasObjectIndex(SceneField::Light);
+    CORRADE_COMPARE_AS(out,
+        "Trade::SceneData::buildObjectIndex(): index 1 out of range for 1 fields\n"
+        "Trade::SceneData::buildObjectIndex(): field Trade::SceneField::Light not found\n"
+        "Trade::SceneData::hasObjectIndex(): index 1 out of range for 1 fields\n"
+        "Trade::SceneData::hasObjectIndex(): field Trade::SceneField::Light not found\n",
+        TestSuite::Compare::String);
+}
+
 template<class T> void SceneDataTest::mappingAsArrayByIndex() {
     setTestCaseTemplateName(NameTraits<T>::name());
 
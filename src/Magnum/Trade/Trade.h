@@ -44,6 +44,8 @@ namespace Magnum { namespace Trade {
 class AbstractImageConverter;
 class AbstractImporter;
 class AbstractSceneConverter;
+class AsyncImporter;
+enum class AsyncImporterJobState: UnsignedByte;
 
 enum class MaterialAttribute: UnsignedInt;
 enum class MaterialTextureSwizzle: UnsignedInt;
@@ -69,6 +71,7 @@ class AnimationData;
 enum class CameraType: UnsignedByte;
 class CameraData;
 
+class DataArena;
 enum class DataFlag: UnsignedByte;
 typedef Containers::EnumSet<DataFlag> DataFlags;
 
@@ -79,6 +82,13 @@ typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
+template<UnsignedInt> class ImageProperties;
+typedef ImageProperties<1> ImageProperties1D;
+typedef ImageProperties<2> ImageProperties2D;
+typedef ImageProperties<3> ImageProperties3D;
+
+class ImportCache;
+
 enum class LightType: UnsignedByte;
 class LightData;
 
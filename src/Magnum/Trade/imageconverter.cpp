@@ -24,10 +24,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
+#include <cstdlib>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Algorithms.h>
@@ -36,9 +41,12 @@
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/Image.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Implementation/converterUtilities.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/TextureTools/Mipmap.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -207,6 +215,32 @@ file again:
 magnum-imageconverter cube-mips.exr --layer 2 --level 1 +x-128.exr
 @endcode
 
+Generating a full mip chain of a foliage texture with a Kaiser filter and
+preserving its alpha-tested coverage, saved into a KTX2 file using
+@relativeref{Trade,KtxImageConverter}:
+
+@code{.sh}
+magnum-imageconverter --mipmaps --mipmap-filter kaiser \
+    --mipmap-alpha-coverage 0.5 leaves.png leaves.ktx2
+@endcode
+
+@subsection magnum-imageconverter-example-batch Converting many images at once
+
+Converting a set of PNG files to KTX2 on all available CPU cores, with the
+plugins loaded just once per thread instead of once per file. Input and output
+files alternate on the command line:
+
+@code{.sh}
+magnum-imageconverter --batch -j0 a.png a.ktx2 b.png b.ktx2 c.png c.ktx2
+@endcode
+
+The same with input and output pairs listed in a file, one pair per line,
+using at most four threads:
+
+@code{.sh}
+magnum-imageconverter --batch-file images.txt -j4 -C StbDxtImageConverter
+@endcode
+
 @section magnum-imageconverter-usage Full usage documentation
 
 @code{.sh}
@@ -215,8 +249,10 @@ magnum-imageconverter [-h|--help] [-I|--importer PLUGIN]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]... [-D|--dimensions N]
     [--image N] [--level N] [--layer N] [--layers] [--levels] [--in-place]
-    [--info-importer] [--info-converter] [--info] [--color on|off|auto]
-    [-v|--verbose] [--profile] [--] input output
+    [--mipmaps] [--mipmap-filter box|kaiser|lanczos]
+    [--mipmap-alpha-coverage REFERENCE] [--batch] [--batch-file FILE] [-j|--jobs N] [--info-importer] [--info-converter] [--info] [--probe] [--color on|off|auto]
+    [-v|--verbose] [--profile] [--profile-format text|json|csv]
+    [--profile-output FILE] [--trace FILE] [--] input output
 @endcode
 
 Arguments:
@@ -245,12 +281,30 @@ Arguments:
     more
 -   `--levels` --- combine multiple image levels into a single file
 -   `--in-place` --- overwrite the input image with the output
+-   `--mipmaps` --- generate all mip levels of the output image
+-   `--mipmap-filter box|kaiser|lanczos` --- filter to use for `--mipmaps`
+    (default: `box`)
+-   `--mipmap-alpha-coverage REFERENCE` --- preserve alpha coverage for given
+    alpha reference value with `--mipmaps`
+-   `--batch` --- treat the input and output arguments as a list of input and
+    output pairs
+-   `--batch-file FILE` --- read input and output pairs from a file, implies
+    `--batch`
+-   `-j`, `--jobs N` --- process `--batch` inputs or generate `--mipmaps` on
+    given count of threads, `0` for all available (default: `1`)
 -   `--info-importer` --- print info about the importer plugin and exit
 -   `--info-converter` --- print info about the image converter plugin and exit
 -   `--info` --- print info about the input file and exit
+-   `--probe` --- with `--info`, query just image properties, parsing only
+    file headers where the importer supports it
 -   `--color` --- colored output for `--info` (default: `auto`)
 -   `-v`, `--verbose` --- verbose output from importer and converter plugins
 -   `--profile` --- measure import and conversion time
+-   `--profile-format text|json|csv` --- format of the `--profile` output
+    (default: `text`)
+-   `--profile-output FILE` --- save the `--profile` output to a file instead,
+    implies `--profile`
+-   `--trace FILE` --- save a Chrome trace of all import and conversion steps
 
 Specifying `--importer raw:&lt;format&gt;` will treat the input as a raw
 tightly-packed square of pixels in given @ref PixelFormat. Specifying `-C` /
@@ -268,6 +322,14 @@ independently of the `-D` / `--dimensions` option. In this case the input file
 is read but no no conversion is done and output file doesn't need to be
 specified.
 
+If `--probe` is given together with `--info`, only image properties are
+queried through @relativeref{Trade,AbstractImporter::image2DProperties()} and
+related APIs instead of importing the images, and data sizes aren't printed.
+With the default @relativeref{Trade,AnyImageImporter}, its
+@ref Trade-AnyImageImporter-probing "probe option" is enabled, which parses
+just the header for formats that support it. Together with `--map`, only the
+file headers are then read from the disk.
+
 The `-i` / `--importer-options` and `-c` / `--converter-options` arguments
 accept a comma-separated list of key/value pairs to set in the importer /
 converter plugin configuration. If the `=` character is omitted, it's
@@ -283,6 +345,38 @@ image-to-image or image-to-file conversion. If the last converter doesn't
 support conversion to a file, @relativeref{Trade,AnyImageConverter} is used to
 save its output; if no `-C` / `--converter` is specified,
 @relativeref{Trade,AnyImageConverter} is used.
+
+If `--mipmaps` is given, all mip levels down to a single pixel are generated
+from the (single-level) image using @ref TextureTools::generateMipmaps() and
+the result is saved as a multi-level image. The `--mipmap-filter` option
+selects the downsampling filter, with `--mipmap-alpha-coverage` the alpha
+channel of each level is scaled to preserve the fraction of pixels with alpha
+above given reference value. The levels are generated on `-j` / `--jobs`
+threads, or on a single thread with `--batch`. Only 2D and 3D images in 8-bit
+and 32-bit floating-point formats are supported.
+
+If `--batch` is given, the positional arguments are treated as a list of input
+and output file pairs, each converted separately with the same set of options.
+With `--batch-file`, the pairs are read from given file instead, one
+whitespace-separated input and output pair per line, with empty lines and
+lines starting with `#` ignored. The pairs are processed on `-j` / `--jobs`
+threads, each having its own importer and converter instances which are reused
+for all files it processes. A failure in one of the files is reported and
+doesn't stop the remaining conversions, the utility then exits with a non-zero
+code. The `--batch` option can't be combined with `--layers`, `--levels`,
+`--in-place` or `--info`.
+
+If `--profile` is given, the utility prints time spent in import and
+conversion, followed by a breakdown by stage --- opening each file, importing,
+combining layers and each converter plugin --- together with the amount of data
+each stage consumed and produced and peak memory usage of the process. With
+`--profile-format json` or `csv`, the output contains also a record for every
+processed item and is printed to the standard output or saved to a file given
+by `--profile-output`. All times in it are in microseconds and sizes in bytes.
+The `--trace` option saves the same records in the Trace Event Format, which
+can be opened in `chrome://tracing` or [Perfetto](https://ui.perfetto.dev/) to
+see how the work was distributed across threads. Peak memory usage is currently
+reported only on Unix platforms.
 */
 
 }
@@ -292,12 +386,65 @@ using namespace Containers::Literals;
 
 namespace {
 
+/* Plugin managers. In batch mode each thread gets its own, as plugin managers
+   aren't thread-safe and importers such as AnyImageImporter load and
+   instantiate other plugins when opening a file. */
+struct Managers {
+    explicit Managers(const Utility::Arguments& args);
+
+    PluginManager::Manager<Trade::AbstractImporter> importerManager;
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager;
+};
+
+Managers::Managers(const Utility::Arguments& args):
+    importerManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        args.value("plugin-dir").empty() ? Containers::String{} :
+        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
+        #endif
+    },
+    converterManager{
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        args.value("plugin-dir").empty() ? Containers::String{} :
+        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
+        #endif
+    }
+{
+    #ifdef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    static_cast<void>(args);
+    #endif
+}
+
+/* Per-thread state for conversion. The importer and converters are
+   instantiated on first use and then reused for all subsequent inputs, the
+   durations are accumulated over all of them. */
+struct Worker {
+    /* The converter array has one more item for the implicit
+       AnyImageConverter at the end */
+    explicit Worker(const Utility::Arguments& args): managers{InPlaceInit, args}, converters{ValueInit, args.arrayValueCount("converter") + 1} {}
+
+    /* Declared first so it's destroyed after all plugin instances */
+    Containers::Pointer<Managers> managers;
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    Containers::Array<Containers::Pointer<Trade::AbstractImageConverter>> converters;
+    /* Shared by all workers, null if profiling isn't requested */
+    Trade::Implementation::Profiler* profiler{};
+    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
+    std::chrono::high_resolution_clock::duration importTime{};
+    std::chrono::high_resolution_clock::duration conversionTime{};
+};
+
 bool isPluginInfoRequested(const Utility::Arguments& args) {
     return args.isSet("info-importer") ||
            args.isSet("info-converter");
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+bool isBatchRequested(const Utility::Arguments& args) {
+    return args.isSet("batch") ||
+           args.value<Containers::StringView>("batch-file");
+}
+
+template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     const bool compressed = images.front().isCompressed();
     PixelFormat format{};
@@ -312,7 +459,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
            (compressed && images[i].compressedFormat() != compressedFormat))
         {
             Error e;
-            e << "Images have different formats," << args.arrayValue("input", i) << "has";
+            e << "Images have different formats," << inputs[i] << "has";
             if(images[i].isCompressed())
                 e << images[i].compressedFormat();
             else
@@ -325,7 +472,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
             return false;
         }
         if(images[i].flags() != flags) {
-            Error{} << "Images have different flags," << args.arrayValue("input", i) << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
+            Error{} << "Images have different flags," << inputs[i] << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
             return false;
         }
     }
@@ -333,15 +480,15 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
     return true;
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
-    if(!checkCommonFormatFlags(args, images))
+template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+    if(!checkCommonFormatFlags(inputs, images))
         return false;
 
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     Math::Vector<dimensions, Int> size = images.front().size();
     for(std::size_t i = 1; i != images.size(); ++i) {
         if(images[i].size() != size) {
-            Error{} << "Images have different sizes," << args.arrayValue("input", i) << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
+            Error{} << "Images have different sizes," << inputs[i] << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
             return false;
         }
     }
@@ -357,6 +504,14 @@ template<template<UnsignedInt, class> class View, UnsignedInt dimensions> bool c
     return converter.convertToFile(views, output);
 }
 
+/* Total data size of all images, for profiling */
+template<UnsignedInt dimensions> std::size_t dataSize(const Containers::Array<Trade::ImageData<dimensions>>& images) {
+    std::size_t size = 0;
+    for(const Trade::ImageData<dimensions>& image: images)
+        size += image.data().size();
+    return size;
+}
+
 template<UnsignedInt dimensions> bool convertOneOrMoreImagesToFile(Trade::AbstractImageConverter& converter, const Containers::Array<Trade::ImageData<dimensions>>& outputImages, const Containers::StringView output) {
     /* If there's just one image, convert it using the single-level API.
        Otherwise the multi-level entrypoint would require the plugin to support
@@ -383,188 +538,91 @@ template<UnsignedInt dimensions> bool convertImages(Trade::AbstractImageConverte
     return true;
 }
 
+/* Parses the --mipmap-filter value, returns an empty Optional and prints an
+   error on an unknown value */
+Containers::Optional<TextureTools::MipmapFilter> mipmapFilter(const Containers::StringView value) {
+    if(value == "box"_s)
+        return TextureTools::MipmapFilter::Box;
+    if(value == "kaiser"_s)
+        return TextureTools::MipmapFilter::Kaiser;
+    if(value == "lanczos"_s)
+        return TextureTools::MipmapFilter::Lanczos;
+
+    Error{} << "Invalid --mipmap-filter value" << value << Debug::nospace << ", expected box, kaiser or lanczos";
+    return {};
 }
 
-int main(int argc, char** argv) {
-    Utility::Arguments args;
-    args.addArrayArgument("input").setHelp("input", "input image(s)")
-        .addArgument("output").setHelp("output", "output image; ignored if --info is present, disallowed for --in-place")
-        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
-        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
-        #endif
-        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
-        #endif
-        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
-        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
-        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
-        .addOption("image", "0").setHelp("image", "image to import", "N")
-        .addOption("level").setHelp("level", "import given image level instead of all", "N")
-        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
-        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
-        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
-        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
-        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
-        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
-        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
-        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
-        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
-        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
-        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
-            /* If --info for plugins is passed, we don't need the input */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "input" && isPluginInfoRequested(args))
-                return true;
-            /* If --in-place or --info for plugins or data is passed, we don't
-               need the output argument */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "output" && (args.isSet("in-place") || isPluginInfoRequested(args) || args.isSet("info")))
-                return true;
-
-            /* Handle all other errors as usual */
-            return false;
-        })
-        .setGlobalHelp(R"(Converts images of different formats.
-
-Specifying --importer raw:<format> will treat the input as a raw tightly-packed
-square of pixels in given pixel format. Specifying -C / --converter raw will
-save raw imported data instead of using a converter plugin.
-
-If the --info-importer or --info-converter option is given, the utility will
-print information about given plugin specified via the -I or -C option,
-including its configuration options potentially overriden with -i or -c. In
-this case no file is read and no conversion is done and neither the input nor
-the output file needs to be specified.
-
-If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
-read but no conversion is done and output file doesn't need to be specified.
-
-The -i / --importer-options and -c / --converter-options arguments accept a
-comma-separated list of key/value pairs to set in the importer / converter
-plugin configuration. If the = character is omitted, it's equivalent to saying
-key=true; configuration subgroups are delimited with /. Prefix the key with +
-to add new options or multiple options of the same name.
-
-It's possible to specify the -C / --converter option (and correspondingly also
--c / --converter-options) multiple times in order to chain more converters
-together. All converters in the chain have to support image-to-image
-conversion, the last converter has to be either raw or support either
-image-to-image or image-to-file conversion. If the last converter doesn't
-support conversion to a file, AnyImageConverter is used to save its output; if
-no -C / --converter is specified, AnyImageConverter is used.)")
-        .parse(argc, argv);
+/* Parses the --mipmap-alpha-coverage value, returns an empty Optional and
+   prints an error if it isn't a number in the [0, 1] range. Utility::Arguments
+   would silently turn anything unparsable into a zero. */
+Containers::Optional<Float> mipmapAlphaCoverageReference(const Containers::StringView value) {
+    const Containers::String nullTerminated = Containers::String::nullTerminatedView(value);
+    char* end;
+    const Float reference = std::strtof(nullTerminated.data(), &end);
+    if(!value || end != nullTerminated.end() || !(reference >= 0.0f && reference <= 1.0f)) {
+        Error{} << "Invalid --mipmap-alpha-coverage value" << value << Debug::nospace << ", expected a number between 0 and 1";
+        return {};
+    }
 
-    /* Colored output. Enable only if a TTY. */
-    Debug::Flags useColor;
-    if(args.value("color") == "on")
-        useColor = Debug::Flags{};
-    else if(args.value("color") == "off")
-        useColor = Debug::Flag::DisableColors;
-    else
-        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
+    return reference;
+}
 
-    /* Generic checks */
-    if(const std::size_t inputCount = args.arrayValueCount("input")) {
-        /* Not an error in this case, it should be possible to just append
-           --info* to existing command line without having to remove anything.
-           But print a warning at least, it could also be a mistyped option. */
-        if(isPluginInfoRequested(args)) {
-            Warning w;
-            w << "Ignoring input files for --info:";
-            for(std::size_t i = 0; i != inputCount; ++i)
-                w << args.arrayValue<Containers::StringView>("input", i);
-        }
+/* Checks that TextureTools::generateMipmaps() can handle given image format
+   and flags, prints an error otherwise. The function itself asserts on
+   those. */
+bool checkMipmapFormat(const PixelFormat format, const Utility::Arguments& args) {
+    if(isPixelFormatImplementationSpecific(format) || isPixelFormatDepthOrStencil(format)) {
+        Error{} << "The --mipmaps option isn't implemented for" << format;
+        return false;
     }
-    if(args.value<Containers::StringView>("output")) {
-        if(args.isSet("in-place")) {
-            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
-            return 1;
-        }
 
-        /* Same as above, it should be possible to just append --info* to
-           existing command line */
-        if(isPluginInfoRequested(args) || args.isSet("info"))
-            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
+    const PixelFormat channelFormat = pixelFormatChannelFormat(format);
+    if(channelFormat != PixelFormat::R8Unorm &&
+       channelFormat != PixelFormat::R8Srgb &&
+       channelFormat != PixelFormat::R32F) {
+        Error{} << "The --mipmaps option isn't implemented for" << format;
+        return false;
     }
 
-    /* Mutually incompatible options */
-    if(args.isSet("layers") && args.isSet("levels")) {
-        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
-        Error{} << "The --layers / --levels option can't be combined with --in-place";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
-        Error{} << "The --layers / --levels option can't be combined with --info";
-        return 1;
-    }
-    /* It can be combined with --levels though. This could potentially be
-       possible to implement, but I don't see a reason, all it would do is
-       picking Nth image from the input set and recompress it. OTOH, combining
-       --levels and --level "works", the --level picks Nth level from each
-       input image, although the usefulness of that is also doubtful. Why
-       create multi-level images from images that are already multi-level? */
-    if(args.isSet("layers") && !args.value("layer").empty()) {
-        Error{} << "The --layers option can't be combined with --layer.";
-        return 1;
-    }
-    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
-        Error{} << "The --levels option can't be combined with raw data output";
-        return 1;
-    }
-    if(!args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args)) {
-        Error{} << "Multiple input files require the --layers / --levels option to be set";
-        return 1;
+    if(args.value<Containers::StringView>("mipmap-alpha-coverage") && pixelFormatChannelCount(format) != 4) {
+        Error{} << "The --mipmap-alpha-coverage option expects a four-component format but got" << format;
+        return false;
     }
 
-    /* Importer and converter manager */
-    PluginManager::Manager<Trade::AbstractImporter> importerManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
-        #endif
-    };
-    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
-        #endif
-    };
-
-    /* Print plugin info, if requested */
-    if(args.isSet("info-importer")) {
-        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
-        if(!importer) {
-            Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
-            return 1;
-        }
+    return true;
+}
 
-        /* Set options, if passed */
-        if(args.isSet("verbose"))
-            importer->addFlags(Trade::ImporterFlag::Verbose);
-        Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
-        Trade::Implementation::printImporterInfo(useColor, *importer);
-        return 0;
+/* Appends all mip levels generated from the first (and only) image */
+template<UnsignedInt dimensions> void generateMipmaps(Containers::Array<Trade::ImageData<dimensions>>& images, const Utility::Arguments& args, const UnsignedInt threadCount) {
+    CORRADE_INTERNAL_ASSERT(images.size() == 1 && !images.front().isCompressed());
+
+    /* The alpha coverage value and the format are checked in main() and
+       checkMipmapFormat() already */
+    TextureTools::MipmapFlags flags;
+    Float alphaCoverageReference = 0.5f;
+    if(const Containers::StringView reference = args.value<Containers::StringView>("mipmap-alpha-coverage")) {
+        flags |= TextureTools::MipmapFlag::PreserveAlphaCoverage;
+        alphaCoverageReference = *mipmapAlphaCoverageReference(reference);
     }
-    if(args.isSet("info-converter")) {
-        Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.arrayValueCount("converter") ? args.arrayValue("converter", 0) : "AnyImageConverter");
-        if(!converter) {
-            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
-            return 1;
-        }
 
-        /* Set options, if passed */
-        if(args.isSet("verbose"))
-            converter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(args.arrayValueCount("converter-options"))
-            Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", 0));
-        Trade::Implementation::printImageConverterInfo(useColor, *converter);
-        return 0;
+    /* The filter value is checked in main() already */
+    Containers::Array<Image<dimensions>> levels = TextureTools::generateMipmaps(images.front(), *mipmapFilter(args.value<Containers::StringView>("mipmap-filter")), flags, alphaCoverageReference, threadCount);
+    arrayReserve(images, images.size() + levels.size());
+    for(Image<dimensions>& level: levels) {
+        /* Query everything before release() resets it */
+        const PixelFormat format = level.format();
+        const VectorTypeFor<dimensions, Int> size = level.size();
+        const ImageFlags<dimensions> levelFlags = level.flags();
+        arrayAppend(images, InPlaceInit, format, size, level.release(), levelFlags);
     }
+}
+
+/* Imports given input file(s), converts them and saves the result to the
+   output, or prints info about the input if --info is set. Returns 0 on
+   success and an exit code otherwise. */
+int convert(Worker& worker, const Utility::Arguments& args, const Debug::Flags useColor, const Containers::ArrayView<const Containers::StringView> inputs, const Containers::StringView output) {
+    std::chrono::high_resolution_clock::duration& importTime = worker.importTime;
+    std::chrono::high_resolution_clock::duration& conversionTime = worker.conversionTime;
 
     const Int dimensions = args.value<Int>("dimensions");
     /** @todo make them array options as well? */
@@ -575,15 +633,19 @@ no -C / --converter is specified, AnyImageConverter is used.)")
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     Containers::Array<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
     #endif
+    /* The importer is reused for subsequent inputs, close it on every exit
+       path so it doesn't stay opened on the memory-mapped data once
+       `mapped` goes out of scope. Declared after `mapped` so it's destroyed
+       before it. */
+    Containers::ScopeGuard closeImporter{&worker, [](Worker* worker) {
+        if(worker->importer) worker->importer->close();
+    }};
     Containers::Array<Trade::ImageData1D> images1D;
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration importTime{};
-
-    for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i) {
-        const Containers::StringView input = args.arrayValue<Containers::StringView>("input", i);
+    for(std::size_t i = 0; i != inputs.size(); ++i) {
+        const Containers::StringView input = inputs[i];
 
         /* Load raw data, if requested; assume it's a tightly-packed square of
            given format */
@@ -609,12 +671,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             if(args.isSet("map")) {
                 arrayAppend(mapped, InPlaceInit);
 
-                Trade::Implementation::Duration d{importTime};
+                Trade::Implementation::Duration d{importTime, worker.profiler, "open"_s, input};
                 Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mappedMaybe = Utility::Path::mapRead(input);
                 if(!mappedMaybe) {
                     Error() << "Cannot memory-map file" << input;
                     return 3;
                 }
+                d.setBytes(mappedMaybe->size(), 0);
 
                 /* Fake a mutable array with a non-owning deleter to have the
                    same type as from Path::read(). The actual memory is owned
@@ -624,12 +687,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             } else
             #endif
             {
-                Trade::Implementation::Duration d{importTime};
+                Trade::Implementation::Duration d{importTime, worker.profiler, "open"_s, input};
                 Containers::Optional<Containers::Array<char>> dataMaybe = Utility::Path::read(input);
                 if(!dataMaybe) {
                     Error{} << "Cannot read file" << input;
                     return 3;
                 }
+                d.setBytes(dataMaybe->size(), 0);
 
                 data = *Utility::move(dataMaybe);
             }
@@ -655,38 +719,50 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
         /* Otherwise load it using an importer plugin */
         } else {
-            Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
+            /* Instantiate the importer on first use, it's then reused for
+               all subsequent inputs */
+            Containers::Pointer<Trade::AbstractImporter>& importer = worker.importer;
             if(!importer) {
-                Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
-                return 1;
-            }
+                PluginManager::Manager<Trade::AbstractImporter>& importerManager = worker.managers->importerManager;
+                if(!(importer = importerManager.loadAndInstantiate(args.value("importer")))) {
+                    Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
+                    return 1;
+                }
 
-            /* Set options, if passed */
-            if(args.isSet("verbose"))
-                importer->addFlags(Trade::ImporterFlag::Verbose);
-            Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+                /* Set options, if passed */
+                if(args.isSet("verbose"))
+                    importer->addFlags(Trade::ImporterFlag::Verbose);
+                /* Enable header probing in AnyImageImporter. Set before the
+                   options so it can be still overriden with -i. */
+                if(args.isSet("probe") && args.value("importer") == "AnyImageImporter")
+                    importer->configuration().setValue("probe", true);
+                Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+            }
 
             /* Open the file or map it if requested */
             #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
             if(args.isSet("map")) {
                 arrayAppend(mapped, InPlaceInit);
 
-                Trade::Implementation::Duration d{importTime};
+                Trade::Implementation::Duration d{importTime, worker.profiler, "open"_s, input};
                 Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mappedMaybe = Utility::Path::mapRead(input);
                 if(!mappedMaybe || !importer->openMemory(*mappedMaybe)) {
                     Error() << "Cannot memory-map file" << input;
                     return 3;
                 }
+                d.setBytes(mappedMaybe->size(), 0);
 
                 mapped.back() = *Utility::move(mappedMaybe);
             } else
             #endif
             {
-                Trade::Implementation::Duration d{importTime};
+                Trade::Implementation::Duration d{importTime, worker.profiler, "open"_s, input};
                 if(!importer->openFile(input)) {
                     Error{} << "Cannot open file" << input;
                     return 3;
                 }
+                if(worker.profiler)
+                    d.setBytes(Trade::Implementation::fileSize(input), 0);
             }
 
             /* Print image info, if requested. This is always done for just one
@@ -703,9 +779,9 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                    output */
                 bool error = false;
                 Containers::Array<Trade::Implementation::ImageInfo> infos =
-                    Trade::Implementation::imageInfo(*importer, error, importTime);
+                    Trade::Implementation::imageInfo(*importer, error, importTime, args.isSet("probe"));
 
-                Trade::Implementation::printImageInfo(useColor, infos, nullptr, nullptr, nullptr);
+                Trade::Implementation::printImageInfo(useColor, infos, nullptr, nullptr, nullptr, args.isSet("probe"));
 
                 if(args.isSet("profile")) {
                     Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds";
@@ -750,7 +826,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                     }
                 }
                 for(; minLevel != maxLevel; ++minLevel) {
-                    if(Containers::Optional<Trade::ImageData1D> image1D = importer->image1D(image, minLevel)) {
+                    Containers::Optional<Trade::ImageData1D> image1D;
+                    {
+                        Trade::Implementation::Duration d{importTime, worker.profiler, "import"_s, input};
+                        if((image1D = importer->image1D(image, minLevel)))
+                            d.setBytes(0, image1D->data().size());
+                    }
+                    if(image1D) {
                         /* The --layer option is only for 2D/3D, not checking
                            any bounds here. If the option is present, the
                            extraction code below will fail. */
@@ -787,7 +869,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                     }
                 }
                 for(; minLevel != maxLevel; ++minLevel) {
-                    if(Containers::Optional<Trade::ImageData2D> image2D = importer->image2D(image, minLevel)) {
+                    Containers::Optional<Trade::ImageData2D> image2D;
+                    {
+                        Trade::Implementation::Duration d{importTime, worker.profiler, "import"_s, input};
+                        if((image2D = importer->image2D(image, minLevel)))
+                            d.setBytes(0, image2D->data().size());
+                    }
+                    if(image2D) {
                         /* Check bounds for the --layer option here, as we
                            won't have the filename etc. later */
                         if(!args.value("layer").empty() && args.value<Int>("layer") >= image2D->size().y()) {
@@ -828,7 +916,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                     }
                 }
                 for(; minLevel != maxLevel; ++minLevel) {
-                    if(Containers::Optional<Trade::ImageData3D> image3D = importer->image3D(image, minLevel)) {
+                    Containers::Optional<Trade::ImageData3D> image3D;
+                    {
+                        Trade::Implementation::Duration d{importTime, worker.profiler, "import"_s, input};
+                        if((image3D = importer->image3D(image, minLevel)))
+                            d.setBytes(0, image3D->data().size());
+                    }
+                    if(image3D) {
                         /* Check bounds for the --layer option here, as we
                            won't have the filename etc. later */
                         if(!args.value("layer").empty() && args.value<Int>("layer") >= image3D->size().z()) {
@@ -853,16 +947,6 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         }
     }
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration conversionTime{};
-
-    Containers::StringView output;
-    if(args.isSet("in-place")) {
-        /* Should have been checked in a graceful way above */
-        CORRADE_INTERNAL_ASSERT(args.arrayValueCount("input") == 1);
-        output = args.arrayValue<Containers::StringView>("input", 0);
-    } else output = args.value<Containers::StringView>("output");
-
     Int outputDimensions;
     Containers::Array<Trade::ImageData1D> outputImages1D;
     Containers::Array<Trade::ImageData2D> outputImages2D;
@@ -871,10 +955,10 @@ no -C / --converter is specified, AnyImageConverter is used.)")
     /* Combine multiple layers into an image of one dimension more */
     if(args.isSet("layers")) {
         /* To include allocation + copy costs in the output */
-        Trade::Implementation::Duration d{conversionTime};
+        Trade::Implementation::Duration d{conversionTime, worker.profiler, "layers"_s, output};
 
         if(dimensions == 1) {
-            if(!checkCommonFormatAndSize(args, images1D))
+            if(!checkCommonFormatAndSize(inputs, images1D))
                 return 1;
 
             outputDimensions = 2;
@@ -903,7 +987,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             }
 
         } else if(dimensions == 2) {
-            if(!checkCommonFormatAndSize(args, images2D))
+            if(!checkCommonFormatAndSize(inputs, images2D))
                 return 1;
 
             outputDimensions = 3;
@@ -950,7 +1034,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images2D))
+            if(!checkCommonFormatFlags(inputs, images2D))
                 return 1;
             if(!images2D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images2D.size(); ++i) {
@@ -981,7 +1065,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images3D))
+            if(!checkCommonFormatFlags(inputs, images3D))
                 return 1;
             if(!images3D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images3D.size(); ++i) {
@@ -1014,23 +1098,56 @@ no -C / --converter is specified, AnyImageConverter is used.)")
        --levels is set or if the (single) input image is multi-level. */
     } else {
         if(dimensions == 1) {
-            if(!checkCommonFormatFlags(args, images1D))
+            if(!checkCommonFormatFlags(inputs, images1D))
                 return 1;
             outputDimensions = 1;
             outputImages1D = Utility::move(images1D);
         } else if(dimensions == 2) {
-            if(!checkCommonFormatFlags(args, images2D))
+            if(!checkCommonFormatFlags(inputs, images2D))
                 return 1;
             outputDimensions = 2;
             outputImages2D = Utility::move(images2D);
         } else if(dimensions == 3) {
-            if(!checkCommonFormatFlags(args, images3D))
+            if(!checkCommonFormatFlags(inputs, images3D))
                 return 1;
             outputDimensions = 3;
             outputImages3D = Utility::move(images3D);
         } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
     }
 
+    /* Generate mip levels from the (single-level) output of the above */
+    if(args.isSet("mipmaps")) {
+        if(outputDimensions == 1) {
+            Error{} << "The --mipmaps option can be only used with 2D and 3D outputs, not 1D";
+            return 1;
+        }
+        if(outputImages2D.size() > 1 || outputImages3D.size() > 1) {
+            Error{} << "The --mipmaps option can't be used with multi-level images. Specify --level N to generate the levels from just one of them.";
+            return 1;
+        }
+        if((outputDimensions == 2 && outputImages2D.front().isCompressed()) ||
+           (outputDimensions == 3 && outputImages3D.front().isCompressed())) {
+            Error{} << "The --mipmaps option isn't implemented for compressed images";
+            return 1;
+        }
+        if(!checkMipmapFormat(outputDimensions == 2 ? outputImages2D.front().format() : outputImages3D.front().format(), args))
+            return 1;
+
+        /* In batch mode the files are already processed in parallel, so
+           use just a single thread for each */
+        const UnsignedInt threadCount = isBatchRequested(args) ? 1 : args.value<UnsignedInt>("jobs");
+
+        /* To include allocation + copy costs in the output */
+        Trade::Implementation::Duration d{conversionTime, worker.profiler, "mipmaps"_s, output};
+        const std::size_t sizeBefore = dataSize(outputImages2D) + dataSize(outputImages3D);
+        if(outputDimensions == 2)
+            generateMipmaps(outputImages2D, args, threadCount);
+        else if(outputDimensions == 3)
+            generateMipmaps(outputImages3D, args, threadCount);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+        d.setBytes(sizeBefore, dataSize(outputImages2D) + dataSize(outputImages3D));
+    }
+
     const bool outputIsMultiLevel =
         outputImages1D.size() > 1 ||
         outputImages2D.size() > 1 ||
@@ -1050,9 +1167,12 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             (outputDimensions == 2 && outputImages2D.front().isCompressed()) ||
             (outputDimensions == 3 && outputImages3D.front().isCompressed());
 
-        /* Load converter plugin if a raw conversion is not requested */
-        Containers::Pointer<Trade::AbstractImageConverter> converter;
-        if(converterName != "raw"_s) {
+        /* Load converter plugin if a raw conversion is not requested. It's
+           instantiated on first use and then reused for all subsequent
+           inputs. */
+        Containers::Pointer<Trade::AbstractImageConverter>& converter = worker.converters[i];
+        if(converterName != "raw"_s && !converter) {
+            PluginManager::Manager<Trade::AbstractImageConverter>& converterManager = worker.managers->converterManager;
             if(!(converter = converterManager.loadAndInstantiate(converterName))) {
                 Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
                 return 2;
@@ -1166,7 +1286,8 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                 } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
 
                 {
-                    Trade::Implementation::Duration d{conversionTime};
+                    Trade::Implementation::Duration d{conversionTime, worker.profiler, converterName, output};
+                    d.setBytes(data.size(), data.size());
                     if(!Utility::Path::write(output, data))
                         return 1;
                 }
@@ -1174,7 +1295,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             /* Convert to a file */
             } else {
                 bool converted;
-                Trade::Implementation::Duration d{conversionTime};
+                Trade::Implementation::Duration d{conversionTime, worker.profiler, converterName, output};
                 if(outputDimensions == 1)
                     converted = convertOneOrMoreImagesToFile(*converter, outputImages1D, output);
                 else if(outputDimensions == 2)
@@ -1186,6 +1307,8 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                     Error{} << "Cannot save file" << output;
                     return 5;
                 }
+                if(worker.profiler)
+                    d.setBytes(dataSize(outputImages1D) + dataSize(outputImages2D) + dataSize(outputImages3D), Trade::Implementation::fileSize(output));
             }
 
             break;
@@ -1230,7 +1353,8 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             }
 
             bool converted;
-            Trade::Implementation::Duration d{conversionTime};
+            Trade::Implementation::Duration d{conversionTime, worker.profiler, converterName, output};
+            const std::size_t sizeBefore = dataSize(outputImages1D) + dataSize(outputImages2D) + dataSize(outputImages3D);
             if(outputDimensions == 1)
                 converted = convertImages(*converter, outputImages1D);
             else if(outputDimensions == 2)
@@ -1242,11 +1366,381 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                 Error{} << converterName << "cannot convert the image";
                 return 5;
             }
+            d.setBytes(sizeBefore, dataSize(outputImages1D) + dataSize(outputImages2D) + dataSize(outputImages3D));
+        }
+    }
+
+    return 0;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArrayArgument("input").setHelp("input", "input image(s)")
+        .addArgument("output").setHelp("output", "output image; ignored if --info is present, disallowed for --in-place")
+        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
+        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        #endif
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
+        #endif
+        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
+        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
+        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
+        .addOption("image", "0").setHelp("image", "image to import", "N")
+        .addOption("level").setHelp("level", "import given image level instead of all", "N")
+        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
+        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
+        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
+        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
+        .addBooleanOption("mipmaps").setHelp("mipmaps", "generate all mip levels of the output image")
+        .addOption("mipmap-filter", "box").setHelp("mipmap-filter", "filter to use for --mipmaps", "box|kaiser|lanczos")
+        .addOption("mipmap-alpha-coverage").setHelp("mipmap-alpha-coverage", "preserve alpha coverage for given alpha reference value with --mipmaps", "REFERENCE")
+        .addBooleanOption("batch").setHelp("batch", "treat the input and output arguments as a list of input and output pairs")
+        .addOption("batch-file").setHelp("batch-file", "read input and output pairs from a file, implies --batch", "FILE")
+        .addOption('j', "jobs", "1").setHelp("jobs", "process --batch inputs or generate --mipmaps on given count of threads, 0 for all available", "N")
+        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
+        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
+        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
+        .addBooleanOption("probe").setHelp("probe", "with --info, query just image properties, parsing only file headers where the importer supports it")
+        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
+        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
+        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .addOption("profile-format", "text").setHelp("profile-format", "format of the --profile output", "text|json|csv")
+        .addOption("profile-output").setHelp("profile-output", "save the --profile output to a file instead, implies --profile", "FILE")
+        .addOption("trace").setHelp("trace", "save a Chrome trace of all import and conversion steps", "FILE")
+        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
+            /* If --info for plugins is passed, we don't need the input. With
+               --batch-file, the inputs can be all in the file. */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "input" && (isPluginInfoRequested(args) || args.value<Containers::StringView>("batch-file")))
+                return true;
+            /* If --in-place or --info for plugins or data is passed, we don't
+               need the output argument. With --batch, the pairs are checked
+               later. */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "output" && (args.isSet("in-place") || isPluginInfoRequested(args) || args.isSet("info") || isBatchRequested(args)))
+                return true;
+
+            /* Handle all other errors as usual */
+            return false;
+        })
+        .setGlobalHelp(R"(Converts images of different formats.
+
+Specifying --importer raw:<format> will treat the input as a raw tightly-packed
+square of pixels in given pixel format. Specifying -C / --converter raw will
+save raw imported data instead of using a converter plugin.
+
+If the --info-importer or --info-converter option is given, the utility will
+print information about given plugin specified via the -I or -C option,
+including its configuration options potentially overriden with -i or -c. In
+this case no file is read and no conversion is done and neither the input nor
+the output file needs to be specified.
+
+If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
+read but no conversion is done and output file doesn't need to be specified.
+
+If --probe is given together with --info, only image properties are queried
+instead of importing the images, and data sizes aren't printed. With the
+default AnyImageImporter, its probe option is enabled, which parses just the
+header for formats that support it.
+
+The -i / --importer-options and -c / --converter-options arguments accept a
+comma-separated list of key/value pairs to set in the importer / converter
+plugin configuration. If the = character is omitted, it's equivalent to saying
+key=true; configuration subgroups are delimited with /. Prefix the key with +
+to add new options or multiple options of the same name.
+
+It's possible to specify the -C / --converter option (and correspondingly also
+-c / --converter-options) multiple times in order to chain more converters
+together. All converters in the chain have to support image-to-image
+conversion, the last converter has to be either raw or support either
+image-to-image or image-to-file conversion. If the last converter doesn't
+support conversion to a file, AnyImageConverter is used to save its output; if
+no -C / --converter is specified, AnyImageConverter is used.
+
+If --mipmaps is given, all mip levels down to a single pixel are generated from
+the (single-level) image and the result is saved as a multi-level image. The
+--mipmap-filter option selects the downsampling filter, with
+--mipmap-alpha-coverage the alpha channel of each level is scaled to preserve
+the fraction of pixels with alpha above given reference value. The levels are
+generated on -j / --jobs threads, or on a single thread with --batch.
+
+If --batch is given, the positional arguments are treated as a list of input
+and output file pairs, each converted separately with the same set of options.
+With --batch-file, the pairs are read from given file instead, one
+whitespace-separated input and output pair per line, with empty lines and lines
+starting with # ignored. The pairs are processed on -j / --jobs threads, each
+reusing its importer and converter instances for all files it processes.
+
+If --profile is given, the utility prints time spent in import and conversion,
+followed by a breakdown by stage (opening each file, importing, combining
+layers and each converter plugin) together with the amount of data each stage
+consumed and produced and peak memory usage. With --profile-format json or csv,
+the output contains also a record for every processed item and is printed to
+the standard output or saved to a file given by --profile-output. All times in
+it are in microseconds and sizes in bytes. The --trace option saves the same
+records in the Trace Event Format, viewable in chrome://tracing or Perfetto.)")
+        .parse(argc, argv);
+
+    /* Colored output. Enable only if a TTY. */
+    Debug::Flags useColor;
+    if(args.value("color") == "on")
+        useColor = Debug::Flags{};
+    else if(args.value("color") == "off")
+        useColor = Debug::Flag::DisableColors;
+    else
+        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
+
+    /* Generic checks */
+    if(const std::size_t inputCount = args.arrayValueCount("input")) {
+        /* Not an error in this case, it should be possible to just append
+           --info* to existing command line without having to remove anything.
+           But print a warning at least, it could also be a mistyped option. */
+        if(isPluginInfoRequested(args)) {
+            Warning w;
+            w << "Ignoring input files for --info:";
+            for(std::size_t i = 0; i != inputCount; ++i)
+                w << args.arrayValue<Containers::StringView>("input", i);
+        }
+    }
+    if(args.value<Containers::StringView>("output")) {
+        if(args.isSet("in-place")) {
+            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
+            return 1;
         }
+
+        /* Same as above, it should be possible to just append --info* to
+           existing command line */
+        if(isPluginInfoRequested(args) || args.isSet("info"))
+            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
     }
 
-    if(args.isSet("profile")) {
-        Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds, conversion"
-            << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
+    /* Mutually incompatible options */
+    if(args.isSet("layers") && args.isSet("levels")) {
+        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
+        Error{} << "The --layers / --levels option can't be combined with --in-place";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
+        Error{} << "The --layers / --levels option can't be combined with --info";
+        return 1;
+    }
+    if(args.isSet("probe") && !args.isSet("info")) {
+        Error{} << "The --probe option can be only used together with --info";
+        return 1;
+    }
+    if(args.isSet("mipmaps") && (args.isSet("levels") || args.isSet("info"))) {
+        Error{} << "The --mipmaps option can't be combined with --levels or --info";
+        return 1;
+    }
+    if(args.isSet("mipmaps") && !mipmapFilter(args.value<Containers::StringView>("mipmap-filter")))
+        return 1;
+    if(args.isSet("mipmaps") && args.value<Containers::StringView>("mipmap-alpha-coverage") && !mipmapAlphaCoverageReference(args.value<Containers::StringView>("mipmap-alpha-coverage")))
+        return 1;
+    /* It can be combined with --levels though. This could potentially be
+       possible to implement, but I don't see a reason, all it would do is
+       picking Nth image from the input set and recompress it. OTOH, combining
+       --levels and --level "works", the --level picks Nth level from each
+       input image, although the usefulness of that is also doubtful. Why
+       create multi-level images from images that are already multi-level? */
+    if(args.isSet("layers") && !args.value("layer").empty()) {
+        Error{} << "The --layers option can't be combined with --layer.";
+        return 1;
+    }
+    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
+        Error{} << "The --levels option can't be combined with raw data output";
+        return 1;
+    }
+    if(isBatchRequested(args) && (args.isSet("layers") || args.isSet("levels") || args.isSet("in-place") || args.isSet("info"))) {
+        Error{} << "The --batch option can't be combined with --layers, --levels, --in-place or --info";
+        return 1;
+    }
+    if(!args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args) && !isBatchRequested(args)) {
+        Error{} << "Multiple input files require the --layers / --levels option to be set";
+        return 1;
+    }
+
+    if(!Trade::Implementation::checkProfileOptions(args))
+        return 1;
+
+    /* Collects per-stage and per-item timings for all workers */
+    Containers::Optional<Trade::Implementation::Profiler> profiler;
+    if(Trade::Implementation::isProfileRequested(args))
+        profiler.emplace();
+
+    /* Importer and converter manager, owned by the first worker. In batch
+       mode there's one worker per thread, otherwise just this one. */
+    Containers::Array<Worker> workers;
+    arrayAppend(workers, InPlaceInit, args).profiler = profiler ? &*profiler : nullptr;
+    PluginManager::Manager<Trade::AbstractImporter>& importerManager = workers[0].managers->importerManager;
+    PluginManager::Manager<Trade::AbstractImageConverter>& converterManager = workers[0].managers->converterManager;
+
+    /* Print plugin info, if requested */
+    if(args.isSet("info-importer")) {
+        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
+        if(!importer) {
+            Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
+            return 1;
+        }
+
+        /* Set options, if passed */
+        if(args.isSet("verbose"))
+            importer->addFlags(Trade::ImporterFlag::Verbose);
+        Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+        Trade::Implementation::printImporterInfo(useColor, *importer);
+        return 0;
+    }
+    if(args.isSet("info-converter")) {
+        Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.arrayValueCount("converter") ? args.arrayValue("converter", 0) : "AnyImageConverter");
+        if(!converter) {
+            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
+            return 1;
+        }
+
+        /* Set options, if passed */
+        if(args.isSet("verbose"))
+            converter->addFlags(Trade::ImageConverterFlag::Verbose);
+        if(args.arrayValueCount("converter-options"))
+            Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", 0));
+        Trade::Implementation::printImageConverterInfo(useColor, *converter);
+        return 0;
+    }
+
+    /* Batch mode, convert all input / output pairs on a pool of threads */
+    if(isBatchRequested(args)) {
+        /* Pairs from the command line, if any */
+        Containers::Array<Containers::Pair<Containers::StringView, Containers::StringView>> items;
+        {
+            Containers::Array<Containers::StringView> paths;
+            for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i)
+                arrayAppend(paths, args.arrayValue<Containers::StringView>("input", i));
+            if(const Containers::StringView output = args.value<Containers::StringView>("output"))
+                arrayAppend(paths, output);
+            if(paths.size() % 2) {
+                Error{} << "The --batch option expects input and output file pairs, got" << paths.size() << "files";
+                return 1;
+            }
+            for(std::size_t i = 0; i != paths.size(); i += 2)
+                arrayAppend(items, InPlaceInit, paths[i], paths[i + 1]);
+        }
+
+        /* Pairs from the batch file, if any. Kept in scope as the items
+           reference it. */
+        Containers::Optional<Containers::String> batchFile;
+        if(const Containers::StringView batchFilename = args.value<Containers::StringView>("batch-file")) {
+            if(!(batchFile = Utility::Path::readString(batchFilename))) {
+                Error{} << "Cannot read file" << batchFilename;
+                return 3;
+            }
+
+            std::size_t lineNumber = 0;
+            for(const Containers::StringView line: batchFile->split('\n')) {
+                ++lineNumber;
+                const Containers::StringView trimmed = line.trimmed();
+                if(!trimmed || trimmed.hasPrefix('#'))
+                    continue;
+
+                const Containers::Array<Containers::StringView> paths = trimmed.splitOnWhitespaceWithoutEmptyParts();
+                if(paths.size() != 2) {
+                    Error{} << "Expected an input and an output file on line" << lineNumber << "of" << batchFilename << Debug::nospace << ", got" << paths.size() << "items";
+                    return 1;
+                }
+                arrayAppend(items, InPlaceInit, paths[0], paths[1]);
+            }
+        }
+
+        if(items.isEmpty()) {
+            Error{} << "No input and output file pairs specified for --batch";
+            return 1;
+        }
+
+        /* Create the remaining workers. Each has its own plugin managers,
+           importer and converter instances, which are reused for all items
+           processed by given thread. */
+        const UnsignedInt threadCount = Magnum::Implementation::parallelForThreadCount(items.size(), args.value<UnsignedInt>("jobs"), 1);
+        /* The profiler pointer is copied out first, as reading workers[0]
+           in the same expression as a reallocating append isn't sequenced */
+        Trade::Implementation::Profiler* const workerProfiler = workers[0].profiler;
+        for(UnsignedInt i = 1; i < threadCount; ++i)
+            arrayAppend(workers, InPlaceInit, args).profiler = workerProfiler;
+        if(args.isSet("verbose"))
+            Debug{} << "Converting" << items.size() << "images on" << threadCount << "threads";
+
+        /* Each thread picks the next item from a shared counter so all stay
+           busy even if the images differ in size. A failure is reported for
+           given item and doesn't stop the others. */
+        Containers::Array<int> exitCodes{ValueInit, items.size()};
+        std::atomic<std::size_t> next{0};
+        std::chrono::high_resolution_clock::duration totalTime{};
+        {
+            Trade::Implementation::Duration d{totalTime};
+            Magnum::Implementation::parallelFor(workers.size(), workers.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+                for(std::size_t w = begin; w != end; ++w) {
+                    for(std::size_t i; (i = next++) < items.size(); ) {
+                        const Containers::StringView input = items[i].first();
+                        if((exitCodes[i] = convert(workers[w], args, useColor, {&input, 1}, items[i].second())))
+                            Error{} << "Cannot convert" << input << "to" << items[i].second();
+                    }
+                }
+            });
+        }
+
+        /* Import and conversion times are summed over all threads, so they
+           can be larger than the total wall time */
+        if(args.isSet("profile") && args.value<Containers::StringView>("profile-format") == "text"_s) {
+            std::chrono::high_resolution_clock::duration importTime{};
+            std::chrono::high_resolution_clock::duration conversionTime{};
+            for(const Worker& worker: workers) {
+                importTime += worker.importTime;
+                conversionTime += worker.conversionTime;
+            }
+            Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds, conversion"
+                << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds, converting" << items.size() << "images on" << threadCount << "threads took"
+                << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(totalTime).count())/1.0e3f << "seconds";
+        }
+        if(profiler && !Trade::Implementation::outputProfile(args, *profiler))
+            return 1;
+
+        std::size_t failedCount = 0;
+        for(const int exitCode: exitCodes)
+            if(exitCode) ++failedCount;
+        if(failedCount) {
+            Error{} << failedCount << "out of" << items.size() << "conversions failed";
+            return 1;
+        }
+
+        return 0;
+    }
+
+    Containers::Array<Containers::StringView> inputs;
+    arrayReserve(inputs, args.arrayValueCount("input"));
+    for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i)
+        arrayAppend(inputs, args.arrayValue<Containers::StringView>("input", i));
+
+    Containers::StringView output;
+    if(args.isSet("in-place")) {
+        /* Should have been checked in a graceful way above */
+        CORRADE_INTERNAL_ASSERT(inputs.size() == 1);
+        output = inputs[0];
+    } else output = args.value<Containers::StringView>("output");
+
+    if(const int exitCode = convert(workers[0], args, useColor, inputs, output))
+        return exitCode;
+
+    /* For --info the import time is printed directly in convert() */
+    if(!args.isSet("info")) {
+        if(args.isSet("profile") && args.value<Containers::StringView>("profile-format") == "text"_s) {
+            Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(workers[0].importTime).count())/1.0e3f << "seconds, conversion"
+                << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(workers[0].conversionTime).count())/1.0e3f << "seconds";
+        }
+        if(profiler && !Trade::Implementation::outputProfile(args, *profiler))
+            return 1;
     }
 }
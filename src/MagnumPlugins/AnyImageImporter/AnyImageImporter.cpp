@@ -27,22 +27,155 @@
 
 #include "AnyImageImporter.h"
 
+#include <string> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/Containers/Optional.h>
-#include <Corrade/Containers/StringView.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/PluginManager/PluginMetadata.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* lowercase() */
 
+#include "Magnum/FileCallback.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 #include "MagnumPlugins/Implementation/propagateConfiguration.h"
 
 namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+struct AnyImageImporter::Probed {
+    /* Either the filename or the data is used to open the file with the
+       concrete plugin once image data are requested */
+    Containers::String filename;
+    Containers::Array<char> data;
+    ImageProperties2D properties;
+};
+
+namespace {
+
+UnsignedInt readBigEndian32(const char* const data) {
+    return UnsignedInt(UnsignedByte(data[0])) << 24|
+           UnsignedInt(UnsignedByte(data[1])) << 16|
+           UnsignedInt(UnsignedByte(data[2])) << 8|
+           UnsignedInt(UnsignedByte(data[3]));
+}
+
+/* Reports the same format as PngImporter produces, i.e. with palettes and
+   bit depths lower than 8 expanded and transparency masks converted to an
+   alpha channel. https://www.w3.org/TR/png-3/#11IHDR */
+Containers::Optional<ImageProperties2D> probePng(const Containers::ArrayView<const char> data) {
+    /* Signature, IHDR length and type, width, height, bit depth and color
+       type. IHDR is required to be the first chunk and always has 13 bytes.
+       If any of that doesn't match, the file isn't a valid PNG and it's left
+       for the concrete plugin to fail on. */
+    if(data.size() < 26 ||
+       Containers::StringView{data.prefix(8)} != "\x89PNG\r\n\x1a\n"_s ||
+       readBigEndian32(data + 8) != 13 ||
+       Containers::StringView{data.sliceSize(12, 4)} != "IHDR"_s)
+        return {};
+
+    /* PNG limits the size to 2^31 - 1, leave anything larger for the plugin
+       to fail on instead of turning it into a negative size */
+    const UnsignedInt width = readBigEndian32(data + 16);
+    const UnsignedInt height = readBigEndian32(data + 20);
+    if(width > 0x7fffffffu || height > 0x7fffffffu)
+        return {};
+    const Vector2i size{Int(width), Int(height)};
+    const UnsignedByte bitDepth = data[24];
+    const UnsignedByte colorType = data[25];
+
+    /* Look for a transparency chunk, which can be only before the first image
+       data chunk. Gives up on truncated data, as that's what the concrete
+       plugin will fail on anyway. The chunk length is checked against the
+       remaining size before advancing, as with a 32-bit std::size_t a
+       crafted length could otherwise wrap the offset around and loop
+       forever. */
+    bool transparency = false;
+    for(std::size_t offset = 8; offset + 8 <= data.size(); ) {
+        const Containers::StringView type = data.sliceSize(offset + 4, 4);
+        if(type == "IDAT"_s || type == "IEND"_s)
+            break;
+        if(type == "tRNS"_s) {
+            transparency = true;
+            break;
+        }
+        const UnsignedInt length = readBigEndian32(data + offset);
+        if(data.size() - offset < 12 || length > data.size() - offset - 12)
+            break;
+        offset += 12 + std::size_t(length);
+    }
+
+    UnsignedInt channelCount;
+    switch(colorType) {
+        case 0: channelCount = transparency ? 2 : 1; break;
+        case 2: channelCount = transparency ? 4 : 3; break;
+        case 3: channelCount = transparency ? 4 : 3; break;
+        case 4: channelCount = 2; break;
+        case 6: channelCount = 4; break;
+        default: return {};
+    }
+
+    /* Palette entries are always 8-bit */
+    const PixelFormat channelFormat = bitDepth == 16 && colorType != 3 ?
+        PixelFormat::R16Unorm : PixelFormat::R8Unorm;
+    return ImageProperties2D{pixelFormat(channelFormat, channelCount, false), size};
+}
+
+/* Reports the same format as TgaImporter produces. Formats it doesn't
+   support, such as paletted images, are left for it to fail on. */
+Containers::Optional<ImageProperties2D> probeTga(const Containers::ArrayView<const char> data) {
+    /* Color map type at byte 1, image type at byte 2, width and height as
+       little-endian 16-bit values at byte 12 and 14, bits per pixel at byte
+       16 */
+    if(data.size() < 18 || data[1] != 0)
+        return {};
+
+    const UnsignedByte imageType = data[2] & ~8;
+    const UnsignedByte bpp = data[16];
+    PixelFormat format;
+    if(imageType == 2 && bpp == 24)
+        format = PixelFormat::RGB8Unorm;
+    else if(imageType == 2 && bpp == 32)
+        format = PixelFormat::RGBA8Unorm;
+    else if(imageType == 3 && bpp == 8)
+        format = PixelFormat::R8Unorm;
+    else return {};
+
+    return ImageProperties2D{format, {
+        Int(UnsignedByte(data[12])) | Int(UnsignedByte(data[13])) << 8,
+        Int(UnsignedByte(data[14])) | Int(UnsignedByte(data[15])) << 8}};
+}
+
+/* The probes model the default behavior of the concrete plugins. Thus they can
+   be used only if the plugin is actually the one that was probed for and not
+   just another plugin providing it, such as StbImageImporter providing
+   PngImporter, and if no options were propagated to it, as those can affect
+   the imported format, such as StbImageImporter forceChannelCount. */
+bool canProbe(const Containers::StringView plugin, const AbstractImporter& importer, Utility::ConfigurationGroup configuration) {
+    if((plugin != "PngImporter"_s && plugin != "TgaImporter"_s) ||
+       !importer.metadata() || importer.metadata()->name() != plugin)
+        return false;
+
+    configuration.removeValue("probe"_s);
+    return !configuration.hasValues() && !configuration.hasGroups();
+}
+
+Containers::Optional<ImageProperties2D> probe(const Containers::StringView plugin, const Containers::ArrayView<const char> data) {
+    if(plugin == "PngImporter"_s)
+        return probePng(data);
+    if(plugin == "TgaImporter"_s)
+        return probeTga(data);
+    return {};
+}
+
+}
+
 AnyImageImporter::AnyImageImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnyImageImporter::AnyImageImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
@@ -59,6 +192,53 @@ bool AnyImageImporter::doIsOpened() const { return !!_in; }
 
 void AnyImageImporter::doClose() {
     _in = nullptr;
+    _probed = nullptr;
+}
+
+void AnyImageImporter::doSetArena(DataArena* const arena) {
+    if(_in) _in->setArena(arena);
+}
+
+Containers::Pointer<AbstractImporter> AnyImageImporter::instantiate(const char* const messagePrefix, const Containers::StringView plugin) {
+    /* Try to load the plugin */
+    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error{} << messagePrefix << "cannot load the" << plugin << "plugin";
+        return {};
+    }
+
+    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
+    CORRADE_INTERNAL_ASSERT(metadata);
+    if(flags() & ImporterFlag::Verbose) {
+        Debug d;
+        d << messagePrefix << "using" << plugin;
+        if(plugin != metadata->name())
+            d << "(provided by" << metadata->name() << Debug::nospace << ")";
+    }
+
+    /* Instantiate the plugin, propagate flags and the arena */
+    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
+    importer->setFlags(flags());
+    importer->setArena(arena());
+
+    /* Propagate configuration, except for options of this plugin itself */
+    Utility::ConfigurationGroup configuration = this->configuration();
+    configuration.removeValue("probe"_s);
+    Magnum::Implementation::propagateConfiguration(messagePrefix, {}, metadata->name(), configuration, importer->configuration(), !(flags() & ImporterFlag::Quiet));
+
+    return importer;
+}
+
+bool AnyImageImporter::openProbed() {
+    if(!_probed)
+        return true;
+
+    /* Error output should be printed by the plugin itself. On failure the
+       probed state is kept so the next data access tries again. */
+    if(!(!_probed->filename.isEmpty() ? _in->openFile(_probed->filename) : _in->openData(_probed->data)))
+        return false;
+
+    _probed = nullptr;
+    return true;
 }
 
 void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
@@ -163,29 +343,41 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error{} << "Trade::AnyImageImporter::openFile(): cannot load the" << plugin << "plugin";
+    /* Load and instantiate the plugin, propagate the file callback, if set */
+    Containers::Pointer<AbstractImporter> importer = instantiate("Trade::AnyImageImporter::openFile():", plugin);
+    if(!importer)
         return;
-    }
-
-    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
-    CORRADE_INTERNAL_ASSERT(metadata);
-    if(flags() & ImporterFlag::Verbose) {
-        Debug d;
-        d << "Trade::AnyImageImporter::openFile(): using" << plugin;
-        if(plugin != metadata->name())
-            d << "(provided by" << metadata->name() << Debug::nospace << ")";
-    }
-
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
-    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    importer->setFlags(flags());
     if(fileCallback())
         importer->setFileCallback(fileCallback(), fileCallbackUserData());
 
-    /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openFile():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    /* If probing, parse just the file header if the format allows that and
+       delay opening the file until image data are requested. The file is
+       memory-mapped where possible so only the header gets actually read from
+       the disk. If the format can't be probed, open it fully. */
+    if(configuration().value<bool>("probe") && canProbe(plugin, *importer, configuration())) {
+        Containers::Optional<ImageProperties2D> properties;
+        if(fileCallback()) {
+            const Containers::Optional<Containers::ArrayView<const char>> data = fileCallback()(filename, InputFileCallbackPolicy::LoadTemporary, fileCallbackUserData());
+            if(data) {
+                properties = probe(plugin, *data);
+                fileCallback()(filename, InputFileCallbackPolicy::Close, fileCallbackUserData());
+            }
+        } else {
+            #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+            const Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(filename);
+            #else
+            const Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+            #endif
+            if(data)
+                properties = probe(plugin, *data);
+        }
+
+        if(properties) {
+            _probed.emplace(Containers::String{filename}, nullptr, *properties);
+            _in = Utility::move(importer);
+            return;
+        }
+    }
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
@@ -196,7 +388,7 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
     _in = Utility::move(importer);
 }
 
-void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
+void AnyImageImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     using namespace Containers::Literals;
 
     CORRADE_INTERNAL_ASSERT(manager());
@@ -319,30 +511,32 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
         return;
     }
 
-    /* Try to load the plugin */
-    if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
-        Error{} << "Trade::AnyImageImporter::openData(): cannot load the" << plugin << "plugin";
-        return;
-    }
-
-    const PluginManager::PluginMetadata* const metadata = manager()->metadata(plugin);
-    CORRADE_INTERNAL_ASSERT(metadata);
-    if(flags() & ImporterFlag::Verbose) {
-        Debug d;
-        d << "Trade::AnyImageImporter::openData(): using" << plugin;
-        if(plugin != metadata->name())
-            d << "(provided by" << metadata->name() << Debug::nospace << ")";
-    }
-
-    /* Instantiate the plugin, propagate flags. File callbacks not propagated
-       here as no image importers currently load any extra files. */
+    /* Load and instantiate the plugin. File callbacks not propagated here as
+       no image importers currently load any extra files. */
     /** @todo revisit callbacks when that becomes true (such as loading XMP
         files accompanying RAWs) */
-    Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
-    importer->setFlags(flags());
+    Containers::Pointer<AbstractImporter> importer = instantiate("Trade::AnyImageImporter::openData():", plugin);
+    if(!importer)
+        return;
 
-    /* Propagate configuration */
-    Magnum::Implementation::propagateConfiguration("Trade::AnyImageImporter::openData():", {}, metadata->name(), configuration(), importer->configuration(), !(flags() & ImporterFlag::Quiet));
+    /* If probing, parse just the header if the format allows that and delay
+       opening the data until image data are requested. Unless the data are
+       owned by us or guaranteed to stay in scope, they have to be copied. */
+    if(configuration().value<bool>("probe") && canProbe(plugin, *importer, configuration())) {
+        if(const Containers::Optional<ImageProperties2D> properties = probe(plugin, data)) {
+            Containers::Array<char> dataCopy;
+            if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned))
+                dataCopy = Utility::move(data);
+            else {
+                dataCopy = Containers::Array<char>{NoInit, data.size()};
+                Utility::copy(data, dataCopy);
+            }
+
+            _probed.emplace(Containers::String{}, Utility::move(dataCopy), *properties);
+            _in = Utility::move(importer);
+            return;
+        }
+    }
 
     /* Try to open the file (error output should be printed by the plugin
        itself) */
@@ -353,25 +547,46 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
     _in = Utility::move(importer);
 }
 
-UnsignedInt AnyImageImporter::doImage1DCount() const { return _in->image1DCount(); }
+/* The formats that can be probed have just a single 2D image with a single
+   level, so no 1D or 3D image accessors can be called while probed */
+
+UnsignedInt AnyImageImporter::doImage1DCount() const { return _probed ? 0 : _in->image1DCount(); }
 
 UnsignedInt AnyImageImporter::doImage1DLevelCount(UnsignedInt id) { return _in->image1DLevelCount(id); }
 
 Containers::Optional<ImageData1D> AnyImageImporter::doImage1D(const UnsignedInt id, const UnsignedInt level) { return _in->image1D(id, level); }
 
-UnsignedInt AnyImageImporter::doImage2DCount() const { return _in->image2DCount(); }
+Containers::Optional<ImageProperties1D> AnyImageImporter::doImage1DProperties(const UnsignedInt id, const UnsignedInt level) { return _in->image1DProperties(id, level); }
+
+UnsignedInt AnyImageImporter::doImage2DCount() const { return _probed ? 1 : _in->image2DCount(); }
 
-UnsignedInt AnyImageImporter::doImage2DLevelCount(UnsignedInt id) { return _in->image2DLevelCount(id); }
+UnsignedInt AnyImageImporter::doImage2DLevelCount(UnsignedInt id) {
+    return _probed ? 1 : _in->image2DLevelCount(id);
+}
 
-Containers::Optional<ImageData2D> AnyImageImporter::doImage2D(const UnsignedInt id, const UnsignedInt level) { return _in->image2D(id, level); }
+Containers::Optional<ImageData2D> AnyImageImporter::doImage2D(const UnsignedInt id, const UnsignedInt level) {
+    if(!openProbed())
+        return {};
+    return _in->image2D(id, level);
+}
 
-UnsignedInt AnyImageImporter::doImage3DCount() const { return _in->image3DCount(); }
+Containers::Optional<ImageProperties2D> AnyImageImporter::doImage2DProperties(const UnsignedInt id, const UnsignedInt level) {
+    if(_probed)
+        return _probed->properties;
+    return _in->image2DProperties(id, level);
+}
+
+UnsignedInt AnyImageImporter::doImage3DCount() const { return _probed ? 0 : _in->image3DCount(); }
 
 UnsignedInt AnyImageImporter::doImage3DLevelCount(UnsignedInt id) { return _in->image3DLevelCount(id); }
 
 Containers::Optional<ImageData3D> AnyImageImporter::doImage3D(const UnsignedInt id, const UnsignedInt level) { return _in->image3D(id, level); }
 
-const void* AnyImageImporter::doImporterState() const { return _in->importerState(); }
+Containers::Optional<ImageProperties3D> AnyImageImporter::doImage3DProperties(const UnsignedInt id, const UnsignedInt level) { return _in->image3DProperties(id, level); }
+
+/* The probed file isn't opened by the concrete plugin yet, so there's no
+   state to return */
+const void* AnyImageImporter::doImporterState() const { return _probed ? nullptr : _in->importerState(); }
 
 }}
 
@@ -154,14 +154,16 @@ information.
 On a call to @ref openFile() / @ref openData(), a file format is detected from
 the extension / file signature and a corresponding plugin is loaded. After
 that, flags set via @ref setFlags(), file callbacks set via
-@ref setFileCallback() and options set through @ref configuration() are
-propagated to the concrete implementation. A warning is emitted in case an
+@ref setFileCallback(), the arena set via @ref setArena() and options set
+through @ref configuration() are propagated to the concrete implementation. A warning is emitted in case an
 option set is not present in the default configuration of the target plugin.
 
 Calls to the @ref image1DCount() / @ref image2DCount() / @ref image3DCount(),
 @ref image1DLevelCount() / @ref image2DLevelCount() / @ref image3DLevelCount(),
-@ref image1D() / @ref image2D() / @ref image3D() and @ref importerState()
-functions are then proxied to the concrete implementation. The @ref close()
+@ref image1D() / @ref image2D() / @ref image3D(),
+@ref image1DProperties() / @ref image2DProperties() /
+@ref image3DProperties() and @ref importerState() functions are then proxied
+to the concrete implementation. The @ref close()
 function closes and discards the internally instantiated plugin;
 @ref isOpened() works as usual.
 
@@ -169,6 +171,36 @@ Besides delegating the flags, the @ref AnyImageImporter itself recognizes
 @ref ImporterFlag::Verbose, printing info about the concrete plugin being used
 when the flag is enabled. @ref ImporterFlag::Quiet is recognized as well and
 causes all warnings to be suppressed.
+
+@section Trade-AnyImageImporter-probing Header probing
+
+With the @cb{.ini} probe @ce @ref Trade-AnyImageImporter-configuration "configuration option"
+enabled, @ref openFile() / @ref openData() parses just the file header for
+PNG and TGA files and reports a single 2D image with a single level. The
+concrete plugin is loaded and instantiated as usual, but the file is opened
+with it only once @ref image2D() is called, meaning that
+@ref image2DProperties() can be queried without decoding any pixel data.
+Files opened with @ref openFile() are memory-mapped on platforms that support
+it, so only the header is read from the disk. Until the file is opened with
+the concrete plugin, @ref importerState() returns @cpp nullptr @ce.
+
+The reported format matches what the @ref PngImporter and @ref TgaImporter
+plugins produce with their default configuration, i.e. with palettes
+expanded, bit depths below 8 expanded to 8 and transparency masks converted
+to an alpha channel. Because of that, probing is done only if the concrete
+plugin is actually @ref PngImporter or @ref TgaImporter and not another plugin
+providing the format, such as @ref StbImageImporter, and if no options are
+propagated to it, as those could affect the imported format. Other file
+formats, as well as PNG and TGA files with a header that can't be probed, are
+opened fully with the concrete plugin right away.
+
+@section Trade-AnyImageImporter-configuration Plugin-specific configuration
+
+Apart from options propagated to the concrete implementation, the plugin
+recognizes the following options. See @ref plugins-configuration for more
+information and an example showing how to edit the configuration values.
+
+@snippet MagnumPlugins/AnyImageImporter/AnyImageImporter.conf configuration_
 */
 class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
     public:
@@ -201,24 +233,33 @@ class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
         MAGNUM_ANYIMAGEIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL void doClose() override;
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL void doSetArena(DataArena* arena) override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage1DLevelCount(UnsignedInt id) override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageProperties1D> doImage1DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage2DLevelCount(UnsignedInt id) override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageProperties2D> doImage2DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL UnsignedInt doImage3DLevelCount(UnsignedInt id) override;
         MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Optional<ImageProperties3D> doImage3DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL const void* doImporterState() const override;
 
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL Containers::Pointer<AbstractImporter> instantiate(const char* messagePrefix, Containers::StringView plugin);
+        MAGNUM_ANYIMAGEIMPORTER_LOCAL bool openProbed();
+
+        struct Probed;
         Containers::Pointer<AbstractImporter> _in;
+        Containers::Pointer<Probed> _probed;
 };
 
 }}
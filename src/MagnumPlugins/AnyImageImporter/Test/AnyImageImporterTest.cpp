@@ -39,7 +39,9 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/DebugTools/CompareImage.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 
 #include "configure.h"
 
@@ -64,6 +66,7 @@ struct AnyImageImporterTest: TestSuite::Tester {
     /* configuration propagation fully tested in AnySceneImporter, as there the
        plugins have configuration subgroups as well */
     void propagateFileCallback();
+    void propagateArena();
 
     void images1D();
     void images2D();
@@ -74,6 +77,15 @@ struct AnyImageImporterTest: TestSuite::Tester {
 
     void importerState();
 
+    void probe();
+    void probeFileCallback();
+    void probePng();
+    void probePngChunkLengthOutOfBounds();
+    void probePngSizeOutOfRange();
+    void probePngInvalid();
+    void probeForcedChannelCount();
+    void probeOpenFailed();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -219,6 +231,25 @@ constexpr struct {
     {"data, quiet", "rgb.tga", true, "openData", ImporterFlag::Quiet, true}
 };
 
+constexpr struct {
+    const char* name;
+    bool asData;
+} ProbeData[]{
+    {"", false},
+    {"data", true}
+};
+
+/* Modifying a single byte of a valid 3x2 8-bit RGB PNG header */
+constexpr struct {
+    const char* name;
+    std::size_t offset;
+    char value;
+} ProbePngInvalidData[]{
+    {"invalid signature", 1, 'Q'},
+    {"invalid IHDR length", 11, 12},
+    {"first chunk not IHDR", 15, 'X'},
+};
+
 AnyImageImporterTest::AnyImageImporterTest() {
     addInstancedTests({&AnyImageImporterTest::load},
         Containers::arraySize(LoadData));
@@ -247,6 +278,7 @@ AnyImageImporterTest::AnyImageImporterTest() {
         Containers::arraySize(PropagateConfigurationUnknownData));
 
     addTests({&AnyImageImporterTest::propagateFileCallback,
+              &AnyImageImporterTest::propagateArena,
 
               &AnyImageImporterTest::images1D,
               &AnyImageImporterTest::images2D,
@@ -257,6 +289,20 @@ AnyImageImporterTest::AnyImageImporterTest() {
 
               &AnyImageImporterTest::importerState});
 
+    addInstancedTests({&AnyImageImporterTest::probe},
+        Containers::arraySize(ProbeData));
+
+    addTests({&AnyImageImporterTest::probeFileCallback,
+              &AnyImageImporterTest::probePng,
+              &AnyImageImporterTest::probePngChunkLengthOutOfBounds,
+              &AnyImageImporterTest::probePngSizeOutOfRange});
+
+    addInstancedTests({&AnyImageImporterTest::probePngInvalid},
+        Containers::arraySize(ProbePngInvalidData));
+
+    addTests({&AnyImageImporterTest::probeForcedChannelCount,
+              &AnyImageImporterTest::probeOpenFailed});
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -542,6 +588,43 @@ void AnyImageImporterTest::propagateFileCallback() {
     CORRADE_VERIFY(!importer->isOpened());
 }
 
+void AnyImageImporterTest::propagateArena() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    /* Arena set before opening gets propagated to the concrete importer */
+    DataArena arena{1024};
+    importer->setArena(&arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+    {
+        Containers::Optional<ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(arena.size(), 18);
+    }
+
+    /* Arena set after opening as well */
+    DataArena another{1024};
+    importer->setArena(&another);
+    {
+        Containers::Optional<ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(arena.size(), 18);
+        CORRADE_COMPARE(another.size(), 18);
+    }
+
+    /* And resetting it goes back to owned allocations */
+    importer->setArena(nullptr);
+    {
+        Containers::Optional<ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    }
+}
+
 void AnyImageImporterTest::images1D() {
     PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
     #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
@@ -693,6 +776,289 @@ void AnyImageImporterTest::importerState() {
         TestSuite::Compare::Container);
 }
 
+void AnyImageImporterTest::probe() {
+    auto&& data = ProbeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+
+    /* The option shouldn't get propagated to the concrete plugin */
+    Containers::String out;
+    Warning redirectWarning{&out};
+    Containers::Optional<Containers::Array<char>> read = Utility::Path::read(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga"));
+    CORRADE_VERIFY(read);
+    if(data.asData)
+        CORRADE_VERIFY(importer->openData(*read));
+    else
+        CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga")));
+    CORRADE_COMPARE(out, "");
+
+    /* Overwrite the original data to verify a copy was made */
+    for(char& i: *read) i = '\0';
+
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->image2DLevelCount(0), 1);
+
+    /* The file isn't opened with the concrete plugin yet */
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_VERIFY(!properties->isCompressed());
+    CORRADE_COMPARE(properties->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+    CORRADE_VERIFY(!importer->importerState());
+
+    /* Getting the image opens it, after which the properties are proxied to
+       the concrete plugin */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{3, 2}));
+
+    properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+
+    importer->close();
+    CORRADE_VERIFY(!importer->isOpened());
+}
+
+void AnyImageImporterTest::probeFileCallback() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+
+    struct {
+        Containers::Array<char> storage;
+        Int loadCount = 0;
+    } state;
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy policy, decltype(state)& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        if(policy == InputFileCallbackPolicy::Close)
+            return {};
+        Containers::Optional<Containers::Array<char>> data = Utility::Path::read(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.tga"));
+        CORRADE_VERIFY(data);
+        state.storage = *Utility::move(data);
+        ++state.loadCount;
+        return Containers::ArrayView<const char>{state.storage};
+    }, state);
+
+    CORRADE_VERIFY(true); /* Capture correct function name first */
+
+    /* The header gets parsed from the file loaded through the callback */
+    CORRADE_VERIFY(importer->openFile("you-know-where-the-file-is.tga"));
+    CORRADE_COMPARE(state.loadCount, 1);
+
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(state.loadCount, 1);
+
+    /* The concrete plugin then loads it again through the same callback */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), (Vector2i{3, 2}));
+    CORRADE_COMPARE(state.loadCount, 2);
+}
+
+void AnyImageImporterTest::probePng() {
+    PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_VERIFY(manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Catch also ABI and interface mismatch errors */
+    if(!(manager.load("PngImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("PngImporter plugin can't be loaded.");
+
+    Containers::Pointer<AbstractImporter> importer = manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.png")));
+
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+
+    /* The probed properties should match what the plugin actually produces */
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), properties->format());
+    CORRADE_COMPARE(image->size(), properties->size());
+}
+
+void AnyImageImporterTest::probePngChunkLengthOutOfBounds() {
+    PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_VERIFY(manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Catch also ABI and interface mismatch errors */
+    if(!(manager.load("PngImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("PngImporter plugin can't be loaded.");
+
+    /* Signature, a 3x2 8-bit RGB IHDR and a chunk with a length that would,
+       with a 32-bit std::size_t, make the offset wrap around back to itself.
+       The search for a transparency chunk should stop there instead. */
+    const char data[]{
+        '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        0, 0, 0, 3, 0, 0, 0, 2, 8, 2, 0, 0, 0,
+        0, 0, 0, 0,
+        '\xff', '\xff', '\xff', '\xf4', 't', 'E', 'X', 't',
+        0, 0, 0, 0
+    };
+
+    Containers::Pointer<AbstractImporter> importer = manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+}
+
+void AnyImageImporterTest::probePngSizeOutOfRange() {
+    PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_VERIFY(manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Catch also ABI and interface mismatch errors */
+    if(!(manager.load("PngImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("PngImporter plugin can't be loaded.");
+
+    /* Signature and an IHDR with a width larger than 2^31 - 1, which isn't
+       probed but left for the concrete plugin to fail on */
+    const char data[]{
+        '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        '\x80', 0, 0, 0, 0, 0, 0, 2, 8, 2, 0, 0, 0,
+        0, 0, 0, 0
+    };
+
+    Containers::Pointer<AbstractImporter> importer = manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+    CORRADE_VERIFY(importer->openData(data));
+
+    /* There's no probed size, so the properties and the image come from the
+       concrete plugin, which fails. Not checking the message as it's
+       libpng-specific. */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_VERIFY(!out.isEmpty());
+}
+
+void AnyImageImporterTest::probePngInvalid() {
+    auto&& data = ProbePngInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_VERIFY(manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Catch also ABI and interface mismatch errors */
+    if(!(manager.load("PngImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("PngImporter plugin can't be loaded.");
+
+    char file[]{
+        '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        0, 0, 0, 3, 0, 0, 0, 2, 8, 2, 0, 0, 0,
+        0, 0, 0, 0
+    };
+    file[data.offset] = data.value;
+
+    /* Going through a file callback, as the data wouldn't be detected as a
+       PNG with an invalid signature */
+    Containers::ArrayView<const char> view = file;
+    Containers::Pointer<AbstractImporter> importer = manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::ArrayView<const char>& view) -> Containers::Optional<Containers::ArrayView<const char>> {
+        return view;
+    }, view);
+
+    /* The header isn't probed, so the properties come from the concrete
+       plugin, which fails instead of returning garbage. Not checking the
+       message as it's libpng-specific. */
+    Containers::String out;
+    Error redirectError{&out};
+    if(importer->openFile("invalid.png"))
+        CORRADE_VERIFY(!importer->image2DProperties(0));
+    CORRADE_VERIFY(!out.isEmpty());
+}
+
+void AnyImageImporterTest::probeForcedChannelCount() {
+    PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    #ifdef ANYIMAGEIMPORTER_PLUGIN_FILENAME
+    CORRADE_VERIFY(manager.load(ANYIMAGEIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Catch also ABI and interface mismatch errors */
+    if(!(manager.load("StbImageImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("StbImageImporter plugin can't be loaded.");
+
+    /* The PNG header probe models PngImporter with default options, which
+       neither matches StbImageImporter nor a forced channel count */
+    manager.setPreferredPlugins("PngImporter", {"StbImageImporter"});
+
+    Containers::Pointer<AbstractImporter> importer = manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+    importer->configuration().setValue("forceChannelCount", 1);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.png")));
+
+    /* The properties come from the concrete plugin, which has the file
+       opened already */
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), properties->format());
+    CORRADE_COMPARE(image->size(), properties->size());
+}
+
+void AnyImageImporterTest::probeOpenFailed() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+    importer->configuration().setValue("probe", true);
+
+    /* Just a header of a 3x2 RGB image, without any pixel data. Probing
+       succeeds, failure happens only once the data are requested. */
+    const char data[]{
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 24, 0
+    };
+    CORRADE_VERIFY(importer->openData(data));
+
+    Containers::Optional<ImageProperties2D> properties = importer->image2DProperties(0);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->size(), (Vector2i{3, 2}));
+
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        CORRADE_VERIFY(!importer->image2D(0));
+    }
+    CORRADE_COMPARE(out, "Trade::TgaImporter::image2D(): file too short, expected 36 bytes but got 18\n");
+
+    /* The importer stays opened */
+    CORRADE_VERIFY(importer->isOpened());
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AnyImageImporterTest)
@@ -83,8 +83,10 @@ bool AnySceneConverter::doConvertToFile(const MeshData& mesh, const Containers::
 
     /* Detect the plugin from extension */
     Containers::StringView plugin;
-    if(normalizedExtension == ".gltf"_s ||
-       normalizedExtension == ".glb"_s)
+    if(normalizedExtension == ".blob"_s)
+        plugin = "MagnumSceneConverter"_s;
+    else if(normalizedExtension == ".gltf"_s ||
+            normalizedExtension == ".glb"_s)
         plugin = "GltfSceneConverter"_s;
     else if(normalizedExtension == ".ply"_s)
         plugin = "StanfordSceneConverter"_s;
@@ -135,8 +137,10 @@ bool AnySceneConverter::doBeginFile(const Containers::StringView filename) {
 
     /* Detect the plugin from extension */
     Containers::StringView plugin;
-    if(normalizedExtension == ".gltf"_s ||
-       normalizedExtension == ".glb"_s)
+    if(normalizedExtension == ".blob"_s)
+        plugin = "MagnumSceneConverter"_s;
+    else if(normalizedExtension == ".gltf"_s ||
+            normalizedExtension == ".glb"_s)
         plugin = "GltfSceneConverter"_s;
     else if(normalizedExtension == ".ply"_s)
         plugin = "StanfordSceneConverter"_s;
@@ -106,6 +106,7 @@ constexpr struct {
     const char* filename;
     const char* plugin;
 } DetectConvertData[]{
+    {"Magnum binary", "scene.blob", "MagnumSceneConverter"},
     {"glTF", "khronos.gltf", "GltfSceneConverter"},
     {"glTF binary", "khronos.glb", "GltfSceneConverter"},
     {"Stanford PLY", "bunny.ply", "StanfordSceneConverter"},
@@ -118,6 +119,7 @@ constexpr struct {
     const char* filename;
     const char* plugin;
 } DetectBeginEndData[]{
+    {"Magnum binary", "scene.blob", "MagnumSceneConverter"},
     {"glTF", "khronos.gltf", "GltfSceneConverter"},
     {"glTF binary", "khronos.glb", "GltfSceneConverter"},
     {"Stanford PLY", "bunny.ply", "StanfordSceneConverter"},
@@ -36,6 +36,7 @@
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -74,6 +75,10 @@ void AnySceneImporter::doClose() {
     _in = nullptr;
 }
 
+void AnySceneImporter::doSetArena(DataArena* const arena) {
+    if(_in) _in->setArena(arena);
+}
+
 void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
     CORRADE_INTERNAL_ASSERT(manager());
 
@@ -120,6 +125,8 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
         plugin = "Ac3dImporter"_s;
     else if(normalized.hasSuffix(".blend"_s))
         plugin = "BlenderImporter"_s;
+    else if(normalized.hasSuffix(".blob"_s))
+        plugin = "MagnumImporter"_s;
     else if(normalized.hasSuffix(".bvh"_s))
         plugin = "BvhImporter"_s;
     else if(normalized.hasSuffix(".csm"_s))
@@ -200,9 +207,11 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
             d << "(provided by" << metadata->name() << Debug::nospace << ")";
     }
 
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
+    /* Instantiate the plugin, propagate flags, the arena and the file
+       callback, if set */
     Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
     importer->setFlags(flags());
+    importer->setArena(arena());
     if(fileCallback())
         importer->setFileCallback(fileCallback(), fileCallbackUserData());
 
@@ -295,6 +304,7 @@ UnsignedInt AnySceneImporter::doMeshLevelCount(UnsignedInt id) { return _in->mes
 Int AnySceneImporter::doMeshForName(const Containers::StringView name) { return _in->meshForName(name); }
 Containers::String AnySceneImporter::doMeshName(const UnsignedInt id) { return _in->meshName(id); }
 Containers::Optional<MeshData> AnySceneImporter::doMesh(const UnsignedInt id, const UnsignedInt level) { return _in->mesh(id, level); }
+bool AnySceneImporter::doMeshChunks(const UnsignedInt id, const UnsignedInt level, const std::size_t maxChunkSize, bool(*const callback)(MeshData&&, void*), void* const userData) { return _in->meshChunks(id, level, maxChunkSize, callback, userData); }
 
 MeshAttribute AnySceneImporter::doMeshAttributeForName(const Containers::StringView name) {
     /* This API can be called even if no file is opened, in that case return
@@ -336,18 +346,21 @@ UnsignedInt AnySceneImporter::doImage1DLevelCount(UnsignedInt id) { return _in->
 Int AnySceneImporter::doImage1DForName(const Containers::StringView name) { return _in->image1DForName(name); }
 Containers::String AnySceneImporter::doImage1DName(const UnsignedInt id) { return _in->image1DName(id); }
 Containers::Optional<ImageData1D> AnySceneImporter::doImage1D(const UnsignedInt id, const UnsignedInt level) { return _in->image1D(id, level); }
+Containers::Optional<ImageProperties1D> AnySceneImporter::doImage1DProperties(const UnsignedInt id, const UnsignedInt level) { return _in->image1DProperties(id, level); }
 
 UnsignedInt AnySceneImporter::doImage2DCount() const { return _in->image2DCount(); }
 UnsignedInt AnySceneImporter::doImage2DLevelCount(UnsignedInt id) { return _in->image2DLevelCount(id); }
 Int AnySceneImporter::doImage2DForName(const Containers::StringView name) { return _in->image2DForName(name); }
 Containers::String AnySceneImporter::doImage2DName(const UnsignedInt id) { return _in->image2DName(id); }
 Containers::Optional<ImageData2D> AnySceneImporter::doImage2D(const UnsignedInt id, const UnsignedInt level) { return _in->image2D(id, level); }
+Containers::Optional<ImageProperties2D> AnySceneImporter::doImage2DProperties(const UnsignedInt id, const UnsignedInt level) { return _in->image2DProperties(id, level); }
 
 UnsignedInt AnySceneImporter::doImage3DCount() const { return _in->image3DCount(); }
 UnsignedInt AnySceneImporter::doImage3DLevelCount(UnsignedInt id) { return _in->image3DLevelCount(id); }
 Int AnySceneImporter::doImage3DForName(const Containers::StringView name) { return _in->image3DForName(name); }
 Containers::String AnySceneImporter::doImage3DName(const UnsignedInt id) { return _in->image3DName(id); }
 Containers::Optional<ImageData3D> AnySceneImporter::doImage3D(const UnsignedInt id, const UnsignedInt level) { return _in->image3D(id, level); }
+Containers::Optional<ImageProperties3D> AnySceneImporter::doImage3DProperties(const UnsignedInt id, const UnsignedInt level) { return _in->image3DProperties(id, level); }
 
 const void* AnySceneImporter::doImporterState() const { return _in->importerState(); }
 
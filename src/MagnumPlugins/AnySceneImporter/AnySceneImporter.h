@@ -64,6 +64,8 @@ tries to open the file with it. Supported formats:
 -   AC3D (`*.ac`), loaded with any plugin that provides `Ac3dImporter`
 -   Blender 3D (`*.blend`), loaded with any plugin that provides
     `BlenderImporter`
+-   Magnum binary (`*.blob`), loaded with @ref MagnumImporter or any other
+    plugin that provides it
 -   Biovision BVH (`*.bvh`), loaded with any plugin that provides `BvhImporter`
 -   CharacterStudio Motion (`*.csm`), loaded with any plugin that provides
     `CsmImporter`
@@ -157,15 +159,16 @@ information.
 
 On a call to @ref openFile(), a file format is detected from the extension and
 a corresponding plugin is loaded. After that, flags set via @ref setFlags(),
-file callbacks set via @ref setFileCallback() and options set through
-@ref configuration() are propagated to the concrete implementation. A warning
+file callbacks set via @ref setFileCallback(), the arena set via
+@ref setArena() and options set through @ref configuration() are propagated to the concrete implementation. A warning
 is emitted in case an option set is not present in the default configuration of
 the target plugin.
 
 Calls to the @ref animation(), @ref scene(), @ref light(), @ref camera(),
 @ref skin2D(), @ref skin3D(), @ref mesh(), @ref material(), @ref texture(),
-@ref image1D(), @ref image2D(), @ref image3D(), corresponding
-count-/name-related functions and the @ref importerState() function are then
+@ref image1D(), @ref image2D(), @ref image3D(),
+@ref image1DProperties(), @ref image2DProperties(),
+@ref image3DProperties(), corresponding count-/name-related functions and the @ref importerState() function are then
 proxied to the concrete implementation. The @ref close() function closes and
 discards the internally instantiated plugin; @ref isOpened() works as usual.
 
@@ -192,6 +195,7 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL void doClose() override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL void doSetArena(DataArena* arena) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL UnsignedInt doAnimationCount() const override;
@@ -254,6 +258,7 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL bool doMeshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&&, void*), void* userData) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL MeshAttribute doMeshAttributeForName(Containers::StringView name) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::String doMeshAttributeName(MeshAttribute id) override;
@@ -289,18 +294,21 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
         MAGNUM_ANYSCENEIMPORTER_LOCAL Int doImage1DForName(Containers::StringView name) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::String doImage1DName(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageProperties1D> doImage1DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL UnsignedInt doImage2DLevelCount(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Int doImage2DForName(Containers::StringView name) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::String doImage2DName(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageProperties2D> doImage2DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL UnsignedInt doImage3DLevelCount(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Int doImage3DForName(Containers::StringView name) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::String doImage3DName(UnsignedInt id) override;
         MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_ANYSCENEIMPORTER_LOCAL Containers::Optional<ImageProperties3D> doImage3DProperties(UnsignedInt id, UnsignedInt level) override;
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL const void* doImporterState() const override;
 
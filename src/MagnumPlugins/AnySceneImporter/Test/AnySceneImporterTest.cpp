@@ -25,6 +25,7 @@
 */
 
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/PluginManager/Manager.h>
@@ -39,7 +40,9 @@
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImageProperties.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -75,6 +78,7 @@ struct AnySceneImporterTest: TestSuite::Tester {
     void propagateConfigurationUnknown();
     void propagateConfigurationUnknownInEmptySubgroup();
     void propagateFileCallback();
+    void propagateArena();
 
     void animations();
     void animationTrackTargetNameNoFileOpened();
@@ -97,6 +101,7 @@ struct AnySceneImporterTest: TestSuite::Tester {
     void meshesDeprecated3D();
     #endif
     void meshLevels();
+    void meshChunks();
     void meshAttributeNameNoFileOpened();
 
     void materials();
@@ -133,6 +138,7 @@ const struct {
     {"3MF", "print.3mf", "3mfImporter"},
     {"AC3D", "file.ac", "Ac3dImporter"},
     {"Blender", "suzanne.blend", "BlenderImporter"},
+    {"Magnum binary", "scene.blob", "MagnumImporter"},
     {"Biovision BVH", "scene.bvh", "BvhImporter"},
     {"CharacterStudio Motion", "motion.csm", "CsmImporter"},
     {"COLLADA", "xml.dae", "ColladaImporter"},
@@ -212,6 +218,7 @@ AnySceneImporterTest::AnySceneImporterTest() {
 
     addTests({&AnySceneImporterTest::propagateConfigurationUnknownInEmptySubgroup,
               &AnySceneImporterTest::propagateFileCallback,
+              &AnySceneImporterTest::propagateArena,
 
               &AnySceneImporterTest::animations,
               &AnySceneImporterTest::animationTrackTargetNameNoFileOpened,
@@ -234,6 +241,7 @@ AnySceneImporterTest::AnySceneImporterTest() {
               &AnySceneImporterTest::meshesDeprecated3D,
               #endif
               &AnySceneImporterTest::meshLevels,
+              &AnySceneImporterTest::meshChunks,
               &AnySceneImporterTest::meshAttributeNameNoFileOpened,
 
               &AnySceneImporterTest::materials,
@@ -469,6 +477,42 @@ void AnySceneImporterTest::propagateFileCallback() {
     CORRADE_VERIFY(!importer->isOpened());
 }
 
+void AnySceneImporterTest::propagateArena() {
+    if(!(_manager.loadState("ObjImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("ObjImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+
+    /* Arena set before opening gets propagated to the concrete importer */
+    DataArena arena{1024};
+    importer->setArena(&arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj")));
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(arena.size(), mesh->indexData().size() + mesh->vertexData().size());
+    }
+
+    /* Arena set after opening as well */
+    DataArena another{1024};
+    importer->setArena(&another);
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(another.size(), arena.size());
+    }
+
+    /* And resetting it goes back to owned allocations */
+    importer->setArena(nullptr);
+    {
+        Containers::Optional<MeshData> mesh = importer->mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    }
+}
+
 void AnySceneImporterTest::animations() {
     PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
     #ifdef ANYSCENEIMPORTER_PLUGIN_FILENAME
@@ -730,6 +774,41 @@ void AnySceneImporterTest::meshLevels() {
     CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Faces);
 }
 
+void AnySceneImporterTest::meshChunks() {
+    if(!(_manager.loadState("ObjImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("ObjImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj")));
+
+    /* ObjImporter budgets 36 bytes for each index, so each of the two lines
+       ends up in its own chunk */
+    Containers::Array<MeshData> chunks;
+    CORRADE_VERIFY(importer->meshChunks(1, 0, 72, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(chunks[0].primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(chunks[0].indexCount(), 2);
+    CORRADE_COMPARE(chunks[1].primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(chunks[1].indexCount(), 2);
+
+    /* The default implementation would import the whole mesh and split it,
+       which works with forward references. The native ObjImporter
+       implementation doesn't, which proves the call got delegated to it. */
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-forward-references.obj")));
+    arrayClear(chunks);
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->meshChunks(0, 0, 108, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 0);
+    CORRADE_COMPARE(out, "Trade::ObjImporter::mesh(): index 1 out of range for 0 vertices\n");
+}
+
 void AnySceneImporterTest::meshAttributeNameNoFileOpened() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
 
@@ -870,6 +949,11 @@ void AnySceneImporterTest::imageLevels2D() {
     Containers::Optional<Trade::ImageData2D> image = importer->image2D(1, 2);
     CORRADE_VERIFY(image);
     CORRADE_COMPARE(image->size(), (Vector2i{1, 1}));
+
+    /* Properties are proxied as well */
+    Containers::Optional<Trade::ImageProperties2D> properties = importer->image2DProperties(1, 2);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->size(), (Vector2i{1, 1}));
 }
 
 void AnySceneImporterTest::imageLevels3D() {
@@ -894,6 +978,11 @@ void AnySceneImporterTest::imageLevels3D() {
     Containers::Optional<Trade::ImageData3D> image = importer->image3D(1, 2);
     CORRADE_VERIFY(image);
     CORRADE_COMPARE(image->size(), (Vector3i{1, 1, 3}));
+
+    /* Properties are proxied as well */
+    Containers::Optional<Trade::ImageProperties3D> properties = importer->image3DProperties(1, 2);
+    CORRADE_VERIFY(properties);
+    CORRADE_COMPARE(properties->size(), (Vector3i{1, 1, 3}));
 }
 
 void AnySceneImporterTest::importerState() {
@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BcImageConverter.h"
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/Compress.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+BcImageConverter::BcImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImageConverter{manager, plugin} {}
+
+ImageConverterFeatures BcImageConverter::doFeatures() const { return ImageConverterFeature::Convert2D; }
+
+Containers::Optional<ImageData2D> BcImageConverter::doConvert(const ImageView2D& image) {
+    /* Pick the output format */
+    const PixelFormat format = image.format();
+    Containers::String outputFormat = configuration().value<Containers::String>("format"_s);
+    if(outputFormat.isEmpty()) {
+        if(format == PixelFormat::R8Unorm)
+            outputFormat = "bc4"_s;
+        else if(format == PixelFormat::RG8Unorm)
+            outputFormat = "bc5"_s;
+        else if(format == PixelFormat::RGB8Unorm || format == PixelFormat::RGB8Srgb)
+            outputFormat = "bc1"_s;
+        else if(format == PixelFormat::RGBA8Unorm || format == PixelFormat::RGBA8Srgb)
+            outputFormat = "bc3"_s;
+        else {
+            Error{} << "Trade::BcImageConverter::convert(): unsupported pixel format" << format;
+            return {};
+        }
+    }
+
+    const Containers::String qualityString = configuration().value<Containers::String>("quality"_s);
+    TextureTools::CompressionQuality quality;
+    if(qualityString == "fast"_s)
+        quality = TextureTools::CompressionQuality::Fast;
+    else if(qualityString == "normal"_s)
+        quality = TextureTools::CompressionQuality::Normal;
+    else if(qualityString == "high"_s)
+        quality = TextureTools::CompressionQuality::High;
+    else {
+        Error{} << "Trade::BcImageConverter::convert(): expected quality to be fast, normal or high but got" << qualityString;
+        return {};
+    }
+
+    const UnsignedInt threadCount = configuration().value<UnsignedInt>("threads"_s);
+
+    /* Check that the input format is supported by given output format, the
+       TextureTools APIs assert on that */
+    CompressedImage2D out;
+    if(outputFormat == "bc1"_s) {
+        if(format != PixelFormat::RGB8Unorm && format != PixelFormat::RGB8Srgb &&
+           format != PixelFormat::RGBA8Unorm && format != PixelFormat::RGBA8Srgb) {
+            Error{} << "Trade::BcImageConverter::convert(): unsupported pixel format" << format << "for bc1 output";
+            return {};
+        }
+        out = TextureTools::compressBc1(image, quality, threadCount);
+    } else if(outputFormat == "bc2"_s || outputFormat == "bc3"_s || outputFormat == "bc7"_s) {
+        if(format != PixelFormat::RGBA8Unorm && format != PixelFormat::RGBA8Srgb) {
+            Error{} << "Trade::BcImageConverter::convert(): unsupported pixel format" << format << "for" << outputFormat << "output";
+            return {};
+        }
+        if(outputFormat == "bc2"_s)
+            out = TextureTools::compressBc2(image, quality, threadCount);
+        else if(outputFormat == "bc3"_s)
+            out = TextureTools::compressBc3(image, quality, threadCount);
+        else
+            out = TextureTools::compressBc7(image, quality, threadCount);
+    } else if(outputFormat == "bc4"_s) {
+        if(format != PixelFormat::R8Unorm) {
+            Error{} << "Trade::BcImageConverter::convert(): unsupported pixel format" << format << "for bc4 output";
+            return {};
+        }
+        out = TextureTools::compressBc4(image, quality, threadCount);
+    } else if(outputFormat == "bc5"_s) {
+        if(format != PixelFormat::RG8Unorm) {
+            Error{} << "Trade::BcImageConverter::convert(): unsupported pixel format" << format << "for bc5 output";
+            return {};
+        }
+        out = TextureTools::compressBc5(image, quality, threadCount);
+    } else {
+        Error{} << "Trade::BcImageConverter::convert(): expected format to be empty or one of bc1, bc2, bc3, bc4, bc5 or bc7 but got" << outputFormat;
+        return {};
+    }
+
+    const CompressedPixelFormat outFormat = out.format();
+    const Vector2i outSize = out.size();
+    const ImageFlags2D outFlags = out.flags();
+    return ImageData2D{outFormat, outSize, out.release(), outFlags};
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(BcImageConverter, Magnum::Trade::BcImageConverter,
+    MAGNUM_TRADE_ABSTRACTIMAGECONVERTER_PLUGIN_INTERFACE)
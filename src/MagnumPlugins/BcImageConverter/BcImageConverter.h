@@ -0,0 +1,155 @@
+#ifndef Magnum_Trade_BcImageConverter_h
+#define Magnum_Trade_BcImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::BcImageConverter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "MagnumPlugins/BcImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BCIMAGECONVERTER_BUILD_STATIC
+    #if defined(BcImageConverter_EXPORTS) || defined(BcImageConverterObjects_EXPORTS)
+        #define MAGNUM_BCIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_BCIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_BCIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_BCIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_BCIMAGECONVERTER_EXPORT
+#define MAGNUM_BCIMAGECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief BC1-BC5 and BC7 image compressor plugin
+@m_since_latest
+
+Compresses 8-bit images to BC1, BC2, BC3, BC4, BC5 or BC7 using
+@ref TextureTools::compressBc1(), @relativeref{TextureTools,compressBc2()},
+@relativeref{TextureTools,compressBc3()},
+@relativeref{TextureTools,compressBc4()},
+@relativeref{TextureTools,compressBc5()} and
+@relativeref{TextureTools,compressBc7()}. The result is a compressed image
+that can be then saved with a converter that supports compressed images, such
+as @ref AnyImageConverter delegating to a DDS or KTX2 converter.
+
+@section Trade-BcImageConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    via the base @ref AbstractImageConverter interface. See its documentation
+    for introduction and usage examples.
+
+This plugin depends on the @ref Trade and @ref TextureTools libraries and is
+built if `MAGNUM_WITH_BCIMAGECONVERTER` is enabled when building Magnum. To use
+as a dynamic plugin, load @cpp "BcImageConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_BCIMAGECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::BcImageConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `BcImageConverter` component of the `Magnum` package and
+link to the `Magnum::BcImageConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED BcImageConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::BcImageConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-BcImageConverter-example Example usage
+
+As the plugin produces an image and not a file, it's meant to be chained with
+a file format converter. For example, compressing a PNG to a BC7 DDS file on
+all available cores with the @ref magnum-imageconverter "magnum-imageconverter"
+utility, assuming a plugin for DDS output is available, could look like this:
+
+@code{.sh}
+magnum-imageconverter image.png image.dds \
+    -C BcImageConverter -c format=bc7,threads=0 -C DdsImageConverter
+@endcode
+
+@section Trade-BcImageConverter-behavior Behavior and limitations
+
+Accepts 2D images in @ref PixelFormat::R8Unorm, @relativeref{PixelFormat,RG8Unorm},
+@relativeref{PixelFormat,RGB8Unorm}, @relativeref{PixelFormat,RGBA8Unorm} and
+their sRGB variants, as long as the chosen output format supports them.
+With an empty @cb{.ini} format @ce @ref Trade-BcImageConverter-configuration "configuration option",
+single-channel images are compressed to BC4, two-channel to BC5,
+three-channel to BC1 and four-channel to BC3. Image flags are passed through
+unchanged.
+
+The output is the same regardless of the @cb{.ini} threads @ce option used.
+See documentation of the @ref TextureTools::compressBc1() "TextureTools::compressBc*()"
+functions for details about the encoding and quality levels.
+
+@section Trade-BcImageConverter-configuration Plugin-specific configuration
+
+It's possible to tune various output options through @ref configuration(). See
+below for all options and their default values:
+
+@snippet MagnumPlugins/BcImageConverter/BcImageConverter.conf configuration_
+
+See @ref plugins-configuration for more information and an example showing how
+to edit the configuration values.
+*/
+class MAGNUM_BCIMAGECONVERTER_EXPORT BcImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit BcImageConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+    private:
+        MAGNUM_BCIMAGECONVERTER_LOCAL ImageConverterFeatures doFeatures() const override;
+        MAGNUM_BCIMAGECONVERTER_LOCAL Containers::Optional<ImageData2D> doConvert(const ImageView2D& image) override;
+};
+
+}}
+
+#endif
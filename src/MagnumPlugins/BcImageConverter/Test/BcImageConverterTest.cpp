@@ -0,0 +1,228 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+#include "Magnum/Trade/ImageData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct BcImageConverterTest: TestSuite::Tester {
+    explicit BcImageConverterTest();
+
+    void convert();
+    void convertAutodetect();
+
+    void invalidFormatOption();
+    void invalidQualityOption();
+    void unsupportedAutodetectFormat();
+    void unsupportedFormat();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImageConverter> _converterManager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    const char* format;
+    const char* quality;
+    UnsignedInt threads;
+    PixelFormat inputFormat;
+    UnsignedInt inputPixelSize;
+    CompressedPixelFormat expectedFormat;
+    UnsignedInt expectedBlockSize;
+} ConvertData[]{
+    {"BC1 from RGB", "bc1", "normal", 1,
+        PixelFormat::RGB8Unorm, 3, CompressedPixelFormat::Bc1RGBUnorm, 8},
+    {"BC1 from RGBA sRGB", "bc1", "fast", 1,
+        PixelFormat::RGBA8Srgb, 4, CompressedPixelFormat::Bc1RGBSrgb, 8},
+    {"BC2", "bc2", "normal", 1,
+        PixelFormat::RGBA8Unorm, 4, CompressedPixelFormat::Bc2RGBAUnorm, 16},
+    {"BC3 sRGB", "bc3", "high", 1,
+        PixelFormat::RGBA8Srgb, 4, CompressedPixelFormat::Bc3RGBASrgb, 16},
+    {"BC4", "bc4", "normal", 1,
+        PixelFormat::R8Unorm, 1, CompressedPixelFormat::Bc4RUnorm, 8},
+    {"BC5", "bc5", "normal", 1,
+        PixelFormat::RG8Unorm, 2, CompressedPixelFormat::Bc5RGUnorm, 16},
+    {"BC7", "bc7", "normal", 1,
+        PixelFormat::RGBA8Unorm, 4, CompressedPixelFormat::Bc7RGBAUnorm, 16},
+    {"BC7, three threads", "bc7", "normal", 3,
+        PixelFormat::RGBA8Unorm, 4, CompressedPixelFormat::Bc7RGBAUnorm, 16},
+};
+
+const struct {
+    const char* name;
+    PixelFormat inputFormat;
+    UnsignedInt inputPixelSize;
+    CompressedPixelFormat expectedFormat;
+} ConvertAutodetectData[]{
+    {"R", PixelFormat::R8Unorm, 1, CompressedPixelFormat::Bc4RUnorm},
+    {"RG", PixelFormat::RG8Unorm, 2, CompressedPixelFormat::Bc5RGUnorm},
+    {"RGB", PixelFormat::RGB8Unorm, 3, CompressedPixelFormat::Bc1RGBUnorm},
+    {"RGB sRGB", PixelFormat::RGB8Srgb, 3, CompressedPixelFormat::Bc1RGBSrgb},
+    {"RGBA", PixelFormat::RGBA8Unorm, 4, CompressedPixelFormat::Bc3RGBAUnorm},
+    {"RGBA sRGB", PixelFormat::RGBA8Srgb, 4, CompressedPixelFormat::Bc3RGBASrgb},
+};
+
+const struct {
+    const char* name;
+    const char* format;
+    PixelFormat inputFormat;
+    const char* message;
+} UnsupportedFormatData[]{
+    {"BC1", "bc1", PixelFormat::RG8Unorm,
+        "unsupported pixel format PixelFormat::RG8Unorm for bc1 output"},
+    {"BC2", "bc2", PixelFormat::RGB8Unorm,
+        "unsupported pixel format PixelFormat::RGB8Unorm for bc2 output"},
+    {"BC3", "bc3", PixelFormat::RGB8Srgb,
+        "unsupported pixel format PixelFormat::RGB8Srgb for bc3 output"},
+    {"BC4", "bc4", PixelFormat::R8Srgb,
+        "unsupported pixel format PixelFormat::R8Srgb for bc4 output"},
+    {"BC5", "bc5", PixelFormat::RGBA8Unorm,
+        "unsupported pixel format PixelFormat::RGBA8Unorm for bc5 output"},
+    {"BC7", "bc7", PixelFormat::RGBA16Unorm,
+        "unsupported pixel format PixelFormat::RGBA16Unorm for bc7 output"},
+};
+
+BcImageConverterTest::BcImageConverterTest() {
+    addInstancedTests({&BcImageConverterTest::convert},
+        Containers::arraySize(ConvertData));
+
+    addInstancedTests({&BcImageConverterTest::convertAutodetect},
+        Containers::arraySize(ConvertAutodetectData));
+
+    addTests({&BcImageConverterTest::invalidFormatOption,
+              &BcImageConverterTest::invalidQualityOption,
+              &BcImageConverterTest::unsupportedAutodetectFormat});
+
+    addInstancedTests({&BcImageConverterTest::unsupportedFormat},
+        Containers::arraySize(UnsupportedFormatData));
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef BCIMAGECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(BCIMAGECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void BcImageConverterTest::convert() {
+    auto&& data = ConvertData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+    converter->configuration().setValue("format", data.format);
+    converter->configuration().setValue("quality", data.quality);
+    converter->configuration().setValue("threads", data.threads);
+
+    /* The actual compression is tested in TextureToolsCompressTest, here just
+       verify the options are propagated. A size that isn't divisible by four
+       to verify it gets rounded up for the data size. */
+    const char pixels[4*6*5]{};
+    Containers::Optional<ImageData2D> out = converter->convert(ImageView2D{PixelStorage{}.setAlignment(1), data.inputFormat, {6, 5}, Containers::arrayView(pixels).prefix(data.inputPixelSize*6*5), ImageFlag2D::Array});
+    CORRADE_VERIFY(out);
+    CORRADE_VERIFY(out->isCompressed());
+    CORRADE_COMPARE(out->compressedFormat(), data.expectedFormat);
+    CORRADE_COMPARE(out->size(), (Vector2i{6, 5}));
+    CORRADE_COMPARE(out->flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(out->data().size(), std::size_t(2*2*data.expectedBlockSize));
+}
+
+void BcImageConverterTest::convertAutodetect() {
+    auto&& data = ConvertAutodetectData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+    CORRADE_COMPARE(converter->configuration().value("format"), "");
+
+    const char pixels[4*4*4]{};
+    Containers::Optional<ImageData2D> out = converter->convert(ImageView2D{PixelStorage{}.setAlignment(1), data.inputFormat, {4, 4}, Containers::arrayView(pixels).prefix(data.inputPixelSize*4*4)});
+    CORRADE_VERIFY(out);
+    CORRADE_VERIFY(out->isCompressed());
+    CORRADE_COMPARE(out->compressedFormat(), data.expectedFormat);
+    CORRADE_COMPARE(out->size(), (Vector2i{4, 4}));
+}
+
+void BcImageConverterTest::invalidFormatOption() {
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+    converter->configuration().setValue("format", "bc6h");
+
+    const char pixels[4*4*4]{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}));
+    CORRADE_COMPARE(out, "Trade::BcImageConverter::convert(): expected format to be empty or one of bc1, bc2, bc3, bc4, bc5 or bc7 but got bc6h\n");
+}
+
+void BcImageConverterTest::invalidQualityOption() {
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+    converter->configuration().setValue("quality", "ultra");
+
+    const char pixels[4*4*4]{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RGBA8Unorm, {4, 4}, pixels}));
+    CORRADE_COMPARE(out, "Trade::BcImageConverter::convert(): expected quality to be fast, normal or high but got ultra\n");
+}
+
+void BcImageConverterTest::unsupportedAutodetectFormat() {
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+
+    const char pixels[4*4*4]{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelFormat::RG16F, {4, 4}, pixels}));
+    CORRADE_COMPARE(out, "Trade::BcImageConverter::convert(): unsupported pixel format PixelFormat::RG16F\n");
+}
+
+void BcImageConverterTest::unsupportedFormat() {
+    auto&& data = UnsupportedFormatData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImageConverter> converter = _converterManager.instantiate("BcImageConverter");
+    converter->configuration().setValue("format", data.format);
+
+    const char pixels[8*4*4]{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->convert(ImageView2D{PixelStorage{}.setAlignment(1), data.inputFormat, {4, 4}, Containers::arrayView(pixels).prefix(pixelFormatSize(data.inputFormat)*4*4)}));
+    CORRADE_COMPARE(out, Utility::format("Trade::BcImageConverter::convert(): {}\n", data.message));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BcImageConverterTest)
@@ -0,0 +1,242 @@
+#ifndef Magnum_Trade_Implementation_blob_h
+#define Magnum_Trade_Implementation_blob_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Magnum.h"
+
+/* Layout of the binary format written by MagnumSceneConverter and read by
+   MagnumImporter. All structures are written in the native byte order and
+   only have fixed-size members, explicitly padded so there's no
+   compiler-dependent padding. The file is:
+
+    -   BlobHeader, padded to BlobAlignment
+    -   chunk data, with each chunk and each data region inside a chunk being
+        aligned to BlobAlignment
+    -   BlobHeader::chunkCount BlobChunk entries at BlobHeader::chunkOffset
+
+   The chunk table is at the end so the converter can write the chunk data
+   directly into the output without knowing the chunk count upfront.
+
+   All offsets in BlobChunk are from the start of the file, offsets in the
+   per-chunk structures are from the start of the chunk. Chunk names are not
+   null-terminated.
+
+   Because all data are aligned and the vertex, index, field, material
+   attribute and pixel data are stored in exactly the layout the Trade
+   classes use, the importer can return views directly on a memory-mapped
+   file. Increment BlobVersion on every incompatible change, including a
+   change to the MaterialAttributeData layout, which is stored as-is. */
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+/* Used only in plugins where we don't want it to be exported */
+namespace {
+
+constexpr char BlobMagic[]{'B', 'L', 'O', 'B'};
+constexpr UnsignedShort BlobVersion = 1;
+/* Reads as 0x0201 on a machine with a different byte order */
+constexpr UnsignedShort BlobByteOrderMark = 0x0102;
+constexpr std::size_t BlobAlignment = 16;
+
+inline std::size_t blobAlign(const std::size_t offset) {
+    return (offset + BlobAlignment - 1)/BlobAlignment*BlobAlignment;
+}
+
+enum class BlobChunkType: UnsignedInt {
+    /* BlobMeshHeader directly followed by BlobMeshAttribute entries, index
+       and vertex data */
+    Mesh = 1,
+    /* BlobSceneHeader directly followed by BlobSceneField entries, field
+       data */
+    Scene = 2,
+    /* BlobMaterialHeader, MaterialAttributeData entries and layer offsets */
+    Material = 3,
+    /* BlobTexture */
+    Texture = 4,
+    /* BlobImageHeader and image data */
+    Image1D = 5,
+    Image2D = 6,
+    Image3D = 7,
+    /* A single UnsignedInt with the custom field / attribute value, the chunk
+       name is the field / attribute name */
+    SceneFieldName = 8,
+    MeshAttributeName = 9,
+    /* A single UnsignedInt with the default scene ID */
+    DefaultScene = 10
+};
+
+struct BlobHeader {
+    char magic[4];
+    UnsignedShort version;
+    UnsignedShort byteOrderMark;
+    UnsignedInt chunkCount;
+    UnsignedInt:32;
+    UnsignedLong chunkOffset;
+    /* Size of the whole file */
+    UnsignedLong size;
+};
+
+static_assert(sizeof(BlobHeader) == 32, "improper size of BlobHeader");
+
+struct BlobChunk {
+    BlobChunkType type;
+    UnsignedInt nameSize;
+    UnsignedLong nameOffset;
+    UnsignedLong offset;
+    UnsignedLong size;
+};
+
+static_assert(sizeof(BlobChunk) == 32, "improper size of BlobChunk");
+
+struct BlobMeshHeader {
+    /* MeshPrimitive, possibly implementation-specific */
+    UnsignedInt primitive;
+    /* MeshIndexType, possibly implementation-specific, or 0 if the mesh is
+       not indexed */
+    UnsignedInt indexType;
+    UnsignedInt indexCount;
+    Int indexStride;
+    UnsignedInt vertexCount;
+    UnsignedInt attributeCount;
+    /* Offset of the first index in the index data */
+    UnsignedLong indexOffset;
+    UnsignedLong indexDataOffset;
+    UnsignedLong indexDataSize;
+    UnsignedLong vertexDataOffset;
+    UnsignedLong vertexDataSize;
+};
+
+static_assert(sizeof(BlobMeshHeader) == 64 && sizeof(BlobMeshHeader) % BlobAlignment == 0, "improper size of BlobMeshHeader");
+
+struct BlobMeshAttribute {
+    /* VertexFormat, possibly implementation-specific */
+    UnsignedInt format;
+    /* MeshAttribute */
+    UnsignedShort name;
+    UnsignedShort arraySize;
+    Int stride;
+    Int morphTargetId;
+    /* Offset of the first item in the vertex data */
+    UnsignedLong offset;
+};
+
+static_assert(sizeof(BlobMeshAttribute) == 24, "improper size of BlobMeshAttribute");
+
+struct BlobSceneHeader {
+    /* SceneMappingType */
+    UnsignedInt mappingType;
+    UnsignedInt fieldCount;
+    UnsignedLong mappingBound;
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+};
+
+static_assert(sizeof(BlobSceneHeader) == 32 && sizeof(BlobSceneHeader) % BlobAlignment == 0, "improper size of BlobSceneHeader");
+
+struct BlobSceneField {
+    /* SceneField */
+    UnsignedInt name;
+    /* SceneFieldType */
+    UnsignedShort type;
+    UnsignedShort arraySize;
+    /* SceneFieldFlags, without SceneFieldFlag::OffsetOnly */
+    UnsignedShort flags;
+    /* Bit offset for SceneFieldType::Bit fields, 0 otherwise */
+    UnsignedShort bitOffset;
+    UnsignedInt:32;
+    UnsignedLong size;
+    /* All offsets are relative to the scene data */
+    UnsignedLong mappingOffset;
+    Long mappingStride;
+    UnsignedLong fieldOffset;
+    /* In bits for SceneFieldType::Bit fields */
+    Long fieldStride;
+    /* String data offset for string fields, 0 otherwise */
+    UnsignedLong stringOffset;
+};
+
+static_assert(sizeof(BlobSceneField) == 64, "improper size of BlobSceneField");
+
+struct BlobMaterialHeader {
+    /* MaterialTypes */
+    UnsignedInt types;
+    /* Or 0 if there's just an implicit base layer */
+    UnsignedInt layerCount;
+    UnsignedLong attributeCount;
+    UnsignedLong attributeOffset;
+    UnsignedLong layerOffset;
+};
+
+static_assert(sizeof(BlobMaterialHeader) == 32, "improper size of BlobMaterialHeader");
+
+struct BlobTexture {
+    /* TextureType */
+    UnsignedInt type;
+    /* SamplerFilter, SamplerFilter, SamplerMipmap and SamplerWrapping */
+    UnsignedInt minificationFilter;
+    UnsignedInt magnificationFilter;
+    UnsignedInt mipmapFilter;
+    UnsignedInt wrapping[3];
+    UnsignedInt image;
+};
+
+static_assert(sizeof(BlobTexture) == 32, "improper size of BlobTexture");
+
+struct BlobImageHeader {
+    /* ImageFlags1D, ImageFlags2D or ImageFlags3D */
+    UnsignedShort flags;
+    /* 1 if compressed, 0 otherwise */
+    UnsignedShort compressed;
+    /* PixelFormat or CompressedPixelFormat, possibly implementation-specific.
+       The formatExtra and pixelSize is used only for implementation-specific
+       uncompressed formats, blockSize and blockDataSize only for
+       implementation-specific compressed formats. */
+    UnsignedInt format;
+    UnsignedInt formatExtra;
+    UnsignedInt pixelSize;
+    Int blockSize[3];
+    UnsignedInt blockDataSize;
+    /* Size in all three dimensions, with the unused dimensions being 1 */
+    Int size[3];
+    /* PixelStorage or CompressedPixelStorage, alignment is used only for
+       uncompressed images */
+    Int alignment;
+    Int rowLength;
+    Int imageHeight;
+    Int skip[3];
+    UnsignedInt:32;
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+};
+
+static_assert(sizeof(BlobImageHeader) == 88, "improper size of BlobImageHeader");
+
+}
+
+}}}
+
+#endif
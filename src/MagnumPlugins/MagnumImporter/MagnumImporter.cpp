@@ -0,0 +1,1037 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumImporter.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/ImageProperties.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/DataArena.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/TextureData.h"
+#include "MagnumPlugins/Implementation/blob.h"
+
+namespace Magnum { namespace Trade {
+
+struct MagnumImporter::State {
+    Containers::Array<char> data;
+    /* If set, the data are externally owned and all imported data are views
+       on them. Otherwise the imported data are copies. */
+    bool externallyOwned;
+    Int defaultScene = -1;
+
+    Containers::ArrayView<const Implementation::BlobChunk> chunks;
+    /* Chunk IDs for each data type */
+    Containers::Array<UnsignedInt> scenes;
+    Containers::Array<UnsignedInt> sceneFieldNames;
+    Containers::Array<UnsignedInt> meshes;
+    Containers::Array<UnsignedInt> meshAttributeNames;
+    Containers::Array<UnsignedInt> materials;
+    Containers::Array<UnsignedInt> textures;
+    Containers::Array<UnsignedInt> images1D;
+    Containers::Array<UnsignedInt> images2D;
+    Containers::Array<UnsignedInt> images3D;
+};
+
+MagnumImporter::MagnumImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+MagnumImporter::~MagnumImporter() = default;
+
+ImporterFeatures MagnumImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+bool MagnumImporter::doIsOpened() const { return !!_state; }
+
+void MagnumImporter::doClose() { _state = nullptr; }
+
+void MagnumImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
+    Containers::Pointer<State> state{InPlaceInit};
+
+    /* Take over the existing array or copy the data if we can't. Externally
+       owned data, such as a memory-mapped file, are referenced by all
+       imported data directly, unless they're not aligned enough for the data
+       structures inside. Arrays allocated by us are always aligned enough. */
+    const bool aligned = reinterpret_cast<std::uintptr_t>(data.data()) % 8 == 0;
+    if(aligned && (dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned))) {
+        state->data = Utility::move(data);
+        state->externallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
+    } else {
+        state->data = Containers::Array<char>{NoInit, data.size()};
+        Utility::copy(data, state->data);
+        state->externallyOwned = false;
+    }
+
+    const Containers::ArrayView<const char> in = state->data;
+    if(in.size() < sizeof(Implementation::BlobHeader)) {
+        Error{} << "Trade::MagnumImporter::openData(): file too short, expected at least" << sizeof(Implementation::BlobHeader) << "bytes but got" << in.size();
+        return;
+    }
+
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(in.data());
+    if(std::memcmp(header.magic, Implementation::BlobMagic, sizeof(header.magic)) != 0) {
+        Error{} << "Trade::MagnumImporter::openData(): invalid file signature" << Containers::StringView{header.magic, sizeof(header.magic)};
+        return;
+    }
+    /* Checked before the version as it'd be byte-swapped as well */
+    if(header.byteOrderMark != Implementation::BlobByteOrderMark) {
+        Error{} << "Trade::MagnumImporter::openData(): file has a different byte order";
+        return;
+    }
+    if(header.version != Implementation::BlobVersion) {
+        Error{} << "Trade::MagnumImporter::openData(): unsupported file version" << header.version << Debug::nospace << ", expected" << Implementation::BlobVersion;
+        return;
+    }
+    if(header.size != in.size()) {
+        Error{} << "Trade::MagnumImporter::openData(): file size mismatch, expected" << header.size << "bytes but got" << in.size();
+        return;
+    }
+    if(header.chunkOffset % 8 || header.chunkOffset > in.size() || header.chunkCount > (in.size() - header.chunkOffset)/sizeof(Implementation::BlobChunk)) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk table of" << header.chunkCount << "items at offset" << header.chunkOffset << "out of bounds for a file of" << in.size() << "bytes";
+        return;
+    }
+
+    state->chunks = {reinterpret_cast<const Implementation::BlobChunk*>(in + header.chunkOffset), header.chunkCount};
+    for(UnsignedInt i = 0; i != state->chunks.size(); ++i) {
+        const Implementation::BlobChunk& chunk = state->chunks[i];
+        if(chunk.offset % Implementation::BlobAlignment || chunk.offset > in.size() || chunk.size > in.size() - chunk.offset || chunk.nameOffset > in.size() || chunk.nameSize > in.size() - chunk.nameOffset) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << i << "out of bounds for a file of" << in.size() << "bytes";
+            return;
+        }
+
+        switch(chunk.type) {
+            case Implementation::BlobChunkType::Scene:
+                arrayAppend(state->scenes, i);
+                break;
+            case Implementation::BlobChunkType::Mesh:
+                arrayAppend(state->meshes, i);
+                break;
+            case Implementation::BlobChunkType::Material:
+                arrayAppend(state->materials, i);
+                break;
+            case Implementation::BlobChunkType::Texture:
+                arrayAppend(state->textures, i);
+                break;
+            case Implementation::BlobChunkType::Image1D:
+                arrayAppend(state->images1D, i);
+                break;
+            case Implementation::BlobChunkType::Image2D:
+                arrayAppend(state->images2D, i);
+                break;
+            case Implementation::BlobChunkType::Image3D:
+                arrayAppend(state->images3D, i);
+                break;
+            case Implementation::BlobChunkType::SceneFieldName:
+            case Implementation::BlobChunkType::MeshAttributeName:
+            case Implementation::BlobChunkType::DefaultScene:
+                if(chunk.size != sizeof(UnsignedInt)) {
+                    Error{} << "Trade::MagnumImporter::openData(): expected chunk" << i << "to have" << sizeof(UnsignedInt) << "bytes but got" << chunk.size;
+                    return;
+                }
+                if(chunk.type == Implementation::BlobChunkType::SceneFieldName)
+                    arrayAppend(state->sceneFieldNames, i);
+                else if(chunk.type == Implementation::BlobChunkType::MeshAttributeName)
+                    arrayAppend(state->meshAttributeNames, i);
+                else
+                    state->defaultScene = *reinterpret_cast<const UnsignedInt*>(in + chunk.offset);
+                break;
+            /* Chunks of unknown type are ignored. Incompatible changes to the
+               format bump the version, so this only allows adding new kinds
+               of data without breaking existing importers. */
+        }
+    }
+
+    if(state->defaultScene >= Int(state->scenes.size())) {
+        Error{} << "Trade::MagnumImporter::openData(): default scene" << state->defaultScene << "out of range for" << state->scenes.size() << "scenes";
+        return;
+    }
+
+    _state = Utility::move(state);
+}
+
+namespace {
+
+Containers::StringView chunkName(const Containers::ArrayView<const char> data, const Implementation::BlobChunk& chunk) {
+    return {data + chunk.nameOffset, std::size_t(chunk.nameSize)};
+}
+
+/* Linear search, the data counts are expected to be small enough and the
+   lookup infrequent enough to not warrant building a hashmap upfront */
+Int chunkForName(const Containers::ArrayView<const char> data, const Containers::ArrayView<const Implementation::BlobChunk> chunks, const Containers::ArrayView<const UnsignedInt> ids, const Containers::StringView name) {
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        if(chunkName(data, chunks[ids[i]]) == name)
+            return i;
+    return -1;
+}
+
+/* Returns the value of a SceneFieldName or MeshAttributeName chunk matching
+   given name, or 0 if there's none */
+UnsignedInt customNameForName(const Containers::ArrayView<const char> data, const Containers::ArrayView<const Implementation::BlobChunk> chunks, const Containers::ArrayView<const UnsignedInt> ids, const Containers::StringView name) {
+    for(const UnsignedInt id: ids)
+        if(chunkName(data, chunks[id]) == name)
+            return *reinterpret_cast<const UnsignedInt*>(data + chunks[id].offset);
+    return 0;
+}
+
+/* Returns name of a SceneFieldName or MeshAttributeName chunk matching given
+   value, or an empty string if there's none */
+Containers::String customName(const Containers::ArrayView<const char> data, const Containers::ArrayView<const Implementation::BlobChunk> chunks, const Containers::ArrayView<const UnsignedInt> ids, const UnsignedInt value) {
+    for(const UnsignedInt id: ids)
+        if(*reinterpret_cast<const UnsignedInt*>(data + chunks[id].offset) == value)
+            return chunkName(data, chunks[id]);
+    return {};
+}
+
+/* Checks that a data region is inside given chunk and is aligned enough */
+bool checkRegion(const char* const prefix, const Implementation::BlobChunk& chunk, const UnsignedLong offset, const UnsignedLong size) {
+    if(offset % 8 || offset > chunk.size || size > chunk.size - offset) {
+        Error{} << prefix << "data region of" << size << "bytes at offset" << offset << "out of bounds for a chunk of" << chunk.size << "bytes";
+        return false;
+    }
+    return true;
+}
+
+/* Checks that a strided view of given item count and item size, starting at
+   given offset, is inside a data region of given size. Compared to the checks
+   in MeshData and SceneData constructors this is done on unsigned values so
+   it can't overflow for arbitrary input. The stride is expected to be already
+   checked to fit into 16 bits. */
+bool checkView(const UnsignedLong dataSize, const UnsignedLong offset, const Long stride, const UnsignedLong count, const UnsignedLong itemSize) {
+    if(!count)
+        return true;
+    if(offset > dataSize || itemSize > dataSize - offset)
+        return false;
+    if(count == 1 || stride == 0)
+        return true;
+    /* For negative strides the view goes backwards from the offset */
+    if(stride < 0)
+        return count - 1 <= offset/UnsignedLong(-stride);
+    return count - 1 <= (dataSize - offset - itemSize)/UnsignedLong(stride);
+}
+
+bool strideFitsInto16Bits(const Long stride) {
+    return stride >= -32768 && stride <= 32767;
+}
+
+/* The field data don't have any alignment requirements in the file, so the
+   string offsets and sizes are read through a memcpy() */
+template<class T> UnsignedLong readStringEntry(const char* const data) {
+    T out;
+    std::memcpy(&out, data, sizeof(T));
+    return out;
+}
+
+/* Checks that strings of a StringOffset*, StringRange* or
+   StringRangeNullTerminated* field are all inside the string data and
+   null-terminated if they're meant to be, mirroring what
+   SceneData::fieldStrings() accesses. The field view is expected to be
+   already checked to be in bounds. */
+template<class T> bool checkStringOffsets(const SceneField name, const char* const field, const Long stride, const UnsignedLong count, const Containers::ArrayView<const char> strings, const bool nullTerminated) {
+    UnsignedLong prev = 0;
+    for(UnsignedLong i = 0; i != count; ++i) {
+        const UnsignedLong offset = readStringEntry<T>(field + Long(i)*stride);
+        if(offset < prev + (nullTerminated ? 1 : 0) || offset > strings.size()) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "spanning offsets" << prev << "to" << offset << "out of bounds for" << strings.size() << "bytes of string data";
+            return false;
+        }
+        if(nullTerminated && strings[offset - 1]) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "is not null-terminated";
+            return false;
+        }
+        prev = offset;
+    }
+    return true;
+}
+
+template<class T> bool checkStringRanges(const SceneField name, const char* const field, const Long stride, const UnsignedLong count, const Containers::ArrayView<const char> strings, const bool nullTerminated) {
+    for(UnsignedLong i = 0; i != count; ++i) {
+        const UnsignedLong offset = readStringEntry<T>(field + Long(i)*stride);
+        const UnsignedLong size = readStringEntry<T>(field + Long(i)*stride + sizeof(T));
+        if(offset > strings.size() || size + (nullTerminated ? 1 : 0) > strings.size() - offset) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "with offset" << offset << "and size" << size << "out of bounds for" << strings.size() << "bytes of string data";
+            return false;
+        }
+        if(nullTerminated && strings[offset + size]) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "is not null-terminated";
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class T> bool checkStringRangesNullTerminated(const SceneField name, const char* const field, const Long stride, const UnsignedLong count, const Containers::ArrayView<const char> strings) {
+    for(UnsignedLong i = 0; i != count; ++i) {
+        const UnsignedLong offset = readStringEntry<T>(field + Long(i)*stride);
+        if(offset >= strings.size()) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "at offset" << offset << "out of bounds for" << strings.size() << "bytes of string data";
+            return false;
+        }
+        if(!std::memchr(strings + offset, '\0', strings.size() - offset)) {
+            Error{} << "Trade::MagnumImporter::scene(): string" << i << "of" << name << "is not null-terminated";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkStrings(const SceneField name, const SceneFieldType type, const bool nullTerminated, const char* const field, const Long stride, const UnsignedLong count, const Containers::ArrayView<const char> strings) {
+    switch(type) {
+        case SceneFieldType::StringOffset8:
+            return checkStringOffsets<UnsignedByte>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringOffset16:
+            return checkStringOffsets<UnsignedShort>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringOffset32:
+            return checkStringOffsets<UnsignedInt>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringOffset64:
+            return checkStringOffsets<UnsignedLong>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringRange8:
+            return checkStringRanges<UnsignedByte>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringRange16:
+            return checkStringRanges<UnsignedShort>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringRange32:
+            return checkStringRanges<UnsignedInt>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringRange64:
+            return checkStringRanges<UnsignedLong>(name, field, stride, count, strings, nullTerminated);
+        case SceneFieldType::StringRangeNullTerminated8:
+            return checkStringRangesNullTerminated<UnsignedByte>(name, field, stride, count, strings);
+        case SceneFieldType::StringRangeNullTerminated16:
+            return checkStringRangesNullTerminated<UnsignedShort>(name, field, stride, count, strings);
+        case SceneFieldType::StringRangeNullTerminated32:
+            return checkStringRangesNullTerminated<UnsignedInt>(name, field, stride, count, strings);
+        case SceneFieldType::StringRangeNullTerminated64:
+            return checkStringRangesNullTerminated<UnsignedLong>(name, field, stride, count, strings);
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+/* If the data aren't externally owned, copies them either to the arena, if
+   set, or to the output array, and updates the view to point to the copy.
+   Returns flags to pair the view with if the data are externally owned or
+   copied to the arena, an empty set if the output array should be used. */
+DataFlags copyIfNotExternallyOwned(const bool externallyOwned, DataArena* const arena, Containers::ArrayView<const char>& data, Containers::Array<char>& out) {
+    if(externallyOwned)
+        return DataFlag::ExternallyOwned;
+
+    if(arena) {
+        data = arena->copy(data);
+        return DataFlag::ExternallyOwned|DataFlag::Mutable;
+    }
+
+    out = Containers::Array<char>{NoInit, data.size()};
+    Utility::copy(data, out);
+    data = out;
+    return {};
+}
+
+}
+
+Int MagnumImporter::doDefaultScene() const {
+    return _state->defaultScene;
+}
+
+UnsignedInt MagnumImporter::doSceneCount() const {
+    return _state->scenes.size();
+}
+
+Int MagnumImporter::doSceneForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->scenes, name);
+}
+
+Containers::String MagnumImporter::doSceneName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->scenes[id]]);
+}
+
+Containers::Optional<SceneData> MagnumImporter::doScene(const UnsignedInt id) {
+    const Implementation::BlobChunk& chunk = _state->chunks[_state->scenes[id]];
+    const char* const in = _state->data + chunk.offset;
+    if(!checkRegion("Trade::MagnumImporter::scene():", chunk, 0, sizeof(Implementation::BlobSceneHeader)))
+        return {};
+
+    const Implementation::BlobSceneHeader& header = *reinterpret_cast<const Implementation::BlobSceneHeader*>(in);
+    if(!checkRegion("Trade::MagnumImporter::scene():", chunk, sizeof(Implementation::BlobSceneHeader), UnsignedLong(header.fieldCount)*sizeof(Implementation::BlobSceneField)) ||
+       !checkRegion("Trade::MagnumImporter::scene():", chunk, header.dataOffset, header.dataSize))
+        return {};
+
+    /* Validate everything the SceneFieldData and SceneData constructors would
+       otherwise assert on, as the file can come from anywhere */
+    /* SceneMappingType is just 8-bit, so print the raw value */
+    if(!header.mappingType || header.mappingType > UnsignedInt(SceneMappingType::UnsignedLong)) {
+        Error{} << "Trade::MagnumImporter::scene(): invalid mapping type" << Debug::hex << header.mappingType;
+        return {};
+    }
+    const SceneMappingType mappingType = SceneMappingType(header.mappingType);
+    if(mappingType != SceneMappingType::UnsignedLong && header.mappingBound >= (1ull << 8*sceneMappingTypeSize(mappingType))) {
+        Error{} << "Trade::MagnumImporter::scene():" << mappingType << "is too small for" << header.mappingBound << "objects";
+        return {};
+    }
+
+    const Implementation::BlobSceneField* const fieldData = reinterpret_cast<const Implementation::BlobSceneField*>(in + sizeof(Implementation::BlobSceneHeader));
+    for(std::size_t i = 0; i != header.fieldCount; ++i) {
+        const Implementation::BlobSceneField& field = fieldData[i];
+        const SceneField name = SceneField(field.name);
+        const SceneFieldType type = SceneFieldType(field.type);
+        if(!field.type || field.type > UnsignedShort(SceneFieldType::MutablePointer) || type == SceneFieldType::Pointer || type == SceneFieldType::MutablePointer) {
+            Error{} << "Trade::MagnumImporter::scene(): invalid field" << i << "type" << type;
+            return {};
+        }
+        if(!Implementation::isSceneFieldTypeCompatibleWithField(name, type)) {
+            Error{} << "Trade::MagnumImporter::scene():" << type << "is not a valid type for" << name;
+            return {};
+        }
+        for(std::size_t j = 0; j != i; ++j) if(fieldData[j].name == field.name) {
+            Error{} << "Trade::MagnumImporter::scene(): duplicate field" << name;
+            return {};
+        }
+
+        const bool isString = Implementation::isSceneFieldTypeString(type);
+        const SceneFieldFlags allowedFlags = (SceneFieldFlag::ImplicitMapping|SceneFieldFlag::MultiEntry|(isString ? SceneFieldFlag::NullTerminatedString : SceneFieldFlags{})) & ~Implementation::disallowedSceneFieldFlagsFor(name);
+        if(field.flags & ~UnsignedShort(UnsignedByte(allowedFlags))) {
+            Error{} << "Trade::MagnumImporter::scene(): invalid flags" << Debug::hex << field.flags << "for" << name << "of" << type;
+            return {};
+        }
+        if(field.arraySize && (isString || !Implementation::isSceneFieldArrayAllowed(name))) {
+            Error{} << "Trade::MagnumImporter::scene():" << name << "of" << type << "can't be an array field";
+            return {};
+        }
+        if(type == SceneFieldType::Bit && field.bitOffset >= 8) {
+            Error{} << "Trade::MagnumImporter::scene(): expected bit offset of" << name << "to be smaller than 8 but got" << field.bitOffset;
+            return {};
+        }
+        if(!strideFitsInto16Bits(field.mappingStride) || !strideFitsInto16Bits(field.fieldStride)) {
+            Error{} << "Trade::MagnumImporter::scene(): expected" << name << "mapping and field stride to fit into 16 bits but got" << field.mappingStride << "and" << field.fieldStride;
+            return {};
+        }
+
+        if(!checkView(header.dataSize, field.mappingOffset, field.mappingStride, field.size, sceneMappingTypeSize(mappingType))) {
+            Error{} << "Trade::MagnumImporter::scene(): mapping view of" << name << "with" << field.size << "items and a stride of" << field.mappingStride << "at offset" << field.mappingOffset << "out of bounds for" << header.dataSize << "bytes of data";
+            return {};
+        }
+        /* Bit field offsets, strides and array sizes are in bits */
+        const bool fieldInBounds = type == SceneFieldType::Bit ?
+            field.fieldOffset <= header.dataSize && checkView(header.dataSize*8, field.fieldOffset*8 + field.bitOffset, field.fieldStride, field.size, field.arraySize ? field.arraySize : 1) :
+            checkView(header.dataSize, field.fieldOffset, field.fieldStride, field.size, sceneFieldTypeSize(type)*(field.arraySize ? field.arraySize : 1));
+        if(!fieldInBounds) {
+            Error{} << "Trade::MagnumImporter::scene(): field view of" << name << "with" << field.size << "items and a stride of" << field.fieldStride << "at offset" << field.fieldOffset << "out of bounds for" << header.dataSize << "bytes of data";
+            return {};
+        }
+        if(isString && field.stringOffset > header.dataSize) {
+            Error{} << "Trade::MagnumImporter::scene(): string data of" << name << "at offset" << field.stringOffset << "out of bounds for" << header.dataSize << "bytes of data";
+            return {};
+        }
+        if(isString && !checkStrings(name, type, field.flags & UnsignedShort(SceneFieldFlag::NullTerminatedString), in + header.dataOffset + field.fieldOffset, field.fieldStride, field.size, {in + header.dataOffset + field.stringOffset, std::size_t(header.dataSize - field.stringOffset)}))
+            return {};
+    }
+
+    /* Cross-field invariants the SceneData constructor asserts on. All fields
+       are relative to the same data, so TRS and mesh/material fields sharing
+       the same mapping means they have the same mapping offset, size and
+       stride. */
+    const Implementation::BlobSceneField* trsField = nullptr;
+    const Implementation::BlobSceneField* meshMaterialField = nullptr;
+    UnsignedInt dimensions = 0;
+    bool hasSkin = false;
+    for(std::size_t i = 0; i != header.fieldCount; ++i) {
+        const Implementation::BlobSceneField& field = fieldData[i];
+        const SceneField name = SceneField(field.name);
+        const SceneFieldType type = SceneFieldType(field.type);
+
+        const Implementation::BlobSceneField* shared = nullptr;
+        if(name == SceneField::Translation || name == SceneField::Rotation || name == SceneField::Scaling) {
+            if(!trsField) trsField = &field;
+            shared = trsField;
+        } else if(name == SceneField::Mesh || name == SceneField::MeshMaterial) {
+            if(!meshMaterialField) meshMaterialField = &field;
+            shared = meshMaterialField;
+        }
+        if(shared && (field.size != shared->size || field.mappingOffset != shared->mappingOffset || field.mappingStride != shared->mappingStride)) {
+            Error{} << "Trade::MagnumImporter::scene():" << name << "mapping data of" << field.size << "items with a stride of" << field.mappingStride << "at offset" << field.mappingOffset << "is different from" << SceneField(shared->name) << "mapping data of" << shared->size << "items with a stride of" << shared->mappingStride << "at offset" << shared->mappingOffset;
+            return {};
+        }
+
+        /* The types are already checked to be compatible with the field, so
+           it's enough to pick the 2D ones */
+        if(name == SceneField::Transformation || name == SceneField::Translation || name == SceneField::Rotation || name == SceneField::Scaling) {
+            const UnsignedInt fieldDimensions =
+                type == SceneFieldType::Matrix3x3 ||
+                type == SceneFieldType::Matrix3x3d ||
+                type == SceneFieldType::Matrix3x2 ||
+                type == SceneFieldType::Matrix3x2d ||
+                type == SceneFieldType::DualComplex ||
+                type == SceneFieldType::DualComplexd ||
+                type == SceneFieldType::Vector2 ||
+                type == SceneFieldType::Vector2d ||
+                type == SceneFieldType::Complex ||
+                type == SceneFieldType::Complexd ? 2 : 3;
+            if(dimensions && dimensions != fieldDimensions) {
+                Error{} << "Trade::MagnumImporter::scene(): expected a" << dimensions << Debug::nospace << "D type for" << name << "but got" << type;
+                return {};
+            }
+            dimensions = fieldDimensions;
+        } else if(name == SceneField::Skin)
+            hasSkin = true;
+    }
+    if(hasSkin && !dimensions) {
+        Error{} << "Trade::MagnumImporter::scene(): a skin field requires some transformation field to be present";
+        return {};
+    }
+
+    Containers::ArrayView<const char> data{in + header.dataOffset, std::size_t(header.dataSize)};
+    Containers::Array<char> dataCopy;
+    const DataFlags dataFlags = copyIfNotExternallyOwned(_state->externallyOwned, arena(), data, dataCopy);
+
+    /* The offset-only field constructors make the fields relative to
+       whatever data array they end up being paired with */
+    Containers::Array<SceneFieldData> fields{NoInit, header.fieldCount};
+    for(std::size_t i = 0; i != header.fieldCount; ++i) {
+        const Implementation::BlobSceneField& field = fieldData[i];
+        const SceneField name = SceneField(field.name);
+        const SceneFieldType type = SceneFieldType(field.type);
+        const SceneFieldFlags flags = SceneFieldFlag(field.flags);
+        if(type == SceneFieldType::Bit)
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), std::ptrdiff_t(field.mappingStride), std::size_t(field.fieldOffset), field.bitOffset, std::ptrdiff_t(field.fieldStride), field.arraySize, flags};
+        else if(Implementation::isSceneFieldTypeString(type))
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), std::ptrdiff_t(field.mappingStride), std::size_t(field.stringOffset), type, std::size_t(field.fieldOffset), std::ptrdiff_t(field.fieldStride), flags};
+        else
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), std::ptrdiff_t(field.mappingStride), type, std::size_t(field.fieldOffset), std::ptrdiff_t(field.fieldStride), field.arraySize, flags};
+    }
+
+    if(dataFlags)
+        return SceneData{mappingType, header.mappingBound, dataFlags, data, Utility::move(fields)};
+    return SceneData{mappingType, header.mappingBound, Utility::move(dataCopy), Utility::move(fields)};
+}
+
+SceneField MagnumImporter::doSceneFieldForName(const Containers::StringView name) {
+    return SceneField(customNameForName(_state->data, _state->chunks, _state->sceneFieldNames, name));
+}
+
+Containers::String MagnumImporter::doSceneFieldName(const SceneField name) {
+    return customName(_state->data, _state->chunks, _state->sceneFieldNames, UnsignedInt(name));
+}
+
+UnsignedInt MagnumImporter::doMeshCount() const {
+    return _state->meshes.size();
+}
+
+Int MagnumImporter::doMeshForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->meshes, name);
+}
+
+Containers::String MagnumImporter::doMeshName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->meshes[id]]);
+}
+
+Containers::Optional<MeshData> MagnumImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    const Implementation::BlobChunk& chunk = _state->chunks[_state->meshes[id]];
+    const char* const in = _state->data + chunk.offset;
+    if(!checkRegion("Trade::MagnumImporter::mesh():", chunk, 0, sizeof(Implementation::BlobMeshHeader)))
+        return {};
+
+    const Implementation::BlobMeshHeader& header = *reinterpret_cast<const Implementation::BlobMeshHeader*>(in);
+    if(!checkRegion("Trade::MagnumImporter::mesh():", chunk, sizeof(Implementation::BlobMeshHeader), UnsignedLong(header.attributeCount)*sizeof(Implementation::BlobMeshAttribute)) ||
+       !checkRegion("Trade::MagnumImporter::mesh():", chunk, header.indexDataOffset, header.indexDataSize) ||
+       !checkRegion("Trade::MagnumImporter::mesh():", chunk, header.vertexDataOffset, header.vertexDataSize))
+        return {};
+
+    /* Validate everything the MeshIndexData, MeshAttributeData and MeshData
+       constructors would otherwise assert on, as the file can come from
+       anywhere */
+    const MeshPrimitive primitive = MeshPrimitive(header.primitive);
+    if(!isMeshPrimitiveImplementationSpecific(primitive) && (!header.primitive || header.primitive > UnsignedInt(MeshPrimitive::Meshlets))) {
+        Error{} << "Trade::MagnumImporter::mesh(): invalid primitive" << primitive;
+        return {};
+    }
+
+    if(header.indexType) {
+        const MeshIndexType indexType = MeshIndexType(header.indexType);
+        const bool isImplementationSpecific = isMeshIndexTypeImplementationSpecific(indexType);
+        if(!isImplementationSpecific && header.indexType > UnsignedInt(MeshIndexType::UnsignedInt)) {
+            Error{} << "Trade::MagnumImporter::mesh(): invalid index type" << indexType;
+            return {};
+        }
+        if(!strideFitsInto16Bits(header.indexStride)) {
+            Error{} << "Trade::MagnumImporter::mesh(): expected index stride to fit into 16 bits but got" << header.indexStride;
+            return {};
+        }
+        /* Size of implementation-specific types isn't known, check at least
+           the offsets, same as MeshData does */
+        if(!checkView(header.indexDataSize, header.indexOffset, header.indexStride, header.indexCount, isImplementationSpecific ? 0 : meshIndexTypeSize(indexType))) {
+            Error{} << "Trade::MagnumImporter::mesh(): index view of" << header.indexCount << "items with a stride of" << header.indexStride << "at offset" << header.indexOffset << "out of bounds for" << header.indexDataSize << "bytes of index data";
+            return {};
+        }
+    }
+    if((!header.indexType || !header.indexCount) && header.indexDataSize) {
+        Error{} << "Trade::MagnumImporter::mesh(): expected no index data for a mesh with no indices but got" << header.indexDataSize << "bytes";
+        return {};
+    }
+
+    if(!header.attributeCount && header.vertexCount == MeshData::ImplicitVertexCount) {
+        Error{} << "Trade::MagnumImporter::mesh(): vertex count can't be implicit if there are no attributes";
+        return {};
+    }
+
+    const Implementation::BlobMeshAttribute* const attributeData = reinterpret_cast<const Implementation::BlobMeshAttribute*>(in + sizeof(Implementation::BlobMeshHeader));
+    UnsignedInt jointIdAttributeCount = 0;
+    UnsignedInt weightAttributeCount = 0;
+    for(std::size_t i = 0; i != header.attributeCount; ++i) {
+        const Implementation::BlobMeshAttribute& attribute = attributeData[i];
+        const MeshAttribute name = MeshAttribute(attribute.name);
+        const VertexFormat format = VertexFormat(attribute.format);
+        if(!attribute.name || (!isMeshAttributeCustom(name) && attribute.name > UnsignedShort(MeshAttribute::ObjectId))) {
+            Error{} << "Trade::MagnumImporter::mesh(): invalid attribute" << i << "name" << name;
+            return {};
+        }
+        const bool isImplementationSpecific = isVertexFormatImplementationSpecific(format);
+        if(!isImplementationSpecific && (!attribute.format || attribute.format > UnsignedInt(VertexFormat::Matrix4x3sNormalizedAligned))) {
+            Error{} << "Trade::MagnumImporter::mesh(): invalid attribute" << i << "format" << format;
+            return {};
+        }
+        if(!Implementation::isVertexFormatCompatibleWithAttribute(name, format)) {
+            Error{} << "Trade::MagnumImporter::mesh():" << format << "is not a valid format for" << name;
+            return {};
+        }
+        if(attribute.arraySize && !Implementation::isAttributeArrayAllowed(name)) {
+            Error{} << "Trade::MagnumImporter::mesh():" << name << "can't be an array attribute";
+            return {};
+        }
+        if(!attribute.arraySize && Implementation::isAttributeArrayExpected(name)) {
+            Error{} << "Trade::MagnumImporter::mesh():" << name << "has to be an array attribute";
+            return {};
+        }
+        if(attribute.morphTargetId != -1 && (UnsignedInt(attribute.morphTargetId) >= 128 || !Implementation::isMorphTargetAllowed(name))) {
+            Error{} << "Trade::MagnumImporter::mesh(): invalid morph target ID" << attribute.morphTargetId << "for" << name;
+            return {};
+        }
+        if(!strideFitsInto16Bits(attribute.stride)) {
+            Error{} << "Trade::MagnumImporter::mesh(): expected attribute" << i << "stride to fit into 16 bits but got" << attribute.stride;
+            return {};
+        }
+        /* Same as with indices, size of implementation-specific formats isn't
+           known */
+        if(!checkView(header.vertexDataSize, attribute.offset, attribute.stride, header.vertexCount, isImplementationSpecific ? 0 : vertexFormatSize(format)*(attribute.arraySize ? attribute.arraySize : 1))) {
+            Error{} << "Trade::MagnumImporter::mesh(): attribute" << i << "view of" << header.vertexCount << "items with a stride of" << attribute.stride << "at offset" << attribute.offset << "out of bounds for" << header.vertexDataSize << "bytes of vertex data";
+            return {};
+        }
+
+        if(name == MeshAttribute::JointIds)
+            ++jointIdAttributeCount;
+        else if(name == MeshAttribute::Weights)
+            ++weightAttributeCount;
+    }
+
+    /* Joint IDs and weights are expected to be paired, in order */
+    if(jointIdAttributeCount != weightAttributeCount) {
+        Error{} << "Trade::MagnumImporter::mesh(): expected" << jointIdAttributeCount << "weight attributes to match joint IDs but got" << weightAttributeCount;
+        return {};
+    }
+    for(std::size_t i = 0, j = 0; i != header.attributeCount; ++i) {
+        if(MeshAttribute(attributeData[i].name) != MeshAttribute::JointIds)
+            continue;
+        while(MeshAttribute(attributeData[j].name) != MeshAttribute::Weights)
+            ++j;
+        if(attributeData[i].arraySize != attributeData[j].arraySize) {
+            Error{} << "Trade::MagnumImporter::mesh(): expected" << attributeData[i].arraySize << "array items for weight attribute to match joint IDs but got" << attributeData[j].arraySize;
+            return {};
+        }
+        ++j;
+    }
+
+    Containers::ArrayView<const char> indexData{in + header.indexDataOffset, std::size_t(header.indexDataSize)};
+    Containers::ArrayView<const char> vertexData{in + header.vertexDataOffset, std::size_t(header.vertexDataSize)};
+    Containers::Array<char> indexDataCopy, vertexDataCopy;
+    const DataFlags indexDataFlags = copyIfNotExternallyOwned(_state->externallyOwned, arena(), indexData, indexDataCopy);
+    const DataFlags vertexDataFlags = copyIfNotExternallyOwned(_state->externallyOwned, arena(), vertexData, vertexDataCopy);
+
+    MeshIndexData indices;
+    if(header.indexType)
+        indices = MeshIndexData{MeshIndexType(header.indexType), Containers::StridedArrayView1D<const void>{indexData, indexData + header.indexOffset, header.indexCount, header.indexStride}};
+
+    Containers::Array<MeshAttributeData> attributes{NoInit, header.attributeCount};
+    for(std::size_t i = 0; i != header.attributeCount; ++i) {
+        const Implementation::BlobMeshAttribute& attribute = attributeData[i];
+        attributes[i] = MeshAttributeData{MeshAttribute(attribute.name), VertexFormat(attribute.format), std::size_t(attribute.offset), header.vertexCount, attribute.stride, attribute.arraySize, attribute.morphTargetId};
+    }
+
+    /* Both are either externally owned, in the arena or copied */
+    if(vertexDataFlags)
+        return MeshData{primitive, indexDataFlags, indexData, indices, vertexDataFlags, vertexData, Utility::move(attributes), header.vertexCount};
+    return MeshData{primitive, Utility::move(indexDataCopy), indices, Utility::move(vertexDataCopy), Utility::move(attributes), header.vertexCount};
+}
+
+MeshAttribute MagnumImporter::doMeshAttributeForName(const Containers::StringView name) {
+    return MeshAttribute(customNameForName(_state->data, _state->chunks, _state->meshAttributeNames, name));
+}
+
+Containers::String MagnumImporter::doMeshAttributeName(const MeshAttribute name) {
+    return customName(_state->data, _state->chunks, _state->meshAttributeNames, UnsignedInt(name));
+}
+
+UnsignedInt MagnumImporter::doMaterialCount() const {
+    return _state->materials.size();
+}
+
+Int MagnumImporter::doMaterialForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->materials, name);
+}
+
+Containers::String MagnumImporter::doMaterialName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->materials[id]]);
+}
+
+Containers::Optional<MaterialData> MagnumImporter::doMaterial(const UnsignedInt id) {
+    const Implementation::BlobChunk& chunk = _state->chunks[_state->materials[id]];
+    const char* const in = _state->data + chunk.offset;
+    if(!checkRegion("Trade::MagnumImporter::material():", chunk, 0, sizeof(Implementation::BlobMaterialHeader)))
+        return {};
+
+    const Implementation::BlobMaterialHeader& header = *reinterpret_cast<const Implementation::BlobMaterialHeader*>(in);
+    /* The attribute count is 64-bit, so check it against the chunk size
+       first instead of multiplying, which could overflow */
+    if(header.attributeOffset > chunk.size || header.attributeCount > (chunk.size - header.attributeOffset)/sizeof(MaterialAttributeData)) {
+        Error{} << "Trade::MagnumImporter::material(): attribute data of" << header.attributeCount << "items at offset" << header.attributeOffset << "out of bounds for a chunk of" << chunk.size << "bytes";
+        return {};
+    }
+    if(!checkRegion("Trade::MagnumImporter::material():", chunk, header.attributeOffset, header.attributeCount*sizeof(MaterialAttributeData)) ||
+       !checkRegion("Trade::MagnumImporter::material():", chunk, header.layerOffset, UnsignedLong(header.layerCount)*sizeof(UnsignedInt)))
+        return {};
+
+    /* The attributes are stored as-is, so before treating them as
+       MaterialAttributeData verify that the raw bytes have the layout the
+       class expects -- a valid type, a non-empty null-terminated name and a
+       value that fits after it. See the MaterialAttributeData::Storage
+       comment for details. */
+    const char* const rawAttributeData = in + header.attributeOffset;
+    for(std::size_t i = 0; i != header.attributeCount; ++i) {
+        const char* const attribute = rawAttributeData + i*sizeof(MaterialAttributeData);
+        const MaterialAttributeType type = MaterialAttributeType(UnsignedByte(attribute[0]));
+        if(!UnsignedByte(type) || UnsignedByte(type) > UnsignedByte(MaterialAttributeType::TextureSwizzle) || type == MaterialAttributeType::Pointer || type == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MagnumImporter::material(): invalid attribute" << i << "type" << type;
+            return {};
+        }
+
+        const void* const nameEnd = std::memchr(attribute + 1, '\0', sizeof(MaterialAttributeData) - 1);
+        const std::size_t nameSize = nameEnd ? static_cast<const char*>(nameEnd) - attribute - 1 : 0;
+        if(!nameSize) {
+            Error{} << "Trade::MagnumImporter::material(): attribute" << i << "has an empty or unterminated name";
+            return {};
+        }
+
+        /* The extra bytes are for the type, a null byte after the name, and
+           for strings and buffers a value size and a null terminator */
+        std::size_t size;
+        if(type == MaterialAttributeType::String)
+            size = UnsignedByte(attribute[sizeof(MaterialAttributeData) - 1]) + 4;
+        else if(type == MaterialAttributeType::Buffer)
+            size = nameSize + 3 > sizeof(MaterialAttributeData) ? sizeof(MaterialAttributeData) : UnsignedByte(attribute[nameSize + 2]) + 3;
+        else
+            size = materialAttributeTypeSize(type) + 2;
+        if(nameSize + size > sizeof(MaterialAttributeData)) {
+            Error{} << "Trade::MagnumImporter::material(): value of attribute" << Containers::StringView{attribute + 1, nameSize} << "out of bounds";
+            return {};
+        }
+    }
+
+    /* Each layer has to be sorted and without duplicates for the non-owning
+       MaterialData constructor, and the layer offsets have to cover all
+       attributes. The names are all null-terminated at this point. */
+    const auto attributeName = [&](const UnsignedLong i) {
+        return Containers::StringView{rawAttributeData + i*sizeof(MaterialAttributeData) + 1};
+    };
+    const UnsignedInt* const rawLayerData = reinterpret_cast<const UnsignedInt*>(in + header.layerOffset);
+    UnsignedLong begin = 0;
+    for(UnsignedInt i = 0; i != header.layerCount; ++i) {
+        const UnsignedLong end = rawLayerData[i];
+        if(end < begin || end > header.attributeCount) {
+            Error{} << "Trade::MagnumImporter::material(): invalid range (" << Debug::nospace << begin << Debug::nospace << "," << end << Debug::nospace << ") for layer" << i << "with" << header.attributeCount << "attributes in total";
+            return {};
+        }
+        begin = end;
+    }
+    if(header.layerCount && begin != header.attributeCount) {
+        Error{} << "Trade::MagnumImporter::material(): last layer offset" << begin << "too short for" << header.attributeCount << "attributes in total";
+        return {};
+    }
+    for(UnsignedInt i = 0; i != (header.layerCount ? header.layerCount : 1); ++i) {
+        const UnsignedLong layerBegin = i ? rawLayerData[i - 1] : 0;
+        const UnsignedLong layerEnd = header.layerCount ? rawLayerData[i] : header.attributeCount;
+        for(UnsignedLong j = layerBegin + 1; j < layerEnd; ++j) if(!(attributeName(j - 1) < attributeName(j))) {
+            Error{} << "Trade::MagnumImporter::material(): attribute" << attributeName(j) << "in layer" << i << "is duplicate or not sorted";
+            return {};
+        }
+    }
+
+    const Containers::ArrayView<const MaterialAttributeData> attributeData{reinterpret_cast<const MaterialAttributeData*>(rawAttributeData), std::size_t(header.attributeCount)};
+    const Containers::ArrayView<const UnsignedInt> layerData{rawLayerData, header.layerCount};
+
+    if(_state->externallyOwned)
+        return MaterialData{MaterialType(header.types), DataFlag::ExternallyOwned, attributeData, DataFlag::ExternallyOwned, layerData};
+
+    if(arena()) {
+        const Containers::ArrayView<MaterialAttributeData> attributes = Containers::arrayCast<MaterialAttributeData>(arena()->copy(attributeData));
+        const Containers::ArrayView<UnsignedInt> layers = Containers::arrayCast<UnsignedInt>(arena()->copy(layerData));
+        return MaterialData{MaterialType(header.types), DataFlag::ExternallyOwned|DataFlag::Mutable, attributes, DataFlag::ExternallyOwned|DataFlag::Mutable, layers};
+    }
+
+    Containers::Array<MaterialAttributeData> attributes{NoInit, attributeData.size()};
+    if(!attributeData.isEmpty())
+        std::memcpy(attributes.data(), attributeData.data(), attributeData.size()*sizeof(MaterialAttributeData));
+    Containers::Array<UnsignedInt> layers;
+    if(!layerData.isEmpty()) {
+        layers = Containers::Array<UnsignedInt>{NoInit, layerData.size()};
+        Utility::copy(layerData, layers);
+    }
+    return MaterialData{MaterialType(header.types), Utility::move(attributes), Utility::move(layers)};
+}
+
+UnsignedInt MagnumImporter::doTextureCount() const {
+    return _state->textures.size();
+}
+
+Int MagnumImporter::doTextureForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->textures, name);
+}
+
+Containers::String MagnumImporter::doTextureName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->textures[id]]);
+}
+
+Containers::Optional<TextureData> MagnumImporter::doTexture(const UnsignedInt id) {
+    const Implementation::BlobChunk& chunk = _state->chunks[_state->textures[id]];
+    if(!checkRegion("Trade::MagnumImporter::texture():", chunk, 0, sizeof(Implementation::BlobTexture)))
+        return {};
+
+    /* Validate the enums and the image reference, as the file can come from
+       anywhere */
+    const Implementation::BlobTexture& texture = *reinterpret_cast<const Implementation::BlobTexture*>(_state->data + chunk.offset);
+    if(texture.type > UnsignedInt(TextureType::CubeMapArray)) {
+        Error{} << "Trade::MagnumImporter::texture(): invalid type" << Debug::hex << texture.type;
+        return {};
+    }
+    if(texture.minificationFilter > UnsignedInt(SamplerFilter::Linear) ||
+       texture.magnificationFilter > UnsignedInt(SamplerFilter::Linear) ||
+       texture.mipmapFilter > UnsignedInt(SamplerMipmap::Linear)) {
+        Error{} << "Trade::MagnumImporter::texture(): invalid filter" << SamplerFilter(texture.minificationFilter) << Debug::nospace << "," << SamplerFilter(texture.magnificationFilter) << Debug::nospace << "," << SamplerMipmap(texture.mipmapFilter);
+        return {};
+    }
+    for(std::size_t i = 0; i != 3; ++i) if(texture.wrapping[i] > UnsignedInt(SamplerWrapping::MirrorClampToEdge)) {
+        Error{} << "Trade::MagnumImporter::texture(): invalid wrapping" << SamplerWrapping(texture.wrapping[i]) << "in dimension" << i;
+        return {};
+    }
+
+    const TextureType type = TextureType(texture.type);
+    const std::size_t imageCount =
+        type == TextureType::Texture1D ? _state->images1D.size() :
+        type == TextureType::Texture1DArray || type == TextureType::Texture2D ? _state->images2D.size() :
+        _state->images3D.size();
+    if(texture.image >= imageCount) {
+        Error{} << "Trade::MagnumImporter::texture(): image" << texture.image << "out of range for" << imageCount << "images of" << type;
+        return {};
+    }
+
+    return TextureData{TextureType(texture.type),
+        SamplerFilter(texture.minificationFilter),
+        SamplerFilter(texture.magnificationFilter),
+        SamplerMipmap(texture.mipmapFilter),
+        {SamplerWrapping(texture.wrapping[0]),
+         SamplerWrapping(texture.wrapping[1]),
+         SamplerWrapping(texture.wrapping[2])},
+        texture.image};
+}
+
+namespace {
+
+template<UnsignedInt dimensions> Containers::Optional<ImageData<dimensions>> importImage(const char* const prefix, const Containers::ArrayView<const char> file, const Implementation::BlobChunk& chunk, const bool externallyOwned, DataArena* const arena) {
+    const char* const in = file + chunk.offset;
+    if(!checkRegion(prefix, chunk, 0, sizeof(Implementation::BlobImageHeader)))
+        return {};
+
+    const Implementation::BlobImageHeader& header = *reinterpret_cast<const Implementation::BlobImageHeader*>(in);
+    if(!checkRegion(prefix, chunk, header.dataOffset, header.dataSize))
+        return {};
+
+    /* Validate everything the ImageData constructors would otherwise assert
+       on, as the file can come from anywhere */
+    const Vector3i size3 = Vector3i::from(header.size);
+    const Vector3i skip = Vector3i::from(header.skip);
+    if((size3 < Vector3i{}).any() || (skip < Vector3i{}).any() || header.rowLength < 0 || header.imageHeight < 0) {
+        Error{} << prefix << "invalid size" << Debug::packed << size3 << "or pixel storage parameters";
+        return {};
+    }
+    const UnsignedShort allowedFlags =
+        dimensions == 3 ? UnsignedShort(ImageFlag3D::Array|ImageFlag3D::CubeMap) :
+        dimensions == 2 ? UnsignedShort(ImageFlag2D::Array) : 0;
+    if(header.flags & ~allowedFlags) {
+        Error{} << prefix << "invalid flags" << Debug::hex << header.flags;
+        return {};
+    }
+    if((header.flags & UnsignedShort(ImageFlag3D::CubeMap)) && (size3.x() != size3.y() || (!(header.flags & UnsignedShort(ImageFlag3D::Array)) && size3.z() != 6))) {
+        Error{} << prefix << "invalid cube map size" << Debug::packed << size3;
+        return {};
+    }
+
+    const VectorTypeFor<dimensions, Int> size = Math::Vector<dimensions, Int>::pad(size3);
+    const ImageFlags<dimensions> flags = ImageFlag<dimensions>(header.flags);
+
+    /* The expected data size is calculated from a view that has no data
+       attached, as such a view doesn't check the size */
+    std::size_t expectedDataSize;
+    PixelStorage storage;
+    CompressedPixelStorage compressedStorage;
+    if(header.compressed) {
+        compressedStorage.setRowLength(header.rowLength)
+            .setImageHeight(header.imageHeight)
+            .setSkip(skip);
+
+        const CompressedPixelFormat format = CompressedPixelFormat(header.format);
+        if(isCompressedPixelFormatImplementationSpecific(format)) {
+            const Vector3i blockSize = Vector3i::from(header.blockSize);
+            if((blockSize <= Vector3i{}).any() || (blockSize >= Vector3i{256}).any() || !header.blockDataSize || header.blockDataSize >= 256) {
+                Error{} << prefix << "invalid block size" << Debug::packed << blockSize << "and block data size" << header.blockDataSize << "for" << format;
+                return {};
+            }
+            expectedDataSize = Magnum::Implementation::compressedImageDataSize(CompressedImageView<dimensions, const char>{compressedStorage, format, blockSize, header.blockDataSize, size, flags});
+        } else if(!header.format || header.format > UnsignedInt(CompressedPixelFormat::PvrtcRGBA4bppSrgb)) {
+            Error{} << prefix << "invalid format" << format;
+            return {};
+        } else expectedDataSize = Magnum::Implementation::compressedImageDataSize(CompressedImageView<dimensions, const char>{compressedStorage, format, size, flags});
+    } else {
+        if(header.alignment != 1 && header.alignment != 2 && header.alignment != 4 && header.alignment != 8) {
+            Error{} << prefix << "invalid alignment" << header.alignment;
+            return {};
+        }
+        storage.setAlignment(header.alignment)
+            .setRowLength(header.rowLength)
+            .setImageHeight(header.imageHeight)
+            .setSkip(skip);
+
+        const PixelFormat format = PixelFormat(header.format);
+        if(isPixelFormatImplementationSpecific(format)) {
+            if(!header.pixelSize || header.pixelSize >= 256) {
+                Error{} << prefix << "invalid pixel size" << header.pixelSize << "for" << format;
+                return {};
+            }
+            expectedDataSize = Magnum::Implementation::imageDataSize(ImageView<dimensions, const char>{storage, format, header.formatExtra, header.pixelSize, size, flags});
+        } else if(!header.format || header.format > UnsignedInt(PixelFormat::Depth32FStencil8UI)) {
+            Error{} << prefix << "invalid format" << format;
+            return {};
+        } else expectedDataSize = Magnum::Implementation::imageDataSize(ImageView<dimensions, const char>{storage, format, size, flags});
+    }
+    if(header.dataSize < expectedDataSize) {
+        Error{} << prefix << "expected at least" << expectedDataSize << "bytes of image data but got" << header.dataSize;
+        return {};
+    }
+
+    Containers::ArrayView<const char> data{in + header.dataOffset, std::size_t(header.dataSize)};
+    Containers::Array<char> dataCopy;
+    const DataFlags dataFlags = copyIfNotExternallyOwned(externallyOwned, arena, data, dataCopy);
+
+    if(header.compressed) {
+        const CompressedPixelFormat format = CompressedPixelFormat(header.format);
+        if(isCompressedPixelFormatImplementationSpecific(format)) {
+            if(dataFlags)
+                return ImageData<dimensions>{compressedStorage, format, Vector3i::from(header.blockSize), header.blockDataSize, size, dataFlags, data, flags};
+            return ImageData<dimensions>{compressedStorage, format, Vector3i::from(header.blockSize), header.blockDataSize, size, Utility::move(dataCopy), flags};
+        }
+
+        if(dataFlags)
+            return ImageData<dimensions>{compressedStorage, format, size, dataFlags, data, flags};
+        return ImageData<dimensions>{compressedStorage, format, size, Utility::move(dataCopy), flags};
+    }
+
+    const PixelFormat format = PixelFormat(header.format);
+    if(isPixelFormatImplementationSpecific(format)) {
+        if(dataFlags)
+            return ImageData<dimensions>{storage, format, header.formatExtra, header.pixelSize, size, dataFlags, data, flags};
+        return ImageData<dimensions>{storage, format, header.formatExtra, header.pixelSize, size, Utility::move(dataCopy), flags};
+    }
+
+    if(dataFlags)
+        return ImageData<dimensions>{storage, format, size, dataFlags, data, flags};
+    return ImageData<dimensions>{storage, format, size, Utility::move(dataCopy), flags};
+}
+
+}
+
+UnsignedInt MagnumImporter::doImage1DCount() const {
+    return _state->images1D.size();
+}
+
+Int MagnumImporter::doImage1DForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->images1D, name);
+}
+
+Containers::String MagnumImporter::doImage1DName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->images1D[id]]);
+}
+
+Containers::Optional<ImageData1D> MagnumImporter::doImage1D(const UnsignedInt id, UnsignedInt) {
+    return importImage<1>("Trade::MagnumImporter::image1D():", _state->data, _state->chunks[_state->images1D[id]], _state->externallyOwned, arena());
+}
+
+UnsignedInt MagnumImporter::doImage2DCount() const {
+    return _state->images2D.size();
+}
+
+Int MagnumImporter::doImage2DForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->images2D, name);
+}
+
+Containers::String MagnumImporter::doImage2DName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->images2D[id]]);
+}
+
+Containers::Optional<ImageData2D> MagnumImporter::doImage2D(const UnsignedInt id, UnsignedInt) {
+    return importImage<2>("Trade::MagnumImporter::image2D():", _state->data, _state->chunks[_state->images2D[id]], _state->externallyOwned, arena());
+}
+
+UnsignedInt MagnumImporter::doImage3DCount() const {
+    return _state->images3D.size();
+}
+
+Int MagnumImporter::doImage3DForName(const Containers::StringView name) {
+    return chunkForName(_state->data, _state->chunks, _state->images3D, name);
+}
+
+Containers::String MagnumImporter::doImage3DName(const UnsignedInt id) {
+    return chunkName(_state->data, _state->chunks[_state->images3D[id]]);
+}
+
+Containers::Optional<ImageData3D> MagnumImporter::doImage3D(const UnsignedInt id, UnsignedInt) {
+    return importImage<3>("Trade::MagnumImporter::image3D():", _state->data, _state->chunks[_state->images3D[id]], _state->externallyOwned, arena());
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumImporter, Magnum::Trade::MagnumImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
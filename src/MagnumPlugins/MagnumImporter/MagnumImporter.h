@@ -0,0 +1,203 @@
+#ifndef Magnum_Trade_MagnumImporter_h
+#define Magnum_Trade_MagnumImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumImporter
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MagnumImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MAGNUMIMPORTER_BUILD_STATIC
+    #ifdef MagnumImporter_EXPORTS
+        #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MAGNUMIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MAGNUMIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MAGNUMIMPORTER_EXPORT
+#define MAGNUM_MAGNUMIMPORTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum binary importer plugin
+@m_since_latest
+
+Imports meshes, scenes, materials, textures and images from binary `*.blob`
+files produced by @ref MagnumSceneConverter.
+
+@section Trade-MagnumImporter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractImporter interface. See its documentation for
+    introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_MAGNUMIMPORTER` is enabled when building Magnum. To use as a
+dynamic plugin, load @cpp "MagnumImporter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MAGNUMIMPORTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MagnumImporter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MagnumImporter` component of the `Magnum` package and
+link to the `Magnum::MagnumImporter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MagnumImporter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MagnumImporter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MagnumImporter-behavior Behavior and limitations
+
+Opening a file only checks the file header and the chunk table, which is
+independent of the amount of data in the file. As the data are stored in the
+same layout as @ref MeshData, @ref SceneData, @ref MaterialData and
+@ref ImageData use internally, accessing the data involves no parsing or
+conversion, only a check that the data regions are inside of the file.
+
+@subsection Trade-MagnumImporter-behavior-zero-copy Zero-copy import
+
+If the file is opened using @ref openMemory(), which is for example the case
+with a memory-mapped file, all returned data are views on the passed memory,
+with @ref DataFlag::ExternallyOwned set. The memory thus has to stay in scope
+for as long as the returned data are used. Otherwise the data are copied from
+the file on each access. The memory passed to @ref openMemory() is expected to
+be aligned to at least 8 bytes, otherwise it's copied as well.
+
+@snippet Trade.cpp MagnumImporter-zero-copy
+
+If the data are copied and an arena is set via @ref setArena(), scene data,
+mesh index and vertex data, material attribute and layer data and image data
+are copied into the arena instead of being allocated separately, with
+@ref DataFlag::ExternallyOwned and @ref DataFlag::Mutable set. Mesh attribute
+arrays are allocated as usual.
+
+@subsection Trade-MagnumImporter-behavior-validation File validation
+
+The file header, file version, byte order and bounds of all chunks and data
+regions are checked and the import fails with an error message if they're
+invalid. Before constructing the imported data, enum values, mesh index and
+attribute views, scene field views including offsets and sizes of all
+strings in string fields, material attribute layout and image data sizes are
+validated as well, so a corrupted or malicious file fails the import
+with an error message instead of triggering an assertion or an out-of-bounds
+access. The actual values such as index or object IDs aren't checked, same as
+with @ref MeshData and @ref SceneData created in any other way. Consistency
+between multiple scene fields, such as translation, rotation and scaling
+sharing the same object mapping, is left to @ref SceneData assertions.
+
+Looking up data by name is a linear search over all data of given type.
+*/
+class MAGNUM_MAGNUMIMPORTER_EXPORT MagnumImporter: public AbstractImporter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit MagnumImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MagnumImporter();
+
+    private:
+        struct State;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doDefaultScene() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doSceneCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doSceneForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doSceneName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<SceneData> doScene(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL SceneField doSceneFieldForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doSceneFieldName(SceneField name) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doMeshCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL MeshAttribute doMeshAttributeForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doMeshAttributeName(MeshAttribute name) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doMaterialForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doMaterialName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<MaterialData> doMaterial(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doTextureCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doTextureForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doTextureName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<TextureData> doTexture(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doImage1DForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doImage1DName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData1D> doImage1D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doImage2DForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doImage2DName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
+
+        MAGNUM_MAGNUMIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Int doImage3DForName(Containers::StringView name) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::String doImage3DName(UnsignedInt id) override;
+        MAGNUM_MAGNUMIMPORTER_LOCAL Containers::Optional<ImageData3D> doImage3D(UnsignedInt id, UnsignedInt level) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
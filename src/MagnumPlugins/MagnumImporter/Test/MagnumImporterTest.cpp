@@ -0,0 +1,1189 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/DataArena.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/TextureData.h"
+#include "MagnumPlugins/Implementation/blob.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MagnumImporterTest: TestSuite::Tester {
+    explicit MagnumImporterTest();
+
+    void invalid();
+    void empty();
+    void chunkRegionOutOfBounds();
+
+    void mesh();
+    void meshInvalid();
+    void scene();
+    void sceneInvalid();
+    void sceneInvalidStrings();
+    void material();
+    void materialInvalid();
+    void texture();
+    void textureCubeMapArray();
+    void textureInvalid();
+    void image2D();
+    void image2DInvalid();
+    void compressedImage3D();
+    void customNamesDefaultScene();
+    void arena();
+
+    void openMemoryUnaligned();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+    PluginManager::Manager<AbstractSceneConverter> _converterManager{"nonexistent"};
+};
+
+using namespace Containers::Literals;
+
+/* A minimal valid file with a single custom scene field name chunk, modified
+   by the InvalidData cases below */
+struct File {
+    Implementation::BlobHeader header;
+    UnsignedInt value;
+    char padding[12];
+    Implementation::BlobChunk chunk;
+};
+
+File validFile() {
+    File file{};
+    std::memcpy(file.header.magic, Implementation::BlobMagic, 4);
+    file.header.version = Implementation::BlobVersion;
+    file.header.byteOrderMark = Implementation::BlobByteOrderMark;
+    file.header.chunkCount = 1;
+    file.header.chunkOffset = offsetof(File, chunk);
+    file.header.size = sizeof(File);
+    file.value = UnsignedInt(sceneFieldCustom(1));
+    file.chunk.type = Implementation::BlobChunkType::SceneFieldName;
+    file.chunk.offset = offsetof(File, value);
+    file.chunk.size = 4;
+    return file;
+}
+
+const struct {
+    const char* name;
+    std::size_t size;
+    void(*modify)(File&);
+    const char* message;
+} InvalidData[]{
+    {"too short", 31, [](File&) {},
+        "file too short, expected at least 32 bytes but got 31"},
+    {"invalid signature", 0, [](File& file) {
+            file.header.magic[3] = 'C';
+        }, "invalid file signature BLOC"},
+    {"different byte order", 0, [](File& file) {
+            file.header.byteOrderMark = 0x0201;
+        }, "file has a different byte order"},
+    {"unsupported version", 0, [](File& file) {
+            file.header.version = 2;
+        }, "unsupported file version 2, expected 1"},
+    {"size mismatch", 0, [](File& file) {
+            file.header.size = 81;
+        }, "file size mismatch, expected 81 bytes but got 80"},
+    {"chunk table out of bounds", 0, [](File& file) {
+            file.header.chunkCount = 2;
+        }, "chunk table of 2 items at offset 48 out of bounds for a file of 80 bytes"},
+    {"chunk out of bounds", 0, [](File& file) {
+            file.chunk.size = 49;
+        }, "chunk 0 out of bounds for a file of 80 bytes"},
+    {"chunk not aligned", 0, [](File& file) {
+            file.chunk.offset = 40;
+        }, "chunk 0 out of bounds for a file of 80 bytes"},
+    {"chunk name out of bounds", 0, [](File& file) {
+            file.chunk.nameOffset = 78;
+            file.chunk.nameSize = 3;
+        }, "chunk 0 out of bounds for a file of 80 bytes"},
+    {"custom name chunk size", 0, [](File& file) {
+            file.chunk.size = 8;
+        }, "expected chunk 0 to have 4 bytes but got 8"},
+    {"default scene out of range", 0, [](File& file) {
+            file.chunk.type = Implementation::BlobChunkType::DefaultScene;
+            file.value = 3;
+        }, "default scene 3 out of range for 0 scenes"},
+};
+
+/* Returns the first chunk of given type in a file produced by
+   MagnumSceneConverter, for corrupting its payload in the tests below */
+char* chunkData(const Containers::ArrayView<char> blob, const Implementation::BlobChunkType type) {
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(blob.data());
+    const Implementation::BlobChunk* const chunks = reinterpret_cast<const Implementation::BlobChunk*>(blob + header.chunkOffset);
+    for(std::size_t i = 0; i != header.chunkCount; ++i)
+        if(chunks[i].type == type)
+            return blob + chunks[i].offset;
+    return nullptr;
+}
+
+/* Modifying the mesh from the mesh() test, having 6 bytes of index data and
+   60 bytes of vertex data, with a 20-byte stride */
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobMeshHeader&, Implementation::BlobMeshAttribute*);
+    const char* message;
+} InvalidMeshData[]{
+    {"invalid primitive", [](Implementation::BlobMeshHeader& header, Implementation::BlobMeshAttribute*) {
+            header.primitive = 0xdead;
+        }, "invalid primitive MeshPrimitive(0xdead)"},
+    {"invalid index type", [](Implementation::BlobMeshHeader& header, Implementation::BlobMeshAttribute*) {
+            header.indexType = 0xdead;
+        }, "invalid index type MeshIndexType(0xdead)"},
+    {"index view out of bounds", [](Implementation::BlobMeshHeader& header, Implementation::BlobMeshAttribute*) {
+            header.indexCount = 7;
+        }, "index view of 7 items with a stride of 1 at offset 0 out of bounds for 6 bytes of index data"},
+    {"index view out of bounds, negative stride", [](Implementation::BlobMeshHeader& header, Implementation::BlobMeshAttribute*) {
+            header.indexStride = -1;
+        }, "index view of 6 items with a stride of -1 at offset 0 out of bounds for 6 bytes of index data"},
+    {"invalid attribute format", [](Implementation::BlobMeshHeader&, Implementation::BlobMeshAttribute* attributes) {
+            attributes[0].format = 0xdead;
+        }, "invalid attribute 0 format VertexFormat(0xdead)"},
+    {"attribute format not valid for the name", [](Implementation::BlobMeshHeader&, Implementation::BlobMeshAttribute* attributes) {
+            attributes[1].format = UnsignedInt(VertexFormat::Float);
+        }, "VertexFormat::Float is not a valid format for Trade::MeshAttribute::TextureCoordinates"},
+    {"attribute stride too large", [](Implementation::BlobMeshHeader&, Implementation::BlobMeshAttribute* attributes) {
+            attributes[0].stride = 32768;
+        }, "expected attribute 0 stride to fit into 16 bits but got 32768"},
+    {"attribute view out of bounds", [](Implementation::BlobMeshHeader&, Implementation::BlobMeshAttribute* attributes) {
+            attributes[1].offset = 48;
+        }, "attribute 1 view of 3 items with a stride of 20 at offset 48 out of bounds for 60 bytes of vertex data"},
+    {"attribute view out of bounds, vertex count", [](Implementation::BlobMeshHeader& header, Implementation::BlobMeshAttribute*) {
+            header.vertexCount = 4;
+        }, "attribute 0 view of 4 items with a stride of 20 at offset 0 out of bounds for 60 bytes of vertex data"},
+};
+
+/* Modifying the scene from the scene() test, having 24 bytes of data with
+   an 8-byte stride */
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobSceneHeader&, Implementation::BlobSceneField*);
+    const char* message;
+} InvalidSceneData[]{
+    {"invalid mapping type", [](Implementation::BlobSceneHeader& header, Implementation::BlobSceneField*) {
+            header.mappingType = 0xdead;
+        }, "invalid mapping type 0xdead"},
+    {"mapping type too small", [](Implementation::BlobSceneHeader& header, Implementation::BlobSceneField*) {
+            header.mappingBound = 65536;
+        }, "Trade::SceneMappingType::UnsignedShort is too small for 65536 objects"},
+    {"invalid field type", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[1].type = 0xdead;
+        }, "invalid field 1 type Trade::SceneFieldType(0xdead)"},
+    {"field type not valid for the name", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].type = UnsignedShort(SceneFieldType::Float);
+        }, "Trade::SceneFieldType::Float is not a valid type for Trade::SceneField::Parent"},
+    {"duplicate field", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[1] = fields[0];
+        }, "duplicate field Trade::SceneField::Parent"},
+    {"disallowed flags", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].flags = UnsignedShort(SceneFieldFlag::MultiEntry);
+        }, "invalid flags 0x10 for Trade::SceneField::Parent of Trade::SceneFieldType::Short"},
+    {"mapping view out of bounds", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].mappingOffset = 8;
+        }, "mapping view of Trade::SceneField::Parent with 3 items and a stride of 8 at offset 8 out of bounds for 24 bytes of data"},
+    {"field view out of bounds", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[1].fieldOffset = 8;
+        }, "field view of Trade::SceneField::Mesh with 3 items and a stride of 8 at offset 8 out of bounds for 24 bytes of data"},
+    {"mesh and material mapping mismatch", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].name = UnsignedInt(SceneField::MeshMaterial);
+            fields[0].mappingOffset = 2;
+        }, "Trade::SceneField::Mesh mapping data of 3 items with a stride of 8 at offset 0 is different from Trade::SceneField::MeshMaterial mapping data of 3 items with a stride of 8 at offset 2"},
+    {"TRS mapping mismatch", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].name = UnsignedInt(SceneField::Translation);
+            fields[0].type = UnsignedShort(SceneFieldType::Vector2);
+            fields[0].fieldOffset = 0;
+            fields[1].name = UnsignedInt(SceneField::Rotation);
+            fields[1].type = UnsignedShort(SceneFieldType::Complex);
+            fields[1].fieldOffset = 0;
+            fields[1].mappingStride = 0;
+        }, "Trade::SceneField::Rotation mapping data of 3 items with a stride of 0 at offset 0 is different from Trade::SceneField::Translation mapping data of 3 items with a stride of 8 at offset 0"},
+    {"mixed 2D and 3D transformations", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[0].name = UnsignedInt(SceneField::Translation);
+            fields[0].type = UnsignedShort(SceneFieldType::Vector2);
+            fields[0].fieldOffset = 0;
+            fields[1].name = UnsignedInt(SceneField::Rotation);
+            fields[1].type = UnsignedShort(SceneFieldType::Quaternion);
+            fields[1].fieldOffset = 0;
+            fields[1].fieldStride = 0;
+        }, "expected a 2D type for Trade::SceneField::Rotation but got Trade::SceneFieldType::Quaternion"},
+    {"skin without a transformation", [](Implementation::BlobSceneHeader&, Implementation::BlobSceneField* fields) {
+            fields[1].name = UnsignedInt(SceneField::Skin);
+        }, "a skin field requires some transformation field to be present"},
+};
+
+/* Modifying the scene from the sceneInvalidStrings() test, having a custom
+   field with two null-terminated StringOffset32 strings, "abc" and "efg",
+   with the offsets at byte 4 of the data and 8 bytes of string data at
+   byte 12 */
+void setStringEntry(char* const data, const std::size_t i, const UnsignedInt value) {
+    std::memcpy(data + 4 + i*4, &value, 4);
+}
+
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobSceneField&, char*);
+    const char* message;
+} InvalidSceneStringData[]{
+    {"offset out of bounds", [](Implementation::BlobSceneField&, char* data) {
+            setStringEntry(data, 1, 9);
+        }, "string 1 of Trade::SceneField::Custom(0) spanning offsets 4 to 9 out of bounds for 8 bytes of string data"},
+    {"offset smaller than previous", [](Implementation::BlobSceneField&, char* data) {
+            setStringEntry(data, 1, 3);
+        }, "string 1 of Trade::SceneField::Custom(0) spanning offsets 4 to 3 out of bounds for 8 bytes of string data"},
+    {"string data truncated", [](Implementation::BlobSceneField& field, char*) {
+            field.stringOffset += 4;
+        }, "string 1 of Trade::SceneField::Custom(0) spanning offsets 4 to 8 out of bounds for 4 bytes of string data"},
+    {"offset not null-terminated", [](Implementation::BlobSceneField&, char* data) {
+            data[12 + 7] = 'h';
+        }, "string 1 of Trade::SceneField::Custom(0) is not null-terminated"},
+    {"range out of bounds", [](Implementation::BlobSceneField& field, char* data) {
+            field.type = UnsignedShort(SceneFieldType::StringRange16);
+            field.flags = 0;
+            /* Offset 7, size 2 */
+            setStringEntry(data, 1, 7|(2 << 16));
+        }, "string 1 of Trade::SceneField::Custom(0) with offset 7 and size 2 out of bounds for 8 bytes of string data"},
+    {"range not null-terminated", [](Implementation::BlobSceneField& field, char*) {
+            /* Offset 4, size 0, so there's 'e' after */
+            field.type = UnsignedShort(SceneFieldType::StringRange16);
+        }, "string 0 of Trade::SceneField::Custom(0) is not null-terminated"},
+    {"null-terminated range out of bounds", [](Implementation::BlobSceneField& field, char*) {
+            field.type = UnsignedShort(SceneFieldType::StringRangeNullTerminated32);
+            field.flags = 0;
+        }, "string 1 of Trade::SceneField::Custom(0) at offset 8 out of bounds for 8 bytes of string data"},
+    {"null-terminated range not null-terminated", [](Implementation::BlobSceneField& field, char* data) {
+            field.type = UnsignedShort(SceneFieldType::StringRangeNullTerminated32);
+            field.flags = 0;
+            data[12 + 7] = 'h';
+        }, "string 0 of Trade::SceneField::Custom(0) is not null-terminated"},
+};
+
+/* Modifying the material from the material() test, having attributes
+   DiffuseColor, Shininess and name in the base layer and $LayerName and
+   LayerFactor in the second layer */
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobMaterialHeader&, MaterialAttributeData*, UnsignedInt*);
+    const char* message;
+} InvalidMaterialData[]{
+    {"invalid attribute type", [](Implementation::BlobMaterialHeader&, MaterialAttributeData* attributes, UnsignedInt*) {
+            reinterpret_cast<char*>(attributes + 1)[0] = 0x7f;
+        }, "invalid attribute 1 type Trade::MaterialAttributeType(0x7f)"},
+    {"pointer attribute type", [](Implementation::BlobMaterialHeader&, MaterialAttributeData* attributes, UnsignedInt*) {
+            reinterpret_cast<char*>(attributes + 1)[0] = char(MaterialAttributeType::Pointer);
+        }, "invalid attribute 1 type Trade::MaterialAttributeType::Pointer"},
+    {"unterminated name", [](Implementation::BlobMaterialHeader&, MaterialAttributeData* attributes, UnsignedInt*) {
+            std::memset(reinterpret_cast<char*>(attributes + 2) + 1, 'a', sizeof(MaterialAttributeData) - 1);
+        }, "attribute 2 has an empty or unterminated name"},
+    {"string value out of bounds", [](Implementation::BlobMaterialHeader&, MaterialAttributeData* attributes, UnsignedInt*) {
+            reinterpret_cast<char*>(attributes + 2)[sizeof(MaterialAttributeData) - 1] = 57;
+        }, "value of attribute name out of bounds"},
+    {"attributes not sorted", [](Implementation::BlobMaterialHeader&, MaterialAttributeData* attributes, UnsignedInt*) {
+            MaterialAttributeData a = attributes[0];
+            attributes[0] = attributes[1];
+            attributes[1] = a;
+        }, "attribute DiffuseColor in layer 0 is duplicate or not sorted"},
+    {"layer range out of bounds", [](Implementation::BlobMaterialHeader&, MaterialAttributeData*, UnsignedInt* layers) {
+            layers[0] = 6;
+        }, "invalid range (0, 6) for layer 0 with 5 attributes in total"},
+    {"last layer too short", [](Implementation::BlobMaterialHeader&, MaterialAttributeData*, UnsignedInt* layers) {
+            layers[1] = 4;
+        }, "last layer offset 4 too short for 5 attributes in total"},
+    {"attribute count overflowing", [](Implementation::BlobMaterialHeader& header, MaterialAttributeData*, UnsignedInt*) {
+            /* Multiplied by the 64-byte attribute size it wraps around to
+               64, which would fit into the chunk */
+            header.attributeCount = 0x0400000000000001ull;
+        }, "attribute data of 288230376151711745 items at offset 32 out of bounds for a chunk of 360 bytes"},
+};
+
+/* Modifying the texture from the texture() test, which references the only
+   3D image in the file */
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobTexture&);
+    const char* message;
+} InvalidTextureData[]{
+    {"invalid type", [](Implementation::BlobTexture& texture) {
+            texture.type = 0xde;
+        }, "invalid type 0xde"},
+    {"invalid filter", [](Implementation::BlobTexture& texture) {
+            texture.magnificationFilter = 0xdead;
+        }, "invalid filter SamplerFilter::Nearest, SamplerFilter(0xdead), SamplerMipmap::Nearest"},
+    {"invalid mipmap filter", [](Implementation::BlobTexture& texture) {
+            texture.mipmapFilter = 0xdead;
+        }, "invalid filter SamplerFilter::Nearest, SamplerFilter::Linear, SamplerMipmap(0xdead)"},
+    {"invalid wrapping", [](Implementation::BlobTexture& texture) {
+            texture.wrapping[2] = 0xdead;
+        }, "invalid wrapping SamplerWrapping(0xdead) in dimension 2"},
+    {"image out of range", [](Implementation::BlobTexture& texture) {
+            texture.image = 1;
+        }, "image 1 out of range for 1 images of Trade::TextureType::Texture3D"},
+    {"image out of range for the type", [](Implementation::BlobTexture& texture) {
+            texture.type = UnsignedInt(TextureType::Texture2D);
+        }, "image 0 out of range for 0 images of Trade::TextureType::Texture2D"},
+};
+
+/* Modifying the image from the image2D() test, which is 2x2 RGB8 with a
+   one-byte alignment, i.e. having 12 bytes */
+const struct {
+    const char* name;
+    void(*modify)(Implementation::BlobImageHeader&);
+    const char* message;
+} InvalidImageData[]{
+    {"invalid format", [](Implementation::BlobImageHeader& header) {
+            header.format = 0xdead;
+        }, "invalid format PixelFormat(0xdead)"},
+    {"invalid alignment", [](Implementation::BlobImageHeader& header) {
+            header.alignment = 3;
+        }, "invalid alignment 3"},
+    {"data too small", [](Implementation::BlobImageHeader& header) {
+            header.size[1] = 3;
+        }, "expected at least 18 bytes of image data but got 12"},
+};
+
+const struct {
+    const char* name;
+    bool memory;
+} OpenData[]{
+    {"data", false},
+    {"memory", true},
+};
+
+MagnumImporterTest::MagnumImporterTest() {
+    addInstancedTests({&MagnumImporterTest::invalid},
+        Containers::arraySize(InvalidData));
+
+    addTests({&MagnumImporterTest::empty,
+              &MagnumImporterTest::chunkRegionOutOfBounds});
+
+    addInstancedTests({&MagnumImporterTest::mesh},
+        Containers::arraySize(OpenData));
+
+    addInstancedTests({&MagnumImporterTest::meshInvalid},
+        Containers::arraySize(InvalidMeshData));
+
+    addInstancedTests({&MagnumImporterTest::scene},
+        Containers::arraySize(OpenData));
+
+    addInstancedTests({&MagnumImporterTest::sceneInvalid},
+        Containers::arraySize(InvalidSceneData));
+
+    addInstancedTests({&MagnumImporterTest::sceneInvalidStrings},
+        Containers::arraySize(InvalidSceneStringData));
+
+    addInstancedTests({&MagnumImporterTest::material},
+        Containers::arraySize(OpenData));
+
+    addInstancedTests({&MagnumImporterTest::materialInvalid},
+        Containers::arraySize(InvalidMaterialData));
+
+    addInstancedTests({&MagnumImporterTest::texture,
+                       &MagnumImporterTest::image2D},
+        Containers::arraySize(OpenData));
+
+    addTests({&MagnumImporterTest::textureCubeMapArray});
+
+    addInstancedTests({&MagnumImporterTest::textureInvalid},
+        Containers::arraySize(InvalidTextureData));
+
+    addInstancedTests({&MagnumImporterTest::image2DInvalid},
+        Containers::arraySize(InvalidImageData));
+
+    addInstancedTests({&MagnumImporterTest::compressedImage3D},
+        Containers::arraySize(OpenData));
+
+    addTests({&MagnumImporterTest::customNamesDefaultScene});
+
+    addInstancedTests({&MagnumImporterTest::arena},
+        Containers::arraySize(OpenData));
+
+    addTests({&MagnumImporterTest::openMemoryUnaligned});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MAGNUMIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    /* Optional plugins that don't have to be here */
+    #ifdef MAGNUMSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(MAGNUMSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MagnumImporterTest::invalid() {
+    auto&& data = InvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Verify the unmodified file is valid, to not have the test cases pass
+       due to some unrelated error */
+    File file = validFile();
+    {
+        Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+        CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+        CORRADE_COMPARE(importer->sceneFieldForName(""), sceneFieldCustom(1));
+    }
+
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(reinterpret_cast<const char*>(&file), data.size ? data.size : sizeof(File))));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::empty() {
+    Implementation::BlobHeader header{};
+    std::memcpy(header.magic, Implementation::BlobMagic, 4);
+    header.version = Implementation::BlobVersion;
+    header.byteOrderMark = Implementation::BlobByteOrderMark;
+    header.chunkOffset = sizeof(Implementation::BlobHeader);
+    header.size = sizeof(Implementation::BlobHeader);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&header, 1)));
+    CORRADE_COMPARE(importer->defaultScene(), -1);
+    CORRADE_COMPARE(importer->sceneCount(), 0);
+    CORRADE_COMPARE(importer->meshCount(), 0);
+    CORRADE_COMPARE(importer->materialCount(), 0);
+    CORRADE_COMPARE(importer->textureCount(), 0);
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 0);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+}
+
+void MagnumImporterTest::chunkRegionOutOfBounds() {
+    /* The chunk is in bounds of the file so opening succeeds, but it's too
+       small to contain a mesh header */
+    File file = validFile();
+    file.chunk.type = Implementation::BlobChunkType::Mesh;
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, "Trade::MagnumImporter::mesh(): data region of 64 bytes at offset 0 out of bounds for a chunk of 4 bytes\n");
+}
+
+void MagnumImporterTest::mesh() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {0.25f, 0.5f}},
+        {{4.0f, 5.0f, 6.0f}, {0.75f, 1.0f}},
+        {{7.0f, 8.0f, 9.0f}, {0.0f, 0.125f}},
+    };
+    const UnsignedByte indices[]{2, 1, 0, 0, 1, 2};
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Lines,
+        {}, indices, MeshIndexData{indices},
+        {}, vertices, {
+            MeshAttributeData{MeshAttribute::Position, view.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }}, "a mesh"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+    CORRADE_COMPARE(importer->meshName(0), "a mesh");
+    CORRADE_COMPARE(importer->meshForName("a mesh"), 0);
+    CORRADE_COMPARE(importer->meshForName("nonexistent"), -1);
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    if(data.memory) {
+        CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_VERIFY(mesh->vertexData().data() >= blob->data() && mesh->vertexData().data() < blob->end());
+    } else {
+        CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    }
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedByte>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->vertexCount(), 3);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attributeStride(MeshAttribute::Position), sizeof(Vertex));
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        view.slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        view.slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::meshInvalid() {
+    auto&& data = InvalidMeshData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertices[3]{};
+    const UnsignedByte indices[]{2, 1, 0, 0, 1, 2};
+    Containers::StridedArrayView1D<const Vertex> view = vertices;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Lines,
+        {}, indices, MeshIndexData{indices},
+        {}, vertices, {
+            MeshAttributeData{MeshAttribute::Position, view.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, view.slice(&Vertex::textureCoordinates)}
+        }}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Mesh);
+    CORRADE_VERIFY(chunk);
+    data.modify(*reinterpret_cast<Implementation::BlobMeshHeader*>(chunk), reinterpret_cast<Implementation::BlobMeshAttribute*>(chunk + sizeof(Implementation::BlobMeshHeader)));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::mesh(): {}\n", data.message));
+}
+
+void MagnumImporterTest::scene() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    struct Field {
+        UnsignedShort object;
+        Short parent;
+        UnsignedInt mesh;
+    } fields[]{
+        {3, -1, 7},
+        {0, 3, 2},
+        {1, 0, 5},
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(SceneData{SceneMappingType::UnsignedShort, 4, {}, fields, {
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent)},
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh), SceneFieldFlag::MultiEntry}
+    }}, "a scene"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+    CORRADE_COMPARE(importer->sceneName(0), "a scene");
+    CORRADE_COMPARE(importer->sceneForName("a scene"), 0);
+
+    Containers::Optional<SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->dataFlags(), data.memory ? DataFlags{DataFlag::ExternallyOwned} : DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(scene->mappingType(), SceneMappingType::UnsignedShort);
+    CORRADE_COMPARE(scene->mappingBound(), 4);
+    CORRADE_COMPARE(scene->fieldCount(), 2);
+    CORRADE_COMPARE(scene->fieldType(SceneField::Parent), SceneFieldType::Short);
+    CORRADE_COMPARE(scene->fieldFlags(SceneField::Parent), SceneFieldFlags{});
+    CORRADE_COMPARE_AS(scene->mapping<UnsignedShort>(SceneField::Parent),
+        view.slice(&Field::object),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<Short>(SceneField::Parent),
+        view.slice(&Field::parent),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(scene->fieldType(SceneField::Mesh), SceneFieldType::UnsignedInt);
+    CORRADE_COMPARE(scene->fieldFlags(SceneField::Mesh), SceneFieldFlag::MultiEntry);
+    CORRADE_COMPARE_AS(scene->field<UnsignedInt>(SceneField::Mesh),
+        view.slice(&Field::mesh),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::sceneInvalid() {
+    auto&& data = InvalidSceneData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    struct Field {
+        UnsignedShort object;
+        Short parent;
+        UnsignedInt mesh;
+    } fields[3]{};
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(SceneData{SceneMappingType::UnsignedShort, 4, {}, fields, {
+        SceneFieldData{SceneField::Parent, view.slice(&Field::object), view.slice(&Field::parent)},
+        SceneFieldData{SceneField::Mesh, view.slice(&Field::object), view.slice(&Field::mesh)}
+    }}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Scene);
+    CORRADE_VERIFY(chunk);
+    data.modify(*reinterpret_cast<Implementation::BlobSceneHeader*>(chunk), reinterpret_cast<Implementation::BlobSceneField*>(chunk + sizeof(Implementation::BlobSceneHeader)));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->scene(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::scene(): {}\n", data.message));
+}
+
+void MagnumImporterTest::sceneInvalidStrings() {
+    auto&& data = InvalidSceneStringData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    struct Data {
+        UnsignedShort mapping[2];
+        UnsignedInt offsets[2];
+        char strings[8];
+    } fieldData{{0, 1}, {4, 8}, {'a', 'b', 'c', '\0', 'e', 'f', 'g', '\0'}};
+    CORRADE_COMPARE(offsetof(Data, offsets), 4);
+    CORRADE_COMPARE(offsetof(Data, strings), 12);
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(SceneData{SceneMappingType::UnsignedShort, 2, {}, Containers::arrayView(&fieldData, 1), {
+        SceneFieldData{sceneFieldCustom(0), Containers::arrayView(fieldData.mapping), fieldData.strings, SceneFieldType::StringOffset32, Containers::stridedArrayView(fieldData.offsets), SceneFieldFlag::NullTerminatedString}
+    }}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Scene);
+    CORRADE_VERIFY(chunk);
+    Implementation::BlobSceneHeader& header = *reinterpret_cast<Implementation::BlobSceneHeader*>(chunk);
+    Implementation::BlobSceneField& field = *reinterpret_cast<Implementation::BlobSceneField*>(chunk + sizeof(Implementation::BlobSceneHeader));
+    CORRADE_COMPARE(header.dataSize, sizeof(Data));
+    CORRADE_COMPARE(field.stringOffset, 12);
+
+    /* Verify the unmodified file is valid, to not have the test cases pass
+       due to some unrelated error */
+    {
+        Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+        CORRADE_VERIFY(importer->openData(*blob));
+        Containers::Optional<SceneData> scene = importer->scene(0);
+        CORRADE_VERIFY(scene);
+        CORRADE_COMPARE_AS(scene->fieldStrings(0),
+            Containers::arrayView({"abc"_s, "efg"_s}),
+            TestSuite::Compare::Container);
+    }
+
+    data.modify(field, chunk + header.dataOffset);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->scene(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::scene(): {}\n", data.message));
+}
+
+void MagnumImporterTest::material() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::DiffuseColor, Color4{0.25f, 0.5f, 0.75f, 1.0f}},
+        {MaterialAttribute::Shininess, 15.0f},
+        {"name", "hello"_s},
+
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.5f},
+    }, {3, 5}}, "a material"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->materialName(0), "a material");
+    CORRADE_COMPARE(importer->materialForName("a material"), 0);
+
+    Containers::Optional<MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->attributeDataFlags(), data.memory ? DataFlags{DataFlag::ExternallyOwned} : DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(material->layerDataFlags(), data.memory ? DataFlags{DataFlag::ExternallyOwned} : DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(material->types(), MaterialType::Phong);
+    CORRADE_COMPARE(material->layerCount(), 2);
+    CORRADE_COMPARE(material->attributeCount(0), 3);
+    CORRADE_COMPARE(material->attribute<Color4>(MaterialAttribute::DiffuseColor), (Color4{0.25f, 0.5f, 0.75f, 1.0f}));
+    CORRADE_COMPARE(material->attribute<Float>(MaterialAttribute::Shininess), 15.0f);
+    CORRADE_COMPARE(material->attribute<Containers::StringView>("name"), "hello");
+    CORRADE_COMPARE(material->layerName(1), "ClearCoat");
+    CORRADE_COMPARE(material->layerFactor(1), 0.5f);
+}
+
+void MagnumImporterTest::materialInvalid() {
+    auto&& data = InvalidMaterialData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::DiffuseColor, Color4{0.25f, 0.5f, 0.75f, 1.0f}},
+        {MaterialAttribute::Shininess, 15.0f},
+        {"name", "hello"_s},
+
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.5f},
+    }, {3, 5}}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Material);
+    CORRADE_VERIFY(chunk);
+    Implementation::BlobMaterialHeader& header = *reinterpret_cast<Implementation::BlobMaterialHeader*>(chunk);
+    CORRADE_COMPARE(header.attributeCount, 5);
+    CORRADE_COMPARE(header.layerCount, 2);
+    data.modify(header, reinterpret_cast<MaterialAttributeData*>(chunk + header.attributeOffset), reinterpret_cast<UnsignedInt*>(chunk + header.layerOffset));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->material(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::material(): {}\n", data.message));
+}
+
+void MagnumImporterTest::texture() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    /* The importer checks that the referenced image exists */
+    const char pixel[4]{};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageView3D{PixelFormat::RGBA8Unorm, {1, 1, 1}, pixel}));
+    CORRADE_VERIFY(converter->add(TextureData{TextureType::Texture3D,
+        SamplerFilter::Nearest, SamplerFilter::Linear, SamplerMipmap::Nearest,
+        {SamplerWrapping::Repeat, SamplerWrapping::ClampToEdge, SamplerWrapping::MirroredRepeat}, 0}, "a texture"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->textureCount(), 1);
+    CORRADE_COMPARE(importer->textureName(0), "a texture");
+    CORRADE_COMPARE(importer->textureForName("a texture"), 0);
+
+    Containers::Optional<TextureData> texture = importer->texture(0);
+    CORRADE_VERIFY(texture);
+    CORRADE_COMPARE(texture->type(), TextureType::Texture3D);
+    CORRADE_COMPARE(texture->minificationFilter(), SamplerFilter::Nearest);
+    CORRADE_COMPARE(texture->magnificationFilter(), SamplerFilter::Linear);
+    CORRADE_COMPARE(texture->mipmapFilter(), SamplerMipmap::Nearest);
+    CORRADE_COMPARE(texture->wrapping(), (Math::Vector3<SamplerWrapping>{SamplerWrapping::Repeat, SamplerWrapping::ClampToEdge, SamplerWrapping::MirroredRepeat}));
+    CORRADE_COMPARE(texture->image(), 0);
+}
+
+void MagnumImporterTest::textureCubeMapArray() {
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    /* Two cube maps, six layers each */
+    const char pixels[12*4]{};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageView3D{PixelFormat::RGBA8Unorm, {1, 1, 12}, pixels, ImageFlag3D::CubeMap|ImageFlag3D::Array}));
+    CORRADE_VERIFY(converter->add(TextureData{TextureType::CubeMapArray,
+        SamplerFilter::Linear, SamplerFilter::Linear, SamplerMipmap::Linear,
+        SamplerWrapping::ClampToEdge, 0}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::Optional<TextureData> texture = importer->texture(0);
+    CORRADE_VERIFY(texture);
+    CORRADE_COMPARE(texture->type(), TextureType::CubeMapArray);
+    CORRADE_COMPARE(texture->minificationFilter(), SamplerFilter::Linear);
+    CORRADE_COMPARE(texture->magnificationFilter(), SamplerFilter::Linear);
+    CORRADE_COMPARE(texture->mipmapFilter(), SamplerMipmap::Linear);
+    CORRADE_COMPARE(texture->wrapping(), Math::Vector3<SamplerWrapping>{SamplerWrapping::ClampToEdge});
+    CORRADE_COMPARE(texture->image(), 0);
+
+    Containers::Optional<ImageData3D> image = importer->image3D(texture->image());
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->flags(), ImageFlag3D::CubeMap|ImageFlag3D::Array);
+    CORRADE_COMPARE(image->size(), (Vector3i{1, 1, 12}));
+}
+
+void MagnumImporterTest::textureInvalid() {
+    auto&& data = InvalidTextureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const char pixel[4]{};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageView3D{PixelFormat::RGBA8Unorm, {1, 1, 1}, pixel}));
+    CORRADE_VERIFY(converter->add(TextureData{TextureType::Texture3D,
+        SamplerFilter::Nearest, SamplerFilter::Linear, SamplerMipmap::Nearest,
+        {SamplerWrapping::Repeat, SamplerWrapping::ClampToEdge, SamplerWrapping::MirroredRepeat}, 0}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Texture);
+    CORRADE_VERIFY(chunk);
+    data.modify(*reinterpret_cast<Implementation::BlobTexture*>(chunk));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->texture(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::texture(): {}\n", data.message));
+}
+
+void MagnumImporterTest::image2D() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const char pixels[]{
+        1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12
+    };
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, pixels, ImageFlag2D::Array}, "an image"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image2DName(0), "an image");
+    CORRADE_COMPARE(importer->image2DForName("an image"), 0);
+
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), data.memory ? DataFlags{DataFlag::ExternallyOwned} : DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(!image->isCompressed());
+    CORRADE_COMPARE(image->flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::image2DInvalid() {
+    auto&& data = InvalidImageData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const char pixels[12]{};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, pixels}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    char* const chunk = chunkData(*blob, Implementation::BlobChunkType::Image2D);
+    CORRADE_VERIFY(chunk);
+    data.modify(*reinterpret_cast<Implementation::BlobImageHeader*>(chunk));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->image2D(0));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::image2D(): {}\n", data.message));
+}
+
+void MagnumImporterTest::compressedImage3D() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    /* Two 4x4 BC1 blocks, 8 bytes each */
+    const char blocks[]{
+        1, 2, 3, 4, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16
+    };
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(CompressedImageView3D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4, 2}, blocks, ImageFlag3D::Array}, "a compressed image"));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+    CORRADE_COMPARE(importer->image3DCount(), 1);
+    CORRADE_COMPARE(importer->image3DName(0), "a compressed image");
+
+    Containers::Optional<ImageData3D> image = importer->image3D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), data.memory ? DataFlags{DataFlag::ExternallyOwned} : DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->flags(), ImageFlag3D::Array);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::Bc1RGBAUnorm);
+    CORRADE_COMPARE(image->size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(blocks),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::customNamesDefaultScene() {
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    struct Field {
+        UnsignedInt object;
+        Float radius;
+    } fields[]{
+        {0, 1.5f},
+        {1, 2.5f},
+    };
+    Containers::StridedArrayView1D<Field> view = fields;
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    converter->setSceneFieldName(sceneFieldCustom(17), "radius");
+    converter->setMeshAttributeName(meshAttributeCustom(3), "temperature");
+    CORRADE_VERIFY(converter->add(SceneData{SceneMappingType::UnsignedInt, 2, nullptr, {}}));
+    CORRADE_VERIFY(converter->add(SceneData{SceneMappingType::UnsignedInt, 2, {}, fields, {
+        SceneFieldData{sceneFieldCustom(17), view.slice(&Field::object), view.slice(&Field::radius)}
+    }}));
+    converter->setDefaultScene(1);
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(*blob));
+    CORRADE_COMPARE(importer->sceneCount(), 2);
+    CORRADE_COMPARE(importer->defaultScene(), 1);
+    CORRADE_COMPARE(importer->sceneFieldForName("radius"), sceneFieldCustom(17));
+    CORRADE_COMPARE(importer->sceneFieldName(sceneFieldCustom(17)), "radius");
+    CORRADE_COMPARE(importer->sceneFieldForName("nonexistent"), SceneField{});
+    CORRADE_COMPARE(importer->meshAttributeForName("temperature"), meshAttributeCustom(3));
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(3)), "temperature");
+    CORRADE_COMPARE(importer->meshAttributeName(meshAttributeCustom(4)), "");
+
+    Containers::Optional<SceneData> scene = importer->scene(1);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE_AS(scene->field<Float>(sceneFieldCustom(17)),
+        view.slice(&Field::radius),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::arena() {
+    auto&& data = OpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(!(_converterManager.loadState("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin not enabled, cannot test");
+
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+    };
+    const UnsignedShort indices[]{2, 1, 0};
+    const char pixels[]{
+        1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12
+    };
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, positions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+        }}));
+    CORRADE_VERIFY(converter->add(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 2}, pixels}));
+    CORRADE_VERIFY(converter->add(MaterialData{MaterialType::Phong, {
+        {MaterialAttribute::Shininess, 15.0f},
+
+        {MaterialLayer::ClearCoat},
+    }, {1, 2}}));
+    Containers::Optional<Containers::Array<char>> blob = converter->endData();
+    CORRADE_VERIFY(blob);
+
+    DataArena arena{1024};
+    /* Allocate a byte upfront to know where the block is */
+    const char* const block = arena.allocate(1).data();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    importer->setArena(&arena);
+    CORRADE_VERIFY(data.memory ? importer->openMemory(*blob) : importer->openData(*blob));
+
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    Containers::Optional<MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView(positions),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(pixels),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(material->layerCount(), 2);
+    CORRADE_COMPARE(material->attribute<Float>(MaterialAttribute::Shininess), 15.0f);
+    CORRADE_COMPARE(material->layerName(1), "ClearCoat");
+
+    /* Zero-copy import references the passed memory, the arena isn't used */
+    if(data.memory) {
+        CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(material->attributeDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(material->layerDataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(arena.size(), 1);
+        return;
+    }
+
+    CORRADE_COMPARE(mesh->indexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(material->attributeDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(material->layerDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+    CORRADE_COMPARE(arena.size(), 1 + sizeof(indices) + sizeof(positions) + sizeof(pixels) + 2*sizeof(MaterialAttributeData) + 2*sizeof(UnsignedInt));
+    for(Containers::ArrayView<const char> view: {
+        mesh->indexData(),
+        mesh->vertexData(),
+        image->data(),
+        Containers::arrayCast<const char>(material->attributeData()),
+        Containers::arrayCast<const char>(material->layerData())
+    }) {
+        CORRADE_ITERATION(view.size());
+        CORRADE_VERIFY(view.begin() > block);
+        CORRADE_VERIFY(view.end() <= block + arena.blockSize());
+    }
+}
+
+void MagnumImporterTest::openMemoryUnaligned() {
+    File file = validFile();
+
+    /* Place the file at an odd address, the importer should make an aligned
+       copy instead of referencing the memory */
+    char storage[sizeof(File) + 1];
+    std::memcpy(storage + 1, &file, sizeof(File));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openMemory(Containers::arrayView(storage).exceptPrefix(1)));
+
+    /* Overwriting the original memory doesn't affect the imported data */
+    std::memset(storage, 0, sizeof(storage));
+    CORRADE_COMPARE(importer->sceneFieldForName(""), sceneFieldCustom(1));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumImporterTest)
@@ -0,0 +1,388 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumSceneConverter.h"
+
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ArrayAllocator.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/TextureData.h"
+#include "MagnumPlugins/Implementation/blob.h"
+
+namespace Magnum { namespace Trade {
+
+struct MagnumSceneConverter::State {
+    /* Space for the header, followed by the chunk data. The chunk table is
+       appended in doEndData() and the header filled there as well. */
+    Containers::Array<char> data;
+    Containers::Array<Implementation::BlobChunk> chunks;
+};
+
+MagnumSceneConverter::MagnumSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractSceneConverter{manager, plugin} {}
+
+MagnumSceneConverter::~MagnumSceneConverter() = default;
+
+SceneConverterFeatures MagnumSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMultipleToData|
+           SceneConverterFeature::AddScenes|
+           SceneConverterFeature::AddMeshes|
+           SceneConverterFeature::AddMaterials|
+           SceneConverterFeature::AddTextures|
+           SceneConverterFeature::AddImages1D|
+           SceneConverterFeature::AddImages2D|
+           SceneConverterFeature::AddImages3D|
+           SceneConverterFeature::AddCompressedImages1D|
+           SceneConverterFeature::AddCompressedImages2D|
+           SceneConverterFeature::AddCompressedImages3D;
+}
+
+void MagnumSceneConverter::doAbort() {
+    _state = {};
+}
+
+bool MagnumSceneConverter::doBeginData() {
+    _state.emplace();
+    /* Growing with the Trade allocator so the final array can be returned
+       without a copy */
+    arrayResize<ArrayAllocator>(_state->data, ValueInit, Implementation::blobAlign(sizeof(Implementation::BlobHeader)));
+    return true;
+}
+
+Containers::Optional<Containers::Array<char>> MagnumSceneConverter::doEndData() {
+    Containers::Array<char>& data = _state->data;
+
+    /* The chunk count is stored in 32 bits */
+    if(_state->chunks.size() > 0xffffffffu) {
+        Error{} << "Trade::MagnumSceneConverter::endData(): expected at most 4294967295 chunks but got" << _state->chunks.size();
+        return {};
+    }
+
+    /* Append the chunk table */
+    const std::size_t chunkOffset = Implementation::blobAlign(data.size());
+    const Containers::ArrayView<const char> chunks = Containers::arrayCast<const char>(_state->chunks);
+    arrayResize<ArrayAllocator>(data, ValueInit, chunkOffset + chunks.size());
+    Utility::copy(chunks, data.sliceSize(chunkOffset, chunks.size()));
+
+    /* Fill the header. The memory is zero-initialized, so the padding is
+       zero as well. */
+    Implementation::BlobHeader& header = *reinterpret_cast<Implementation::BlobHeader*>(data.data());
+    std::memcpy(header.magic, Implementation::BlobMagic, sizeof(header.magic));
+    header.version = Implementation::BlobVersion;
+    header.byteOrderMark = Implementation::BlobByteOrderMark;
+    header.chunkCount = UnsignedInt(_state->chunks.size());
+    header.chunkOffset = chunkOffset;
+    header.size = data.size();
+
+    Containers::Optional<Containers::Array<char>> out{Utility::move(data)};
+    _state = {};
+    return out;
+}
+
+namespace {
+
+/* Appends a zero-filled chunk of given size, aligned to BlobAlignment,
+   followed by its name. Returns offset of the chunk data, which has to be
+   re-fetched from the array afterwards as it may have been reallocated. */
+std::size_t appendChunk(Containers::Array<char>& data, Containers::Array<Implementation::BlobChunk>& chunks, const Implementation::BlobChunkType type, const std::size_t size, const Containers::StringView name) {
+    /* The name size is stored in 32 bits */
+    CORRADE_ASSERT(name.size() <= 0xffffffffu,
+        "Trade::MagnumSceneConverter: expected a name at most 4294967295 bytes long but got" << name.size(), {});
+
+    const std::size_t offset = Implementation::blobAlign(data.size());
+    arrayResize<ArrayAllocator>(data, ValueInit, offset + size);
+
+    Implementation::BlobChunk& chunk = arrayAppend(chunks, ValueInit);
+    chunk.type = type;
+    chunk.nameSize = UnsignedInt(name.size());
+    chunk.nameOffset = data.size();
+    chunk.offset = offset;
+    chunk.size = size;
+
+    arrayAppend<ArrayAllocator>(data, Containers::ArrayView<const char>{name});
+    return offset;
+}
+
+void appendUnsignedIntChunk(Containers::Array<char>& data, Containers::Array<Implementation::BlobChunk>& chunks, const Implementation::BlobChunkType type, const UnsignedInt value, const Containers::StringView name) {
+    const std::size_t offset = appendChunk(data, chunks, type, sizeof(UnsignedInt), name);
+    *reinterpret_cast<UnsignedInt*>(data + offset) = value;
+}
+
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const SceneData& scene, const Containers::StringView name) {
+    /* Fields directly follow the header, which is a multiple of the
+       alignment */
+    const std::size_t fieldOffset = sizeof(Implementation::BlobSceneHeader);
+    const std::size_t dataOffset = Implementation::blobAlign(fieldOffset + scene.fieldCount()*sizeof(Implementation::BlobSceneField));
+
+    /* The data layout is stored as offsets relative to the data array, so
+       everything has to be inside of it. The SceneData constructor checks
+       that for the mapping and field views but not for string data. */
+    const Containers::ArrayView<const char> sceneData = scene.data();
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const SceneFieldType type = scene.fieldType(i);
+        if(type == SceneFieldType::Pointer ||
+           type == SceneFieldType::MutablePointer) {
+            Error{} << "Trade::MagnumSceneConverter::add(): scene field" << scene.fieldName(i) << "is a" << type << "which can't be serialized";
+            return false;
+        }
+
+        if(!(scene.fieldFlags(i) & SceneFieldFlag::OffsetOnly) && Implementation::isSceneFieldTypeString(type)) {
+            const char* const stringData = scene.fieldStringData(i);
+            if(stringData < sceneData.begin() || stringData > sceneData.end()) {
+                Error{} << "Trade::MagnumSceneConverter::add(): string data of field" << i << "are not contained in the scene data array";
+                return false;
+            }
+        }
+    }
+
+    const std::size_t offset = appendChunk(_state->data, _state->chunks, Implementation::BlobChunkType::Scene, dataOffset + sceneData.size(), name);
+    char* const chunk = _state->data + offset;
+
+    Implementation::BlobSceneHeader& header = *reinterpret_cast<Implementation::BlobSceneHeader*>(chunk);
+    header.mappingType = UnsignedInt(scene.mappingType());
+    header.fieldCount = scene.fieldCount();
+    header.mappingBound = scene.mappingBound();
+    header.dataOffset = dataOffset;
+    header.dataSize = sceneData.size();
+
+    Implementation::BlobSceneField* const fields = reinterpret_cast<Implementation::BlobSceneField*>(chunk + fieldOffset);
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        Implementation::BlobSceneField& field = fields[i];
+        const SceneFieldType type = scene.fieldType(i);
+        field.name = UnsignedInt(scene.fieldName(i));
+        field.type = UnsignedShort(type);
+        field.arraySize = scene.fieldArraySize(i);
+        field.flags = UnsignedByte(scene.fieldFlags(i) & ~SceneFieldFlag::OffsetOnly);
+        field.size = scene.fieldSize(i);
+
+        /* Empty views can have arbitrary pointers, keep offsets of those at
+           zero */
+        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
+        field.mappingStride = mapping.stride()[0];
+        if(field.size)
+            field.mappingOffset = static_cast<const char*>(mapping.data()) - sceneData.data();
+
+        if(type == SceneFieldType::Bit) {
+            const Containers::StridedBitArrayView2D bits = scene.fieldBitArrays(i);
+            field.bitOffset = bits.offset();
+            field.fieldStride = bits.stride()[0];
+            if(field.size)
+                field.fieldOffset = static_cast<const char*>(bits.data()) - sceneData.data();
+        } else {
+            const Containers::StridedArrayView2D<const char> data = scene.field(i);
+            field.fieldStride = data.stride()[0];
+            if(field.size)
+                field.fieldOffset = static_cast<const char*>(data.data()) - sceneData.data();
+            if(Implementation::isSceneFieldTypeString(type))
+                field.stringOffset = scene.fieldStringData(i) - sceneData.data();
+        }
+    }
+
+    Utility::copy(sceneData, Containers::arrayView(chunk + dataOffset, sceneData.size()));
+    return true;
+}
+
+void MagnumSceneConverter::doSetSceneFieldName(const SceneField field, const Containers::StringView name) {
+    appendUnsignedIntChunk(_state->data, _state->chunks, Implementation::BlobChunkType::SceneFieldName, UnsignedInt(field), name);
+}
+
+void MagnumSceneConverter::doSetDefaultScene(const UnsignedInt id) {
+    appendUnsignedIntChunk(_state->data, _state->chunks, Implementation::BlobChunkType::DefaultScene, id, {});
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MeshData& mesh, const Containers::StringView name) {
+    /* Attributes directly follow the header, which is a multiple of the
+       alignment */
+    const std::size_t attributeOffset = sizeof(Implementation::BlobMeshHeader);
+    const std::size_t indexDataOffset = Implementation::blobAlign(attributeOffset + mesh.attributeCount()*sizeof(Implementation::BlobMeshAttribute));
+    const std::size_t vertexDataOffset = Implementation::blobAlign(indexDataOffset + mesh.indexData().size());
+
+    const std::size_t offset = appendChunk(_state->data, _state->chunks, Implementation::BlobChunkType::Mesh, vertexDataOffset + mesh.vertexData().size(), name);
+    char* const chunk = _state->data + offset;
+
+    Implementation::BlobMeshHeader& header = *reinterpret_cast<Implementation::BlobMeshHeader*>(chunk);
+    header.primitive = UnsignedInt(mesh.primitive());
+    if(mesh.isIndexed()) {
+        header.indexType = UnsignedInt(mesh.indexType());
+        header.indexCount = mesh.indexCount();
+        header.indexStride = mesh.indexStride();
+        header.indexOffset = mesh.indexOffset();
+    }
+    header.vertexCount = mesh.vertexCount();
+    header.attributeCount = mesh.attributeCount();
+    header.indexDataOffset = indexDataOffset;
+    header.indexDataSize = mesh.indexData().size();
+    header.vertexDataOffset = vertexDataOffset;
+    header.vertexDataSize = mesh.vertexData().size();
+
+    Implementation::BlobMeshAttribute* const attributes = reinterpret_cast<Implementation::BlobMeshAttribute*>(chunk + attributeOffset);
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        Implementation::BlobMeshAttribute& attribute = attributes[i];
+        attribute.format = UnsignedInt(mesh.attributeFormat(i));
+        attribute.name = UnsignedShort(mesh.attributeName(i));
+        attribute.arraySize = mesh.attributeArraySize(i);
+        attribute.stride = mesh.attributeStride(i);
+        attribute.morphTargetId = mesh.attributeMorphTargetId(i);
+        attribute.offset = mesh.attributeOffset(i);
+    }
+
+    Utility::copy(mesh.indexData(), Containers::arrayView(chunk + indexDataOffset, mesh.indexData().size()));
+    Utility::copy(mesh.vertexData(), Containers::arrayView(chunk + vertexDataOffset, mesh.vertexData().size()));
+    return true;
+}
+
+void MagnumSceneConverter::doSetMeshAttributeName(const MeshAttribute attribute, const Containers::StringView name) {
+    appendUnsignedIntChunk(_state->data, _state->chunks, Implementation::BlobChunkType::MeshAttributeName, UnsignedInt(attribute), name);
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MaterialData& material, const Containers::StringView name) {
+    const Containers::ArrayView<const MaterialAttributeData> attributeData = material.attributeData();
+    for(const MaterialAttributeData& attribute: attributeData) {
+        if(attribute.type() == MaterialAttributeType::Pointer ||
+           attribute.type() == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MagnumSceneConverter::add(): material attribute" << attribute.name() << "is a" << attribute.type() << "which can't be serialized";
+            return false;
+        }
+    }
+
+    const Containers::ArrayView<const UnsignedInt> layerData = material.layerData();
+    const std::size_t attributeOffset = Implementation::blobAlign(sizeof(Implementation::BlobMaterialHeader));
+    const std::size_t layerOffset = Implementation::blobAlign(attributeOffset + attributeData.size()*sizeof(MaterialAttributeData));
+
+    const std::size_t offset = appendChunk(_state->data, _state->chunks, Implementation::BlobChunkType::Material, layerOffset + layerData.size()*sizeof(UnsignedInt), name);
+    char* const chunk = _state->data + offset;
+
+    Implementation::BlobMaterialHeader& header = *reinterpret_cast<Implementation::BlobMaterialHeader*>(chunk);
+    header.types = UnsignedInt(material.types());
+    header.layerCount = layerData.size();
+    header.attributeCount = attributeData.size();
+    header.attributeOffset = attributeOffset;
+    header.layerOffset = layerOffset;
+
+    /* Copying the attributes as-is, including inline string and buffer
+       values */
+    if(!attributeData.isEmpty())
+        std::memcpy(chunk + attributeOffset, attributeData.data(), attributeData.size()*sizeof(MaterialAttributeData));
+    if(!layerData.isEmpty())
+        std::memcpy(chunk + layerOffset, layerData.data(), layerData.size()*sizeof(UnsignedInt));
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const TextureData& texture, const Containers::StringView name) {
+    const std::size_t offset = appendChunk(_state->data, _state->chunks, Implementation::BlobChunkType::Texture, sizeof(Implementation::BlobTexture), name);
+
+    Implementation::BlobTexture& out = *reinterpret_cast<Implementation::BlobTexture*>(_state->data + offset);
+    out.type = UnsignedInt(texture.type());
+    out.minificationFilter = UnsignedInt(texture.minificationFilter());
+    out.magnificationFilter = UnsignedInt(texture.magnificationFilter());
+    out.mipmapFilter = UnsignedInt(texture.mipmapFilter());
+    for(std::size_t i = 0; i != 3; ++i)
+        out.wrapping[i] = UnsignedInt(texture.wrapping()[i]);
+    out.image = texture.image();
+    return true;
+}
+
+namespace {
+
+template<UnsignedInt dimensions> void addImage(Containers::Array<char>& data, Containers::Array<Implementation::BlobChunk>& chunks, const Implementation::BlobChunkType type, const ImageData<dimensions>& image, const Containers::StringView name) {
+    const std::size_t dataOffset = Implementation::blobAlign(sizeof(Implementation::BlobImageHeader));
+
+    const std::size_t offset = appendChunk(data, chunks, type, dataOffset + image.data().size(), name);
+    char* const chunk = data + offset;
+
+    Implementation::BlobImageHeader& header = *reinterpret_cast<Implementation::BlobImageHeader*>(chunk);
+    header.flags = UnsignedShort(image.flags());
+
+    Vector3i skip;
+    if(image.isCompressed()) {
+        header.compressed = 1;
+        header.format = UnsignedInt(image.compressedFormat());
+        const Vector3i blockSize = image.blockSize();
+        for(std::size_t i = 0; i != 3; ++i)
+            header.blockSize[i] = blockSize[i];
+        header.blockDataSize = image.blockDataSize();
+        const CompressedPixelStorage storage = image.compressedStorage();
+        header.rowLength = storage.rowLength();
+        header.imageHeight = storage.imageHeight();
+        skip = storage.skip();
+    } else {
+        header.format = UnsignedInt(image.format());
+        header.formatExtra = image.formatExtra();
+        header.pixelSize = image.pixelSize();
+        const PixelStorage storage = image.storage();
+        header.alignment = storage.alignment();
+        header.rowLength = storage.rowLength();
+        header.imageHeight = storage.imageHeight();
+        skip = storage.skip();
+    }
+
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+    for(std::size_t i = 0; i != 3; ++i) {
+        header.size[i] = size[i];
+        header.skip[i] = skip[i];
+    }
+    header.dataOffset = dataOffset;
+    header.dataSize = image.data().size();
+
+    Utility::copy(image.data(), Containers::arrayView(chunk + dataOffset, image.data().size()));
+}
+
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData1D& image, const Containers::StringView name) {
+    addImage(_state->data, _state->chunks, Implementation::BlobChunkType::Image1D, image, name);
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData2D& image, const Containers::StringView name) {
+    addImage(_state->data, _state->chunks, Implementation::BlobChunkType::Image2D, image, name);
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData3D& image, const Containers::StringView name) {
+    addImage(_state->data, _state->chunks, Implementation::BlobChunkType::Image3D, image, name);
+    return true;
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumSceneConverter, Magnum::Trade::MagnumSceneConverter,
+    MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE)
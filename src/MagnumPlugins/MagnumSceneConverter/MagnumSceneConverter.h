@@ -0,0 +1,165 @@
+#ifndef Magnum_Trade_MagnumSceneConverter_h
+#define Magnum_Trade_MagnumSceneConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumSceneConverter
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "MagnumPlugins/MagnumSceneConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MAGNUMSCENECONVERTER_BUILD_STATIC
+    #ifdef MagnumSceneConverter_EXPORTS
+        #define MAGNUM_MAGNUMSCENECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MAGNUMSCENECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MAGNUMSCENECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MAGNUMSCENECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#else
+#define MAGNUM_MAGNUMSCENECONVERTER_EXPORT
+#define MAGNUM_MAGNUMSCENECONVERTER_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum binary scene converter plugin
+@m_since_latest
+
+Serializes meshes, scenes, materials, textures and images into a binary
+`*.blob` file that can be loaded back with @ref MagnumImporter without any
+parsing and, if memory-mapped, without any copying.
+
+@section Trade-MagnumSceneConverter-usage Usage
+
+@m_class{m-note m-success}
+
+@par
+    This class is a plugin that's meant to be dynamically loaded and used
+    through the base @ref AbstractSceneConverter interface. See its
+    documentation for introduction and usage examples.
+
+This plugin depends on the @ref Trade library and is built if
+`MAGNUM_WITH_MAGNUMSCENECONVERTER` is enabled when building Magnum. To use as a
+dynamic plugin, load @cpp "MagnumSceneConverter" @ce via
+@ref Corrade::PluginManager::Manager.
+
+Additionally, if you're using Magnum as a CMake subproject, do the following:
+
+@code{.cmake}
+set(MAGNUM_WITH_MAGNUMSCENECONVERTER ON CACHE BOOL "" FORCE)
+add_subdirectory(magnum EXCLUDE_FROM_ALL)
+
+# So the dynamically loaded plugin gets built implicitly
+add_dependencies(your-app Magnum::MagnumSceneConverter)
+@endcode
+
+To use as a static plugin or as a dependency of another plugin with CMake, you
+need to request the `MagnumSceneConverter` component of the `Magnum` package
+and link to the `Magnum::MagnumSceneConverter` target:
+
+@code{.cmake}
+find_package(Magnum REQUIRED MagnumSceneConverter)
+
+# ...
+target_link_libraries(your-app PRIVATE Magnum::MagnumSceneConverter)
+@endcode
+
+See @ref building, @ref cmake, @ref plugins and @ref file-formats for more
+information.
+
+@section Trade-MagnumSceneConverter-behavior Behavior and limitations
+
+The index, vertex, scene field, material attribute and pixel data are stored
+in exactly the layout the @ref MeshData, @ref SceneData, @ref MaterialData and
+@ref ImageData classes use internally, with each data region aligned to 16
+bytes, so interleaving, strides and implementation-specific formats are
+preserved. Names of all data, custom @ref SceneField and
+@ref MeshAttribute names passed to @ref setSceneFieldName() and
+@ref setMeshAttributeName() and the default scene passed to
+@ref setDefaultScene() are stored as well.
+
+The file is written in the native byte order and the material attributes are
+stored as-is, which means a file is meant to be loaded only on a platform with
+the same endianness and by the same Magnum version that produced it. Its main
+use is as an intermediate cache format for fast loading of assets that were
+converted from another format beforehand. @ref MagnumImporter checks the file
+version and byte order and fails the import if they don't match.
+
+Scene object names, animations, lights, cameras and skins aren't supported.
+Scene fields of @ref SceneFieldType::Pointer and
+@relativeref{SceneFieldType,MutablePointer} types and material attributes of
+@ref MaterialAttributeType::Pointer and
+@relativeref{MaterialAttributeType,MutablePointer} types can't be serialized
+and cause the scene or material addition to fail. Only single-level meshes
+and images are supported. Compressed image storage properties other than row
+length, image height and skip aren't preserved.
+*/
+class MAGNUM_MAGNUMSCENECONVERTER_EXPORT MagnumSceneConverter: public AbstractSceneConverter {
+    public:
+        /** @brief Plugin manager constructor */
+        explicit MagnumSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
+
+        ~MagnumSceneConverter();
+
+    private:
+        struct State;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL SceneConverterFeatures doFeatures() const override;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL void doAbort() override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doBeginData() override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL Containers::Optional<Containers::Array<char>> doEndData() override;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const SceneData& scene, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL void doSetSceneFieldName(SceneField field, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL void doSetDefaultScene(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const MeshData& mesh, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL void doSetMeshAttributeName(MeshAttribute attribute, Containers::StringView name) override;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const MaterialData& material, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const TextureData& texture, Containers::StringView name) override;
+
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData1D& image, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData2D& image, Containers::StringView name) override;
+        MAGNUM_MAGNUMSCENECONVERTER_LOCAL bool doAdd(UnsignedInt id, const ImageData3D& image, Containers::StringView name) override;
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
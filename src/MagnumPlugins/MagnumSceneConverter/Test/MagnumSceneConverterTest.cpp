@@ -0,0 +1,217 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/Implementation/blob.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MagnumSceneConverterTest: TestSuite::Tester {
+    explicit MagnumSceneConverterTest();
+
+    void empty();
+    void mesh();
+    void names();
+
+    void scenePointerField();
+    void materialPointerAttribute();
+
+    void abort();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _manager{"nonexistent"};
+};
+
+MagnumSceneConverterTest::MagnumSceneConverterTest() {
+    addTests({&MagnumSceneConverterTest::empty,
+              &MagnumSceneConverterTest::mesh,
+              &MagnumSceneConverterTest::names,
+
+              &MagnumSceneConverterTest::scenePointerField,
+              &MagnumSceneConverterTest::materialPointerAttribute,
+
+              &MagnumSceneConverterTest::abort});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MAGNUMSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MagnumSceneConverterTest::empty() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    /* Just the header padded to the alignment, and an empty chunk table */
+    CORRADE_COMPARE(out->size(), 32);
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(out->data());
+    CORRADE_COMPARE((Containers::StringView{header.magic, 4}), "BLOB");
+    CORRADE_COMPARE(header.version, 1);
+    CORRADE_COMPARE(header.byteOrderMark, 0x0102);
+    CORRADE_COMPARE(header.chunkCount, 0);
+    CORRADE_COMPARE(header.chunkOffset, 32);
+    CORRADE_COMPARE(header.size, 32);
+}
+
+void MagnumSceneConverterTest::mesh() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const UnsignedShort indices[]{0, 2, 1, 1, 2, 3};
+    const Vector3 positions[]{{}, {}, {}, {}};
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, positions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(mesh, "a mesh"));
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(out->data());
+    CORRADE_COMPARE(header.size, out->size());
+    CORRADE_COMPARE(header.chunkCount, 1);
+    CORRADE_COMPARE(header.chunkOffset % 16, 0);
+
+    const Implementation::BlobChunk& chunk = *reinterpret_cast<const Implementation::BlobChunk*>(out->data() + header.chunkOffset);
+    CORRADE_COMPARE(UnsignedInt(chunk.type), UnsignedInt(Implementation::BlobChunkType::Mesh));
+    CORRADE_COMPARE(chunk.offset % 16, 0);
+    CORRADE_COMPARE((Containers::StringView{out->data() + chunk.nameOffset, chunk.nameSize}), "a mesh");
+
+    /* The index and vertex data are aligned and stored as-is */
+    const Implementation::BlobMeshHeader& meshHeader = *reinterpret_cast<const Implementation::BlobMeshHeader*>(out->data() + chunk.offset);
+    CORRADE_COMPARE(meshHeader.indexType, UnsignedInt(MeshIndexType::UnsignedShort));
+    CORRADE_COMPARE(meshHeader.indexCount, 6);
+    CORRADE_COMPARE(meshHeader.vertexCount, 4);
+    CORRADE_COMPARE(meshHeader.attributeCount, 1);
+    CORRADE_COMPARE(meshHeader.indexDataOffset % 16, 0);
+    CORRADE_COMPARE(meshHeader.indexDataSize, sizeof(indices));
+    CORRADE_COMPARE(meshHeader.vertexDataOffset % 16, 0);
+    CORRADE_COMPARE(meshHeader.vertexDataSize, sizeof(positions));
+    CORRADE_COMPARE_AS((Containers::arrayCast<const UnsignedShort>(out->sliceSize(chunk.offset + meshHeader.indexDataOffset, meshHeader.indexDataSize))),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+}
+
+void MagnumSceneConverterTest::names() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+    converter->setMeshAttributeName(meshAttributeCustom(3), "customAttribute");
+    converter->setSceneFieldName(sceneFieldCustom(17), "customField");
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(out->data());
+    CORRADE_COMPARE(header.chunkCount, 2);
+
+    const Implementation::BlobChunk* chunks = reinterpret_cast<const Implementation::BlobChunk*>(out->data() + header.chunkOffset);
+    CORRADE_COMPARE(UnsignedInt(chunks[0].type), UnsignedInt(Implementation::BlobChunkType::MeshAttributeName));
+    CORRADE_COMPARE((Containers::StringView{out->data() + chunks[0].nameOffset, chunks[0].nameSize}), "customAttribute");
+    CORRADE_COMPARE(*reinterpret_cast<const UnsignedInt*>(out->data() + chunks[0].offset), UnsignedInt(meshAttributeCustom(3)));
+    CORRADE_COMPARE(UnsignedInt(chunks[1].type), UnsignedInt(Implementation::BlobChunkType::SceneFieldName));
+    CORRADE_COMPARE((Containers::StringView{out->data() + chunks[1].nameOffset, chunks[1].nameSize}), "customField");
+    CORRADE_COMPARE(*reinterpret_cast<const UnsignedInt*>(out->data() + chunks[1].offset), UnsignedInt(sceneFieldCustom(17)));
+}
+
+void MagnumSceneConverterTest::scenePointerField() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    struct Field {
+        UnsignedInt object;
+        const void* importerState;
+    } fields[1]{};
+    Containers::StridedArrayView1D<Field> view = fields;
+    SceneData scene{SceneMappingType::UnsignedInt, 1, {}, fields, {
+        SceneFieldData{SceneField::ImporterState, view.slice(&Field::object), view.slice(&Field::importerState)}
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(scene));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): scene field Trade::SceneField::ImporterState is a Trade::SceneFieldType::Pointer which can't be serialized\n");
+}
+
+void MagnumSceneConverterTest::materialPointerAttribute() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const Int a = 5;
+    MaterialData material{{}, {
+        {MaterialAttribute::BaseColor, Color4{}},
+        {"pointer", &a}
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(material));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): material attribute pointer is a Trade::MaterialAttributeType::Pointer which can't be serialized\n");
+}
+
+void MagnumSceneConverterTest::abort() {
+    Containers::Pointer<AbstractSceneConverter> converter = _manager.instantiate("MagnumSceneConverter");
+
+    const Vector3 positions[3]{};
+    MeshData mesh{MeshPrimitive::Points, {}, positions, {
+        MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+    }};
+
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(mesh));
+    converter->abort();
+
+    /* Starting again should produce a file without the previous data */
+    CORRADE_VERIFY(converter->beginData());
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(reinterpret_cast<const Implementation::BlobHeader*>(out->data())->chunkCount, 0);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumSceneConverterTest)
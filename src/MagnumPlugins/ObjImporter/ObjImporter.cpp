@@ -40,6 +40,7 @@
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Trade {
@@ -279,11 +280,151 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
     return true;
 }
 
+/* Allocates from the arena if there's one, otherwise into the owned array */
+Containers::ArrayView<char> allocate(DataArena* const arena, Containers::Array<char>& owned, const std::size_t size) {
+    if(arena)
+        return arena->allocate(size);
+    owned = Containers::Array<char>{NoInit, size};
+    return owned;
+}
+
+/* Assembles a mesh out of indices parsed so far. The vertex data are all
+   vertex data parsed so far, the indices are modified in-place if index arrays
+   are merged. If the arena is non-null, index and vertex data are allocated
+   from it. */
+Containers::Optional<MeshData> assembleMesh(const Mesh& mesh, const Containers::Optional<MeshPrimitive> primitive, const Containers::Array<Vector3>& positions, const Containers::Array<Vector2>& textureCoordinates, const Containers::Array<Vector3>& normals, const Containers::ArrayView<Vector3ui> indices, const std::size_t textureCoordinateIndexCount, const std::size_t normalIndexCount, const bool mergeIndexArrays, DataArena* const arena) {
+    /* There should be at least indexed position data */
+    if(positions.isEmpty() || indices.isEmpty()) {
+        Error() << "Trade::ObjImporter::mesh(): incomplete position data";
+        return {};
+    }
+
+    /* If there are index data, there should be also vertex data (and also the other way) */
+    if(textureCoordinates.isEmpty() != (textureCoordinateIndexCount == 0)) {
+        Error() << "Trade::ObjImporter::mesh(): incomplete texture coordinate data";
+        return {};
+    }
+    if(normals.isEmpty() != (normalIndexCount == 0)) {
+        Error() << "Trade::ObjImporter::mesh(): incomplete normal data";
+        return {};
+    }
+
+    /* All index arrays should have the same length */
+    if(textureCoordinateIndexCount && textureCoordinateIndexCount != indices.size()) {
+        CORRADE_INTERNAL_ASSERT(textureCoordinateIndexCount < indices.size());
+        Error() << "Trade::ObjImporter::mesh(): some texture coordinate indices are missing";
+        return {};
+    }
+    if(normalIndexCount && normalIndexCount != indices.size()) {
+        CORRADE_INTERNAL_ASSERT(normalIndexCount < indices.size());
+        Error() << "Trade::ObjImporter::mesh(): some normal indices are missing";
+        return {};
+    }
+
+    /* Merge index arrays, unless disabled. If any of the attributes was not
+       there, the whole index array has zeros, not affecting the uniqueness in
+       any way. */
+    Containers::Array<char> ownedIndexData;
+    Containers::ArrayView<char> indexData;
+    std::size_t vertexCount;
+    if(mergeIndexArrays) {
+        indexData = allocate(arena, ownedIndexData, indices.size()*sizeof(UnsignedInt));
+        const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
+        vertexCount = MeshTools::removeDuplicatesInPlaceInto(
+            Containers::arrayCast<2, char>(indices), indexDataI);
+
+    /* If merging was disabled, this behaves like if all index tuples were
+       unique. No other change needed. */
+    } else vertexCount = indices.size();
+
+    /* Allocate attribute and vertex data */
+    std::size_t attributeCount = 1;
+    UnsignedInt stride = sizeof(Vector3);
+    if(textureCoordinateIndexCount) {
+        ++attributeCount;
+        stride += sizeof(Vector2);
+    }
+    if(normalIndexCount) {
+        ++attributeCount;
+        stride += sizeof(Vector3);
+    }
+    Containers::Array<MeshAttributeData> attributeData{ValueInit, attributeCount};
+    Containers::Array<char> ownedVertexData;
+    const Containers::ArrayView<char> vertexData = allocate(arena, ownedVertexData, vertexCount*stride);
+
+    /* Duplicate the vertices into the output */
+    const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
+    std::size_t attributeIndex = 0;
+    std::size_t offset = 0;
+    {
+        Containers::StridedArrayView1D<Vector3> view{vertexData,
+            reinterpret_cast<Vector3*>(vertexData.data()), vertexCount, stride};
+        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, mesh.positionIndexOffset))
+            return {};
+        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Position, view};
+        offset += sizeof(Vector3);
+    }
+    if(textureCoordinateIndexCount) {
+        Containers::StridedArrayView1D<Vector2> view{vertexData,
+            reinterpret_cast<Vector2*>(vertexData.data() + offset), vertexCount, stride};
+        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), textureCoordinates, view, mesh.textureCoordinateIndexOffset))
+            return {};
+        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::TextureCoordinates, view};
+        offset += sizeof(Vector2);
+    }
+    if(normalIndexCount) {
+        Containers::StridedArrayView1D<Vector3> view{vertexData,
+            reinterpret_cast<Vector3*>(vertexData.data() + offset), vertexCount, stride};
+        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), normals, view, mesh.normalIndexOffset))
+            return {};
+        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Normal, view};
+        offset += sizeof(Vector3);
+    }
+    CORRADE_INTERNAL_ASSERT(offset == stride && attributeIndex == attributeCount);
+
+    /* If mergeIndexArrays was disabled, indexData is empty and the mesh is
+       not indexed */
+    const auto meshIndices = mergeIndexArrays ?
+        Trade::MeshIndexData{MeshIndexType::UnsignedInt, indexData} :
+        Trade::MeshIndexData{};
+    if(arena) return MeshData{*primitive,
+        DataFlag::ExternallyOwned|DataFlag::Mutable, indexData, meshIndices,
+        DataFlag::ExternallyOwned|DataFlag::Mutable, vertexData, Utility::move(attributeData)};
+    return MeshData{*primitive,
+        Utility::move(ownedIndexData), meshIndices,
+        Utility::move(ownedVertexData), Utility::move(attributeData)};
+}
+
 }
 
 Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    /* Import everything as a single chunk. Unlike chunks, which are meant to
+       be processed and discarded right away, the whole mesh can be placed
+       into the arena. */
+    Containers::Optional<MeshData> out;
+    if(!meshChunksInternal(id, ~std::size_t{}, arena(), [](MeshData&& chunk, void* const out) {
+        *static_cast<Containers::Optional<MeshData>*>(out) = Utility::move(chunk);
+        return true;
+    }, &out))
+        return {};
+
+    return out;
+}
+
+bool ObjImporter::doMeshChunks(const UnsignedInt id, UnsignedInt, const std::size_t maxChunkSize, bool(*const callback)(MeshData&&, void*), void* const userData) {
+    return meshChunksInternal(id, maxChunkSize, nullptr, callback, userData);
+}
+
+bool ObjImporter::meshChunksInternal(const UnsignedInt id, const std::size_t maxChunkSize, DataArena* const arena, bool(*const callback)(MeshData&&, void*), void* const userData) {
     /* Seek the file, set mesh parsing parameters */
     const Mesh& mesh = _file->meshes[id];
+    const bool mergeIndexArrays = configuration().value<bool>("mergeIndexArrays");
+
+    /* In the worst case each index tuple results in a unique vertex with all
+       three attributes, plus an index. Chunks are flushed at primitive
+       boundaries once adding another primitive would exceed this count. */
+    const std::size_t maxChunkIndexTupleCount = maxChunkSize/(sizeof(Vector3)*2 + sizeof(Vector2) + sizeof(UnsignedInt));
+    bool chunkImported = false;
 
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
@@ -294,6 +435,25 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
     Containers::Array<Vector3ui> indices;
     std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
 
+    /* Imports indices parsed so far as a chunk if adding given count of index
+       tuples would make it exceed the budget. The index counts are without
+       the tuples parsed on the current line. */
+    const auto flushChunk = [&](const std::size_t indexTupleCount, const std::size_t chunkTextureCoordinateIndexCount, const std::size_t chunkNormalIndexCount) {
+        if(indices.isEmpty() || indices.size() + indexTupleCount <= maxChunkIndexTupleCount)
+            return true;
+
+        Containers::Optional<MeshData> chunk = assembleMesh(mesh, primitive, positions, textureCoordinates, normals, indices, chunkTextureCoordinateIndexCount, chunkNormalIndexCount, mergeIndexArrays, arena);
+        if(!chunk || !callback(Utility::move(*chunk), userData))
+            return false;
+
+        /* Keep the capacity for the next chunk */
+        arrayClear(indices);
+        textureCoordinateIndexCount -= chunkTextureCoordinateIndexCount;
+        normalIndexCount -= chunkNormalIndexCount;
+        chunkImported = true;
+        return true;
+    };
+
     Containers::StringView in{mesh.begin, std::size_t(_file->meshes[id + 1].begin - mesh.begin)};
     while(in) {
         /* Get a line from the input */
@@ -345,7 +505,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                 const Containers::StringView foundSpace = contents.findAnyOr(Whitespace, contents.end());
 
                 if(!parseFloat("Trade::ObjImporter::mesh():", contents.prefix(foundSpace.begin()), data[i]))
-                    return {};
+                    return false;
 
                 contents = contents.suffix(foundSpace.end()).trimmedPrefix(Whitespace);
             }
@@ -354,11 +514,11 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             if(keyword == "v"_s) {
                 if(i < 3 || contents) {
                     Error{} << "Trade::ObjImporter::mesh(): expected 3 or 4 position coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
                 if(i == 4 && !Math::equal(data[3], 1.0f)) {
                     Error{} << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                    return {};
+                    return false;
                 }
 
                 arrayAppend(positions, Vector3::from(data));
@@ -367,11 +527,11 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             } else if(keyword == "vt"_s) {
                 if(i < 2 || contents) {
                     Error{} << "Trade::ObjImporter::mesh(): expected 2 or 3 texture coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
                 if(i == 3 && !Math::equal(data[2], 0.0f)) {
                     Error{} << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                    return {};
+                    return false;
                 }
 
                 arrayAppend(textureCoordinates, Vector2::from(data));
@@ -380,7 +540,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             } else if(keyword == "vn"_s) {
                 if(i < 3 || contents) {
                     Error{} << "Trade::ObjImporter::mesh(): expected 3 normal coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
 
                 arrayAppend(normals, Vector3::from(data));
@@ -400,6 +560,11 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                 maxIndexTupleCount = 4;
             else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
+            /* Index counts before this line, in case the indices parsed so
+               far get imported as a chunk */
+            const std::size_t previousTextureCoordinateIndexCount = textureCoordinateIndexCount;
+            const std::size_t previousNormalIndexCount = normalIndexCount;
+
             /* Parse them all. If there's less than expected, `i` would be too
                small; if there's more then `contents` would stay non-empty. */
             Vector3ui data[4];
@@ -412,7 +577,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                 const Containers::StringView foundSlash1 = indexTuple.findOr('/', indexTuple.end());
                 Int index;
                 if(!parseInt("Trade::ObjImporter::mesh():", indexTuple.prefix(foundSlash1.begin()), index))
-                    return {};
+                    return false;
                 /* If the number is negative, it counts from the end (-1 is
                    the last known position at this point, counting from 1) */
                 if(index < 0)
@@ -426,7 +591,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                     const Containers::StringView foundSlash2 = indexTuple.findOr('/', indexTuple.end());
                     if(!foundSlash2 || foundSlash2.begin() != indexTuple.begin()) {
                         if(!parseInt("Trade::ObjImporter::mesh():", indexTuple.prefix(foundSlash2.begin()), index))
-                            return {};
+                            return false;
                         /* If the number is negative, it counts from the end
                            (-1 is the last known texture coordinate at this
                            point, counting from 1) */
@@ -440,7 +605,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                     if(foundSlash2) {
                         indexTuple = indexTuple.suffix(foundSlash2.end());
                         if(!parseInt("Trade::ObjImporter::mesh():", indexTuple, index))
-                            return {};
+                            return false;
                         /* If the number is negative, it counts from the end
                            (-1 is the last known normal at this point, counting
                            from 1) */
@@ -458,13 +623,15 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             if(keyword == "p") {
                 if(primitive && primitive != MeshPrimitive::Points) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return {};
+                    return false;
                 }
                 if(i < 1 || contents) {
                     Error() << "Trade::ObjImporter::mesh(): expected exactly 1 position index tuple for a point, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
 
+                if(!flushChunk(1, previousTextureCoordinateIndexCount, previousNormalIndexCount))
+                    return false;
                 primitive = MeshPrimitive::Points;
                 arrayAppend(indices, Containers::arrayView(data).prefix(1));
 
@@ -472,13 +639,15 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             } else if(keyword == "l") {
                 if(primitive && primitive != MeshPrimitive::Lines) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return {};
+                    return false;
                 }
                 if(i < 2 || contents) {
                     Error() << "Trade::ObjImporter::mesh(): expected exactly 2 position index tuples for a line, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
 
+                if(!flushChunk(2, previousTextureCoordinateIndexCount, previousNormalIndexCount))
+                    return false;
                 primitive = MeshPrimitive::Lines;
                 arrayAppend(indices, Containers::arrayView(data).prefix(2));
 
@@ -486,13 +655,16 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             } else if(keyword == "f") {
                 if(primitive && primitive != MeshPrimitive::Triangles) {
                     Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return {};
+                    return false;
                 }
                 if(i < 3 || contents) {
                     Error() << "Trade::ObjImporter::mesh(): expected 3 or 4 position index tuples for a face, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    return false;
                 }
 
+                if(!flushChunk(i == 4 ? 6 : 3, previousTextureCoordinateIndexCount, previousNormalIndexCount))
+                    return false;
+
                 /* If it's a quad, convert it to two triangles */
                 if(i == 4) {
                     /** @todo use MeshTools::generateQuadIndices() once it
@@ -528,105 +700,17 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
         /* Unknown keyword */
         } else {
             Error{} << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
-            return {};
+            return false;
         }
     }
 
-    /* There should be at least indexed position data */
-    if(positions.isEmpty() || indices.isEmpty()) {
-        Error() << "Trade::ObjImporter::mesh(): incomplete position data";
-        return {};
-    }
-
-    /* If there are index data, there should be also vertex data (and also the other way) */
-    if(textureCoordinates.isEmpty() != (textureCoordinateIndexCount == 0)) {
-        Error() << "Trade::ObjImporter::mesh(): incomplete texture coordinate data";
-        return {};
-    }
-    if(normals.isEmpty() != (normalIndexCount == 0)) {
-        Error() << "Trade::ObjImporter::mesh(): incomplete normal data";
-        return {};
-    }
-
-    /* All index arrays should have the same length */
-    if(textureCoordinateIndexCount && textureCoordinateIndexCount != indices.size()) {
-        CORRADE_INTERNAL_ASSERT(textureCoordinateIndexCount < indices.size());
-        Error() << "Trade::ObjImporter::mesh(): some texture coordinate indices are missing";
-        return {};
-    }
-    if(normalIndexCount && normalIndexCount != indices.size()) {
-        CORRADE_INTERNAL_ASSERT(normalIndexCount < indices.size());
-        Error() << "Trade::ObjImporter::mesh(): some normal indices are missing";
-        return {};
-    }
-
-    /* Merge index arrays, unless disabled. If any of the attributes was not
-       there, the whole index array has zeros, not affecting the uniqueness in
-       any way. */
-    Containers::Array<char> indexData;
-    std::size_t vertexCount;
-    if(configuration().value<bool>("mergeIndexArrays")) {
-        indexData = Containers::Array<char>{NoInit, indices.size()*sizeof(UnsignedInt)};
-        const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
-        vertexCount = MeshTools::removeDuplicatesInPlaceInto(
-            Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
-
-    /* If merging was disabled, this behaves like if all index tuples were
-       unique. No other change needed. */
-    } else vertexCount = indices.size();
-
-    /* Allocate attribute and vertex data */
-    std::size_t attributeCount = 1;
-    UnsignedInt stride = sizeof(Vector3);
-    if(textureCoordinateIndexCount) {
-        ++attributeCount;
-        stride += sizeof(Vector2);
-    }
-    if(normalIndexCount) {
-        ++attributeCount;
-        stride += sizeof(Vector3);
-    }
-    Containers::Array<MeshAttributeData> attributeData{ValueInit, attributeCount};
-    Containers::Array<char> vertexData{NoInit, vertexCount*stride};
-
-    /* Duplicate the vertices into the output */
-    const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
-    std::size_t attributeIndex = 0;
-    std::size_t offset = 0;
-    {
-        Containers::StridedArrayView1D<Vector3> view{vertexData,
-            reinterpret_cast<Vector3*>(vertexData.data()), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[0].prefix(vertexCount), positions, view, mesh.positionIndexOffset))
-            return {};
-        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Position, view};
-        offset += sizeof(Vector3);
-    }
-    if(textureCoordinateIndexCount) {
-        Containers::StridedArrayView1D<Vector2> view{vertexData,
-            reinterpret_cast<Vector2*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[1].prefix(vertexCount), textureCoordinates, view, mesh.textureCoordinateIndexOffset))
-            return {};
-        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::TextureCoordinates, view};
-        offset += sizeof(Vector2);
-    }
-    if(normalIndexCount) {
-        Containers::StridedArrayView1D<Vector3> view{vertexData,
-            reinterpret_cast<Vector3*>(vertexData.data() + offset), vertexCount, stride};
-        if(!checkAndDuplicateInto(indicesPerAttribute[2].prefix(vertexCount), normals, view, mesh.normalIndexOffset))
-            return {};
-        attributeData[attributeIndex++] = MeshAttributeData{MeshAttribute::Normal, view};
-        offset += sizeof(Vector3);
-    }
-    CORRADE_INTERNAL_ASSERT(offset == stride && attributeIndex == attributeCount);
-
-    /* If mergeIndexArrays was disabled, indexData is nullptr and the mesh is
-       not indexed */
-    const auto meshIndices = indexData ?
-        Trade::MeshIndexData{MeshIndexType::UnsignedInt, indexData} :
-        Trade::MeshIndexData{};
-    return MeshData{*primitive,
-        Utility::move(indexData), meshIndices,
-        Utility::move(vertexData), Utility::move(attributeData)};
+    /* Import the remaining indices. If no chunk was imported so far, this
+       is done even if there are no indices in order to fail on the empty
+       mesh. */
+    if(indices.isEmpty() && chunkImported)
+        return true;
+    Containers::Optional<MeshData> chunk = assembleMesh(mesh, primitive, positions, textureCoordinates, normals, indices, textureCoordinateIndexCount, normalIndexCount, mergeIndexArrays, arena);
+    return chunk && callback(Utility::move(*chunk), userData);
 }
 
 }}
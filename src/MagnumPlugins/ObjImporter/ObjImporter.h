@@ -118,6 +118,25 @@ that mix points, lines and faces together are not supported.
 Files containing object name annotations (`o`) are split into multiple meshes,
 with the object name available through @ref meshName() / @ref meshForName().
 
+@ref meshChunks() is implemented natively. Faces, lines and points are parsed
+and turned into a chunk as soon as the next primitive wouldn't fit into the
+budget anymore, assuming each index can reference a unique vertex with all
+three attributes. Only the index data of a single chunk are held in memory at a
+time, however the positions, texture coordinates and normals are parsed into
+per-attribute arrays that are kept for the whole mesh, as any face can
+reference any of them. The memory use is thus bounded only for the index data
+and the assembled chunks, not for the vertex data, and the importer isn't
+suitable for files whose positions, texture coordinates and normals alone
+don't fit into memory. Unlike with @ref mesh(), when importing in chunks,
+primitives can reference only vertex data defined earlier in the file,
+otherwise the import fails with an out-of-range index error.
+
+If an arena is set via @ref setArena(), index and vertex data of meshes
+returned from @ref mesh() are allocated from it and imported with
+@ref DataFlag::ExternallyOwned and @ref DataFlag::Mutable set. The attribute
+array as well as chunks passed to the @ref meshChunks() callback are allocated
+as usual.
+
 Material properties are currently not supported.
 
 @section Trade-ObjImporter-configuration Plugin-specific configuration
@@ -160,8 +179,10 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
         MAGNUM_OBJIMPORTER_LOCAL Int doMeshForName(Containers::StringView name) override;
         MAGNUM_OBJIMPORTER_LOCAL Containers::String doMeshName(UnsignedInt id) override;
         MAGNUM_OBJIMPORTER_LOCAL Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override;
+        MAGNUM_OBJIMPORTER_LOCAL bool doMeshChunks(UnsignedInt id, UnsignedInt level, std::size_t maxChunkSize, bool(*callback)(MeshData&&, void*), void* userData) override;
 
         MAGNUM_OBJIMPORTER_LOCAL void parseMeshNames();
+        MAGNUM_OBJIMPORTER_LOCAL bool meshChunksInternal(UnsignedInt id, std::size_t maxChunkSize, DataArena* arena, bool(*callback)(MeshData&&, void*), void* userData);
 
         Containers::Pointer<File> _file;
 };
@@ -24,17 +24,20 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Move.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/MeshData.h"
 
 #include "configure.h"
@@ -60,6 +63,11 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshNoMergeIndexArrays();
     void meshNegativeIndices();
     void meshQuads();
+    void meshChunks();
+    void meshChunksWhole();
+    void meshChunksForwardReferences();
+    void meshArena();
+    void meshChunksArena();
 
     void meshIgnoredKeyword();
 
@@ -204,6 +212,11 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::meshNoMergeIndexArrays,
               &ObjImporterTest::meshNegativeIndices,
               &ObjImporterTest::meshQuads,
+              &ObjImporterTest::meshChunks,
+              &ObjImporterTest::meshChunksWhole,
+              &ObjImporterTest::meshChunksForwardReferences,
+              &ObjImporterTest::meshArena,
+              &ObjImporterTest::meshChunksArena,
 
               &ObjImporterTest::meshIgnoredKeyword,
 
@@ -620,6 +633,188 @@ void ObjImporterTest::meshQuads() {
         }), TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshChunks() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-quads.obj")));
+
+    /* Each index tuple is budgeted 36 bytes for the worst case of a unique
+       vertex with all three attributes plus an index, so 108 bytes fit just
+       the triangle. The quad doesn't fit but has to be imported whole. */
+    Containers::Array<MeshData> chunks;
+    CORRADE_VERIFY(importer->meshChunks(0, 0, 108, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 2);
+
+    CORRADE_COMPARE(chunks[0].primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(chunks[0].attributeCount(), 3);
+    CORRADE_COMPARE_AS(chunks[0].attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.0f, 3.0f, 0.0f},
+            {-1.0f, 1.0f, 0.0f},
+            {1.0f, 1.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[0].attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.5f, 1.0f},
+            {0.0f, 0.5f},
+            {1.0f, 0.5f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[0].attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {0.0f, 1.0f, 0.0f},
+            {-1.0f, 0.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[0].indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 2
+        }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(chunks[1].primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(chunks[1].attributeCount(), 3);
+    CORRADE_COMPARE_AS(chunks[1].attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {-1.0f, 1.0f, 0.0f},
+            {-1.0f, -1.0f, 0.0f},
+            {1.0f, -1.0f, 0.0f},
+            {1.0f, 1.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[1].attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({
+            {0.0f, 0.5f},
+            {0.0f, 0.0f},
+            {1.0f, 0.0f},
+            {1.0f, 0.5f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[1].attribute<Vector3>(MeshAttribute::Normal),
+        Containers::arrayView<Vector3>({
+            {0.0f, -1.0f, 0.0f},
+            {0.0f, -1.0f, 0.0f},
+            {0.0f, -1.0f, 0.0f},
+            {0.0f, -1.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(chunks[1].indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 2, 0, 2, 3
+        }), TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshChunksWhole() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-quads.obj")));
+
+    /* With a large enough budget, the chunk is the same as the whole mesh */
+    Containers::Array<MeshData> chunks;
+    CORRADE_VERIFY(importer->meshChunks(0, 0, 1024, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 1);
+    CORRADE_COMPARE(chunks[0].vertexCount(), 7);
+    CORRADE_COMPARE_AS(chunks[0].indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 2, 3, 4, 5, 3, 5, 6
+        }), TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshChunksForwardReferences() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-forward-references.obj")));
+
+    /* Importing the whole mesh sees all positions */
+    Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->indexCount(), 6);
+
+    /* With a budget for just one triangle, the first chunk gets imported
+       before any position is parsed, which is a documented limitation */
+    Containers::Array<MeshData> chunks;
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->meshChunks(0, 0, 108, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 0);
+    CORRADE_COMPARE(out, "Trade::ObjImporter::mesh(): index 1 out of range for 0 vertices\n");
+}
+
+void ObjImporterTest::meshArena() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    /* Allocate something upfront so it's known where the block is */
+    DataArena arena{1024};
+    const char* const block = arena.allocate(1).data();
+    importer->setArena(&arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-primitive-triangles.obj")));
+
+    {
+        const Containers::Optional<MeshData> data = importer->mesh(0);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(data->indexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position),
+            Containers::arrayView<Vector3>({
+                {0.5f, 2.0f, 3.0f},
+                {0.0f, 1.5f, 1.0f},
+                {2.0f, 3.0f, 5.0f},
+                {2.5f, 0.0f, 1.0f}
+            }), TestSuite::Compare::Container);
+        CORRADE_COMPARE_AS(data->indices<UnsignedInt>(),
+            Containers::arrayView<UnsignedInt>({0, 1, 2, 3, 1, 0}),
+            TestSuite::Compare::Container);
+
+        /* Both the index and vertex data should be inside the same arena
+           block */
+        CORRADE_COMPARE(arena.blockCount(), 1);
+        CORRADE_COMPARE(arena.size(), 1 + 6*4 + 4*12);
+        CORRADE_VERIFY(data->indexData().begin() > block);
+        CORRADE_VERIFY(data->indexData().end() <= block + arena.blockSize());
+        CORRADE_VERIFY(data->vertexData().begin() > block);
+        CORRADE_VERIFY(data->vertexData().end() <= block + arena.blockSize());
+    }
+
+    /* A non-indexed mesh has just the vertex data in the arena */
+    importer->configuration().setValue("mergeIndexArrays", false);
+    {
+        const Containers::Optional<MeshData> data = importer->mesh(0);
+        CORRADE_VERIFY(data);
+        CORRADE_VERIFY(!data->isIndexed());
+        CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+        CORRADE_COMPARE(data->vertexCount(), 6);
+        CORRADE_COMPARE(arena.blockCount(), 1);
+        CORRADE_COMPARE(arena.size(), 1 + 6*4 + 4*12 + 6*12);
+        CORRADE_VERIFY(data->vertexData().begin() > block);
+        CORRADE_VERIFY(data->vertexData().end() <= block + arena.blockSize());
+    }
+}
+
+void ObjImporterTest::meshChunksArena() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+
+    DataArena arena;
+    importer->setArena(&arena);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-quads.obj")));
+
+    /* Chunks are meant to be processed and discarded right away, so they
+       aren't allocated from the arena */
+    Containers::Array<MeshData> chunks;
+    CORRADE_VERIFY(importer->meshChunks(0, 0, 108, [](MeshData&& chunk, Containers::Array<MeshData>& chunks) {
+        arrayAppend(chunks, Utility::move(chunk));
+        return true;
+    }, chunks));
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(chunks[0].indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(chunks[0].vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(chunks[1].indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(chunks[1].vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(arena.size(), 0);
+    CORRADE_COMPARE(arena.blockCount(), 0);
+}
+
 void ObjImporterTest::meshIgnoredKeyword() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-ignored-keyword.obj")));
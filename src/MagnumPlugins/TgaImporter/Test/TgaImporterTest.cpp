@@ -34,6 +34,7 @@
 
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
 
 #include "configure.h"
@@ -58,6 +59,8 @@ struct TgaImporterTest: TestSuite::Tester {
     void tga2();
     void fileTooLong();
 
+    void arena();
+
     void openMemory();
     void openTwice();
     void importTwice();
@@ -102,6 +105,14 @@ constexpr const char Color24Rle[] = {
     '\x82', 4, 5, 6
 };
 
+const struct {
+    const char* name;
+    Containers::ArrayView<const char> data;
+} ArenaData[]{
+    {"", Color24},
+    {"RLE", Color24Rle},
+};
+
 /* Separate from ErrorData so we can just slice existing arrays instead of
    creating new ones from scratch */
 const struct {
@@ -294,6 +305,9 @@ TgaImporterTest::TgaImporterTest() {
     addInstancedTests({&TgaImporterTest::fileTooLong},
         Containers::arraySize(FileTooLongData));
 
+    addInstancedTests({&TgaImporterTest::arena},
+        Containers::arraySize(ArenaData));
+
     addInstancedTests({&TgaImporterTest::openMemory},
         Containers::arraySize(OpenMemoryData));
 
@@ -612,6 +626,35 @@ void TgaImporterTest::openTwice() {
     /* Shouldn't crash, leak or anything */
 }
 
+void TgaImporterTest::arena() {
+    auto&& data = ArenaData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    /* Allocate something upfront so it's known where the block is */
+    DataArena arena{1024};
+    const char* const block = arena.allocate(1).data();
+    importer->setArena(&arena);
+    CORRADE_VERIFY(importer->openData(data.data));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned|DataFlag::Mutable);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+
+    /* The image data should be inside the same arena block */
+    CORRADE_COMPARE(arena.blockCount(), 1);
+    CORRADE_COMPARE(arena.size(), 1 + 2*3*3);
+    CORRADE_VERIFY(image->data().begin() > block);
+    CORRADE_VERIFY(image->data().end() <= block + arena.blockSize());
+
+    /* The BGR to RGB conversion is done in the arena as well */
+    CORRADE_COMPARE_AS(image->data().prefix(6), Containers::arrayView<char>({
+        3, 2, 1, 4, 3, 2
+    }), TestSuite::Compare::Container);
+}
+
 void TgaImporterTest::importTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(TGAIMPORTER_TEST_DIR, "file.tga")));
@@ -35,6 +35,7 @@
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Math/Swizzle.h"
 #include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/DataArena.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
@@ -182,8 +183,17 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         }
     }
 
+    /* Output data, allocated from the arena if there's one */
+    Containers::Array<char> ownedData;
+    Containers::ArrayView<char> data;
+    if(arena())
+        data = arena()->allocate(outputSize);
+    else {
+        ownedData = Containers::Array<char>{NoInit, outputSize};
+        data = ownedData;
+    }
+
     /* Copy data directly if not RLE */
-    Containers::Array<char> data{NoInit, outputSize};
     if(!rle) {
         if(srcPixels.size() < outputSize) {
             Error{} << "Trade::TgaImporter::image2D(): file too short, expected" << outputSize + sizeof(Implementation::TgaHeader) << "bytes but got" << _in.size();
@@ -258,7 +268,9 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
             pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
     }
 
-    return ImageData2D{storage, format, size, Utility::move(data)};
+    if(arena())
+        return ImageData2D{storage, format, size, DataFlag::ExternallyOwned|DataFlag::Mutable, data};
+    return ImageData2D{storage, format, size, Utility::move(ownedData)};
 }
 
 }}